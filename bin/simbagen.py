@@ -146,6 +146,23 @@ const FAR struct setting_t settings[] = {{
 }};
 
 const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE] = {{{default_data}}};
+
+{hash}
+"""
+
+SETTINGS_HASH_FMT = """\
+static const FAR int16_t settings_hash_displacements[] = {{{displacements}}};
+static const FAR uint16_t settings_hash_indexes[] = {{{indexes}}};
+
+const FAR struct settings_hash_t settings_hash = {{
+    .size = {size},
+    .displacements_p = settings_hash_displacements,
+    .indexes_p = settings_hash_indexes
+}};
+"""
+
+SETTINGS_HASH_EMPTY = """\
+const FAR struct settings_hash_t settings_hash = { 0, NULL, NULL };
 """
 
 SETTING_HELPER_FUNCTIONS = """\
@@ -468,10 +485,99 @@ class Settings(object):
         default_data = ', '.join([str(byte)
                                   for byte in bytearray(self.as_binary())])
 
+        if len(self.settings) > 0:
+            displacements, indexes = create_settings_hash(
+                list(self.settings.keys()))
+            settings_hash = SETTINGS_HASH_FMT.format(
+                displacements=', '.join([str(v) for v in displacements]),
+                indexes=', '.join([str(v) for v in indexes]),
+                size=len(indexes))
+        else:
+            settings_hash = SETTINGS_HASH_EMPTY
+
         return SETTINGS_FMT.format(names='\n'.join(names),
                                    functions='\n'.join(functions),
                                    array='\n'.join(array),
-                                   default_data=default_data)
+                                   default_data=default_data,
+                                   hash=settings_hash)
+
+
+def hash_setting_name(seed, name):
+    """FNV-1a hash of given setting name. A non-zero seed replaces the
+    offset basis. Must match hash_name() in src/oam/settings.c.
+
+    """
+
+    value = seed if seed != 0 else 0x811c9dc5
+
+    for byte in bytearray(name.encode('ascii')):
+        value ^= byte
+        value = ((value * 0x01000193) & 0xffffffff)
+
+    return value
+
+
+def create_settings_hash(names):
+    """Create a minimal perfect hash of given setting names using hash
+    and displace. Returns the displacement and index tables, both with
+    one entry per setting.
+
+    """
+
+    size = len(names)
+    buckets = [[] for _ in range(size)]
+
+    for index, name in enumerate(names):
+        buckets[hash_setting_name(0, name) % size].append(index)
+
+    displacements = [0] * size
+    indexes = [None] * size
+
+    # Place the largest buckets first, while most slots are free.
+    order = sorted(range(size), key=lambda slot: -len(buckets[slot]))
+
+    for slot in order:
+        bucket = buckets[slot]
+
+        if len(bucket) <= 1:
+            break
+
+        seed = 1
+
+        while True:
+            if seed > 32767:
+                sys.exit("error: failed to create the settings hash")
+
+            slots = [hash_setting_name(seed, names[index]) % size
+                     for index in bucket]
+
+            if (len(set(slots)) == len(slots)
+                and all([indexes[s] is None for s in slots])):
+                break
+
+            seed += 1
+
+        displacements[slot] = seed
+
+        for index, s in zip(bucket, slots):
+            indexes[s] = index
+
+    # Single name buckets are stored directly as -(slot + 1).
+    free = [slot for slot in range(size) if indexes[slot] is None]
+
+    for slot in order:
+        bucket = buckets[slot]
+
+        if len(bucket) != 1:
+            continue
+
+        s = free.pop()
+        displacements[slot] = -s - 1
+        indexes[s] = bucket[0]
+
+    indexes = [0 if index is None else index for index in indexes]
+
+    return displacements, indexes
 
 
 class EepromSoft(object):
@@ -594,6 +700,12 @@ class SoamDb(object):
             generated_id,
             decoder_fmtstr)
 
+        # Argument types of binary log points.
+        types = re.findall(r'%-?[0-9]*?l?([dsuxcfS])', soam_fmtstr)
+        self.decoder_format_strings += 'ARG: 0x{:x} "{}"\n'.format(
+            generated_id,
+            ''.join(types))
+
     def parse_cmd(self, fin):
         command = fin.readline().strip()
         c_variable = fin.readline().strip()
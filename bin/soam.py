@@ -56,6 +56,7 @@ SOAM_TYPE_DATABASE_ID_REQUEST          = 8
 SOAM_TYPE_DATABASE_ID_RESPONSE         = 9
 SOAM_TYPE_DATABASE_REQUEST             = 10
 SOAM_TYPE_DATABASE_RESPONSE            = 11
+SOAM_TYPE_LOG_POINT_BINARY             = 12
 SOAM_TYPE_INVALID_TYPE                 = 15
 
 SOAM_SEGMENT_SIZE_MIN = 7
@@ -154,6 +155,56 @@ def format_log_point(database, packet):
     return formatted_string
 
 
+def format_log_points_binary(database, packet):
+    """Format given packet of binary log points. Each log point is the
+    format identity followed by its raw arguments.
+
+    """
+
+    formatted_strings = []
+    offset = 0
+
+    while offset < len(packet):
+        identity = struct.unpack('>H', packet[offset:offset + 2])[0]
+        offset += 2
+
+        try:
+            fmt = database.formats[identity]
+            types = database.argument_types[identity]
+        except KeyError:
+            formatted_strings.append(
+                'warning: 0x{:x}: unknown log point\n'.format(identity))
+            break
+
+        args = []
+
+        for kind in types:
+            if kind in 'di':
+                args.append(struct.unpack('>i', packet[offset:offset + 4])[0])
+                offset += 4
+            elif kind == 'u':
+                args.append(struct.unpack('>I', packet[offset:offset + 4])[0])
+                offset += 4
+            elif kind == 'x':
+                value = struct.unpack('>I', packet[offset:offset + 4])[0]
+                args.append('{:x}'.format(value))
+                offset += 4
+            elif kind == 'f':
+                args.append(struct.unpack('>f', packet[offset:offset + 4])[0])
+                offset += 4
+            elif kind == 'c':
+                args.append(packet[offset:offset + 1].decode('ascii'))
+                offset += 1
+            else:
+                end = packet.index(b'\x00', offset)
+                args.append(packet[offset:end].decode('ascii'))
+                offset = end + 1
+
+        formatted_strings.append(fmt.format(*args))
+
+    return ''.join(formatted_strings)
+
+
 class Database(object):
     """The SOAM database.
 
@@ -161,6 +212,7 @@ class Database(object):
 
     def __init__(self):
         self.formats = {}
+        self.argument_types = {}
         self.commands = {}
         self.command_id_to_string = {}
 
@@ -185,6 +237,8 @@ class Database(object):
 
             if kind == 'FMT:':
                 self.formats[identity] = string
+            elif kind == 'ARG:':
+                self.argument_types[identity] = string
             elif kind == 'CMD:':
                 self.commands[string] = identity
                 self.command_id_to_string[identity] = string
@@ -311,6 +365,11 @@ class ReaderThread(threading.Thread):
             elif packet_type == SOAM_TYPE_LOG_POINT:
                 formatted_string = format_log_point(self.client.database, packet)
                 print(formatted_string, end='', file=self.ostream)
+            elif packet_type == SOAM_TYPE_LOG_POINT_BINARY:
+                formatted_string = format_log_points_binary(
+                    self.client.database,
+                    packet)
+                print(formatted_string, end='', file=self.ostream)
             elif packet_type in [SOAM_TYPE_COMMAND_RESPONSE_DATA_PRINTF,
                                  SOAM_TYPE_COMMAND_RESPONSE_DATA_BINARY]:
                 response_data.append((packet_type, transaction_id, packet))
@@ -26,6 +26,18 @@ TYPE_I2C_DEVICE_REQUEST                =  9
 TYPE_I2C_DEVICE_RESPONSE               = 10
 
 
+# Protocol versions. The version is stored in the upper 16 bits of
+# the request and response types.
+VERSION_1 = 1
+VERSION_2 = 2
+VERSION_SHIFT = 16
+TYPE_MASK = 0xffff
+
+# Version 2 frame header; payload size and timestamp in microseconds.
+FRAME_HEADER_FMT = '>IQ'
+FRAME_HEADER_SIZE = 12
+
+
 # Maps device type strings to request types.
 REQUEST_TYPE_FROM_STRING = {
     'uart': TYPE_UART_DEVICE_REQUEST,
@@ -55,9 +67,16 @@ class DeviceAlreadyInUseError(Exception):
 
 class SocketDevice(object):
 
-    def __init__(self, device_type, device_name, address=None, port=None):
+    def __init__(self,
+                 device_type,
+                 device_name,
+                 address=None,
+                 port=None,
+                 version=VERSION_1):
         self.device_type = device_type
         self.device_name = device_name
+        self.version = version
+        self.rxbuf = b''
 
         if address is None:
             address = 'localhost'
@@ -112,13 +131,17 @@ class SocketDevice(object):
                   end='')
 
             request_type = REQUEST_TYPE_FROM_STRING[self.device_type]
+
+            if self.version != VERSION_1:
+                request_type |= (self.version << VERSION_SHIFT)
+
             request = struct.pack('>II', request_type, len(self.device_name))
             request += self.device_name.encode('utf-8')
 
-            self.write(request)
+            self.socket.sendall(request)
 
             # Read the header.
-            response = self.read(8)
+            response = self.read_raw(8)
 
             if len(response) != 8:
                 raise RuntimeError('error: bad response length {}'.format(
@@ -138,7 +161,7 @@ class SocketDevice(object):
                     size))
 
             # Read the data.
-            data = self.read(size)
+            data = self.read_raw(size)
 
             if len(data) != size:
                 raise RuntimeError('error: bad response data length {}'.format(
@@ -162,10 +185,20 @@ class SocketDevice(object):
             print('failed.', flush=True)
             raise
 
-    def write(self, buf):
+    def write(self, buf, timestamp=0):
+        """Write given data to the device. The data is delivered to the
+        device when its clock reaches given timestamp in microseconds
+        in protocol version 2, which makes it possible to replay
+        recorded input faster than real time.
+
+        """
+
+        if self.version == VERSION_2:
+            buf = struct.pack(FRAME_HEADER_FMT, len(buf), timestamp) + buf
+
         self.socket.sendall(buf)
 
-    def read(self, length=1):
+    def read_raw(self, length):
         buf = b''
 
         while len(buf) < length:
@@ -178,6 +211,43 @@ class SocketDevice(object):
 
         return buf
 
+    def read_frame(self):
+        """Read a protocol version 2 frame. Returns a tuple of the
+        timestamp in microseconds and the payload, or None if the
+        connection was closed.
+
+        """
+
+        header = self.read_raw(FRAME_HEADER_SIZE)
+
+        if len(header) != FRAME_HEADER_SIZE:
+            return None
+
+        size, timestamp = struct.unpack(FRAME_HEADER_FMT, header)
+        payload = self.read_raw(size)
+
+        if len(payload) != size:
+            return None
+
+        return timestamp, payload
+
+    def read(self, length=1):
+        if self.version == VERSION_1:
+            return self.read_raw(length)
+
+        while len(self.rxbuf) < length:
+            frame = self.read_frame()
+
+            if frame is None:
+                break
+
+            self.rxbuf += frame[1]
+
+        buf = self.rxbuf[:length]
+        self.rxbuf = self.rxbuf[length:]
+
+        return buf
+
     def readline(self):
         """Read a line.
 
@@ -186,7 +256,7 @@ class SocketDevice(object):
         buf = b''
 
         while True:
-            data = self.socket.recv(1)
+            data = self.read(1)
 
             if not data:
                 break
@@ -263,12 +333,12 @@ def reader_line_main(device):
             print(prefix, line)
 
 
-def monitor(device_type, device_name, address, port):
+def monitor(device_type, device_name, address, port, version):
     """Monitor given device.
 
     """
 
-    device = SocketDevice(device_type, device_name, address, port)
+    device = SocketDevice(device_type, device_name, address, port, version)
     device.start()
     reader = threading.Thread(target=reader_main, args=(device, ))
     reader.setDaemon(True)
@@ -278,12 +348,12 @@ def monitor(device_type, device_name, address, port):
         device.write(sys.stdin.read(1).encode('utf-8'))
 
 
-def monitor_escaped_line(device_type, device_name, address, port):
+def monitor_escaped_line(device_type, device_name, address, port, version):
     """Monitor given device.
 
     """
 
-    device = SocketDevice(device_type, device_name, address, port)
+    device = SocketDevice(device_type, device_name, address, port, version)
     device.start()
     reader = threading.Thread(target=reader_line_main, args=(device, ))
     reader.setDaemon(True)
@@ -299,12 +369,12 @@ def monitor_escaped_line(device_type, device_name, address, port):
         device.write(line.encode('utf-8'))
 
 
-def monitor_hex_line(device_type, device_name, address, port):
+def monitor_hex_line(device_type, device_name, address, port, version):
     """Monitor given device.
 
     """
 
-    device = SocketDevice(device_type, device_name, address, port)
+    device = SocketDevice(device_type, device_name, address, port, version)
     device.start()
     reader = threading.Thread(target=reader_hex_line_main, args=(device, ))
     reader.setDaemon(True)
@@ -320,12 +390,12 @@ def monitor_hex_line(device_type, device_name, address, port):
         device.write(line)
 
 
-def monitor_line(device_type, device_name, address, port):
+def monitor_line(device_type, device_name, address, port, version):
     """Monitor given device.
 
     """
 
-    device = SocketDevice(device_type, device_name, address, port)
+    device = SocketDevice(device_type, device_name, address, port, version)
     device.start()
     reader = threading.Thread(target=reader_line_main, args=(device, ))
     reader.setDaemon(True)
@@ -341,7 +411,7 @@ def monitor_line(device_type, device_name, address, port):
         device.write(line.encode('utf-8'))
 
 
-def request_all_devices(device_type, address, port):
+def request_all_devices(device_type, address, port, version):
     """Request all devices of given type.
 
     """
@@ -351,7 +421,11 @@ def request_all_devices(device_type, address, port):
 
     while True:
         try:
-            device = SocketDevice(device_type, str(index), address, port)
+            device = SocketDevice(device_type,
+                                  str(index),
+                                  address,
+                                  port,
+                                  version)
             device.start()
             reader = threading.Thread(target=reader_main, args=(device, ))
             reader.setDaemon(True)
@@ -367,7 +441,7 @@ def request_all_devices(device_type, address, port):
     return devices
 
 
-def request_all_line_devices(device_type, address, port):
+def request_all_line_devices(device_type, address, port, version):
     """Request all line devices of given type.
 
     """
@@ -377,7 +451,11 @@ def request_all_line_devices(device_type, address, port):
 
     while True:
         try:
-            device = SocketDevice(device_type, str(index), address, port)
+            device = SocketDevice(device_type,
+                                  str(index),
+                                  address,
+                                  port,
+                                  version)
             device.start()
             reader = threading.Thread(target=reader_line_main, args=(device, ))
             reader.setDaemon(True)
@@ -394,45 +472,78 @@ def request_all_line_devices(device_type, address, port):
 
 
 def do_pin(args):
-    monitor_line('pin', args.device, args.address, args.port)
+    monitor_line('pin',
+                 args.device,
+                 args.address,
+                 args.port,
+                 args.protocol_version)
 
 
 def do_uart(args):
     if args.mode == 'escaped':
-        monitor_escaped_line('uart', args.device, args.address, args.port)
+        monitor_escaped_line('uart',
+                             args.device,
+                             args.address,
+                             args.port,
+                             args.protocol_version)
     elif args.mode == 'hex':
-        monitor_hex_line('uart', args.device, args.address, args.port)
+        monitor_hex_line('uart',
+                         args.device,
+                         args.address,
+                         args.port,
+                         args.protocol_version)
     else:
-        monitor('uart', args.device, args.address, args.port)
+        monitor('uart',
+                args.device,
+                args.address,
+                args.port,
+                args.protocol_version)
 
 def do_pwm(args):
-    monitor_line('pwm', args.device, args.address, args.port)
+    monitor_line('pwm',
+                 args.device,
+                 args.address,
+                 args.port,
+                 args.protocol_version)
 
 
 def do_can(args):
-    monitor_line('can', args.device, args.address, args.port)
+    monitor_line('can',
+                 args.device,
+                 args.address,
+                 args.port,
+                 args.protocol_version)
 
 
 def do_i2c(args):
-    monitor_line('i2c', args.device, args.address, args.port)
+    monitor_line('i2c',
+                 args.device,
+                 args.address,
+                 args.port,
+                 args.protocol_version)
 
 
 def do_monitor(args):
     uart_devices = request_all_devices('uart',
                                        args.address,
-                                       args.port)
+                                       args.port,
+                                       args.protocol_version)
     pin_devices = request_all_line_devices('pin',
                                            args.address,
-                                           args.port)
+                                           args.port,
+                                           args.protocol_version)
     pwm_devices = request_all_line_devices('pwm',
                                            args.address,
-                                           args.port)
+                                           args.port,
+                                           args.protocol_version)
     can_devices = request_all_line_devices('can',
                                            args.address,
-                                           args.port)
+                                           args.port,
+                                           args.protocol_version)
     i2c_devices = request_all_line_devices('i2c',
                                            args.address,
-                                           args.port)
+                                           args.port,
+                                           args.protocol_version)
 
     input('Press <Enter> to exit.')
 
@@ -448,6 +559,11 @@ def main():
                         type=int,
                         default=47000,
                         help='TCP port to connect to (default: 47000).')
+    parser.add_argument('-v', '--protocol-version',
+                        type=int,
+                        choices=[VERSION_1, VERSION_2],
+                        default=VERSION_1,
+                        help='Socket device protocol version (default: 1).')
 
     # Workaround to make the subparser required in Python 3.
     subparsers = parser.add_subparsers(title='subcommands',
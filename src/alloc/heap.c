@@ -181,6 +181,8 @@ int heap_init(struct heap_t *self_p,
     }
 
     self_p->dynamic.free_p = NULL;
+    self_p->statistics.allocs = 0;
+    self_p->statistics.frees = 0;
 
     return (mutex_init(&self_p->mutex));
 }
@@ -201,6 +203,10 @@ void *heap_alloc(struct heap_t *self_p,
         buf_p = alloc_dynamic_size(self_p, size);
     }
 
+    if (buf_p != NULL) {
+        self_p->statistics.allocs++;
+    }
+
     mutex_unlock(&self_p->mutex);
 
     return (buf_p);
@@ -225,6 +231,8 @@ int heap_free(struct heap_t *self_p,
 
         /* Free when count is zero. */
         if (count == 0) {
+            self_p->statistics.frees++;
+
             if (header_p->u.fixed_p != NULL) {
                 count = free_fixed_size(self_p, header_p);
             } else {
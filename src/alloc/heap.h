@@ -57,6 +57,11 @@ struct heap_t {
     struct heap_fixed_t fixed[HEAP_FIXED_SIZES_MAX];
     struct heap_dynamic_t dynamic;
     struct mutex_t mutex;
+    /* Number of allocated and freed buffers since initialization. */
+    struct {
+        uint32_t allocs;
+        uint32_t frees;
+    } statistics;
 };
 
 /**
@@ -64,6 +64,8 @@
 
 #define adc_0_dev adc_device[0]
 
+#define dac_0_dev dac_device[0]
+
 #define pin_dac0_dev pin_device[10]
 #define pin_dac1_dev pin_device[11]
 
@@ -39,6 +39,7 @@
 #define PORT_HAS_XBEE
 #define PORT_HAS_XBEE_CLIENT
 #define PORT_HAS_HX711
+#define PORT_HAS_SENSOR_HUB
 #define PORT_HAS_GNSS
 #define PORT_HAS_HD44780
 #define PORT_HAS_JTAG_SOFT
@@ -317,6 +318,23 @@
 #    define CONFIG_LINUX_SOCKET_DEVICE                      0
 #endif
 
+/**
+ * Input buffer size per linux socket device client. A protocol
+ * version 2 frame must fit in the buffer.
+ */
+#ifndef CONFIG_LINUX_SOCKET_DEVICE_BUFFER_SIZE
+#    define CONFIG_LINUX_SOCKET_DEVICE_BUFFER_SIZE       4096
+#endif
+
+/**
+ * Run the linux system tick this many times faster than real
+ * time. Timers, sleeps and timeouts all expire sooner, which makes
+ * long running simulations finish faster. One(1) for real time.
+ */
+#ifndef CONFIG_LINUX_TIME_SPEEDUP
+#    define CONFIG_LINUX_TIME_SPEEDUP                          1
+#endif
+
 /**
  * Enable the adc driver.
  */
@@ -675,6 +693,19 @@
 #    endif
 #endif
 
+/**
+ * Maximum number of started software PWM drivers, at most 32. The
+ * period is divided into this number of phases. Each channel uses
+ * about 46 bytes of RAM on AVR.
+ */
+#ifndef CONFIG_PWM_SOFT_CHANNELS_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_PWM_SOFT_CHANNELS_MAX                4
+#    else
+#        define CONFIG_PWM_SOFT_CHANNELS_MAX                8
+#    endif
+#endif
+
 /**
  * Enable the sd driver.
  */
@@ -819,6 +850,15 @@
 #    define CONFIG_XBEE_DATA_MAX                          120
 #endif
 
+/**
+ * Size of the xbee driver receive buffer in bytes. Bytes available in
+ * the transport channel are read into this buffer in chunks of up to
+ * this size, and frames are parsed from the buffer.
+ */
+#ifndef CONFIG_XBEE_RX_BUFFER_SIZE
+#    define CONFIG_XBEE_RX_BUFFER_SIZE                     32
+#endif
+
 /**
  * Enable the xbee_client driver.
  */
@@ -844,6 +884,14 @@
 #    define CONFIG_XBEE_CLIENT_RESPONSE_TIMEOUT_MS       1000
 #endif
 
+/**
+ * Maximum number of xbee_client requests waiting for a response from
+ * the XBee at the same time.
+ */
+#ifndef CONFIG_XBEE_CLIENT_PENDING_REQUESTS_MAX
+#    define CONFIG_XBEE_CLIENT_PENDING_REQUESTS_MAX         4
+#endif
+
 /**
  * Enable the hx711 driver.
  */
@@ -855,6 +903,25 @@
 #    endif
 #endif
 
+/**
+ * Enable the sensor hub.
+ */
+#ifndef CONFIG_SENSOR_HUB
+#    if defined(CONFIG_MINIMAL_SYSTEM) || !defined(PORT_HAS_SENSOR_HUB)
+#        define CONFIG_SENSOR_HUB                           0
+#    else
+#        define CONFIG_SENSOR_HUB                           1
+#    endif
+#endif
+
+/**
+ * Maximum size in bytes of a sample read from a sensor by the sensor
+ * hub.
+ */
+#ifndef CONFIG_SENSOR_HUB_SAMPLE_SIZE_MAX
+#    define CONFIG_SENSOR_HUB_SAMPLE_SIZE_MAX              16
+#endif
+
 /**
  * Enable the gnss driver.
  */
@@ -873,6 +940,24 @@
 #    define CONFIG_GNSS_DEBUG_LOG_MASK                     -1
 #endif
 
+/**
+ * Size of the GNSS driver receive buffer in bytes. Bytes available in
+ * the transport channel are read into this buffer in chunks of up to
+ * this size, and sentences are framed in the buffer.
+ */
+#ifndef CONFIG_GNSS_RX_BUFFER_SIZE
+#    define CONFIG_GNSS_RX_BUFFER_SIZE                     64
+#endif
+
+/**
+ * Maximum UBX frame payload size in bytes. Longer frames are rejected
+ * as a false frame start, and the GNSS driver looks for the next
+ * frame in the bytes after the sync characters.
+ */
+#ifndef CONFIG_GNSS_UBX_PAYLOAD_SIZE_MAX
+#    define CONFIG_GNSS_UBX_PAYLOAD_SIZE_MAX             1024
+#endif
+
 /**
  * Enable the bmp280 driver.
  */
@@ -1444,6 +1529,30 @@
 #    endif
 #endif
 
+/**
+ * Asynchronous i2c transactions executed by an i2c thread, started
+ * when the first transaction is queued.
+ */
+#ifndef CONFIG_I2C_TRANSACTION
+#    if defined(ARCH_AVR)
+#        define CONFIG_I2C_TRANSACTION                      0
+#    else
+#        define CONFIG_I2C_TRANSACTION                      1
+#    endif
+#endif
+
+/**
+ * Stack size of the i2c transaction thread. Transaction callbacks are
+ * called from this thread.
+ */
+#ifndef CONFIG_I2C_TRANSACTION_STACK_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_I2C_TRANSACTION_STACK_SIZE        2048
+#    else
+#        define CONFIG_I2C_TRANSACTION_STACK_SIZE         512
+#    endif
+#endif
+
 /**
  * Debug file system command to list all log objects.
  */
@@ -1612,6 +1721,19 @@
 #    define CONFIG_FS_PATH_MAX                             64
 #endif
 
+/**
+ * Number of buckets in the debug file system command index, used by
+ * `fs_call()` to find commands without searching the whole command
+ * list. Must be a power of two. Set to zero(0) to disable the index.
+ */
+#ifndef CONFIG_FS_COMMAND_INDEX_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_FS_COMMAND_INDEX_SIZE                0
+#    else
+#        define CONFIG_FS_COMMAND_INDEX_SIZE               32
+#    endif
+#endif
+
 /**
  * Debug file system command to append to a file.
  */
@@ -1774,6 +1896,40 @@
 #    define CONFIG_SETTINGS_BLOB                            1
 #endif
 
+/**
+ * Keep a RAM copy of the settings area. Reads are served from RAM and
+ * writes are collected in a dirty range that is written to NVM by
+ * `settings_sync()`.
+ */
+#ifndef CONFIG_SETTINGS_CACHE
+#    if defined(ARCH_AVR)
+#        define CONFIG_SETTINGS_CACHE                       0
+#    else
+#        define CONFIG_SETTINGS_CACHE                       1
+#    endif
+#endif
+
+/**
+ * Number of milliseconds after the last cached settings write before
+ * the dirty range is written to NVM by the settings sync thread. Zero
+ * (0) writes and syncs NVM in each `settings_write()`, which is slow.
+ * Call `settings_sync()` before a reset to not lose recent writes.
+ */
+#ifndef CONFIG_SETTINGS_SYNC_DELAY_MS
+#    define CONFIG_SETTINGS_SYNC_DELAY_MS                 100
+#endif
+
+/**
+ * Stack size of the settings sync thread.
+ */
+#ifndef CONFIG_SETTINGS_SYNC_STACK_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_SETTINGS_SYNC_STACK_SIZE          2048
+#    else
+#        define CONFIG_SETTINGS_SYNC_STACK_SIZE           512
+#    endif
+#endif
+
 /**
  * Maximum number of characters in a shell command.
  */
@@ -1800,6 +1956,25 @@
 #    endif
 #endif
 
+/**
+ * Shell batch mode for scripted command execution, entered with the
+ * shell command ``batch``.
+ */
+#ifndef CONFIG_SHELL_BATCH
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_SHELL_BATCH                          0
+#    else
+#        define CONFIG_SHELL_BATCH                          1
+#    endif
+#endif
+
+/**
+ * Size of the shell batch mode input buffer.
+ */
+#ifndef CONFIG_SHELL_BATCH_BUFFER_SIZE
+#    define CONFIG_SHELL_BATCH_BUFFER_SIZE                128
+#endif
+
 /**
  * The shell prompt string.
  */
@@ -1828,6 +2003,30 @@
 #    endif
 #endif
 
+/**
+ * Asynchronous SPI transactions executed by a SPI thread, started
+ * when the first transaction is queued.
+ */
+#ifndef CONFIG_SPI_TRANSACTION
+#    if defined(ARCH_AVR)
+#        define CONFIG_SPI_TRANSACTION                      0
+#    else
+#        define CONFIG_SPI_TRANSACTION                      1
+#    endif
+#endif
+
+/**
+ * Stack size of the SPI transaction thread. Transaction callbacks are
+ * called from this thread.
+ */
+#ifndef CONFIG_SPI_TRANSACTION_STACK_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_SPI_TRANSACTION_STACK_SIZE        2048
+#    else
+#        define CONFIG_SPI_TRANSACTION_STACK_SIZE         512
+#    endif
+#endif
+
 /**
  * FAT16 is a file system.
  */
@@ -1900,6 +2099,64 @@
 #    endif
 #endif
 
+/**
+ * Console UART TX ring buffer size. Output written to the console is
+ * buffered and written to the UART by a low priority thread, so the
+ * writer does not wait for the UART. Set to zero(0) to write directly
+ * to the UART.
+ */
+#ifndef CONFIG_START_CONSOLE_UART_TX_BUFFER_SIZE
+#    define CONFIG_START_CONSOLE_UART_TX_BUFFER_SIZE         0
+#endif
+
+/**
+ * Block the writer until there is space in the TX ring buffer.
+ */
+#define CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK          0
+
+/**
+ * Drop output that does not fit in the TX ring buffer.
+ */
+#define CONFIG_START_CONSOLE_UART_TX_OVERFLOW_DROP           1
+
+/**
+ * Console UART TX ring buffer overflow policy, one of
+ * ``CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK`` and
+ * ``CONFIG_START_CONSOLE_UART_TX_OVERFLOW_DROP``.
+ */
+#ifndef CONFIG_START_CONSOLE_UART_TX_OVERFLOW
+#    define CONFIG_START_CONSOLE_UART_TX_OVERFLOW \
+    CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK
+#endif
+
+/**
+ * Maximum number of milliseconds `console_flush()` waits for the
+ * console UART TX ring buffer to be empty.
+ */
+#ifndef CONFIG_START_CONSOLE_UART_TX_FLUSH_TIMEOUT_MS
+#    define CONFIG_START_CONSOLE_UART_TX_FLUSH_TIMEOUT_MS 1000
+#endif
+
+/**
+ * Console UART TX thread priority.
+ */
+#ifndef CONFIG_START_CONSOLE_UART_TX_PRIO
+#    define CONFIG_START_CONSOLE_UART_TX_PRIO              100
+#endif
+
+/**
+ * Console UART TX thread stack size.
+ */
+#ifndef CONFIG_START_CONSOLE_UART_TX_STACK_SIZE
+#    if defined(ARCH_LINUX)
+#        define CONFIG_START_CONSOLE_UART_TX_STACK_SIZE   2048
+#    elif defined(FAMILY_ESP) || defined(FAMILY_ESP32)
+#        define CONFIG_START_CONSOLE_UART_TX_STACK_SIZE    768
+#    else
+#        define CONFIG_START_CONSOLE_UART_TX_STACK_SIZE    256
+#    endif
+#endif
+
 /**
  * Console USB CDC control interface number.
  */
@@ -2019,6 +2276,15 @@
 #    endif
 #endif
 
+/**
+ * Linux only. Maximum number of bytes in the non-volatile memory
+ * write-ahead journal before it is emptied by an implicit
+ * `nvm_sync()`.
+ */
+#ifndef CONFIG_NVM_JOURNAL_SIZE_MAX
+#    define CONFIG_NVM_JOURNAL_SIZE_MAX                 16384
+#endif
+
 /**
  * Use the software EEPROM implementation in the non-volatile memory
  * module.
@@ -2164,6 +2430,14 @@
 #    define CONFIG_START_SOAM_PRIO                         30
 #endif
 
+/**
+ * Maximum SOAM packet size in bytes of the started SOAM. Set it to
+ * the link MTU for best throughput, at most 1024.
+ */
+#ifndef CONFIG_START_SOAM_PACKET_SIZE
+#    define CONFIG_START_SOAM_PACKET_SIZE                 128
+#endif
+
 /**
  * SOAM thread stack size in words.
  */
@@ -2178,10 +2452,18 @@
 #endif
 
 /**
- * Maximum number of bytes in the print output buffer.
+ * Maximum number of bytes in the print output buffer, allocated on
+ * the stack of the printing thread. The buffer is written to the
+ * output channel when full.
  */
 #ifndef CONFIG_STD_OUTPUT_BUFFER_MAX
-#    define CONFIG_STD_OUTPUT_BUFFER_MAX                   16
+#    if defined(ARCH_AVR)
+#        define CONFIG_STD_OUTPUT_BUFFER_MAX               16
+#    elif defined(ARCH_LINUX)
+#        define CONFIG_STD_OUTPUT_BUFFER_MAX              128
+#    else
+#        define CONFIG_STD_OUTPUT_BUFFER_MAX               32
+#    endif
 #endif
 
 /**
@@ -2257,6 +2539,52 @@
 #    define CONFIG_RE_DEBUG_LOG_MASK                       -1
 #endif
 
+/**
+ * Maximum number of instructions in the linear time regular
+ * expression matcher. Patterns that need more instructions are
+ * matched by the backtracking matcher. Set to zero(0) to always use
+ * the backtracking matcher.
+ */
+#ifndef CONFIG_RE_NFA_INSTRUCTIONS_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_RE_NFA_INSTRUCTIONS_MAX             16
+#    else
+#        define CONFIG_RE_NFA_INSTRUCTIONS_MAX             64
+#    endif
+#endif
+
+/**
+ * Number of states in the lazily built DFA cache of a compiled
+ * regular expression. The cache is flushed when full. Set to zero(0)
+ * to disable the cache and only simulate the NFA. The cache is
+ * stored after the pattern in the compiled buffer, and uses
+ * ``CONFIG_RE_NFA_INSTRUCTIONS_MAX`` + 34 bytes per state, a 256
+ * bytes character class table and a mutex, that is about 3.5 KB with
+ * the default values. Patterns compiled into smaller buffers are
+ * matched without the cache.
+ */
+#ifndef CONFIG_RE_DFA_STATES_MAX
+#    if defined(ARCH_AVR)
+#        define CONFIG_RE_DFA_STATES_MAX                   0
+#    else
+#        define CONFIG_RE_DFA_STATES_MAX                   32
+#    endif
+#endif
+
+/**
+ * Number of slots in the property index of a configuration file
+ * object. Must be a power of two. Files with more properties than
+ * fit in the index are searched linearly. Set to zero(0) to disable
+ * the index.
+ */
+#ifndef CONFIG_CONFIGFILE_INDEX_SIZE
+#    if defined(ARCH_AVR)
+#        define CONFIG_CONFIGFILE_INDEX_SIZE                0
+#    else
+#        define CONFIG_CONFIGFILE_INDEX_SIZE               32
+#    endif
+#endif
+
 /**
  * Each thread has a list of environment variables associated with
  * it. A typical example of an environment variable is "CWD" - Current
@@ -2449,6 +2777,29 @@
 #    endif
 #endif
 
+/**
+ * Harness mock heap size in bytes. Set to zero(0) to derive it from
+ * ``CONFIG_HARNESS_MOCK_ENTRIES_MAX``. Suites with large mock data
+ * may set it in their Makefile.
+ */
+#ifndef CONFIG_HARNESS_HEAP_SIZE
+#    define CONFIG_HARNESS_HEAP_SIZE                        0
+#endif
+
+/**
+ * Number of buckets in the harness mock id hash table. Must be a
+ * power of two.
+ */
+#ifndef CONFIG_HARNESS_MOCK_ID_BUCKETS
+#    if defined(BOARD_ARDUINO_NANO) || defined(BOARD_ARDUINO_UNO) || defined(BOARD_ARDUINO_PRO_MICRO)
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS              1
+#    elif defined(ARCH_LINUX) || defined(ARCH_ARM64)
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS            256
+#    else
+#        define CONFIG_HARNESS_MOCK_ID_BUCKETS             16
+#    endif
+#endif
+
 /**
  * Call sys_exit() immediately on test failure to stop the test suite
  * execution as early as possible.
@@ -2457,6 +2808,32 @@
 #    define CONFIG_HARNESS_EARLY_EXIT                       1
 #endif
 
+/**
+ * Number of samples measured per benchmark by the benchmark harness.
+ */
+#ifndef CONFIG_HARNESS_BENCH_SAMPLES
+#    if defined(ARCH_LINUX)
+#        define CONFIG_HARNESS_BENCH_SAMPLES               31
+#    else
+#        define CONFIG_HARNESS_BENCH_SAMPLES               11
+#    endif
+#endif
+
+/**
+ * Targeted duration of a benchmark sample in microseconds. Limited
+ * to half the `time_micros()` maximum value.
+ */
+#ifndef CONFIG_HARNESS_BENCH_SAMPLE_US
+#    define CONFIG_HARNESS_BENCH_SAMPLE_US               2000
+#endif
+
+/**
+ * Print benchmark results as CSV instead of JSON.
+ */
+#ifndef CONFIG_HARNESS_BENCH_CSV
+#    define CONFIG_HARNESS_BENCH_CSV                        0
+#endif
+
 /**
  * Output debug information from the harness.
  */
@@ -2511,6 +2888,14 @@
 #    define CONFIG_TIME_UNIX_TIME_TO_DATE                   1
 #endif
 
+/**
+ * Batch binary SOAM log points into a single packet until the packet
+ * is full, another packet is written or `soam_flush()` is called.
+ */
+#ifndef CONFIG_SOAM_LOG_POINT_BATCH
+#    define CONFIG_SOAM_LOG_POINT_BATCH                     0
+#endif
+
 /**
  * Embed the SOAM database in the application.
  */
@@ -29,6 +29,7 @@
  */
 
 #include "simba.h"
+#include <limits.h>
 
 #if CONFIG_HARNESS_DEBUG == 1
 #    define DPRINT(fmt, ...) std_printf(OSTR(fmt), ##__VA_ARGS__)
@@ -40,11 +41,25 @@
    allocation overhead. */
 #define MOCK_ENTRY_SIZE (sizeof(struct mock_entry_t) + 8 * sizeof(void *))
 
-#define HEAP_SIZE (MOCK_ENTRY_SIZE * CONFIG_HARNESS_MOCK_ENTRIES_MAX)
+#if CONFIG_HARNESS_HEAP_SIZE > 0
+#    define HEAP_SIZE CONFIG_HARNESS_HEAP_SIZE
+#else
+#    define HEAP_SIZE (MOCK_ENTRY_SIZE * CONFIG_HARNESS_MOCK_ENTRIES_MAX)
+#endif
+
+/* All mock entries with the same id, in write order. The id string
+   is copied as the caller's buffer may be reused. */
+struct mock_id_t {
+    struct list_elem_t base;
+    struct mock_id_t *next_p;
+    uint32_t hash;
+    struct list_t entries;
+    char id[1];
+};
 
 struct mock_entry_t {
     struct list_elem_t base;
-    struct entry_t *next_p;
+    struct mock_entry_cb_t *cb_p;
     const char *id_p;
 #if CONFIG_HARNESS_WRITE_BACKTRACE_DEPTH_MAX > 0
     struct {
@@ -59,8 +74,6 @@ struct mock_entry_t {
 };
 
 struct mock_entry_cb_t {
-    struct list_elem_t base;
-    struct mock_entry_t *entry_p;
     harness_mock_cb_t fn;
     char arg[1];
 };
@@ -71,8 +84,10 @@ struct module_t {
         uint8_t buf[HEAP_SIZE];
     } heap;
     struct {
-        struct list_t list;
-        struct list_t cb_list;
+        /* Mock ids hashed by name. */
+        struct mock_id_t *buckets[CONFIG_HARNESS_MOCK_ID_BUCKETS];
+        /* Mock ids in first write order. */
+        struct list_t ids;
     } mock;
     struct mutex_t mutex;
     struct bus_t bus;
@@ -196,27 +211,74 @@ static int free_mock_entry_cb_no_lock(struct mock_entry_cb_t *entry_cb_p)
     return (0);
 }
 
-static struct mock_entry_cb_t *find_mock_entry_cb(struct mock_entry_t *entry_p)
+/**
+ * FNV-1a hash of given mock id.
+ */
+static uint32_t hash_mock_id(const char *id_p)
 {
-    struct list_iter_t iter;
-    struct mock_entry_cb_t *entry_cb_p;
+    uint32_t hash;
 
-    list_iter_init(&iter, &module.mock.cb_list);
+    hash = 2166136261UL;
 
-    while (1) {
-        entry_cb_p = (struct mock_entry_cb_t *)list_iter_next(&iter);
+    while (*id_p != '\0') {
+        hash ^= (uint8_t)*id_p++;
+        hash *= 16777619UL;
+    }
 
-        if (entry_cb_p == NULL) {
-            break;
-        }
+    return (hash);
+}
+
+static struct mock_id_t *find_mock_id_no_lock(const char *id_p,
+                                              uint32_t hash)
+{
+    struct mock_id_t *mock_id_p;
 
-        if (entry_cb_p->entry_p == entry_p) {
-            list_remove(&module.mock.cb_list, entry_cb_p);
+    mock_id_p = module.mock.buckets[hash & (CONFIG_HARNESS_MOCK_ID_BUCKETS - 1)];
+
+    while (mock_id_p != NULL) {
+        if ((mock_id_p->hash == hash)
+            && (strcmp(&mock_id_p->id[0], id_p) == 0)) {
             break;
         }
+
+        mock_id_p = mock_id_p->next_p;
     }
 
-    return (entry_cb_p);
+    return (mock_id_p);
+}
+
+/**
+ * Find given mock id, or create it if missing.
+ */
+static struct mock_id_t *get_mock_id_no_lock(const char *id_p)
+{
+    struct mock_id_t *mock_id_p;
+    struct mock_id_t **bucket_pp;
+    uint32_t hash;
+
+    hash = hash_mock_id(id_p);
+    mock_id_p = find_mock_id_no_lock(id_p, hash);
+
+    if (mock_id_p != NULL) {
+        return (mock_id_p);
+    }
+
+    mock_id_p = heap_alloc(&module.heap.obj,
+                           sizeof(*mock_id_p) + strlen(id_p));
+
+    if (mock_id_p == NULL) {
+        return (NULL);
+    }
+
+    bucket_pp = &module.mock.buckets[hash & (CONFIG_HARNESS_MOCK_ID_BUCKETS - 1)];
+    mock_id_p->next_p = *bucket_pp;
+    strcpy(&mock_id_p->id[0], id_p);
+    mock_id_p->hash = hash;
+    list_init(&mock_id_p->entries);
+    *bucket_pp = mock_id_p;
+    list_add_tail(&module.mock.ids, mock_id_p);
+
+    return (mock_id_p);
 }
 
 static struct mock_entry_t *alloc_mock_entry_no_lock(const char *id_p,
@@ -231,6 +293,7 @@ static struct mock_entry_t *alloc_mock_entry_no_lock(const char *id_p,
 
     if (entry_p != NULL) {
         entry_p->id_p = id_p;
+        entry_p->cb_p = NULL;
     }
 
     return (entry_p);
@@ -265,54 +328,56 @@ static struct mock_entry_t *copy_mock_entry_no_lock(struct mock_entry_t *entry_p
 
     copy_p = alloc_mock_entry_no_lock(entry_p->id_p,
                                       entry_p->data.size);
-    memcpy(copy_p, entry_p, sizeof(*entry_p) + entry_p->data.size - 1);
+
+    if (copy_p != NULL) {
+        memcpy(copy_p, entry_p, sizeof(*entry_p) + entry_p->data.size - 1);
+    }
 
     return (copy_p);
 }
 
 static struct mock_entry_t *find_mock_entry(const char *id_p)
 {
-    struct list_iter_t iter;
+    struct mock_id_t *mock_id_p;
     struct mock_entry_t *entry_p;
     struct mock_entry_t *unmodified_entry_p;
     struct mock_entry_cb_t *entry_cb_p;
     int res;
 
+    entry_p = NULL;
+
     mutex_lock(&module.mutex);
 
-    list_iter_init(&iter, &module.mock.list);
+    mock_id_p = find_mock_id_no_lock(id_p, hash_mock_id(id_p));
 
-    while (1) {
-        entry_p = (struct mock_entry_t *)list_iter_next(&iter);
+    if (mock_id_p != NULL) {
+        entry_p = list_peek_head(&mock_id_p->entries);
+    }
 
-        if (entry_p == NULL) {
-            break;
-        }
+    if (entry_p != NULL) {
+        entry_cb_p = entry_p->cb_p;
 
-        if (strcmp(entry_p->id_p, id_p) == 0) {
-            entry_cb_p = find_mock_entry_cb(entry_p);
+        if (entry_cb_p == NULL) {
+            list_remove_head(&mock_id_p->entries);
+        } else {
+            /* Make a copy of the mock entry since the mock callback
+               may modify it. */
+            unmodified_entry_p = copy_mock_entry_no_lock(entry_p);
 
-            if (entry_cb_p == NULL) {
-                list_remove(&module.mock.list, entry_p);
-            } else {
-                /* Make a copy of the mock entry since the mock
-                   callback may modify it. */
-                unmodified_entry_p = copy_mock_entry_no_lock(entry_p);
+            res = entry_cb_p->fn(&entry_cb_p->arg[0],
+                                 &entry_p->data.buf[0]);
 
-                res = entry_cb_p->fn(&entry_cb_p->arg[0],
-                                     &entry_p->data.buf[0]);
+            if (res == 1) {
+                list_remove_head(&mock_id_p->entries);
+                free_mock_entry_cb_no_lock(entry_cb_p);
+                heap_free(&module.heap.obj, entry_p);
+            }
 
-                if (res == 1) {
-                    list_remove(&module.mock.list, entry_p);
-                    free_mock_entry_cb_no_lock(entry_cb_p);
-                } else {
-                    list_add_tail(&module.mock.cb_list, entry_cb_p);
-                }
+            entry_p = unmodified_entry_p;
 
-                entry_p = unmodified_entry_p;
+            if (entry_p != NULL) {
+                entry_p->cb_p = NULL;
             }
-
-            break;
         }
     }
 
@@ -321,6 +386,36 @@ static struct mock_entry_t *find_mock_entry(const char *id_p)
     return (entry_p);
 }
 
+/**
+ * Append given mock entry to the queue of its id.
+ */
+static int add_mock_entry(struct mock_entry_t *entry_p)
+{
+    struct mock_id_t *mock_id_p;
+
+    mutex_lock(&module.mutex);
+
+    mock_id_p = get_mock_id_no_lock(entry_p->id_p);
+
+    if (mock_id_p != NULL) {
+        entry_p->id_p = &mock_id_p->id[0];
+        list_add_tail(&mock_id_p->entries, entry_p);
+    }
+
+    mutex_unlock(&module.mutex);
+
+    if (mock_id_p == NULL) {
+        std_printf(OSTR("Mock id memory allocation failed for id '%s'\r\n"),
+                   entry_p->id_p);
+        print_write_backtrace();
+        harness_set_testcase_result(-1);
+
+        return (-ENOMEM);
+    }
+
+    return (0);
+}
+
 static int read_mock_entry(struct mock_entry_t *entry_p,
                            const char *id_p,
                            void *buf_p,
@@ -471,13 +566,87 @@ static int print_report_and_stop(void)
     return (0);
 }
 
+static void print_header(void)
+{
+    thrd_sleep_ms(CONFIG_HARNESS_SLEEP_MS);
+
+    std_printf(OSTR("\r\n"));
+
+    std_printf(OSTR("================================== TEST BEGIN =========="
+                    "========================\r\n\r\n"));
+    std_printf(sys_get_info());
+    std_printf(OSTR("\r\n"));
+}
+
+static long bench_sample(struct harness_bench_t *bench_p,
+                         long iterations)
+{
+    long i;
+    int start;
+
+    start = time_micros();
+
+    for (i = 0; i < iterations; i++) {
+        bench_p->callback(bench_p->arg_p);
+    }
+
+    return (time_micros_elapsed(start, time_micros()));
+}
+
+static void bench_sort(long *samples_p, int length)
+{
+    int i;
+    int j;
+    long sample;
+
+    for (i = 1; i < length; i++) {
+        sample = samples_p[i];
+
+        for (j = i; (j > 0) && (samples_p[j - 1] > sample); j--) {
+            samples_p[j] = samples_p[j - 1];
+        }
+
+        samples_p[j] = sample;
+    }
+}
+
+static void bench_print_result(struct harness_bench_t *bench_p,
+                               struct harness_bench_result_t *result_p)
+{
+#if CONFIG_HARNESS_BENCH_CSV == 1
+    std_printf(OSTR("%s,%ld,%d,%ld,%ld,%ld,%ld,%ld\r\n"),
+#else
+    std_printf(OSTR("{\"benchmark\": \"%s\", \"iterations\": %ld, "
+                    "\"samples\": %d, \"min_ns\": %ld, \"median_ns\": %ld, "
+                    "\"p99_ns\": %ld, \"allocs\": %ld, \"frees\": %ld}\r\n"),
+#endif
+               bench_p->name_p,
+               result_p->iterations,
+               result_p->samples,
+               result_p->min_ns,
+               result_p->median_ns,
+               result_p->p99_ns,
+               result_p->allocs,
+               result_p->frees);
+}
+
 int harness_run(struct harness_testcase_t *testcases_p)
 {
     int err;
     struct harness_testcase_t *testcase_p;
-    struct mock_entry_t *entry_p;
+    struct mock_id_t *mock_id_p;
+    /* Mock ids and callbacks fit in the two smallest sizes, and mock
+       entries with up to 256 bytes of data in the others, so the
+       slow dynamic allocator is rarely used. */
     size_t sizes[HEAP_FIXED_SIZES_MAX] = {
-        8, 16, 32, 32, 32, 32, 32, 32
+        32,
+        64,
+        sizeof(struct mock_entry_t) + 8,
+        sizeof(struct mock_entry_t) + 16,
+        sizeof(struct mock_entry_t) + 32,
+        sizeof(struct mock_entry_t) + 64,
+        sizeof(struct mock_entry_t) + 128,
+        sizeof(struct mock_entry_t) + 256
     };
 
     mutex_init(&module.mutex);
@@ -488,22 +657,14 @@ int harness_run(struct harness_testcase_t *testcases_p)
     module.skipped = 0;
     testcase_p = testcases_p;
 
-    thrd_sleep_ms(CONFIG_HARNESS_SLEEP_MS);
-
-    /* Print a header. */
-    std_printf(OSTR("\r\n"));
-
-    std_printf(OSTR("================================== TEST BEGIN =========="
-                    "========================\r\n\r\n"));
-    std_printf(sys_get_info());
-    std_printf(OSTR("\r\n"));
+    print_header();
     std_printf(OSTR("mock heap size: %u bytes\r\n"), sizeof(module.heap.buf));
 
     while (testcase_p->callback != NULL) {
         /* Reinitialize the heap before every testcase for minimal
            memory usage. */
-        list_init(&module.mock.list);
-        list_init(&module.mock.cb_list);
+        memset(&module.mock.buckets[0], 0, sizeof(module.mock.buckets));
+        list_init(&module.mock.ids);
 
         heap_init(&module.heap.obj,
                   &module.heap.buf[0],
@@ -518,14 +679,17 @@ int harness_run(struct harness_testcase_t *testcases_p)
         err = testcase_p->callback();
  
         do {
-            entry_p = (struct mock_entry_t *)list_remove_head(&module.mock.list);
-
-            if (entry_p != NULL) {
-                std_printf(OSTR("Found unread mock id '%s'. Failing test.\r\n"),
-                           entry_p->id_p);
-                err = -1;
+            mock_id_p = list_remove_head(&module.mock.ids);
+
+            if (mock_id_p != NULL) {
+                while (list_remove_head(&mock_id_p->entries) != NULL) {
+                    std_printf(
+                        OSTR("Found unread mock id '%s'. Failing test.\r\n"),
+                        &mock_id_p->id[0]);
+                    err = -1;
+                }
             }
-        } while (entry_p != NULL);
+        } while (mock_id_p != NULL);
 
         if ((err < 0) || (harness_get_testcase_result() == -1)) {
             module.failed++;
@@ -558,6 +722,121 @@ int harness_run(struct harness_testcase_t *testcases_p)
     return (print_report_and_stop());
 }
 
+int harness_bench_run(struct harness_bench_t *bench_p,
+                      struct harness_bench_result_t *result_p)
+{
+    ASSERTN(bench_p != NULL, EINVAL);
+    ASSERTN(bench_p->callback != NULL, EINVAL);
+    ASSERTN(result_p != NULL, EINVAL);
+
+    long samples[CONFIG_HARNESS_BENCH_SAMPLES];
+    long target_us;
+    long iterations;
+    long iterations_max;
+    long us;
+    uint32_t allocs;
+    uint32_t frees;
+    int i;
+
+    target_us = time_micros_maximum();
+
+    if (target_us < 0) {
+        return (target_us);
+    }
+
+    target_us /= 2;
+
+    if (target_us > CONFIG_HARNESS_BENCH_SAMPLE_US) {
+        target_us = CONFIG_HARNESS_BENCH_SAMPLE_US;
+    }
+
+    /* Calibrate the number of iterations per sample, which also
+       warms up caches and lazily initialized state. The number of
+       iterations is limited so the calculations below cannot
+       overflow. */
+    iterations = 1;
+    iterations_max = (LONG_MAX / (target_us + 16));
+
+    while (1) {
+        us = bench_sample(bench_p, iterations);
+
+        if ((us >= target_us / 2) || (iterations == iterations_max)) {
+            break;
+        }
+
+        if ((us == 0) || (us < target_us / 16)) {
+            iterations *= 16;
+        } else {
+            iterations = ((iterations * target_us) / us);
+        }
+
+        iterations = MIN(iterations, iterations_max);
+    }
+
+    /* Count allocations in a single call. */
+    if (bench_p->heap_p != NULL) {
+        allocs = bench_p->heap_p->statistics.allocs;
+        frees = bench_p->heap_p->statistics.frees;
+        bench_p->callback(bench_p->arg_p);
+        result_p->allocs = (bench_p->heap_p->statistics.allocs - allocs);
+        result_p->frees = (bench_p->heap_p->statistics.frees - frees);
+    } else {
+        result_p->allocs = 0;
+        result_p->frees = 0;
+    }
+
+    for (i = 0; i < CONFIG_HARNESS_BENCH_SAMPLES; i++) {
+        samples[i] = ((1000 * bench_sample(bench_p, iterations)) / iterations);
+    }
+
+    bench_sort(&samples[0], CONFIG_HARNESS_BENCH_SAMPLES);
+
+    result_p->iterations = iterations;
+    result_p->samples = CONFIG_HARNESS_BENCH_SAMPLES;
+    result_p->min_ns = samples[0];
+    result_p->median_ns = samples[CONFIG_HARNESS_BENCH_SAMPLES / 2];
+    result_p->p99_ns =
+        samples[(99 * CONFIG_HARNESS_BENCH_SAMPLES + 99) / 100 - 1];
+
+    return (0);
+}
+
+int harness_bench(struct harness_bench_t *benchmarks_p)
+{
+    struct harness_bench_t *bench_p;
+    struct harness_bench_result_t result;
+
+    module.total = 0;
+    module.passed = 0;
+    module.failed = 0;
+    module.skipped = 0;
+
+    print_header();
+
+#if CONFIG_HARNESS_BENCH_CSV == 1
+    std_printf(OSTR("benchmark,iterations,samples,min_ns,median_ns,p99_ns,"
+                    "allocs,frees\r\n"));
+#endif
+
+    bench_p = benchmarks_p;
+
+    while (bench_p->callback != NULL) {
+        module.total++;
+
+        if (harness_bench_run(bench_p, &result) == 0) {
+            module.passed++;
+            bench_print_result(bench_p, &result);
+        } else {
+            module.failed++;
+            std_printf(OSTR("%s: FAILED\r\n"), bench_p->name_p);
+        }
+
+        bench_p++;
+    }
+
+    return (print_report_and_stop());
+}
+
 int harness_expect(void *chan_p,
                    const char *pattern_p,
                    const struct time_t *timeout_p)
@@ -616,10 +895,12 @@ ssize_t harness_mock_write(const char *id_p,
         return (res);
     }
 
-    /* Add the entry at the end of the list. */
-    mutex_lock(&module.mutex);
-    list_add_tail(&module.mock.list, entry_p);
-    mutex_unlock(&module.mutex);
+    /* Add the entry at the end of the queue of its id. */
+    if (add_mock_entry(entry_p) != 0) {
+        free_mock_entry(entry_p);
+
+        return (-ENOMEM);
+    }
 
     return (res);
 }
@@ -673,17 +954,22 @@ ssize_t harness_mock_cwrite(const char *id_p,
     }
 
     /* Initiate the callback entry. */
-    entry_cb_p->entry_p = entry_p;
     entry_cb_p->fn = cb;
 
     if (arg_p != NULL) {
         memcpy(&entry_cb_p->arg[0], arg_p, arg_size);
     }
 
-    mutex_lock(&module.mutex);
-    list_add_tail(&module.mock.list, entry_p);
-    list_add_tail(&module.mock.cb_list, entry_cb_p);
-    mutex_unlock(&module.mutex);
+    entry_p->cb_p = entry_cb_p;
+
+    if (add_mock_entry(entry_p) != 0) {
+        mutex_lock(&module.mutex);
+        free_mock_entry_cb_no_lock(entry_cb_p);
+        mutex_unlock(&module.mutex);
+        free_mock_entry(entry_p);
+
+        return (-ENOMEM);
+    }
 
     return (size);
 }
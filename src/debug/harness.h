@@ -177,6 +177,34 @@ struct harness_testcase_t {
     const char *name_p;
 };
 
+/**
+ * The benchmark callback, called repeatedly by the benchmark harness.
+ *
+ * @param[in] arg_p Argument pointer given in the benchmark.
+ */
+typedef void (*harness_bench_cb_t)(void *arg_p);
+
+struct harness_bench_t {
+    harness_bench_cb_t callback;
+    const char *name_p;
+    void *arg_p;
+    /* Heap to count allocations in, or NULL. */
+    struct heap_t *heap_p;
+};
+
+struct harness_bench_result_t {
+    /* Number of callback calls per sample. */
+    long iterations;
+    int samples;
+    /* Time per callback call in nanoseconds. */
+    long min_ns;
+    long median_ns;
+    long p99_ns;
+    /* Number of allocated and freed buffers in one callback call. */
+    long allocs;
+    long frees;
+};
+
 /**
  * Run given testcases in the test harness.
  *
@@ -188,6 +216,33 @@ struct harness_testcase_t {
  */
 int harness_run(struct harness_testcase_t *testcases_p);
 
+/**
+ * Run given benchmark. The callback is first called with an
+ * increasing number of iterations until a sample takes about
+ * ``CONFIG_HARNESS_BENCH_SAMPLE_US`` microseconds, which also warms
+ * up caches. Then ``CONFIG_HARNESS_BENCH_SAMPLES`` samples are
+ * measured with `time_micros()`.
+ *
+ * @param[in] bench_p Benchmark to run.
+ * @param[out] result_p Benchmark result.
+ *
+ * @return zero(0) or negative error code.
+ */
+int harness_bench_run(struct harness_bench_t *bench_p,
+                      struct harness_bench_result_t *result_p);
+
+/**
+ * Run given benchmarks and print their results, one JSON object per
+ * line, or as CSV if ``CONFIG_HARNESS_BENCH_CSV`` is set.
+ *
+ * @param[in] benchmarks_p An array of benchmarks to run. The last
+ *                         element in the array must have ``callback``
+ *                         and ``name_p`` set to NULL.
+ *
+ * @return Never returns.
+ */
+int harness_bench(struct harness_bench_t *benchmarks_p);
+
 /**
  * Continiously read from given channel and return when given pattern
  * has been read, or when given timeout occurs.
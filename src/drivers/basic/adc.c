@@ -36,6 +36,101 @@ struct module_t {
     int8_t initialized;
 };
 
+/**
+ * Find the buffer with given sequence number.
+ */
+static struct adc_stream_buffer_t *stream_find_buffer_isr(
+    struct adc_stream_t *self_p,
+    size_t sequence_number)
+{
+    size_t i;
+
+    for (i = 0; i < self_p->number_of_buffers; i++) {
+        if (self_p->buffers_p[i].sequence_number == sequence_number) {
+            return (&self_p->buffers_p[i]);
+        }
+    }
+
+    return (NULL);
+}
+
+/**
+ * A buffer is free if it is not owned by the reader and does not
+ * contain unread or produced samples.
+ */
+static int stream_is_buffer_free_isr(struct adc_stream_t *self_p,
+                                     struct adc_stream_buffer_t *buffer_p)
+{
+    if ((self_p->holding == 1)
+        && (buffer_p->sequence_number == self_p->held_sequence_number)) {
+        return (0);
+    }
+
+    return ((buffer_p->sequence_number < self_p->consumed)
+            || (buffer_p->sequence_number >= self_p->assigned));
+}
+
+/**
+ * Get the buffer to fill with given sequence number. A buffer is
+ * assigned to each sequence number the first time it is requested,
+ * dropping the oldest unread buffers if needed. The buffer owned by
+ * the reader is never assigned.
+ */
+static struct adc_stream_buffer_t *stream_get_buffer_isr(
+    struct adc_stream_t *self_p,
+    size_t sequence_number)
+{
+    struct adc_stream_buffer_t *buffer_p;
+    size_t i;
+    size_t j;
+
+    if (sequence_number < self_p->assigned) {
+        return (stream_find_buffer_isr(self_p, sequence_number));
+    }
+
+    while (1) {
+        /* Start the search at the buffer given by the sequence number
+           for round robin use when the reader keeps up. */
+        for (i = 0; i < self_p->number_of_buffers; i++) {
+            j = ((sequence_number + i) % self_p->number_of_buffers);
+            buffer_p = &self_p->buffers_p[j];
+
+            if (stream_is_buffer_free_isr(self_p, buffer_p)) {
+                buffer_p->sequence_number = sequence_number;
+                self_p->assigned = (sequence_number + 1);
+
+                return (buffer_p);
+            }
+        }
+
+        /* Drop the oldest unread buffer. There is always one as at
+           least three buffers are used. */
+        self_p->consumed++;
+        self_p->overruns++;
+    }
+}
+
+/**
+ * Called by the port when the oldest buffer being filled is full.
+ */
+static void stream_buffer_filled_isr(struct adc_stream_t *self_p)
+{
+    struct adc_stream_buffer_t *buffer_p;
+
+    buffer_p = stream_find_buffer_isr(self_p, self_p->produced);
+    sys_uptime_isr(&buffer_p->timestamp);
+    self_p->produced++;
+
+    if (self_p->callback != NULL) {
+        self_p->callback(self_p->arg_p, buffer_p);
+    }
+
+    if (self_p->thrd_p != NULL) {
+        thrd_resume_isr(self_p->thrd_p, 0);
+        self_p->thrd_p = NULL;
+    }
+}
+
 #include "adc_port.i"
 
 static struct module_t module;
@@ -108,6 +203,118 @@ RAM_CODE int adc_convert_isr(struct adc_driver_t *self_p,
     return (adc_port_convert_isr(self_p, sample_p));
 }
 
+int adc_stream_init(struct adc_stream_t *self_p,
+                    struct adc_driver_t *drv_p,
+                    struct adc_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    adc_stream_callback_t callback,
+                    void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(drv_p != NULL, EINVAL);
+    ASSERTN(buffers_p != NULL, EINVAL);
+    ASSERTN(number_of_buffers >= 3, EINVAL);
+
+    self_p->drv_p = drv_p;
+    self_p->buffers_p = buffers_p;
+    self_p->number_of_buffers = number_of_buffers;
+    self_p->callback = callback;
+    self_p->arg_p = arg_p;
+    self_p->running = 0;
+    self_p->thrd_p = NULL;
+
+    return (0);
+}
+
+int adc_stream_start(struct adc_stream_t *self_p)
+{
+    int res;
+    size_t i;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (self_p->running == 1) {
+        return (-EBUSY);
+    }
+
+    self_p->produced = 0;
+    self_p->consumed = 0;
+    self_p->assigned = 0;
+    self_p->holding = 0;
+    self_p->overruns = 0;
+
+    for (i = 0; i < self_p->number_of_buffers; i++) {
+        self_p->buffers_p[i].sequence_number = (size_t)-1;
+    }
+
+    res = adc_port_stream_start(self_p->drv_p, self_p);
+
+    if (res == 0) {
+        self_p->running = 1;
+    }
+
+    return (res);
+}
+
+int adc_stream_stop(struct adc_stream_t *self_p)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (self_p->running == 0) {
+        return (-EINVAL);
+    }
+
+    res = adc_port_stream_stop(self_p->drv_p);
+
+    sys_lock();
+
+    self_p->running = 0;
+
+    if (self_p->thrd_p != NULL) {
+        thrd_resume_isr(self_p->thrd_p, -ECANCELED);
+        self_p->thrd_p = NULL;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int adc_stream_read(struct adc_stream_t *self_p,
+                    struct adc_stream_buffer_t **buffer_pp)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buffer_pp != NULL, EINVAL);
+
+    sys_lock();
+
+    /* Release the previously read buffer. */
+    self_p->holding = 0;
+    res = 0;
+
+    if (self_p->consumed == self_p->produced) {
+        self_p->thrd_p = thrd_self();
+        res = thrd_suspend_isr(NULL);
+    }
+
+    if (res == 0) {
+        *buffer_pp = stream_find_buffer_isr(self_p, self_p->consumed);
+        self_p->held_sequence_number = self_p->consumed;
+        self_p->consumed++;
+        self_p->holding = 1;
+        res = self_p->overruns;
+        self_p->overruns = 0;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
 int adc_is_valid_device(struct adc_device_t *dev_p)
 {
     return ((dev_p >= &adc_device[0])
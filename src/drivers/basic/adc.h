@@ -32,6 +32,9 @@
 #define __DRIVERS_ADC_H__
 
 #include "simba.h"
+
+struct adc_stream_t;
+
 #include "adc_port.h"
 
 /**
@@ -41,6 +44,45 @@
 
 extern struct adc_device_t adc_device[ADC_DEVICE_MAX];
 
+/**
+ * A sample buffer in an ADC stream.
+ */
+struct adc_stream_buffer_t {
+    uint16_t *samples_p;
+    size_t length;
+    /* Time when the last sample in the buffer was converted. */
+    struct time_t timestamp;
+    /* Sequence number of the samples in the buffer. Used by the
+       driver. */
+    size_t sequence_number;
+};
+
+/**
+ * Called from interrupt context when a stream buffer has been
+ * filled.
+ *
+ * @param[in] arg_p Stream argument.
+ * @param[in] buffer_p Filled buffer.
+ */
+typedef void (*adc_stream_callback_t)(void *arg_p,
+                                      struct adc_stream_buffer_t *buffer_p);
+
+struct adc_stream_t {
+    struct adc_driver_t *drv_p;
+    struct adc_stream_buffer_t *buffers_p;
+    size_t number_of_buffers;
+    adc_stream_callback_t callback;
+    void *arg_p;
+    size_t produced;
+    size_t consumed;
+    size_t assigned;
+    size_t held_sequence_number;
+    int holding;
+    int overruns;
+    int running;
+    struct thrd_t *thrd_p;
+};
+
 /**
  * Initialize the ADC driver module. This function must be called
  * before calling any other function in this module.
@@ -128,6 +170,69 @@ int adc_convert(struct adc_driver_t *self_p,
 int adc_convert_isr(struct adc_driver_t *self_p,
                     uint16_t *sample_p);
 
+/**
+ * Initialize given stream. A stream continuously converts samples
+ * into given buffers, one buffer after the other. Filled buffers are
+ * read with `adc_stream_read()`, and/or given callback is called when
+ * a buffer has been filled.
+ *
+ * If all buffers are filled and not yet read when the next buffer is
+ * needed, the oldest unread buffer is dropped, which is called an
+ * overrun. The buffer owned by the reader is never overwritten.
+ *
+ * @param[out] self_p Stream to initialize.
+ * @param[in] drv_p Initialized driver object.
+ * @param[in] buffers_p Array of buffers. Set `samples_p` and
+ *                      `length` of each buffer.
+ * @param[in] number_of_buffers Number of buffers. At least three.
+ * @param[in] callback Callback called when a buffer has been filled,
+ *                     or NULL.
+ * @param[in] arg_p Callback argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int adc_stream_init(struct adc_stream_t *self_p,
+                    struct adc_driver_t *drv_p,
+                    struct adc_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    adc_stream_callback_t callback,
+                    void *arg_p);
+
+/**
+ * Start converting samples into the stream buffers. The driver
+ * cannot be used for other convertions until the stream is stopped.
+ *
+ * @param[in] self_p Initialized stream.
+ *
+ * @return zero(0), -EBUSY if the stream is already started, or other
+ *         negative error code.
+ */
+int adc_stream_start(struct adc_stream_t *self_p);
+
+/**
+ * Stop given stream. A thread waiting in `adc_stream_read()` is
+ * resumed with an error.
+ *
+ * @param[in] self_p Started stream.
+ *
+ * @return zero(0), -EINVAL if the stream is not started, or other
+ *         negative error code.
+ */
+int adc_stream_stop(struct adc_stream_t *self_p);
+
+/**
+ * Wait for the next filled buffer. The buffer is owned by the caller
+ * until the next call to this function.
+ *
+ * @param[in] self_p Started stream.
+ * @param[out] buffer_pp Filled buffer.
+ *
+ * @return Number of buffers dropped since the previous call, or
+ *         negative error code.
+ */
+int adc_stream_read(struct adc_stream_t *self_p,
+                    struct adc_stream_buffer_t **buffer_pp);
+
 /**
  * Check if given ADC device is valid.
  *
@@ -36,6 +36,63 @@ struct module_t {
     int8_t initialized;
 };
 
+/**
+ * Returns the next written buffer that has not yet been handed to
+ * the hardware, or NULL if there is none.
+ */
+static struct dac_stream_buffer_t *stream_load_isr(struct dac_stream_t *self_p)
+{
+    struct dac_stream_buffer_t *buffer_p;
+
+    if (self_p->loaded == self_p->produced) {
+        return (NULL);
+    }
+
+    buffer_p = &self_p->buffers_p[self_p->loaded % self_p->number_of_buffers];
+    self_p->loaded++;
+
+    return (buffer_p);
+}
+
+static void stream_refill_isr(struct dac_stream_t *self_p)
+{
+    struct dac_stream_buffer_t *buffer_p;
+
+    while (self_p->produced - self_p->consumed < self_p->number_of_buffers) {
+        buffer_p = &self_p->buffers_p[self_p->produced
+                                      % self_p->number_of_buffers];
+
+        if (self_p->refill(self_p->arg_p, buffer_p) != 0) {
+            self_p->counters.late_refills++;
+            break;
+        }
+
+        self_p->produced++;
+    }
+}
+
+/**
+ * Called by the port when the oldest loaded buffer has been
+ * converted.
+ */
+static void stream_buffer_done_isr(struct dac_stream_t *self_p)
+{
+    self_p->consumed++;
+
+    if (self_p->refill != NULL) {
+        stream_refill_isr(self_p);
+    }
+
+    if (self_p->consumed == self_p->produced) {
+        self_p->counters.underruns++;
+    }
+
+    if (self_p->thrd_p != NULL) {
+        thrd_resume_isr(self_p->thrd_p, 0);
+        self_p->thrd_p = NULL;
+    }
+}
+
 #include "dac_port.i"
 
 static struct module_t module;
@@ -100,4 +157,137 @@ int dac_convert(struct dac_driver_t *self_p,
     return (dac_port_convert(self_p, samples_p, length));
 }
 
+int dac_stream_init(struct dac_stream_t *self_p,
+                    struct dac_driver_t *drv_p,
+                    struct dac_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    dac_stream_refill_t refill,
+                    void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(drv_p != NULL, EINVAL);
+    ASSERTN(buffers_p != NULL, EINVAL);
+    ASSERTN(number_of_buffers >= 2, EINVAL);
+
+    self_p->drv_p = drv_p;
+    self_p->buffers_p = buffers_p;
+    self_p->number_of_buffers = number_of_buffers;
+    self_p->refill = refill;
+    self_p->arg_p = arg_p;
+    self_p->produced = 0;
+    self_p->loaded = 0;
+    self_p->consumed = 0;
+    self_p->counters.underruns = 0;
+    self_p->counters.late_refills = 0;
+    self_p->running = 0;
+    self_p->thrd_p = NULL;
+
+    return (0);
+}
+
+int dac_stream_start(struct dac_stream_t *self_p)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (self_p->running == 1) {
+        return (-EBUSY);
+    }
+
+    sys_lock();
+
+    if (self_p->refill != NULL) {
+        stream_refill_isr(self_p);
+    }
+
+    res = dac_port_stream_start_isr(self_p->drv_p, self_p);
+
+    if (res == 0) {
+        self_p->running = 1;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int dac_stream_stop(struct dac_stream_t *self_p)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (self_p->running == 0) {
+        return (-EINVAL);
+    }
+
+    sys_lock();
+
+    res = dac_port_stream_stop_isr(self_p->drv_p);
+    self_p->running = 0;
+
+    /* Buffers loaded by the hardware are dropped, while written but
+       not yet loaded buffers are converted when started again. */
+    self_p->consumed = self_p->loaded;
+
+    if (self_p->thrd_p != NULL) {
+        thrd_resume_isr(self_p->thrd_p, -ECANCELED);
+        self_p->thrd_p = NULL;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int dac_stream_get_buffer(struct dac_stream_t *self_p,
+                          struct dac_stream_buffer_t **buffer_pp)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buffer_pp != NULL, EINVAL);
+
+    res = 0;
+
+    sys_lock();
+
+    while ((res == 0)
+           && (self_p->produced - self_p->consumed
+               == self_p->number_of_buffers)) {
+        self_p->thrd_p = thrd_self();
+        res = thrd_suspend_isr(NULL);
+    }
+
+    if (res == 0) {
+        *buffer_pp = &self_p->buffers_p[self_p->produced
+                                        % self_p->number_of_buffers];
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+int dac_stream_write(struct dac_stream_t *self_p)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    sys_lock();
+
+    if (self_p->produced - self_p->consumed < self_p->number_of_buffers) {
+        self_p->produced++;
+        res = dac_port_stream_write_isr(self_p->drv_p);
+    } else {
+        res = -ENOMEM;
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
 #endif
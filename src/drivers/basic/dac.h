@@ -32,10 +32,55 @@
 #define __DRIVERS_DAC_H__
 
 #include "simba.h"
+
+struct dac_stream_t;
+
 #include "dac_port.h"
 
 extern struct dac_device_t dac_device[DAC_DEVICE_MAX];
 
+/**
+ * A sample buffer in a DAC stream.
+ */
+struct dac_stream_buffer_t {
+    void *samples_p;
+    size_t length;
+};
+
+/**
+ * Called from interrupt context when a stream buffer has been
+ * converted and is free to be refilled. The whole buffer must be
+ * filled.
+ *
+ * @param[in] arg_p Stream argument.
+ * @param[in] buffer_p Buffer to refill.
+ *
+ * @return zero(0) if the buffer was refilled, or non-zero if no
+ *         samples are available yet.
+ */
+typedef int (*dac_stream_refill_t)(void *arg_p,
+                                   struct dac_stream_buffer_t *buffer_p);
+
+struct dac_stream_t {
+    struct dac_driver_t *drv_p;
+    struct dac_stream_buffer_t *buffers_p;
+    size_t number_of_buffers;
+    dac_stream_refill_t refill;
+    void *arg_p;
+    size_t produced;
+    size_t loaded;
+    size_t consumed;
+    int running;
+    struct thrd_t *thrd_p;
+    struct {
+        /* Number of times all buffers were converted before a new
+           buffer was written. */
+        uint32_t underruns;
+        /* Number of times the refill callback had no samples. */
+        uint32_t late_refills;
+    } counters;
+};
+
 /**
  * Initialize DAC driver module. This function must be called before
  * calling any other function in this module.
@@ -99,4 +144,76 @@ int dac_convert(struct dac_driver_t *self_p,
                 void *samples_p,
                 size_t length);
 
+/**
+ * Initialize given stream. A stream converts a ring of buffers
+ * without gaps as long as a buffer is written before the previous
+ * buffer has been converted.
+ *
+ * Buffers are either refilled by given callback from interrupt
+ * context when converted, or written by a thread using
+ * `dac_stream_get_buffer()` and `dac_stream_write()`. Use only one
+ * of them per stream.
+ *
+ * @param[out] self_p Stream to initialize.
+ * @param[in] drv_p Initialized driver object.
+ * @param[in] buffers_p Array of buffers. Set `samples_p` and
+ *                      `length` of each buffer.
+ * @param[in] number_of_buffers Number of buffers. At least two.
+ * @param[in] refill Callback called when a buffer has been
+ *                   converted, or NULL.
+ * @param[in] arg_p Callback argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_stream_init(struct dac_stream_t *self_p,
+                    struct dac_driver_t *drv_p,
+                    struct dac_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    dac_stream_refill_t refill,
+                    void *arg_p);
+
+/**
+ * Start converting samples from the stream buffers. All buffers are
+ * first filled by the refill callback, if any. Buffers written
+ * before the stream is started are converted first. The driver
+ * cannot be used for other convertions until the stream is stopped.
+ *
+ * @param[in] self_p Initialized stream.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_stream_start(struct dac_stream_t *self_p);
+
+/**
+ * Stop given stream immediately. A thread waiting in
+ * `dac_stream_get_buffer()` is resumed with an error.
+ *
+ * @param[in] self_p Started stream.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_stream_stop(struct dac_stream_t *self_p);
+
+/**
+ * Wait for a free buffer to fill with samples. Write it to the
+ * stream with `dac_stream_write()`.
+ *
+ * @param[in] self_p Started stream.
+ * @param[out] buffer_pp Free buffer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_stream_get_buffer(struct dac_stream_t *self_p,
+                          struct dac_stream_buffer_t **buffer_pp);
+
+/**
+ * Write the buffer returned by the last call to
+ * `dac_stream_get_buffer()` to the stream.
+ *
+ * @param[in] self_p Started stream.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_stream_write(struct dac_stream_t *self_p);
+
 #endif
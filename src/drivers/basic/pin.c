@@ -260,20 +260,6 @@ int pin_set_mode(struct pin_driver_t *self_p, int mode)
     return (pin_port_set_mode(self_p, mode));
 }
 
-int pin_device_write(const struct pin_device_t *dev_p,
-                     int value)
-{
-    int res;
-    
-    if (value == 0) {
-        res = pin_device_write_low(dev_p);
-    } else {
-        res = pin_device_write_high(dev_p);
-    }
-    
-    return (res);
-}
-
 int pin_is_valid_device(struct pin_device_t *dev_p)
 {
     return ((dev_p != NULL)
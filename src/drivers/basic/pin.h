@@ -195,8 +195,15 @@ static inline int pin_device_read(const struct pin_device_t *dev_p)
  *
  * @return zero(0) or negative error code.
  */
-int pin_device_write(const struct pin_device_t *dev_p,
-                     int value);
+static inline int pin_device_write(const struct pin_device_t *dev_p,
+                                   int value)
+{
+    if (value == 0) {
+        return (pin_port_device_write_low(dev_p));
+    } else {
+        return (pin_port_device_write_high(dev_p));
+    }
+}
 
 /**
  * Write high to given pin device.
@@ -228,6 +235,80 @@ static inline int pin_device_write_low(const struct pin_device_t *dev_p)
     return (pin_port_device_write_low(dev_p));
 }
 
+/**
+ * Get the bit mask of given pin device in its GPIO port. Masks of
+ * pins in the same port (see `pin_device_is_same_port()`) may be
+ * combined and passed to `pin_device_write_mask()` and
+ * `pin_device_read_mask()` to access several pins at once.
+ *
+ * Compute the masks once, for example when a driver is initialized,
+ * and keep them with the pin device pointer.
+ *
+ * @param[in] dev_p Pin device.
+ *
+ * @return Bit mask of the pin.
+ */
+static inline uint32_t pin_device_mask(const struct pin_device_t *dev_p)
+{
+    return (pin_port_device_mask(dev_p));
+}
+
+/**
+ * Check if given pin devices are in the same GPIO port, that is, if
+ * their masks may be combined in a single masked read or write.
+ *
+ * @param[in] dev_p Pin device.
+ * @param[in] other_p Other pin device.
+ *
+ * @return true(1) if the pins are in the same port, otherwise
+ *         false(0).
+ */
+static inline int pin_device_is_same_port(const struct pin_device_t *dev_p,
+                                          const struct pin_device_t *other_p)
+{
+    return (pin_port_device_is_same_port(dev_p, other_p));
+}
+
+/**
+ * Write high to all pins in given high mask and low to all pins in
+ * given low mask. The masks refer to pins in the same port as given
+ * pin device. The write is a single register access on ports that
+ * supports it.
+ *
+ * This function may be called from interrupt context and with the
+ * system lock taken.
+ *
+ * @param[in] dev_p Any pin device in the port to write to.
+ * @param[in] high_mask Pins to write high.
+ * @param[in] low_mask Pins to write low.
+ *
+ * @return zero(0) or negative error code.
+ */
+static inline int pin_device_write_mask(const struct pin_device_t *dev_p,
+                                        uint32_t high_mask,
+                                        uint32_t low_mask)
+{
+    return (pin_port_device_write_mask(dev_p, high_mask, low_mask));
+}
+
+/**
+ * Read the input values of all pins in given mask. The mask refers to
+ * pins in the same port as given pin device.
+ *
+ * This function may be called from interrupt context and with the
+ * system lock taken.
+ *
+ * @param[in] dev_p Any pin device in the port to read from.
+ * @param[in] mask Pins to read.
+ *
+ * @return Given mask with the bits of all low pins cleared.
+ */
+static inline uint32_t pin_device_read_mask(const struct pin_device_t *dev_p,
+                                            uint32_t mask)
+{
+    return (pin_port_device_read_mask(dev_p, mask));
+}
+
 /**
  * Check if given pin device is valid.
  *
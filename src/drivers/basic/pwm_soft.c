@@ -34,81 +34,308 @@
 
 #define DUTY_CYCLE_MAX module.duty_cycle_max
 
+/* A pin value change at given time in the period. */
+struct pwm_soft_edge_t {
+    unsigned int time;
+    struct pin_device_t *pin_dev_p;
+    int8_t value;
+    /* Only written in the first period of the schedule. */
+    int8_t first_period_only;
+};
+
+/* Edges sorted on time. */
+struct pwm_soft_schedule_t {
+    int length;
+    struct pwm_soft_edge_t edges[3 * CONFIG_PWM_SOFT_CHANNELS_MAX];
+    /* Channels that are high at the end of the period, and when they
+       fall in the next period. */
+    uint32_t high_mask;
+    unsigned int falls[CONFIG_PWM_SOFT_CHANNELS_MAX];
+    struct pin_device_t *pin_devs_p[CONFIG_PWM_SOFT_CHANNELS_MAX];
+};
+
 struct module_t {
     struct pwm_soft_port_module_t port;
     int initialized;
-    struct pwm_soft_driver_t tail_pwm_soft;
-    struct pwm_soft_driver_t *head_p;
-    /* A circular linked list of started devices (and this modules'
-       dummy software pwm). */
-    struct pwm_soft_driver_t *current_p;
     long frequency;
     long duty_cycle_max;
+    /* Started drivers. The index in this array is the channel, which
+       gives the phase of the driver. */
+    struct pwm_soft_driver_t *channels_p[CONFIG_PWM_SOFT_CHANNELS_MAX];
+    struct mutex_t mutex;
+    /* The active schedule is used by the interrupt handler and the
+       other is written by threads. A pending schedule replaces the
+       active one at the start of the next period. */
+    struct pwm_soft_schedule_t schedules[2];
+    struct pwm_soft_schedule_t *active_p;
+    struct pwm_soft_schedule_t *pending_p;
+    /* Thread waiting for the first period of the pending schedule to
+       end. */
+    struct thrd_t *thrd_p;
+    /* Interrupt handler state. */
+    struct {
+        unsigned int time;
+        int index;
+        int begin;
+        int end;
+        int first_period;
+    } isr;
 };
 
 static struct module_t module;
 
-static void unlink_pwm_soft_isr(struct pwm_soft_driver_t *self_p);
+/**
+ * Prepare writing the edges due now. Returns the number of timer
+ * ticks until the next interrupt.
+ */
+static unsigned int prepare_isr(void)
+{
+    struct pwm_soft_schedule_t *schedule_p;
+    unsigned int time;
+    unsigned int next;
+    int index;
+
+    time = module.isr.time;
+
+    /* Activate the pending schedule, if any, at the start of a
+       period. */
+    if (time == 0) {
+        if (module.pending_p != NULL) {
+            module.active_p = module.pending_p;
+            module.pending_p = NULL;
+            module.isr.first_period = 1;
+        } else {
+            module.isr.first_period = 0;
+
+            if (module.thrd_p != NULL) {
+                thrd_resume_isr(module.thrd_p, 0);
+                module.thrd_p = NULL;
+            }
+        }
+
+        module.isr.index = 0;
+    }
 
-#include "pwm_soft_port.i"
+    schedule_p = module.active_p;
+    index = module.isr.index;
+    module.isr.begin = index;
+
+    while ((index < schedule_p->length)
+           && (schedule_p->edges[index].time == time)) {
+        index++;
+    }
+
+    module.isr.end = index;
+
+    if (module.isr.first_period == 0) {
+        while ((index < schedule_p->length)
+               && schedule_p->edges[index].first_period_only) {
+            index++;
+        }
+    }
+
+    if (index < schedule_p->length) {
+        next = schedule_p->edges[index].time;
+    } else {
+        next = DUTY_CYCLE_MAX;
+    }
+
+    module.isr.index = index;
+
+    if (next == DUTY_CYCLE_MAX) {
+        module.isr.time = 0;
+    } else {
+        module.isr.time = next;
+    }
+
+    return (next - time);
+}
 
 /**
- * Insert given object into the global list of software PWM objects.
+ * Write the edges prepared by prepare_isr().
  */
-static void insert_pwm_soft(struct pwm_soft_driver_t *self_p)
+static void output_isr(void)
 {
-    struct pwm_soft_driver_t *elem_p, *prev_p;
+    struct pwm_soft_edge_t *edge_p;
+    int i;
 
-    sys_lock();
+    for (i = module.isr.begin; i < module.isr.end; i++) {
+        edge_p = &module.active_p->edges[i];
 
-    /* Find element preceeding this one.*/
-    elem_p = module.head_p;
-    prev_p = &module.tail_pwm_soft;
+        if (edge_p->first_period_only && (module.isr.first_period == 0)) {
+            continue;
+        }
 
-    /* Delta is initially the timeout. */
-    while (elem_p->delta < self_p->delta) {
-        self_p->delta -= elem_p->delta;
-        prev_p = elem_p;
-        elem_p = elem_p->next_p;
+        if (edge_p->value == 1) {
+            pin_device_write_high(edge_p->pin_dev_p);
+        } else {
+            pin_device_write_low(edge_p->pin_dev_p);
+        }
     }
+}
 
-    /* Insert new software PWM into list.*/
-    elem_p->delta -= self_p->delta;
-    self_p->next_p = elem_p;
-    prev_p->next_p = self_p;
+#include "pwm_soft_port.i"
+
+static void add_edge(struct pwm_soft_schedule_t *schedule_p,
+                     unsigned int time,
+                     struct pin_device_t *pin_dev_p,
+                     int value,
+                     int first_period_only)
+{
+    struct pwm_soft_edge_t *edge_p;
+
+    edge_p = &schedule_p->edges[schedule_p->length];
+    edge_p->time = time;
+    edge_p->pin_dev_p = pin_dev_p;
+    edge_p->value = value;
+    edge_p->first_period_only = first_period_only;
+    schedule_p->length++;
+}
 
-    if (prev_p == &module.tail_pwm_soft) {
-        module.head_p = self_p;
+/**
+ * Returns true(1) if given edge is written after given other
+ * edge. Edges correcting the pin state in the first period are
+ * written before regular edges at the same time, as a correction
+ * fall may coincide with a new rise on the same pin.
+ */
+static int is_edge_after(const struct pwm_soft_edge_t *edge_p,
+                         const struct pwm_soft_edge_t *other_p)
+{
+    if (edge_p->time != other_p->time) {
+        return (edge_p->time > other_p->time);
     }
 
-    sys_unlock();
+    return ((edge_p->first_period_only == 0)
+            && (other_p->first_period_only == 1));
 }
 
 /**
- * Unlink given software PWM from the list of started software PWM:s.
+ * Insertion sort of the edges on time.
  */
-static void unlink_pwm_soft_isr(struct pwm_soft_driver_t *self_p)
+static void sort_edges(struct pwm_soft_schedule_t *schedule_p)
 {
-    struct pwm_soft_driver_t *prev_p;
+    struct pwm_soft_edge_t edge;
+    int i;
+    int j;
 
-    /* Add the delta to the next element. */
-    self_p->next_p->delta += self_p->delta;
+    for (i = 1; i < schedule_p->length; i++) {
+        edge = schedule_p->edges[i];
 
-    /* Find element preceeding this one.*/
-    prev_p = module.head_p;
+        for (j = i;
+             (j > 0) && is_edge_after(&schedule_p->edges[j - 1], &edge);
+             j--) {
+            schedule_p->edges[j] = schedule_p->edges[j - 1];
+        }
 
-    while (prev_p->next_p != self_p) {
-        prev_p = prev_p->next_p;
+        schedule_p->edges[j] = edge;
     }
+}
 
-    /* Remove software PWM from the list.*/
-    prev_p->next_p = self_p->next_p;
+/**
+ * Build a schedule from the started drivers and make it pending. Must
+ * be called with the module mutex taken.
+ *
+ * A pulse started in the last period of the active schedule ends as
+ * in the active schedule or as in the new schedule, so no pulse is
+ * cut short by the update.
+ */
+static void update_schedule(void)
+{
+    struct pwm_soft_schedule_t *active_p;
+    struct pwm_soft_schedule_t *schedule_p;
+    struct pwm_soft_driver_t *driver_p;
+    unsigned int phase;
+    unsigned int fall;
+    uint32_t mask;
+    int channel;
+    int high;
+
+    /* No schedule swap while the inactive schedule is written. */
+    sys_lock();
+    module.pending_p = NULL;
+    sys_unlock();
+
+    active_p = module.active_p;
 
-    if (self_p == module.head_p) {
-        module.head_p = self_p->next_p;
+    if (active_p == &module.schedules[0]) {
+        schedule_p = &module.schedules[1];
+    } else {
+        schedule_p = &module.schedules[0];
     }
 
-    self_p->next_p = NULL;
+    schedule_p->length = 0;
+    schedule_p->high_mask = 0;
+
+    for (channel = 0; channel < CONFIG_PWM_SOFT_CHANNELS_MAX; channel++) {
+        driver_p = module.channels_p[channel];
+        mask = (1UL << channel);
+        high = 0;
+
+        if (driver_p != NULL) {
+            /* Spread the rising edges over the period. */
+            phase = ((DUTY_CYCLE_MAX * channel)
+                     / CONFIG_PWM_SOFT_CHANNELS_MAX);
+
+            if (driver_p->duty_cycle == DUTY_CYCLE_MAX) {
+                high = 1;
+                fall = 0;
+            } else if (driver_p->duty_cycle > 0) {
+                fall = (phase + driver_p->duty_cycle);
+
+                if (fall >= DUTY_CYCLE_MAX) {
+                    high = 1;
+                    fall -= DUTY_CYCLE_MAX;
+                }
+
+                add_edge(schedule_p, phase, driver_p->pin_dev_p, 1, 0);
+                add_edge(schedule_p, fall, driver_p->pin_dev_p, 0, 0);
+            }
+
+            if (high == 1) {
+                schedule_p->high_mask |= mask;
+                schedule_p->falls[channel] = fall;
+                schedule_p->pin_devs_p[channel] = driver_p->pin_dev_p;
+            }
+        }
+
+        /* Correct pins in the first period if the pin state at the
+           end of the active schedule period differs. */
+        if (active_p->high_mask & mask) {
+            if (high == 0) {
+                add_edge(schedule_p,
+                         active_p->falls[channel],
+                         active_p->pin_devs_p[channel],
+                         0,
+                         1);
+            }
+        } else if ((driver_p != NULL)
+                   && (driver_p->duty_cycle == DUTY_CYCLE_MAX)) {
+            add_edge(schedule_p, 0, driver_p->pin_dev_p, 1, 1);
+        }
+    }
+
+    sort_edges(schedule_p);
+
+    sys_lock();
+    module.pending_p = schedule_p;
+    sys_unlock();
+}
+
+/**
+ * Wait for the first period of the pending schedule to end.
+ */
+static void wait_for_schedule(void)
+{
+#if !defined(PWM_SOFT_PORT_SKIP_WAIT_FOR_SCHEDULE)
+    sys_lock();
+
+    if ((module.pending_p != NULL) || (module.isr.first_period == 1)) {
+        module.thrd_p = thrd_self();
+        thrd_suspend_isr(NULL);
+    }
+
+    sys_unlock();
+#endif
 }
 
 int pwm_soft_module_init(long frequency)
@@ -117,11 +344,17 @@ int pwm_soft_module_init(long frequency)
         return (0);
     }
 
-    module.tail_pwm_soft.duty_cycle = -1;
-    module.tail_pwm_soft.thrd_p = NULL;
-    module.tail_pwm_soft.next_p = &module.tail_pwm_soft;
-    module.head_p = &module.tail_pwm_soft;
-    module.current_p = &module.tail_pwm_soft;
+    mutex_init(&module.mutex);
+    module.schedules[0].length = 0;
+    module.schedules[0].high_mask = 0;
+    module.active_p = &module.schedules[0];
+    module.pending_p = NULL;
+    module.thrd_p = NULL;
+    module.isr.time = 0;
+    module.isr.index = 0;
+    module.isr.begin = 0;
+    module.isr.end = 0;
+    module.isr.first_period = 0;
     module.frequency = frequency;
 
     if (pwm_soft_port_module_init(frequency) != 0) {
@@ -135,15 +368,27 @@ int pwm_soft_module_init(long frequency)
 
 int pwm_soft_set_frequency(long value)
 {
+    int res;
+    int channel;
+
+    mutex_lock(&module.mutex);
+
     /* It's not allowed to change the frequency with started software
        PWM drivers. */
-    if (module.head_p != &module.tail_pwm_soft) {
-        return (-1);
+    for (channel = 0; channel < CONFIG_PWM_SOFT_CHANNELS_MAX; channel++) {
+        if (module.channels_p[channel] != NULL) {
+            mutex_unlock(&module.mutex);
+
+            return (-1);
+        }
     }
 
     module.frequency = value;
+    res = pwm_soft_port_set_frequency(value);
+
+    mutex_unlock(&module.mutex);
 
-    return (pwm_soft_port_set_frequency(value));
+    return (res);
 }
 
 long pwm_soft_get_frequency(void)
@@ -161,9 +406,7 @@ int pwm_soft_init(struct pwm_soft_driver_t *self_p,
 
     self_p->pin_dev_p = pin_dev_p;
     self_p->duty_cycle = duty_cycle;
-    self_p->delta = 0;
-    self_p->thrd_p = NULL;
-    self_p->next_p = NULL;
+    self_p->channel = -1;
 
     return (0);
 }
@@ -172,19 +415,38 @@ int pwm_soft_start(struct pwm_soft_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    pin_device_set_mode(self_p->pin_dev_p, PIN_OUTPUT);
+    int channel;
 
-    if (self_p->duty_cycle == DUTY_CYCLE_MAX) {
-        pin_device_write_high(self_p->pin_dev_p);
-    } else {
-        pin_device_write_low(self_p->pin_dev_p);
+    mutex_lock(&module.mutex);
 
-        if (self_p->duty_cycle > 0) {
-            self_p->delta = self_p->duty_cycle;
-            insert_pwm_soft(self_p);
+    if (self_p->channel != -1) {
+        mutex_unlock(&module.mutex);
+
+        return (0);
+    }
+
+    for (channel = 0; channel < CONFIG_PWM_SOFT_CHANNELS_MAX; channel++) {
+        if (module.channels_p[channel] == NULL) {
+            break;
         }
     }
 
+    if (channel == CONFIG_PWM_SOFT_CHANNELS_MAX) {
+        mutex_unlock(&module.mutex);
+
+        return (-ENOMEM);
+    }
+
+    /* The pin is low until the new schedule is activated. */
+    pin_device_set_mode(self_p->pin_dev_p, PIN_OUTPUT);
+    pin_device_write_low(self_p->pin_dev_p);
+
+    self_p->channel = channel;
+    module.channels_p[channel] = self_p;
+    update_schedule();
+
+    mutex_unlock(&module.mutex);
+
     return (0);
 }
 
@@ -192,24 +454,22 @@ int pwm_soft_stop(struct pwm_soft_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    if (!((self_p->duty_cycle == DUTY_CYCLE_MAX) ||
-          (self_p->duty_cycle == 0))) {
-        sys_lock();
-
-        /* Is the timer started? */
-        if (self_p->next_p != NULL) {
-            /* Wait for the PWM to be inactive. */
-            if (self_p == module.current_p) {
-                self_p->thrd_p = thrd_self();
-                thrd_suspend_isr(NULL);
-            } else {
-                unlink_pwm_soft_isr(self_p);
-            }
-        }
+    mutex_lock(&module.mutex);
 
-        sys_unlock();
+    if (self_p->channel != -1) {
+        module.channels_p[self_p->channel] = NULL;
+        self_p->channel = -1;
+        update_schedule();
+
+        /* The pin must not be used by the interrupt handler after
+           this function returns. A high pin is set low by the
+           interrupt handler in the first period of the new
+           schedule. */
+        wait_for_schedule();
     }
 
+    mutex_unlock(&module.mutex);
+
     pin_device_set_mode(self_p->pin_dev_p, PIN_INPUT);
 
     return (0);
@@ -221,12 +481,19 @@ int pwm_soft_set_duty_cycle(struct pwm_soft_driver_t *self_p,
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN((value >= 0) && (value <= DUTY_CYCLE_MAX), EINVAL);
 
-    if (pwm_soft_stop(self_p) != 0) {
-        return (-1);
-    }
+    mutex_lock(&module.mutex);
 
     self_p->duty_cycle = value;
 
+    if (self_p->channel != -1) {
+        update_schedule();
+        mutex_unlock(&module.mutex);
+
+        return (0);
+    }
+
+    mutex_unlock(&module.mutex);
+
     return (pwm_soft_start(self_p));
 }
 
@@ -38,9 +38,8 @@ struct pwm_soft_driver_t {
     struct pin_device_t *pin_dev_p;
     long frequency;
     long duty_cycle;
-    unsigned int delta;
-    struct thrd_t *thrd_p;
-    struct pwm_soft_driver_t *next_p;
+    /* Channel index, or -1 if stopped. */
+    int channel;
 };
 
 /**
@@ -93,7 +92,12 @@ int pwm_soft_init(struct pwm_soft_driver_t *self_p,
 
 /**
  * Start outputting the PWM signal on the pin given to
- * `pwm_soft_init()`.
+ * `pwm_soft_init()`. Each started driver gets a channel with its own
+ * phase, so that the rising edges of different drivers are spread
+ * over the period. At most ``CONFIG_PWM_SOFT_CHANNELS_MAX`` drivers
+ * may be started at the same time.
+ *
+ * The signal is output from the start of the next period.
  *
  * @param[in] self_p Driver object to start.
  *
@@ -103,7 +107,9 @@ int pwm_soft_start(struct pwm_soft_driver_t *self_p);
 
 /**
  * Stop outputting the PWM signal on the pin given to
- * `pwm_soft_init()`.
+ * `pwm_soft_init()`. Waits for the current pulse to end, at most two
+ * periods, and then configures the pin as an input. The Linux port
+ * does not wait, as its timer is simulated by the application.
  *
  * @param[in] self_p Driver object to stop.
  *
@@ -112,8 +118,9 @@ int pwm_soft_start(struct pwm_soft_driver_t *self_p);
 int pwm_soft_stop(struct pwm_soft_driver_t *self_p);
 
 /**
- * Set the duty cycle. Calls `pwm_soft_stop()` and `pwm_soft_start()`
- * to restart outputting the PWM signal with the new duty cycle.
+ * Set the duty cycle. The new duty cycle is used from the start of
+ * the next period, so no period is cut short. Does not wait for the
+ * next period. Starts the driver if stopped.
  *
  * @param[in] self_p Driver object.
  * @param[in] value Duty cycle. Use `pwm_soft_duty_cycle()` to convert
@@ -82,6 +82,13 @@ int ws2812_init(struct ws2812_driver_t *self_p,
 
     int i;
 
+    /* All pins are written with a single masked write. */
+    for (i = 1; i < number_of_pins; i++) {
+        if (pin_device_is_same_port(pins_pp[0], pins_pp[i]) == 0) {
+            return (-EINVAL);
+        }
+    }
+
     self_p->pins_pp = pins_pp;
     self_p->number_of_pins = number_of_pins;
     self_p->mask = 0;
@@ -89,7 +96,7 @@ int ws2812_init(struct ws2812_driver_t *self_p,
     for (i = 0; i < number_of_pins; i++) {
         pin_device_set_mode(pins_pp[i], PIN_OUTPUT);
         pin_device_write_low(pins_pp[i]);
-        self_p->mask |= (1 << pins_pp[i]->id);
+        self_p->mask |= pin_device_mask(pins_pp[i]);
     }
 
     return (0);
@@ -118,7 +125,7 @@ int ws2812_write(struct ws2812_driver_t *self_p,
                 for (l = 0; l < 8; l++) {
                     if (l < self_p->number_of_pins) {
                         if ((buffer_p[l] >> k) & 0x01) {
-                            ones |= (1 << self_p->pins_pp[l]->id);
+                            ones |= pin_device_mask(self_p->pins_pp[l]);
                         } else {
                             nop(1);
                         }
@@ -130,15 +137,15 @@ int ws2812_write(struct ws2812_driver_t *self_p,
                 zeros = ~ones;
                 zeros &= self_p->mask;
 
-                ESP32_GPIO->OUT[0].W1TS = self_p->mask;
+                pin_device_write_mask(self_p->pins_pp[0], self_p->mask, 0);
 
                 /* Zeros. */
                 busy_wait_300_ns();
-                ESP32_GPIO->OUT[0].W1TC = zeros;
+                pin_device_write_mask(self_p->pins_pp[0], 0, zeros);
 
                 /* Ones. */
                 busy_wait_600_ns();
-                ESP32_GPIO->OUT[0].W1TC = ones;
+                pin_device_write_mask(self_p->pins_pp[0], 0, ones);
             }
 
             buffer_p += self_p->number_of_pins;
@@ -61,7 +61,8 @@ int ws2812_module_init(void);
  * @param[out] self_p Driver object to be initialized.
  * @param[in] pin_devices_pp An array of pin device(s) to use. The
  *                           maximum length of the array is defined as
- *                           ``WS2812_PIN_DEVICES_MAX``.
+ *                           ``WS2812_PIN_DEVICES_MAX``. All pins must
+ *                           be in the same GPIO port.
  * @param[in] number_of_pin_devices Number of pin devices in the pin
  *                                  devices array.
  *
@@ -34,6 +34,12 @@
 
 struct module_t {
     int8_t initialized;
+    /* Serializes transfers on each bus. */
+    struct mutex_t mutexes[I2C_DEVICE_MAX];
+#if CONFIG_I2C_TRANSACTION == 1
+    struct transaction_queue_t queue;
+    struct transaction_list_t list;
+#endif
 #if CONFIG_I2C_FS_COMMAND_READ == 1
     struct fs_command_t cmd_read;
 #endif
@@ -53,6 +59,43 @@ struct module_t {
 
 static struct module_t module;
 
+/**
+ * Returns the mutex of the bus of given driver.
+ */
+static struct mutex_t *bus_mutex(struct i2c_driver_t *self_p)
+{
+    return (&module.mutexes[indexof(self_p->dev_p, i2c_device)]);
+}
+
+#if CONFIG_I2C_TRANSACTION == 1
+
+static THRD_STACK(transaction_stack, CONFIG_I2C_TRANSACTION_STACK_SIZE);
+
+static ssize_t transaction_execute(struct transaction_t *transaction_p)
+{
+    struct i2c_transaction_t *self_p;
+
+    self_p = container_of(transaction_p, struct i2c_transaction_t, base);
+
+    return (i2c_transfer(self_p->drv_p,
+                         self_p->address,
+                         self_p->messages_p,
+                         self_p->number_of_messages));
+}
+
+static void transaction_complete(struct transaction_t *transaction_p)
+{
+    struct i2c_transaction_t *self_p;
+
+    self_p = container_of(transaction_p, struct i2c_transaction_t, base);
+
+    if (self_p->callback != NULL) {
+        self_p->callback(self_p->arg_p, self_p);
+    }
+}
+
+#endif
+
 #if CONFIG_I2C_FS_COMMAND_READ == 1
 
 static int cmd_read_cb(int argc,
@@ -191,6 +234,8 @@ static int cmd_scan_cb(int argc,
 
 int i2c_module_init()
 {
+    int i;
+
     /* Return immediately if the module is already initialized. */
     if (module.initialized == 1) {
         return (0);
@@ -198,6 +243,21 @@ int i2c_module_init()
 
     module.initialized = 1;
 
+    for (i = 0; i < membersof(module.mutexes); i++) {
+        mutex_init(&module.mutexes[i]);
+    }
+
+#if CONFIG_I2C_TRANSACTION == 1
+    transaction_queue_init(&module.queue,
+                           "i2c",
+                           &module.list,
+                           1,
+                           transaction_execute,
+                           transaction_complete,
+                           transaction_stack,
+                           sizeof(transaction_stack));
+#endif
+
 #if CONFIG_I2C_FS_COMMAND_READ == 1
     fs_command_init(&module.cmd_read,
                     CSTR("/drivers/i2c/read"),
@@ -255,12 +315,18 @@ ssize_t i2c_read(struct i2c_driver_t *self_p,
                  void *buf_p,
                  size_t size)
 {
+    ssize_t res;
+
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(address < 128, EINVAL);
     ASSERTN(buf_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
-    return (i2c_port_read(self_p, address, buf_p, size));
+    mutex_lock(bus_mutex(self_p));
+    res = i2c_port_read(self_p, address, buf_p, size);
+    mutex_unlock(bus_mutex(self_p));
+
+    return (res);
 }
 
 ssize_t i2c_write(struct i2c_driver_t *self_p,
@@ -268,22 +334,145 @@ ssize_t i2c_write(struct i2c_driver_t *self_p,
                   const void *buf_p,
                   size_t size)
 {
+    ssize_t res;
+
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(address < 128, EINVAL);
     ASSERTN(buf_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
-    return (i2c_port_write(self_p, address, buf_p, size));
+    mutex_lock(bus_mutex(self_p));
+    res = i2c_port_write(self_p, address, buf_p, size);
+    mutex_unlock(bus_mutex(self_p));
+
+    return (res);
 }
 
 int i2c_scan(struct i2c_driver_t *self_p, int address)
 {
+    int res;
+
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(address < 128, EINVAL);
 
-    return (i2c_port_scan(self_p, address));
+    mutex_lock(bus_mutex(self_p));
+    res = i2c_port_scan(self_p, address);
+    mutex_unlock(bus_mutex(self_p));
+
+    return (res);
 }
 
+ssize_t i2c_transfer(struct i2c_driver_t *self_p,
+                     int address,
+                     struct i2c_message_t *messages_p,
+                     size_t number_of_messages)
+{
+    ssize_t res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(address < 128, EINVAL);
+    ASSERTN(messages_p != NULL, EINVAL);
+    ASSERTN(number_of_messages > 0, EINVAL);
+
+    mutex_lock(bus_mutex(self_p));
+    res = i2c_port_transfer(self_p, address, messages_p, number_of_messages);
+    mutex_unlock(bus_mutex(self_p));
+
+    return (res);
+}
+
+ssize_t i2c_write_read(struct i2c_driver_t *self_p,
+                       int address,
+                       const void *txbuf_p,
+                       size_t txsize,
+                       void *rxbuf_p,
+                       size_t rxsize)
+{
+    struct i2c_message_t messages[2];
+    ssize_t res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(address < 128, EINVAL);
+    ASSERTN(txbuf_p != NULL, EINVAL);
+    ASSERTN(txsize > 0, EINVAL);
+    ASSERTN(rxbuf_p != NULL, EINVAL);
+    ASSERTN(rxsize > 0, EINVAL);
+
+    messages[0].flags = I2C_MESSAGE_WRITE;
+    messages[0].buf_p = (void *)txbuf_p;
+    messages[0].size = txsize;
+    messages[1].flags = I2C_MESSAGE_READ;
+    messages[1].buf_p = rxbuf_p;
+    messages[1].size = rxsize;
+
+    res = i2c_transfer(self_p, address, &messages[0], 2);
+
+    if (res < 0) {
+        return (res);
+    }
+
+    if (res != txsize + rxsize) {
+        return (-EIO);
+    }
+
+    return (rxsize);
+}
+
+#if CONFIG_I2C_TRANSACTION == 1
+
+int i2c_transaction_init(struct i2c_transaction_t *self_p,
+                         struct i2c_driver_t *drv_p,
+                         int address,
+                         struct i2c_message_t *messages_p,
+                         size_t number_of_messages,
+                         i2c_transaction_callback_t callback,
+                         void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(drv_p != NULL, EINVAL);
+    ASSERTN(address < 128, EINVAL);
+    ASSERTN(messages_p != NULL, EINVAL);
+    ASSERTN(number_of_messages > 0, EINVAL);
+
+    self_p->drv_p = drv_p;
+    self_p->address = address;
+    self_p->messages_p = messages_p;
+    self_p->number_of_messages = number_of_messages;
+    self_p->callback = callback;
+    self_p->arg_p = arg_p;
+
+    return (transaction_init(&self_p->base));
+}
+
+int i2c_async_transaction(struct i2c_transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (transaction_queue_push(&module.queue, &self_p->base, 0));
+}
+
+ssize_t i2c_transaction_wait(struct i2c_transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (transaction_wait(&self_p->base));
+}
+
+ssize_t i2c_transaction(struct i2c_transaction_t *self_p)
+{
+    ssize_t res;
+
+    res = i2c_async_transaction(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (i2c_transaction_wait(self_p));
+}
+
+#endif
+
 int i2c_slave_start(struct i2c_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
@@ -33,6 +33,8 @@
 
 #include "simba.h"
 
+struct i2c_message_t;
+
 #if CONFIG_SOFTWARE_I2C == 1
 #    include "../ports/software/i2c_port.h"
 #else
@@ -45,8 +47,45 @@
 #define I2C_BAUDRATE_400KBPS     I2C_PORT_BAUDRATE_400KBPS
 #define I2C_BAUDRATE_100KBPS     I2C_PORT_BAUDRATE_100KBPS
 
+/* Message flags. */
+#define I2C_MESSAGE_WRITE                                0x00
+#define I2C_MESSAGE_READ                                 0x01
+
 extern struct i2c_device_t i2c_device[I2C_DEVICE_MAX];
 
+/**
+ * A message in an i2c transfer.
+ */
+struct i2c_message_t {
+    /* I2C_MESSAGE_WRITE or I2C_MESSAGE_READ. */
+    int flags;
+    void *buf_p;
+    size_t size;
+};
+
+struct i2c_transaction_t;
+
+/**
+ * Called from the i2c thread when a transaction has been executed. The
+ * transaction may be queued again by the callback.
+ *
+ * @param[in] arg_p Transaction argument.
+ * @param[in] transaction_p Executed transaction.
+ */
+typedef void (*i2c_transaction_callback_t)(
+    void *arg_p,
+    struct i2c_transaction_t *transaction_p);
+
+struct i2c_transaction_t {
+    struct i2c_driver_t *drv_p;
+    int address;
+    struct i2c_message_t *messages_p;
+    size_t number_of_messages;
+    i2c_transaction_callback_t callback;
+    void *arg_p;
+    struct transaction_t base;
+};
+
 /**
  * Initialize the i2c module. This function must be called before
  * calling any other function in this module.
@@ -139,6 +178,101 @@ ssize_t i2c_write(struct i2c_driver_t *self_p,
  */
 int i2c_scan(struct i2c_driver_t *self_p, int address);
 
+/**
+ * Transfer given messages to and from given slave. The messages are
+ * separated by repeated start conditions and the stop condition is
+ * sent after the last message, so no other master can access the
+ * slave during the transfer. Ports without repeated start support
+ * send a stop condition after each message.
+ *
+ * @param[in] self_p Driver object.
+ * @param[in] address Slave address.
+ * @param[in,out] messages_p Messages to transfer.
+ * @param[in] number_of_messages Number of messages.
+ *
+ * @return Total number of transferred bytes or negative error code.
+ */
+ssize_t i2c_transfer(struct i2c_driver_t *self_p,
+                     int address,
+                     struct i2c_message_t *messages_p,
+                     size_t number_of_messages);
+
+/**
+ * Write given data to given slave, followed by a repeated start and
+ * a read from the slave. Typically used to read registers, where the
+ * written data is the register address.
+ *
+ * @param[in] self_p Driver object.
+ * @param[in] address Slave address.
+ * @param[in] txbuf_p Data to write.
+ * @param[in] txsize Number of bytes to write.
+ * @param[out] rxbuf_p Buffer to read into.
+ * @param[in] rxsize Number of bytes to read.
+ *
+ * @return Number of read bytes or negative error code.
+ */
+ssize_t i2c_write_read(struct i2c_driver_t *self_p,
+                       int address,
+                       const void *txbuf_p,
+                       size_t txsize,
+                       void *rxbuf_p,
+                       size_t rxsize);
+
+/**
+ * Initialize given transaction, a transfer of given messages to and
+ * from given slave, executed by the i2c thread.
+ *
+ * @param[out] self_p Transaction to initialize.
+ * @param[in] drv_p Started driver object.
+ * @param[in] address Slave address.
+ * @param[in,out] messages_p Messages to transfer.
+ * @param[in] number_of_messages Number of messages.
+ * @param[in] callback Callback called when the transaction has been
+ *                     executed, or NULL.
+ * @param[in] arg_p Callback argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int i2c_transaction_init(struct i2c_transaction_t *self_p,
+                         struct i2c_driver_t *drv_p,
+                         int address,
+                         struct i2c_message_t *messages_p,
+                         size_t number_of_messages,
+                         i2c_transaction_callback_t callback,
+                         void *arg_p);
+
+/**
+ * Queue given transaction on its bus and return immediately. Queued
+ * transactions are executed back-to-back in order by the i2c thread,
+ * which is started when the first transaction is queued. The i2c
+ * thread and the blocking functions take turns on the bus.
+ *
+ * @param[in] self_p Initialized transaction.
+ *
+ * @return zero(0), -EBUSY if the transaction is already queued,
+ *         -ENOMEM if the i2c thread could not be started, or other
+ *         negative error code.
+ */
+int i2c_async_transaction(struct i2c_transaction_t *self_p);
+
+/**
+ * Wait for given queued transaction to be executed.
+ *
+ * @param[in] self_p Queued transaction.
+ *
+ * @return Total number of transferred bytes or negative error code.
+ */
+ssize_t i2c_transaction_wait(struct i2c_transaction_t *self_p);
+
+/**
+ * Queue given transaction and wait for it to be executed.
+ *
+ * @param[in] self_p Initialized transaction.
+ *
+ * @return Total number of transferred bytes or negative error code.
+ */
+ssize_t i2c_transaction(struct i2c_transaction_t *self_p);
+
 /**
  * Start given driver object in slave mode. Enables data reception and
  * transmission, but does not start any transmission. Data transfers
@@ -245,6 +245,87 @@ static int read_byte(struct i2c_soft_driver_t *self_p,
     return (0);
 }
 
+/**
+ * Send the repeated start condition. SCL is low when this function
+ * is called. SDA is released before SCL, and then the start condition
+ * is sent.
+ */
+static int repeated_start_cond(struct i2c_soft_driver_t *self_p)
+{
+    /* Set SDA to 1. */
+    pin_device_set_mode(self_p->sda_p, PIN_INPUT);
+    time_busy_wait_us(self_p->baudrate_us);
+
+    /* Set SCL to 1. */
+    pin_device_set_mode(self_p->scl_p, PIN_INPUT);
+
+    /* Clock stretching. */
+    if (wait_for_clock_stretching_end(self_p) != 0) {
+        return (-1);
+    }
+
+    /* Repeated start setup time, minimum 4.7us. */
+    time_busy_wait_us(self_p->baudrate_us);
+
+    return (start_cond(self_p));
+}
+
+/**
+ * Write the address with the direction bit set to 1 and read the
+ * data. The start condition must already have been sent.
+ */
+static int read_data(struct i2c_soft_driver_t *self_p,
+                     int address,
+                     uint8_t *buf_p,
+                     size_t size)
+{
+    size_t i;
+    int ack;
+
+    /* Write the address with the direction bit set to 1. */
+    if (write_byte(self_p, ((address << 1) | 0x1)) != 0) {
+        return (-1);
+    }
+
+    /* Read the data. */
+    for (i = 0; i < size; i++) {
+        /* ACK all but last read byte. */
+        ack = (i + 1 != size);
+
+        if (read_byte(self_p, &buf_p[i], ack) != 0) {
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Write the address with the direction bit set to 0 and write the
+ * data. The start condition must already have been sent.
+ */
+static int write_data(struct i2c_soft_driver_t *self_p,
+                      int address,
+                      const uint8_t *buf_p,
+                      size_t size)
+{
+    size_t i;
+
+    /* Write the address with the direction bit set to 0. */
+    if (write_byte(self_p, ((address << 1) | 0x0)) != 0) {
+        return (-1);
+    }
+
+    /* Write the data. */
+    for (i = 0; i < size; i++) {
+        if (write_byte(self_p, buf_p[i]) != 0) {
+            return (-1);
+        }
+    }
+
+    return (0);
+}
+
 int i2c_soft_module_init()
 {
     return (0);
@@ -291,34 +372,16 @@ ssize_t i2c_soft_read(struct i2c_soft_driver_t *self_p,
                       void *buf_p,
                       size_t size)
 {
-    size_t i;
-    uint8_t *b_p;
-    int ack;
-
-    b_p = buf_p;
-
     /* Send the start condition. */
     if (start_cond(self_p) != 0) {
         return (-1);
     }
 
-    /* Write the address with the direction bit set to 1. */
-    if (write_byte(self_p, ((address << 1) | 0x1)) != 0) {
+    if (read_data(self_p, address, buf_p, size) != 0) {
         stop_cond(self_p);
         return (-1);
     }
 
-    /* Read the data. */
-    for (i = 0; i < size; i++) {
-        /* ACK all but last read byte. */
-        ack = (i + 1 != size);
-
-        if (read_byte(self_p, &b_p[i], ack) != 0) {
-            stop_cond(self_p);
-            return (-1);
-        }
-    }
-
     /* Send the stop condition. */
     if (stop_cond(self_p) != 0) {
         return (-1);
@@ -332,28 +395,51 @@ ssize_t i2c_soft_write(struct i2c_soft_driver_t *self_p,
                        const void *buf_p,
                        size_t size)
 {
-    size_t i;
-    const uint8_t *b_p;
+    /* Send the start condition. */
+    if (start_cond(self_p) != 0) {
+        return (-1);
+    }
 
-    b_p = buf_p;
+    if (write_data(self_p, address, buf_p, size) != 0) {
+        stop_cond(self_p);
+        return (-1);
+    }
 
+    /* Send the stop condition. */
+    if (stop_cond(self_p) != 0) {
+        return (-1);
+    }
+
+    return (size);
+}
+
+ssize_t i2c_soft_write_read(struct i2c_soft_driver_t *self_p,
+                            int address,
+                            const void *txbuf_p,
+                            size_t txsize,
+                            void *rxbuf_p,
+                            size_t rxsize)
+{
     /* Send the start condition. */
     if (start_cond(self_p) != 0) {
         return (-1);
     }
 
-    /* Write the address with the direction bit set to 0. */
-    if (write_byte(self_p, ((address << 1) | 0x0)) != 0) {
+    if (write_data(self_p, address, txbuf_p, txsize) != 0) {
         stop_cond(self_p);
         return (-1);
     }
 
-    /* Write the data. */
-    for (i = 0; i < size; i++) {
-        if (write_byte(self_p, b_p[i]) != 0) {
-            stop_cond(self_p);
-            return (-1);
-        }
+    /* Keep the bus by sending a repeated start condition instead of
+       a stop condition before the read. */
+    if (repeated_start_cond(self_p) != 0) {
+        stop_cond(self_p);
+        return (-1);
+    }
+
+    if (read_data(self_p, address, rxbuf_p, rxsize) != 0) {
+        stop_cond(self_p);
+        return (-1);
     }
 
     /* Send the stop condition. */
@@ -361,7 +447,7 @@ ssize_t i2c_soft_write(struct i2c_soft_driver_t *self_p,
         return (-1);
     }
 
-    return (size);
+    return (rxsize);
 }
 
 int i2c_soft_scan(struct i2c_soft_driver_t *self_p,
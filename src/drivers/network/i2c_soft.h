@@ -126,6 +126,26 @@ ssize_t i2c_soft_write(struct i2c_soft_driver_t *self_p,
                        const void *buf_p,
                        size_t size);
 
+/**
+ * Write given data to given slave, followed by a repeated start
+ * condition and a read from the slave.
+ *
+ * @param[in] self_p Driver object.
+ * @param[in] address Slave address.
+ * @param[in] txbuf_p Data to write.
+ * @param[in] txsize Number of bytes to write.
+ * @param[out] rxbuf_p Buffer to read into.
+ * @param[in] rxsize Number of bytes to read.
+ *
+ * @return Number of bytes read or negative error code.
+ */
+ssize_t i2c_soft_write_read(struct i2c_soft_driver_t *self_p,
+                            int address,
+                            const void *txbuf_p,
+                            size_t txsize,
+                            void *rxbuf_p,
+                            size_t rxsize);
+
 /**
  * Scan the i2c bus for a slave with given address.
  *
@@ -32,9 +32,54 @@
 
 #if CONFIG_JTAG_SOFT == 1
 
-static int clock_low(struct jtag_soft_driver_t *self_p)
+/**
+ * Add given pin value to the high or low mask if the pin is in the
+ * TCK port, otherwise write it immediately. A value of -1 leaves the
+ * pin unchanged.
+ */
+static void prepare_write(const struct pin_device_t *dev_p,
+                          uint32_t mask,
+                          int value,
+                          uint32_t *high_mask_p,
+                          uint32_t *low_mask_p)
+{
+    if (value == -1) {
+        return;
+    }
+
+    if (mask == 0) {
+        pin_device_write(dev_p, value);
+    } else if (value == 1) {
+        *high_mask_p |= mask;
+    } else {
+        *low_mask_p |= mask;
+    }
+}
+
+/**
+ * Write given values to TMS and TDI and then drive TCK low. Pins in
+ * the TCK port are written together with TCK in a single port
+ * access.
+ */
+static int clock_low(struct jtag_soft_driver_t *self_p, int tms, int tdi)
 {
-    pin_write(&self_p->tck, 0);
+    uint32_t high_mask;
+    uint32_t low_mask;
+
+    high_mask = 0;
+    low_mask = self_p->tck_mask;
+
+    prepare_write(self_p->tms_p,
+                  self_p->tms_mask,
+                  tms,
+                  &high_mask,
+                  &low_mask);
+    prepare_write(self_p->tdi_p,
+                  self_p->tdi_mask,
+                  tdi,
+                  &high_mask,
+                  &low_mask);
+    pin_device_write_mask(self_p->tck_p, high_mask, low_mask);
     time_busy_wait_us(1);
 
     return (0);
@@ -42,18 +87,20 @@ static int clock_low(struct jtag_soft_driver_t *self_p)
 
 static int clock_high(struct jtag_soft_driver_t *self_p)
 {
-    pin_write(&self_p->tck, 1);
+    pin_device_write_high(self_p->tck_p);
     time_busy_wait_us(1);
 
     return (0);
 }
 
-static int clock_pulse(struct jtag_soft_driver_t *self_p)
+static uint32_t tck_port_mask(struct jtag_soft_driver_t *self_p,
+                              const struct pin_device_t *dev_p)
 {
-    clock_low(self_p);
-    clock_high(self_p);
-
-    return (0);
+    if (pin_device_is_same_port(self_p->tck_p, dev_p)) {
+        return (pin_device_mask(dev_p));
+    } else {
+        return (0);
+    }
 }
 
 static int move(struct jtag_soft_driver_t *self_p,
@@ -104,6 +151,8 @@ static int transfer(struct jtag_soft_driver_t *self_p,
     size_t bit_index;
     uint8_t *u8_rxbuf_p;
     const uint8_t *u8_txbuf_p;
+    int tms;
+    int tdi;
     int value;
 
     u8_rxbuf_p = rxbuf_p;
@@ -119,18 +168,21 @@ static int transfer(struct jtag_soft_driver_t *self_p,
 
         /* The last bit is transferred with TMS=1. */
         if (i == (number_of_bits - 1)) {
-            pin_write(&self_p->tms, 1);
+            tms = 1;
+        } else {
+            tms = -1;
         }
 
         if (u8_txbuf_p != NULL) {
-            value = ((u8_txbuf_p[byte_index] >> bit_index) & 1);
-            pin_write(&self_p->tdi, value);
+            tdi = ((u8_txbuf_p[byte_index] >> bit_index) & 1);
+        } else {
+            tdi = -1;
         }
 
-        clock_low(self_p);
+        clock_low(self_p, tms, tdi);
 
         if (u8_rxbuf_p != NULL) {
-            value = pin_read(&self_p->tdo);
+            value = pin_device_read(self_p->tdo_p);
             u8_rxbuf_p[byte_index] |= (value << bit_index);
         }
 
@@ -152,11 +204,23 @@ int jtag_soft_init(struct jtag_soft_driver_t *self_p,
                    struct pin_device_t *tdo_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
-
-    pin_init(&self_p->tck, tck_p, PIN_INPUT);
-    pin_init(&self_p->tms, tms_p, PIN_INPUT);
-    pin_init(&self_p->tdi, tdi_p, PIN_INPUT);
-    pin_init(&self_p->tdo, tdo_p, PIN_INPUT);
+    ASSERTN(tck_p != NULL, EINVAL);
+    ASSERTN(tms_p != NULL, EINVAL);
+    ASSERTN(tdi_p != NULL, EINVAL);
+    ASSERTN(tdo_p != NULL, EINVAL);
+
+    self_p->tck_p = tck_p;
+    self_p->tms_p = tms_p;
+    self_p->tdi_p = tdi_p;
+    self_p->tdo_p = tdo_p;
+    self_p->tck_mask = pin_device_mask(tck_p);
+    self_p->tms_mask = tck_port_mask(self_p, tms_p);
+    self_p->tdi_mask = tck_port_mask(self_p, tdi_p);
+
+    pin_device_set_mode(tck_p, PIN_INPUT);
+    pin_device_set_mode(tms_p, PIN_INPUT);
+    pin_device_set_mode(tdi_p, PIN_INPUT);
+    pin_device_set_mode(tdo_p, PIN_INPUT);
 
     return (0);
 }
@@ -165,9 +229,9 @@ int jtag_soft_start(struct jtag_soft_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    pin_set_mode(&self_p->tck, PIN_OUTPUT);
-    pin_set_mode(&self_p->tms, PIN_OUTPUT);
-    pin_set_mode(&self_p->tdi, PIN_OUTPUT);
+    pin_device_set_mode(self_p->tck_p, PIN_OUTPUT);
+    pin_device_set_mode(self_p->tms_p, PIN_OUTPUT);
+    pin_device_set_mode(self_p->tdi_p, PIN_OUTPUT);
 
     return (jtag_soft_reset(self_p));
 }
@@ -178,9 +242,9 @@ int jtag_soft_stop(struct jtag_soft_driver_t *self_p)
 
     move_to_reset(self_p);
 
-    pin_set_mode(&self_p->tck, PIN_INPUT);
-    pin_set_mode(&self_p->tms, PIN_INPUT);
-    pin_set_mode(&self_p->tdi, PIN_INPUT);
+    pin_device_set_mode(self_p->tck_p, PIN_INPUT);
+    pin_device_set_mode(self_p->tms_p, PIN_INPUT);
+    pin_device_set_mode(self_p->tdi_p, PIN_INPUT);
 
     return (0);
 }
@@ -245,9 +309,9 @@ int jtag_soft_make_transition(struct jtag_soft_driver_t *self_p,
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN((transition == 0) || (transition == 1), EINVAL);
 
-    pin_write(&self_p->tms, transition);
+    clock_low(self_p, transition, -1);
 
-    return (clock_pulse(self_p));
+    return (clock_high(self_p));
 }
 
 #endif
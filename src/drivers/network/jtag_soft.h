@@ -34,10 +34,15 @@
 #include "simba.h"
 
 struct jtag_soft_driver_t {
-    struct pin_driver_t tck;
-    struct pin_driver_t tms;
-    struct pin_driver_t tdi;
-    struct pin_driver_t tdo;
+    struct pin_device_t *tck_p;
+    struct pin_device_t *tms_p;
+    struct pin_device_t *tdi_p;
+    struct pin_device_t *tdo_p;
+    uint32_t tck_mask;
+    /* Masks of TMS and TDI in the TCK port, or zero(0) if in another
+       port. */
+    uint32_t tms_mask;
+    uint32_t tdi_mask;
 };
 
 /**
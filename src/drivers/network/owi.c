@@ -59,16 +59,16 @@ int owi_reset(struct owi_driver_t *self_p)
     int err;
 
     do {
-        pin_write(&self_p->pin, 0);
+        pin_device_write_low(self_p->pin.dev_p);
         time_busy_wait_us(480);
         sys_lock();
-        pin_write(&self_p->pin, 1);
-        pin_set_mode(&self_p->pin, PIN_INPUT);
+        pin_device_write_high(self_p->pin.dev_p);
+        pin_device_set_mode(self_p->pin.dev_p, PIN_INPUT);
         time_busy_wait_us(70);
-        err = pin_read(&self_p->pin);
+        err = pin_device_read(self_p->pin.dev_p);
         sys_unlock();
         time_busy_wait_us(410);
-        pin_set_mode(&self_p->pin, PIN_OUTPUT);
+        pin_device_set_mode(self_p->pin.dev_p, PIN_OUTPUT);
     } while ((--attempts > 0) && (err != 0));
 
     return (err == 0);
@@ -171,16 +171,16 @@ ssize_t owi_read(struct owi_driver_t *self_p,
 
     for (i = 0; i < size; i++) {
         sys_lock();
-        pin_write(&self_p->pin, 0);
+        pin_device_write_low(self_p->pin.dev_p);
         time_busy_wait_us(5);
-        pin_set_mode(&self_p->pin, PIN_INPUT);
+        pin_device_set_mode(self_p->pin.dev_p, PIN_INPUT);
         time_busy_wait_us(9);
         *b_p >>= 1;
-        *b_p |= (pin_read(&self_p->pin) << 7);
+        *b_p |= (pin_device_read(self_p->pin.dev_p) << 7);
         sys_unlock();
         time_busy_wait_us(55);
-        pin_set_mode(&self_p->pin, PIN_OUTPUT);
-        pin_write(&self_p->pin, 1);
+        pin_device_set_mode(self_p->pin.dev_p, PIN_OUTPUT);
+        pin_device_write_high(self_p->pin.dev_p);
 
         if ((i & 0x7) == 0x7) {
             b_p++;
@@ -213,15 +213,15 @@ ssize_t owi_write(struct owi_driver_t *self_p,
         }
 
         sys_lock();
-        pin_write(&self_p->pin, 0);
+        pin_device_write_low(self_p->pin.dev_p);
 
         if (value & 1) {
             time_busy_wait_us(5);
-            pin_write(&self_p->pin, 1);
+            pin_device_write_high(self_p->pin.dev_p);
             time_busy_wait_us(64);
         } else {
             time_busy_wait_us(59);
-            pin_write(&self_p->pin, 1);
+            pin_device_write_high(self_p->pin.dev_p);
             time_busy_wait_us(10);
         }
 
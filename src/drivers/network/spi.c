@@ -34,12 +34,83 @@
 
 struct module_t {
     int8_t initialized;
+#if CONFIG_SPI_TRANSACTION == 1
+    struct transaction_queue_t queue;
+    /* One transaction list per bus. */
+    struct transaction_list_t lists[SPI_DEVICE_MAX];
+#endif
 };
 
 #include "spi_port.i"
 
 static struct module_t module;
 
+#if CONFIG_SPI_TRANSACTION == 1
+
+static THRD_STACK(transaction_stack, CONFIG_SPI_TRANSACTION_STACK_SIZE);
+
+static ssize_t transaction_execute(struct transaction_t *transaction_p)
+{
+    struct spi_transaction_t *self_p;
+    struct spi_transfer_t *transfer_p;
+    ssize_t res;
+    ssize_t size;
+    size_t i;
+
+    self_p = container_of(transaction_p, struct spi_transaction_t, base);
+    size = 0;
+    res = 0;
+
+    spi_take_bus(self_p->drv_p);
+    spi_select(self_p->drv_p);
+
+    for (i = 0; i < self_p->number_of_transfers; i++) {
+        transfer_p = &self_p->transfers_p[i];
+        res = spi_port_transfer(self_p->drv_p,
+                                transfer_p->rxbuf_p,
+                                transfer_p->txbuf_p,
+                                transfer_p->size);
+
+        if (res != transfer_p->size) {
+            if (res >= 0) {
+                res = -EIO;
+            }
+
+            break;
+        }
+
+        size += res;
+
+        if ((transfer_p->deselect == 1)
+            && (i < self_p->number_of_transfers - 1)) {
+            spi_deselect(self_p->drv_p);
+            spi_select(self_p->drv_p);
+        }
+    }
+
+    spi_deselect(self_p->drv_p);
+    spi_give_bus(self_p->drv_p);
+
+    if (res < 0) {
+        return (res);
+    }
+
+    return (size);
+}
+
+static void transaction_complete(struct transaction_t *transaction_p)
+{
+    struct spi_transaction_t *self_p;
+
+    self_p = container_of(transaction_p, struct spi_transaction_t, base);
+
+    if (self_p->callback != NULL) {
+        self_p->callback(self_p->arg_p, self_p);
+    }
+}
+
+#endif
+
 int spi_module_init(void)
 {
     /* Return immediately if the module is already initialized. */
@@ -49,6 +120,17 @@ int spi_module_init(void)
 
     module.initialized = 1;
 
+#if CONFIG_SPI_TRANSACTION == 1
+    transaction_queue_init(&module.queue,
+                           "spi",
+                           &module.lists[0],
+                           membersof(module.lists),
+                           transaction_execute,
+                           transaction_complete,
+                           transaction_stack,
+                           sizeof(transaction_stack));
+#endif
+
     return (spi_port_module_init());
 }
 
@@ -191,4 +273,60 @@ ssize_t spi_put(struct spi_driver_t *self_p,
     return (spi_write(self_p, &data, 1));
 }
 
+#if CONFIG_SPI_TRANSACTION == 1
+
+int spi_transaction_init(struct spi_transaction_t *self_p,
+                         struct spi_driver_t *drv_p,
+                         struct spi_transfer_t *transfers_p,
+                         size_t number_of_transfers,
+                         spi_transaction_callback_t callback,
+                         void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(drv_p != NULL, EINVAL);
+    ASSERTN(transfers_p != NULL, EINVAL);
+    ASSERTN(number_of_transfers > 0, EINVAL);
+
+    self_p->drv_p = drv_p;
+    self_p->transfers_p = transfers_p;
+    self_p->number_of_transfers = number_of_transfers;
+    self_p->callback = callback;
+    self_p->arg_p = arg_p;
+
+    return (transaction_init(&self_p->base));
+}
+
+int spi_async_transaction(struct spi_transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (transaction_queue_push(&module.queue,
+                                   &self_p->base,
+                                   self_p->drv_p->dev_p - &spi_device[0]));
+}
+
+ssize_t spi_transaction_wait(struct spi_transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (transaction_wait(&self_p->base));
+}
+
+ssize_t spi_transaction(struct spi_transaction_t *self_p)
+{
+    int res;
+
+    ASSERTN(self_p != NULL, EINVAL);
+
+    res = spi_async_transaction(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (spi_transaction_wait(self_p));
+}
+
+#endif
+
 #endif
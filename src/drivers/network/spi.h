@@ -49,6 +49,42 @@
 
 extern struct spi_device_t spi_device[SPI_DEVICE_MAX];
 
+/**
+ * A transfer in a SPI transaction.
+ */
+struct spi_transfer_t {
+    /* Receive buffer or NULL. */
+    void *rxbuf_p;
+    /* Transmit buffer or NULL. */
+    const void *txbuf_p;
+    size_t size;
+    /* Deselect the slave after this transfer, and select it again
+       before the next transfer, if any. */
+    int deselect;
+};
+
+struct spi_transaction_t;
+
+/**
+ * Called from the SPI thread when a transaction has been executed. The
+ * transaction may be queued again by the callback.
+ *
+ * @param[in] arg_p Transaction argument.
+ * @param[in] transaction_p Executed transaction.
+ */
+typedef void (*spi_transaction_callback_t)(
+    void *arg_p,
+    struct spi_transaction_t *transaction_p);
+
+struct spi_transaction_t {
+    struct spi_driver_t *drv_p;
+    struct spi_transfer_t *transfers_p;
+    size_t number_of_transfers;
+    spi_transaction_callback_t callback;
+    void *arg_p;
+    struct transaction_t base;
+};
+
 /**
  * Initialize SPI module. This function must be called before calling
  * any other function in this module.
@@ -200,4 +236,57 @@ ssize_t spi_get(struct spi_driver_t *self_p, uint8_t *data_p);
  */
 ssize_t spi_put(struct spi_driver_t *self_p, uint8_t data);
 
+/**
+ * Initialize given transaction. A transaction is a chain of transfers
+ * to given slave, executed with the slave selected and the SPI
+ * hardware configured with the clock and mode of given driver.
+ *
+ * @param[out] self_p Transaction to initialize.
+ * @param[in] drv_p Initialized driver object of the slave.
+ * @param[in] transfers_p Array of transfers.
+ * @param[in] number_of_transfers Number of transfers.
+ * @param[in] callback Callback called when the transaction has been
+ *                     executed, or NULL.
+ * @param[in] arg_p Callback argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int spi_transaction_init(struct spi_transaction_t *self_p,
+                         struct spi_driver_t *drv_p,
+                         struct spi_transfer_t *transfers_p,
+                         size_t number_of_transfers,
+                         spi_transaction_callback_t callback,
+                         void *arg_p);
+
+/**
+ * Queue given transaction on its bus and return immediately. Queued
+ * transactions are executed back-to-back in order by the SPI thread,
+ * which takes the bus as `spi_take_bus()`.
+ *
+ * @param[in] self_p Initialized transaction.
+ *
+ * @return zero(0), -EBUSY if the transaction is already queued,
+ *         -ENOMEM if the SPI thread could not be started, or other
+ *         negative error code.
+ */
+int spi_async_transaction(struct spi_transaction_t *self_p);
+
+/**
+ * Wait for given queued transaction to be executed.
+ *
+ * @param[in] self_p Queued transaction.
+ *
+ * @return Number of transferred bytes or negative error code.
+ */
+ssize_t spi_transaction_wait(struct spi_transaction_t *self_p);
+
+/**
+ * Queue given transaction and wait for it to be executed.
+ *
+ * @param[in] self_p Initialized transaction.
+ *
+ * @return Number of transferred bytes or negative error code.
+ */
+ssize_t spi_transaction(struct spi_transaction_t *self_p);
+
 #endif
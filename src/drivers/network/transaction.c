@@ -0,0 +1,246 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#if (CONFIG_SPI_TRANSACTION == 1) || (CONFIG_I2C_TRANSACTION == 1)
+
+/* Transaction states. */
+#define TRANSACTION_STATE_IDLE                              0
+#define TRANSACTION_STATE_QUEUED                            1
+
+/**
+ * Dequeue the next transaction. The lists are served round-robin, one
+ * transaction at a time.
+ */
+static struct transaction_t *dequeue_isr(struct transaction_queue_t *self_p)
+{
+    struct transaction_list_t *list_p;
+    struct transaction_t *transaction_p;
+    int i;
+
+    for (i = 0; i < self_p->number_of_lists; i++) {
+        list_p = &self_p->lists_p[self_p->next_list];
+        self_p->next_list++;
+        self_p->next_list %= self_p->number_of_lists;
+        transaction_p = list_p->head_p;
+
+        if (transaction_p != NULL) {
+            list_p->head_p = transaction_p->next_p;
+
+            return (transaction_p);
+        }
+    }
+
+    return (NULL);
+}
+
+static void *queue_main(void *arg_p)
+{
+    struct transaction_queue_t *self_p;
+    struct transaction_t *transaction_p;
+    struct thrd_t *thrd_p;
+    ssize_t res;
+
+    self_p = arg_p;
+
+    thrd_set_name(self_p->name_p);
+
+    sys_lock();
+    self_p->thrd_p = thrd_self();
+    sys_unlock();
+
+    while (1) {
+        sys_lock();
+
+        transaction_p = dequeue_isr(self_p);
+
+        if (transaction_p == NULL) {
+            self_p->is_waiting = 1;
+            thrd_suspend_isr(NULL);
+        }
+
+        sys_unlock();
+
+        if (transaction_p == NULL) {
+            continue;
+        }
+
+        res = self_p->execute(transaction_p);
+
+        /* The transaction is idle when the complete function is
+           called, so it may be queued again. */
+        sys_lock();
+        transaction_p->res = res;
+        transaction_p->state = TRANSACTION_STATE_IDLE;
+        thrd_p = transaction_p->thrd_p;
+        transaction_p->thrd_p = NULL;
+        sys_unlock();
+
+        self_p->complete(transaction_p);
+
+        if (thrd_p != NULL) {
+            thrd_resume(thrd_p, 0);
+        }
+    }
+
+    return (NULL);
+}
+
+int transaction_queue_init(struct transaction_queue_t *self_p,
+                           const char *name_p,
+                           struct transaction_list_t *lists_p,
+                           int number_of_lists,
+                           transaction_execute_t execute,
+                           transaction_complete_t complete,
+                           void *stack_p,
+                           size_t stack_size)
+{
+    int i;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(name_p != NULL, EINVAL);
+    ASSERTN(lists_p != NULL, EINVAL);
+    ASSERTN(number_of_lists > 0, EINVAL);
+    ASSERTN(execute != NULL, EINVAL);
+    ASSERTN(complete != NULL, EINVAL);
+    ASSERTN(stack_p != NULL, EINVAL);
+
+    for (i = 0; i < number_of_lists; i++) {
+        lists_p[i].head_p = NULL;
+        lists_p[i].tail_p = NULL;
+    }
+
+    self_p->name_p = name_p;
+    self_p->lists_p = lists_p;
+    self_p->number_of_lists = number_of_lists;
+    self_p->next_list = 0;
+    self_p->execute = execute;
+    self_p->complete = complete;
+    self_p->stack_p = stack_p;
+    self_p->stack_size = stack_size;
+    self_p->is_started = 0;
+    self_p->is_waiting = 0;
+    self_p->thrd_p = NULL;
+
+    return (0);
+}
+
+int transaction_queue_push(struct transaction_queue_t *self_p,
+                           struct transaction_t *transaction_p,
+                           int list)
+{
+    struct transaction_list_t *list_p;
+    int is_started;
+
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(transaction_p != NULL, EINVAL);
+    ASSERTN((list >= 0) && (list < self_p->number_of_lists), EINVAL);
+
+    list_p = &self_p->lists_p[list];
+
+    /* Start the queue thread when the first transaction is queued. */
+    sys_lock();
+    is_started = self_p->is_started;
+    self_p->is_started = 1;
+    sys_unlock();
+
+    if (is_started == 0) {
+        if (thrd_spawn(queue_main,
+                       self_p,
+                       0,
+                       self_p->stack_p,
+                       self_p->stack_size) == NULL) {
+            sys_lock();
+            self_p->is_started = 0;
+            sys_unlock();
+
+            return (-ENOMEM);
+        }
+    }
+
+    sys_lock();
+
+    if (transaction_p->state != TRANSACTION_STATE_IDLE) {
+        sys_unlock();
+
+        return (-EBUSY);
+    }
+
+    transaction_p->state = TRANSACTION_STATE_QUEUED;
+    transaction_p->next_p = NULL;
+
+    if (list_p->head_p == NULL) {
+        list_p->head_p = transaction_p;
+    } else {
+        list_p->tail_p->next_p = transaction_p;
+    }
+
+    list_p->tail_p = transaction_p;
+
+    if (self_p->is_waiting == 1) {
+        self_p->is_waiting = 0;
+        thrd_resume_isr(self_p->thrd_p, 0);
+    }
+
+    sys_unlock();
+
+    return (0);
+}
+
+int transaction_init(struct transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->state = TRANSACTION_STATE_IDLE;
+    self_p->res = 0;
+    self_p->thrd_p = NULL;
+    self_p->next_p = NULL;
+
+    return (0);
+}
+
+ssize_t transaction_wait(struct transaction_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    sys_lock();
+
+    if (self_p->state == TRANSACTION_STATE_QUEUED) {
+        self_p->thrd_p = thrd_self();
+        thrd_suspend_isr(NULL);
+    }
+
+    sys_unlock();
+
+    return (self_p->res);
+}
+
+#endif
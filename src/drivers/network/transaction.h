@@ -0,0 +1,150 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#ifndef __DRIVERS_TRANSACTION_H__
+#define __DRIVERS_TRANSACTION_H__
+
+#include "simba.h"
+
+struct transaction_t;
+
+/**
+ * Execute given transaction. Called from the queue thread.
+ *
+ * @param[in] transaction_p Transaction to execute.
+ *
+ * @return Transaction result.
+ */
+typedef ssize_t (*transaction_execute_t)(struct transaction_t *transaction_p);
+
+/**
+ * Called from the queue thread when given transaction has been
+ * executed. The transaction is idle and may be queued again.
+ *
+ * @param[in] transaction_p Executed transaction.
+ */
+typedef void (*transaction_complete_t)(struct transaction_t *transaction_p);
+
+/**
+ * A transaction, embedded in the transactions of the bus drivers.
+ */
+struct transaction_t {
+    int state;
+    ssize_t res;
+    struct thrd_t *thrd_p;
+    struct transaction_t *next_p;
+};
+
+/**
+ * A list of queued transactions, typically one per bus.
+ */
+struct transaction_list_t {
+    struct transaction_t *head_p;
+    struct transaction_t *tail_p;
+};
+
+/**
+ * Transactions queued on a number of lists and executed by a thread,
+ * one at a time. The lists are served round-robin.
+ */
+struct transaction_queue_t {
+    const char *name_p;
+    struct transaction_list_t *lists_p;
+    int number_of_lists;
+    int next_list;
+    transaction_execute_t execute;
+    transaction_complete_t complete;
+    void *stack_p;
+    size_t stack_size;
+    int is_started;
+    int is_waiting;
+    struct thrd_t *thrd_p;
+};
+
+/**
+ * Initialize given transaction queue. The queue thread is started
+ * when the first transaction is queued.
+ *
+ * @param[out] self_p Queue to initialize.
+ * @param[in] name_p Name of the queue thread.
+ * @param[in] lists_p Array of lists.
+ * @param[in] number_of_lists Number of lists.
+ * @param[in] execute Transaction execute function.
+ * @param[in] complete Transaction complete function.
+ * @param[in] stack_p Queue thread stack.
+ * @param[in] stack_size Queue thread stack size.
+ *
+ * @return zero(0) or negative error code.
+ */
+int transaction_queue_init(struct transaction_queue_t *self_p,
+                           const char *name_p,
+                           struct transaction_list_t *lists_p,
+                           int number_of_lists,
+                           transaction_execute_t execute,
+                           transaction_complete_t complete,
+                           void *stack_p,
+                           size_t stack_size);
+
+/**
+ * Queue given transaction last in given list and return
+ * immediately.
+ *
+ * @param[in] self_p Initialized queue.
+ * @param[in] transaction_p Initialized transaction.
+ * @param[in] list Index of the list.
+ *
+ * @return zero(0), -EBUSY if the transaction is already queued,
+ *         -ENOMEM if the queue thread could not be started, or other
+ *         negative error code.
+ */
+int transaction_queue_push(struct transaction_queue_t *self_p,
+                           struct transaction_t *transaction_p,
+                           int list);
+
+/**
+ * Initialize given transaction.
+ *
+ * @param[out] self_p Transaction to initialize.
+ *
+ * @return zero(0) or negative error code.
+ */
+int transaction_init(struct transaction_t *self_p);
+
+/**
+ * Wait for given queued transaction to be executed. Returns
+ * immediately if the transaction is not queued.
+ *
+ * @param[in] self_p Transaction.
+ *
+ * @return Result of the last execution of the transaction.
+ */
+ssize_t transaction_wait(struct transaction_t *self_p);
+
+#endif
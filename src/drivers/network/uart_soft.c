@@ -55,7 +55,7 @@ static void rx_isr(void *arg_p)
 
         /* Sample the pin. */
         data >>= 1;
-        sample = pin_read(&self_p->rx_pin);
+        sample = pin_device_read(self_p->rx_pin.dev_p);
         data |= (0x80 * sample);
     }
 
@@ -76,25 +76,27 @@ static ssize_t uart_soft_write_cb(void *arg_p,
     int i, j;
     uint8_t data;
     struct uart_soft_driver_t *self_p;
+    const struct pin_device_t *tx_dev_p;
     const uint8_t *tx_p = txbuf_p;
 
     self_p = container_of(arg_p, struct uart_soft_driver_t, chout);
+    tx_dev_p = self_p->tx_pin.dev_p;
 
     for (i = 0; i < size; i++) {
         sys_lock();
-        pin_write(&self_p->tx_pin, 0);
+        pin_device_write_low(tx_dev_p);
 
         /* Put 8 bits on the transmission wire. */
         data = tx_p[i];
 
         for (j = 0; j < 8; j++) {
             time_busy_wait_us(self_p->sample_time);
-            pin_write(&self_p->tx_pin, data & 1);
+            pin_device_write(tx_dev_p, data & 1);
             data >>= 1;
         }
 
         time_busy_wait_us(self_p->sample_time);
-        pin_write(&self_p->tx_pin, 1);
+        pin_device_write_high(tx_dev_p);
         time_busy_wait_us(self_p->sample_time);
         sys_unlock();
     }
@@ -37,49 +37,86 @@
 #define XOFF                                  0x13
 
 /**
- * Read a single byte from the transport channel.
+ * Read available bytes from the transport channel into the receive
+ * buffer. Blocks until at least one byte is available.
  *
  * @return zero(0) or negative error code.
  */
+static int fill_rx_buffer(struct xbee_driver_t *self_p)
+{
+    ssize_t res;
+    size_t size;
+
+    size = chan_size(self_p->transport.chin_p);
+
+    if (size == 0) {
+        size = 1;
+    } else if (size > sizeof(self_p->rx.buf)) {
+        size = sizeof(self_p->rx.buf);
+    }
+
+    res = chan_read(self_p->transport.chin_p, &self_p->rx.buf[0], size);
+
+    if (res <= 0) {
+        return (res == 0 ? -EIO : res);
+    }
+
+    self_p->rx.pos = 0;
+    self_p->rx.size = res;
+
+    return (0);
+}
+
+/**
+ * Read a single byte from the receive buffer, refilling it from the
+ * transport channel when empty.
+ *
+ * @return Number of read bytes or negative error code.
+ */
 static int read_byte(struct xbee_driver_t *self_p,
                      uint8_t *byte_p)
 {
     int res;
 
-    res = chan_read(self_p->transport.chin_p,
-                    byte_p,
-                    sizeof(*byte_p));
+    if (self_p->rx.pos == self_p->rx.size) {
+        res = fill_rx_buffer(self_p);
 
-    if (res == 0) {
-        res = -EIO;
+        if (res != 0) {
+            return (res);
+        }
     }
 
-    return (res);
+    *byte_p = self_p->rx.buf[self_p->rx.pos++];
+
+    return (sizeof(*byte_p));
 }
 
 /**
- * Read data from the transport channel until a frame delimiter is
- * found.
+ * Discard data until a frame delimiter is found.
  */
 static int read_frame_delimiter(struct xbee_driver_t *self_p)
 {
     int res;
-    uint8_t byte;
-    
+    uint8_t *delimiter_p;
+
     while (1) {
-        res = read_byte(self_p, &byte);
+        delimiter_p = memchr(&self_p->rx.buf[self_p->rx.pos],
+                             FRAME_DELIMITER,
+                             self_p->rx.size - self_p->rx.pos);
 
-        if (res != sizeof(byte)) {
+        if (delimiter_p != NULL) {
+            self_p->rx.pos = (delimiter_p - &self_p->rx.buf[0] + 1);
             break;
         }
 
-        if (byte == FRAME_DELIMITER) {
-            res = 0;
-            break;
+        res = fill_rx_buffer(self_p);
+
+        if (res != 0) {
+            return (res);
         }
     }
 
-    return (res);
+    return (0);
 }
 
 /**
@@ -189,6 +226,8 @@ int xbee_init(struct xbee_driver_t *self_p,
 
     self_p->transport.chin_p = chin_p;
     self_p->transport.chout_p = chout_p;
+    self_p->rx.pos = 0;
+    self_p->rx.size = 0;
 
     return (0);
 }
@@ -220,8 +259,6 @@ int xbee_read(struct xbee_driver_t *self_p,
 
     frame_p->data.size = ((size[0] << 8) | size[1]);
 
-    std_printf(OSTR("frame_p->data.size: %d\r\n"), frame_p->data.size);
-    
     if (frame_p->data.size < 1) {
         return (-EPROTO);
     }
@@ -229,8 +266,6 @@ int xbee_read(struct xbee_driver_t *self_p,
     /* Read the frame id. */
     res = read_bytes(self_p, &frame_p->type, sizeof(frame_p->type));
 
-    std_printf(OSTR("frame_p->type: 0x%x\r\n"), frame_p->type);
-
     if (res != sizeof(frame_p->type)) {
         return (res);
     }
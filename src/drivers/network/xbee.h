@@ -105,6 +105,11 @@ struct xbee_driver_t {
         struct chan_t *chin_p;
         struct chan_t *chout_p;
     } transport;
+    struct {
+        uint8_t buf[CONFIG_XBEE_RX_BUFFER_SIZE];
+        size_t pos;
+        size_t size;
+    } rx;
 };
 
 /**
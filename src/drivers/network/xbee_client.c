@@ -37,17 +37,163 @@
 #    define DLOG(level, msg, ...)
 #endif
 
-static uint8_t next_frame_id(struct xbee_client_t *self_p)
+static void response_timeout(struct time_t *timeout_p)
 {
-    self_p->frame_id++;
+    timeout_p->seconds = (CONFIG_XBEE_CLIENT_RESPONSE_TIMEOUT_MS / 1000);
+    timeout_p->nanoseconds =
+        (1000000L * (CONFIG_XBEE_CLIENT_RESPONSE_TIMEOUT_MS % 1000));
+}
 
-    if (self_p->frame_id == XBEE_FRAME_ID_NO_ACK) {
-        self_p->frame_id++;
+/**
+ * Find the pending request with given frame id. The rpc mutex must
+ * be locked by the caller.
+ */
+static struct xbee_client_request_t *find_request(
+    struct xbee_client_t *self_p,
+    uint8_t frame_id)
+{
+    size_t i;
+
+    for (i = 0; i < membersof(self_p->rpc.requests); i++) {
+        if (self_p->rpc.requests[i].frame_id == frame_id) {
+            return (&self_p->rpc.requests[i]);
+        }
     }
 
+    return (NULL);
+}
+
+/**
+ * Return the next frame id not used by any pending request. The rpc
+ * mutex must be locked by the caller.
+ */
+static uint8_t next_frame_id(struct xbee_client_t *self_p)
+{
+    do {
+        self_p->frame_id++;
+
+        if (self_p->frame_id == XBEE_FRAME_ID_NO_ACK) {
+            self_p->frame_id++;
+        }
+    } while (find_request(self_p, self_p->frame_id) != NULL);
+
     return (self_p->frame_id);
 }
 
+/**
+ * Allocate a request and assign it a frame id, waiting for a request
+ * to be freed if all are pending. The rpc mutex must be locked by the
+ * caller.
+ *
+ * @return Allocated request or NULL on timeout.
+ */
+static struct xbee_client_request_t *alloc_request(
+    struct xbee_client_t *self_p)
+{
+    struct xbee_client_request_t *request_p;
+    struct time_t timeout;
+
+    while (1) {
+        request_p = find_request(self_p, XBEE_FRAME_ID_NO_ACK);
+
+        if (request_p != NULL) {
+            break;
+        }
+
+        response_timeout(&timeout);
+
+        if (cond_wait(&self_p->rpc.cond,
+                      &self_p->rpc.mutex,
+                      &timeout) != 0) {
+            return (NULL);
+        }
+    }
+
+    request_p->frame_id = next_frame_id(self_p);
+    request_p->buf_p = NULL;
+    request_p->size_p = NULL;
+    request_p->callback = NULL;
+
+    return (request_p);
+}
+
+/**
+ * Free given request. The rpc mutex must be locked by the caller.
+ */
+static void free_request(struct xbee_client_t *self_p,
+                         struct xbee_client_request_t *request_p)
+{
+    request_p->frame_id = XBEE_FRAME_ID_NO_ACK;
+    cond_signal(&self_p->rpc.cond);
+}
+
+/**
+ * Complete given request with given result. Waiting requests are
+ * resumed, and callbacks of asynchronous requests are called with the
+ * rpc mutex unlocked. The rpc mutex must be locked by the caller, and
+ * is unlocked by this function.
+ */
+static void complete_request(struct xbee_client_t *self_p,
+                             struct xbee_client_request_t *request_p,
+                             int res)
+{
+    xbee_client_write_cb_t callback;
+    void *arg_p;
+
+    callback = request_p->callback;
+    arg_p = request_p->arg_p;
+
+    if (callback != NULL) {
+        free_request(self_p, request_p);
+    } else {
+        request_p->res = res;
+        cond_signal(&request_p->cond);
+    }
+
+    mutex_unlock(&self_p->rpc.mutex);
+
+    if (callback != NULL) {
+        callback(arg_p, res);
+    }
+}
+
+/**
+ * Complete asynchronous requests that have not received a response
+ * within the response timeout.
+ */
+static void expire_requests(struct xbee_client_t *self_p)
+{
+    struct xbee_client_request_t *request_p;
+    struct time_t now;
+    size_t i;
+
+    time_get(&now);
+
+    mutex_lock(&self_p->rpc.mutex);
+
+    for (i = 0; i < membersof(self_p->rpc.requests); i++) {
+        request_p = &self_p->rpc.requests[i];
+
+        if ((request_p->frame_id == XBEE_FRAME_ID_NO_ACK)
+            || (request_p->callback == NULL)) {
+            continue;
+        }
+
+        if (time_compare(&now, &request_p->deadline)
+            == time_compare_less_than_t) {
+            continue;
+        }
+
+        DLOG(DEBUG,
+             "No response for frame id 0x%02x.\r\n",
+             request_p->frame_id);
+        complete_request(self_p, request_p, -ETIMEDOUT);
+        mutex_lock(&self_p->rpc.mutex);
+    }
+
+    mutex_unlock(&self_p->rpc.mutex);
+}
+
 /**
  * @return zero(0) or negative error code.
  */
@@ -57,43 +203,42 @@ static int communicate(struct xbee_client_t *self_p,
                        size_t *response_size_p)
 {
     ssize_t res;
-    uint8_t frame_id;
+    struct xbee_client_request_t *request_p;
     struct time_t timeout;
 
     mutex_lock(&self_p->rpc.mutex);
 
     if (response_size_p != NULL) {
-        mutex_lock(&self_p->rpc.rx.mutex);
+        request_p = alloc_request(self_p);
 
-        /* Set the frame id. */
-        frame_id = next_frame_id(self_p);
-        frame_p->data.buf[0] = frame_id;
+        if (request_p == NULL) {
+            mutex_unlock(&self_p->rpc.mutex);
+
+            return (-ETIMEDOUT);
+        }
 
         /* Response expected. */
-        self_p->rpc.rx.frame_p = frame_p;
-        self_p->rpc.rx.buf_p = response_buf_p;
-        self_p->rpc.rx.size_p = response_size_p;
+        frame_p->data.buf[0] = request_p->frame_id;
+        request_p->buf_p = response_buf_p;
+        request_p->size_p = response_size_p;
 
         /* Write the frame. */
         res = xbee_write(&self_p->driver, frame_p);
 
-        /* Resumed when (or if) the response is received. */
+        /* Resumed when (or if) the response is received. Other
+           requests may be written and completed meanwhile. */
         if (res == 0) {
-            timeout.seconds = (CONFIG_XBEE_CLIENT_RESPONSE_TIMEOUT_MS / 1000);
-            timeout.nanoseconds =
-                (1000000L * (CONFIG_XBEE_CLIENT_RESPONSE_TIMEOUT_MS % 1000));
-            res = cond_wait(&self_p->rpc.rx.cond,
-                            &self_p->rpc.rx.mutex,
+            response_timeout(&timeout);
+            res = cond_wait(&request_p->cond,
+                            &self_p->rpc.mutex,
                             &timeout);
 
             if (res == 0) {
-                res = self_p->rpc.rx.res;
+                res = request_p->res;
             }
-
-            self_p->rpc.rx.frame_p = NULL;
         }
 
-        mutex_unlock(&self_p->rpc.rx.mutex);
+        free_request(self_p, request_p);
     } else {
         /* Set the frame id. */
         frame_p->data.buf[0] = XBEE_FRAME_ID_NO_ACK;
@@ -107,6 +252,49 @@ static int communicate(struct xbee_client_t *self_p,
     return (res);
 }
 
+/**
+ * Write given frame and return without waiting for the
+ * response. Given callback is called when the response is received.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int communicate_async(struct xbee_client_t *self_p,
+                             struct xbee_frame_t *frame_p,
+                             xbee_client_write_cb_t callback,
+                             void *arg_p)
+{
+    int res;
+    struct xbee_client_request_t *request_p;
+    struct time_t timeout;
+
+    mutex_lock(&self_p->rpc.mutex);
+
+    request_p = alloc_request(self_p);
+
+    if (request_p == NULL) {
+        mutex_unlock(&self_p->rpc.mutex);
+
+        return (-ETIMEDOUT);
+    }
+
+    frame_p->data.buf[0] = request_p->frame_id;
+    request_p->callback = callback;
+    request_p->arg_p = arg_p;
+    response_timeout(&timeout);
+    time_get(&request_p->deadline);
+    time_add(&request_p->deadline, &request_p->deadline, &timeout);
+
+    res = xbee_write(&self_p->driver, frame_p);
+
+    if (res != 0) {
+        free_request(self_p, request_p);
+    }
+
+    mutex_unlock(&self_p->rpc.mutex);
+
+    return (res);
+}
+
 static int execute_at_command(struct xbee_client_t *self_p,
                               const char *command_p,
                               const uint8_t *parameter_p,
@@ -134,6 +322,43 @@ static int execute_at_command(struct xbee_client_t *self_p,
                         response_size_p));
 }
 
+/**
+ * Initiate a TX request frame (frame id assigned later).
+ *
+ * @return zero(0) or negative error code.
+ */
+static int init_tx_request(struct xbee_frame_t *frame_p,
+                           const void *buf_p,
+                           size_t size,
+                           struct xbee_client_address_t *address_p)
+{
+    size_t pos;
+
+    switch (address_p->type) {
+
+    case xbee_client_address_type_16_bits_t:
+        frame_p->type = XBEE_FRAME_TYPE_TX_REQUEST_16_BIT_ADDRESS;
+        memcpy(&frame_p->data.buf[1], &address_p->buf[0], 2);
+        pos = 4;
+        break;
+
+    case xbee_client_address_type_64_bits_t:
+        frame_p->type = XBEE_FRAME_TYPE_TX_REQUEST_64_BIT_ADDRESS;
+        memcpy(&frame_p->data.buf[1], &address_p->buf[0], 8);
+        pos = 10;
+        break;
+
+    default:
+        return (-EINVAL);
+    }
+
+    frame_p->data.size = (pos + size);
+    frame_p->data.buf[pos - 1] = 0;
+    memcpy(&frame_p->data.buf[pos], buf_p, size);
+
+    return (0);
+}
+
 static int handle_rx_packet_16_bit_address(struct xbee_client_t *self_p,
                                            struct xbee_frame_t *frame_p)
 {
@@ -191,8 +416,8 @@ static int handle_tx_status(struct xbee_client_t *self_p,
 {
     ssize_t size;
     int frame_id;
-    int expected_frame_id;
     int status;
+    struct xbee_client_request_t *request_p;
 
     size = frame_p->data.size;
 
@@ -204,36 +429,29 @@ static int handle_tx_status(struct xbee_client_t *self_p,
     frame_id = frame_p->data.buf[0];
     status = frame_p->data.buf[1];
 
-    mutex_lock(&self_p->rpc.rx.mutex);
+    mutex_lock(&self_p->rpc.mutex);
 
-    if (self_p->rpc.rx.frame_p != NULL) {
-        expected_frame_id = self_p->rpc.rx.frame_p->data.buf[0];
+    request_p = find_request(self_p, frame_id);
 
-        if (expected_frame_id == frame_id) {
-            if (status != 0) {
-                DLOG(WARNING,
-                     "Negative response %d in TX Status for "
-                     "frame id 0x%02x.\r\n",
-                     status,
-                     frame_id);
-                status = -EPROTO;
-            }
+    if ((frame_id == XBEE_FRAME_ID_NO_ACK) || (request_p == NULL)) {
+        DLOG(DEBUG,
+             "Unexpected TX Status for frame id 0x%02x received.\r\n",
+             frame_id);
+        mutex_unlock(&self_p->rpc.mutex);
 
-            self_p->rpc.rx.frame_p = NULL;
-            self_p->rpc.rx.res = status;
-            cond_signal(&self_p->rpc.rx.cond);
-        } else {
-            DLOG(DEBUG,
-                 "Expected frame id 0x%02x in TX Status but "
-                 "got 0x%02x.\r\n",
-                 expected_frame_id,
-                 frame_id);
-        }
-    } else {
-        DLOG(DEBUG, "Unexpected TX Status received.\r\n");
+        return (0);
+    }
+
+    if (status != 0) {
+        DLOG(WARNING,
+             "Negative response %d in TX Status for "
+             "frame id 0x%02x.\r\n",
+             status,
+             frame_id);
+        status = -EPROTO;
     }
 
-    mutex_unlock(&self_p->rpc.rx.mutex);
+    complete_request(self_p, request_p, status);
 
     return (0);
 }
@@ -243,8 +461,8 @@ static int handle_at_command_response(struct xbee_client_t *self_p,
 {
     ssize_t size;
     int frame_id;
-    int expected_frame_id;
     int status;
+    struct xbee_client_request_t *request_p;
 
     size = frame_p->data.size;
 
@@ -259,40 +477,36 @@ static int handle_at_command_response(struct xbee_client_t *self_p,
     frame_id = frame_p->data.buf[0];
     status = frame_p->data.buf[3];
 
-    mutex_lock(&self_p->rpc.rx.mutex);
-
-    if (self_p->rpc.rx.frame_p != NULL) {
-        expected_frame_id = self_p->rpc.rx.frame_p->data.buf[0];
-
-        if (expected_frame_id == frame_id) {
-            if (status == 0) {
-                size = MIN(size - 4, *self_p->rpc.rx.size_p);
-                memcpy(self_p->rpc.rx.buf_p, &frame_p->data.buf[4], size);
-            } else {
-                DLOG(WARNING,
-                     "Negative response %d in AT Command Response for "
-                     "frame id 0x%02x.\r\n",
-                     status,
-                     frame_id);
-                status = -EPROTO;
-            }
+    mutex_lock(&self_p->rpc.mutex);
 
-            self_p->rpc.rx.frame_p = NULL;
-            *self_p->rpc.rx.size_p = size;
-            self_p->rpc.rx.res = status;
-            cond_signal(&self_p->rpc.rx.cond);
-        } else {
-            DLOG(DEBUG,
-                 "Expected frame id 0x%02x in AT Command Response but "
-                 "got 0x%02x.\r\n",
-                 expected_frame_id,
-                 frame_id);
-        }
+    request_p = find_request(self_p, frame_id);
+
+    if ((frame_id == XBEE_FRAME_ID_NO_ACK)
+        || (request_p == NULL)
+        || (request_p->size_p == NULL)) {
+        DLOG(DEBUG,
+             "Unexpected AT Command Response for frame id 0x%02x "
+             "received.\r\n",
+             frame_id);
+        mutex_unlock(&self_p->rpc.mutex);
+
+        return (0);
+    }
+
+    if (status == 0) {
+        size = MIN(size - 4, *request_p->size_p);
+        memcpy(request_p->buf_p, &frame_p->data.buf[4], size);
     } else {
-        DLOG(DEBUG, "Unexpected AT Command Response received.\r\n");
+        DLOG(WARNING,
+             "Negative response %d in AT Command Response for "
+             "frame id 0x%02x.\r\n",
+             status,
+             frame_id);
+        status = -EPROTO;
     }
 
-    mutex_unlock(&self_p->rpc.rx.mutex);
+    *request_p->size_p = size;
+    complete_request(self_p, request_p, status);
 
     return (0);
 }
@@ -313,6 +527,8 @@ int xbee_client_init(struct xbee_client_t *self_p,
                      size_t size,
                      int flags)
 {
+    size_t i;
+
     xbee_init(&self_p->driver, chin_p, chout_p);
     queue_init(&self_p->chin, buf_p, size);
 
@@ -321,11 +537,14 @@ int xbee_client_init(struct xbee_client_t *self_p,
     }
 
     self_p->frame_id = XBEE_FRAME_ID_NO_ACK;
-    self_p->rpc.rx.frame_p = NULL;
+
+    for (i = 0; i < membersof(self_p->rpc.requests); i++) {
+        self_p->rpc.requests[i].frame_id = XBEE_FRAME_ID_NO_ACK;
+        cond_init(&self_p->rpc.requests[i].cond);
+    }
 
     mutex_init(&self_p->rpc.mutex);
-    mutex_init(&self_p->rpc.rx.mutex);
-    cond_init(&self_p->rpc.rx.cond);
+    cond_init(&self_p->rpc.cond);
 
 #if CONFIG_XBEE_CLIENT_DEBUG_LOG_MASK > -1
     log_object_init(&self_p->log,
@@ -341,12 +560,21 @@ void *xbee_client_main(void *arg_p)
     int res;
     struct xbee_client_t *self_p;
     struct xbee_frame_t frame;
+    struct time_t timeout;
 
     self_p = arg_p;
+    response_timeout(&timeout);
 
     while (1) {
-        if (chan_poll(self_p->driver.transport.chin_p, NULL) == NULL) {
-            continue;
+        expire_requests(self_p);
+
+        /* Frames already in the driver receive buffer are parsed
+           without polling the transport channel. */
+        if (self_p->driver.rx.pos == self_p->driver.rx.size) {
+            if (chan_poll(self_p->driver.transport.chin_p,
+                          &timeout) == NULL) {
+                continue;
+            }
         }
 
         res = xbee_read(&self_p->driver, &frame);
@@ -404,32 +632,15 @@ ssize_t xbee_client_write_to(struct xbee_client_t *self_p,
                              struct xbee_client_address_t *address_p)
 {
     struct xbee_frame_t frame;
-    size_t pos;
     size_t response_size;
     int res;
 
-    switch (address_p->type) {
-
-    case xbee_client_address_type_16_bits_t:
-        frame.type = XBEE_FRAME_TYPE_TX_REQUEST_16_BIT_ADDRESS;
-        memcpy(&frame.data.buf[1], &address_p->buf[0], 2);
-        pos = 4;
-        break;
+    res = init_tx_request(&frame, buf_p, size, address_p);
 
-    case xbee_client_address_type_64_bits_t:
-        frame.type = XBEE_FRAME_TYPE_TX_REQUEST_64_BIT_ADDRESS;
-        memcpy(&frame.data.buf[1], &address_p->buf[0], 8);
-        pos = 10;
-        break;
-
-    default:
-        return (-EINVAL);
+    if (res != 0) {
+        return (res);
     }
 
-    frame.data.size = (pos + size);
-    frame.data.buf[pos - 1] = 0;
-    memcpy(&frame.data.buf[pos], buf_p, size);
-
     if (flags & XBEE_CLIENT_NO_ACK) {
         res = communicate(self_p, &frame, NULL, NULL);
     } else {
@@ -444,6 +655,33 @@ ssize_t xbee_client_write_to(struct xbee_client_t *self_p,
     return (size);
 }
 
+ssize_t xbee_client_write_to_async(struct xbee_client_t *self_p,
+                                   const void *buf_p,
+                                   size_t size,
+                                   struct xbee_client_address_t *address_p,
+                                   xbee_client_write_cb_t callback,
+                                   void *arg_p)
+{
+    ASSERTN(callback != NULL, EINVAL);
+
+    struct xbee_frame_t frame;
+    int res;
+
+    res = init_tx_request(&frame, buf_p, size, address_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    res = communicate_async(self_p, &frame, callback, arg_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    return (size);
+}
+
 int xbee_client_pin_set_mode(struct xbee_client_t *self_p,
                              int pin,
                              int mode)
@@ -56,6 +56,28 @@ struct xbee_client_address_t {
     uint8_t buf[8];
 };
 
+/**
+ * Transmit status callback of an asynchronous write.
+ *
+ * @param[in] arg_p Argument given to ``xbee_client_write_to_async()``.
+ * @param[in] res zero(0) if the XBee acknowledged the packet,
+ *                otherwise negative error code.
+ */
+typedef void (*xbee_client_write_cb_t)(void *arg_p, int res);
+
+/* A request waiting for its response, keyed by frame id. */
+struct xbee_client_request_t {
+    /* XBEE_FRAME_ID_NO_ACK if unused. */
+    uint8_t frame_id;
+    struct cond_t cond;
+    uint8_t *buf_p;
+    size_t *size_p;
+    int res;
+    xbee_client_write_cb_t callback;
+    void *arg_p;
+    struct time_t deadline;
+};
+
 /* The XBee client. */
 struct xbee_client_t {
     struct queue_t chin;
@@ -65,15 +87,11 @@ struct xbee_client_t {
         uint8_t value;
     } pins;
     struct {
-        struct {
-            struct mutex_t mutex;
-            struct cond_t cond;
-            struct xbee_frame_t *frame_p;
-            void *buf_p;
-            size_t *size_p;
-            int res;
-        } rx;
         struct mutex_t mutex;
+        /* Signalled when a request is freed. */
+        struct cond_t cond;
+        struct xbee_client_request_t
+        requests[CONFIG_XBEE_CLIENT_PENDING_REQUESTS_MAX];
     } rpc;
 #if CONFIG_XBEE_CLIENT_DEBUG_LOG_MASK > -1
     struct log_object_t log;
@@ -157,6 +175,33 @@ ssize_t xbee_client_write_to(struct xbee_client_t *self_p,
                              int flags,
                              struct xbee_client_address_t *address_p);
 
+/**
+ * Create a TX packet of given data and write it to given 16 or 64
+ * bits XBee address, without waiting for the transmit status. Given
+ * callback is called from the client thread when the transmit status
+ * is received, or with ``-ETIMEDOUT`` if it is not received within
+ * the response timeout.
+ *
+ * Up to ``CONFIG_XBEE_CLIENT_PENDING_REQUESTS_MAX`` requests may be
+ * pending at the same time. This function waits for one of them to
+ * complete if all are in use.
+ *
+ * @param[in] self_p Initialized client object.
+ * @param[in] buf_p Buffer to write.
+ * @param[in] size Number of bytes to write.
+ * @param[out] address_p Receiver address.
+ * @param[in] callback Transmit status callback.
+ * @param[in] arg_p Transmit status callback argument.
+ *
+ * @return Number of bytes written or negative error code.
+ */
+ssize_t xbee_client_write_to_async(struct xbee_client_t *self_p,
+                                   const void *buf_p,
+                                   size_t size,
+                                   struct xbee_client_address_t *address_p,
+                                   xbee_client_write_cb_t callback,
+                                   void *arg_p);
+
 /**
  * Configure given pin to given mode.
  *
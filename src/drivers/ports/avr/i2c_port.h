@@ -47,6 +47,12 @@ struct i2c_driver_t {
     volatile ssize_t size;
     uint8_t *buf_p;
     struct thrd_t *thrd_p;
+    struct {
+        int address;
+        struct i2c_message_t *messages_p;
+        size_t number_of_messages;
+        size_t transferred;
+    } transfer;
 };
 
 #endif
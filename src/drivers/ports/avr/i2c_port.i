@@ -97,6 +97,7 @@ static ssize_t transfer(struct i2c_driver_t *self_p,
     self_p->buf_p = (void *)buf_p;
     self_p->size = size;
     self_p->thrd_p = thrd_self();
+    self_p->transfer.number_of_messages = 0;
 
     /* Start the transfer by sending the START condition, and then
        wait for the transfer to complete. */
@@ -108,6 +109,43 @@ static ssize_t transfer(struct i2c_driver_t *self_p,
     return (size - self_p->size);
 }
 
+/**
+ * Prepare the driver for the next message in a transfer.
+ */
+static void load_message(struct i2c_driver_t *self_p)
+{
+    struct i2c_message_t *message_p;
+
+    message_p = self_p->transfer.messages_p;
+    self_p->address = ((self_p->transfer.address << 1)
+                       | (message_p->flags & I2C_MESSAGE_READ));
+    self_p->buf_p = message_p->buf_p;
+    self_p->size = message_p->size;
+}
+
+/**
+ * Called when the current message has been transferred. Send a
+ * repeated start condition if there are more messages in the
+ * transfer.
+ *
+ * @return true(1) if the next message was started, otherwise
+ *         false(0).
+ */
+static int next_message_isr(struct i2c_driver_t *self_p)
+{
+    if (self_p->transfer.number_of_messages <= 1) {
+        return (0);
+    }
+
+    self_p->transfer.transferred += self_p->transfer.messages_p->size;
+    self_p->transfer.messages_p++;
+    self_p->transfer.number_of_messages--;
+    load_message(self_p);
+    TWCR = (_BV(TWINT) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE));
+
+    return (1);
+}
+
 ISR(TWI_vect)
 {
     struct i2c_device_t *dev_p = &i2c_device[0];
@@ -136,7 +174,7 @@ ISR(TWI_vect)
             TWDR = *drv_p->buf_p++;
             drv_p->size--;
             TWCR = (_BV(TWINT) | _BV(TWEN) | _BV(TWIE));
-        } else {
+        } else if (next_message_isr(drv_p) == 0) {
             TWCR = (_BV(TWINT) | _BV(TWSTO) | _BV(TWEN));
             thrd_resume_isr(drv_p->thrd_p, 0);
         }
@@ -170,6 +208,11 @@ ISR(TWI_vect)
     case I2C_M_RX_DATA_NACK:
         *drv_p->buf_p++ = TWDR;
         drv_p->size--;
+
+        if (next_message_isr(drv_p) == 1) {
+            break;
+        }
+
     case I2C_M_TX_SLA_W_NACK:
     case I2C_M_TX_DATA_NACK:
     case I2C_M_RX_SLA_R_NACK:
@@ -292,6 +335,30 @@ ssize_t i2c_port_write(struct i2c_driver_t *self_p,
     return (transfer(self_p, address, (void *)buf_p, size, I2C_WRITE));
 }
 
+ssize_t i2c_port_transfer(struct i2c_driver_t *self_p,
+                          int address,
+                          struct i2c_message_t *messages_p,
+                          size_t number_of_messages)
+{
+    self_p->transfer.address = address;
+    self_p->transfer.messages_p = messages_p;
+    self_p->transfer.number_of_messages = number_of_messages;
+    self_p->transfer.transferred = 0;
+    load_message(self_p);
+    self_p->thrd_p = thrd_self();
+
+    /* All messages are transferred by the interrupt service routine,
+       separated by repeated start conditions. */
+    sys_lock();
+    TWCR = (_BV(TWINT) | _BV(TWSTA) | _BV(TWEN) | _BV(TWIE));
+    thrd_suspend_isr(NULL);
+    sys_unlock();
+
+    return (self_p->transfer.transferred
+            + self_p->transfer.messages_p->size
+            - self_p->size);
+}
+
 int i2c_port_scan(struct i2c_driver_t *self_p,
                   int address)
 {
@@ -300,6 +367,7 @@ int i2c_port_scan(struct i2c_driver_t *self_p,
     self_p->address = ((address << 1) | I2C_WRITE);
     self_p->size = 0;
     self_p->thrd_p = thrd_self();
+    self_p->transfer.number_of_messages = 0;
 
     /* Start the transfer by sending the START condition, and then
        wait for the transfer to complete. */
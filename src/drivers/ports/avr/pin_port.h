@@ -97,4 +97,30 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (dev_p->mask);
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    return (dev_p->sfr_p == other_p->sfr_p);
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    *PORT(dev_p->sfr_p) = ((*PORT(dev_p->sfr_p) | high_mask) & ~low_mask);
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (*PIN(dev_p->sfr_p) & mask);
+}
+
 #endif
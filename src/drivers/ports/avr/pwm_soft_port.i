@@ -87,7 +87,7 @@ static void reset_timer_isr(uint16_t count)
 ISR(TIMER3_COMPA_vect)
 {
     PWM_SOFT_ISR_PROLOGUE;
-    reset_timer_isr(elem_p->delta);
+    reset_timer_isr(delta);
     PWM_SOFT_ISR_EPILOGUE;
 }
 
@@ -99,11 +99,9 @@ static int pwm_soft_port_module_init(long frequency)
         return (-1);
     }
 
-    module.tail_pwm_soft.delta = DUTY_CYCLE_MAX;
-
     /* Enable the timer interrput. */
     TCCR3A = 0;
-    reset_timer_isr(module.tail_pwm_soft.delta);
+    reset_timer_isr(DUTY_CYCLE_MAX);
     TIMSK3 = _BV(OCIE3A);
 
     return (0);
@@ -117,9 +115,5 @@ static int pwm_soft_port_set_frequency(long value)
         return (-1);
     }
 
-    sys_lock();
-    module.tail_pwm_soft.delta = DUTY_CYCLE_MAX;
-    sys_unlock();
-    
     return (0);
 }
@@ -102,4 +102,42 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (dev_p->mask);
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    /* GPIO16 is in the RTC block and forms a port of its own. */
+    return ((dev_p == other_p) || ((dev_p->id < 16) && (other_p->id < 16)));
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    if (dev_p->id < 16) {
+        ESP8266_GPIO->OUT_W1TS = high_mask;
+        ESP8266_GPIO->OUT_W1TC = low_mask;
+    } else if (high_mask != 0) {
+        ESP8266_RTC->GPIO.OUT |= 1;
+    } else if (low_mask != 0) {
+        ESP8266_RTC->GPIO.OUT &= ~1;
+    }
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    if (dev_p->id < 16) {
+        return (ESP8266_GPIO->IN & mask);
+    } else {
+        return ((ESP8266_RTC->GPIO.IN & 0x01) != 0 ? mask : 0);
+    }
+}
+
 #endif
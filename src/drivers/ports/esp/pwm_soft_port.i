@@ -50,7 +50,7 @@ static void isr(void *arg_p)
 
     /* Clear the interrupt flag and start a new timer. */
     ESP8266_TIMER0->INT = ESP8266_TIMER_INT_CLR;
-    ESP8266_TIMER0->LOAD = elem_p->delta;
+    ESP8266_TIMER0->LOAD = delta;
 
     PWM_SOFT_ISR_EPILOGUE;
 }
@@ -61,8 +61,6 @@ static int pwm_soft_port_module_init(long frequency)
         return (-1);
     }
 
-    module.tail_pwm_soft.delta = DUTY_CYCLE_MAX;
-
     /* Configure and start the software PWM timer. */
     ESP8266_TIMER0->CTRL = (ESP8266_TIMER_CTRL_ENABLE
                             | ESP8266_TIMER_CTRL_PRESCALE_1
@@ -71,7 +69,7 @@ static int pwm_soft_port_module_init(long frequency)
     _xt_isr_attach(ESP8266_IRQ_NUM_TIMER1, isr, NULL);
     TM1_EDGE_INT_ENABLE();
     _xt_isr_unmask(1 << ESP8266_IRQ_NUM_TIMER1);
-    ESP8266_TIMER0->LOAD = module.tail_pwm_soft.delta;
+    ESP8266_TIMER0->LOAD = DUTY_CYCLE_MAX;
 
     return (0);
 }
@@ -82,9 +80,5 @@ static int pwm_soft_port_set_frequency(long value)
         return (-1);
     }
 
-    sys_lock();
-    module.tail_pwm_soft.delta = DUTY_CYCLE_MAX;
-    sys_unlock();
-
     return (0);
 }
@@ -91,6 +91,20 @@ static int adc_port_async_wait(struct adc_driver_t *self_p)
     return (0);
 }
 
+static int adc_port_stream_start(struct adc_driver_t *self_p,
+                                 struct adc_stream_t *stream_p)
+{
+    (void)stream_get_buffer_isr;
+    (void)stream_buffer_filled_isr;
+
+    return (-ENOSYS);
+}
+
+static int adc_port_stream_stop(struct adc_driver_t *self_p)
+{
+    return (-ENOSYS);
+}
+
 static int adc_port_convert_isr(struct adc_driver_t *self_p,
                                 uint16_t *sample_p)
 {
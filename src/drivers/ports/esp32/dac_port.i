@@ -93,3 +93,22 @@ static int dac_port_convert(struct dac_driver_t *self_p,
 
     return (0);
 }
+
+static int dac_port_stream_start_isr(struct dac_driver_t *self_p,
+                                     struct dac_stream_t *stream_p)
+{
+    (void)stream_load_isr;
+    (void)stream_buffer_done_isr;
+
+    return (-ENOSYS);
+}
+
+static int dac_port_stream_stop_isr(struct dac_driver_t *self_p)
+{
+    return (-ENOSYS);
+}
+
+static int dac_port_stream_write_isr(struct dac_driver_t *self_p)
+{
+    return (-ENOSYS);
+}
@@ -98,4 +98,31 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (1 << (dev_p->id % 32));
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    return ((dev_p->id / 32) == (other_p->id / 32));
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    ESP32_GPIO->OUT[dev_p->id / 32].W1TS = high_mask;
+    ESP32_GPIO->OUT[dev_p->id / 32].W1TC = low_mask;
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (ESP32_GPIO->IN_VALUE[dev_p->id / 32] & mask);
+}
+
 #endif
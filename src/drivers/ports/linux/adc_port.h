@@ -32,14 +32,53 @@
 #define __DRIVERS_ADC_PORT_H__
 
 
+#include <stdio.h>
+
 #define ADC_PORT_REFERENCE_VCC 0
 
 struct adc_device_t {
     struct adc_driver_t *drv_p;
+    struct {
+        FILE *file_p;
+        int is_wav;
+        long data_offset;
+        size_t data_size;
+        size_t data_left;
+        int channels;
+        int bits_per_sample;
+    } input;
 };
 
 struct adc_driver_t {
     struct adc_device_t *dev_p;
+    long sampling_rate;
+    struct {
+        struct adc_stream_t *stream_p;
+        struct timer_t timer;
+        struct time_t start;
+        uint64_t number_of_samples;
+    } stream;
 };
 
+/**
+ * Replay samples from given file in all convertions on given
+ * device. The file is either a WAV file with 8 or 16 bits PCM
+ * samples, or a CSV file with one sample per line in the first
+ * column. Only the first channel of a WAV file is used, and WAV
+ * samples are scaled to the range 0 to 65535. The file is replayed
+ * from the beginning when the end of the file is reached.
+ *
+ * Stream samples are replayed at the sampling rate given to
+ * `adc_init()`, which may be higher than real time to benchmark
+ * signal processing.
+ *
+ * @param[in] dev_p ADC device.
+ * @param[in] path_p File path, or NULL to convert all samples to
+ *                   zero(0).
+ *
+ * @return zero(0) or negative error code.
+ */
+int adc_port_device_set_input_file(struct adc_device_t *dev_p,
+                                   const char *path_p);
+
 #endif
@@ -28,6 +28,223 @@
  * This file is part of the Simba project.
  */
 
+static uint32_t read_le(const uint8_t *buf_p, int size)
+{
+    uint32_t value;
+
+    value = 0;
+
+    while (size > 0) {
+        size--;
+        value <<= 8;
+        value |= buf_p[size];
+    }
+
+    return (value);
+}
+
+/**
+ * Find the fmt and data chunks in a WAV file.
+ */
+static int wav_parse_header(struct adc_device_t *dev_p)
+{
+    uint8_t buf[16];
+    uint32_t size;
+    int has_fmt;
+
+    has_fmt = 0;
+
+    if (fread(&buf[0], 12, 1, dev_p->input.file_p) != 1) {
+        return (-EINVAL);
+    }
+
+    if ((memcmp(&buf[0], "RIFF", 4) != 0)
+        || (memcmp(&buf[8], "WAVE", 4) != 0)) {
+        return (-EINVAL);
+    }
+
+    while (fread(&buf[0], 8, 1, dev_p->input.file_p) == 1) {
+        size = read_le(&buf[4], 4);
+
+        if (memcmp(&buf[0], "fmt ", 4) == 0) {
+            if ((size < 16) || (fread(&buf[0], 16, 1, dev_p->input.file_p) != 1)) {
+                return (-EINVAL);
+            }
+
+            /* PCM only. */
+            if (read_le(&buf[0], 2) != 1) {
+                return (-EINVAL);
+            }
+
+            dev_p->input.channels = read_le(&buf[2], 2);
+            dev_p->input.bits_per_sample = read_le(&buf[14], 2);
+
+            if ((dev_p->input.channels == 0)
+                || ((dev_p->input.bits_per_sample != 8)
+                    && (dev_p->input.bits_per_sample != 16))) {
+                return (-EINVAL);
+            }
+
+            fseek(dev_p->input.file_p, size - 16 + (size & 1), SEEK_CUR);
+            has_fmt = 1;
+        } else if (memcmp(&buf[0], "data", 4) == 0) {
+            if (has_fmt == 0) {
+                return (-EINVAL);
+            }
+
+            dev_p->input.data_offset = ftell(dev_p->input.file_p);
+            dev_p->input.data_size = size;
+            dev_p->input.data_left = size;
+
+            return (0);
+        } else {
+            fseek(dev_p->input.file_p, size + (size & 1), SEEK_CUR);
+        }
+    }
+
+    return (-EINVAL);
+}
+
+static uint16_t wav_read_sample(struct adc_device_t *dev_p)
+{
+    uint8_t buf[4];
+    int frame_size;
+    int sample_size;
+
+    sample_size = (dev_p->input.bits_per_sample / 8);
+    frame_size = (dev_p->input.channels * sample_size);
+
+    if (dev_p->input.data_left < frame_size) {
+        /* Replay from the beginning. */
+        fseek(dev_p->input.file_p, dev_p->input.data_offset, SEEK_SET);
+        dev_p->input.data_left = dev_p->input.data_size;
+
+        if (dev_p->input.data_left < frame_size) {
+            return (0);
+        }
+    }
+
+    if (fread(&buf[0], sample_size, 1, dev_p->input.file_p) != 1) {
+        return (0);
+    }
+
+    /* Skip the other channels. */
+    if (dev_p->input.channels > 1) {
+        fseek(dev_p->input.file_p, frame_size - sample_size, SEEK_CUR);
+    }
+
+    dev_p->input.data_left -= frame_size;
+
+    if (sample_size == 1) {
+        return (buf[0] << 8);
+    } else {
+        return ((uint16_t)(read_le(&buf[0], 2) + 32768));
+    }
+}
+
+static uint16_t csv_read_sample(struct adc_device_t *dev_p)
+{
+    char line[64];
+    int rewinded;
+
+    rewinded = 0;
+
+    while (1) {
+        if (fgets(&line[0], sizeof(line), dev_p->input.file_p) == NULL) {
+            /* Replay from the beginning, but only once to handle
+               files without samples. */
+            if (rewinded == 1) {
+                return (0);
+            }
+
+            rewind(dev_p->input.file_p);
+            rewinded = 1;
+            continue;
+        }
+
+        /* Skip lines that does not start with a number, for example a
+           header. */
+        if (isdigit((int)line[0])) {
+            return (strtol(&line[0], NULL, 0));
+        }
+    }
+}
+
+static void read_samples(struct adc_device_t *dev_p,
+                         uint16_t *samples_p,
+                         size_t length)
+{
+    size_t i;
+
+    if (dev_p->input.file_p == NULL) {
+        memset(samples_p, 0, sizeof(*samples_p) * length);
+
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        if (dev_p->input.is_wav == 1) {
+            samples_p[i] = wav_read_sample(dev_p);
+        } else {
+            samples_p[i] = csv_read_sample(dev_p);
+        }
+    }
+}
+
+/**
+ * Length of the next buffer to fill. An unassigned buffer is
+ * expected to be the next one in round robin order, which it is
+ * when the reader keeps up.
+ */
+static size_t next_buffer_length(struct adc_stream_t *stream_p)
+{
+    if (stream_p->produced < stream_p->assigned) {
+        return (stream_find_buffer_isr(stream_p,
+                                       stream_p->produced)->length);
+    }
+
+    return (stream_p->buffers_p[stream_p->produced
+                                % stream_p->number_of_buffers].length);
+}
+
+/**
+ * Fill all stream buffers that are due according to the sampling
+ * rate.
+ */
+static void stream_timer_cb(void *arg_p)
+{
+    struct adc_driver_t *self_p;
+    struct adc_stream_t *stream_p;
+    struct adc_stream_buffer_t *buffer_p;
+    struct time_t now;
+    uint64_t elapsed;
+    uint64_t number_of_samples;
+
+    self_p = arg_p;
+    stream_p = self_p->stream.stream_p;
+
+    sys_uptime_isr(&now);
+    time_subtract(&now, &now, &self_p->stream.start);
+    elapsed = ((uint64_t)now.seconds * 1000000 + now.nanoseconds / 1000);
+    number_of_samples = (elapsed * self_p->sampling_rate / 1000000);
+
+    /* Only take the next buffer when it is due, as taking it may
+       drop the oldest unread buffer. */
+    while (self_p->stream.number_of_samples + next_buffer_length(stream_p)
+           <= number_of_samples) {
+        buffer_p = stream_get_buffer_isr(stream_p, stream_p->produced);
+
+        if (self_p->stream.number_of_samples + buffer_p->length
+            > number_of_samples) {
+            break;
+        }
+
+        read_samples(self_p->dev_p, buffer_p->samples_p, buffer_p->length);
+        self_p->stream.number_of_samples += buffer_p->length;
+        stream_buffer_filled_isr(stream_p);
+    }
+}
+
 static int adc_port_module_init(void)
 {
     return (0);
@@ -37,8 +254,12 @@ static int adc_port_init(struct adc_driver_t *self_p,
                          struct adc_device_t *dev_p,
                          struct pin_device_t *pin_dev_p,
                          int reference,
-                         int sampling_rate)
+                         long sampling_rate)
 {
+    self_p->dev_p = dev_p;
+    self_p->sampling_rate = sampling_rate;
+    self_p->stream.stream_p = NULL;
+
     return (0);
 }
 
@@ -46,6 +267,10 @@ static int adc_port_async_convert(struct adc_driver_t *self_p,
                                   uint16_t *samples_p,
                                   size_t length)
 {
+    sys_lock();
+    read_samples(self_p->dev_p, samples_p, length);
+    sys_unlock();
+
     return (0);
 }
 
@@ -54,8 +279,83 @@ static int adc_port_async_wait(struct adc_driver_t *self_p)
     return (0);
 }
 
+static int adc_port_stream_start(struct adc_driver_t *self_p,
+                                 struct adc_stream_t *stream_p)
+{
+    struct time_t timeout;
+    uint64_t period;
+
+    if (self_p->stream.stream_p != NULL) {
+        return (-EBUSY);
+    }
+
+    /* Check for due buffers once per buffer period. */
+    period = (1000000ull * stream_p->buffers_p[0].length
+              / self_p->sampling_rate);
+    timeout.seconds = (period / 1000000);
+    timeout.nanoseconds = (1000 * (period % 1000000));
+
+    self_p->stream.stream_p = stream_p;
+    self_p->stream.number_of_samples = 0;
+    sys_uptime(&self_p->stream.start);
+    timer_init(&self_p->stream.timer,
+               &timeout,
+               stream_timer_cb,
+               self_p,
+               TIMER_PERIODIC);
+
+    return (timer_start(&self_p->stream.timer));
+}
+
+static int adc_port_stream_stop(struct adc_driver_t *self_p)
+{
+    if (self_p->stream.stream_p == NULL) {
+        return (-EINVAL);
+    }
+
+    timer_stop(&self_p->stream.timer);
+    self_p->stream.stream_p = NULL;
+
+    return (0);
+}
+
 int adc_port_convert_isr(struct adc_driver_t *self_p,
                          uint16_t *sample_p)
 {
-    return (-1);
+    read_samples(self_p->dev_p, sample_p, 1);
+
+    return (0);
+}
+
+int adc_port_device_set_input_file(struct adc_device_t *dev_p,
+                                   const char *path_p)
+{
+    int res;
+
+    res = 0;
+
+    sys_lock();
+
+    if (dev_p->input.file_p != NULL) {
+        fclose(dev_p->input.file_p);
+        dev_p->input.file_p = NULL;
+    }
+
+    if (path_p != NULL) {
+        dev_p->input.file_p = fopen(path_p, "rb");
+
+        if (dev_p->input.file_p == NULL) {
+            res = -ENOENT;
+        } else {
+            dev_p->input.is_wav = (wav_parse_header(dev_p) == 0);
+
+            if (dev_p->input.is_wav == 0) {
+                rewind(dev_p->input.file_p);
+            }
+        }
+    }
+
+    sys_unlock();
+
+    return (res);
 }
@@ -31,14 +31,47 @@
 #ifndef __DRIVERS_DAC_PORT_H__
 #define __DRIVERS_DAC_PORT_H__
 
+#include <stdio.h>
+
 struct dac_driver_t;
 
 struct dac_device_t {
     struct dac_driver_t *drv_p;
+    struct {
+        FILE *file_p;
+        uint32_t data_size;
+        long sampling_rate;
+    } output;
 };
 
 struct dac_driver_t {
     struct dac_device_t *dev_p;
+    long sampling_rate;
+    struct {
+        struct dac_stream_t *stream_p;
+        struct dac_stream_buffer_t *buffer_p;
+        struct timer_t timer;
+        struct time_t start;
+        uint64_t number_of_samples;
+    } stream;
 };
 
+/**
+ * Write all converted samples on given device to given file. The
+ * file is a 16 bits stereo PCM WAV file where each 32 bits sample is
+ * written as is, that is, the lower 16 bits in the left channel and
+ * the upper 16 bits in the right channel.
+ *
+ * Stream samples are written with timing at the sampling rate given
+ * to `dac_init()`. Silence is written when there are no samples to
+ * convert, so underruns are visible in the file.
+ *
+ * @param[in] dev_p DAC device.
+ * @param[in] path_p File path, or NULL to close the current file.
+ *
+ * @return zero(0) or negative error code.
+ */
+int dac_port_device_set_output_file(struct dac_device_t *dev_p,
+                                    const char *path_p);
+
 #endif
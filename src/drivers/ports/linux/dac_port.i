@@ -28,6 +28,130 @@
  * This file is part of the Simba project.
  */
 
+static void write_le(uint8_t *buf_p, uint32_t value, int size)
+{
+    while (size > 0) {
+        *buf_p++ = value;
+        value >>= 8;
+        size--;
+    }
+}
+
+/**
+ * Write the WAV header with current data size and sampling rate.
+ */
+static void wav_write_header(struct dac_device_t *dev_p)
+{
+    uint8_t header[44];
+    long sampling_rate;
+
+    sampling_rate = dev_p->output.sampling_rate;
+
+    memcpy(&header[0], "RIFF", 4);
+    write_le(&header[4], 36 + dev_p->output.data_size, 4);
+    memcpy(&header[8], "WAVEfmt ", 8);
+    write_le(&header[16], 16, 4);
+    /* PCM, two channels, 16 bits per sample. */
+    write_le(&header[20], 1, 2);
+    write_le(&header[22], 2, 2);
+    write_le(&header[24], sampling_rate, 4);
+    write_le(&header[28], 4 * sampling_rate, 4);
+    write_le(&header[32], 4, 2);
+    write_le(&header[34], 16, 2);
+    memcpy(&header[36], "data", 4);
+    write_le(&header[40], dev_p->output.data_size, 4);
+
+    fseek(dev_p->output.file_p, 0, SEEK_SET);
+    fwrite(&header[0], sizeof(header), 1, dev_p->output.file_p);
+    fseek(dev_p->output.file_p, 0, SEEK_END);
+}
+
+/**
+ * Write given samples to the output file, or silence if samples_p is
+ * NULL.
+ */
+static void write_samples(struct dac_driver_t *self_p,
+                          const uint32_t *samples_p,
+                          size_t length)
+{
+    struct dac_device_t *dev_p;
+    uint8_t buf[4];
+    size_t i;
+
+    dev_p = self_p->dev_p;
+
+    if (dev_p->output.file_p == NULL) {
+        return;
+    }
+
+    for (i = 0; i < length; i++) {
+        if (samples_p != NULL) {
+            write_le(&buf[0], samples_p[i], 4);
+        } else {
+            write_le(&buf[0], 0, 4);
+        }
+
+        fwrite(&buf[0], 4, 1, dev_p->output.file_p);
+    }
+
+    /* The header is written when the stream is stopped or the file
+       is closed. */
+    dev_p->output.data_size += (4 * length);
+    dev_p->output.sampling_rate = self_p->sampling_rate;
+}
+
+/**
+ * Convert all stream buffers that are due according to the sampling
+ * rate, and write silence when there are none.
+ */
+static void stream_timer_cb(void *arg_p)
+{
+    struct dac_driver_t *self_p;
+    struct dac_stream_t *stream_p;
+    struct time_t now;
+    uint64_t elapsed;
+    uint64_t number_of_samples;
+
+    self_p = arg_p;
+    stream_p = self_p->stream.stream_p;
+
+    sys_uptime_isr(&now);
+    time_subtract(&now, &now, &self_p->stream.start);
+    elapsed = ((uint64_t)now.seconds * 1000000 + now.nanoseconds / 1000);
+    number_of_samples = (elapsed * self_p->sampling_rate / 1000000);
+
+    while (1) {
+        if (self_p->stream.buffer_p == NULL) {
+            self_p->stream.buffer_p = stream_load_isr(stream_p);
+
+            if (self_p->stream.buffer_p == NULL) {
+                /* Underrun. */
+                if (number_of_samples > self_p->stream.number_of_samples) {
+                    write_samples(self_p,
+                                  NULL,
+                                  (number_of_samples
+                                   - self_p->stream.number_of_samples));
+                    self_p->stream.number_of_samples = number_of_samples;
+                }
+
+                break;
+            }
+        }
+
+        if (self_p->stream.number_of_samples + self_p->stream.buffer_p->length
+            > number_of_samples) {
+            break;
+        }
+
+        write_samples(self_p,
+                      self_p->stream.buffer_p->samples_p,
+                      self_p->stream.buffer_p->length);
+        self_p->stream.number_of_samples += self_p->stream.buffer_p->length;
+        self_p->stream.buffer_p = NULL;
+        stream_buffer_done_isr(stream_p);
+    }
+}
+
 static int dac_port_module_init(void)
 {
     return (0);
@@ -39,6 +163,10 @@ static int dac_port_init(struct dac_driver_t *self_p,
                          struct pin_device_t *pin1_dev_p,
                          long sampling_rate)
 {
+    self_p->dev_p = dev_p;
+    self_p->sampling_rate = sampling_rate;
+    self_p->stream.stream_p = NULL;
+
     return (0);
 }
 
@@ -46,6 +174,10 @@ static int dac_port_async_convert(struct dac_driver_t *self_p,
                                   uint32_t *samples_p,
                                   size_t length)
 {
+    sys_lock();
+    write_samples(self_p, samples_p, length);
+    sys_unlock();
+
     return (0);
 }
 
@@ -57,6 +189,89 @@ static int dac_port_async_wait(struct dac_driver_t *self_p)
 static int dac_port_convert(struct dac_driver_t *self_p,
                             uint32_t *samples_p,
                             size_t length)
+{
+    return (dac_port_async_convert(self_p, samples_p, length));
+}
+
+static int dac_port_stream_start_isr(struct dac_driver_t *self_p,
+                                     struct dac_stream_t *stream_p)
+{
+    struct dac_stream_buffer_t *buffer_p;
+    struct time_t timeout;
+    uint64_t period;
+
+    if (self_p->stream.stream_p != NULL) {
+        return (-EBUSY);
+    }
+
+    /* Convert due buffers once per buffer period. */
+    buffer_p = &stream_p->buffers_p[0];
+    period = (1000000ull * buffer_p->length / self_p->sampling_rate);
+    timeout.seconds = (period / 1000000);
+    timeout.nanoseconds = (1000 * (period % 1000000));
+
+    self_p->stream.stream_p = stream_p;
+    self_p->stream.buffer_p = NULL;
+    self_p->stream.number_of_samples = 0;
+    sys_uptime_isr(&self_p->stream.start);
+    timer_init(&self_p->stream.timer,
+               &timeout,
+               stream_timer_cb,
+               self_p,
+               TIMER_PERIODIC);
+
+    return (timer_start_isr(&self_p->stream.timer));
+}
+
+static int dac_port_stream_stop_isr(struct dac_driver_t *self_p)
+{
+    if (self_p->stream.stream_p == NULL) {
+        return (-EINVAL);
+    }
+
+    timer_stop_isr(&self_p->stream.timer);
+    self_p->stream.stream_p = NULL;
+
+    if (self_p->dev_p->output.file_p != NULL) {
+        wav_write_header(self_p->dev_p);
+    }
+
+    return (0);
+}
+
+static int dac_port_stream_write_isr(struct dac_driver_t *self_p)
 {
     return (0);
 }
+
+int dac_port_device_set_output_file(struct dac_device_t *dev_p,
+                                    const char *path_p)
+{
+    int res;
+
+    res = 0;
+
+    sys_lock();
+
+    if (dev_p->output.file_p != NULL) {
+        wav_write_header(dev_p);
+        fclose(dev_p->output.file_p);
+        dev_p->output.file_p = NULL;
+    }
+
+    if (path_p != NULL) {
+        dev_p->output.file_p = fopen(path_p, "wb");
+
+        if (dev_p->output.file_p == NULL) {
+            res = -ENOENT;
+        } else {
+            dev_p->output.data_size = 0;
+            dev_p->output.sampling_rate = 0;
+            wav_write_header(dev_p);
+        }
+    }
+
+    sys_unlock();
+
+    return (res);
+}
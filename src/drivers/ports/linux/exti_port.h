@@ -34,6 +34,9 @@
 
 struct exti_device_t {
     struct exti_driver_t *drv_p;
+    /* Pin stimulus set with pin_port_device_set_input() triggers
+       interrupts on this device. */
+    const struct pin_device_t *pin_dev_p;
 };
 
 struct exti_driver_t {
@@ -35,11 +35,19 @@ static int exti_port_module_init()
 
 static int exti_port_start(struct exti_driver_t *self_p)
 {
+    sys_lock();
+    self_p->dev_p->drv_p = self_p;
+    sys_unlock();
+
     return (0);
 }
 
 static int exti_port_stop(struct exti_driver_t *self_p)
 {
+    sys_lock();
+    self_p->dev_p->drv_p = NULL;
+    sys_unlock();
+
     return (0);
 }
 
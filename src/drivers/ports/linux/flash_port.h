@@ -33,10 +33,43 @@
 
 struct flash_device_t {
     struct mutex_t mutex;
+    /* Simulated memory, or NULL. */
+    struct {
+        uint8_t *buf_p;
+        uintptr_t address;
+        size_t size;
+    } memory;
+    struct {
+        uint32_t reads;
+        uint32_t writes;
+        uint32_t erases;
+        uint32_t bytes_read;
+        uint32_t bytes_written;
+        uint32_t bytes_erased;
+    } counters;
 };
 
 struct flash_driver_t {
     struct flash_device_t *dev_p;
 };
 
+/**
+ * Simulate NOR flash memory in given buffer on given device. Erased
+ * bytes read as 0xff, and writes can only clear bits, as on a real
+ * flash. Accesses outside the memory fail with -EFAULT. Without
+ * memory all reads, writes and erases succeed without touching any
+ * data.
+ *
+ * @param[in] dev_p Flash device.
+ * @param[in] buf_p Memory buffer, or NULL to remove the memory.
+ * @param[in] address Flash address of the first byte in the buffer.
+ * @param[in] size Buffer size in bytes.
+ *
+ * @return zero(0) or negative error code.
+ */
+int flash_port_device_set_memory(struct flash_device_t *dev_p,
+                                 void *buf_p,
+                                 uintptr_t address,
+                                 size_t size);
+
 #endif
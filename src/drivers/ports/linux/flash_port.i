@@ -33,11 +33,47 @@ int flash_port_module_init(void)
     return (0);
 }
 
+/**
+ * Return a pointer to given simulated memory range, or NULL if it is
+ * outside the memory.
+ */
+static uint8_t *memory_get(struct flash_device_t *dev_p,
+                           uintptr_t address,
+                           size_t size)
+{
+    if ((address < dev_p->memory.address)
+        || (size > dev_p->memory.size)
+        || (address - dev_p->memory.address
+            > dev_p->memory.size - size)) {
+        return (NULL);
+    }
+
+    return (&dev_p->memory.buf_p[address - dev_p->memory.address]);
+}
+
 ssize_t flash_port_read(struct flash_driver_t *self_p,
                         void *dst_p,
                         uintptr_t src,
                         size_t size)
 {
+    struct flash_device_t *dev_p;
+    uint8_t *memory_p;
+
+    dev_p = self_p->dev_p;
+    dev_p->counters.reads++;
+
+    if (dev_p->memory.buf_p != NULL) {
+        memory_p = memory_get(dev_p, src, size);
+
+        if (memory_p == NULL) {
+            return (-EFAULT);
+        }
+
+        memcpy(dst_p, memory_p, size);
+    }
+
+    dev_p->counters.bytes_read += size;
+
     return (size);
 }
 
@@ -46,6 +82,31 @@ ssize_t flash_port_write(struct flash_driver_t *self_p,
                          const void *src_p,
                          size_t size)
 {
+    struct flash_device_t *dev_p;
+    uint8_t *memory_p;
+    const uint8_t *u8_src_p;
+    size_t i;
+
+    dev_p = self_p->dev_p;
+    dev_p->counters.writes++;
+
+    if (dev_p->memory.buf_p != NULL) {
+        memory_p = memory_get(dev_p, dst, size);
+
+        if (memory_p == NULL) {
+            return (-EFAULT);
+        }
+
+        u8_src_p = src_p;
+
+        /* Programming can only clear bits. */
+        for (i = 0; i < size; i++) {
+            memory_p[i] &= u8_src_p[i];
+        }
+    }
+
+    dev_p->counters.bytes_written += size;
+
     return (size);
 }
 
@@ -53,5 +114,37 @@ static int flash_port_erase(struct flash_driver_t *self_p,
                             uintptr_t addr,
                             size_t size)
 {
+    struct flash_device_t *dev_p;
+    uint8_t *memory_p;
+
+    dev_p = self_p->dev_p;
+    dev_p->counters.erases++;
+
+    if (dev_p->memory.buf_p != NULL) {
+        memory_p = memory_get(dev_p, addr, size);
+
+        if (memory_p == NULL) {
+            return (-EFAULT);
+        }
+
+        memset(memory_p, 0xff, size);
+    }
+
+    dev_p->counters.bytes_erased += size;
+
+    return (0);
+}
+
+int flash_port_device_set_memory(struct flash_device_t *dev_p,
+                                 void *buf_p,
+                                 uintptr_t address,
+                                 size_t size)
+{
+    ASSERTN(dev_p != NULL, EINVAL);
+
+    dev_p->memory.buf_p = buf_p;
+    dev_p->memory.address = address;
+    dev_p->memory.size = size;
+
     return (0);
 }
@@ -37,12 +37,68 @@
 #define I2C_PORT_BAUDRATE_400KBPS  2
 #define I2C_PORT_BAUDRATE_100KBPS  3
 
+struct i2c_driver_t;
+
+/**
+ * Transfer a message to or from a simulated slave.
+ *
+ * @param[in] arg_p Slave argument.
+ * @param[in] flags Message flags, I2C_MESSAGE_READ or
+ *                  I2C_MESSAGE_WRITE.
+ * @param[in,out] buf_p Data written by the master or buffer to read
+ *                      into.
+ * @param[in] size Number of bytes to transfer.
+ *
+ * @return Number of transferred bytes or negative error code.
+ */
+typedef ssize_t (*i2c_port_slave_transfer_t)(void *arg_p,
+                                             int flags,
+                                             void *buf_p,
+                                             size_t size);
+
+/**
+ * A simulated slave on an i2c bus.
+ */
+struct i2c_port_slave_t {
+    int address;
+    i2c_port_slave_transfer_t transfer;
+    void *arg_p;
+    struct i2c_port_slave_t *next_p;
+};
+
 struct i2c_device_t {
     struct i2c_driver_t *drv_p;
+    struct i2c_port_slave_t *slaves_p;
+    /* Bus activity, used to measure bus utilisation. */
+    struct {
+        uint32_t starts;
+        uint32_t stops;
+        uint32_t bytes;
+        /* Time the bus was busy at the configured baudrate. */
+        uint64_t busy_ns;
+    } counters;
 };
 
 struct i2c_driver_t {
     struct i2c_device_t *dev_p;
+    long baudrate;
 };
 
+/**
+ * Add a simulated slave with given address to given bus.
+ *
+ * @param[in] dev_p I2C device.
+ * @param[out] slave_p Slave to initialize and add.
+ * @param[in] address Slave address.
+ * @param[in] transfer Transfer function of the slave model.
+ * @param[in] arg_p Transfer function argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int i2c_port_device_add_slave(struct i2c_device_t *dev_p,
+                              struct i2c_port_slave_t *slave_p,
+                              int address,
+                              i2c_port_slave_transfer_t transfer,
+                              void *arg_p);
+
 #endif
@@ -30,6 +30,14 @@
 
 #include "socket_device.h"
 
+/* Baudrates in bits per second, indexed by I2C_PORT_BAUDRATE_*. */
+static const long baudrates[] = {
+    3200000,
+    1000000,
+    400000,
+    100000
+};
+
 static int i2c_port_module_init()
 {
     return (0);
@@ -42,9 +50,27 @@ static int i2c_port_init(struct i2c_driver_t *self_p,
 {
     self_p->dev_p = dev_p;
 
+    if ((baudrate >= 0) && (baudrate < membersof(baudrates))) {
+        self_p->baudrate = baudrates[baudrate];
+    } else {
+        self_p->baudrate = 0;
+    }
+
     return (0);
 }
 
+/**
+ * Add given number of bit times to the bus occupancy. Must be called
+ * with the system lock taken.
+ */
+static void occupy_isr(struct i2c_driver_t *self_p, size_t bits)
+{
+    if (self_p->baudrate > 0) {
+        self_p->dev_p->counters.busy_ns +=
+            ((1000000000ULL * bits) / self_p->baudrate);
+    }
+}
+
 static int i2c_port_start(struct i2c_driver_t *self_p)
 {
     self_p->dev_p->drv_p = self_p;
@@ -59,44 +85,169 @@ static int i2c_port_stop(struct i2c_driver_t *self_p)
     return (0);
 }
 
-static ssize_t i2c_port_read(struct i2c_driver_t *self_p,
-                             int address,
-                             void *buf_p,
-                             size_t size)
+static struct i2c_port_slave_t *find_slave(struct i2c_device_t *dev_p,
+                                           int address)
 {
-    return (-1);
+    struct i2c_port_slave_t *slave_p;
+
+    slave_p = dev_p->slaves_p;
+
+    while (slave_p != NULL) {
+        if (slave_p->address == address) {
+            return (slave_p);
+        }
+
+        slave_p = slave_p->next_p;
+    }
+
+    return (NULL);
 }
 
-static ssize_t i2c_port_write(struct i2c_driver_t *self_p,
-                              int address,
-                              const void *buf_p,
-                              size_t size)
+/**
+ * Transfer given message, started with a start or repeated start
+ * condition. Data written to a slave is also forwarded to the socket
+ * device client, if connected.
+ */
+static ssize_t transfer_message(struct i2c_driver_t *self_p,
+                                struct i2c_port_slave_t *slave_p,
+                                int address,
+                                int flags,
+                                void *buf_p,
+                                size_t size)
 {
     struct i2c_device_t *dev_p;
     ssize_t res;
 
     dev_p = self_p->dev_p;
+    res = -1;
 
     sys_lock();
 
-    if (socket_device_is_i2c_device_connected_isr(dev_p) == 1) {
+    /* Start condition and address, nine bits per byte including the
+       acknowledge bit. */
+    dev_p->counters.starts++;
+    dev_p->counters.bytes++;
+    occupy_isr(self_p, 1 + 9);
+
+    if (((flags & I2C_MESSAGE_READ) == 0)
+        && (socket_device_is_i2c_device_connected_isr(dev_p) == 1)) {
         res = socket_device_i2c_device_write_isr(dev_p,
                                                  address,
                                                  buf_p,
                                                  size);
-    } else {
-        res = size;
     }
 
     sys_unlock();
 
+    if (slave_p != NULL) {
+        res = slave_p->transfer(slave_p->arg_p, flags, buf_p, size);
+    }
+
+    if (res > 0) {
+        sys_lock();
+        dev_p->counters.bytes += res;
+        occupy_isr(self_p, 9 * res);
+        sys_unlock();
+    }
+
+    return (res);
+}
+
+static void stop(struct i2c_driver_t *self_p)
+{
+    sys_lock();
+    self_p->dev_p->counters.stops++;
+    occupy_isr(self_p, 1);
+    sys_unlock();
+}
+
+static ssize_t i2c_port_read(struct i2c_driver_t *self_p,
+                             int address,
+                             void *buf_p,
+                             size_t size)
+{
+    ssize_t res;
+
+    res = transfer_message(self_p,
+                           find_slave(self_p->dev_p, address),
+                           address,
+                           I2C_MESSAGE_READ,
+                           buf_p,
+                           size);
+    stop(self_p);
+
+    return (res);
+}
+
+static ssize_t i2c_port_write(struct i2c_driver_t *self_p,
+                              int address,
+                              const void *buf_p,
+                              size_t size)
+{
+    struct i2c_port_slave_t *slave_p;
+    ssize_t res;
+
+    slave_p = find_slave(self_p->dev_p, address);
+    res = transfer_message(self_p,
+                           slave_p,
+                           address,
+                           I2C_MESSAGE_WRITE,
+                           (void *)buf_p,
+                           size);
+    stop(self_p);
+
+    /* Writes without a simulated slave are accepted. */
+    if ((slave_p == NULL) && (res < 0)) {
+        res = size;
+    }
+
     return (res);
 }
 
+static ssize_t i2c_port_transfer(struct i2c_driver_t *self_p,
+                                 int address,
+                                 struct i2c_message_t *messages_p,
+                                 size_t number_of_messages)
+{
+    struct i2c_port_slave_t *slave_p;
+    ssize_t res;
+    ssize_t size;
+    size_t i;
+
+    slave_p = find_slave(self_p->dev_p, address);
+
+    if (slave_p == NULL) {
+        return (-1);
+    }
+
+    size = 0;
+
+    /* The messages are separated by repeated start conditions. */
+    for (i = 0; i < number_of_messages; i++) {
+        res = transfer_message(self_p,
+                               slave_p,
+                               address,
+                               messages_p[i].flags,
+                               messages_p[i].buf_p,
+                               messages_p[i].size);
+
+        if (res < 0) {
+            size = res;
+            break;
+        }
+
+        size += res;
+    }
+
+    stop(self_p);
+
+    return (size);
+}
+
 static int i2c_port_scan(struct i2c_driver_t *self_p,
                          int address)
 {
-    return (-1);
+    return (find_slave(self_p->dev_p, address) != NULL);
 }
 
 static int i2c_port_slave_start(struct i2c_driver_t *self_p)
@@ -122,3 +273,26 @@ static ssize_t i2c_port_slave_write(struct i2c_driver_t *self_p,
 {
     return (-1);
 }
+
+int i2c_port_device_add_slave(struct i2c_device_t *dev_p,
+                              struct i2c_port_slave_t *slave_p,
+                              int address,
+                              i2c_port_slave_transfer_t transfer,
+                              void *arg_p)
+{
+    ASSERTN(dev_p != NULL, EINVAL);
+    ASSERTN(slave_p != NULL, EINVAL);
+    ASSERTN(address < 128, EINVAL);
+    ASSERTN(transfer != NULL, EINVAL);
+
+    slave_p->address = address;
+    slave_p->transfer = transfer;
+    slave_p->arg_p = arg_p;
+
+    sys_lock();
+    slave_p->next_p = dev_p->slaves_p;
+    dev_p->slaves_p = slave_p;
+    sys_unlock();
+
+    return (0);
+}
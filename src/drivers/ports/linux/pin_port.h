@@ -49,4 +49,28 @@ int pin_port_device_write_high(const struct pin_device_t *dev_p);
 
 int pin_port_device_write_low(const struct pin_device_t *dev_p);
 
+uint32_t pin_port_device_mask(const struct pin_device_t *dev_p);
+
+int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                 const struct pin_device_t *other_p);
+
+int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                               uint32_t high_mask,
+                               uint32_t low_mask);
+
+uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                   uint32_t mask);
+
+/**
+ * Drive given simulated input pin to given value. Started EXTI
+ * drivers on the pin are interrupted if the value changes in the
+ * direction of their trigger.
+ *
+ * @param[in] dev_p Pin device.
+ * @param[in] value ``1`` for high and ``0`` for low input.
+ *
+ * @return zero(0) or negative error code.
+ */
+int pin_port_device_set_input(struct pin_device_t *dev_p, int value);
+
 #endif
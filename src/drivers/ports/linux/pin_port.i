@@ -44,7 +44,7 @@ static int pin_port_init(struct pin_driver_t *drv_p,
 
 static int pin_port_read(struct pin_driver_t *drv_p)
 {
-    return (0);
+    return (drv_p->dev_p->value);
 }
 
 static int pin_port_write(struct pin_driver_t *drv_p, int value)
@@ -74,7 +74,7 @@ int pin_port_device_set_mode(const struct pin_device_t *dev_p,
 
 int pin_port_device_read(const struct pin_device_t *dev_p)
 {
-    return (0);
+    return (dev_p->value);
 }
 
 int pin_port_device_write_high(const struct pin_device_t *dev_p)
@@ -112,3 +112,120 @@ int pin_port_device_write_low(const struct pin_device_t *dev_p)
 
     return (0);
 }
+
+/* The simulated pins are grouped into ports of 32 pins each. */
+#define PORT_INDEX(dev_p) (((dev_p) - &pin_device[0]) / 32)
+#define PORT_BIT(dev_p) (((dev_p) - &pin_device[0]) % 32)
+
+uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (1UL << PORT_BIT(dev_p));
+}
+
+int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                 const struct pin_device_t *other_p)
+{
+    return (PORT_INDEX(dev_p) == PORT_INDEX(other_p));
+}
+
+int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                               uint32_t high_mask,
+                               uint32_t low_mask)
+{
+    const struct pin_device_t *port_p;
+    int bit;
+
+    port_p = &pin_device[32 * PORT_INDEX(dev_p)];
+    low_mask &= ~high_mask;
+
+    while (high_mask != 0) {
+        bit = (__builtin_ffs(high_mask) - 1);
+        high_mask &= (high_mask - 1);
+        pin_port_device_write_high(&port_p[bit]);
+    }
+
+    while (low_mask != 0) {
+        bit = (__builtin_ffs(low_mask) - 1);
+        low_mask &= (low_mask - 1);
+        pin_port_device_write_low(&port_p[bit]);
+    }
+
+    return (0);
+}
+
+uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                   uint32_t mask)
+{
+    const struct pin_device_t *port_p;
+    uint32_t value;
+    uint32_t pending;
+    int bit;
+
+    port_p = &pin_device[32 * PORT_INDEX(dev_p)];
+    value = 0;
+    pending = mask;
+
+    while (pending != 0) {
+        bit = (__builtin_ffs(pending) - 1);
+        pending &= (pending - 1);
+
+        if (port_p[bit].value != 0) {
+            value |= (1UL << bit);
+        }
+    }
+
+    return (value);
+}
+
+/**
+ * Interrupt started EXTI drivers on given pin with a trigger matching
+ * given edge.
+ */
+static void interrupt_exti_isr(const struct pin_device_t *dev_p,
+                               int is_rising)
+{
+    struct exti_driver_t *exti_p;
+    size_t i;
+
+    for (i = 0; i < EXTI_DEVICE_MAX; i++) {
+        if (exti_device[i].pin_dev_p != dev_p) {
+            continue;
+        }
+
+        exti_p = exti_device[i].drv_p;
+
+        if (exti_p == NULL) {
+            continue;
+        }
+
+        if ((exti_p->trigger == EXTI_PORT_TRIGGER_BOTH_EDGES)
+            || ((exti_p->trigger == EXTI_PORT_TRIGGER_RISING_EDGE)
+                && is_rising)
+            || ((exti_p->trigger == EXTI_PORT_TRIGGER_FALLING_EDGE)
+                && !is_rising)) {
+            exti_p->on_interrupt(exti_p->arg_p);
+        }
+    }
+}
+
+int pin_port_device_set_input(struct pin_device_t *dev_p, int value)
+{
+    ASSERTN(dev_p != NULL, EINVAL);
+
+    int previous_value;
+
+    value = (value != 0);
+
+    sys_lock();
+
+    previous_value = dev_p->value;
+    dev_p->value = value;
+
+    if (value != previous_value) {
+        interrupt_exti_isr(dev_p, value);
+    }
+
+    sys_unlock();
+
+    return (0);
+}
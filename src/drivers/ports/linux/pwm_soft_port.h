@@ -34,4 +34,13 @@
 struct pwm_soft_port_module_t {
 };
 
+/**
+ * Simulate an expiry of the software PWM timer, which ticks once per
+ * microsecond. Pins with an edge at this time are written before
+ * this function returns.
+ *
+ * @return Number of timer ticks until the next expiry.
+ */
+unsigned int pwm_soft_port_timer_isr(void);
+
 #endif
@@ -28,12 +28,45 @@
  * This file is part of the Simba project.
  */
 
-static int pwm_soft_port_module_init()
+#include "drivers/internal.h"
+
+/* There is no timer in the Linux port. The simulated timer is run by
+   the application, possibly in the thread stopping a driver, so do
+   not wait for it. */
+#define PWM_SOFT_PORT_SKIP_WAIT_FOR_SCHEDULE
+
+/* The simulated timer ticks once per microsecond. */
+static int frequency_to_hw_config(long frequency,
+                                  long *duty_cycle_max_p)
 {
+    if ((frequency <= 0) || (frequency > 1000000L)) {
+        return (-1);
+    }
+
+    *duty_cycle_max_p = (1000000L / frequency);
+
     return (0);
 }
 
+unsigned int pwm_soft_port_timer_isr(void)
+{
+    sys_lock();
+    PWM_SOFT_ISR_PROLOGUE;
+    sys_unlock();
+
+    /* Pins are written without the system lock as it is taken by the
+       linux pin port. */
+    PWM_SOFT_ISR_EPILOGUE;
+
+    return (delta);
+}
+
+static int pwm_soft_port_module_init(long frequency)
+{
+    return (frequency_to_hw_config(frequency, &module.duty_cycle_max));
+}
+
 static int pwm_soft_port_set_frequency(long value)
 {
-    return (0);
+    return (frequency_to_hw_config(value, &module.duty_cycle_max));
 }
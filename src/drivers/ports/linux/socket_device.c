@@ -32,8 +32,12 @@
 
 #include <pthread.h>
 #include <unistd.h>
+#include <time.h>
+#include <limits.h>
 #include <sys/types.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/uio.h>
 #include <netdb.h>
 
 /**
@@ -51,6 +55,33 @@
 #define TYPE_I2C_DEVICE_REQUEST                           (9)
 #define TYPE_I2C_DEVICE_RESPONSE                         (10)
 
+/**
+ * The protocol version is stored in the upper 16 bits of the request
+ * type. Version zero(0) is the same as version one(1).
+ */
+#define TYPE_MASK                                    0x0000ffff
+#define VERSION_SHIFT                                        16
+
+#define VERSION_1                                             1
+#define VERSION_2                                             2
+
+/**
+ * Version 2 frame header; a 32 bits payload size followed by a 64
+ * bits timestamp in microseconds, both in network byte order.
+ */
+#define FRAME_HEADER_SIZE                                    12
+
+/**
+ * Maximum number of epoll events handled per wakeup.
+ */
+#define EVENTS_MAX                                           16
+
+/**
+ * Simulated microseconds to wait before passing input to a device
+ * with a full input queue again, one millisecond in real time.
+ */
+#define RETRY_TIMEOUT_US           (1000 * CONFIG_LINUX_TIME_SPEEDUP)
+
 /**
  * Convert given device pointer to its index.
  */
@@ -60,9 +91,26 @@
 #define CAN_INDEX(dev_p) (dev_p - &can_device[0])
 #define I2C_INDEX(dev_p) (dev_p - &i2c_device[0])
 
+struct client_t;
+
+/**
+ * Input data callback. Called with the system lock taken.
+ *
+ * Version 1 clients are passed all buffered input and version 2
+ * clients the payload of one frame at a time. Both shall return the
+ * number of bytes consumed. Input not consumed because the device
+ * input queue is full is passed again later, see
+ * `client_retry_later()`.
+ */
+typedef size_t (*input_fn_t)(struct client_t *self_p,
+                             const uint8_t *buf_p,
+                             size_t size);
+
 struct module_t {
     int8_t initialized;
     pthread_t thrd;
+    int epoll;
+    struct timespec start;
 };
 
 /**
@@ -84,632 +132,740 @@ struct device_response_t {
 };
 
 /**
- * The client types.
+ * A client connected to a device.
  */
-struct uart_client_t {
-    int socket;
-    struct uart_device_t *dev_p;
-    char name[64];
-    pthread_t thrd;
-};
-
-struct pin_client_t {
+struct client_t {
     int socket;
-    struct pin_device_t *dev_p;
+    int version;
+    const char *type_p;
     char name[64];
-    pthread_t thrd;
-};
-
-struct pwm_client_t {
-    int socket;
-    struct pwm_device_t *dev_p;
-    char name[64];
-    pthread_t thrd;
+    void *dev_p;
+    input_fn_t input;
+    int input_enabled;
+    int paused;
+    uint64_t resume_timestamp;
+    size_t size;
+    uint8_t buf[CONFIG_LINUX_SOCKET_DEVICE_BUFFER_SIZE];
 };
 
-struct can_client_t {
-    int socket;
-    struct can_device_t *dev_p;
-    char name[64];
-    pthread_t thrd;
+struct client_list_t {
+    struct client_t *clients_p;
+    size_t length;
 };
 
-struct i2c_client_t {
-    int socket;
-    struct i2c_device_t *dev_p;
-    char name[64];
-    pthread_t thrd;
+static struct client_t uart_clients[UART_DEVICE_MAX];
+static struct client_t pin_clients[PIN_DEVICE_MAX];
+static struct client_t pwm_clients[PWM_DEVICE_MAX];
+static struct client_t can_clients[CAN_DEVICE_MAX];
+static struct client_t i2c_clients[I2C_DEVICE_MAX];
+
+static struct client_list_t client_lists[] = {
+    { &uart_clients[0], membersof(uart_clients) },
+    { &pin_clients[0], membersof(pin_clients) },
+    { &pwm_clients[0], membersof(pwm_clients) },
+    { &can_clients[0], membersof(can_clients) },
+    { &i2c_clients[0], membersof(i2c_clients) }
 };
 
-static struct uart_client_t uart_clients[UART_DEVICE_MAX];
-static struct pin_client_t pin_clients[PIN_DEVICE_MAX];
-static struct pwm_client_t pwm_clients[PWM_DEVICE_MAX];
-static struct can_client_t can_clients[CAN_DEVICE_MAX];
-static struct i2c_client_t i2c_clients[I2C_DEVICE_MAX];
 static struct module_t module;
 
 /**
- * Handle a UART client connection.
+ * Simulated microseconds since the module was initialized. Like the
+ * system tick, the simulated time runs ``CONFIG_LINUX_TIME_SPEEDUP``
+ * times faster than real time.
  */
-static void *uart_client_main(void *arg_p)
+static uint64_t timestamp_now(void)
 {
-    struct uart_client_t *client_p;
-    ssize_t size;
-    uint8_t byte;
+    struct timespec now;
+    int64_t elapsed;
 
-    client_p = arg_p;
+    clock_gettime(CLOCK_MONOTONIC, &now);
 
-    printf("socket_device: uart device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
-
-    while (1) {
-        size = read(client_p->socket, &byte, sizeof(byte));
-
-        if (size != sizeof(byte)) {
-            break;
-        }
+    elapsed = ((int64_t)(now.tv_sec - module.start.tv_sec) * 1000000
+               + (now.tv_nsec - module.start.tv_nsec) / 1000);
 
-        sys_lock();
+    return (elapsed * CONFIG_LINUX_TIME_SPEEDUP);
+}
 
-        if (client_p->dev_p->drv_p != NULL) {
-            queue_write_isr(&client_p->dev_p->drv_p->base,
-                            &byte,
-                            sizeof(byte));
-        }
+static void pack_u64(uint8_t *buf_p, uint64_t value)
+{
+    int i;
 
-        sys_unlock();
+    for (i = 7; i >= 0; i--) {
+        buf_p[i] = value;
+        value >>= 8;
     }
+}
 
-    close(client_p->socket);
-    client_p->socket = -2;
+static uint64_t unpack_u64(const uint8_t *buf_p)
+{
+    uint64_t value;
+    int i;
 
-    printf("socket_device: uart device %s disconnected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    value = 0;
 
-    return (NULL);
+    for (i = 0; i < 8; i++) {
+        value <<= 8;
+        value |= buf_p[i];
+    }
+
+    return (value);
 }
 
-static int handle_uart_device_request(struct device_request_t *request_p,
-                                      int client)
+static void pack_u32(uint8_t *buf_p, uint32_t value)
 {
-    struct device_response_t response;
-    int res;
-    long index;
-    char *device_p;
+    buf_p[0] = (value >> 24);
+    buf_p[1] = (value >> 16);
+    buf_p[2] = (value >> 8);
+    buf_p[3] = value;
+}
 
-    res = 0;
+static uint32_t unpack_u32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | buf_p[3]);
+}
 
-    /* Parse the device name. */
-    device_p = (char *)&request_p->device[0];
+/**
+ * Enable or disable reading from given client.
+ */
+static void client_set_input_enabled(struct client_t *self_p, int enabled)
+{
+    struct epoll_event event;
 
-    if (std_strtol(device_p, &index) == NULL) {
-        index = -1;
+    if (self_p->input_enabled == enabled) {
+        return;
     }
 
-    /* Prepare the response. */
-    response.header.type = htonl(TYPE_UART_DEVICE_RESPONSE);
-    response.header.size = htonl(4);
-
-    if ((index < 0) || (index >= UART_DEVICE_MAX)) {
-        response.result = -ENODEV;
-    } else if (uart_clients[index].socket >= 0) {
-        response.result = -EADDRINUSE;
-    } else {
-        if (uart_clients[index].socket == -2) {
-            pthread_join(uart_clients[index].thrd, NULL);
-            uart_clients[index].socket = -1;
-        }
+    memset(&event, 0, sizeof(event));
 
-        response.result = 0;
+    if (enabled == 1) {
+        event.events = EPOLLIN;
     }
 
-    /* Send the response. */
-    response.result = htonl(response.result);
-    res = write(client, &response, sizeof(response));
+    event.data.ptr = self_p;
+    epoll_ctl(module.epoll, EPOLL_CTL_MOD, self_p->socket, &event);
+    self_p->input_enabled = enabled;
+}
 
-    if (response.result != 0) {
-        return (-1);
-    }
+static void client_disconnect(struct client_t *self_p)
+{
+    epoll_ctl(module.epoll, EPOLL_CTL_DEL, self_p->socket, NULL);
 
-    /* Start the client thread if everything went well so far. */
-    if (res == sizeof(response)) {
-        uart_clients[index].socket = client;
-        uart_clients[index].dev_p = &uart_device[index];
-        strcpy(&uart_clients[index].name[0], device_p);
-        res = pthread_create(&uart_clients[index].thrd,
-                             NULL,
-                             uart_client_main,
-                             &uart_clients[index]);
-
-        if (res != 0) {
-            fprintf(stderr, "error: creating uart device thread\n");
-        }
-    }
+    sys_lock();
+    close(self_p->socket);
+    self_p->socket = -1;
+    sys_unlock();
 
-    return (0);
+    printf("socket_device: %s device %s disconnected\n",
+           self_p->type_p,
+           &self_p->name[0]);
+    fflush(stdout);
 }
 
 /**
- * Handle a pin client connection.
+ * Pause given client as its device input queue is full. The rest of
+ * the input is passed to the device after a short timeout.
  */
-static void *pin_client_main(void *arg_p)
+static void client_retry_later(struct client_t *self_p)
 {
-    struct pin_client_t *client_p;
-    ssize_t size;
-    uint8_t byte;
+    self_p->paused = 1;
+    self_p->resume_timestamp = (timestamp_now() + RETRY_TIMEOUT_US);
+}
+
+/**
+ * Pass all version 2 frames that are due to the input callback.
+ *
+ * @return Number of consumed bytes or negative error code.
+ */
+static ssize_t client_process_frames(struct client_t *self_p, uint64_t now)
+{
+    size_t pos;
+    size_t consumed;
+    uint32_t size;
+    uint64_t timestamp;
 
-    client_p = arg_p;
+    pos = 0;
 
-    printf("socket_device: pin device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    while (self_p->size - pos >= FRAME_HEADER_SIZE) {
+        size = unpack_u32(&self_p->buf[pos]);
+        timestamp = unpack_u64(&self_p->buf[pos + 4]);
 
-    while (1) {
-        size = read(client_p->socket, &byte, sizeof(byte));
+        if (size > sizeof(self_p->buf) - FRAME_HEADER_SIZE) {
+            return (-EMSGSIZE);
+        }
 
-        if (size != sizeof(byte)) {
+        if (self_p->size - pos < FRAME_HEADER_SIZE + size) {
             break;
         }
 
-        /* Discard input data for now. */
-    }
+        /* Hold the frame until its timestamp. */
+        if (timestamp > now) {
+            self_p->paused = 1;
+            self_p->resume_timestamp = timestamp;
+            break;
+        }
 
-    close(client_p->socket);
-    client_p->socket = -2;
+        consumed = self_p->input(self_p,
+                                 &self_p->buf[pos + FRAME_HEADER_SIZE],
+                                 size);
 
-    printf("socket_device: pin device %s disconnected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+        /* Keep the rest of a partially consumed frame, with a new
+           header just before it. */
+        if (consumed < size) {
+            pos += consumed;
+            pack_u32(&self_p->buf[pos], size - consumed);
+            pack_u64(&self_p->buf[pos + 4], timestamp);
+            break;
+        }
 
-    return (NULL);
+        pos += (FRAME_HEADER_SIZE + size);
+    }
+
+    return (pos);
 }
 
-static int handle_pin_device_request(struct device_request_t *request_p,
-                                      int client)
+/**
+ * Pass buffered input to the device, taking the system lock once.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int client_process(struct client_t *self_p)
 {
-    struct device_response_t response;
-    int res;
-    long index;
-    char *device_p;
+    ssize_t pos;
 
-    res = 0;
+    self_p->paused = 0;
 
-    /* Parse the device name. */
-    device_p = (char *)&request_p->device[0];
-
-    index = board_pin_string_to_device_index(device_p);
+    sys_lock();
 
-    if (index < 0) {
-        if (std_strtol(device_p, &index) == NULL) {
-            index = -1;
-        }
-    }
-
-    /* Prepare the response. */
-    response.header.type = htonl(TYPE_PIN_DEVICE_RESPONSE);
-    response.header.size = htonl(4);
-
-    if ((index < 0) || (index >= PIN_DEVICE_MAX)) {
-        response.result = -ENODEV;
-    } else if (pin_clients[index].socket >= 0) {
-        response.result = -EADDRINUSE;
+    if (self_p->version == VERSION_1) {
+        pos = self_p->input(self_p, &self_p->buf[0], self_p->size);
     } else {
-        if (pin_clients[index].socket == -2) {
-            pthread_join(pin_clients[index].thrd, NULL);
-            pin_clients[index].socket = -1;
-        }
-
-        response.result = 0;
+        pos = client_process_frames(self_p, timestamp_now());
     }
 
-    /* Send the response. */
-    response.result = htonl(response.result);
-    res = write(client, &response, sizeof(response));
+    sys_unlock();
 
-    if (response.result != 0) {
-        return (-1);
+    if (pos < 0) {
+        return (pos);
     }
 
-    /* Start the client thread if everything went well so far. */
-    if (res == sizeof(response)) {
-        pin_clients[index].socket = client;
-        pin_clients[index].dev_p = &pin_device[index];
-        strcpy(&pin_clients[index].name[0], device_p);
-        res = pthread_create(&pin_clients[index].thrd,
-                             NULL,
-                             pin_client_main,
-                             &pin_clients[index]);
-
-        if (res != 0) {
-            fprintf(stderr, "error: creating pin device thread\n");
-        }
-    }
+    self_p->size -= pos;
+    memmove(&self_p->buf[0], &self_p->buf[pos], self_p->size);
+
+    /* Stop reading while waiting for a frame to become due. */
+    client_set_input_enabled(self_p, !self_p->paused);
 
     return (0);
 }
 
-#if CONFIG_PWM == 1
-
 /**
- * Handle a pwm client connection.
+ * Read as much input as possible from given client and process it.
  */
-static void *pwm_client_main(void *arg_p)
+static void client_read(struct client_t *self_p)
 {
-    struct pwm_client_t *client_p;
     ssize_t size;
-    uint8_t byte;
 
-    client_p = arg_p;
+    size = read(self_p->socket,
+                &self_p->buf[self_p->size],
+                sizeof(self_p->buf) - self_p->size);
 
-    printf("socket_device: pwm device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    if (size <= 0) {
+        client_disconnect(self_p);
 
-    while (1) {
-        size = read(client_p->socket, &byte, sizeof(byte));
+        return;
+    }
 
-        if (size != sizeof(byte)) {
-            break;
-        }
+    self_p->size += size;
 
-        /* Discard input data for now. */
+    if (client_process(self_p) != 0) {
+        printf("warning: socket_device: %s device %s: bad frame\n",
+               self_p->type_p,
+               &self_p->name[0]);
+        fflush(stdout);
+        client_disconnect(self_p);
+
+        return;
     }
 
-    close(client_p->socket);
-    client_p->socket = -2;
+    /* Discard input that cannot be processed. A paused client keeps
+       its input until the held frame is due, and is not read from
+       meanwhile. */
+    if ((self_p->paused == 0) && (self_p->size == sizeof(self_p->buf))) {
+        printf("warning: socket_device: %s device %s: discarding input\n",
+               self_p->type_p,
+               &self_p->name[0]);
+        fflush(stdout);
+        self_p->size = 0;
+    }
+}
 
-    printf("socket_device: pwm device %s disconnected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+/**
+ * Write given data to given client. Version 2 data is sent as a
+ * timestamped frame.
+ */
+static ssize_t client_write(struct client_t *self_p,
+                            const void *buf_p,
+                            size_t size)
+{
+    uint8_t header[FRAME_HEADER_SIZE];
+    struct iovec iov[2];
+    ssize_t res;
 
-    return (NULL);
+    if (self_p->version == VERSION_1) {
+        return (write(self_p->socket, buf_p, size));
+    }
+
+    pack_u32(&header[0], size);
+    pack_u64(&header[4], timestamp_now());
+    iov[0].iov_base = &header[0];
+    iov[0].iov_len = sizeof(header);
+    iov[1].iov_base = (void *)buf_p;
+    iov[1].iov_len = size;
+    res = writev(self_p->socket, &iov[0], membersof(iov));
+
+    if (res != sizeof(header) + size) {
+        return (-1);
+    }
+
+    return (size);
 }
 
-static int handle_pwm_device_request(struct device_request_t *request_p,
-                                      int client)
+/**
+ * Discard all input.
+ */
+static size_t discard_input(struct client_t *self_p,
+                            const uint8_t *buf_p,
+                            size_t size)
 {
-    struct device_response_t response;
-    int res;
-    long index;
-    char *device_p;
-    struct pwm_device_t *dev_p;
+    return (size);
+}
 
-    res = 0;
+/**
+ * Write as much input as fits to the UART driver input queue. Input
+ * is discarded if the driver is not started.
+ */
+static size_t uart_input(struct client_t *self_p,
+                         const uint8_t *buf_p,
+                         size_t size)
+{
+    struct uart_device_t *dev_p;
+    ssize_t res;
 
-    /* Parse the device name. */
-    device_p = (char *)&request_p->device[0];
+    dev_p = self_p->dev_p;
 
-    index = board_pin_string_to_device_index(device_p);
+    if (dev_p->drv_p == NULL) {
+        return (size);
+    }
 
-    if (index >= 0) {
-        dev_p = pwm_pin_to_device(&pin_device[index]);
+    res = queue_write_isr(&dev_p->drv_p->base, buf_p, size);
 
-        if (dev_p == NULL) {
-            index = -1;
-        } else {
-            index = PWM_INDEX(dev_p);
-        }
-    } else {
-        if (std_strtol(device_p, &index) == NULL) {
-            index = -1;
-        }
+    if (res < 0) {
+        return (size);
     }
 
-    /* Prepare the response. */
-    response.header.type = htonl(TYPE_PWM_DEVICE_RESPONSE);
-    response.header.size = htonl(4);
+    if ((size_t)res < size) {
+        client_retry_later(self_p);
+    }
 
-    if ((index < 0) || (index >= PWM_DEVICE_MAX)) {
-        response.result = -ENODEV;
-    } else if (pwm_clients[index].socket >= 0) {
-        response.result = -EADDRINUSE;
-    } else {
-        if (pwm_clients[index].socket == -2) {
-            pthread_join(pwm_clients[index].thrd, NULL);
-            pwm_clients[index].socket = -1;
-        }
+    return (res);
+}
 
-        response.result = 0;
+/**
+ * Write given frame to the CAN driver input queue.
+ *
+ * @return zero(0) if the frame was written or discarded, or -1 if the
+ *         queue is full.
+ */
+static int can_input_frame(struct client_t *self_p,
+                           struct can_frame_t *frame_p)
+{
+    struct can_device_t *dev_p;
+
+    dev_p = self_p->dev_p;
+
+    if (dev_p->drv_p == NULL) {
+        return (0);
     }
 
-    /* Send the response. */
-    response.result = htonl(response.result);
-    res = write(client, &response, sizeof(response));
+    if (queue_unused_size_isr(&dev_p->drv_p->chin) < sizeof(*frame_p)) {
+        client_retry_later(self_p);
 
-    if (response.result != 0) {
         return (-1);
     }
 
-    /* Start the client thread if everything went well so far. */
-    if (res == sizeof(response)) {
-        pwm_clients[index].socket = client;
-        pwm_clients[index].dev_p = &pwm_device[index];
-        strcpy(&pwm_clients[index].name[0], device_p);
-        res = pthread_create(&pwm_clients[index].thrd,
-                             NULL,
-                             pwm_client_main,
-                             &pwm_clients[index]);
-
-        if (res != 0) {
-            fprintf(stderr, "error: creating pwm device thread\n");
-        }
-    }
+    queue_write_isr(&dev_p->drv_p->chin, frame_p, sizeof(*frame_p));
 
     return (0);
 }
 
-#endif
-
 /**
- * Handle a can client connection.
+ * Parse version 1 CAN lines on the format
+ * ``id=%08x,extended=%d,size=%d,data=<hexdata>\r\n``.
  */
-static void *can_client_main(void *arg_p)
+static size_t can_input_v1(struct client_t *self_p,
+                           const uint8_t *buf_p,
+                           size_t size)
 {
-    struct can_client_t *client_p;
-    ssize_t size;
-    char buf[64];
     struct can_frame_t frame;
-    int frame_size;
-    long value;
-    size_t i;
+    const char *line_p;
+    const char *end_p;
+    char line[64];
+    size_t pos;
+    size_t length;
+    unsigned int id;
     int extended_frame;
+    int frame_size;
+    int offset;
+    unsigned int byte;
+    int i;
 
-    client_p = arg_p;
-
-    printf("socket_device: can device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    pos = 0;
 
     while (1) {
-        size = read(client_p->socket, &buf[0], 35);
+        line_p = (const char *)&buf_p[pos];
+        end_p = memchr(line_p, '\n', size - pos);
 
-        if (size == 0) {
+        if (end_p == NULL) {
             break;
-        } else if (size != 35) {
-            printf("warning: bad can line size %d\n", (int)size);
+        }
+
+        length = (end_p - line_p + 1);
+        pos += length;
+
+        if (length >= sizeof(line)) {
+            printf("warning: bad can line size %d\n", (int)length);
             fflush(stdout);
             continue;
         }
 
-        size = sscanf(&buf[0],
-                      "id=%08x,extended=%d,size=%d,data=",
-                      &frame.id,
-                      &extended_frame,
-                      &frame_size);
-
-        frame.extended_frame = extended_frame;
+        memcpy(&line[0], line_p, length);
+        line[length] = '\0';
 
-        if (size != 3) {
-            printf("warning: bad can message received: %s\n", &buf[0]);
+        if (sscanf(&line[0],
+                   "id=%08x,extended=%d,size=%d,data=%n",
+                   &id,
+                   &extended_frame,
+                   &frame_size,
+                   &offset) != 3) {
+            printf("warning: bad can message received: %s\n", &line[0]);
             fflush(stdout);
             continue;
         }
 
-        if ((frame.extended_frame != 0) && (frame.extended_frame != 1)) {
+        if ((extended_frame != 0) && (extended_frame != 1)) {
             printf("warning: bad can message exteneded frame: %d\n",
-                   frame.extended_frame);
+                   extended_frame);
             fflush(stdout);
             continue;
         }
 
-        if (frame_size > 8) {
+        if ((frame_size < 0) || (frame_size > 8)) {
             printf("warning: bad can message size: %d\n", frame_size);
             fflush(stdout);
             continue;
         }
 
+        memset(&frame, 0, sizeof(frame));
+        frame.id = id;
+        frame.extended_frame = extended_frame;
         frame.size = frame_size;
 
-        /* Read the data, one byte at a time. */
-        buf[0] = '0';
-        buf[1] = 'x';
-        buf[4] = '\0';
-
         for (i = 0; i < frame_size; i++) {
-            size = read(client_p->socket, &buf[2], 2);
-
-            if (size == 0) {
-                break;
-            } else if (size != 2) {
-                printf("warning: bad can line size %d\n", (int)size);
-                fflush(stdout);
-                size = -1;
+            if (sscanf(&line[offset + 2 * i], "%2x", &byte) != 1) {
                 break;
             }
 
-            if (std_strtol(&buf[0], &value) == NULL) {
-                size = -1;
-                break;
-            }
-
-            frame.data.u8[i] = value;
+            frame.data.u8[i] = byte;
         }
 
-        if (size == 0) {
-            break;
-        } else if (size == -1) {
+        if (i != frame_size) {
+            printf("warning: bad can message data: %s\n", &line[0]);
+            fflush(stdout);
             continue;
         }
 
-        /* Read the line terminator. */
-        read(client_p->socket, &buf[0], 2);
+        if (can_input_frame(self_p, &frame) != 0) {
+            return (pos - length);
+        }
+    }
 
-        sys_lock();
+    return (pos);
+}
 
-        if (client_p->dev_p->drv_p != NULL) {
-            queue_write_isr(&client_p->dev_p->drv_p->chin,
-                            &frame,
-                            sizeof(frame));
-        }
+/**
+ * Version 2 CAN frame payload; 32 bits id in network byte order,
+ * flags (bit 0 is extended frame and bit 1 is remote transmission
+ * request), size and data.
+ */
+static size_t can_input_v2(struct client_t *self_p,
+                           const uint8_t *buf_p,
+                           size_t size)
+{
+    struct can_frame_t frame;
+
+    if ((size < 6) || (buf_p[5] > 8) || (size != 6 + buf_p[5])) {
+        printf("warning: bad can frame size %d\n", (int)size);
+        fflush(stdout);
 
-        sys_unlock();
+        return (size);
     }
 
-    close(client_p->socket);
-    client_p->socket = -2;
+    memset(&frame, 0, sizeof(frame));
+    frame.id = unpack_u32(&buf_p[0]);
+    frame.extended_frame = ((buf_p[4] & 0x1) != 0);
+    frame.rtr = ((buf_p[4] & 0x2) != 0);
+    frame.size = buf_p[5];
+    memcpy(&frame.data.u8[0], &buf_p[6], frame.size);
 
-    printf("socket_device: can device %s disconnected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    if (can_input_frame(self_p, &frame) != 0) {
+        return (0);
+    }
 
-    return (NULL);
+    return (size);
 }
 
-static int handle_can_device_request(struct device_request_t *request_p,
-                                      int client)
+/**
+ * Respond to given device request and start serving the client if
+ * the device is available.
+ *
+ * @return zero(0) if the client was connected, otherwise negative
+ *         error code.
+ */
+static int client_connect(struct device_request_t *request_p,
+                          int client,
+                          int version,
+                          uint32_t response_type,
+                          struct client_t *clients_p,
+                          long length,
+                          long index,
+                          void *dev_p,
+                          const char *type_p,
+                          input_fn_t input_v1,
+                          input_fn_t input_v2)
 {
     struct device_response_t response;
-    int res;
-    long index;
-    char *device_p;
-
-    res = 0;
-
-    /* Parse the device name. */
-    device_p = (char *)&request_p->device[0];
+    struct client_t *client_p;
+    struct epoll_event event;
+    ssize_t res;
 
-    if (std_strtol(device_p, &index) == NULL) {
-        index = -1;
+    /* Prepare the response. Version 1 responses have no version for
+       compatibility with old clients. */
+    if (version != VERSION_1) {
+        response_type |= (version << VERSION_SHIFT);
     }
 
-    /* Prepare the response. */
-    response.header.type = htonl(TYPE_CAN_DEVICE_RESPONSE);
+    response.header.type = htonl(response_type);
     response.header.size = htonl(4);
 
-    if ((index < 0) || (index >= CAN_DEVICE_MAX)) {
+    if ((index < 0) || (index >= length)) {
         response.result = -ENODEV;
-    } else if (can_clients[index].socket >= 0) {
+    } else if (clients_p[index].socket >= 0) {
         response.result = -EADDRINUSE;
     } else {
-        if (can_clients[index].socket == -2) {
-            pthread_join(can_clients[index].thrd, NULL);
-            can_clients[index].socket = -1;
-        }
-
         response.result = 0;
     }
 
     /* Send the response. */
+    res = response.result;
     response.result = htonl(response.result);
-    res = write(client, &response, sizeof(response));
 
-    if (response.result != 0) {
-        return (-1);
+    if (write(client, &response, sizeof(response)) != sizeof(response)) {
+        return (-EIO);
     }
 
-    /* Start the client thread if everything went well so far. */
-    if (res == sizeof(response)) {
-        can_clients[index].socket = client;
-        can_clients[index].dev_p = &can_device[index];
-        strcpy(&can_clients[index].name[0], device_p);
-        res = pthread_create(&can_clients[index].thrd,
-                             NULL,
-                             can_client_main,
-                             &can_clients[index]);
-
-        if (res != 0) {
-            fprintf(stderr, "error: creating can device thread\n");
-        }
+    if (res != 0) {
+        return (res);
     }
 
-    return (0);
-}
+    client_p = &clients_p[index];
+    client_p->version = version;
+    client_p->type_p = type_p;
+    client_p->dev_p = dev_p;
+    client_p->input = (version == VERSION_1 ? input_v1 : input_v2);
+    client_p->input_enabled = 1;
+    client_p->paused = 0;
+    client_p->size = 0;
+    strcpy(&client_p->name[0], (char *)&request_p->device[0]);
 
-/**
- * Handle a i2c client connection.
- */
-static void *i2c_client_main(void *arg_p)
-{
-    struct i2c_client_t *client_p;
-    ssize_t size;
-    uint8_t byte;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = client_p;
 
-    client_p = arg_p;
+    if (epoll_ctl(module.epoll, EPOLL_CTL_ADD, client, &event) != 0) {
+        perror("socket_device: epoll_ctl");
 
-    printf("socket_device: i2c device %s connected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+        return (-EIO);
+    }
 
-    while (1) {
-        size = read(client_p->socket, &byte, sizeof(byte));
+    sys_lock();
+    client_p->socket = client;
+    sys_unlock();
 
-        if (size == 0) {
-            break;
-        }
+    printf("socket_device: %s device %s connected (protocol version %d)\n",
+           type_p,
+           &client_p->name[0],
+           version);
+    fflush(stdout);
 
-        /* Discard input data for now. */
-    }
+    return (0);
+}
 
-    close(client_p->socket);
-    client_p->socket = -2;
+static int handle_uart_device_request(struct device_request_t *request_p,
+                                      int client,
+                                      int version)
+{
+    long index;
 
-    printf("socket_device: i2c device %s disconnected\n",
-           &client_p->name[0]);
-    fflush(stdout);
+    /* Parse the device name. */
+    if (std_strtol((char *)&request_p->device[0], &index) == NULL) {
+        index = -1;
+    }
 
-    return (NULL);
+    return (client_connect(request_p,
+                           client,
+                           version,
+                           TYPE_UART_DEVICE_RESPONSE,
+                           &uart_clients[0],
+                           membersof(uart_clients),
+                           index,
+                           ((index >= 0) && (index < UART_DEVICE_MAX)
+                            ? &uart_device[index]
+                            : NULL),
+                           "uart",
+                           uart_input,
+                           uart_input));
 }
 
-static int handle_i2c_device_request(struct device_request_t *request_p,
-                                     int client)
+static int handle_pin_device_request(struct device_request_t *request_p,
+                                     int client,
+                                     int version)
 {
-    struct device_response_t response;
-    int res;
     long index;
     char *device_p;
 
-    res = 0;
-
     /* Parse the device name. */
     device_p = (char *)&request_p->device[0];
+    index = board_pin_string_to_device_index(device_p);
 
-    if (std_strtol(device_p, &index) == NULL) {
-        index = -1;
+    if (index < 0) {
+        if (std_strtol(device_p, &index) == NULL) {
+            index = -1;
+        }
     }
 
-    /* Prepare the response. */
-    response.header.type = htonl(TYPE_I2C_DEVICE_RESPONSE);
-    response.header.size = htonl(4);
+    return (client_connect(request_p,
+                           client,
+                           version,
+                           TYPE_PIN_DEVICE_RESPONSE,
+                           &pin_clients[0],
+                           membersof(pin_clients),
+                           index,
+                           ((index >= 0) && (index < PIN_DEVICE_MAX)
+                            ? &pin_device[index]
+                            : NULL),
+                           "pin",
+                           discard_input,
+                           discard_input));
+}
 
-    if ((index < 0) || (index >= I2C_DEVICE_MAX)) {
-        response.result = -ENODEV;
-    } else if (i2c_clients[index].socket >= 0) {
-        response.result = -EADDRINUSE;
+#if CONFIG_PWM == 1
+
+static int handle_pwm_device_request(struct device_request_t *request_p,
+                                     int client,
+                                     int version)
+{
+    long index;
+    char *device_p;
+    struct pwm_device_t *dev_p;
+
+    /* Parse the device name. */
+    device_p = (char *)&request_p->device[0];
+    index = board_pin_string_to_device_index(device_p);
+
+    if (index >= 0) {
+        dev_p = pwm_pin_to_device(&pin_device[index]);
+
+        if (dev_p == NULL) {
+            index = -1;
+        } else {
+            index = PWM_INDEX(dev_p);
+        }
     } else {
-        if (i2c_clients[index].socket == -2) {
-            pthread_join(i2c_clients[index].thrd, NULL);
-            i2c_clients[index].socket = -1;
+        if (std_strtol(device_p, &index) == NULL) {
+            index = -1;
         }
-
-        response.result = 0;
     }
 
-    /* Send the response. */
-    response.result = htonl(response.result);
-    res = write(client, &response, sizeof(response));
+    return (client_connect(request_p,
+                           client,
+                           version,
+                           TYPE_PWM_DEVICE_RESPONSE,
+                           &pwm_clients[0],
+                           membersof(pwm_clients),
+                           index,
+                           ((index >= 0) && (index < PWM_DEVICE_MAX)
+                            ? &pwm_device[index]
+                            : NULL),
+                           "pwm",
+                           discard_input,
+                           discard_input));
+}
 
-    if (response.result != 0) {
-        return (-1);
+#endif
+
+static int handle_can_device_request(struct device_request_t *request_p,
+                                     int client,
+                                     int version)
+{
+    long index;
+
+    /* Parse the device name. */
+    if (std_strtol((char *)&request_p->device[0], &index) == NULL) {
+        index = -1;
     }
 
-    /* Start the client thread if everything went well so far. */
-    if (res == sizeof(response)) {
-        i2c_clients[index].socket = client;
-        i2c_clients[index].dev_p = &i2c_device[index];
-        strcpy(&i2c_clients[index].name[0], device_p);
-        res = pthread_create(&i2c_clients[index].thrd,
-                             NULL,
-                             i2c_client_main,
-                             &i2c_clients[index]);
-
-        if (res != 0) {
-            fprintf(stderr, "error: creating i2c device thread\n");
-        }
+    return (client_connect(request_p,
+                           client,
+                           version,
+                           TYPE_CAN_DEVICE_RESPONSE,
+                           &can_clients[0],
+                           membersof(can_clients),
+                           index,
+                           ((index >= 0) && (index < CAN_DEVICE_MAX)
+                            ? &can_device[index]
+                            : NULL),
+                           "can",
+                           can_input_v1,
+                           can_input_v2));
+}
+
+static int handle_i2c_device_request(struct device_request_t *request_p,
+                                     int client,
+                                     int version)
+{
+    long index;
+
+    /* Parse the device name. */
+    if (std_strtol((char *)&request_p->device[0], &index) == NULL) {
+        index = -1;
     }
 
-    return (0);
+    return (client_connect(request_p,
+                           client,
+                           version,
+                           TYPE_I2C_DEVICE_RESPONSE,
+                           &i2c_clients[0],
+                           membersof(i2c_clients),
+                           index,
+                           ((index >= 0) && (index < I2C_DEVICE_MAX)
+                            ? &i2c_device[index]
+                            : NULL),
+                           "i2c",
+                           discard_input,
+                           discard_input));
 }
 
 /**
@@ -786,126 +942,223 @@ static int setup_listener(void)
 }
 
 /**
- * Entry function of the socket device listener thread.
+ * Accept a new client and handle its device request.
  */
-static void *listener_main(void *arg_p)
+static void accept_client(int listener)
 {
-    int listener;
     int client;
     ssize_t size;
     struct device_request_t request;
     struct header_t response;
     int res;
+    int version;
+    uint32_t type;
 
-    listener = setup_listener();
+    client = accept(listener, NULL, NULL);
 
-    if (listener < 0) {
-        printf("warning: socket_device: failed to setup listener socket\n");
-        fflush(stdout);
+    if (client == -1) {
+        perror("socket_device: accept");
 
-        return (NULL);
+        return;
     }
 
-    printf("info: socket_device: listening for clients on TCP port 47000\n");
-    fflush(stdout);
+    /* Read the request header. */
+    size = read(client, &request.header, sizeof(request.header));
 
-    while (1) {
-        client = accept(listener, NULL, NULL);
+    if (size != sizeof(request.header)) {
+        perror("socket_device: read request");
+        close(client);
 
-        if (client == -1) {
-            perror("socket_device: accept");
-            continue;
-        }
+        return;
+    }
 
-        /* Read the request header. */
-        size = read(client, &request.header, sizeof(request.header));
+    /* Host byte order. */
+    request.header.type = ntohl(request.header.type);
+    request.header.size = ntohl(request.header.size);
 
-        if (size != sizeof(request.header)) {
-            perror("socket_device: read request");
-            close(client);
-            continue;
-        }
+    /* Validate the size. */
+    if (request.header.size >= sizeof(request.device)) {
+        perror("socket_device: read request size");
+        close(client);
 
-        /* Host byte order. */
-        request.header.type = ntohl(request.header.type);
-        request.header.size = ntohl(request.header.size);
+        return;
+    }
 
-        /* Validate the size. */
-        if (request.header.size >= sizeof(request.device)) {
-            perror("socket_device: read request size");
-            close(client);
-            continue;
-        }
+    /* Read the device name. */
+    size = read(client, &request.device[0], request.header.size);
 
-        /* Read the device name. */
-        size = read(client, &request.device[0], request.header.size);
+    if (size != request.header.size) {
+        perror("socket_device: read request device name size");
+        close(client);
 
-        if (size != request.header.size) {
-            perror("socket_device: read request device name size");
-            close(client);
-            continue;
-        }
+        return;
+    }
 
-        request.device[request.header.size] = '\0';
+    request.device[request.header.size] = '\0';
 
-        /* Handle the request type. */
-        if (request.header.type == TYPE_UART_DEVICE_REQUEST) {
-            res = handle_uart_device_request(&request, client);
-        } else if (request.header.type == TYPE_PIN_DEVICE_REQUEST) {
-            res = handle_pin_device_request(&request, client);
+    version = (request.header.type >> VERSION_SHIFT);
+    type = (request.header.type & TYPE_MASK);
+
+    if (version == 0) {
+        version = VERSION_1;
+    }
+
+    /* Handle the request type. */
+    if ((version != VERSION_1) && (version != VERSION_2)) {
+        type = TYPE_UNSUPPORTED_TYPE;
+    }
+
+    if (type == TYPE_UART_DEVICE_REQUEST) {
+        res = handle_uart_device_request(&request, client, version);
+    } else if (type == TYPE_PIN_DEVICE_REQUEST) {
+        res = handle_pin_device_request(&request, client, version);
 #if CONFIG_PWM == 1
-        } else if (request.header.type == TYPE_PWM_DEVICE_REQUEST) {
-            res = handle_pwm_device_request(&request, client);
+    } else if (type == TYPE_PWM_DEVICE_REQUEST) {
+        res = handle_pwm_device_request(&request, client, version);
 #endif
-        } else if (request.header.type == TYPE_CAN_DEVICE_REQUEST) {
-            res = handle_can_device_request(&request, client);
-        } else if (request.header.type == TYPE_I2C_DEVICE_REQUEST) {
-            res = handle_i2c_device_request(&request, client);
-        } else {
-            /* Send the response. */
-            response.type = htonl(TYPE_UNSUPPORTED_TYPE);
-            response.size = htonl(0);
-            write(client, &response, sizeof(response));
-            res = -1;
-        }
+    } else if (type == TYPE_CAN_DEVICE_REQUEST) {
+        res = handle_can_device_request(&request, client, version);
+    } else if (type == TYPE_I2C_DEVICE_REQUEST) {
+        res = handle_i2c_device_request(&request, client, version);
+    } else {
+        /* Send the response. */
+        response.type = htonl(TYPE_UNSUPPORTED_TYPE);
+        response.size = htonl(0);
+        write(client, &response, sizeof(response));
+        res = -1;
+    }
+
+    if (res != 0) {
+        close(client);
+    }
+}
+
+/**
+ * Process input from paused clients with due frames, and calculate
+ * the epoll timeout until the next paused client is due.
+ *
+ * @return Timeout in milliseconds, or -1 if no client is paused.
+ */
+static int process_paused_clients(void)
+{
+    struct client_t *client_p;
+    uint64_t now;
+    uint64_t timeout;
+    int res;
+    size_t i;
+    size_t j;
+
+    res = -1;
+
+    for (i = 0; i < membersof(client_lists); i++) {
+        for (j = 0; j < client_lists[i].length; j++) {
+            client_p = &client_lists[i].clients_p[j];
+
+            if ((client_p->socket < 0) || (client_p->paused == 0)) {
+                continue;
+            }
+
+            now = timestamp_now();
+
+            if (client_p->resume_timestamp <= now) {
+                if (client_process(client_p) != 0) {
+                    client_disconnect(client_p);
+                    continue;
+                }
 
-        if (res != 0) {
-            close(client);
+                if (client_p->paused == 0) {
+                    continue;
+                }
+            }
+
+            /* Real time milliseconds until the frame is due. */
+            timeout = DIV_CEIL(client_p->resume_timestamp - now,
+                               (1000 * CONFIG_LINUX_TIME_SPEEDUP));
+
+            if ((res == -1) || (timeout < res)) {
+                res = MIN(timeout, INT_MAX);
+            }
         }
     }
 
-    return (NULL);
+    return (res);
 }
 
-int socket_device_module_init()
+/**
+ * Entry function of the socket device thread. All clients are served
+ * by this thread.
+ */
+static void *listener_main(void *arg_p)
 {
+    int listener;
+    struct epoll_event events[EVENTS_MAX];
+    struct epoll_event event;
+    int number_of_events;
+    int timeout;
     int i;
-    int res;
 
-    if (module.initialized == 1) {
-        return (0);
-    }
+    listener = setup_listener();
 
-    module.initialized = 1;
+    if (listener < 0) {
+        printf("warning: socket_device: failed to setup listener socket\n");
+        fflush(stdout);
 
-    for (i = 0; i < membersof(pin_clients); i++) {
-        pin_clients[i].socket = -1;
+        return (NULL);
     }
 
-    for (i = 0; i < membersof(uart_clients); i++) {
-        uart_clients[i].socket = -1;
+    module.epoll = epoll_create1(0);
+
+    if (module.epoll == -1) {
+        perror("socket_device: epoll_create1");
+        close(listener);
+
+        return (NULL);
     }
 
-    for (i = 0; i < membersof(pwm_clients); i++) {
-        pwm_clients[i].socket = -1;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN;
+    event.data.ptr = NULL;
+    epoll_ctl(module.epoll, EPOLL_CTL_ADD, listener, &event);
+
+    printf("info: socket_device: listening for clients on TCP port 47000\n");
+    fflush(stdout);
+
+    while (1) {
+        timeout = process_paused_clients();
+        number_of_events = epoll_wait(module.epoll,
+                                      &events[0],
+                                      membersof(events),
+                                      timeout);
+
+        for (i = 0; i < number_of_events; i++) {
+            if (events[i].data.ptr == NULL) {
+                accept_client(listener);
+            } else {
+                client_read(events[i].data.ptr);
+            }
+        }
     }
 
-    for (i = 0; i < membersof(can_clients); i++) {
-        can_clients[i].socket = -1;
+    return (NULL);
+}
+
+int socket_device_module_init()
+{
+    int res;
+    size_t i;
+    size_t j;
+
+    if (module.initialized == 1) {
+        return (0);
     }
 
-    for (i = 0; i < membersof(i2c_clients); i++) {
-        i2c_clients[i].socket = -1;
+    module.initialized = 1;
+    clock_gettime(CLOCK_MONOTONIC, &module.start);
+
+    for (i = 0; i < membersof(client_lists); i++) {
+        for (j = 0; j < client_lists[i].length; j++) {
+            client_lists[i].clients_p[j].socket = -1;
+        }
     }
 
 #if CONFIG_LINUX_SOCKET_DEVICE == 1
@@ -913,7 +1166,7 @@ int socket_device_module_init()
     res = pthread_create(&module.thrd, NULL, listener_main, NULL);
 
     if (res != 0) {
-        fprintf(stderr, "error: creating uart device thread\n");
+        fprintf(stderr, "error: creating socket device thread\n");
     }
 
 #else
@@ -929,11 +1182,7 @@ int socket_device_module_init()
 int socket_device_is_uart_device_connected_isr(
     const struct uart_device_t *dev_p)
 {
-    int client;
-
-    client = uart_clients[UART_INDEX(dev_p)].socket;
-
-    return (client >= 0);
+    return (uart_clients[UART_INDEX(dev_p)].socket >= 0);
 }
 
 ssize_t socket_device_uart_device_write_isr(
@@ -941,51 +1190,39 @@ ssize_t socket_device_uart_device_write_isr(
     const void *buf_p,
     size_t size)
 {
-    return (write(uart_clients[UART_INDEX(dev_p)].socket, buf_p, size));
+    return (client_write(&uart_clients[UART_INDEX(dev_p)], buf_p, size));
 }
 
 int socket_device_is_pin_device_connected_isr(
     const struct pin_device_t *dev_p)
 {
-    int client;
-
-    client = pin_clients[PIN_INDEX(dev_p)].socket;
-
-    return (client >= 0);
+    return (pin_clients[PIN_INDEX(dev_p)].socket >= 0);
 }
 
 ssize_t socket_device_pin_device_write_isr(const struct pin_device_t *dev_p,
                                            const void *buf_p,
                                            size_t size)
 {
-    return (write(pin_clients[PIN_INDEX(dev_p)].socket, buf_p, size));
+    return (client_write(&pin_clients[PIN_INDEX(dev_p)], buf_p, size));
 }
 
 int socket_device_is_pwm_device_connected_isr(
     const struct pwm_device_t *dev_p)
 {
-    int client;
-
-    client = pwm_clients[PWM_INDEX(dev_p)].socket;
-
-    return (client >= 0);
+    return (pwm_clients[PWM_INDEX(dev_p)].socket >= 0);
 }
 
 ssize_t socket_device_pwm_device_write_isr(const struct pwm_device_t *dev_p,
                                            const void *buf_p,
                                            size_t size)
 {
-    return (write(pwm_clients[PWM_INDEX(dev_p)].socket, buf_p, size));
+    return (client_write(&pwm_clients[PWM_INDEX(dev_p)], buf_p, size));
 }
 
 int socket_device_is_can_device_connected_isr(
     const struct can_device_t *dev_p)
 {
-    int client;
-
-    client = can_clients[CAN_INDEX(dev_p)].socket;
-
-    return (client >= 0);
+    return (can_clients[CAN_INDEX(dev_p)].socket >= 0);
 }
 
 ssize_t socket_device_can_device_write_isr(const struct can_device_t *dev_p,
@@ -993,56 +1230,49 @@ ssize_t socket_device_can_device_write_isr(const struct can_device_t *dev_p,
                                            size_t size)
 {
     const struct can_frame_t *frame_p;
+    struct client_t *client_p;
     char buf[64];
-    ssize_t res;
-    int socket;
     size_t i;
+    size_t j;
+    int length;
+
+    client_p = &can_clients[CAN_INDEX(dev_p)];
+    frame_p = buf_p;
+
+    for (i = 0; i < size / sizeof(*frame_p); i++, frame_p++) {
+        if (client_p->version == VERSION_1) {
+            /* Format the line to send to the client. */
+            length = sprintf(&buf[0],
+                             "id=%08x,extended=%d,size=%d,data=",
+                             frame_p->id,
+                             (int)frame_p->extended_frame,
+                             (int)frame_p->size);
+
+            for (j = 0; j < frame_p->size; j++) {
+                length += sprintf(&buf[length], "%02x", frame_p->data.u8[j]);
+            }
 
-    socket = can_clients[CAN_INDEX(dev_p)].socket;
-
-    frame_p = (struct can_frame_t *)buf_p;
-
-    /* Format the line to send to the client. */
-    sprintf(&buf[0],
-            "id=%08x,extended=%d,size=%d,data=",
-            frame_p->id,
-            (int)frame_p->extended_frame,
-            (int)frame_p->size);
-
-    res = write(socket, &buf[0], strlen(&buf[0]));
-
-    if (res != strlen(&buf[0])) {
-        return (-1);
-    }
-
-    /* Write the data, one byte at a time. */
-    for (i = 0; i < frame_p->size; i++) {
-        sprintf(&buf[0], "%02x", frame_p->data.u8[i]);
-
-        res = write(socket, &buf[0], 2);
+            length += sprintf(&buf[length], "\r\n");
+        } else {
+            pack_u32((uint8_t *)&buf[0], frame_p->id);
+            buf[4] = ((frame_p->rtr << 1) | frame_p->extended_frame);
+            buf[5] = frame_p->size;
+            memcpy(&buf[6], &frame_p->data.u8[0], frame_p->size);
+            length = (6 + frame_p->size);
+        }
 
-        if (res != 2) {
+        if (client_write(client_p, &buf[0], length) != length) {
             return (-1);
         }
     }
 
-    res = write(socket, "\r\n", 2);
-
-    if (res != 2) {
-        return (-1);
-    }
-
     return (size);
 }
 
 int socket_device_is_i2c_device_connected_isr(
     const struct i2c_device_t *dev_p)
 {
-    int client;
-
-    client = i2c_clients[I2C_INDEX(dev_p)].socket;
-
-    return (client >= 0);
+    return (i2c_clients[I2C_INDEX(dev_p)].socket >= 0);
 }
 
 ssize_t socket_device_i2c_device_write_isr(const struct i2c_device_t *dev_p,
@@ -1050,18 +1280,40 @@ ssize_t socket_device_i2c_device_write_isr(const struct i2c_device_t *dev_p,
                                            const void *buf_p,
                                            size_t size)
 {
+    struct client_t *client_p;
     char buf[64];
     ssize_t res;
-    int socket;
     size_t i;
     const uint8_t *byte_p;
+    struct iovec iov[2];
+    uint8_t header[FRAME_HEADER_SIZE + 2];
+
+    client_p = &i2c_clients[I2C_INDEX(dev_p)];
+
+    if (client_p->version == VERSION_2) {
+        /* 16 bits address in network byte order followed by the
+           data. */
+        pack_u32(&header[0], size + 2);
+        pack_u64(&header[4], timestamp_now());
+        header[12] = (address >> 8);
+        header[13] = address;
+        iov[0].iov_base = &header[0];
+        iov[0].iov_len = sizeof(header);
+        iov[1].iov_base = (void *)buf_p;
+        iov[1].iov_len = size;
+        res = writev(client_p->socket, &iov[0], membersof(iov));
+
+        if (res != sizeof(header) + size) {
+            return (-1);
+        }
 
-    socket = i2c_clients[I2C_INDEX(dev_p)].socket;
+        return (size);
+    }
 
     /* Write the address. */
     sprintf(&buf[0], "address=%04x,size=%04lx,data=", address, size);
 
-    res = write(socket, &buf[0], strlen(&buf[0]));
+    res = write(client_p->socket, &buf[0], strlen(&buf[0]));
 
     if (res != strlen(&buf[0])) {
         return (-1);
@@ -1073,14 +1325,14 @@ ssize_t socket_device_i2c_device_write_isr(const struct i2c_device_t *dev_p,
     for (i = 0; i < size; i++) {
         sprintf(&buf[0], "%02x", byte_p[i]);
 
-        res = write(socket, &buf[0], 2);
+        res = write(client_p->socket, &buf[0], 2);
 
         if (res != 2) {
             return (-1);
         }
     }
 
-    res = write(socket, "\r\n", 2);
+    res = write(client_p->socket, "\r\n", 2);
 
     if (res != 2) {
         return (-1);
@@ -33,20 +33,55 @@
 
 #include <io.h>
 
-/* Speed configuration is not used in this port. */
-#define SPI_PORT_SPEED_8MBPS    0
-#define SPI_PORT_SPEED_4MBPS    0
-#define SPI_PORT_SPEED_2MBPS    0
-#define SPI_PORT_SPEED_1MBPS    0
-#define SPI_PORT_SPEED_500KBPS  0
-#define SPI_PORT_SPEED_250KBPS  0
-#define SPI_PORT_SPEED_125KBPS  0
+/* Speeds in bits per second, used to calculate the bus
+   occupancy. */
+#define SPI_PORT_SPEED_8MBPS    8000000
+#define SPI_PORT_SPEED_4MBPS    4000000
+#define SPI_PORT_SPEED_2MBPS    2000000
+#define SPI_PORT_SPEED_1MBPS    1000000
+#define SPI_PORT_SPEED_500KBPS   500000
+#define SPI_PORT_SPEED_250KBPS   250000
+#define SPI_PORT_SPEED_125KBPS   125000
 
 struct spi_driver_t;
 
+/**
+ * Transfer data to and from a simulated slave. Either buffer may be
+ * NULL.
+ *
+ * @param[in] arg_p Slave argument.
+ * @param[out] rxbuf_p Data read by the master, or NULL.
+ * @param[in] txbuf_p Data written by the master, or NULL.
+ * @param[in] size Number of bytes to transfer.
+ *
+ * @return Number of transferred bytes or negative error code.
+ */
+typedef ssize_t (*spi_port_slave_transfer_t)(void *arg_p,
+                                             void *rxbuf_p,
+                                             const void *txbuf_p,
+                                             size_t size);
+
+/**
+ * A simulated slave on a SPI bus, selected by its slave select pin.
+ */
+struct spi_port_slave_t {
+    const struct pin_device_t *ss_pin_p;
+    spi_port_slave_transfer_t transfer;
+    void *arg_p;
+    struct spi_port_slave_t *next_p;
+};
+
 struct spi_device_t {
     struct spi_driver_t *drv_p;
     struct mutex_t mutex;
+    struct spi_port_slave_t *slaves_p;
+    /* Bus activity, used to measure bus utilisation. */
+    struct {
+        uint32_t transfers;
+        uint32_t bytes;
+        /* Time the bus was busy at the configured speed. */
+        uint64_t busy_ns;
+    } counters;
 };
 
 struct spi_driver_t {
@@ -58,4 +93,23 @@ struct spi_driver_t {
     int phase;
 };
 
+/**
+ * Add a simulated slave to given bus. Transfers on the bus are routed
+ * to the slave when its slave select pin is low, otherwise the
+ * transfer is ignored, as if no slave was connected.
+ *
+ * @param[in] dev_p SPI device.
+ * @param[out] slave_p Slave to initialize and add.
+ * @param[in] ss_pin_p Slave select pin device of the slave.
+ * @param[in] transfer Transfer function of the slave model.
+ * @param[in] arg_p Transfer function argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int spi_port_device_add_slave(struct spi_device_t *dev_p,
+                              struct spi_port_slave_t *slave_p,
+                              const struct pin_device_t *ss_pin_p,
+                              spi_port_slave_transfer_t transfer,
+                              void *arg_p);
+
 #endif
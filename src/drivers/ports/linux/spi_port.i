@@ -42,6 +42,7 @@ static int spi_port_init(struct spi_driver_t *self_p,
                          int phase)
 {
     pin_init(&self_p->ss, ss_pin_p, PIN_OUTPUT);
+    pin_write(&self_p->ss, 1);
 
     return (0);
 }
@@ -61,5 +62,55 @@ static ssize_t spi_port_transfer(struct spi_driver_t *self_p,
                                  const void *txbuf_p,
                                  size_t n)
 {
+    struct spi_port_slave_t *slave_p;
+    struct spi_device_t *dev_p;
+
+    dev_p = self_p->dev_p;
+
+    sys_lock();
+
+    dev_p->counters.transfers++;
+    dev_p->counters.bytes += n;
+
+    if (self_p->speed > 0) {
+        dev_p->counters.busy_ns += ((8000000000ULL * n) / self_p->speed);
+    }
+
+    sys_unlock();
+
+    slave_p = dev_p->slaves_p;
+
+    while (slave_p != NULL) {
+        if ((slave_p->ss_pin_p == self_p->ss.dev_p)
+            && (slave_p->ss_pin_p->value == 0)) {
+            return (slave_p->transfer(slave_p->arg_p, rxbuf_p, txbuf_p, n));
+        }
+
+        slave_p = slave_p->next_p;
+    }
+
     return (n);
 }
+
+int spi_port_device_add_slave(struct spi_device_t *dev_p,
+                              struct spi_port_slave_t *slave_p,
+                              const struct pin_device_t *ss_pin_p,
+                              spi_port_slave_transfer_t transfer,
+                              void *arg_p)
+{
+    ASSERTN(dev_p != NULL, EINVAL);
+    ASSERTN(slave_p != NULL, EINVAL);
+    ASSERTN(ss_pin_p != NULL, EINVAL);
+    ASSERTN(transfer != NULL, EINVAL);
+
+    slave_p->ss_pin_p = ss_pin_p;
+    slave_p->transfer = transfer;
+    slave_p->arg_p = arg_p;
+
+    sys_lock();
+    slave_p->next_p = dev_p->slaves_p;
+    dev_p->slaves_p = slave_p;
+    sys_unlock();
+
+    return (0);
+}
@@ -28,6 +28,8 @@
  * This file is part of the Simba project.
  */
 
+#include <errno.h>
+#include <unistd.h>
 #include "socket_device.h"
 
 static ssize_t uart_port_write_cb_isr(void *arg_p,
@@ -70,7 +72,7 @@ static ssize_t uart_port_write_cb_isr(void *arg_p,
 {
     struct uart_driver_t *self_p;
     struct uart_device_t *dev_p;
-    size_t i;
+    size_t left;
     const char *c_p;
     ssize_t res;
 
@@ -78,11 +80,26 @@ static ssize_t uart_port_write_cb_isr(void *arg_p,
     dev_p = self_p->dev_p;
 
     if (socket_device_is_uart_device_connected_isr(dev_p) == 0) {
+        /* Write the whole buffer with a single system call. Flush
+           stdout first as it may be written to by the panic
+           output. */
+        fflush(stdout);
         c_p = txbuf_p;
+        left = size;
 
-        for (i = 0; i < size; i++) {
-            putc(*c_p++, stdout);
-            fflush(stdout);
+        while (left > 0) {
+            res = write(STDOUT_FILENO, c_p, left);
+
+            if (res < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+
+                return (-errno);
+            }
+
+            c_p += res;
+            left -= res;
         }
 
         res = size;
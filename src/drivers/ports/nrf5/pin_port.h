@@ -82,4 +82,33 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (BIT(dev_p->pin));
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    return (dev_p->regs_p == other_p->regs_p);
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    /* Same polarity as pin_port_device_write_high() and
+       pin_port_device_write_low(). */
+    dev_p->regs_p->OUTCLR = high_mask;
+    dev_p->regs_p->OUTSET = low_mask;
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (0);
+}
+
 #endif
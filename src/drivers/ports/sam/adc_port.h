@@ -42,6 +42,7 @@ struct adc_device_t {
         struct adc_driver_t *head_p;
         struct adc_driver_t *tail_p;
     } jobs;
+    struct adc_stream_t *stream_p;
     struct {
         volatile struct sam_tc_t *regs_p;
         int channel;
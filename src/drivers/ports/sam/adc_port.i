@@ -60,11 +60,34 @@ static void stop_adc_hw(struct adc_driver_t *self_p)
     regs_p->IDR = (SAM_ADC_IDR_ENDRX);
 }
 
+/**
+ * The PDC has moved the next buffer into the current buffer
+ * registers. Set the buffer after it as next buffer, so there is no
+ * gap between the buffers.
+ */
+static void stream_isr(struct adc_device_t *dev_p)
+{
+    struct adc_stream_t *stream_p;
+    struct adc_stream_buffer_t *buffer_p;
+
+    stream_p = dev_p->stream_p;
+    stream_buffer_filled_isr(stream_p);
+    buffer_p = stream_get_buffer_isr(stream_p, stream_p->produced + 1);
+    dev_p->regs_p->PDC.RNPR = (uint32_t)buffer_p->samples_p;
+    dev_p->regs_p->PDC.RNCR = buffer_p->length;
+}
+
 ISR(adc)
 {
     struct adc_device_t *dev_p = &adc_device[0];
     struct adc_driver_t *self_p = dev_p->jobs.head_p;
 
+    if (dev_p->stream_p != NULL) {
+        stream_isr(dev_p);
+
+        return;
+    }
+
     /* Mark the job as finished. */
     self_p->state = STATE_FINISHED;
 
@@ -223,6 +246,56 @@ static int adc_port_async_wait(struct adc_driver_t *self_p)
     return (has_finished);
 }
 
+static int adc_port_stream_start(struct adc_driver_t *self_p,
+                                 struct adc_stream_t *stream_p)
+{
+    volatile struct sam_adc_t *regs_p;
+    struct adc_stream_buffer_t *buffer_p;
+    int res;
+
+    regs_p = self_p->dev_p->regs_p;
+    res = 0;
+
+    sys_lock();
+
+    if ((self_p->dev_p->jobs.head_p != NULL)
+        || (self_p->dev_p->stream_p != NULL)) {
+        res = -EBUSY;
+    } else {
+        self_p->dev_p->stream_p = stream_p;
+
+        /* Current and next buffers. */
+        buffer_p = stream_get_buffer_isr(stream_p, 0);
+        regs_p->PDC.RPR = (uint32_t)buffer_p->samples_p;
+        regs_p->PDC.RCR = buffer_p->length;
+        buffer_p = stream_get_buffer_isr(stream_p, 1);
+        regs_p->PDC.RNPR = (uint32_t)buffer_p->samples_p;
+        regs_p->PDC.RNCR = buffer_p->length;
+
+        regs_p->CHER = (1 << self_p->channel);
+        regs_p->IER = (SAM_ADC_IER_ENDRX);
+
+        /* Start the convertion. */
+        regs_p->CR = (SAM_ADC_CR_START);
+    }
+
+    sys_unlock();
+
+    return (res);
+}
+
+static int adc_port_stream_stop(struct adc_driver_t *self_p)
+{
+    sys_lock();
+    stop_adc_hw(self_p);
+    self_p->dev_p->regs_p->PDC.RNCR = 0;
+    self_p->dev_p->regs_p->PDC.RCR = 0;
+    self_p->dev_p->stream_p = NULL;
+    sys_unlock();
+
+    return (0);
+}
+
 int adc_port_convert_isr(struct adc_driver_t *self_p,
                          uint16_t *sample_p)
 {
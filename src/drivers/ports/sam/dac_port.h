@@ -40,6 +40,7 @@ struct dac_device_t {
         struct dac_driver_t *head_p;
         struct dac_driver_t *tail_p;
     } jobs;
+    struct dac_stream_t *stream_p;
     struct {
         volatile struct sam_tc_t *regs_p;
         int channel;
@@ -53,11 +53,76 @@ static void convert_stop(struct dac_driver_t *self_p)
     self_p->dev_p->regs_p->CHDR = self_p->chxr;
 }
 
+/**
+ * Hand written stream buffers to the PDC, first the current and
+ * then the next buffer. The end of transfer interrupt is only
+ * enabled if there is a next buffer, otherwise the stream waits for
+ * the buffer empty interrupt.
+ */
+static void stream_load(struct dac_device_t *dev_p)
+{
+    struct dac_stream_buffer_t *buffer_p;
+
+    if (dev_p->regs_p->PDC.TCR == 0) {
+        buffer_p = stream_load_isr(dev_p->stream_p);
+
+        if (buffer_p == NULL) {
+            return;
+        }
+
+        dev_p->regs_p->PDC.TPR = (uint32_t)buffer_p->samples_p;
+        dev_p->regs_p->PDC.TCR = buffer_p->length;
+        dev_p->regs_p->IER = SAM_DACC_IER_TXBUFE;
+    }
+
+    if (dev_p->regs_p->PDC.TNCR == 0) {
+        buffer_p = stream_load_isr(dev_p->stream_p);
+
+        if (buffer_p == NULL) {
+            dev_p->regs_p->IDR = SAM_DACC_IDR_ENDTX;
+
+            return;
+        }
+
+        dev_p->regs_p->PDC.TNPR = (uint32_t)buffer_p->samples_p;
+        dev_p->regs_p->PDC.TNCR = buffer_p->length;
+        dev_p->regs_p->IER = SAM_DACC_IER_ENDTX;
+    }
+}
+
+static void stream_isr(struct dac_device_t *dev_p)
+{
+    struct dac_stream_t *stream_p;
+
+    stream_p = dev_p->stream_p;
+
+    if ((dev_p->regs_p->ISR & SAM_DACC_ISR_TXBUFE) != 0) {
+        /* All loaded buffers have been converted. */
+        while (stream_p->consumed != stream_p->loaded) {
+            stream_buffer_done_isr(stream_p);
+        }
+
+        dev_p->regs_p->IDR = SAM_DACC_IDR_TXBUFE;
+    } else {
+        /* The current buffer has been converted and the PDC
+           continues with the next buffer. */
+        stream_buffer_done_isr(stream_p);
+    }
+
+    stream_load(dev_p);
+}
+
 ISR(dacc)
 {
     struct dac_device_t *dev_p = &dac_device[0];
     struct dac_driver_t *self_p = dev_p->jobs.head_p;
 
+    if (dev_p->stream_p != NULL) {
+        stream_isr(dev_p);
+
+        return;
+    }
+
     /* Add more samples to the PDC, if any. */
     if (self_p->next.length > 0) {
         write_next(self_p);
@@ -233,3 +298,53 @@ static int dac_port_convert(struct dac_driver_t *self_p,
 
     return (0);
 }
+
+static int dac_port_stream_start_isr(struct dac_driver_t *self_p,
+                                     struct dac_stream_t *stream_p)
+{
+    struct dac_device_t *dev_p;
+
+    dev_p = self_p->dev_p;
+
+    if ((dev_p->jobs.head_p != NULL) || (dev_p->stream_p != NULL)) {
+        return (-EBUSY);
+    }
+
+    dev_p->stream_p = stream_p;
+    dev_p->regs_p->PDC.TCR = 0;
+    dev_p->regs_p->PDC.TNCR = 0;
+    dev_p->regs_p->CHER = self_p->chxr;
+    stream_load(dev_p);
+
+    return (0);
+}
+
+static int dac_port_stream_stop_isr(struct dac_driver_t *self_p)
+{
+    struct dac_device_t *dev_p;
+
+    dev_p = self_p->dev_p;
+
+    if (dev_p->stream_p == NULL) {
+        return (-EINVAL);
+    }
+
+    dev_p->regs_p->IDR = (SAM_DACC_IDR_ENDTX | SAM_DACC_IDR_TXBUFE);
+    dev_p->regs_p->CHDR = self_p->chxr;
+    dev_p->regs_p->PDC.TCR = 0;
+    dev_p->regs_p->PDC.TNCR = 0;
+    dev_p->stream_p = NULL;
+
+    return (0);
+}
+
+static int dac_port_stream_write_isr(struct dac_driver_t *self_p)
+{
+    /* Buffers written before the stream is started are loaded on
+       start. */
+    if (self_p->dev_p->stream_p != NULL) {
+        stream_load(self_p->dev_p);
+    }
+
+    return (0);
+}
@@ -90,22 +90,40 @@ int i2c_port_stop(struct i2c_driver_t *self_p)
     return (0);
 }
 
-ssize_t i2c_port_read(struct i2c_driver_t *self_p,
-                      int address,
-                      void *buf_p,
-                      size_t size)
+/**
+ * Read from given slave. The internal address, if any, is written to
+ * the slave before the read, separated by a repeated start condition.
+ */
+static ssize_t master_read(struct i2c_driver_t *self_p,
+                           int address,
+                           const uint8_t *iadr_p,
+                           size_t iadr_size,
+                           void *buf_p,
+                           size_t size)
 {
     volatile struct sam_twi_t *regs_p;
     size_t i;
     uint8_t *u8_buf_p;
+    uint32_t iadr;
 
     u8_buf_p = buf_p;
     regs_p = self_p->dev_p->regs_p;
 
     /* Slave address and read command. */
     regs_p->MMR = (SAM_TWI_MMR_DADR(address)
+                   | SAM_TWI_MMR_IADRSZ(iadr_size)
                    | SAM_TWI_MMR_MREAD);
 
+    /* Internal address, most significant byte first. */
+    iadr = 0;
+
+    for (i = 0; i < iadr_size; i++) {
+        iadr <<= 8;
+        iadr |= iadr_p[i];
+    }
+
+    regs_p->IADR = iadr;
+
     /* Read from the slave into given buffer. */
     regs_p->CR = SAM_TWI_CR_START;
 
@@ -129,6 +147,14 @@ ssize_t i2c_port_read(struct i2c_driver_t *self_p,
     return (size);
 }
 
+ssize_t i2c_port_read(struct i2c_driver_t *self_p,
+                      int address,
+                      void *buf_p,
+                      size_t size)
+{
+    return (master_read(self_p, address, NULL, 0, buf_p, size));
+}
+
 ssize_t i2c_port_write(struct i2c_driver_t *self_p,
                        int address,
                        const void *buf_p,
@@ -173,6 +199,65 @@ ssize_t i2c_port_write(struct i2c_driver_t *self_p,
     return (res);
 }
 
+ssize_t i2c_port_transfer(struct i2c_driver_t *self_p,
+                          int address,
+                          struct i2c_message_t *messages_p,
+                          size_t number_of_messages)
+{
+    ssize_t res;
+    ssize_t size;
+    size_t i;
+
+    /* A register read, a write of up to three bytes followed by a
+       read, is performed with a repeated start by the hardware using
+       the internal address. */
+    if ((number_of_messages == 2)
+        && (messages_p[0].flags == I2C_MESSAGE_WRITE)
+        && (messages_p[0].size <= 3)
+        && (messages_p[1].flags == I2C_MESSAGE_READ)) {
+        res = master_read(self_p,
+                          address,
+                          messages_p[0].buf_p,
+                          messages_p[0].size,
+                          messages_p[1].buf_p,
+                          messages_p[1].size);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        return (messages_p[0].size + res);
+    }
+
+    /* Other transfers are sent with a stop condition after each
+       message. */
+    size = 0;
+
+    for (i = 0; i < number_of_messages; i++) {
+        if (messages_p[i].flags & I2C_MESSAGE_READ) {
+            res = master_read(self_p,
+                              address,
+                              NULL,
+                              0,
+                              messages_p[i].buf_p,
+                              messages_p[i].size);
+        } else {
+            res = i2c_port_write(self_p,
+                                 address,
+                                 messages_p[i].buf_p,
+                                 messages_p[i].size);
+        }
+
+        if (res < 0) {
+            return (res);
+        }
+
+        size += res;
+    }
+
+    return (size);
+}
+
 int i2c_port_scan(struct i2c_driver_t *self_p,
                   int address)
 {
@@ -71,4 +71,31 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (dev_p->mask);
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    return (dev_p->pio_p == other_p->pio_p);
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    dev_p->pio_p->SODR = high_mask;
+    dev_p->pio_p->CODR = low_mask;
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (dev_p->pio_p->PDSR & mask);
+}
+
 #endif
@@ -49,6 +49,7 @@ struct i2c_device_t {
 };
 
 struct i2c_driver_t {
+    struct i2c_device_t *dev_p;
     struct i2c_soft_driver_t soft;
 };
 
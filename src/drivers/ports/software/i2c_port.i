@@ -38,6 +38,8 @@ int i2c_port_init(struct i2c_driver_t *self_p,
                   int baudrate,
                   int address)
 {
+    self_p->dev_p = dev_p;
+
     return (i2c_soft_init(&self_p->soft,
                           dev_p->scl_p,
                           dev_p->sda_p,
@@ -72,6 +74,57 @@ ssize_t i2c_port_write(struct i2c_driver_t *self_p,
     return (i2c_soft_write(&self_p->soft, address, buf_p, size));
 }
 
+ssize_t i2c_port_transfer(struct i2c_driver_t *self_p,
+                          int address,
+                          struct i2c_message_t *messages_p,
+                          size_t number_of_messages)
+{
+    ssize_t res;
+    ssize_t size;
+    size_t i;
+
+    size = 0;
+
+    for (i = 0; i < number_of_messages; i++) {
+        /* A write followed by a read is separated by a repeated start
+           condition. */
+        if ((i + 1 < number_of_messages)
+            && (messages_p[i].flags == I2C_MESSAGE_WRITE)
+            && (messages_p[i + 1].flags == I2C_MESSAGE_READ)) {
+            res = i2c_soft_write_read(&self_p->soft,
+                                      address,
+                                      messages_p[i].buf_p,
+                                      messages_p[i].size,
+                                      messages_p[i + 1].buf_p,
+                                      messages_p[i + 1].size);
+
+            if (res >= 0) {
+                res += messages_p[i].size;
+            }
+
+            i++;
+        } else if (messages_p[i].flags & I2C_MESSAGE_READ) {
+            res = i2c_soft_read(&self_p->soft,
+                                address,
+                                messages_p[i].buf_p,
+                                messages_p[i].size);
+        } else {
+            res = i2c_soft_write(&self_p->soft,
+                                 address,
+                                 messages_p[i].buf_p,
+                                 messages_p[i].size);
+        }
+
+        if (res < 0) {
+            return (res);
+        }
+
+        size += res;
+    }
+
+    return (size);
+}
+
 int i2c_port_scan(struct i2c_driver_t *self_p,
                   int address)
 {
@@ -75,4 +75,35 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (1);
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    /* Each pin has its own data registers. */
+    return (dev_p == other_p);
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    if (high_mask != 0) {
+        SPC5_SIUL->GPDO[dev_p->id] = 1;
+    } else if (low_mask != 0) {
+        SPC5_SIUL->GPDO[dev_p->id] = 0;
+    }
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (SPC5_SIUL->GPDI[dev_p->id] & mask);
+}
+
 #endif
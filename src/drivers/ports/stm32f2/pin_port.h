@@ -73,4 +73,32 @@ static inline int pin_port_device_write_low(const struct pin_device_t *dev_p)
     return (0);
 }
 
+static inline uint32_t pin_port_device_mask(const struct pin_device_t *dev_p)
+{
+    return (1 << dev_p->bit);
+}
+
+static inline int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                               const struct pin_device_t *other_p)
+{
+    return (dev_p->regs_p == other_p->regs_p);
+}
+
+static inline int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                                             uint32_t high_mask,
+                                             uint32_t low_mask)
+{
+    /* Set and reset in a single write. Set wins if a pin is in both
+       masks. */
+    dev_p->regs_p->BSRR = ((low_mask << 16) | high_mask);
+
+    return (0);
+}
+
+static inline uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                                 uint32_t mask)
+{
+    return (dev_p->regs_p->IDR & mask);
+}
+
 #endif
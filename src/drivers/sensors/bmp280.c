@@ -128,23 +128,14 @@ static int transport_i2c_read(struct bmp280_driver_t *self_p,
 
     transport_p = (struct bmp280_transport_i2c_t *)self_p->transport_p;
 
-    res = i2c_write(transport_p->i2c_p,
-                    transport_p->i2c_address,
-                    &address,
-                    sizeof(address));
-
-    if (res != sizeof(address)) {
-        DLOG(ERROR,
-             "I2C address write failed with %d: %S.\r\n",
-             res,
-             errno_as_string(res));
-        return (-EIO);
-    }
-
-    res = i2c_read(transport_p->i2c_p,
-                   transport_p->i2c_address,
-                   buf_p,
-                   size);
+    /* Write the register address and read its data in a single
+       transfer. */
+    res = i2c_write_read(transport_p->i2c_p,
+                         transport_p->i2c_address,
+                         &address,
+                         sizeof(address),
+                         buf_p,
+                         size);
 
     if (res != size) {
         DLOG(ERROR,
@@ -512,17 +503,12 @@ int bmp280_read_fixed_point(struct bmp280_driver_t *self_p,
 {
     ASSERTN(self_p != NULL, EINVAL);
 
-    uint8_t buf[6];
     int res;
-    int32_t adc_t;
-    int32_t adc_p;
-    long temperature;
-    long pressure;
     int attempt;
 
     /* Start a measurement in forced mode if configured. */
     if (!is_normal_mode(self_p)) {
-        res = write_ctrl_meas(self_p);
+        res = bmp280_convert(self_p);
 
         if (res != 0) {
             return (res);
@@ -551,6 +537,36 @@ int bmp280_read_fixed_point(struct bmp280_driver_t *self_p,
         }
     }
 
+    return (bmp280_read_converted_fixed_point(self_p,
+                                              temperature_p,
+                                              pressure_p));
+}
+
+int bmp280_convert(struct bmp280_driver_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    /* Measurements are made continuously in normal mode. */
+    if (is_normal_mode(self_p)) {
+        return (0);
+    }
+
+    return (write_ctrl_meas(self_p));
+}
+
+int bmp280_read_converted_fixed_point(struct bmp280_driver_t *self_p,
+                                      long *temperature_p,
+                                      long *pressure_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    uint8_t buf[6];
+    int res;
+    int32_t adc_t;
+    int32_t adc_p;
+    long temperature;
+    long pressure;
+
     /* Read the pressure and temperature. */
     res = self_p->transport_p->protocol_p->read(self_p,
                                                 REG_PRESS_MSB,
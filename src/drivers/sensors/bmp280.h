@@ -227,6 +227,30 @@ int bmp280_read_fixed_point(struct bmp280_driver_t *self_p,
                             long *temperature_p,
                             long *pressure_p);
 
+/**
+ * Start a measurement in forced mode and return immediately. Does
+ * nothing in normal mode, where the device measures continuously.
+ *
+ * @param[in] self_p Driver object.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bmp280_convert(struct bmp280_driver_t *self_p);
+
+/**
+ * Read the most recently measured temperature and pressure from the
+ * device, without waiting for an ongoing measurement to complete.
+ *
+ * @param[in] self_p Driver object.
+ * @param[out] temperature_p Temperature in milli-Celsius, or NULL.
+ * @param[out] pressure_p Pressure in milli-Pascal, or NULL.
+ *
+ * @return zero(0) or negative error code.
+ */
+int bmp280_read_converted_fixed_point(struct bmp280_driver_t *self_p,
+                                      long *temperature_p,
+                                      long *pressure_p);
+
 /**
  * Initialize given I2C transport object.
  *
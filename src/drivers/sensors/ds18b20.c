@@ -176,6 +176,23 @@ int ds18b20_convert(struct ds18b20_driver_t *self_p)
 {
     ASSERTN(self_p != NULL, EINVAL);
 
+    int res;
+
+    res = ds18b20_convert_start(self_p);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    thrd_sleep_ms(DS18B20_CONVERSION_TIME_MS);
+
+    return (0);
+}
+
+int ds18b20_convert_start(struct ds18b20_driver_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
     uint8_t b;
 
     owi_reset(self_p->owi_p);
@@ -183,7 +200,6 @@ int ds18b20_convert(struct ds18b20_driver_t *self_p)
     owi_write(self_p->owi_p, &b, 8);
     b = CONVERT_T;
     owi_write(self_p->owi_p, &b, 8);
-    thrd_sleep_ms(750);
 
     return (0);
 }
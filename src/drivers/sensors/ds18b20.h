@@ -36,6 +36,9 @@
 /* DS18B20 one wire family code. */
 #define DS18B20_FAMILY_CODE 0x28
 
+/* Maximum temperature convertion time with 12 bits resolution. */
+#define DS18B20_CONVERSION_TIME_MS 750
+
 struct ds18b20_driver_t {
     struct owi_driver_t *owi_p;
     struct ds18b20_driver_t *next_p;
@@ -74,6 +77,18 @@ int ds18b20_init(struct ds18b20_driver_t *self_p,
  */
 int ds18b20_convert(struct ds18b20_driver_t *self_p);
 
+/**
+ * Start a temperature convertion on all sensors and return
+ * immediately. The converted temperature can be read with
+ * ``ds18b20_read*()`` ``DS18B20_CONVERSION_TIME_MS`` milliseconds
+ * later.
+ *
+ * @param[in] self_p Initialized driver object.
+ *
+ * @return zero(0) or negative error code.
+ */
+int ds18b20_convert_start(struct ds18b20_driver_t *self_p);
+
 /**
  * Read the most recently converted temperature from given sensor.
  *
@@ -0,0 +1,319 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#if CONFIG_SENSOR_HUB == 1
+
+/* Sensor states. */
+#define SENSOR_STATE_IDLE                                   0
+#define SENSOR_STATE_CONVERTING                             1
+
+struct module_t {
+    int8_t initialized;
+};
+
+static struct module_t module;
+
+static void time_from_ms(struct time_t *time_p, int ms)
+{
+    time_p->seconds = (ms / 1000);
+    time_p->nanoseconds = (1000000L * (ms % 1000));
+}
+
+static int is_due(struct time_t *deadline_p, struct time_t *now_p)
+{
+    return (time_compare(deadline_p, now_p) != time_compare_greater_than_t);
+}
+
+static void publish(struct sensor_hub_t *self_p,
+                    struct sensor_hub_sensor_t *sensor_p,
+                    struct sensor_hub_sample_t *sample_p,
+                    int res)
+{
+    size_t size;
+
+    sample_p->id = sensor_p->id;
+    sample_p->timestamp = sensor_p->timestamp;
+    size = offsetof(struct sensor_hub_sample_t, data);
+
+    if (res < 0) {
+        sample_p->res = res;
+        sensor_p->counters.errors++;
+    } else {
+        sample_p->res = 0;
+        size += res;
+        sensor_p->counters.samples++;
+    }
+
+    bus_write(self_p->bus_p, sensor_p->id, sample_p, size);
+}
+
+/**
+ * Start a conversion in given sensor and schedule the next one.
+ */
+static void sensor_convert(struct sensor_hub_t *self_p,
+                           struct sensor_hub_sensor_t *sensor_p,
+                           struct time_t *now_p)
+{
+    struct sensor_hub_sample_t sample;
+    int res;
+
+    sensor_p->timestamp = *now_p;
+    time_add(&sensor_p->next_convert,
+             &sensor_p->next_convert,
+             &sensor_p->period);
+
+    /* Skip missed conversions if the sensor cannot keep up with its
+       period. */
+    if (time_compare(&sensor_p->next_convert,
+                     now_p) == time_compare_less_than_t) {
+        sensor_p->next_convert = *now_p;
+
+        if ((sensor_p->period.seconds != 0)
+            || (sensor_p->period.nanoseconds != 0)) {
+            sensor_p->counters.overruns++;
+        }
+    }
+
+    if (sensor_p->convert != NULL) {
+        res = sensor_p->convert(sensor_p->arg_p);
+
+        if (res != 0) {
+            publish(self_p, sensor_p, &sample, res);
+
+            return;
+        }
+    }
+
+    time_add(&sensor_p->ready, now_p, &sensor_p->latency);
+    sensor_p->state = SENSOR_STATE_CONVERTING;
+}
+
+/**
+ * Read the converted sample from given sensor and publish it.
+ */
+static void sensor_read(struct sensor_hub_t *self_p,
+                        struct sensor_hub_sensor_t *sensor_p)
+{
+    struct sensor_hub_sample_t sample;
+    ssize_t res;
+
+    res = sensor_p->read(sensor_p->arg_p,
+                         &sample.data[0],
+                         sizeof(sample.data));
+    publish(self_p, sensor_p, &sample, res);
+    sensor_p->state = SENSOR_STATE_IDLE;
+}
+
+/**
+ * Start and read conversions that are due.
+ *
+ * @return The earliest deadline of all sensors, or NULL if there are
+ *         no sensors.
+ */
+static struct time_t *process(struct sensor_hub_t *self_p)
+{
+    struct sensor_hub_sensor_t *sensor_p;
+    struct time_t *deadline_p;
+    struct time_t *sensor_deadline_p;
+    struct time_t now;
+
+    sys_lock();
+    sensor_p = self_p->sensors_p;
+    sys_unlock();
+
+    deadline_p = NULL;
+
+    while (sensor_p != NULL) {
+        time_get(&now);
+
+        if ((sensor_p->state == SENSOR_STATE_CONVERTING)
+            && is_due(&sensor_p->ready, &now)) {
+            sensor_read(self_p, sensor_p);
+            time_get(&now);
+        }
+
+        if ((sensor_p->state == SENSOR_STATE_IDLE)
+            && is_due(&sensor_p->next_convert, &now)) {
+            sensor_convert(self_p, sensor_p, &now);
+        }
+
+        if (sensor_p->state == SENSOR_STATE_CONVERTING) {
+            sensor_deadline_p = &sensor_p->ready;
+        } else {
+            sensor_deadline_p = &sensor_p->next_convert;
+        }
+
+        if ((deadline_p == NULL)
+            || (time_compare(sensor_deadline_p,
+                             deadline_p) == time_compare_less_than_t)) {
+            deadline_p = sensor_deadline_p;
+        }
+
+        sys_lock();
+        sensor_p = sensor_p->next_p;
+        sys_unlock();
+    }
+
+    return (deadline_p);
+}
+
+int sensor_hub_module_init()
+{
+    /* Return immediately if the module is already initialized. */
+    if (module.initialized == 1) {
+        return (0);
+    }
+
+    module.initialized = 1;
+
+    return (bus_module_init());
+}
+
+int sensor_hub_init(struct sensor_hub_t *self_p,
+                    struct bus_t *bus_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(bus_p != NULL, EINVAL);
+
+    self_p->bus_p = bus_p;
+    self_p->sensors_p = NULL;
+    self_p->tail_p = NULL;
+    self_p->thrd_p = NULL;
+    self_p->is_waiting = 0;
+
+    return (0);
+}
+
+int sensor_hub_sensor_init(struct sensor_hub_sensor_t *self_p,
+                           int id,
+                           sensor_hub_convert_t convert,
+                           sensor_hub_read_t read,
+                           void *arg_p,
+                           int latency_ms,
+                           int period_ms)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(read != NULL, EINVAL);
+    ASSERTN(latency_ms >= 0, EINVAL);
+    ASSERTN(period_ms >= 0, EINVAL);
+
+    self_p->id = id;
+    self_p->convert = convert;
+    self_p->read = read;
+    self_p->arg_p = arg_p;
+    time_from_ms(&self_p->latency, latency_ms);
+    time_from_ms(&self_p->period, period_ms);
+    self_p->state = SENSOR_STATE_IDLE;
+    self_p->counters.samples = 0;
+    self_p->counters.errors = 0;
+    self_p->counters.overruns = 0;
+    self_p->next_p = NULL;
+
+    return (0);
+}
+
+int sensor_hub_add(struct sensor_hub_t *self_p,
+                   struct sensor_hub_sensor_t *sensor_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(sensor_p != NULL, EINVAL);
+
+    time_get(&sensor_p->next_convert);
+    sensor_p->state = SENSOR_STATE_IDLE;
+    sensor_p->next_p = NULL;
+
+    sys_lock();
+
+    /* Sensors are processed in the order they were added. */
+    if (self_p->sensors_p == NULL) {
+        self_p->sensors_p = sensor_p;
+    } else {
+        self_p->tail_p->next_p = sensor_p;
+    }
+
+    self_p->tail_p = sensor_p;
+
+    if (self_p->is_waiting == 1) {
+        self_p->is_waiting = 0;
+        thrd_resume_isr(self_p->thrd_p, 0);
+    }
+
+    sys_unlock();
+
+    return (0);
+}
+
+void *sensor_hub_main(void *arg_p)
+{
+    struct sensor_hub_t *self_p;
+    struct time_t *deadline_p;
+    struct time_t timeout;
+    struct time_t now;
+
+    self_p = arg_p;
+
+    thrd_set_name("sensor_hub");
+
+    sys_lock();
+    self_p->thrd_p = thrd_self();
+    sys_unlock();
+
+    while (1) {
+        deadline_p = process(self_p);
+
+        /* Sleep until the next conversion shall be started or read. */
+        if (deadline_p != NULL) {
+            time_get(&now);
+
+            if (is_due(deadline_p, &now)) {
+                continue;
+            }
+
+            time_subtract(&timeout, deadline_p, &now);
+        }
+
+        sys_lock();
+
+        /* Sensors may have been added while processing. */
+        if ((deadline_p != NULL) || (self_p->sensors_p == NULL)) {
+            self_p->is_waiting = 1;
+            thrd_suspend_isr(deadline_p != NULL ? &timeout : NULL);
+            self_p->is_waiting = 0;
+        }
+
+        sys_unlock();
+    }
+
+    return (NULL);
+}
+
+#endif
@@ -0,0 +1,170 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2017-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#ifndef __DRIVERS_SENSOR_HUB_H__
+#define __DRIVERS_SENSOR_HUB_H__
+
+#include "simba.h"
+
+/**
+ * Start a conversion in a sensor and return immediately.
+ *
+ * @param[in] arg_p Sensor argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+typedef int (*sensor_hub_convert_t)(void *arg_p);
+
+/**
+ * Read the result of a completed conversion from a sensor.
+ *
+ * @param[in] arg_p Sensor argument.
+ * @param[out] buf_p Buffer to read the sample into.
+ * @param[in] size Buffer size.
+ *
+ * @return Sample size in bytes or negative error code.
+ */
+typedef ssize_t (*sensor_hub_read_t)(void *arg_p,
+                                     void *buf_p,
+                                     size_t size);
+
+/**
+ * A sample published on the bus with the sensor id as message id.
+ */
+struct sensor_hub_sample_t {
+    /** Sensor id. */
+    int id;
+    /** Time when the conversion was started. */
+    struct time_t timestamp;
+    /** Zero(0) or negative error code. */
+    int res;
+    /** Sample data read from the sensor. */
+    uint8_t data[CONFIG_SENSOR_HUB_SAMPLE_SIZE_MAX];
+};
+
+struct sensor_hub_sensor_t {
+    int id;
+    sensor_hub_convert_t convert;
+    sensor_hub_read_t read;
+    void *arg_p;
+    struct time_t latency;
+    struct time_t period;
+    int state;
+    struct time_t timestamp;
+    struct time_t next_convert;
+    struct time_t ready;
+    struct {
+        uint32_t samples;
+        uint32_t errors;
+        uint32_t overruns;
+    } counters;
+    struct sensor_hub_sensor_t *next_p;
+};
+
+struct sensor_hub_t {
+    struct bus_t *bus_p;
+    struct sensor_hub_sensor_t *sensors_p;
+    struct sensor_hub_sensor_t *tail_p;
+    struct thrd_t *thrd_p;
+    int is_waiting;
+};
+
+/**
+ * Initialize the sensor hub module. This function must be called
+ * before calling any other function in this module.
+ *
+ * The module will only be initialized once even if this function is
+ * called multiple times.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sensor_hub_module_init(void);
+
+/**
+ * Initialize given sensor hub. Samples are published on given bus.
+ *
+ * @param[out] self_p Sensor hub to initialize.
+ * @param[in] bus_p Bus to publish samples on.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sensor_hub_init(struct sensor_hub_t *self_p,
+                    struct bus_t *bus_p);
+
+/**
+ * Initialize given sensor.
+ *
+ * @param[out] self_p Sensor to initialize.
+ * @param[in] id Sensor id, used as message id on the bus.
+ * @param[in] convert Start conversion function, or NULL if the sensor
+ *                    converts continuously.
+ * @param[in] read Read function.
+ * @param[in] arg_p Argument passed to the convert and read
+ *                  functions.
+ * @param[in] latency_ms Conversion time in milliseconds.
+ * @param[in] period_ms Sampling period in milliseconds. Zero(0) to
+ *                      start a new conversion as soon as the
+ *                      previous sample has been read.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sensor_hub_sensor_init(struct sensor_hub_sensor_t *self_p,
+                           int id,
+                           sensor_hub_convert_t convert,
+                           sensor_hub_read_t read,
+                           void *arg_p,
+                           int latency_ms,
+                           int period_ms);
+
+/**
+ * Add given sensor to given sensor hub. The first conversion is
+ * started immediately.
+ *
+ * @param[in] self_p Sensor hub.
+ * @param[in] sensor_p Initialized sensor to add.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sensor_hub_add(struct sensor_hub_t *self_p,
+                   struct sensor_hub_sensor_t *sensor_p);
+
+/**
+ * The sensor hub thread entry function. Conversions are started in
+ * all sensors, and each sensor is read when its conversion time has
+ * elapsed, so the conversion times overlap. Spawn a thread running
+ * this function after the sensor hub has been initialized.
+ *
+ * @param[in] arg_p Initialized sensor hub.
+ *
+ * @return Never returns.
+ */
+void *sensor_hub_main(void *arg_p);
+
+#endif
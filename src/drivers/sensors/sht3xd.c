@@ -237,7 +237,6 @@ int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
     ASSERTN(self_p != NULL, EINVAL);
 
     int res;
-    uint8_t data[6];
 
     /*
      * We use a non-clockstreching command followed by a sleep and
@@ -245,7 +244,7 @@ int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
      * long sleep (probably a bit more power efficient), and to not
      * block the I2C bus while sensor is active - in case it's shared.
      */
-    res = sht3xd_sendcmd(self_p, CMD_SINGLE_NOCLKSTRETCH_REPHIGH);
+    res = sht3xd_measure_start(self_p);
 
     if (res != 0) {
         return (res);
@@ -254,6 +253,18 @@ int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
     /* We use max duration to avoid having to handle retry. */
     thrd_sleep_ms(MEASUREMENT_DURATION_HIGH_MS);
 
+    return (sht3xd_measure_read(self_p, temp_p, humid_p));
+}
+
+int sht3xd_measure_read(struct sht3xd_driver_t *self_p,
+                        float *temp_p,
+                        float *humid_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    int res;
+    uint8_t data[6];
+
     res = sht3xd_read2x16(self_p, data);
 
     if (res != 0) {
@@ -273,6 +284,13 @@ int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
 
 #endif
 
+int sht3xd_measure_start(struct sht3xd_driver_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (sht3xd_sendcmd(self_p, CMD_SINGLE_NOCLKSTRETCH_REPHIGH));
+}
+
 int sht3xd_get_serial(struct sht3xd_driver_t *self_p,
                       uint32_t *serial_p)
 {
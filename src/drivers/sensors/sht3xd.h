@@ -103,6 +103,31 @@ int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
                           float *temp_p,
                           float *humid_p);
 
+/**
+ * Start a measurement and return immediately. Read the result with
+ * ``sht3xd_measure_read()`` ``MEASUREMENT_DURATION_HIGH_MS``
+ * milliseconds later.
+ *
+ * @param[in] self_p Driver object.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sht3xd_measure_start(struct sht3xd_driver_t *self_p);
+
+/**
+ * Read the result of a measurement started with
+ * ``sht3xd_measure_start()``.
+ *
+ * @param[in] self_p Driver object.
+ * @param[out] temp_p Tempererature in Celsius, or NULL.
+ * @param[out] humid_p Relative Humidity, or NULL.
+ *
+ * @return zero(0) or negative error code.
+ */
+int sht3xd_measure_read(struct sht3xd_driver_t *self_p,
+                        float *temp_p,
+                        float *humid_p);
+
 /**
  * Get the serial number from the SHD3x-D.
  *
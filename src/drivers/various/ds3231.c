@@ -89,17 +89,12 @@ int ds3231_get_date(struct ds3231_driver_t *self_p,
 
     address = 0x0;
 
-    if (i2c_write(self_p->i2c_p,
-                  DS3231_I2C_ADDRESS,
-                  &address,
-                  sizeof(address)) != sizeof(address)) {
-        return (-1);
-    }
-
-    if (i2c_read(self_p->i2c_p,
-                 DS3231_I2C_ADDRESS,
-                 date,
-                 sizeof(date)) != sizeof(date)) {
+    if (i2c_write_read(self_p->i2c_p,
+                       DS3231_I2C_ADDRESS,
+                       &address,
+                       sizeof(address),
+                       date,
+                       sizeof(date)) != sizeof(date)) {
         return (-1);
     }
 
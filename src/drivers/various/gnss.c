@@ -37,6 +37,12 @@
 #    define DLOG(level, msg, ...)
 #endif
 
+#define UBX_SYNC_CHAR_1                                  0xb5
+#define UBX_SYNC_CHAR_2                                  0x62
+
+#define FRAME_TYPE_NMEA                                     0
+#define FRAME_TYPE_UBX                                      1
+
 static int get_data_age(struct time_t *timestamp_p)
 {
     struct time_t uptime;
@@ -51,46 +57,121 @@ static int get_data_age(struct time_t *timestamp_p)
 }
 
 /**
- * Read a single byte from the transport channel.
+ * Read available bytes from the transport channel into the receive
+ * buffer. Blocks until at least one byte is available.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int fill_rx_buffer(struct gnss_driver_t *self_p)
+{
+    ssize_t res;
+    size_t size;
+
+    size = chan_size(self_p->chin_p);
+
+    if (size == 0) {
+        size = 1;
+    } else if (size > sizeof(self_p->rx.buf)) {
+        size = sizeof(self_p->rx.buf);
+    }
+
+    res = chan_read(self_p->chin_p, &self_p->rx.buf[0], size);
+
+    if (res <= 0) {
+        return (res == 0 ? -EIO : res);
+    }
+
+    self_p->rx.pos = 0;
+    self_p->rx.size = res;
+
+    return (0);
+}
+
+/**
+ * Read a single byte from the receive buffer, refilling it from the
+ * transport channel when empty.
  *
  * @return zero(0) or negative error code.
  */
 static int read_byte(struct gnss_driver_t *self_p,
-                     char *byte_p)
+                     uint8_t *byte_p)
 {
     int res;
 
-    res = chan_read(self_p->chin_p,
-                    byte_p,
-                    sizeof(*byte_p));
+    if (self_p->rx.pos == self_p->rx.size) {
+        res = fill_rx_buffer(self_p);
 
-    if (res == 0) {
-        res = -EIO;
+        if (res != 0) {
+            return (res);
+        }
     }
 
-    return (res);
+    *byte_p = self_p->rx.buf[self_p->rx.pos++];
+
+    return (0);
 }
 
 /**
- * Find the start of an NMEA sentence (dollar sign).
+ * Find the start of an NMEA sentence (dollar sign) or an UBX frame
+ * (sync characters).
+ *
+ * @return Type of found frame or negative error code.
  */
-static int find_sentence_start(struct gnss_driver_t *self_p)
+static int find_frame_start(struct gnss_driver_t *self_p)
 {
     int res;
-    char byte;
+    uint8_t *begin_p;
+    uint8_t *dollar_p;
+    uint8_t *sync_p;
+    size_t size;
+    uint8_t byte;
 
     while (1) {
-        res = read_byte(self_p, &byte);
+        if (self_p->rx.pos == self_p->rx.size) {
+            res = fill_rx_buffer(self_p);
 
-        if (res != sizeof(byte)) {
-            return (res);
+            if (res != 0) {
+                return (res);
+            }
         }
 
-        if (byte == '$') {
+        begin_p = &self_p->rx.buf[self_p->rx.pos];
+        size = (self_p->rx.size - self_p->rx.pos);
+        dollar_p = memchr(begin_p, '$', size);
+
+        /* Only an UBX frame before the sentence start is of
+           interest. */
+        if (dollar_p != NULL) {
+            size = (dollar_p - begin_p);
+        }
+
+        sync_p = memchr(begin_p, UBX_SYNC_CHAR_1, size);
+
+        if (sync_p != NULL) {
+            self_p->rx.pos = (sync_p - &self_p->rx.buf[0] + 1);
+            res = read_byte(self_p, &byte);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            if (byte == UBX_SYNC_CHAR_2) {
+                DLOG(DEBUG, "UBX frame start found.\r\n");
+
+                return (FRAME_TYPE_UBX);
+            }
+
+            /* Not an UBX frame. The read byte may start a frame. */
+            self_p->rx.pos--;
+        } else if (dollar_p != NULL) {
+            self_p->rx.pos = (dollar_p - &self_p->rx.buf[0] + 1);
             self_p->nmea.input.buf[0] = '$';
             self_p->nmea.input.size = 1;
             DLOG(DEBUG, "NMEA sentence start found.\r\n");
-            break;
+
+            return (FRAME_TYPE_NMEA);
+        } else {
+            self_p->rx.pos = self_p->rx.size;
         }
     }
 
@@ -103,25 +184,43 @@ static int find_sentence_start(struct gnss_driver_t *self_p)
 static int read_until_sentence_end(struct gnss_driver_t *self_p)
 {
     int res;
-    char byte;
+    uint8_t *begin_p;
+    uint8_t *end_p;
+    size_t size;
 
     while (1) {
-        res = read_byte(self_p, &byte);
+        if (self_p->rx.pos == self_p->rx.size) {
+            res = fill_rx_buffer(self_p);
 
-        if (res != sizeof(byte)) {
-            return (res);
+            if (res != 0) {
+                return (res);
+            }
         }
 
-        /* Space for the read character and a null-termination. */
-        if ((self_p->nmea.input.size + 1) == sizeof(self_p->nmea.input.buf)) {
+        begin_p = &self_p->rx.buf[self_p->rx.pos];
+        size = (self_p->rx.size - self_p->rx.pos);
+        end_p = memchr(begin_p, '\n', size);
+
+        if (end_p != NULL) {
+            size = (end_p - begin_p + 1);
+        }
+
+        self_p->rx.pos += size;
+
+        /* Space for the read characters and a null-termination. */
+        if ((self_p->nmea.input.size + size)
+            >= sizeof(self_p->nmea.input.buf)) {
             self_p->nmea.input.size = 0;
+
             return (-ENOMEM);
         }
 
-        self_p->nmea.input.buf[self_p->nmea.input.size] = byte;
-        self_p->nmea.input.size++;
+        memcpy(&self_p->nmea.input.buf[self_p->nmea.input.size],
+               begin_p,
+               size);
+        self_p->nmea.input.size += size;
 
-        if (byte == '\n') {
+        if (end_p != NULL) {
             self_p->nmea.input.buf[self_p->nmea.input.size] = '\0';
             break;
         }
@@ -130,6 +229,98 @@ static int read_until_sentence_end(struct gnss_driver_t *self_p)
     return (0);
 }
 
+/**
+ * Write given UBX frame data to the UBX channel, if any.
+ */
+static int write_ubx(struct gnss_driver_t *self_p,
+                     const void *buf_p,
+                     size_t size)
+{
+    if (self_p->ubx.chout_p == NULL) {
+        return (0);
+    }
+
+    if (chan_write(self_p->ubx.chout_p, buf_p, size) != size) {
+        return (-EIO);
+    }
+
+    return (0);
+}
+
+/**
+ * Pass the rest of the UBX frame through to the UBX channel. The sync
+ * characters are already read.
+ */
+static int read_ubx_frame(struct gnss_driver_t *self_p)
+{
+    int res;
+    uint8_t header[6];
+    size_t left;
+    size_t size;
+    int i;
+
+    header[0] = UBX_SYNC_CHAR_1;
+    header[1] = UBX_SYNC_CHAR_2;
+
+    /* Class, id and length. */
+    for (i = 2; i < sizeof(header); i++) {
+        res = read_byte(self_p, &header[i]);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    left = (((size_t)header[5] << 8) | header[4]);
+
+    /* A too long frame is most likely a false frame start. Look for
+       the next frame from the byte after the sync characters. */
+    if (left > CONFIG_GNSS_UBX_PAYLOAD_SIZE_MAX) {
+        self_p->rx.pos -= MIN(sizeof(header) - 2, self_p->rx.pos);
+        DLOG(WARNING,
+             "UBX frame payload of %u bytes is too long.\r\n",
+             (unsigned int)left);
+
+        return (-EPROTO);
+    }
+
+    res = write_ubx(self_p, &header[0], sizeof(header));
+
+    if (res != 0) {
+        return (res);
+    }
+
+    /* Payload and checksum. */
+    left += 2;
+
+    while (left > 0) {
+        if (self_p->rx.pos == self_p->rx.size) {
+            res = fill_rx_buffer(self_p);
+
+            if (res != 0) {
+                return (res);
+            }
+        }
+
+        size = MIN(left, self_p->rx.size - self_p->rx.pos);
+        res = write_ubx(self_p, &self_p->rx.buf[self_p->rx.pos], size);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        self_p->rx.pos += size;
+        left -= size;
+    }
+
+    DLOG(DEBUG,
+         "UBX frame of class 0x%02x and id 0x%02x read.\r\n",
+         header[2],
+         header[3]);
+
+    return (0);
+}
+
 /**
  * Process given NMEA GGA sentence.
  */
@@ -302,8 +493,9 @@ static int process_sentence(struct gnss_driver_t *self_p)
 
     default:
         DLOG(INFO,
-             "Discarding NMEA sentence of type %d.\r\n",
-             self_p->nmea.decoded.type);
+             "Discarding NMEA sentence of type %d from talker %d.\r\n",
+             self_p->nmea.decoded.type,
+             self_p->nmea.decoded.talker);
         break;
     }
 
@@ -333,6 +525,9 @@ int gnss_init(struct gnss_driver_t *self_p,
     self_p->gga_timestamp.seconds = -1;
     self_p->position.timestamp_p = &self_p->rmc_timestamp;
     self_p->nmea.input.size = 0;
+    self_p->rx.pos = 0;
+    self_p->rx.size = 0;
+    self_p->ubx.chout_p = NULL;
 
 #if CONFIG_GNSS_DEBUG_LOG_MASK > -1
     log_object_init(&self_p->log, "gnss", CONFIG_GNSS_DEBUG_LOG_MASK);
@@ -341,18 +536,32 @@ int gnss_init(struct gnss_driver_t *self_p,
     return (0);
 }
 
+int gnss_set_ubx_output(struct gnss_driver_t *self_p,
+                        void *chan_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->ubx.chout_p = chan_p;
+
+    return (0);
+}
+
 int gnss_read(struct gnss_driver_t *self_p)
 {
     int res;
 
-    /* Find the beginning of an NMEA sentence if the sentence buffer
-       is empty. */
+    /* Find the beginning of an NMEA sentence or an UBX frame if the
+       sentence buffer is empty. */
     if (self_p->nmea.input.size == 0) {
-        res = find_sentence_start(self_p);
+        res = find_frame_start(self_p);
 
-        if (res != 0) {
+        if (res < 0) {
             return (res);
         }
+
+        if (res == FRAME_TYPE_UBX) {
+            return (read_ubx_frame(self_p));
+        }
     }
 
     /* Read the rest of the sentence. */
@@ -54,6 +54,14 @@ struct gnss_driver_t {
         } input;
         struct nmea_sentence_t decoded;
     } nmea;
+    struct {
+        uint8_t buf[CONFIG_GNSS_RX_BUFFER_SIZE];
+        size_t pos;
+        size_t size;
+    } rx;
+    struct {
+        void *chout_p;
+    } ubx;
 #if CONFIG_GNSS_DEBUG_LOG_MASK > -1
     struct log_object_t log;
 #endif
@@ -83,17 +91,43 @@ int gnss_init(struct gnss_driver_t *self_p,
               void *chin_p,
               void *chout_p);
 
+/**
+ * Set the channel binary UBX frames read from the transport channel
+ * are written to. UBX frames are written as they are, including sync
+ * characters and checksum. UBX frames are discarded if no channel is
+ * set, which is the default.
+ *
+ * @param[in] self_p Initialized driver object.
+ * @param[in] chan_p UBX output channel, or NULL to discard UBX frames.
+ *
+ * @return zero(0) or negative error code.
+ */
+int gnss_set_ubx_output(struct gnss_driver_t *self_p,
+                        void *chan_p);
+
 /**
  * Update the GNSS driver state by reading and parsing a NMEA sentence
- * from the transport channel.
+ * from the transport channel, or read an UBX frame and write it to
+ * the UBX output channel. RMC and GGA sentences from all talkers,
+ * for example GPS (GP), GLONASS (GL), Galileo (GA) and combined (GN),
+ * update the driver state.
+ *
+ * Available bytes are read from the transport channel in chunks into
+ * a receive buffer. Bytes after the read sentence are kept in the
+ * buffer for the next call.
+ *
+ * UBX frames with a payload longer than
+ * ``CONFIG_GNSS_UBX_PAYLOAD_SIZE_MAX`` bytes are rejected with
+ * -EPROTO, and the next call looks for a frame in the bytes after
+ * the sync characters.
  *
  * NOTE: NMEA sentences will be lost if this function is called too
  *       seldom (due to transport channel input overrun).
  *
  * @param[in] self_p Initialized driver object.
  *
- * @return zero(0) if an NEMA sentence was read, otherwise negative
- *         error code.
+ * @return zero(0) if an NEMA sentence or an UBX frame was read,
+ *         otherwise negative error code.
  */
 int gnss_read(struct gnss_driver_t *self_p);
 
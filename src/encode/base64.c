@@ -30,43 +30,195 @@
 
 #include "simba.h"
 
+/* Decode table values that are not indices. */
+#define INVALID                                            -1
+#define PADDING                                            -2
+
+static FAR const char alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static FAR const char url_alphabet[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+
+/* Encoded character to index, for 7 bit characters. */
+static FAR const int8_t decode_table[128] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -2, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1
+};
+
+static FAR const int8_t url_decode_table[128] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -2, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, 63,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1
+};
+
+/**
+ * Encode three bytes into four characters.
+ */
+static void encode_group(char *dst_p,
+                         const uint8_t *src_p,
+                         FAR const char *alphabet_p)
+{
+    uint32_t value;
+
+    value = ((src_p[0] << 16) | (src_p[1] << 8) | src_p[2]);
+    dst_p[0] = alphabet_p[value >> 18];
+    dst_p[1] = alphabet_p[(value >> 12) & 0x3f];
+    dst_p[2] = alphabet_p[(value >> 6) & 0x3f];
+    dst_p[3] = alphabet_p[value & 0x3f];
+}
+
+/**
+ * Encode the last one or two bytes, with padding.
+ */
+static void encode_tail(char *dst_p,
+                        const uint8_t *src_p,
+                        size_t size,
+                        FAR const char *alphabet_p)
+{
+    uint8_t buf[3];
+
+    buf[0] = src_p[0];
+    buf[1] = (size == 2 ? src_p[1] : 0);
+    buf[2] = 0;
+    encode_group(dst_p, &buf[0], alphabet_p);
+    dst_p[3] = '=';
+
+    if (size == 1) {
+        dst_p[2] = '=';
+    }
+}
+
+static int encode(char *dst_p,
+                  const void *src_p,
+                  size_t size,
+                  FAR const char *alphabet_p)
+{
+    const uint8_t *s_p;
+
+    s_p = src_p;
+
+    while (size >= 3) {
+        encode_group(dst_p, s_p, alphabet_p);
+        s_p += 3;
+        dst_p += 4;
+        size -= 3;
+    }
+
+    if (size > 0) {
+        encode_tail(dst_p, s_p, size, alphabet_p);
+    }
+
+    return (0);
+}
+
 /**
- * Index must be a number 0-64.
+ * Decode four characters. Returns the number of decoded bytes, which
+ * is less than three if the group is padded, or -1 on invalid input.
  */
-static char index_to_encoded(int index)
+static int decode_group(uint8_t *dst_p,
+                        const char *src_p,
+                        FAR const int8_t *table_p)
 {
-    if ((index >= 0) && (index <= 25)) {
-        return ('A' + index - 0);
-    } else if ((index >= 26) && (index <= 51)) {
-        return ('a' + index - 26);
-    } else if ((index >= 52) && (index <= 61)) {
-        return ('0' + index - 52);
-    } else if (index == 62) {
-        return ('+');
-    } else if (index == 63) {
-        return ('/');
+    int8_t index[4];
+    uint32_t value;
+    int size;
+
+    /* The tables only cover 7 bit characters. */
+    if (((src_p[0] | src_p[1] | src_p[2] | src_p[3]) & 0x80) != 0) {
+        return (-1);
+    }
+
+    index[0] = table_p[(uint8_t)src_p[0]];
+    index[1] = table_p[(uint8_t)src_p[1]];
+    index[2] = table_p[(uint8_t)src_p[2]];
+    index[3] = table_p[(uint8_t)src_p[3]];
+
+    if ((index[0] | index[1] | index[2] | index[3]) >= 0) {
+        value = (((uint32_t)index[0] << 18)
+                 | ((uint32_t)index[1] << 12)
+                 | (index[2] << 6)
+                 | index[3]);
+        dst_p[0] = (value >> 16);
+        dst_p[1] = (value >> 8);
+        dst_p[2] = value;
+
+        return (3);
+    }
+
+    /* Padding is only allowed in the last two positions. */
+    if ((index[0] < 0) || (index[1] < 0)) {
+        return (-1);
+    }
+
+    if (index[2] == PADDING) {
+        if (index[3] != PADDING) {
+            return (-1);
+        }
+
+        size = 1;
+        index[2] = 0;
+    } else if ((index[2] >= 0) && (index[3] == PADDING)) {
+        size = 2;
     } else {
-        return ('=');
+        return (-1);
     }
+
+    value = (((uint32_t)index[0] << 18)
+             | ((uint32_t)index[1] << 12)
+             | (index[2] << 6));
+    dst_p[0] = (value >> 16);
+
+    if (size == 2) {
+        dst_p[1] = (value >> 8);
+    }
+
+    return (size);
 }
 
-static int encoded_to_index(char encoded)
+static int decode(void *dst_p,
+                  const char *src_p,
+                  size_t size,
+                  FAR const int8_t *table_p)
 {
-    if ((encoded >= 'A') && (encoded <= 'Z')) {
-        return (0 + encoded - 'A');
-    } else if ((encoded >= 'a') && (encoded <= 'z')) {
-        return (26 + encoded - 'a');
-    } else if ((encoded >= '0') && (encoded <= '9')) {
-        return (52 + encoded - '0');
-    } else if (encoded == '+') {
-        return (62);
-    } else if (encoded == '/') {
-        return (63);
-    } else if (encoded == '=') {
-        return (0);
+    uint8_t *d_p;
+    int res;
+
+    if ((size % 4) != 0) {
+        return (-EINVAL);
+    }
+
+    d_p = dst_p;
+
+    while (size > 0) {
+        res = decode_group(d_p, src_p, table_p);
+
+        if (res < 0) {
+            return (-1);
+        }
+
+        /* Only the last group may be padded. */
+        if ((res < 3) && (size > 4)) {
+            return (-1);
+        }
+
+        d_p += res;
+        src_p += 4;
+        size -= 4;
     }
 
-    return (-1);
+    return (0);
 }
 
 int base64_encode(char *dst_p, const void *src_p, size_t size)
@@ -74,71 +226,167 @@ int base64_encode(char *dst_p, const void *src_p, size_t size)
     ASSERTN(dst_p != NULL, EINVAL);
     ASSERTN(src_p != NULL, EINVAL);
 
-    int i;
-    int j;
-    int index;
-    const uint8_t *s_p = src_p;
-
-    for (i = 0, j = 0; i < size; i += 3, j += 4) {
-        index = ((s_p[i + 0] & 0xfc) >> 2);
-        dst_p[j + 0] = index_to_encoded(index);
-        index = ((s_p[i + 0] & 0x03) << 4);
-
-        if (i + 1 < size) {
-            index |= ((s_p[i + 1] & 0xf0) >> 4);
-            dst_p[j + 1] = index_to_encoded(index);
-            index = (s_p[i + 1] & 0x0f) << 2;
-            
-            if (i + 2 < size) {
-                index |= ((s_p[i + 2] & 0xc0) >> 6);
-                dst_p[j + 2] = index_to_encoded(index);
-                index = (s_p[i + 2] & 0x3f);
-                dst_p[j + 3] = index_to_encoded(index);
-            } else {
-                dst_p[j + 2] = index_to_encoded(index);
-                dst_p[j + 3] = index_to_encoded(64);
-            }
-        } else {
-            dst_p[j + 1] = index_to_encoded(index);
-            dst_p[j + 2] = index_to_encoded(64);
-            dst_p[j + 3] = index_to_encoded(64);
+    return (encode(dst_p, src_p, size, &alphabet[0]));
+}
+
+int base64_decode(void *dst_p, const char *src_p, size_t size)
+{
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN(src_p != NULL, EINVAL);
+
+    return (decode(dst_p, src_p, size, &decode_table[0]));
+}
+
+int base64_url_encode(char *dst_p, const void *src_p, size_t size)
+{
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN(src_p != NULL, EINVAL);
+
+    return (encode(dst_p, src_p, size, &url_alphabet[0]));
+}
+
+int base64_url_decode(void *dst_p, const char *src_p, size_t size)
+{
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN(src_p != NULL, EINVAL);
+
+    return (decode(dst_p, src_p, size, &url_decode_table[0]));
+}
+
+int base64_encoder_init(struct base64_encoder_t *self_p, int url)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->alphabet_p = (url ? &url_alphabet[0] : &alphabet[0]);
+    self_p->size = 0;
+
+    return (0);
+}
+
+ssize_t base64_encoder_update(struct base64_encoder_t *self_p,
+                              char *dst_p,
+                              const void *src_p,
+                              size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN((src_p != NULL) || (size == 0), EINVAL);
+
+    const uint8_t *s_p;
+    char *d_p;
+
+    s_p = src_p;
+    d_p = dst_p;
+
+    /* Complete the buffered group. */
+    if (self_p->size > 0) {
+        while ((self_p->size < 3) && (size > 0)) {
+            self_p->buf[self_p->size++] = *s_p++;
+            size--;
         }
+
+        if (self_p->size < 3) {
+            return (0);
+        }
+
+        encode_group(d_p, &self_p->buf[0], self_p->alphabet_p);
+        d_p += 4;
+        self_p->size = 0;
     }
 
-    return (0);
+    while (size >= 3) {
+        encode_group(d_p, s_p, self_p->alphabet_p);
+        s_p += 3;
+        d_p += 4;
+        size -= 3;
+    }
+
+    memcpy(&self_p->buf[0], s_p, size);
+    self_p->size = size;
+
+    return (d_p - dst_p);
 }
 
-int base64_decode(void *dst_p, const char *src_p, size_t size)
+ssize_t base64_encoder_finish(struct base64_encoder_t *self_p,
+                              char *dst_p)
 {
+    ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(dst_p != NULL, EINVAL);
-    ASSERTN(src_p != NULL, EINVAL);
 
-    int i;
-    int j;
-    int index[4];
-    uint8_t *d_p = dst_p;
-    
-    if ((size % 4) != 0) {
-        return (-EINVAL);
+    if (self_p->size == 0) {
+        return (0);
     }
 
-    for (i = 0, j = 0; i < size; i += 4, j += 3) {
-        index[0] = encoded_to_index(src_p[i + 0]);
-        index[1] = encoded_to_index(src_p[i + 1]);
-        index[2] = encoded_to_index(src_p[i + 2]);
-        index[3] = encoded_to_index(src_p[i + 3]);
+    encode_tail(dst_p, &self_p->buf[0], self_p->size, self_p->alphabet_p);
+    self_p->size = 0;
 
-        if ((index[0] == -1)
-            || (index[1] == -1)
-            || (index[2] == -1)
-            || (index[3] == -1)) {
-            return (-1);
+    return (4);
+}
+
+int base64_decoder_init(struct base64_decoder_t *self_p, int url)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    self_p->table_p = (url ? &url_decode_table[0] : &decode_table[0]);
+    self_p->size = 0;
+    self_p->done = 0;
+
+    return (0);
+}
+
+ssize_t base64_decoder_update(struct base64_decoder_t *self_p,
+                              void *dst_p,
+                              const char *src_p,
+                              size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN((src_p != NULL) || (size == 0), EINVAL);
+
+    uint8_t *d_p;
+    int res;
+
+    d_p = dst_p;
+
+    while (size > 0) {
+        /* No data is allowed after padding. */
+        if (self_p->done == 1) {
+            return (-EINVAL);
+        }
+
+        if ((self_p->size == 0) && (size >= 4)) {
+            res = decode_group(d_p, src_p, self_p->table_p);
+            src_p += 4;
+            size -= 4;
+        } else {
+            self_p->buf[self_p->size++] = *src_p++;
+            size--;
+
+            if (self_p->size < 4) {
+                continue;
+            }
+
+            res = decode_group(d_p, &self_p->buf[0], self_p->table_p);
+            self_p->size = 0;
+        }
+
+        if (res < 0) {
+            return (-EINVAL);
         }
 
-        d_p[j] = ((index[0] << 2) | (index[1] >> 4));
-        d_p[j + 1] = ((index[1] << 4) | (index[2] >> 2));
-        d_p[j + 2] = ((index[2] << 6) | index[3]);
+        if (res < 3) {
+            self_p->done = 1;
+        }
+
+        d_p += res;
     }
-    
-    return (0);
+
+    return (d_p - (uint8_t *)dst_p);
+}
+
+int base64_decoder_finish(struct base64_decoder_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (self_p->size == 0 ? 0 : -EINVAL);
 }
@@ -33,6 +33,25 @@
 
 #include "simba.h"
 
+/**
+ * Incremental encoder state.
+ */
+struct base64_encoder_t {
+    FAR const char *alphabet_p;
+    uint8_t buf[3];
+    size_t size;
+};
+
+/**
+ * Incremental decoder state.
+ */
+struct base64_decoder_t {
+    FAR const int8_t *table_p;
+    char buf[4];
+    size_t size;
+    int done;
+};
+
 /**
  * Encode given buffer. The encoded data will be ~33.3% larger than
  * the source data. Choose the destination buffer size accordingly.
@@ -58,4 +77,106 @@ int base64_encode(char *dst_p, const void *src_p, size_t size);
  */
 int base64_decode(void *dst_p, const char *src_p, size_t size);
 
+/**
+ * Encode given buffer using the URL and filename safe alphabet, where
+ * ``+`` and ``/`` are replaced by ``-`` and ``_``.
+ *
+ * @param[out] dst_p Encoded output data.
+ * @param[in] src_p Input data.
+ * @param[in] size Number of bytes in the input data.
+ *
+ * @return zero(0) or negative error code.
+ */
+int base64_url_encode(char *dst_p, const void *src_p, size_t size);
+
+/**
+ * Decode given buffer encoded using the URL and filename safe
+ * alphabet.
+ *
+ * @param[out] dst_p Output data.
+ * @param[in] src_p Encoded input data.
+ * @param[in] size Number of bytes in the encoded input data.
+ *
+ * @return zero(0) or negative error code.
+ */
+int base64_url_decode(void *dst_p, const char *src_p, size_t size);
+
+/**
+ * Initialize given incremental encoder.
+ *
+ * @param[out] self_p Encoder to initialize.
+ * @param[in] url Use the URL and filename safe alphabet if non-zero.
+ *
+ * @return zero(0) or negative error code.
+ */
+int base64_encoder_init(struct base64_encoder_t *self_p, int url);
+
+/**
+ * Encode given chunk of data. Up to two bytes are buffered in the
+ * encoder until the next call, so the destination buffer must be at
+ * least ``4 * ((size + 2) / 3)`` bytes.
+ *
+ * @param[in] self_p Encoder.
+ * @param[out] dst_p Encoded output data.
+ * @param[in] src_p Input data.
+ * @param[in] size Number of bytes in the input data.
+ *
+ * @return Number of encoded bytes written to dst_p or negative
+ *         error code.
+ */
+ssize_t base64_encoder_update(struct base64_encoder_t *self_p,
+                              char *dst_p,
+                              const void *src_p,
+                              size_t size);
+
+/**
+ * Encode buffered data, with padding.
+ *
+ * @param[in] self_p Encoder.
+ * @param[out] dst_p Encoded output data, at least four bytes.
+ *
+ * @return Number of encoded bytes written to dst_p or negative
+ *         error code.
+ */
+ssize_t base64_encoder_finish(struct base64_encoder_t *self_p,
+                              char *dst_p);
+
+/**
+ * Initialize given incremental decoder.
+ *
+ * @param[out] self_p Decoder to initialize.
+ * @param[in] url Use the URL and filename safe alphabet if non-zero.
+ *
+ * @return zero(0) or negative error code.
+ */
+int base64_decoder_init(struct base64_decoder_t *self_p, int url);
+
+/**
+ * Decode given chunk of encoded data. Up to three characters are
+ * buffered in the decoder until the next call, so the destination
+ * buffer must be at least ``3 * ((size + 3) / 4)`` bytes.
+ *
+ * @param[in] self_p Decoder.
+ * @param[out] dst_p Decoded output data.
+ * @param[in] src_p Encoded input data.
+ * @param[in] size Number of bytes in the encoded input data.
+ *
+ * @return Number of decoded bytes written to dst_p or negative
+ *         error code.
+ */
+ssize_t base64_decoder_update(struct base64_decoder_t *self_p,
+                              void *dst_p,
+                              const char *src_p,
+                              size_t size);
+
+/**
+ * Check that all given data has been decoded.
+ *
+ * @param[in] self_p Decoder.
+ *
+ * @return zero(0) or negative error code if a partial group of four
+ *         characters was given.
+ */
+int base64_decoder_finish(struct base64_decoder_t *self_p);
+
 #endif
@@ -58,6 +58,19 @@
 
 #include "simba.h"
 
+/* Streaming parser states. */
+#define STATE_VALUE                                          0
+#define STATE_VALUE_OR_END                                   1
+#define STATE_KEY                                            2
+#define STATE_KEY_OR_END                                     3
+#define STATE_COLON                                          4
+#define STATE_NEXT                                           5
+#define STATE_STRING                                         6
+#define STATE_STRING_ESCAPE                                  7
+#define STATE_STRING_UNICODE                                 8
+#define STATE_PRIMITIVE                                      9
+#define STATE_DONE                                          10
+
 struct dump_t {
     struct json_t *self_p;
     struct json_tok_t *tokens_p;
@@ -102,6 +115,7 @@ static struct json_tok_t *alloc_token(struct json_t *self_p)
     tok_p->buf_p = NULL;
     tok_p->size = -1;
     tok_p->num_tokens = 0;
+    tok_p->next = 1;
 #ifdef JSON_PARENT_LINKS
     tok_p->parent = -1;
 #endif
@@ -121,6 +135,7 @@ static void fill_token(struct json_tok_t *token_p,
     token_p->buf_p = buf_p;
     token_p->size = size;
     token_p->num_tokens = 0;
+    token_p->next = 1;
 }
 
 /**
@@ -218,17 +233,15 @@ static ssize_t dump_string(struct dump_t *state_p,
 {
     int i;
 
-    std_fprintf(state_p->out_p, FSTR("\""));
-
     for (i = 0; i < token_p->size; i++) {
         if (!isprint((int)token_p->buf_p[i])) {
             return (-1);
         }
-
-        std_fprintf(state_p->out_p, FSTR("%c"), token_p->buf_p[i]);
     }
 
-    std_fprintf(state_p->out_p, FSTR("\""));
+    chan_write(state_p->out_p, "\"", 1);
+    chan_write(state_p->out_p, token_p->buf_p, token_p->size);
+    chan_write(state_p->out_p, "\"", 1);
 
     return (token_p->size + 2);
 }
@@ -239,11 +252,7 @@ static ssize_t dump_string(struct dump_t *state_p,
 static ssize_t dump_primitive(struct dump_t *state_p,
                               struct json_tok_t *token_p)
 {
-    int i;
-
-    for (i = 0; i < token_p->size; i++) {
-        std_fprintf(state_p->out_p, FSTR("%c"), token_p->buf_p[i]);
-    }
+    chan_write(state_p->out_p, token_p->buf_p, token_p->size);
 
     return (token_p->size);
 }
@@ -489,6 +498,48 @@ static int get_number_of_children(struct json_tok_t *token_p)
     return (number_of_children);
 }
 
+/**
+ * Get the next sibling of given token. Uses the precomputed sibling
+ * offset if available.
+ */
+static struct json_tok_t *get_next_sibling(struct json_tok_t *token_p)
+{
+    if (token_p->next > 0) {
+        return (token_p + token_p->next);
+    }
+
+    return (token_p + get_number_of_children(token_p) + 1);
+}
+
+/**
+ * Calculate the next sibling offset of all parsed tokens. Children
+ * are always stored after their parent, so a single pass from the
+ * last token to the first visits each token once as a child.
+ */
+static void link_siblings(struct json_t *self_p)
+{
+    int i;
+    int j;
+    int next;
+    struct json_tok_t *token_p;
+
+    for (i = self_p->toknext - 1; i >= 0; i--) {
+        token_p = &self_p->tokens_p[i];
+        next = 1;
+
+        for (j = 0; j < token_p->num_tokens; j++) {
+            if (i + next >= self_p->toknext) {
+                next = 0;
+                break;
+            }
+
+            next += token_p[next].next;
+        }
+
+        token_p->next = next;
+    }
+}
+
 static struct json_tok_t *object_get(struct json_t *self_p,
                                      const char *key_p,
                                      struct json_tok_t *object_p,
@@ -498,8 +549,7 @@ static struct json_tok_t *object_get(struct json_t *self_p,
     ASSERTNRN(key_p != NULL, EINVAL);
 
     int i;
-    int key_length;
-    int number_of_children;
+    size_t key_length;
     struct json_tok_t *token_p;
 
     /* Return immediatly if no object is found. */
@@ -519,174 +569,908 @@ static struct json_tok_t *object_get(struct json_t *self_p,
 
     /* Find given key in the object. */
     for (i = 0; i < object_p->num_tokens; i++) {
-        if (token_p->type == type) {
-            if (strncmp(key_p, token_p->buf_p, key_length) == 0) {
-                return (token_p + 1);
-            }
+        if ((token_p->type == type)
+            && (token_p->size == key_length)
+            && (memcmp(key_p, token_p->buf_p, key_length) == 0)) {
+            return (token_p + 1);
         }
 
-        /* Get the next child token. */
-        number_of_children = get_number_of_children(token_p);
-        token_p += (number_of_children + 1);
+        token_p = get_next_sibling(token_p);
     }
 
     return (NULL);
 }
 
-int json_init(struct json_t *self_p,
-              struct json_tok_t *tokens_p,
-              int num_tokens)
+/**
+ * Report given event to the streaming parser user.
+ */
+static int stream_event(struct json_stream_t *self_p,
+                        enum json_stream_event_t event,
+                        const char *buf_p,
+                        size_t size)
 {
-    ASSERTN(self_p != NULL, EINVAL);
-    ASSERTN(((tokens_p != NULL) && (num_tokens > 0))
-            || (num_tokens == 0), EINVAL);
+    return (self_p->callback(self_p->arg_p, event, buf_p, size));
+}
 
-    self_p->pos = 0;
-    self_p->toknext = 0;
-    self_p->toksuper = -1;
-    self_p->tokens_p = tokens_p;
-    self_p->num_tokens = num_tokens;
+/**
+ * Append given data to the current streaming parser value.
+ */
+static int stream_append(struct json_stream_t *self_p,
+                         const char *buf_p,
+                         size_t size)
+{
+    if (size > self_p->value.size - self_p->value.pos) {
+        return (JSON_ERROR_NOMEM);
+    }
+
+    memcpy(&self_p->value.buf_p[self_p->value.pos], buf_p, size);
+    self_p->value.pos += size;
 
     return (0);
 }
 
-int json_parse(struct json_t *self_p,
-               const char *js_p,
-               size_t len)
+/**
+ * State after a complete value.
+ */
+static int stream_state_after_value(struct json_stream_t *self_p)
 {
-    ASSERTN(self_p != NULL, EINVAL);
-    ASSERTN(js_p != NULL, EINVAL);
-    ASSERTN(len > 0, EINVAL);
+    return (self_p->depth == 0 ? STATE_DONE : STATE_NEXT);
+}
 
-    int r;
-    int i;
-    struct json_tok_t *token_p;
-    int count;
+static int stream_is_array(struct json_stream_t *self_p)
+{
+    return ((self_p->arrays >> (self_p->depth - 1)) & 1);
+}
 
-    count = self_p->toknext;
+static int stream_begin(struct json_stream_t *self_p, char c)
+{
+    if (self_p->depth == JSON_STREAM_DEPTH_MAX) {
+        return (JSON_ERROR_NOMEM);
+    }
 
-    for (; ((self_p->pos < len)
-            && (js_p[self_p->pos] != '\0')); self_p->pos++) {
-        char c;
-        enum json_type_t type;
+    if (c == '[') {
+        self_p->arrays |= (1UL << self_p->depth);
+        self_p->state = STATE_VALUE_OR_END;
+    } else {
+        self_p->arrays &= ~(1UL << self_p->depth);
+        self_p->state = STATE_KEY_OR_END;
+    }
 
-        c = js_p[self_p->pos];
+    self_p->depth++;
 
-        switch (c) {
+    return (stream_event(self_p,
+                         (c == '['
+                          ? JSON_STREAM_ARRAY_BEGIN
+                          : JSON_STREAM_OBJECT_BEGIN),
+                         NULL,
+                         0));
+}
 
-        case '{':
-        case '[':
-            count++;
+static int stream_end(struct json_stream_t *self_p, char c)
+{
+    if (stream_is_array(self_p) != (c == ']')) {
+        return (JSON_ERROR_INVAL);
+    }
 
-            if (self_p->tokens_p == NULL) {
-                break;
-            }
+    self_p->depth--;
+    self_p->state = stream_state_after_value(self_p);
 
-            token_p = alloc_token(self_p);
+    return (stream_event(self_p,
+                         (c == ']'
+                          ? JSON_STREAM_ARRAY_END
+                          : JSON_STREAM_OBJECT_END),
+                         NULL,
+                         0));
+}
 
-            if (token_p == NULL) {
-                return (JSON_ERROR_NOMEM);
-            }
+/**
+ * Start of a value. A primitive is not consumed here, as its first
+ * character belongs to the value.
+ */
+static int stream_value(struct json_stream_t *self_p, char c)
+{
+    int res;
 
-            if (self_p->toksuper != -1) {
-                self_p->tokens_p[self_p->toksuper].num_tokens++;
-#ifdef JSON_PARENT_LINKS
-                token_p->parent = self_p->toksuper;
-#endif
-            }
+    res = 0;
 
-            token_p->type = (c == '{' ? JSON_OBJECT : JSON_ARRAY);
-            token_p->buf_p = js_p + self_p->pos;
-            self_p->toksuper = self_p->toknext - 1;
+    switch (c) {
+
+    case '{':
+    case '[':
+        res = stream_begin(self_p, c);
+        break;
+
+    case '\"':
+        self_p->is_key = 0;
+        self_p->value.pos = 0;
+        self_p->state = STATE_STRING;
+        break;
+
+    case ',':
+    case ':':
+    case ']':
+    case '}':
+        res = JSON_ERROR_INVAL;
+        break;
+
+    default:
+        self_p->value.pos = 0;
+        self_p->state = STATE_PRIMITIVE;
+        break;
+    }
+
+    return (res);
+}
+
+/**
+ * Handle given structural character.
+ */
+static int stream_structural(struct json_stream_t *self_p, char c)
+{
+    int res;
+
+    res = 0;
+
+    switch (self_p->state) {
+
+    case STATE_VALUE_OR_END:
+        if (c == ']') {
+            res = stream_end(self_p, c);
             break;
+        }
 
-        case '}':
-        case ']':
-            if (self_p->tokens_p == NULL) {
-                break;
-            }
+        /* Fall through. */
 
-            type = (c == '}' ? JSON_OBJECT : JSON_ARRAY);
+    case STATE_VALUE:
+        res = stream_value(self_p, c);
+        break;
 
-#ifdef JSON_PARENT_LINKS
-            if (self_p->toknext < 1) {
-                return (JSON_ERROR_INVAL);
-            }
+    case STATE_KEY_OR_END:
+        if (c == '}') {
+            res = stream_end(self_p, c);
+            break;
+        }
 
-            token = &tokens_p[self_p->toknext - 1];
+        /* Fall through. */
 
-            for (;;) {
-                if ((token_p->start != -1) && (token_p->end == -1)) {
-                    if (token_p->type != type) {
-                        return (JSON_ERROR_INVAL);
-                    }
+    case STATE_KEY:
+        if (c != '\"') {
+            return (JSON_ERROR_INVAL);
+        }
 
-                    token_p->size = (&js_p[self_p->pos]
-                                     - self_p->buf_p + 1);
-                    self_p->toksuper = token_p->parent;
-                    break;
-                }
+        self_p->is_key = 1;
+        self_p->value.pos = 0;
+        self_p->state = STATE_STRING;
+        break;
 
-                if (token_p->parent == -1) {
-                    break;
-                }
+    case STATE_COLON:
+        if (c != ':') {
+            return (JSON_ERROR_INVAL);
+        }
 
-                token = &tokens_p[token_p->parent];
+        self_p->is_key = 0;
+        self_p->state = STATE_VALUE;
+        break;
+
+    case STATE_NEXT:
+        if (c == ',') {
+            self_p->state = (stream_is_array(self_p)
+                             ? STATE_VALUE
+                             : STATE_KEY);
+        } else if ((c == ']') || (c == '}')) {
+            res = stream_end(self_p, c);
+        } else {
+            res = JSON_ERROR_INVAL;
+        }
+
+        break;
+
+    default:
+        res = JSON_ERROR_INVAL;
+        break;
+    }
+
+    return (res);
+}
+
+/**
+ * End of a string or primitive.
+ */
+static int stream_value_end(struct json_stream_t *self_p,
+                            enum json_stream_event_t event)
+{
+    if (self_p->is_key == 1) {
+        event = JSON_STREAM_KEY;
+        self_p->state = STATE_COLON;
+    } else {
+        self_p->state = stream_state_after_value(self_p);
+    }
+
+    return (stream_event(self_p,
+                         event,
+                         self_p->value.buf_p,
+                         self_p->value.pos));
+}
+
+/**
+ * Parse a string, possibly split between chunks. Returns the number
+ * of consumed bytes or negative error code.
+ */
+static ssize_t stream_string(struct json_stream_t *self_p,
+                             const char *buf_p,
+                             size_t size)
+{
+    size_t i;
+    int res;
+    char c;
+
+    i = 0;
+
+    while (i < size) {
+        c = buf_p[i];
+
+        switch (self_p->state) {
+
+        case STATE_STRING:
+            if (c == '\"') {
+                res = stream_value_end(self_p, JSON_STREAM_STRING);
+
+                return (res < 0 ? res : (ssize_t)i + 1);
             }
-#else
-            for (i = self_p->toknext - 1; i >= 0; i--) {
-                token_p = &self_p->tokens_p[i];
 
-                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
-                    if (token_p->type != type) {
-                        return (JSON_ERROR_INVAL);
-                    }
+            if (c == '\\') {
+                self_p->state = STATE_STRING_ESCAPE;
+            }
 
-                    self_p->toksuper = -1;
-                    token_p->size = (&js_p[self_p->pos]
-                                     - token_p->buf_p + 1);
-                    break;
-                }
+            break;
+
+        case STATE_STRING_ESCAPE:
+            switch (c) {
+
+            case '\"':
+            case '/':
+            case '\\':
+            case 'b':
+            case 'f':
+            case 'r':
+            case 'n':
+            case 't':
+                self_p->state = STATE_STRING;
+                break;
+
+            case 'u':
+                self_p->unicode_count = 0;
+                self_p->state = STATE_STRING_UNICODE;
+                break;
+
+            default:
+                return (JSON_ERROR_INVAL);
             }
 
-            /* Error if unmatched closing bracket */
-            if (i == -1) {
+            break;
+
+        default:
+            if (!isxdigit((int)c)) {
                 return (JSON_ERROR_INVAL);
             }
 
-            for (; i >= 0; i--) {
-                token_p = &self_p->tokens_p[i];
+            self_p->unicode_count++;
 
-                if ((token_p->buf_p != NULL) && (token_p->size == -1)) {
-                    self_p->toksuper = i;
-                    break;
-                }
+            if (self_p->unicode_count == 4) {
+                self_p->state = STATE_STRING;
             }
-#endif
+
             break;
-        case '\"':
-            r = parse_string(self_p, js_p, len);
+        }
 
-            if (r < 0) {
-                return (r);
+        /* Copy the character to the value buffer. The string
+           terminating quote is never copied. */
+        res = stream_append(self_p, &c, 1);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        i++;
+
+        /* Copy plain characters in one go. */
+        if (self_p->state == STATE_STRING) {
+            size_t start = i;
+
+            while ((i < size)
+                   && (buf_p[i] != '\"')
+                   && (buf_p[i] != '\\')) {
+                i++;
             }
 
-            count++;
+            res = stream_append(self_p, &buf_p[start], i - start);
 
-            if ((self_p->toksuper != -1) && (self_p->tokens_p != NULL)) {
-                self_p->tokens_p[self_p->toksuper].num_tokens++;
+            if (res != 0) {
+                return (res);
             }
+        }
+    }
 
-            break;
+    return (i);
+}
+
+/**
+ * Parse a primitive, possibly split between chunks. Returns the
+ * number of consumed bytes or negative error code.
+ */
+static ssize_t stream_primitive(struct json_stream_t *self_p,
+                                const char *buf_p,
+                                size_t size)
+{
+    size_t i;
+    int res;
+    char c;
+
+    for (i = 0; i < size; i++) {
+        c = buf_p[i];
+
+        switch (c) {
 
         case '\t':
         case '\r':
         case '\n':
         case ' ':
-            break;
-
+        case ',':
+        case ']':
+        case '}':
         case ':':
-            self_p->toksuper = self_p->toknext - 1;
+            res = stream_append(self_p, buf_p, i);
+
+            if (res != 0) {
+                return (res);
+            }
+
+            res = stream_value_end(self_p, JSON_STREAM_PRIMITIVE);
+
+            return (res < 0 ? res : (ssize_t)i);
+
+        default:
+            break;
+        }
+
+        if ((c < 32) || (c >= 127)) {
+            return (JSON_ERROR_INVAL);
+        }
+    }
+
+    res = stream_append(self_p, buf_p, i);
+
+    return (res < 0 ? res : (ssize_t)i);
+}
+
+/* Decimal digit pairs "00" to "99", used to format two digits per
+   division. */
+static const char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/**
+ * Format given unsigned integer in decimal, two digits at a
+ * time. Returns the number of characters written.
+ */
+static size_t format_unsigned(char *buf_p, unsigned long value)
+{
+    char digits[20];
+    char *p;
+    size_t size;
+    unsigned long index;
+
+    p = &digits[sizeof(digits)];
+
+    while (value >= 100) {
+        index = 2 * (value % 100);
+        value /= 100;
+        p -= 2;
+        p[0] = digit_pairs[index];
+        p[1] = digit_pairs[index + 1];
+    }
+
+    if (value >= 10) {
+        p -= 2;
+        p[0] = digit_pairs[2 * value];
+        p[1] = digit_pairs[2 * value + 1];
+    } else {
+        *--p = ('0' + value);
+    }
+
+    size = (&digits[sizeof(digits)] - p);
+    memcpy(buf_p, p, size);
+
+    return (size);
+}
+
+#if CONFIG_FLOAT == 1
+
+/**
+ * Format given positive number with up to six decimals, without
+ * trailing zeros. Returns the number of characters written.
+ */
+static size_t format_fixed(char *buf_p, float value)
+{
+    size_t size;
+    unsigned long integer;
+    unsigned long fraction;
+    int i;
+
+    integer = (unsigned long)value;
+    fraction = (unsigned long)((value - integer) * 1000000.0f + 0.5f);
+
+    if (fraction >= 1000000) {
+        integer++;
+        fraction -= 1000000;
+    }
+
+    size = format_unsigned(buf_p, integer);
+
+    if (fraction != 0) {
+        buf_p[size++] = '.';
+
+        for (i = 5; i >= 0; i--) {
+            buf_p[size + i] = ('0' + fraction % 10);
+            fraction /= 10;
+        }
+
+        size += 6;
+
+        while (buf_p[size - 1] == '0') {
+            size--;
+        }
+    }
+
+    return (size);
+}
+
+/**
+ * Format given number. Very small and very large numbers are written
+ * in exponent notation. Returns the number of characters written,
+ * at most 32.
+ */
+static size_t format_float(char *buf_p, float value)
+{
+    size_t size;
+    int exponent;
+
+    if (isnan(value) || isinf(value)) {
+        memcpy(buf_p, "null", 4);
+
+        return (4);
+    }
+
+    size = 0;
+
+    if (value < 0.0f) {
+        buf_p[size++] = '-';
+        value = -value;
+    }
+
+    if ((value == 0.0f) || ((value >= 1e-4f) && (value < 1e9f))) {
+        size += format_fixed(&buf_p[size], value);
+    } else {
+        exponent = 0;
+
+        while (value >= 10.0f) {
+            value /= 10.0f;
+            exponent++;
+        }
+
+        while (value < 1.0f) {
+            value *= 10.0f;
+            exponent--;
+        }
+
+        size += format_fixed(&buf_p[size], value);
+        buf_p[size++] = 'e';
+
+        if (exponent < 0) {
+            buf_p[size++] = '-';
+            exponent = -exponent;
+        }
+
+        size += format_unsigned(&buf_p[size], exponent);
+    }
+
+    return (size);
+}
+
+#endif
+
+/**
+ * Write given data to the writer buffer, flushing it to the channel
+ * when full.
+ */
+static int writer_write(struct json_writer_t *self_p,
+                        const void *buf_p,
+                        size_t size)
+{
+    if (self_p->res < 0) {
+        return (self_p->res);
+    }
+
+    if (size > self_p->size - self_p->pos) {
+        if (self_p->chan_p == NULL) {
+            self_p->res = JSON_ERROR_NOMEM;
+
+            return (self_p->res);
+        }
+
+        if (self_p->pos > 0) {
+            if (chan_write(self_p->chan_p,
+                           self_p->buf_p,
+                           self_p->pos) != self_p->pos) {
+                self_p->res = -EIO;
+
+                return (self_p->res);
+            }
+
+            self_p->pos = 0;
+        }
+
+        /* Write big chunks directly to the channel. */
+        if (size > self_p->size) {
+            if (chan_write(self_p->chan_p, buf_p, size) != size) {
+                self_p->res = -EIO;
+
+                return (self_p->res);
+            }
+
+            self_p->length += size;
+
+            return (0);
+        }
+    }
+
+    memcpy(&self_p->buf_p[self_p->pos], buf_p, size);
+    self_p->pos += size;
+    self_p->length += size;
+
+    return (0);
+}
+
+static int writer_is_array(struct json_writer_t *self_p)
+{
+    return ((self_p->arrays >> (self_p->depth - 1)) & 1);
+}
+
+/**
+ * Write the delimiter before a key, or before a value that is not an
+ * object value.
+ */
+static int writer_delimit(struct json_writer_t *self_p)
+{
+    uint32_t mask;
+
+    if (self_p->res < 0) {
+        return (self_p->res);
+    }
+
+    if (self_p->depth == 0) {
+        if (self_p->has_root == 1) {
+            self_p->res = JSON_ERROR_INVAL;
+        }
+
+        self_p->has_root = 1;
+
+        return (self_p->res);
+    }
+
+    mask = (1UL << (self_p->depth - 1));
+
+    if (self_p->non_empty & mask) {
+        return (writer_write(self_p, ",", 1));
+    }
+
+    self_p->non_empty |= mask;
+
+    return (0);
+}
+
+/**
+ * Prepare for a value.
+ */
+static int writer_value(struct json_writer_t *self_p)
+{
+    if (self_p->after_key == 1) {
+        self_p->after_key = 0;
+
+        return (self_p->res);
+    }
+
+    if ((self_p->depth > 0) && !writer_is_array(self_p)) {
+        /* Object values must be preceded by a key. */
+        if (self_p->res == 0) {
+            self_p->res = JSON_ERROR_INVAL;
+        }
+
+        return (self_p->res);
+    }
+
+    return (writer_delimit(self_p));
+}
+
+/**
+ * Write given string with quotes, escaping characters as
+ * needed. Runs of characters that do not need escaping are written
+ * in one go.
+ */
+static int writer_quoted(struct json_writer_t *self_p,
+                         const char *buf_p,
+                         size_t size)
+{
+    size_t i;
+    size_t start;
+    unsigned char c;
+    char escape[6];
+    size_t escape_size;
+
+    writer_write(self_p, "\"", 1);
+    start = 0;
+
+    for (i = 0; i < size; i++) {
+        c = buf_p[i];
+
+        if ((c >= 0x20) && (c != '"') && (c != '\\')) {
+            continue;
+        }
+
+        writer_write(self_p, &buf_p[start], i - start);
+        start = (i + 1);
+        escape[0] = '\\';
+        escape_size = 2;
+
+        switch (c) {
+
+        case '"':
+        case '\\':
+            escape[1] = c;
+            break;
+
+        case '\b':
+            escape[1] = 'b';
+            break;
+
+        case '\f':
+            escape[1] = 'f';
+            break;
+
+        case '\n':
+            escape[1] = 'n';
+            break;
+
+        case '\r':
+            escape[1] = 'r';
+            break;
+
+        case '\t':
+            escape[1] = 't';
+            break;
+
+        default:
+            escape[1] = 'u';
+            escape[2] = '0';
+            escape[3] = '0';
+            escape[4] = "0123456789abcdef"[c >> 4];
+            escape[5] = "0123456789abcdef"[c & 0xf];
+            escape_size = 6;
+            break;
+        }
+
+        writer_write(self_p, &escape[0], escape_size);
+    }
+
+    writer_write(self_p, &buf_p[start], size - start);
+
+    return (writer_write(self_p, "\"", 1));
+}
+
+static int writer_begin(struct json_writer_t *self_p, int is_array)
+{
+    uint32_t mask;
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    if (self_p->depth == JSON_STREAM_DEPTH_MAX) {
+        self_p->res = JSON_ERROR_NOMEM;
+
+        return (self_p->res);
+    }
+
+    mask = (1UL << self_p->depth);
+    self_p->non_empty &= ~mask;
+
+    if (is_array) {
+        self_p->arrays |= mask;
+    } else {
+        self_p->arrays &= ~mask;
+    }
+
+    self_p->depth++;
+
+    return (writer_write(self_p, is_array ? "[" : "{", 1));
+}
+
+static int writer_end(struct json_writer_t *self_p, int is_array)
+{
+    if (self_p->res < 0) {
+        return (self_p->res);
+    }
+
+    if ((self_p->depth == 0)
+        || (writer_is_array(self_p) != is_array)
+        || (self_p->after_key == 1)) {
+        self_p->res = JSON_ERROR_INVAL;
+
+        return (self_p->res);
+    }
+
+    self_p->depth--;
+
+    return (writer_write(self_p, is_array ? "]" : "}", 1));
+}
+
+int json_init(struct json_t *self_p,
+              struct json_tok_t *tokens_p,
+              int num_tokens)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(((tokens_p != NULL) && (num_tokens > 0))
+            || (num_tokens == 0), EINVAL);
+
+    self_p->pos = 0;
+    self_p->toknext = 0;
+    self_p->toksuper = -1;
+    self_p->tokopen = -1;
+    self_p->tokens_p = tokens_p;
+    self_p->num_tokens = num_tokens;
+
+    return (0);
+}
+
+int json_parse(struct json_t *self_p,
+               const char *js_p,
+               size_t len)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(js_p != NULL, EINVAL);
+    ASSERTN(len > 0, EINVAL);
+
+    int r;
+    int i;
+    struct json_tok_t *token_p;
+    int count;
+
+    count = self_p->toknext;
+
+    for (; ((self_p->pos < len)
+            && (js_p[self_p->pos] != '\0')); self_p->pos++) {
+        char c;
+        enum json_type_t type;
+
+        c = js_p[self_p->pos];
+
+        switch (c) {
+
+        case '{':
+        case '[':
+            count++;
+
+            if (self_p->tokens_p == NULL) {
+                break;
+            }
+
+            token_p = alloc_token(self_p);
+
+            if (token_p == NULL) {
+                return (JSON_ERROR_NOMEM);
+            }
+
+            if (self_p->toksuper != -1) {
+                self_p->tokens_p[self_p->toksuper].num_tokens++;
+#ifdef JSON_PARENT_LINKS
+                token_p->parent = self_p->toksuper;
+#endif
+            }
+
+            token_p->type = (c == '{' ? JSON_OBJECT : JSON_ARRAY);
+            token_p->buf_p = js_p + self_p->pos;
+            token_p->next = self_p->tokopen;
+            self_p->toksuper = self_p->toknext - 1;
+            self_p->tokopen = self_p->toksuper;
+            break;
+
+        case '}':
+        case ']':
+            if (self_p->tokens_p == NULL) {
+                break;
+            }
+
+            type = (c == '}' ? JSON_OBJECT : JSON_ARRAY);
+
+#ifdef JSON_PARENT_LINKS
+            if (self_p->toknext < 1) {
+                return (JSON_ERROR_INVAL);
+            }
+
+            token = &tokens_p[self_p->toknext - 1];
+
+            for (;;) {
+                if ((token_p->start != -1) && (token_p->end == -1)) {
+                    if (token_p->type != type) {
+                        return (JSON_ERROR_INVAL);
+                    }
+
+                    token_p->size = (&js_p[self_p->pos]
+                                     - self_p->buf_p + 1);
+                    self_p->toksuper = token_p->parent;
+                    break;
+                }
+
+                if (token_p->parent == -1) {
+                    break;
+                }
+
+                token = &tokens_p[token_p->parent];
+            }
+#else
+            i = self_p->tokopen;
+
+            /* Error if unmatched closing bracket */
+            if (i == -1) {
+                return (JSON_ERROR_INVAL);
+            }
+
+            token_p = &self_p->tokens_p[i];
+
+            if (token_p->type != type) {
+                return (JSON_ERROR_INVAL);
+            }
+
+            token_p->size = (&js_p[self_p->pos] - token_p->buf_p + 1);
+
+            /* The enclosing object or array is the new superior
+               token. */
+            self_p->toksuper = token_p->next;
+            self_p->tokopen = token_p->next;
+            token_p->next = (self_p->toknext - i);
+#endif
+            break;
+        case '\"':
+            r = parse_string(self_p, js_p, len);
+
+            if (r < 0) {
+                return (r);
+            }
+
+            count++;
+
+            if ((self_p->toksuper != -1) && (self_p->tokens_p != NULL)) {
+                self_p->tokens_p[self_p->toksuper].num_tokens++;
+            }
+
+            break;
+
+        case '\t':
+        case '\r':
+        case '\n':
+        case ' ':
+            break;
+
+        case ':':
+            self_p->toksuper = self_p->toknext - 1;
             break;
 
         case ',':
@@ -697,16 +1481,7 @@ int json_parse(struct json_t *self_p,
 #ifdef JSON_PARENT_LINKS
                 self_p->toksuper = tokens_p[self_p->toksuper].parent;
 #else
-                for (i = self_p->toknext - 1; i >= 0; i--) {
-                    if ((self_p->tokens_p[i].type == JSON_ARRAY)
-                        || (self_p->tokens_p[i].type == JSON_OBJECT)) {
-                        if ((self_p->tokens_p[i].buf_p != NULL)
-                            && (self_p->tokens_p[i].size == -1)) {
-                            self_p->toksuper = i;
-                            break;
-                        }
-                    }
-                }
+                self_p->toksuper = self_p->tokopen;
 #endif
             }
             break;
@@ -766,12 +1541,12 @@ int json_parse(struct json_t *self_p,
     }
 
     if (self_p->tokens_p != NULL) {
-        for (i = self_p->toknext - 1; i >= 0; i--) {
-            /* Unmatched opened object or array */
-            if ((self_p->tokens_p[i].buf_p != NULL) && (self_p->tokens_p[i].size == -1)) {
-                return (JSON_ERROR_PART);
-            }
+        /* Unmatched opened object or array */
+        if (self_p->tokopen != -1) {
+            return (JSON_ERROR_PART);
         }
+
+        link_siblings(self_p);
     }
 
     return (count);
@@ -853,7 +1628,6 @@ struct json_tok_t *json_array_get(struct json_t *self_p,
     ASSERTNRN(index >= 0, EINVAL);
 
     int i;
-    int number_of_children;
     struct json_tok_t *token_p;
 
     /* Return immediatly if no array is found. */
@@ -875,14 +1649,299 @@ struct json_tok_t *json_array_get(struct json_t *self_p,
             return (token_p);
         }
 
-        /* Get the next child token. */
-        number_of_children = get_number_of_children(token_p);
-        token_p += (number_of_children + 1);
+        token_p = get_next_sibling(token_p);
     }
 
     return (NULL);
 }
 
+int json_stream_init(struct json_stream_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     json_stream_callback_t callback,
+                     void *arg_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(callback != NULL, EINVAL);
+
+    self_p->state = STATE_VALUE;
+    self_p->is_key = 0;
+    self_p->unicode_count = 0;
+    self_p->depth = 0;
+    self_p->arrays = 0;
+    self_p->value.buf_p = buf_p;
+    self_p->value.size = size;
+    self_p->value.pos = 0;
+    self_p->callback = callback;
+    self_p->arg_p = arg_p;
+
+    return (0);
+}
+
+int json_stream_parse(struct json_stream_t *self_p,
+                      const char *buf_p,
+                      size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN((buf_p != NULL) || (size == 0), EINVAL);
+
+    size_t i;
+    ssize_t res;
+    char c;
+
+    i = 0;
+
+    while (i < size) {
+        c = buf_p[i];
+        res = 1;
+
+        switch (self_p->state) {
+
+        case STATE_STRING:
+        case STATE_STRING_ESCAPE:
+        case STATE_STRING_UNICODE:
+            res = stream_string(self_p, &buf_p[i], size - i);
+            break;
+
+        case STATE_PRIMITIVE:
+            res = stream_primitive(self_p, &buf_p[i], size - i);
+            break;
+
+        default:
+            if ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n')) {
+                break;
+            }
+
+            res = stream_structural(self_p, c);
+
+            if (res < 0) {
+                return (res);
+            }
+
+            /* The first character of a primitive is parsed as part of
+               the primitive. */
+            res = (self_p->state == STATE_PRIMITIVE ? 0 : 1);
+            break;
+        }
+
+        if (res < 0) {
+            return (res);
+        }
+
+        i += res;
+    }
+
+    return (0);
+}
+
+int json_stream_finish(struct json_stream_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    int res;
+
+    if ((self_p->state == STATE_PRIMITIVE) && (self_p->depth == 0)) {
+        res = stream_value_end(self_p, JSON_STREAM_PRIMITIVE);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    if (self_p->state != STATE_DONE) {
+        return (JSON_ERROR_PART);
+    }
+
+    return (0);
+}
+
+int json_writer_init(struct json_writer_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     void *chan_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(buf_p != NULL, EINVAL);
+    ASSERTN(size > 0, EINVAL);
+
+    self_p->chan_p = chan_p;
+    self_p->buf_p = buf_p;
+    self_p->size = size;
+    self_p->pos = 0;
+    self_p->length = 0;
+    self_p->res = 0;
+    self_p->depth = 0;
+    self_p->has_root = 0;
+    self_p->after_key = 0;
+    self_p->arrays = 0;
+    self_p->non_empty = 0;
+
+    /* Leave room for the null termination. */
+    if (chan_p == NULL) {
+        self_p->size--;
+    }
+
+    return (0);
+}
+
+int json_writer_object_begin(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_begin(self_p, 0));
+}
+
+int json_writer_object_end(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_end(self_p, 0));
+}
+
+int json_writer_array_begin(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_begin(self_p, 1));
+}
+
+int json_writer_array_end(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    return (writer_end(self_p, 1));
+}
+
+int json_writer_key(struct json_writer_t *self_p, const char *key_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(key_p != NULL, EINVAL);
+
+    if (self_p->res < 0) {
+        return (self_p->res);
+    }
+
+    if ((self_p->depth == 0)
+        || writer_is_array(self_p)
+        || (self_p->after_key == 1)) {
+        self_p->res = JSON_ERROR_INVAL;
+
+        return (self_p->res);
+    }
+
+    writer_delimit(self_p);
+    writer_quoted(self_p, key_p, strlen(key_p));
+    self_p->after_key = 1;
+
+    return (writer_write(self_p, ":", 1));
+}
+
+int json_writer_string(struct json_writer_t *self_p,
+                       const char *buf_p,
+                       size_t size)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN((buf_p != NULL) || (size == 0), EINVAL);
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    return (writer_quoted(self_p, buf_p, size));
+}
+
+int json_writer_integer(struct json_writer_t *self_p, long value)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    char buf[24];
+    size_t size;
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    if (value < 0) {
+        buf[0] = '-';
+        size = 1 + format_unsigned(&buf[1], -(unsigned long)value);
+    } else {
+        size = format_unsigned(&buf[0], value);
+    }
+
+    return (writer_write(self_p, &buf[0], size));
+}
+
+#if CONFIG_FLOAT == 1
+
+int json_writer_float(struct json_writer_t *self_p, float value)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    char buf[32];
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    return (writer_write(self_p, &buf[0], format_float(&buf[0], value)));
+}
+
+#endif
+
+int json_writer_boolean(struct json_writer_t *self_p, int value)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    if (value) {
+        return (writer_write(self_p, "true", 4));
+    } else {
+        return (writer_write(self_p, "false", 5));
+    }
+}
+
+int json_writer_null(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (writer_value(self_p) != 0) {
+        return (self_p->res);
+    }
+
+    return (writer_write(self_p, "null", 4));
+}
+
+ssize_t json_writer_finish(struct json_writer_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    if (self_p->res < 0) {
+        return (self_p->res);
+    }
+
+    if ((self_p->depth != 0) || (self_p->has_root == 0)) {
+        return (JSON_ERROR_PART);
+    }
+
+    if (self_p->chan_p == NULL) {
+        self_p->buf_p[self_p->pos] = '\0';
+    } else if (self_p->pos > 0) {
+        if (chan_write(self_p->chan_p,
+                       self_p->buf_p,
+                       self_p->pos) != self_p->pos) {
+            return (-EIO);
+        }
+
+        self_p->pos = 0;
+    }
+
+    return (self_p->length);
+}
+
 void json_token_object(struct json_tok_t *token_p,
                        int num_keys)
 {
@@ -890,6 +1949,7 @@ void json_token_object(struct json_tok_t *token_p,
     token_p->buf_p = NULL;
     token_p->size = -1;
     token_p->num_tokens = num_keys;
+    token_p->next = 0;
 }
 
 void json_token_array(struct json_tok_t *token_p,
@@ -899,6 +1959,7 @@ void json_token_array(struct json_tok_t *token_p,
     token_p->buf_p = NULL;
     token_p->size = -1;
     token_p->num_tokens = num_elements;
+    token_p->next = 0;
 }
 
 void json_token_true(struct json_tok_t *token_p)
@@ -907,6 +1968,7 @@ void json_token_true(struct json_tok_t *token_p)
     token_p->buf_p = "true";
     token_p->size = 4;
     token_p->num_tokens = -1;
+    token_p->next = 1;
 }
 
 void json_token_false(struct json_tok_t *token_p)
@@ -915,6 +1977,7 @@ void json_token_false(struct json_tok_t *token_p)
     token_p->buf_p = "false";
     token_p->size = 5;
     token_p->num_tokens = -1;
+    token_p->next = 1;
 }
 
 void json_token_null(struct json_tok_t *token_p)
@@ -923,6 +1986,7 @@ void json_token_null(struct json_tok_t *token_p)
     token_p->buf_p = "null";
     token_p->size = 4;
     token_p->num_tokens = -1;
+    token_p->next = 1;
 }
 
 void json_token_number(struct json_tok_t *token_p,
@@ -933,6 +1997,7 @@ void json_token_number(struct json_tok_t *token_p,
     token_p->buf_p = buf_p;
     token_p->size = size;
     token_p->num_tokens = -1;
+    token_p->next = 1;
 }
 
 void json_token_string(struct json_tok_t *token_p,
@@ -943,4 +2008,5 @@ void json_token_string(struct json_tok_t *token_p,
     token_p->buf_p = buf_p;
     token_p->size = size;
     token_p->num_tokens = -1;
+    token_p->next = 1;
 }
@@ -104,6 +104,12 @@ struct json_tok_t {
     size_t size;
     /* Number of children of this token. Not recursive. */
     int num_tokens;
+    /* Offset to the next sibling token, that is, the number of
+       tokens in the subtree rooted at this token, including the token
+       itself. One for tokens without children. Holds the enclosing
+       open object or array index while an object or array is being
+       parsed. */
+    int next;
 #ifdef JSON_PARENT_LINKS
     int parent;
 #endif
@@ -121,12 +127,106 @@ struct json_t {
     unsigned int toknext;
     /** Superior token node, e.g parent object or array. */
     int toksuper;
+    /** Innermost open object or array. */
+    int tokopen;
     /** Array of tokens. */
     struct json_tok_t *tokens_p;
     /** Number of tokens in the tokens array. */
     int num_tokens;
 };
 
+/**
+ * Maximum object and array nesting depth of the streaming parser.
+ */
+#define JSON_STREAM_DEPTH_MAX                                      32
+
+/**
+ * Streaming parser event type.
+ */
+enum json_stream_event_t {
+    /** Start of an object, ``{``. */
+    JSON_STREAM_OBJECT_BEGIN = 0,
+
+    /** End of an object, ``}``. */
+    JSON_STREAM_OBJECT_END,
+
+    /** Start of an array, ``[``. */
+    JSON_STREAM_ARRAY_BEGIN,
+
+    /** End of an array, ``]``. */
+    JSON_STREAM_ARRAY_END,
+
+    /** Object key string. */
+    JSON_STREAM_KEY,
+
+    /** String value. */
+    JSON_STREAM_STRING,
+
+    /** Other primitive value: number, boolean (true/false) or
+        null. */
+    JSON_STREAM_PRIMITIVE
+};
+
+/**
+ * Streaming parser event callback. Strings are given without quotes
+ * and escape sequences are not decoded, just as for string tokens.
+ *
+ * @param[in] arg_p Callback argument given to `json_stream_init()`.
+ * @param[in] event Event type.
+ * @param[in] buf_p Key, string or primitive value, or NULL for
+ *                  object and array events.
+ * @param[in] size Size of the value in bytes.
+ *
+ * @return zero(0) to continue parsing, or negative error code to
+ *         abort.
+ */
+typedef int (*json_stream_callback_t)(void *arg_p,
+                                      enum json_stream_event_t event,
+                                      const char *buf_p,
+                                      size_t size);
+
+/**
+ * Streaming (push) parser state. Memory usage is bounded by the
+ * value buffer given to `json_stream_init()` and
+ * `JSON_STREAM_DEPTH_MAX`.
+ */
+struct json_stream_t {
+    int state;
+    int is_key;
+    int unicode_count;
+    int depth;
+    /* One bit per nesting level, set if the level is an array. */
+    uint32_t arrays;
+    struct {
+        char *buf_p;
+        size_t size;
+        size_t pos;
+    } value;
+    json_stream_callback_t callback;
+    void *arg_p;
+};
+
+/**
+ * Streaming JSON writer. Writes a JSON document directly to a
+ * channel or a buffer, without building a token array first.
+ */
+struct json_writer_t {
+    void *chan_p;
+    char *buf_p;
+    size_t size;
+    size_t pos;
+    ssize_t length;
+    int res;
+    int depth;
+    int has_root;
+    int after_key;
+    /* One bit per nesting level, set if the level is an array. */
+    uint32_t arrays;
+    /* One bit per nesting level, set if the level has at least one
+       element. */
+    uint32_t non_empty;
+};
+
  /**
   * Initialize given JSON object. The JSON object must be initialized
   * before it can be used to parse and dump JSON data.
@@ -238,6 +338,189 @@ struct json_tok_t *json_array_get(struct json_t *self_p,
                                   int index,
                                   struct json_tok_t *array_p);
 
+/**
+ * Initialize given streaming parser. The parser accepts a JSON
+ * document in chunks of any size, and calls given callback for each
+ * parsed item.
+ *
+ * @param[out] self_p Streaming parser to initialize.
+ * @param[in] buf_p Buffer used to collect keys and values that are
+ *                  split between chunks. It must be able to hold the
+ *                  longest key or value in the document.
+ * @param[in] size Size of the buffer.
+ * @param[in] callback Event callback.
+ * @param[in] arg_p Callback argument.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_stream_init(struct json_stream_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     json_stream_callback_t callback,
+                     void *arg_p);
+
+/**
+ * Parse given chunk of a JSON document. Call this function once per
+ * received chunk, and `json_stream_finish()` once the whole document
+ * has been given. The parser must be initialized again after an
+ * error.
+ *
+ * @param[in] self_p Streaming parser.
+ * @param[in] buf_p Chunk to parse.
+ * @param[in] size Chunk size in bytes.
+ *
+ * @return zero(0) or negative error code, or the negative value
+ *         returned by the callback.
+ */
+int json_stream_parse(struct json_stream_t *self_p,
+                      const char *buf_p,
+                      size_t size);
+
+/**
+ * Finish parsing the document. A pending top level primitive is
+ * reported to the callback.
+ *
+ * @param[in] self_p Streaming parser.
+ *
+ * @return zero(0) if a complete document has been parsed,
+ *         otherwise negative error code.
+ */
+int json_stream_finish(struct json_stream_t *self_p);
+
+/**
+ * Initialize given JSON writer.
+ *
+ * @param[out] self_p JSON writer to initialize.
+ * @param[in] buf_p Output buffer. If `chan_p` is NULL the document is
+ *                  written to this buffer and null terminated by
+ *                  `json_writer_finish()`, otherwise this buffer is
+ *                  used to batch writes to the channel.
+ * @param[in] size Size of the buffer.
+ * @param[in] chan_p Channel to write the document to, or NULL to only
+ *                   write to the buffer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_init(struct json_writer_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     void *chan_p);
+
+/**
+ * Start an object. Inside an object, each value must be preceded by
+ * a call to `json_writer_key()`.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_object_begin(struct json_writer_t *self_p);
+
+/**
+ * End current object.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_object_end(struct json_writer_t *self_p);
+
+/**
+ * Start an array.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_array_begin(struct json_writer_t *self_p);
+
+/**
+ * End current array.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_array_end(struct json_writer_t *self_p);
+
+/**
+ * Write an object key.
+ *
+ * @param[in] self_p JSON writer.
+ * @param[in] key_p Null terminated key. It is escaped as needed.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_key(struct json_writer_t *self_p, const char *key_p);
+
+/**
+ * Write a string value.
+ *
+ * @param[in] self_p JSON writer.
+ * @param[in] buf_p String. Quotes, backslashes and control
+ *                  characters are escaped.
+ * @param[in] size String length in bytes.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_string(struct json_writer_t *self_p,
+                       const char *buf_p,
+                       size_t size);
+
+/**
+ * Write an integer value.
+ *
+ * @param[in] self_p JSON writer.
+ * @param[in] value Integer to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_integer(struct json_writer_t *self_p, long value);
+
+#if CONFIG_FLOAT == 1
+
+/**
+ * Write a floating point number value with up to six decimals. NaN
+ * and infinity are written as null, as JSON cannot represent them.
+ *
+ * @param[in] self_p JSON writer.
+ * @param[in] value Number to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_float(struct json_writer_t *self_p, float value);
+
+#endif
+
+/**
+ * Write a boolean value.
+ *
+ * @param[in] self_p JSON writer.
+ * @param[in] value Boolean to write.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_boolean(struct json_writer_t *self_p, int value);
+
+/**
+ * Write a null value.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return zero(0) or negative error code.
+ */
+int json_writer_null(struct json_writer_t *self_p);
+
+/**
+ * Finish the document and flush any buffered data to the channel.
+ *
+ * @param[in] self_p JSON writer.
+ *
+ * @return Document length (not including termination) or negative
+ *         error code.
+ */
+ssize_t json_writer_finish(struct json_writer_t *self_p);
+
 /**
  * Initialize a JSON object token.
  *
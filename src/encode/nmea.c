@@ -30,6 +30,20 @@
 
 #include "simba.h"
 
+/* Maximum number of fields in a sentence, including the address
+   field. */
+#define FIELDS_MAX                                         20
+
+/* The three characters sentence type packed into an integer. */
+#define TYPE_CODE(c0, c1, c2)                                   \
+    (((uint32_t)(c0) << 16) | ((uint32_t)(c1) << 8) | (uint32_t)(c2))
+
+/* Fields of a sentence found by the tokenizer. */
+struct fields_t {
+    char *values_p[FIELDS_MAX];
+    int length;
+};
+
 static uint8_t calculate_crc(char *buf_p, size_t size)
 {
     size_t i;
@@ -44,6 +58,90 @@ static uint8_t calculate_crc(char *buf_p, size_t size)
     return (crc);
 }
 
+/**
+ * Calculate the CRC of given sentence contents and find the start of
+ * all fields in a single pass. The first field is the address
+ * field. The string is not modified.
+ */
+static uint8_t tokenize(char *buf_p,
+                        size_t size,
+                        struct fields_t *fields_p)
+{
+    size_t i;
+    uint8_t crc;
+
+    crc = 0;
+    fields_p->values_p[0] = &buf_p[0];
+    fields_p->length = 1;
+
+    for (i = 0; i < size; i++) {
+        crc ^= buf_p[i];
+
+        if ((buf_p[i] == ',') && (fields_p->length < FIELDS_MAX)) {
+            fields_p->values_p[fields_p->length] = &buf_p[i + 1];
+            fields_p->length++;
+        }
+    }
+
+    return (crc);
+}
+
+/**
+ * Null-terminate given number of fields after the address field. The
+ * last field ends at the asterix and may contain commas if the
+ * sentence has more fields than expected.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int split_fields(struct fields_t *fields_p, int length)
+{
+    int i;
+
+    if (fields_p->length <= length) {
+        return (-EPROTO);
+    }
+
+    for (i = 2; i <= length; i++) {
+        fields_p->values_p[i][-1] = '\0';
+    }
+
+    return (0);
+}
+
+static int hex_to_int(char c)
+{
+    if ((c >= '0') && (c <= '9')) {
+        return (c - '0');
+    } else if ((c >= 'A') && (c <= 'F')) {
+        return (c - 'A' + 10);
+    } else if ((c >= 'a') && (c <= 'f')) {
+        return (c - 'a' + 10);
+    } else {
+        return (-1);
+    }
+}
+
+static enum nmea_talker_t decode_talker(char *src_p)
+{
+    switch (src_p[1]) {
+
+    case 'P':
+        return (nmea_talker_gp_t);
+
+    case 'L':
+        return (nmea_talker_gl_t);
+
+    case 'A':
+        return (nmea_talker_ga_t);
+
+    case 'N':
+        return (nmea_talker_gn_t);
+
+    default:
+        return (nmea_talker_other_t);
+    }
+}
+
 static int decode_triple(char *src_p,
                          int *v0_p,
                          int *v1_p,
@@ -245,14 +343,12 @@ static ssize_t encode_vtg(char *dst_p,
  * Decode given raw sentence.
  */
 static ssize_t decode_raw(struct nmea_sentence_t *dst_p,
-                          char *src_p,
-                          size_t size)
+                          char *src_p)
 {
     /* Set the type. */
     dst_p->type = nmea_sentence_type_raw_t;
 
-    /* Null-terminate the raw string (overwrites CRC prefix *). */
-    src_p[size - 1] = '\0';
+    /* The raw string is null-terminated at the CRC prefix *. */
     dst_p->raw.str_p = src_p;
 
     return (0);
@@ -263,32 +359,32 @@ static ssize_t decode_raw(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_gga(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
+
     /* Set the type. */
     dst_p->type = nmea_sentence_type_gga_t;
 
-    /* Find all values in the sentence. */
-    dst_p->gga.time_of_fix_p = strsep(&src_p, ",");
-    dst_p->gga.latitude.angle_p = strsep(&src_p, ",");
-    dst_p->gga.latitude.direction_p = strsep(&src_p, ",");
-    dst_p->gga.longitude.angle_p = strsep(&src_p, ",");
-    dst_p->gga.longitude.direction_p = strsep(&src_p, ",");
-    dst_p->gga.fix_quality_p = strsep(&src_p, ",");
-    dst_p->gga.number_of_tracked_satellites_p = strsep(&src_p, ",");
-    dst_p->gga.horizontal_dilution_of_position_p = strsep(&src_p, ",");
-    dst_p->gga.altitude.value_p = strsep(&src_p, ",");
-    dst_p->gga.altitude.unit_p = strsep(&src_p, ",");
-    dst_p->gga.height_of_geoid.value_p = strsep(&src_p, ",");
-    dst_p->gga.height_of_geoid.unit_p = strsep(&src_p, ",");
-    (void)strsep(&src_p, ",");
-    (void)strsep(&src_p, "*");
-
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 14) != 0) {
         return (-EPROTO);
     }
 
+    values_pp = &fields_p->values_p[1];
+    dst_p->gga.time_of_fix_p = values_pp[0];
+    dst_p->gga.latitude.angle_p = values_pp[1];
+    dst_p->gga.latitude.direction_p = values_pp[2];
+    dst_p->gga.longitude.angle_p = values_pp[3];
+    dst_p->gga.longitude.direction_p = values_pp[4];
+    dst_p->gga.fix_quality_p = values_pp[5];
+    dst_p->gga.number_of_tracked_satellites_p = values_pp[6];
+    dst_p->gga.horizontal_dilution_of_position_p = values_pp[7];
+    dst_p->gga.altitude.value_p = values_pp[8];
+    dst_p->gga.altitude.unit_p = values_pp[9];
+    dst_p->gga.height_of_geoid.value_p = values_pp[10];
+    dst_p->gga.height_of_geoid.unit_p = values_pp[11];
+
     return (0);
 }
 
@@ -297,25 +393,26 @@ static ssize_t decode_gga(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_gll(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
+
     /* Set the type. */
     dst_p->type = nmea_sentence_type_gll_t;
 
-    /* Find all values in the sentence. */
-    dst_p->gll.latitude.angle_p = strsep(&src_p, ",");
-    dst_p->gll.latitude.direction_p = strsep(&src_p, ",");
-    dst_p->gll.longitude.angle_p = strsep(&src_p, ",");
-    dst_p->gll.longitude.direction_p = strsep(&src_p, ",");
-    dst_p->gll.time_of_fix_p = strsep(&src_p, ",");
-    dst_p->gll.data_active_p = strsep(&src_p, ",");
-    (void)strsep(&src_p, "*");
-
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 7) != 0) {
         return (-EPROTO);
     }
 
+    values_pp = &fields_p->values_p[1];
+    dst_p->gll.latitude.angle_p = values_pp[0];
+    dst_p->gll.latitude.direction_p = values_pp[1];
+    dst_p->gll.longitude.angle_p = values_pp[2];
+    dst_p->gll.longitude.direction_p = values_pp[3];
+    dst_p->gll.time_of_fix_p = values_pp[4];
+    dst_p->gll.data_active_p = values_pp[5];
+
     return (0);
 }
 
@@ -324,30 +421,31 @@ static ssize_t decode_gll(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_gsa(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
     int i;
 
     /* Set the type. */
     dst_p->type = nmea_sentence_type_gsa_t;
 
-    /* Find all values in the sentence. */
-    dst_p->gsa.selection_p = strsep(&src_p, ",");
-    dst_p->gsa.fix_p = strsep(&src_p, ",");
-
-    for (i = 0; i < membersof(dst_p->gsa.prns); i++) {
-        dst_p->gsa.prns[i] = strsep(&src_p, ",");
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 17) != 0) {
+        return (-EPROTO);
     }
 
-    dst_p->gsa.pdop_p = strsep(&src_p, ",");
-    dst_p->gsa.hdop_p = strsep(&src_p, ",");
-    dst_p->gsa.vdop_p = strsep(&src_p, "*");
+    values_pp = &fields_p->values_p[1];
+    dst_p->gsa.selection_p = values_pp[0];
+    dst_p->gsa.fix_p = values_pp[1];
 
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
-        return (-EPROTO);
+    for (i = 0; i < membersof(dst_p->gsa.prns); i++) {
+        dst_p->gsa.prns[i] = values_pp[2 + i];
     }
 
+    dst_p->gsa.pdop_p = values_pp[14];
+    dst_p->gsa.hdop_p = values_pp[15];
+    dst_p->gsa.vdop_p = values_pp[16];
+
     return (0);
 }
 
@@ -356,33 +454,29 @@ static ssize_t decode_gsa(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_gsv(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
     int i;
 
     /* Set the type. */
     dst_p->type = nmea_sentence_type_gsv_t;
 
-    /* Find all values in the sentence. */
-    dst_p->gsv.number_of_sentences_p = strsep(&src_p, ",");
-    dst_p->gsv.sentence_p = strsep(&src_p, ",");
-    dst_p->gsv.number_of_satellites_p = strsep(&src_p, ",");
-
-    for (i = 0; i < membersof(dst_p->gsv.satellites); i++) {
-        dst_p->gsv.satellites[i].prn_p = strsep(&src_p, ",");
-        dst_p->gsv.satellites[i].elevation_p = strsep(&src_p, ",");
-        dst_p->gsv.satellites[i].azimuth_p = strsep(&src_p, ",");
-
-        if (i < membersof(dst_p->gsv.satellites) - 1) {
-            dst_p->gsv.satellites[i].snr_p = strsep(&src_p, ",");
-        } else {
-            dst_p->gsv.satellites[i].snr_p = strsep(&src_p, "*");
-        }
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 19) != 0) {
+        return (-EPROTO);
     }
 
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
-        return (-EPROTO);
+    values_pp = &fields_p->values_p[1];
+    dst_p->gsv.number_of_sentences_p = values_pp[0];
+    dst_p->gsv.sentence_p = values_pp[1];
+    dst_p->gsv.number_of_satellites_p = values_pp[2];
+
+    for (i = 0; i < membersof(dst_p->gsv.satellites); i++) {
+        dst_p->gsv.satellites[i].prn_p = values_pp[3 + 4 * i];
+        dst_p->gsv.satellites[i].elevation_p = values_pp[4 + 4 * i];
+        dst_p->gsv.satellites[i].azimuth_p = values_pp[5 + 4 * i];
+        dst_p->gsv.satellites[i].snr_p = values_pp[6 + 4 * i];
     }
 
     return (0);
@@ -393,26 +487,28 @@ static ssize_t decode_gsv(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_vtg(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
+
     /* Set the type. */
     dst_p->type = nmea_sentence_type_vtg_t;
 
-    /* Find all values in the sentence. */
-    dst_p->vtg.track_made_good_true.value_p = strsep(&src_p, ",");
-    dst_p->vtg.track_made_good_true.relative_to_p = strsep(&src_p, ",");
-    dst_p->vtg.track_made_good_magnetic.value_p = strsep(&src_p, ",");
-    dst_p->vtg.track_made_good_magnetic.relative_to_p = strsep(&src_p, ",");
-    dst_p->vtg.ground_speed_knots.value_p = strsep(&src_p, ",");
-    dst_p->vtg.ground_speed_knots.unit_p = strsep(&src_p, ",");
-    dst_p->vtg.ground_speed_kmph.value_p = strsep(&src_p, ",");
-    dst_p->vtg.ground_speed_kmph.unit_p = strsep(&src_p, "*");
-
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 8) != 0) {
         return (-EPROTO);
     }
 
+    values_pp = &fields_p->values_p[1];
+    dst_p->vtg.track_made_good_true.value_p = values_pp[0];
+    dst_p->vtg.track_made_good_true.relative_to_p = values_pp[1];
+    dst_p->vtg.track_made_good_magnetic.value_p = values_pp[2];
+    dst_p->vtg.track_made_good_magnetic.relative_to_p = values_pp[3];
+    dst_p->vtg.ground_speed_knots.value_p = values_pp[4];
+    dst_p->vtg.ground_speed_knots.unit_p = values_pp[5];
+    dst_p->vtg.ground_speed_kmph.value_p = values_pp[6];
+    dst_p->vtg.ground_speed_kmph.unit_p = values_pp[7];
+
     return (0);
 }
 
@@ -422,29 +518,31 @@ static ssize_t decode_vtg(struct nmea_sentence_t *dst_p,
  * string into values.
  */
 static ssize_t decode_rmc(struct nmea_sentence_t *dst_p,
-                          char *src_p)
+                          struct fields_t *fields_p)
 {
+    char **values_pp;
+
     /* Set the type. */
     dst_p->type = nmea_sentence_type_rmc_t;
 
-    /* Find all values in the sentence. */
-    dst_p->rmc.time_of_fix_p = strsep(&src_p, ",");
-    dst_p->rmc.status_p = strsep(&src_p, ",");
-    dst_p->rmc.latitude.angle_p = strsep(&src_p, ",");
-    dst_p->rmc.latitude.direction_p = strsep(&src_p, ",");
-    dst_p->rmc.longitude.angle_p = strsep(&src_p, ",");
-    dst_p->rmc.longitude.direction_p = strsep(&src_p, ",");
-    dst_p->rmc.speed_knots_p = strsep(&src_p, ",");
-    dst_p->rmc.track_angle_p = strsep(&src_p, ",");
-    dst_p->rmc.date_p = strsep(&src_p, ",");
-    dst_p->rmc.magnetic_variation.angle_p = strsep(&src_p, ",");
-    dst_p->rmc.magnetic_variation.direction_p = strsep(&src_p, "*");
-
-    /* All values parsed successfully? */
-    if (src_p == NULL) {
+    /* All values in the sentence? */
+    if (split_fields(fields_p, 11) != 0) {
         return (-EPROTO);
     }
 
+    values_pp = &fields_p->values_p[1];
+    dst_p->rmc.time_of_fix_p = values_pp[0];
+    dst_p->rmc.status_p = values_pp[1];
+    dst_p->rmc.latitude.angle_p = values_pp[2];
+    dst_p->rmc.latitude.direction_p = values_pp[3];
+    dst_p->rmc.longitude.angle_p = values_pp[4];
+    dst_p->rmc.longitude.direction_p = values_pp[5];
+    dst_p->rmc.speed_knots_p = values_pp[6];
+    dst_p->rmc.track_angle_p = values_pp[7];
+    dst_p->rmc.date_p = values_pp[8];
+    dst_p->rmc.magnetic_variation.angle_p = values_pp[9];
+    dst_p->rmc.magnetic_variation.direction_p = values_pp[10];
+
     return (0);
 }
 
@@ -536,11 +634,14 @@ ssize_t nmea_decode(struct nmea_sentence_t *dst_p,
 
     ssize_t res;
     uint8_t actual_crc;
-    long expected_crc;
-    const char *end_p;
+    int crc_high;
+    int crc_low;
+    uint32_t type_code;
+    struct fields_t fields;
 
     /* Basic validation of the sentence. */
-    if ((src_p[0] != '$')
+    if ((size < 7)
+        || (src_p[0] != '$')
         || (src_p[1] != 'G')
         || (src_p[size - 5] != '*')
         || (src_p[size - 2] != '\r')
@@ -549,41 +650,62 @@ ssize_t nmea_decode(struct nmea_sentence_t *dst_p,
         return (-EPROTO);
     }
 
-    /* Check the CRC. */
-    actual_crc = calculate_crc(&src_p[1], size - 6);
-    end_p = std_strtolb(&src_p[size - 4], &expected_crc, 16);
+    /* Check the CRC. The fields are found at the same time. */
+    actual_crc = tokenize(&src_p[1], size - 6, &fields);
+    crc_high = hex_to_int(src_p[size - 4]);
+    crc_low = hex_to_int(src_p[size - 3]);
 
-    if (end_p != &src_p[size - 2]) {
+    if ((crc_high == -1) || (crc_low == -1)) {
         return (-EPROTO);
     }
 
-    /* std_printf(FSTR("actual_crc: 0x%02x, expected_crc: 0x%02x\r\n"), */
-    /*            actual_crc, */
-    /*            expected_crc); */
-
-    if (actual_crc != expected_crc) {
+    if (actual_crc != ((crc_high << 4) | crc_low)) {
         return (-EPROTO);
     }
 
-    /* Subtract $, CRC and line termination. Keep * to ease
-       parsing. */
-    size -= 5;
+    dst_p->talker = decode_talker(&src_p[1]);
 
-    /* Parse the sentence. */
-    if (memcmp(&src_p[3], "GGA,", 4) == 0) {
-        res = decode_gga(dst_p, &src_p[7]);
-    } else if (memcmp(&src_p[3], "GLL,", 4) == 0) {
-        res = decode_gll(dst_p, &src_p[7]);
-    } else if (memcmp(&src_p[3], "GSA,", 4) == 0) {
-        res = decode_gsa(dst_p, &src_p[7]);
-    } else if (memcmp(&src_p[3], "GSV,", 4) == 0) {
-        res = decode_gsv(dst_p, &src_p[7]);
-    } else if (memcmp(&src_p[3], "RMC,", 4) == 0) {
-        res = decode_rmc(dst_p, &src_p[7]);
-    } else if (memcmp(&src_p[3], "VTG,", 4) == 0) {
-        res = decode_vtg(dst_p, &src_p[7]);
+    /* The address field is a two characters talker and a three
+       characters sentence type. */
+    if ((fields.length > 1) && (fields.values_p[1] == &src_p[7])) {
+        type_code = TYPE_CODE(src_p[3], src_p[4], src_p[5]);
     } else {
-        res = decode_raw(dst_p, &src_p[1], size);
+        type_code = 0;
+    }
+
+    /* The last field ends at the asterix. */
+    src_p[size - 5] = '\0';
+
+    /* Parse the sentence. */
+    switch (type_code) {
+
+    case TYPE_CODE('G', 'G', 'A'):
+        res = decode_gga(dst_p, &fields);
+        break;
+
+    case TYPE_CODE('G', 'L', 'L'):
+        res = decode_gll(dst_p, &fields);
+        break;
+
+    case TYPE_CODE('G', 'S', 'A'):
+        res = decode_gsa(dst_p, &fields);
+        break;
+
+    case TYPE_CODE('G', 'S', 'V'):
+        res = decode_gsv(dst_p, &fields);
+        break;
+
+    case TYPE_CODE('R', 'M', 'C'):
+        res = decode_rmc(dst_p, &fields);
+        break;
+
+    case TYPE_CODE('V', 'T', 'G'):
+        res = decode_vtg(dst_p, &fields);
+        break;
+
+    default:
+        res = decode_raw(dst_p, &src_p[1]);
+        break;
     }
 
     return (res);
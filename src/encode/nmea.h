@@ -149,11 +149,29 @@ enum nmea_sentence_type_t {
     nmea_sentence_type_max_t
 };
 
+/**
+ * Talkers, the satellite system a sentence originates from.
+ */
+enum nmea_talker_t {
+    /* GPS. */
+    nmea_talker_gp_t = 0,
+    /* GLONASS. */
+    nmea_talker_gl_t,
+    /* Galileo. */
+    nmea_talker_ga_t,
+    /* Multiple satellite systems combined. */
+    nmea_talker_gn_t,
+    nmea_talker_other_t
+};
+
 /**
  * A union of all sentences.
  */
 struct nmea_sentence_t {
     enum nmea_sentence_type_t type;
+    /* Set by `nmea_decode()`. Sentences are always encoded with the
+       GPS talker. */
+    enum nmea_talker_t talker;
     union {
         struct nmea_sentence_raw_t raw;
         struct nmea_sentence_gga_t gga;
@@ -37,6 +37,9 @@
 struct module_t {
     int8_t initialized;
     struct fs_command_t *commands_p;
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+    struct fs_command_t *commands_index[CONFIG_FS_COMMAND_INDEX_SIZE];
+#endif
     struct fs_filesystem_t *filesystems_p;
     struct fs_counter_t *counters_p;
     struct fs_parameter_t *parameters_p;
@@ -461,6 +464,33 @@ static int cmd_parameters_list_cb(int argc,
 
 #endif
 
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+
+/**
+ * Get the command index bucket for given path. The leading slash is
+ * optional.
+ */
+static struct fs_command_t **command_index_bucket(FAR const char *path_p)
+{
+    uint32_t hash;
+
+    if (*path_p == '/') {
+        path_p++;
+    }
+
+    /* FNV-1a. */
+    hash = 0x811c9dc5;
+
+    while (*path_p != '\0') {
+        hash ^= (uint8_t)*path_p++;
+        hash *= 0x01000193;
+    }
+
+    return (&module.commands_index[hash & (CONFIG_FS_COMMAND_INDEX_SIZE - 1)]);
+}
+
+#endif
+
 /**
  * Parse one argument from given string. An argument must be in quotes
  * if it contains spaces.
@@ -569,6 +599,9 @@ int fs_module_init()
     module.filesystems_p = NULL;
     module.counters_p = NULL;
     module.parameters_p = NULL;
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+    memset(&module.commands_index[0], 0, sizeof(module.commands_index));
+#endif
 
 #if CONFIG_FS_FS_COMMAND_FILESYSTEMS_LIST == 1
     fs_command_init(&module.cmd_filesystems_list,
@@ -671,9 +704,14 @@ int fs_call(char *command_p,
     }
 
     /* Find given command. */
-    current_p = module.commands_p;
     skip_slash = (argv[0][0] != '/');
 
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+    current_p = *command_index_bucket(argv[0]);
+#else
+    current_p = module.commands_p;
+#endif
+
     while (current_p != NULL) {
         if (std_strcmp(argv[0], &current_p->path_p[skip_slash]) == 0) {
             return (current_p->callback(argc,
@@ -684,7 +722,11 @@ int fs_call(char *command_p,
                                         arg_p));
         }
 
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+        current_p = current_p->index_next_p;
+#else
         current_p = current_p->next_p;
+#endif
     }
 
     std_fprintf(chout_p, OSTR("%s: command not found\r\n"), argv[0]);
@@ -1848,6 +1890,14 @@ int fs_command_register(struct fs_command_t *command_p)
     ASSERTN(command_p != NULL, EINVAL);
 
     struct fs_command_t *current_p, *prev_p;
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+    struct fs_command_t **bucket_pp;
+
+    /* Insert into the index, used by fs_call(). */
+    bucket_pp = command_index_bucket(command_p->path_p);
+    command_p->index_next_p = *bucket_pp;
+    *bucket_pp = command_p;
+#endif
 
     /* Insert in alphabetical order. */
     prev_p = NULL;
@@ -222,6 +222,9 @@ struct fs_command_t {
     fs_callback_t callback;
     void *arg_p;
     struct fs_command_t *next_p;
+#if CONFIG_FS_COMMAND_INDEX_SIZE > 0
+    struct fs_command_t *index_next_p;
+#endif
 };
 
 /* Counter. */
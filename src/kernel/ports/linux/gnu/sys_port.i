@@ -32,6 +32,9 @@
 #include <execinfo.h>
 #include <signal.h>
 
+/* Real time between system ticks. */
+#define TICK_PERIOD_NS (10000000L / CONFIG_LINUX_TIME_SPEEDUP)
+
 static pthread_mutex_t mutex;
 
 struct sys_port_t {
@@ -54,12 +57,13 @@ static void *sys_port_ticker(void *arg)
     while (1) {
         clock_gettime(CLOCK_REALTIME, &now);
         abstimeout.tv_sec = now.tv_sec;
+        abstimeout.tv_nsec = (now.tv_nsec + TICK_PERIOD_NS);
 
-        if (now.tv_nsec > 990000000L) {
+        if (abstimeout.tv_nsec >= 1000000000L) {
             abstimeout.tv_sec++;
+            abstimeout.tv_nsec -= 1000000000L;
         }
 
-        abstimeout.tv_nsec = ((now.tv_nsec + 10000000L) % 1000000000L);
         pthread_cond_timedwait(&sys_port.cond, &sys_port.mutex, &abstimeout);
         sys_tick_isr();
     }
@@ -40,7 +40,9 @@ static int time_port_micros(void)
 
     clock_gettime(CLOCK_REALTIME, &now);
 
-    return (now.tv_nsec / 1000);
+    /* Follow the system tick in accelerated time. */
+    return (((1000000ULL * now.tv_sec + now.tv_nsec / 1000)
+             * CONFIG_LINUX_TIME_SPEEDUP) % 1000000);
 }
 
 static int time_port_micros_maximum(void)
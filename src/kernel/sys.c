@@ -560,6 +560,10 @@ int sys_start(void)
 
 void sys_stop(int error)
 {
+#if CONFIG_START_CONSOLE != CONFIG_START_CONSOLE_NONE
+    console_flush();
+#endif
+
     sys_port_stop(error);
 }
 
@@ -584,6 +588,11 @@ void sys_panic(far_string_t fmt_p, ...)
               panic_write,
               chan_size_null);
 
+#if CONFIG_START_CONSOLE != CONFIG_START_CONSOLE_NONE
+    /* Output buffered console output before the panic message. */
+    console_panic_flush(&chan);
+#endif
+
     /* Output the message. */
     va_start(ap, fmt_p);
     std_vfprintf(&chan, fmt_p, &ap);
@@ -32,7 +32,7 @@ static struct slip_t slip;
 static uint8_t slip_buf[128];
 
 static struct soam_t soam;
-static uint8_t soam_buf[128];
+static uint8_t soam_buf[CONFIG_START_SOAM_PACKET_SIZE];
 
 static THRD_STACK(soam_stack, CONFIG_START_SOAM_STACK_SIZE);
 
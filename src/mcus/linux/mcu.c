@@ -31,7 +31,40 @@
 #include "simba.h"
 
 struct pin_device_t pin_device[PIN_DEVICE_MAX];
-struct exti_device_t exti_device[EXTI_DEVICE_MAX];
+struct exti_device_t exti_device[EXTI_DEVICE_MAX] = {
+    { .pin_dev_p = &pin_device[0] },
+    { .pin_dev_p = &pin_device[1] },
+    { .pin_dev_p = &pin_device[2] },
+    { .pin_dev_p = &pin_device[3] },
+    { .pin_dev_p = &pin_device[4] },
+    { .pin_dev_p = &pin_device[5] },
+    { .pin_dev_p = &pin_device[6] },
+    { .pin_dev_p = &pin_device[7] },
+    { .pin_dev_p = &pin_device[8] },
+    { .pin_dev_p = &pin_device[9] },
+    { .pin_dev_p = &pin_device[10] },
+    { .pin_dev_p = &pin_device[11] },
+    { .pin_dev_p = &pin_device[12] },
+    { .pin_dev_p = &pin_device[13] },
+    { .pin_dev_p = &pin_device[14] },
+    { .pin_dev_p = &pin_device[15] },
+    { .pin_dev_p = &pin_device[16] },
+    { .pin_dev_p = &pin_device[17] },
+    { .pin_dev_p = &pin_device[18] },
+    { .pin_dev_p = &pin_device[19] },
+    { .pin_dev_p = &pin_device[20] },
+    { .pin_dev_p = &pin_device[21] },
+    { .pin_dev_p = &pin_device[22] },
+    { .pin_dev_p = &pin_device[23] },
+    { .pin_dev_p = &pin_device[24] },
+    { .pin_dev_p = &pin_device[25] },
+    { .pin_dev_p = &pin_device[26] },
+    { .pin_dev_p = &pin_device[27] },
+    { .pin_dev_p = &pin_device[28] },
+    { .pin_dev_p = &pin_device[29] },
+    { .pin_dev_p = &pin_device[30] },
+    { .pin_dev_p = &pin_device[31] }
+};
 struct uart_device_t uart_device[UART_DEVICE_MAX];
 struct can_device_t can_device[CAN_DEVICE_MAX];
 struct adc_device_t adc_device[ADC_DEVICE_MAX];
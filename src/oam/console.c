@@ -32,16 +32,189 @@
 
 #if CONFIG_START_CONSOLE == CONFIG_START_CONSOLE_UART
 
+#define TX_BUFFER_SIZE CONFIG_START_CONSOLE_UART_TX_BUFFER_SIZE
+
 struct module_t {
     int8_t initialized;
     struct {
         struct uart_driver_t uart;
         char rxbuf[CONFIG_START_CONSOLE_UART_RX_BUFFER_SIZE];
+#if TX_BUFFER_SIZE > 0
+        struct {
+            struct chan_t base;
+            struct mutex_t mutex;
+            struct event_t event;
+            struct sem_t sem;
+            int number_of_waiters;
+            struct thrd_prio_list_t flushers;
+            size_t head;
+            size_t tail;
+            size_t length;
+            uint32_t dropped;
+            char buf[TX_BUFFER_SIZE];
+        } tx;
+#endif
     } console;
 };
 
 static struct module_t module;
 
+#if TX_BUFFER_SIZE > 0
+
+static THRD_STACK(tx_thrd_stack, CONFIG_START_CONSOLE_UART_TX_STACK_SIZE);
+
+/**
+ * Copy as much as possible of given buffer to the TX ring. Called
+ * with the system lock taken.
+ */
+static size_t tx_put_isr(const char *buf_p, size_t size)
+{
+    size_t n;
+    size_t i;
+
+    n = MIN(size, TX_BUFFER_SIZE - module.console.tx.length);
+
+    for (i = 0; i < n; i++) {
+        module.console.tx.buf[module.console.tx.head] = buf_p[i];
+        module.console.tx.head++;
+
+        if (module.console.tx.head == TX_BUFFER_SIZE) {
+            module.console.tx.head = 0;
+        }
+    }
+
+    module.console.tx.length += n;
+
+    return (n);
+}
+
+/**
+ * Output written to the console is added to the TX ring and written
+ * to the UART by the TX thread. The caller only blocks if the ring is
+ * full and the overflow policy is to block.
+ */
+static ssize_t tx_write(void *chan_p, const void *buf_p, size_t size)
+{
+    const char *b_p;
+    size_t left;
+    size_t n;
+    uint32_t mask;
+    int is_full;
+
+    b_p = buf_p;
+    left = size;
+    mask = 0x1;
+
+    mutex_lock(&module.console.tx.mutex);
+
+    while (left > 0) {
+        sys_lock();
+        n = tx_put_isr(b_p, left);
+        is_full = (n < left);
+
+        if (is_full) {
+#if CONFIG_START_CONSOLE_UART_TX_OVERFLOW == CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK
+            module.console.tx.number_of_waiters++;
+#else
+            module.console.tx.dropped += (left - n);
+#endif
+        }
+
+        sys_unlock();
+
+        if (n > 0) {
+            event_write(&module.console.tx.event, &mask, sizeof(mask));
+        }
+
+        b_p += n;
+        left -= n;
+
+        if (is_full) {
+#if CONFIG_START_CONSOLE_UART_TX_OVERFLOW == CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK
+            sem_take(&module.console.tx.sem, NULL);
+#else
+            break;
+#endif
+        }
+    }
+
+    mutex_unlock(&module.console.tx.mutex);
+
+    return (size);
+}
+
+/**
+ * Resume all threads waiting in `console_flush()`. Called with the
+ * system lock taken.
+ */
+static void resume_flushers_isr(void)
+{
+    struct thrd_prio_list_elem_t *elem_p;
+
+    while ((elem_p = thrd_prio_list_pop_isr(&module.console.tx.flushers))
+           != NULL) {
+        thrd_resume_isr(elem_p->thrd_p, 0);
+    }
+}
+
+/**
+ * Write the TX ring contents to the UART. The contiguous part of the
+ * ring is written directly and freed after the write.
+ */
+static void *tx_main(void *arg_p)
+{
+    uint32_t mask;
+    size_t size;
+    int number_of_waiters;
+
+    thrd_set_name("console_tx");
+
+    while (1) {
+        mask = 0x1;
+        event_read(&module.console.tx.event, &mask, sizeof(mask));
+
+        while (1) {
+            sys_lock();
+            size = MIN(module.console.tx.length,
+                       TX_BUFFER_SIZE - module.console.tx.tail);
+            sys_unlock();
+
+            if (size == 0) {
+                break;
+            }
+
+            chan_write(&module.console.uart.base,
+                       &module.console.tx.buf[module.console.tx.tail],
+                       size);
+
+            sys_lock();
+            module.console.tx.tail += size;
+
+            if (module.console.tx.tail == TX_BUFFER_SIZE) {
+                module.console.tx.tail = 0;
+            }
+
+            module.console.tx.length -= size;
+            number_of_waiters = module.console.tx.number_of_waiters;
+            module.console.tx.number_of_waiters = 0;
+
+            if (module.console.tx.length == 0) {
+                resume_flushers_isr();
+            }
+
+            sys_unlock();
+
+            if (number_of_waiters > 0) {
+                sem_give(&module.console.tx.sem, number_of_waiters);
+            }
+        }
+    }
+
+    return (NULL);
+}
+
+#endif
+
 int console_module_init(void)
 {
     return (uart_module_init());
@@ -49,6 +222,22 @@ int console_module_init(void)
 
 int console_init(void)
 {
+#if TX_BUFFER_SIZE > 0
+    chan_init(&module.console.tx.base,
+              chan_read_null,
+              tx_write,
+              chan_size_null);
+    mutex_init(&module.console.tx.mutex);
+    event_init(&module.console.tx.event);
+    sem_init(&module.console.tx.sem, 1, 1);
+    module.console.tx.number_of_waiters = 0;
+    thrd_prio_list_init(&module.console.tx.flushers);
+    module.console.tx.head = 0;
+    module.console.tx.tail = 0;
+    module.console.tx.length = 0;
+    module.console.tx.dropped = 0;
+#endif
+
     return (uart_init(&module.console.uart,
                       &uart_device[CONFIG_START_CONSOLE_DEVICE_INDEX],
                       CONFIG_START_CONSOLE_UART_BAUDRATE,
@@ -58,7 +247,21 @@ int console_init(void)
 
 int console_start(void)
 {
-    return (uart_start(&module.console.uart));
+    int res;
+
+    res = uart_start(&module.console.uart);
+
+#if TX_BUFFER_SIZE > 0
+    if (res == 0) {
+        thrd_spawn(tx_main,
+                   NULL,
+                   CONFIG_START_CONSOLE_UART_TX_PRIO,
+                   tx_thrd_stack,
+                   sizeof(tx_thrd_stack));
+    }
+#endif
+
+    return (res);
 }
 
 int console_stop(void)
@@ -66,6 +269,68 @@ int console_stop(void)
     return (uart_stop(&module.console.uart));
 }
 
+int console_flush(void)
+{
+#if TX_BUFFER_SIZE > 0
+    struct thrd_prio_list_elem_t elem;
+    struct time_t timeout;
+    int res;
+
+    timeout.seconds = (CONFIG_START_CONSOLE_UART_TX_FLUSH_TIMEOUT_MS / 1000);
+    timeout.nanoseconds =
+        1000000L * (CONFIG_START_CONSOLE_UART_TX_FLUSH_TIMEOUT_MS % 1000);
+    res = 0;
+
+    /* Wait for the TX thread to empty the ring. */
+    sys_lock();
+
+    if (module.console.tx.length > 0) {
+        elem.thrd_p = thrd_self();
+        thrd_prio_list_push_isr(&module.console.tx.flushers, &elem);
+        res = thrd_suspend_isr(&timeout);
+
+        if (res == -ETIMEDOUT) {
+            thrd_prio_list_remove_isr(&module.console.tx.flushers, &elem);
+        }
+    }
+
+    sys_unlock();
+
+    return (res);
+#else
+    return (0);
+#endif
+}
+
+uint32_t console_get_tx_dropped(void)
+{
+#if TX_BUFFER_SIZE > 0
+    return (module.console.tx.dropped);
+#else
+    return (0);
+#endif
+}
+
+void console_panic_flush(void *chan_p)
+{
+#if TX_BUFFER_SIZE > 0
+    size_t size;
+
+    while (module.console.tx.length > 0) {
+        size = MIN(module.console.tx.length,
+                   TX_BUFFER_SIZE - module.console.tx.tail);
+        chan_write(chan_p, &module.console.tx.buf[module.console.tx.tail], size);
+        module.console.tx.tail += size;
+
+        if (module.console.tx.tail == TX_BUFFER_SIZE) {
+            module.console.tx.tail = 0;
+        }
+
+        module.console.tx.length -= size;
+    }
+#endif
+}
+
 int console_set_input_channel(void *chan_p)
 {
     return (-1);
@@ -83,7 +348,11 @@ void *console_set_output_channel(void *chan_p)
 
 void *console_get_output_channel()
 {
+#if TX_BUFFER_SIZE > 0
+    return (&module.console.tx.base);
+#else
     return (&module.console.uart.base);
+#endif
 }
 
 #elif CONFIG_START_CONSOLE == CONFIG_START_CONSOLE_USB_CDC
@@ -152,6 +421,20 @@ int console_stop(void)
     return (usb_device_stop(&module.console.usb));
 }
 
+int console_flush(void)
+{
+    return (0);
+}
+
+uint32_t console_get_tx_dropped(void)
+{
+    return (0);
+}
+
+void console_panic_flush(void *chan_p)
+{
+}
+
 int console_set_input_channel(void *chan_p)
 {
     return (-1);
@@ -213,6 +496,20 @@ int console_stop(void)
     return (0);
 }
 
+int console_flush(void)
+{
+    return (0);
+}
+
+uint32_t console_get_tx_dropped(void)
+{
+    return (0);
+}
+
+void console_panic_flush(void *chan_p)
+{
+}
+
 int console_set_input_channel(void *chan_p)
 {
     module.console.chin_p = chan_p;
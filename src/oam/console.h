@@ -65,6 +65,33 @@ int console_start(void);
  */
 int console_stop(void);
 
+/**
+ * Wait until all buffered console output has been written to the
+ * console device, or until
+ * ``CONFIG_START_CONSOLE_UART_TX_FLUSH_TIMEOUT_MS`` has passed.
+ *
+ * @return zero(0) or negative error code.
+ */
+int console_flush(void);
+
+/**
+ * Get the number of bytes dropped because the console TX ring buffer
+ * was full. Only non-zero if the overflow policy is
+ * ``CONFIG_START_CONSOLE_UART_TX_OVERFLOW_DROP``.
+ *
+ * @return Number of dropped bytes.
+ */
+uint32_t console_get_tx_dropped(void);
+
+/**
+ * Write all buffered console output to given channel, bypassing the
+ * console device driver. Only called by `sys_panic()`, with the
+ * system lock taken, so output written before the panic is not lost.
+ *
+ * @param[in] chan_p Channel to write the buffered output to.
+ */
+void console_panic_flush(void *chan_p);
+
 /**
  * Set the pointer to the input channel.
  *
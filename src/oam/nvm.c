@@ -199,3 +199,10 @@ ssize_t nvm_write(uint32_t dst, const void *src_p, size_t size)
 
     return (nvm_port_write(dst, src_p, size));
 }
+
+int nvm_sync(void)
+{
+    ASSERTN(module.initialized == 1, EINVAL);
+
+    return (nvm_port_sync());
+}
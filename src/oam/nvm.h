@@ -84,4 +84,12 @@ ssize_t nvm_read(void *dst_p, uint32_t src, size_t size);
  */
 ssize_t nvm_write(uint32_t dst, const void *src_p, size_t size);
 
+/**
+ * Commit all writes to the non-volatile memory. Writes may be
+ * buffered by the port until this function is called.
+ *
+ * @return zero(0) or negative error code.
+ */
+int nvm_sync(void);
+
 #endif
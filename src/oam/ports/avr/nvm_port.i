@@ -61,3 +61,8 @@ static ssize_t nvm_port_write(size_t dst, const void *src_p, size_t size)
 
     return (size);
 }
+
+static int nvm_port_sync()
+{
+    return (0);
+}
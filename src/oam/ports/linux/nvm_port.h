@@ -31,8 +31,17 @@
 #ifndef __OAM_NVM_PORT_H__
 #define __OAM_NVM_PORT_H__
 
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+
 struct module_port_t {
-    FILE *nvm_p;
+    int fd;
+    int journal_fd;
+    size_t journal_size;
+    uint8_t *nvm_p;
 };
 
 #endif
@@ -29,9 +29,179 @@
  */
 
 #define NVM_FILENAME "nvm.bin"
+#define NVM_JOURNAL_FILENAME "nvm.bin.journal"
+
+#define JOURNAL_RECORD_MAGIC                              0x6e766d6a
+
+/**
+ * Every write is appended to the journal before the memory mapped
+ * file is modified, and the journal is replayed at mount. A write
+ * interrupted by a crash is thereby either fully applied or not at
+ * all. The journal is emptied on sync.
+ */
+struct journal_record_t {
+    uint32_t magic;
+    uint32_t address;
+    uint32_t size;
+    uint32_t checksum;
+};
+
+static uint32_t journal_checksum(uint32_t checksum,
+                                 const uint8_t *buf_p,
+                                 size_t size)
+{
+    while (size > 0) {
+        checksum ^= *buf_p++;
+        checksum *= 0x01000193;
+        size--;
+    }
+
+    return (checksum);
+}
+
+static uint32_t journal_record_checksum(struct journal_record_t *record_p)
+{
+    return (journal_checksum(0x811c9dc5,
+                             (uint8_t *)&record_p->address,
+                             2 * sizeof(uint32_t)));
+}
+
+/**
+ * Apply all complete records in the journal. Stops at the first
+ * truncated or corrupt record.
+ */
+static void journal_replay(void)
+{
+    struct journal_record_t record;
+    uint8_t buf[128];
+    off_t offset;
+    uint32_t checksum;
+    size_t left;
+    size_t size;
+
+    offset = 0;
+
+    while (pread(module.port.journal_fd,
+                 &record,
+                 sizeof(record),
+                 offset) == sizeof(record)) {
+        if (record.magic != JOURNAL_RECORD_MAGIC) {
+            break;
+        }
+
+        if ((record.size > CONFIG_NVM_SIZE)
+            || (record.address > CONFIG_NVM_SIZE - record.size)) {
+            break;
+        }
+
+        offset += sizeof(record);
+
+        /* Validate the data before applying it. */
+        checksum = journal_record_checksum(&record);
+        left = record.size;
+
+        while (left > 0) {
+            size = MIN(left, sizeof(buf));
+
+            if (pread(module.port.journal_fd,
+                      &buf[0],
+                      size,
+                      offset + record.size - left) != size) {
+                return;
+            }
+
+            checksum = journal_checksum(checksum, &buf[0], size);
+            left -= size;
+        }
+
+        if (checksum != record.checksum) {
+            break;
+        }
+
+        if (pread(module.port.journal_fd,
+                  &module.port.nvm_p[record.address],
+                  record.size,
+                  offset) != record.size) {
+            break;
+        }
+
+        offset += record.size;
+    }
+}
+
+static int journal_append(size_t dst, const void *src_p, size_t size)
+{
+    struct journal_record_t record;
+    struct iovec iov[2];
+
+    record.magic = JOURNAL_RECORD_MAGIC;
+    record.address = dst;
+    record.size = size;
+    record.checksum = journal_checksum(journal_record_checksum(&record),
+                                       src_p,
+                                       size);
+
+    iov[0].iov_base = &record;
+    iov[0].iov_len = sizeof(record);
+    iov[1].iov_base = (void *)src_p;
+    iov[1].iov_len = size;
+
+    if (writev(module.port.journal_fd, &iov[0], 2) != sizeof(record) + size) {
+        return (-EIO);
+    }
+
+    /* The record must be on disk before the image is modified. */
+    if (fdatasync(module.port.journal_fd) != 0) {
+        return (-EIO);
+    }
+
+    module.port.journal_size += (sizeof(record) + size);
+
+    return (0);
+}
+
+static void unmount(void)
+{
+    if (module.port.nvm_p != NULL) {
+        (void)munmap(module.port.nvm_p, CONFIG_NVM_SIZE);
+        module.port.nvm_p = NULL;
+    }
+
+    if (module.port.fd != -1) {
+        (void)close(module.port.fd);
+        module.port.fd = -1;
+    }
+
+    if (module.port.journal_fd != -1) {
+        (void)close(module.port.journal_fd);
+        module.port.journal_fd = -1;
+    }
+}
+
+static int nvm_port_sync()
+{
+    if (module.port.nvm_p == NULL) {
+        return (-EINVAL);
+    }
+
+    if (msync(module.port.nvm_p, CONFIG_NVM_SIZE, MS_SYNC) != 0) {
+        return (-EIO);
+    }
+
+    if (ftruncate(module.port.journal_fd, 0) != 0) {
+        return (-EIO);
+    }
+
+    module.port.journal_size = 0;
+
+    return (0);
+}
 
 static int nvm_port_module_init()
 {
+    module.port.fd = -1;
+    module.port.journal_fd = -1;
+    module.port.journal_size = 0;
     module.port.nvm_p = NULL;
 
     return (0);
@@ -39,35 +209,88 @@ static int nvm_port_module_init()
 
 static int nvm_port_mount()
 {
-    module.port.nvm_p = fopen(NVM_FILENAME, "r+");
+    struct stat st;
+    void *nvm_p;
 
-    if (module.port.nvm_p == NULL) {
+    unmount();
+
+    module.port.fd = open(NVM_FILENAME, O_RDWR);
+
+    if (module.port.fd == -1) {
         return (-1);
-    } else {
-        return (0);
     }
+
+    /* The file is recreated by format if the configured size has
+       grown. */
+    if ((fstat(module.port.fd, &st) != 0)
+        || (st.st_size < CONFIG_NVM_SIZE)) {
+        unmount();
+
+        return (-1);
+    }
+
+    nvm_p = mmap(NULL,
+                 CONFIG_NVM_SIZE,
+                 PROT_READ | PROT_WRITE,
+                 MAP_SHARED,
+                 module.port.fd,
+                 0);
+
+    if (nvm_p == MAP_FAILED) {
+        unmount();
+
+        return (-1);
+    }
+
+    module.port.nvm_p = nvm_p;
+    module.port.journal_fd = open(NVM_JOURNAL_FILENAME,
+                                  O_RDWR | O_CREAT | O_APPEND,
+                                  0644);
+
+    if (module.port.journal_fd == -1) {
+        unmount();
+
+        return (-1);
+    }
+
+    journal_replay();
+
+    return (nvm_port_sync());
 }
 
 static int nvm_port_format()
 {
-    if (module.port.nvm_p == NULL) {
-        module.port.nvm_p = fopen(NVM_FILENAME, "w+");
+    int fd;
+    uint8_t buf[256];
+    size_t left;
+    size_t size;
+
+    unmount();
+
+    fd = open(NVM_FILENAME, O_RDWR | O_CREAT | O_TRUNC, 0644);
+
+    if (fd == -1) {
+        return (-1);
     }
 
-    ASSERTN(module.port.nvm_p != NULL, EINVAL);
+    memset(&buf[0], 0xff, sizeof(buf));
+    left = CONFIG_NVM_SIZE;
+
+    while (left > 0) {
+        size = MIN(left, sizeof(buf));
 
-    int i;
-    uint8_t byte;
+        if (write(fd, &buf[0], size) != size) {
+            (void)close(fd);
 
-    byte = 0xff;
-    (void)fseek(module.port.nvm_p, 0, SEEK_SET);
+            return (-1);
+        }
 
-    for (i = 0; i < CONFIG_NVM_SIZE; i++) {
-        fwrite(&byte, 1, sizeof(byte), module.port.nvm_p);
+        left -= size;
     }
 
-    fclose(module.port.nvm_p);
-    module.port.nvm_p = NULL;
+    (void)fsync(fd);
+    (void)close(fd);
+    (void)unlink(NVM_JOURNAL_FILENAME);
 
     return (0);
 }
@@ -82,13 +305,18 @@ static ssize_t nvm_port_read(void *dst_p, size_t src, size_t size)
         return (-EINVAL);
     }
 
-    (void)fseek(module.port.nvm_p, src, SEEK_SET);
+    if (module.port.nvm_p == NULL) {
+        return (-EINVAL);
+    }
+
+    memcpy(dst_p, &module.port.nvm_p[src], size);
 
-    return (fread(dst_p, 1, size, module.port.nvm_p));
+    return (size);
 }
 
 static ssize_t nvm_port_write(size_t dst, const void *src_p, size_t size)
 {
+    int res;
 
     if (dst >= CONFIG_NVM_SIZE) {
         return (-EINVAL);
@@ -98,7 +326,26 @@ static ssize_t nvm_port_write(size_t dst, const void *src_p, size_t size)
         return (-EINVAL);
     }
 
-    (void)fseek(module.port.nvm_p, dst, SEEK_SET);
+    if (module.port.nvm_p == NULL) {
+        return (-EINVAL);
+    }
+
+    res = journal_append(dst, src_p, size);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    memcpy(&module.port.nvm_p[dst], src_p, size);
+
+    /* Keep the journal bounded if sync is never called. */
+    if (module.port.journal_size > CONFIG_NVM_JOURNAL_SIZE_MAX) {
+        res = nvm_port_sync();
+
+        if (res != 0) {
+            return (res);
+        }
+    }
 
-    return (fwrite(src_p, 1, size, module.port.nvm_p));
+    return (size);
 }
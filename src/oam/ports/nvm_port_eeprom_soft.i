@@ -82,3 +82,8 @@ static ssize_t nvm_port_write(size_t dst, const void *src_p, size_t size)
 {
     return (eeprom_soft_write(&module.port.eeprom_soft, dst, src_p, size));
 }
+
+static int nvm_port_sync()
+{
+    return (0);
+}
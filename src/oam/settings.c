@@ -32,6 +32,22 @@
 
 struct module_t {
     int8_t initialized;
+#if CONFIG_SETTINGS_CACHE == 1
+    struct {
+        struct sem_t sem;
+        int8_t loaded;
+        size_t dirty_begin;
+        size_t dirty_end;
+        uint8_t buf[CONFIG_SETTINGS_AREA_SIZE];
+    } cache;
+#    if CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    struct {
+        struct timer_t timer;
+        struct event_t event;
+        volatile int8_t expired;
+    } sync;
+#    endif
+#endif
 #if CONFIG_SETTINGS_FS_COMMAND_LIST == 1
     struct fs_command_t cmd_list;
 #endif
@@ -48,14 +64,65 @@ struct module_t {
 
 static struct module_t module;
 
+#if CONFIG_SETTINGS_CACHE == 1 && CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+static THRD_STACK(sync_thrd_stack, CONFIG_SETTINGS_SYNC_STACK_SIZE);
+#endif
+
 extern const FAR struct setting_t settings[];
 const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE]
 __attribute__ ((weak)) = { 0xff, };
 
+/* Applications generated by an older simbagen.py have no hash. */
+const FAR struct settings_hash_t settings_hash
+__attribute__ ((weak)) = { 0, NULL, NULL };
+
+/**
+ * FNV-1a hash of given name. A non-zero seed replaces the offset
+ * basis. Must match the hash function in simbagen.py.
+ */
+static uint32_t hash_name(uint32_t seed, const char *name_p)
+{
+    uint32_t hash;
+
+    if (seed == 0) {
+        hash = 0x811c9dc5;
+    } else {
+        hash = seed;
+    }
+
+    while (*name_p != '\0') {
+        hash ^= (uint8_t)*name_p++;
+        hash *= 0x01000193;
+    }
+
+    return (hash);
+}
+
 static const FAR struct setting_t *get_setting_by_name(
     const char *name_p)
 {
     const FAR struct setting_t *setting_p;
+    int16_t displacement;
+    size_t slot;
+
+    if (settings_hash.size > 0) {
+        slot = (hash_name(0, name_p) % settings_hash.size);
+        displacement = settings_hash.displacements_p[slot];
+
+        if (displacement < 0) {
+            slot = (-displacement - 1);
+        } else {
+            slot = (hash_name(displacement, name_p) % settings_hash.size);
+        }
+
+        setting_p = &settings[settings_hash.indexes_p[slot]];
+
+        if (std_strcmp(name_p, setting_p->name_p) != 0) {
+            return (NULL);
+        }
+
+        return (setting_p);
+    }
 
     setting_p = &settings[0];
 
@@ -382,6 +449,141 @@ static int cmd_write_cb(int argc,
 
 #endif
 
+#if CONFIG_SETTINGS_CACHE == 1
+
+/**
+ * Read the settings area into the cache on first use. NVM is mounted
+ * by then. Called with the cache semaphore taken.
+ */
+static int cache_load(void)
+{
+    if (module.cache.loaded == 1) {
+        return (0);
+    }
+
+    if (nvm_read(&module.cache.buf[0], 0, sizeof(module.cache.buf))
+        != sizeof(module.cache.buf)) {
+        return (-EIO);
+    }
+
+    module.cache.loaded = 1;
+
+    return (0);
+}
+
+/**
+ * Write the dirty range, if any, to NVM in a single write. Called
+ * with the cache semaphore taken.
+ */
+static int cache_sync(void)
+{
+    size_t address;
+    size_t size;
+
+    if (module.cache.dirty_begin >= module.cache.dirty_end) {
+        return (0);
+    }
+
+    address = module.cache.dirty_begin;
+    size = (module.cache.dirty_end - address);
+
+    if (nvm_write(address, &module.cache.buf[address], size) != size) {
+        return (-EIO);
+    }
+
+    if (nvm_sync() != 0) {
+        return (-EIO);
+    }
+
+    module.cache.dirty_begin = sizeof(module.cache.buf);
+    module.cache.dirty_end = 0;
+
+    return (0);
+}
+
+/**
+ * Extend the dirty range with given range and write it to NVM now or
+ * when the sync timer expires. The timer is restarted on each write
+ * so a burst of writes results in a single NVM write.
+ */
+static int cache_mark_dirty(size_t address, size_t size)
+{
+    module.cache.dirty_begin = MIN(module.cache.dirty_begin, address);
+    module.cache.dirty_end = MAX(module.cache.dirty_end, address + size);
+
+#if CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    timer_stop(&module.sync.timer);
+    module.sync.expired = 0;
+    timer_start(&module.sync.timer);
+
+    return (0);
+#else
+    return (cache_sync());
+#endif
+}
+
+#    if CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+
+static void sync_timer_cb(void *arg_p)
+{
+    uint32_t mask;
+
+    module.sync.expired = 1;
+    mask = 0x1;
+    event_write_isr(&module.sync.event, &mask, sizeof(mask));
+}
+
+static void *sync_main(void *arg_p)
+{
+    uint32_t mask;
+
+    thrd_set_name("settings_sync");
+
+    while (1) {
+        mask = 0x1;
+        event_read(&module.sync.event, &mask, sizeof(mask));
+
+        /* Skip the sync if the timer was restarted by a write, or
+           stopped by settings_sync(), after it expired. */
+        sem_take(&module.cache.sem, NULL);
+
+        if (module.sync.expired == 1) {
+            module.sync.expired = 0;
+            (void)cache_sync();
+        }
+
+        sem_give(&module.cache.sem, 1);
+    }
+
+    return (NULL);
+}
+
+#    endif
+
+static int reset(size_t address, size_t size)
+{
+    size_t i;
+    int res;
+
+    sem_take(&module.cache.sem, NULL);
+
+    res = cache_load();
+
+    if (res == 0) {
+        for (i = address; i < address + size; i++) {
+            module.cache.buf[i] = settings_default[i];
+        }
+
+        res = cache_mark_dirty(address, size);
+    }
+
+    sem_give(&module.cache.sem, 1);
+
+    return (res);
+}
+
+#else
+
 static int reset(size_t address, size_t size)
 {
     size_t i;
@@ -412,8 +614,14 @@ static int reset(size_t address, size_t size)
     return (0);
 }
 
+#endif
+
 int settings_module_init(void)
 {
+#if CONFIG_SETTINGS_CACHE == 1 && CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    struct time_t timeout;
+#endif
+
     /* Return immediately if the module is already initialized. */
     if (module.initialized == 1) {
         return (0);
@@ -421,6 +629,26 @@ int settings_module_init(void)
 
     module.initialized = 1;
 
+#if CONFIG_SETTINGS_CACHE == 1
+    sem_init(&module.cache.sem, 0, 1);
+    module.cache.loaded = 0;
+    module.cache.dirty_begin = sizeof(module.cache.buf);
+    module.cache.dirty_end = 0;
+
+#    if CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    timeout.seconds = (CONFIG_SETTINGS_SYNC_DELAY_MS / 1000);
+    timeout.nanoseconds = 1000000L * (CONFIG_SETTINGS_SYNC_DELAY_MS % 1000);
+    module.sync.expired = 0;
+    event_init(&module.sync.event);
+    timer_init(&module.sync.timer, &timeout, sync_timer_cb, NULL, 0);
+    thrd_spawn(sync_main,
+               NULL,
+               0,
+               sync_thrd_stack,
+               sizeof(sync_thrd_stack));
+#    endif
+#endif
+
 #if CONFIG_SETTINGS_FS_COMMAND_LIST == 1
     fs_command_init(&module.cmd_list,
                     CSTR("/oam/settings/list"),
@@ -461,7 +689,27 @@ ssize_t settings_read(void *dst_p, size_t src, size_t size)
     ASSERTN(dst_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
+#if CONFIG_SETTINGS_CACHE == 1
+    int res;
+
+    if (src + size > sizeof(module.cache.buf)) {
+        return (-EINVAL);
+    }
+
+    sem_take(&module.cache.sem, NULL);
+
+    res = cache_load();
+
+    if (res == 0) {
+        memcpy(dst_p, &module.cache.buf[src], size);
+    }
+
+    sem_give(&module.cache.sem, 1);
+
+    return (res == 0 ? size : res);
+#else
     return (nvm_read(dst_p, src, size));
+#endif
 }
 
 ssize_t settings_write(size_t dst, const void *src_p, size_t size)
@@ -469,7 +717,28 @@ ssize_t settings_write(size_t dst, const void *src_p, size_t size)
     ASSERTN(src_p != NULL, EINVAL);
     ASSERTN(size > 0, EINVAL);
 
+#if CONFIG_SETTINGS_CACHE == 1
+    int res;
+
+    if (dst + size > sizeof(module.cache.buf)) {
+        return (-EINVAL);
+    }
+
+    sem_take(&module.cache.sem, NULL);
+
+    res = cache_load();
+
+    if (res == 0) {
+        memcpy(&module.cache.buf[dst], src_p, size);
+        res = cache_mark_dirty(dst, size);
+    }
+
+    sem_give(&module.cache.sem, 1);
+
+    return (res == 0 ? size : res);
+#else
     return (nvm_write(dst, src_p, size));
+#endif
 }
 
 int settings_reset(size_t address, size_t size)
@@ -550,3 +819,22 @@ int settings_reset_all()
 {
     return (reset(0, sizeof(settings_default)));
 }
+
+int settings_sync(void)
+{
+#if CONFIG_SETTINGS_CACHE == 1
+    int res;
+
+    sem_take(&module.cache.sem, NULL);
+#    if CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    timer_stop(&module.sync.timer);
+    module.sync.expired = 0;
+#    endif
+    res = cache_sync();
+    sem_give(&module.cache.sem, 1);
+
+    return (res);
+#else
+    return (0);
+#endif
+}
@@ -51,6 +51,19 @@ struct setting_t {
     size_t size;
 };
 
+/**
+ * Perfect hash of the setting names, generated by simbagen.py. The
+ * name is first hashed with seed zero to select a displacement. A
+ * negative displacement is the slot minus one, otherwise the name is
+ * hashed again with the displacement as seed. The slot indexes the
+ * settings array through `indexes_p`.
+ */
+struct settings_hash_t {
+    size_t size;
+    FAR const int16_t *displacements_p;
+    FAR const uint16_t *indexes_p;
+};
+
 /**
  * Initialize the settings module. This function must be called before
  * calling any other function in this module.
@@ -138,4 +151,12 @@ int settings_reset_by_name(const char *name_p,
  */
 int settings_reset_all(void);
 
+/**
+ * Write all cached settings writes to NVM. Does nothing if the
+ * settings cache is disabled.
+ *
+ * @return zero(0) or negative error code.
+ */
+int settings_sync(void);
+
 #endif
@@ -52,6 +52,10 @@ static struct module_t module;
 
 static struct fs_command_t cmd_logout;
 
+#if CONFIG_SHELL_BATCH == 1
+static struct fs_command_t cmd_batch;
+#endif
+
 #if CONFIG_SHELL_MINIMAL == 0
 
 static struct fs_command_t cmd_help;
@@ -94,7 +98,8 @@ static int is_shell_command(const char *line_p)
 
     return (shell_command_compare(line_p, FSTR("logout"), 6)
             || shell_command_compare(line_p, FSTR("history"), 7)
-            || shell_command_compare(line_p, FSTR("help"), 4));
+            || shell_command_compare(line_p, FSTR("help"), 4)
+            || shell_command_compare(line_p, FSTR("batch"), 5));
 }
 
 /**
@@ -113,9 +118,47 @@ static int cmd_logout_cb(int argc,
         self_p->authorized = 0;
     }
 
+#if CONFIG_SHELL_BATCH == 1
+    self_p->batch.enabled = 0;
+#endif
+
     return (1);
 }
 
+#if CONFIG_SHELL_BATCH == 1
+
+/**
+ * Enter or leave batch mode.
+ */
+static int cmd_batch_cb(int argc,
+                        const char *argv[],
+                        void *chout_p,
+                        void *chin_p,
+                        void *arg_p,
+                        void *call_arg_p)
+{
+    struct shell_t *self_p = call_arg_p;
+
+    if ((argc == 1) || ((argc == 2) && (strcmp(argv[1], "on") == 0))) {
+        if (self_p->batch.enabled == 0) {
+            self_p->batch.enabled = 1;
+            self_p->batch.sequence_number = 0;
+            self_p->batch.pos = 0;
+            self_p->batch.size = 0;
+        }
+    } else if ((argc == 2) && (strcmp(argv[1], "off") == 0)) {
+        self_p->batch.enabled = 0;
+    } else {
+        std_fprintf(chout_p, FSTR("Usage: batch [on|off]\r\n"));
+
+        return (-EINVAL);
+    }
+
+    return (0);
+}
+
+#endif
+
 static int line_init(struct shell_line_t *self_p)
 {
     self_p->buf[0] = '\0';
@@ -1153,6 +1196,129 @@ static int read_command(struct shell_t *self_p)
     return (-E2BIG);
 }
 
+#if CONFIG_SHELL_BATCH == 1
+
+/**
+ * Read the next command in batch mode. All available input is read
+ * into the batch buffer at once, and commands are taken from it
+ * without echo, history or line editing.
+ *
+ * @return Command length or negative error code.
+ */
+static int read_batch_command(struct shell_t *self_p)
+{
+    size_t size;
+    size_t length;
+    char *begin_p;
+    char *end_p;
+    int too_long;
+
+    line_init(&self_p->line);
+    too_long = 0;
+
+    while (1) {
+        /* Read all available input into the batch buffer. */
+        if (self_p->batch.pos == self_p->batch.size) {
+            if (chan_read(self_p->chin_p, &self_p->batch.buf[0], 1) != 1) {
+                return (-EIO);
+            }
+
+            size = MIN(chan_size(self_p->chin_p),
+                       sizeof(self_p->batch.buf) - 1);
+
+            if (size > 0) {
+                if (chan_read(self_p->chin_p,
+                              &self_p->batch.buf[1],
+                              size) != size) {
+                    return (-EIO);
+                }
+            }
+
+            self_p->batch.pos = 0;
+            self_p->batch.size = (size + 1);
+        }
+
+        /* Append input up to the next newline to the line. */
+        begin_p = &self_p->batch.buf[self_p->batch.pos];
+        size = (self_p->batch.size - self_p->batch.pos);
+        end_p = memchr(begin_p, NEWLINE, size);
+
+        if (end_p != NULL) {
+            size = (end_p - begin_p);
+        }
+
+        self_p->batch.pos += size;
+        length = MIN(size,
+                     CONFIG_SHELL_COMMAND_MAX - 1 - self_p->line.length);
+
+        if (length < size) {
+            too_long = 1;
+        }
+
+        memcpy(&self_p->line.buf[self_p->line.length], begin_p, length);
+        self_p->line.length += length;
+        self_p->line.buf[self_p->line.length] = '\0';
+
+        if (end_p != NULL) {
+            /* Skip the newline. */
+            self_p->batch.pos++;
+
+            if (too_long == 1) {
+                return (-E2BIG);
+            }
+
+            return (line_get_length(&self_p->line));
+        }
+    }
+
+    return (-E2BIG);
+}
+
+/**
+ * Output the status line of a command executed in batch mode.
+ */
+static void print_batch_status(struct shell_t *self_p, int res)
+{
+    self_p->batch.sequence_number++;
+
+    if (res == 0) {
+        std_fprintf(self_p->chout_p,
+                    OSTR("[%lu] OK\r\n"),
+                    (unsigned long)self_p->batch.sequence_number);
+    } else {
+        std_fprintf(self_p->chout_p,
+                    OSTR("[%lu] ERROR(%d)\r\n"),
+                    (unsigned long)self_p->batch.sequence_number,
+                    res);
+    }
+}
+
+/**
+ * Check if given shell is in batch mode.
+ */
+static int is_batch(struct shell_t *self_p)
+{
+    return (self_p->batch.enabled);
+}
+
+#else
+
+static int read_batch_command(struct shell_t *self_p)
+{
+    return (-ENOSYS);
+}
+
+static void print_batch_status(struct shell_t *self_p, int res)
+{
+}
+
+static int is_batch(struct shell_t *self_p)
+{
+    return (0);
+}
+
+#endif
+
 int shell_module_init()
 {
     /* Return immediately if the module is already initialized. */
@@ -1168,6 +1334,14 @@ int shell_module_init()
                     NULL);
     fs_command_register(&cmd_logout);
 
+#if CONFIG_SHELL_BATCH == 1
+    fs_command_init(&cmd_batch,
+                    FSTR("/batch"),
+                    cmd_batch_cb,
+                    NULL);
+    fs_command_register(&cmd_batch);
+#endif
+
 #if CONFIG_SHELL_MINIMAL == 0
 
     fs_command_init(&cmd_history,
@@ -1213,6 +1387,10 @@ int shell_init(struct shell_t *self_p,
         self_p->authorized = 0;
     }
 
+#if CONFIG_SHELL_BATCH == 1
+    self_p->batch.enabled = 0;
+#endif
+
 #if CONFIG_SHELL_MINIMAL == 0
     /* Initialize the history. */
     history_init(self_p);
@@ -1227,6 +1405,7 @@ void *shell_main(void *arg_p)
 
     struct shell_t *self_p;
     int res;
+    int batch;
     char *stripped_line_p;
 
     self_p = arg_p;
@@ -1246,7 +1425,11 @@ void *shell_main(void *arg_p)
         }
 
         /* Read command.*/
-        res = read_command(self_p);
+        if (is_batch(self_p)) {
+            res = read_batch_command(self_p);
+        } else {
+            res = read_command(self_p);
+        }
 
         if (res > 0) {
             stripped_line_p = std_strip(line_get_buf(&self_p->line),
@@ -1254,11 +1437,19 @@ void *shell_main(void *arg_p)
 
             if (is_comment(stripped_line_p) == 1) {
                 /* Just print a prompt. */
+            } else if (is_batch(self_p) && (*stripped_line_p == '\0')) {
+                /* Empty lines are ignored in batch mode. */
             } else if (is_shell_command(stripped_line_p) == 1) {
-                (void)fs_call(stripped_line_p,
+                batch = is_batch(self_p);
+                res = fs_call(stripped_line_p,
                               self_p->chin_p,
                               self_p->chout_p,
                               self_p);
+
+                if (batch && is_batch(self_p)) {
+                    print_batch_status(self_p, res);
+                }
+
                 continue;
             } else {
                 res = fs_call(stripped_line_p,
@@ -1266,7 +1457,9 @@ void *shell_main(void *arg_p)
                               self_p->chout_p,
                               self_p->arg_p);
 
-                if (res == 0) {
+                if (is_batch(self_p)) {
+                    print_batch_status(self_p, res);
+                } else if (res == 0) {
                     std_fprintf(self_p->chout_p, OSTR("OK\r\n"));
                 } else {
                     std_fprintf(self_p->chout_p, OSTR("ERROR(%d)\r\n"), res);
@@ -1274,6 +1467,13 @@ void *shell_main(void *arg_p)
             }
         } else if (res == -EIO) {
             break;
+        } else if ((res == -E2BIG) && is_batch(self_p)) {
+            print_batch_status(self_p, res);
+        }
+
+        /* No prompt in batch mode. */
+        if (is_batch(self_p)) {
+            continue;
         }
 
         std_fprintf(self_p->chout_p, FSTR(CONFIG_SHELL_PROMPT));
@@ -58,6 +58,16 @@ struct shell_t {
     int newline_received;
     int authorized;
 
+#if CONFIG_SHELL_BATCH == 1
+    struct {
+        int enabled;
+        uint32_t sequence_number;
+        size_t pos;
+        size_t size;
+        char buf[CONFIG_SHELL_BATCH_BUFFER_SIZE];
+    } batch;
+#endif
+
 #if CONFIG_SHELL_MINIMAL == 0
     struct {
         struct shell_history_elem_t *head_p;
@@ -116,6 +126,16 @@ int shell_init(struct shell_t *self_p,
  * commands are passed to the debug file system function `fs_call()`
  * for execution.
  *
+ * The shell command ``batch`` enters batch mode, intended for
+ * scripts. In batch mode, input is read in bulk and there is no echo,
+ * history, line editing or prompt. Input may contain any number of
+ * commands, which are executed in order. The output of each command
+ * is followed by a status line, ``[<sequence number>] OK`` or
+ * ``[<sequence number>] ERROR(<error code>)``, where the sequence
+ * number is one(1) for the first command after entering batch
+ * mode. Comments and empty lines have no status line. The command
+ * ``batch off`` returns to interactive mode.
+ *
  * @param[in] arg_p Pointer to the shell arguemnt struct `struct
  *                  shell_t`. See the struct definition for a
  *                  description of it's content.
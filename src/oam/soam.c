@@ -31,6 +31,7 @@
 #include "simba.h"
 
 #define SOAM_PACKET_SIZE_MIN                                7
+#define SOAM_PACKET_SIZE_MAX                             1024
 
 #define SOAM_TYPE_STDOUT_PRINTF                      (1 << 4)
 #define SOAM_TYPE_STDOUT_BINARY                      (2 << 4)
@@ -43,6 +44,7 @@
 #define SOAM_TYPE_DATABASE_ID_RESPONSE               (9 << 4)
 #define SOAM_TYPE_DATABASE_REQUEST                  (10 << 4)
 #define SOAM_TYPE_DATABASE_RESPONSE                 (11 << 4)
+#define SOAM_TYPE_LOG_POINT_BINARY                  (12 << 4)
 #define SOAM_TYPE_INVALID_TYPE                      (15 << 4)
 
 #define SOAM_PACKET_FLAGS_CONSECUTIVE                (1 << 1)
@@ -55,6 +57,15 @@ extern char soam_database_id[];
 extern const size_t soam_database_compressed_size;
 extern const uint8_t soam_database_compressed[];
 
+/**
+ * Initialize the header of the packet in the transmission buffer.
+ */
+static void packet_init(struct soam_t *self_p)
+{
+    self_p->tx.buf_p[2] = self_p->transaction_id;
+    self_p->tx.pos = 5;
+}
+
 /**
  * Finalize and output current packet to the output channel.
  */
@@ -67,8 +78,8 @@ static ssize_t packet_output(struct soam_t *self_p)
     size = (self_p->tx.pos + 2);
     payload_crc_size = (size - 5);
 
-    /* Write packet size and crc fields. */
-    self_p->tx.buf_p[2] = self_p->transaction_id;
+    /* Write packet size and crc fields. The CRC covers the header,
+       so it is calculated once the flags and the size are known. */
     self_p->tx.buf_p[3] = (payload_crc_size >> 8);
     self_p->tx.buf_p[4] = payload_crc_size;
 
@@ -86,6 +97,188 @@ static ssize_t packet_output(struct soam_t *self_p)
     return (size - 7);
 }
 
+static void write_begin(struct soam_t *self_p, int type)
+{
+    self_p->tx.buf_p[0] = type;
+    self_p->tx.buf_p[1] = self_p->tx.packet_index++;
+    packet_init(self_p);
+}
+
+static ssize_t write_chunk(struct soam_t *self_p,
+                           const void *buf_p,
+                           size_t size)
+{
+    size_t left;
+    size_t n;
+    const uint8_t *b_p;
+
+    if (self_p->tx.pos == -1) {
+        return (-1);
+    }
+
+    b_p = buf_p;
+    left = size;
+
+    while (left > 0) {
+        /* Output if the transmission buffer is full. */
+        if (self_p->tx.pos == self_p->tx.size - 2) {
+            if (packet_output(self_p) <= 0) {
+                self_p->tx.pos = -1;
+                return (-1);
+            }
+
+            /* Next packet initialization. */
+            self_p->tx.buf_p[0] |= SOAM_PACKET_FLAGS_CONSECUTIVE;
+            self_p->tx.buf_p[1] = self_p->tx.packet_index++;
+            packet_init(self_p);
+        }
+
+        /* Copy data to the transmission buffer. */
+        n = (self_p->tx.size - self_p->tx.pos - 2);
+
+        if (left < n) {
+            n = left;
+        }
+
+        memcpy(&self_p->tx.buf_p[self_p->tx.pos], b_p, n);
+        b_p += n;
+        self_p->tx.pos += n;
+        left -= n;
+    }
+
+    return (size);
+}
+
+static ssize_t write_end(struct soam_t *self_p)
+{
+    ssize_t size;
+
+    /* Output last packet, if any. */
+    if (self_p->tx.pos != -1) {
+        self_p->tx.buf_p[0] |= SOAM_PACKET_FLAGS_LAST;
+        size = packet_output(self_p);
+    } else {
+        size = -1;
+    }
+
+    return (size);
+}
+
+/**
+ * Output the binary log points packet, if any.
+ */
+static ssize_t flush_log_points(struct soam_t *self_p)
+{
+    if (self_p->tx.is_log_points == 0) {
+        return (0);
+    }
+
+    self_p->tx.is_log_points = 0;
+
+    return (write_end(self_p));
+}
+
+static void write_uint32(struct soam_t *self_p, uint32_t value)
+{
+    uint8_t buf[4];
+
+    buf[0] = (value >> 24);
+    buf[1] = (value >> 16);
+    buf[2] = (value >> 8);
+    buf[3] = value;
+    (void)write_chunk(self_p, &buf[0], sizeof(buf));
+}
+
+/**
+ * Write the identity and the raw arguments of given log point. The
+ * format string consists of the two identity bytes followed by the
+ * conversion specifications, as generated by simbapp.py.
+ */
+static void write_log_point(struct soam_t *self_p,
+                            far_string_t fmt_p,
+                            va_list *ap_p)
+{
+    char c;
+    char is_long;
+    uint8_t byte;
+    float value;
+    uint32_t u32;
+    const char *s_p;
+    far_string_t fs_p;
+
+    byte = *fmt_p++;
+    (void)write_chunk(self_p, &byte, 1);
+    byte = *fmt_p++;
+    (void)write_chunk(self_p, &byte, 1);
+
+    while ((c = *fmt_p++) != '\0') {
+        if (c != '%') {
+            continue;
+        }
+
+        /* Skip flags and width. */
+        c = *fmt_p++;
+
+        while ((c == '-') || isdigit((int)c)) {
+            c = *fmt_p++;
+        }
+
+        is_long = (c == 'l');
+
+        if (is_long) {
+            c = *fmt_p++;
+        }
+
+        switch (c) {
+
+        case 'd':
+        case 'i':
+        case 'u':
+        case 'x':
+            if (is_long) {
+                u32 = va_arg(*ap_p, unsigned long);
+            } else {
+                u32 = va_arg(*ap_p, unsigned int);
+            }
+
+            write_uint32(self_p, u32);
+            break;
+
+        case 'c':
+            byte = va_arg(*ap_p, int);
+            (void)write_chunk(self_p, &byte, 1);
+            break;
+
+        case 's':
+            s_p = va_arg(*ap_p, const char *);
+            (void)write_chunk(self_p, s_p, strlen(s_p) + 1);
+            break;
+
+        case 'S':
+            fs_p = va_arg(*ap_p, far_string_t);
+
+            do {
+                byte = *fs_p++;
+                (void)write_chunk(self_p, &byte, 1);
+            } while (byte != '\0');
+
+            break;
+
+        case 'f':
+            value = va_arg(*ap_p, double);
+            memcpy(&u32, &value, sizeof(u32));
+            write_uint32(self_p, u32);
+            break;
+
+        case '\0':
+            return;
+
+        default:
+            break;
+        }
+    }
+}
+
 static ssize_t printf_or_binary_write(struct soam_t *self_p,
                                       const void *buf_p,
                                       size_t size,
@@ -296,13 +489,15 @@ int soam_init(struct soam_t *self_p,
 {
     ASSERTN(self_p != NULL, EINVAL);
     ASSERTN(buf_p != NULL, EINVAL);
-    ASSERTN(size >= 5, EINVAL);
+    ASSERTN(size >= SOAM_PACKET_SIZE_MIN + 1, EINVAL);
+    ASSERTN(size <= SOAM_PACKET_SIZE_MAX, EINVAL);
     ASSERTN(chout_p != NULL, EINVAL);
 
     self_p->tx.buf_p = buf_p;
     self_p->tx.size = size;
     self_p->tx.chout_p = chout_p;
     self_p->tx.packet_index = 1;
+    self_p->tx.is_log_points = 0;
 
     mutex_init(&self_p->tx.mutex);
 
@@ -396,10 +591,10 @@ ssize_t soam_write_begin(struct soam_t *self_p,
 {
     mutex_lock(&self_p->tx.mutex);
 
-    /* First packet initialization. */
-    self_p->tx.buf_p[0] = type;
-    self_p->tx.buf_p[1] = self_p->tx.packet_index++;
-    self_p->tx.pos = 5;
+    /* Batched log points are output before any other packet. */
+    (void)flush_log_points(self_p);
+
+    write_begin(self_p, type);
 
     return (0);
 }
@@ -408,55 +603,14 @@ ssize_t soam_write_chunk(struct soam_t *self_p,
                          const void *buf_p,
                          size_t size)
 {
-    size_t left;
-    size_t n;
-    const uint8_t *b_p;
-
-    b_p = buf_p;
-    left = size;
-
-    while (left > 0) {
-        /* Output if the transmission buffer is full. */
-        if (self_p->tx.pos == self_p->tx.size - 2) {
-            if (packet_output(self_p) <= 0) {
-                self_p->tx.pos = -1;
-                return (-1);
-            }
-
-            /* Next packet initialization. */
-            self_p->tx.buf_p[0] |= SOAM_PACKET_FLAGS_CONSECUTIVE;
-            self_p->tx.buf_p[1] = self_p->tx.packet_index++;
-            self_p->tx.pos = 5;
-        }
-
-        /* Copy data to the transmission buffer. */
-        n = (self_p->tx.size - self_p->tx.pos - 2);
-
-        if (left < n) {
-            n = left;
-        }
-
-        memcpy(&self_p->tx.buf_p[self_p->tx.pos], b_p, n);
-        b_p += n;
-        self_p->tx.pos += n;
-        left -= n;
-    }
-
-    return (size);
+    return (write_chunk(self_p, buf_p, size));
 }
 
 ssize_t soam_write_end(struct soam_t *self_p)
 {
     ssize_t size;
 
-    /* Output last packet, if any. */
-    if (self_p->tx.pos != -1) {
-        self_p->tx.buf_p[0] |= SOAM_PACKET_FLAGS_LAST;
-        size = packet_output(self_p);
-    } else {
-        size = -1;
-    }
-
+    size = write_end(self_p);
     mutex_unlock(&self_p->tx.mutex);
 
     return (size);
@@ -476,6 +630,67 @@ ssize_t soam_write(struct soam_t *self_p,
     return (soam_write_end(self_p));
 }
 
+ssize_t soam_vlog_point(struct soam_t *self_p,
+                        far_string_t fmt_p,
+                        va_list *ap_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(fmt_p != NULL, EINVAL);
+    ASSERTN(ap_p != NULL, EINVAL);
+
+    ssize_t res;
+
+    res = 0;
+
+    mutex_lock(&self_p->tx.mutex);
+
+    if (self_p->tx.is_log_points == 0) {
+        write_begin(self_p, SOAM_TYPE_LOG_POINT_BINARY);
+        self_p->tx.is_log_points = 1;
+    }
+
+    write_log_point(self_p, fmt_p, ap_p);
+
+#if CONFIG_SOAM_LOG_POINT_BATCH == 0
+    res = flush_log_points(self_p);
+#else
+    if (self_p->tx.pos == -1) {
+        res = flush_log_points(self_p);
+    }
+#endif
+
+    mutex_unlock(&self_p->tx.mutex);
+
+    return (res < 0 ? res : 0);
+}
+
+ssize_t soam_log_point(struct soam_t *self_p,
+                       far_string_t fmt_p,
+                       ...)
+{
+    ssize_t res;
+    va_list ap;
+
+    va_start(ap, fmt_p);
+    res = soam_vlog_point(self_p, fmt_p, &ap);
+    va_end(ap);
+
+    return (res);
+}
+
+int soam_flush(struct soam_t *self_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+
+    ssize_t res;
+
+    mutex_lock(&self_p->tx.mutex);
+    res = flush_log_points(self_p);
+    mutex_unlock(&self_p->tx.mutex);
+
+    return (res < 0 ? res : 0);
+}
+
 void *soam_get_log_input_channel(struct soam_t *self_p)
 {
     return (&self_p->log_chan);
@@ -40,6 +40,7 @@ struct soam_t {
         struct mutex_t mutex;
         void *chout_p;
         uint8_t packet_index;
+        int is_log_points;
     } tx;
     struct chan_t stdout_chan;
     struct chan_t log_chan;
@@ -62,7 +63,9 @@ int soam_module_init(void);
  *
  * @param[in] self_p Object to initialize.
  * @param[in] buf_p Transmission buffer.
- * @param[in] size Transmission buffer size.
+ * @param[in] size Transmission buffer size, which is also the
+ *                 maximum packet size. At least 8 and at most 1024
+ *                 bytes. Use the link MTU for best throughput.
  * @param[in] chout_p Soam packets are written to this channel.
  *
  * @return zero(0) or negative error code.
@@ -133,6 +136,43 @@ ssize_t soam_write(struct soam_t *self_p,
                    const void *buf_p,
                    size_t size);
 
+/**
+ * Output a binary log point with given format string and arguments.
+ * Only the format string identity and the raw arguments are
+ * transmitted, and are decoded by soam.py using the SOAM
+ * database. Integers and floats are sent as four bytes and strings
+ * including their null termination.
+ *
+ * Log points are batched into a single packet if
+ * ``CONFIG_SOAM_LOG_POINT_BATCH`` is set. The packet is output when
+ * any other packet is written, or by `soam_flush()`.
+ *
+ * @param[in] self_p Soam object.
+ * @param[in] fmt_p Format string created with ``OSTR()``.
+ * @return zero(0) or negative error code.
+ */
+ssize_t soam_log_point(struct soam_t *self_p,
+                       far_string_t fmt_p,
+                       ...);
+
+/**
+ * Same as `soam_log_point()`, but with a variable argument list.
+ * @param[in] self_p Soam object.
+ * @param[in] fmt_p Format string created with ``OSTR()``.
+ * @param[in] ap_p Variable arguments list.
+ * @return zero(0) or negative error code.
+ */
+ssize_t soam_vlog_point(struct soam_t *self_p,
+                        far_string_t fmt_p,
+                        va_list *ap_p);
+
+/**
+ * Output batched binary log points, if any.
+ * @param[in] self_p Soam object.
+ * @return zero(0) or negative error code.
+ */
+int soam_flush(struct soam_t *self_p);
+
 /**
  * Get the log input channel. This channel can be set as output
  * channel of the log module with
@@ -37,6 +37,41 @@
 /* Inverse log base 2 of 10. */
 #define INV_LOG2_10_Q1DOT31 UINT64_C(0x268826a1)
 
+/* 2^(2^-k) for k = 1, 2, ..., 31 in Q2.30. */
+static FAR const uint32_t exp2_tab[] = {
+    0x5a82799a,
+    0x4c1bf829,
+    0x45cae0f2,
+    0x42d561b4,
+    0x4166c34c,
+    0x40b268fa,
+    0x4058f6a8,
+    0x402c6be9,
+    0x4016321b,
+    0x400b1818,
+    0x40058bce,
+    0x4002c5d8,
+    0x400162e8,
+    0x4000b173,
+    0x400058b9,
+    0x40002c5d,
+    0x4000162e,
+    0x40000b17,
+    0x4000058c,
+    0x400002c6,
+    0x40000163,
+    0x400000b1,
+    0x40000059,
+    0x4000002c,
+    0x40000016,
+    0x4000000b,
+    0x40000006,
+    0x40000003,
+    0x40000001,
+    0x40000001,
+    0x40000000,
+};
+
 #if CONFIG_FLOAT == 1
 
 float math_radians_to_degrees(float value)
@@ -113,3 +148,49 @@ int32_t math_log10_fixed_point(uint32_t x, int precision)
 
     return (y >> 31);
 }
+
+/* Shift-and-multiply algorithm, the inverse of the binary logarithm
+   above. The fractional part of the exponent is built one bit at a
+   time from a table of 2^(2^-k), and the integer part is applied as a
+   shift. */
+int32_t math_exp2_fixed_point(int32_t x, int precision)
+{
+    ASSERTN((precision > 0) && (precision < 32), EINVAL);
+
+    int32_t integer;
+    uint32_t fraction;
+    uint64_t y;
+    int shift;
+    int i;
+
+    integer = (x >> precision);
+    fraction = ((uint32_t)x & ((UINT32_C(1) << precision) - 1));
+    y = (UINT32_C(1) << 30);
+
+    for (i = 0; i < precision; i++) {
+        if (fraction & (UINT32_C(1) << (precision - i - 1))) {
+            y = ((y * exp2_tab[i] + (UINT32_C(1) << 29)) >> 30);
+        }
+    }
+
+    /* Convert from Q2.30 to given precision. */
+    shift = (integer + precision - 30);
+
+    if (shift >= 0) {
+        if ((shift > 31) || (y > (INT32_MAX >> shift))) {
+            return (INT32_MAX);
+        }
+
+        y <<= shift;
+    } else if (shift > -32) {
+        y = ((y + (UINT64_C(1) << (-shift - 1))) >> -shift);
+    } else {
+        y = 0;
+    }
+
+    if (y > INT32_MAX) {
+        return (INT32_MAX);
+    }
+
+    return (y);
+}
@@ -90,4 +90,18 @@ int32_t math_ln_fixed_point(uint32_t x, int precision);
  */
 int32_t math_log10_fixed_point(uint32_t x, int precision);
 
+/**
+ * Calculate 2 raised to the power of given value in given fixed point
+ * precision.
+ *
+ * @param[in] x Exponent in given precision.
+ * @param[in] precision Fixed point precision in the range 1 to 31,
+ *                      inclusive.
+ *
+ * @return 2 raised to the power of given value x, in given
+ *         precision. INT32_MAX is returned if the result does not
+ *         fit in 32 bits.
+ */
+int32_t math_exp2_fixed_point(int32_t x, int precision);
+
 #endif
@@ -37,11 +37,123 @@
 #define SEA_LEVEL_TEMPERATURE                    288.15
 #define TEMPERATURE_LAPSE_RATE                   0.0065
 
+/* Fixed point precision used by the altitude calculations. */
+#define PRECISION                                24
+
+/* R * L / (g * M) in Q1.31. */
+#define RL_GM_Q1DOT31                            INT64_C(0x185a8bb5)
+
+/* g * M / (R * L) in Q8.24. */
+#define GM_RL_Q8DOT24                            INT64_C(0x5418119)
+
+/* T0 / L in millimeters. */
+#define T0_L_MM                                  INT64_C(44330769)
+
+/* Lowest pressure and highest altitude in the troposphere. */
+#define TROPOPAUSE_PRESSURE_MPA                  22632100L
+#define TROPOPAUSE_ALTITUDE_MM                   11000000L
+
 int science_module_init()
 {
     return (0);
 }
 
+/**
+ * Multiply given value by numerator / denominator, rounded to the
+ * nearest integer. All calculations are made in 32 bits, which is
+ * enough for speeds up to about 600 m/s.
+ */
+static long scale(long value, long numerator, long denominator)
+{
+    value *= numerator;
+
+    if (value < 0) {
+        value -= (denominator / 2);
+    } else {
+        value += (denominator / 2);
+    }
+
+    return (value / denominator);
+}
+
+int science_pressure_to_altitude_fixed_point(long pressure,
+                                             long pressure_at_sea_level,
+                                             long *altitude_p)
+{
+    int32_t exponent;
+    int32_t ratio;
+
+    if ((pressure <= TROPOPAUSE_PRESSURE_MPA)
+        || (pressure_at_sea_level <= 0)) {
+        return (-EINVAL);
+    }
+
+    /* altitude = T0 / L * (1 - (p / p0) ^ (R * L / (g * M))) */
+    exponent = (math_log2_fixed_point(pressure, PRECISION)
+                - math_log2_fixed_point(pressure_at_sea_level, PRECISION));
+    exponent = ((exponent * RL_GM_Q1DOT31) >> 31);
+    ratio = math_exp2_fixed_point(exponent, PRECISION);
+    *altitude_p = ((T0_L_MM * ((INT32_C(1) << PRECISION) - ratio)
+                    + (INT32_C(1) << (PRECISION - 1))) >> PRECISION);
+
+    return (0);
+}
+
+int science_pressure_from_altitude_fixed_point(long altitude,
+                                               long pressure_at_sea_level,
+                                               long *pressure_p)
+{
+    int32_t exponent;
+    int32_t ratio;
+
+    if ((altitude >= TROPOPAUSE_ALTITUDE_MM)
+        || (pressure_at_sea_level <= 0)) {
+        return (-EINVAL);
+    }
+
+    /* pressure = p0 * (1 - L * h / T0) ^ (g * M / (R * L)) */
+    exponent = (math_log2_fixed_point(T0_L_MM - altitude, PRECISION)
+                - math_log2_fixed_point(T0_L_MM, PRECISION));
+    exponent = ((exponent * GM_RL_Q8DOT24) >> PRECISION);
+    ratio = math_exp2_fixed_point(exponent, PRECISION);
+    *pressure_p = ((pressure_at_sea_level * (int64_t)ratio
+                    + (INT32_C(1) << (PRECISION - 1))) >> PRECISION);
+
+    return (0);
+}
+
+long science_mps_to_kmph_fixed_point(long speed)
+{
+    return (scale(speed, 18, 5));
+}
+
+long science_mps_from_kmph_fixed_point(long speed)
+{
+    return (scale(speed, 5, 18));
+}
+
+/* One knot is 1852 meters per hour. */
+long science_mps_to_knots_fixed_point(long speed)
+{
+    return (scale(speed, 900, 463));
+}
+
+long science_mps_from_knots_fixed_point(long speed)
+{
+    return (scale(speed, 463, 900));
+}
+
+/* One mile is 1609.344 meters. */
+long science_mps_to_mph_fixed_point(long speed)
+{
+    return (scale(speed, 3125, 1397));
+}
+
+long science_mps_from_mph_fixed_point(long speed)
+{
+    return (scale(speed, 1397, 3125));
+}
+
 #if CONFIG_FLOAT == 1
 
 float science_pressure_to_altitude(float pressure,
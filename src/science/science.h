@@ -122,4 +122,88 @@ float science_mps_to_mph(float speed);
  */
 float science_mps_from_mph(float speed);
 
+/**
+ * Convert given pressure to its altitude, using fixed point
+ * arithmetic only. This is the integer counterpart of
+ * `science_pressure_to_altitude()`, suitable for targets without a
+ * floating point unit.
+ *
+ * @param[in] pressure Pressure in milli-Pascal.
+ * @param[in] pressure_at_sea_level Sea level pressure in milli-Pascal.
+ * @param[out] altitude_p Altitude in millimeters.
+ *
+ * @return zero(0) or negative error code.
+ */
+int science_pressure_to_altitude_fixed_point(long pressure,
+                                             long pressure_at_sea_level,
+                                             long *altitude_p);
+
+/**
+ * Convert given altitude to its pressure, using fixed point
+ * arithmetic only.
+ *
+ * @param[in] altitude Altitude in millimeters.
+ * @param[in] pressure_at_sea_level Sea level pressure in milli-Pascal.
+ * @param[out] pressure_p Pressure in milli-Pascal.
+ *
+ * @return zero(0) or negative error code.
+ */
+int science_pressure_from_altitude_fixed_point(long altitude,
+                                               long pressure_at_sea_level,
+                                               long *pressure_p);
+
+/**
+ * Convert given speed from m/s to km/h, with three decimal places.
+ *
+ * @param[in] speed Speed in mm/s.
+ *
+ * @return Speed in m/h.
+ */
+long science_mps_to_kmph_fixed_point(long speed);
+
+/**
+ * Convert given speed from km/h to m/s, with three decimal places.
+ *
+ * @param[in] speed Speed in m/h.
+ *
+ * @return Speed in mm/s.
+ */
+long science_mps_from_kmph_fixed_point(long speed);
+
+/**
+ * Convert given speed from m/s to knots, with three decimal places.
+ *
+ * @param[in] speed Speed in mm/s.
+ *
+ * @return Speed in milli-knots.
+ */
+long science_mps_to_knots_fixed_point(long speed);
+
+/**
+ * Convert given speed from knots to m/s, with three decimal places.
+ *
+ * @param[in] speed Speed in milli-knots.
+ *
+ * @return Speed in mm/s.
+ */
+long science_mps_from_knots_fixed_point(long speed);
+
+/**
+ * Convert given speed from m/s to mi/h, with three decimal places.
+ *
+ * @param[in] speed Speed in mm/s.
+ *
+ * @return Speed in milli-mi/h.
+ */
+long science_mps_to_mph_fixed_point(long speed);
+
+/**
+ * Convert given speed from mi/h to m/s, with three decimal places.
+ *
+ * @param[in] speed Speed in milli-mi/h.
+ *
+ * @return Speed in mm/s.
+ */
+long science_mps_from_mph_fixed_point(long speed);
+
 #endif
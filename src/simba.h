@@ -162,6 +162,9 @@ typedef intptr_t longptr_t;
 #ifdef PORT_HAS_DAC
 #    include "drivers/basic/dac.h"
 #endif
+#if defined(PORT_HAS_SPI) || defined(PORT_HAS_I2C)
+#    include "drivers/network/transaction.h"
+#endif
 #ifdef PORT_HAS_SPI
 #    include "drivers/network/spi.h"
 #endif
@@ -255,6 +258,9 @@ typedef intptr_t longptr_t;
 #ifdef PORT_HAS_HX711
 #    include "drivers/sensors/hx711.h"
 #endif
+#ifdef PORT_HAS_SENSOR_HUB
+#    include "drivers/sensors/sensor_hub.h"
+#endif
 #ifdef PORT_HAS_GNSS
 #    include "drivers/various/gnss.h"
 #endif
@@ -135,6 +135,7 @@ DRIVERS_SRC ?= \
 	network/nrf24l01.c \
 	network/owi.c \
 	network/spi.c \
+	network/transaction.c \
 	network/uart.c \
 	network/uart_soft.c \
 	network/usb.c \
@@ -150,6 +151,7 @@ DRIVERS_SRC ?= \
 	sensors/dht.c \
 	sensors/ds18b20.c \
 	sensors/hx711.c \
+	sensors/sensor_hub.c \
 	sensors/sht3xd.c \
 	storage/eeprom_i2c.c \
 	storage/eeprom_soft.c \
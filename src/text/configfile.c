@@ -30,138 +30,484 @@
 
 #include "simba.h"
 
+/* Largest buffer offset in the index. */
+#define OFFSET_MAX 0xffff
+
+enum line_type_t {
+    LINE_TYPE_OTHER = 0,
+    LINE_TYPE_SECTION,
+    LINE_TYPE_PROPERTY
+};
+
+struct line_t {
+    enum line_type_t type;
+    char *name_p;
+    size_t name_size;
+    char *value_p;
+    size_t value_size;
+};
+
+static int is_blank(char c)
+{
+    return ((c == ' ') || (c == '\t') || (c == '\r'));
+}
+
 /**
- * Ignore one line.
+ * Parse one line. A line starting with '\r' only consumes that
+ * character.
+ *
+ * @return Pointer to the next line, or NULL at the end of the buffer
+ *         or if the line is not terminated.
  */
-static char *ignore_line(char *buf_p)
+static char *parse_line(char *buf_p, struct line_t *line_p)
 {
-    while (*buf_p != '\n') {
-        if (*buf_p == '\0') {
+    char *end_p;
+    char *separator_p;
+
+    line_p->type = LINE_TYPE_OTHER;
+
+    if (*buf_p == '\0') {
+        return (NULL);
+    }
+
+    if (*buf_p == '\r') {
+        return (buf_p + 1);
+    }
+
+    /* Find the end of the line and the first property separator. */
+    end_p = buf_p;
+    separator_p = NULL;
+
+    while (*end_p != '\n') {
+        if (*end_p == '\0') {
             return (NULL);
         }
 
-        buf_p++;
+        if ((separator_p == NULL) && ((*end_p == ':') || (*end_p == '='))) {
+            separator_p = end_p;
+        }
+
+        end_p++;
     }
 
-    return (buf_p);
+    if ((*buf_p == '#') || (*buf_p == ';')) {
+        /* Comment. */
+    } else if (*buf_p == '[') {
+        line_p->type = LINE_TYPE_SECTION;
+        line_p->name_p = (buf_p + 1);
+        line_p->name_size = 0;
+
+        while ((line_p->name_p + line_p->name_size < end_p)
+               && (line_p->name_p[line_p->name_size] != ']')) {
+            line_p->name_size++;
+        }
+
+        while ((line_p->name_size > 0)
+               && (line_p->name_p[line_p->name_size - 1] == '\r')) {
+            line_p->name_size--;
+        }
+    } else if (separator_p != NULL) {
+        line_p->name_p = buf_p;
+        line_p->name_size = (separator_p - buf_p);
+
+        while ((line_p->name_size > 0)
+               && is_blank(buf_p[line_p->name_size - 1])) {
+            line_p->name_size--;
+        }
+
+        if (line_p->name_size > 0) {
+            line_p->type = LINE_TYPE_PROPERTY;
+            line_p->value_p = (separator_p + 1);
+
+            while ((line_p->value_p < end_p) && is_blank(*line_p->value_p)) {
+                line_p->value_p++;
+            }
+
+            line_p->value_size = (end_p - line_p->value_p);
+
+            while ((line_p->value_size > 0)
+                   && is_blank(line_p->value_p[line_p->value_size - 1])) {
+                line_p->value_size--;
+            }
+        }
+    }
+
+    return (end_p + 1);
 }
 
-/**
- * Parse and ignore a line comment.
- */
-static char *ignore_comment(char *buf_p)
+static uint32_t hash_update(uint32_t hash, const char *buf_p, size_t size)
+{
+    while (size > 0) {
+        hash ^= (uint8_t)*buf_p++;
+        hash *= 16777619UL;
+        size--;
+    }
+
+    return (hash);
+}
+
+static uint32_t hash_key(const char *section_p,
+                         size_t section_size,
+                         const char *property_p,
+                         size_t property_size)
 {
-    return (ignore_line(buf_p));
+    uint32_t hash;
+
+    hash = hash_update(2166136261UL, section_p, section_size);
+    hash = hash_update(hash, "]", 1);
+
+    return (hash_update(hash, property_p, property_size));
 }
 
 /**
- * Ignore wrong property.
+ * Find given property by parsing the whole file.
  */
-static char *ignore_wrong_property(char *buf_p)
+static int find_property_linear(struct configfile_t *self_p,
+                                const char *section_p,
+                                size_t section_size,
+                                const char *property_p,
+                                size_t property_size,
+                                struct configfile_property_t *found_p)
 {
-    return (ignore_line(buf_p));
+    struct line_t line;
+    char *buf_p;
+    char *current_section_p;
+    int in_correct_section;
+
+    buf_p = self_p->buf_p;
+    current_section_p = NULL;
+    in_correct_section = 0;
+
+    while (buf_p != NULL) {
+        buf_p = parse_line(buf_p, &line);
+
+        if (buf_p == NULL) {
+            break;
+        }
+
+        if (line.type == LINE_TYPE_SECTION) {
+            current_section_p = line.name_p;
+            in_correct_section = ((line.name_size == section_size)
+                                  && (memcmp(line.name_p,
+                                             section_p,
+                                             section_size) == 0));
+        } else if ((line.type == LINE_TYPE_PROPERTY)
+                   && in_correct_section
+                   && (line.name_size == property_size)
+                   && (memcmp(line.name_p, property_p, property_size) == 0)) {
+            found_p->section_offset = (current_section_p - self_p->buf_p);
+            found_p->section_size = section_size;
+            found_p->property_offset = (line.name_p - self_p->buf_p);
+            found_p->property_size = property_size;
+            found_p->value_offset = (line.value_p - self_p->buf_p);
+            found_p->value_size = line.value_size;
+
+            return (0);
+        }
+    }
+
+    return (-EKEYNOTFOUND);
 }
 
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+
 /**
- * Parse given section header.
+ * Find the index slot of given key. Returns the slot with the key,
+ * or the empty slot where it belongs.
  */
-static char *parse_section_header(char *buf_p,
-                                  const char *section_p,
-                                  int section_length,
-                                  int *in_correct_section_p)
+static struct configfile_property_t *index_find(struct configfile_t *self_p,
+                                                uint32_t hash,
+                                                const char *section_p,
+                                                size_t section_size,
+                                                const char *property_p,
+                                                size_t property_size)
 {
-    char *name_p;
-    int name_length;
-    int section_end_found;
+    struct configfile_property_t *slot_p;
+    int i;
+    int j;
 
-    buf_p++;
-    name_p = buf_p;
-    name_length = 0;
-    section_end_found = 0;
+    i = (hash & (CONFIG_CONFIGFILE_INDEX_SIZE - 1));
 
-    while (*buf_p != '\n') {
-        if (*buf_p == '\0') {
-            return (NULL);
-        }
+    for (j = 0; j < CONFIG_CONFIGFILE_INDEX_SIZE; j++) {
+        slot_p = &self_p->index.slots[i];
 
-        /* Ignore any carriage return and ']'. */
-        if (*buf_p == ']') {
-            section_end_found = 1;
+        if (slot_p->property_size == 0) {
+            return (slot_p);
         }
 
-        if (*buf_p != '\r') {
-            if (section_end_found == 0) {
-                name_length++;
-            }
+        if ((slot_p->hash == hash)
+            && (slot_p->section_size == section_size)
+            && (slot_p->property_size == property_size)
+            && (memcmp(&self_p->buf_p[slot_p->section_offset],
+                       section_p,
+                       section_size) == 0)
+            && (memcmp(&self_p->buf_p[slot_p->property_offset],
+                       property_p,
+                       property_size) == 0)) {
+            return (slot_p);
         }
 
-        buf_p++;
+        i = ((i + 1) & (CONFIG_CONFIGFILE_INDEX_SIZE - 1));
     }
 
-    /* Is it the section we are looking for? */
-    *in_correct_section_p = ((section_length == name_length)
-                             && (strncmp(section_p, name_p, name_length) == 0));
+    return (NULL);
+}
+
+/**
+ * Add given property to the index, unless already present. Marks
+ * the index incomplete if it does not fit. One slot is always kept
+ * empty to terminate searches.
+ */
+static void index_add(struct configfile_t *self_p,
+                      const char *section_p,
+                      size_t section_size,
+                      struct line_t *line_p)
+{
+    struct configfile_property_t *slot_p;
+    uint32_t hash;
+
+    if ((self_p->index.length == CONFIG_CONFIGFILE_INDEX_SIZE - 1)
+        || (section_size > 255)
+        || (line_p->name_size > 255)) {
+        self_p->index.complete = 0;
 
-    return (buf_p);
+        return;
+    }
+
+    hash = hash_key(section_p, section_size, line_p->name_p, line_p->name_size);
+    slot_p = index_find(self_p,
+                        hash,
+                        section_p,
+                        section_size,
+                        line_p->name_p,
+                        line_p->name_size);
+
+    if ((slot_p == NULL) || (slot_p->property_size != 0)) {
+        return;
+    }
+
+    slot_p->hash = hash;
+    slot_p->section_offset = (section_p - self_p->buf_p);
+    slot_p->section_size = section_size;
+    slot_p->property_offset = (line_p->name_p - self_p->buf_p);
+    slot_p->property_size = line_p->name_size;
+    slot_p->value_offset = (line_p->value_p - self_p->buf_p);
+    slot_p->value_size = line_p->value_size;
+    self_p->index.length++;
 }
 
-static char *parse_property(char *buf_p,
-                            char *value_p,
-                            int length,
-                            int property_length)
+/**
+ * Parse the whole file into the index.
+ */
+static void index_build(struct configfile_t *self_p)
 {
-    int value_length;
+    struct line_t line;
+    char *buf_p;
+    char *section_p;
+    size_t section_size;
 
-    value_length = 0;
-    buf_p += property_length;
+    memset(&self_p->index.slots[0], 0, sizeof(self_p->index.slots));
+    self_p->index.length = 0;
+    self_p->index.complete = 1;
 
-    /* Ignore whitespaces before ':'. */
-    while ((*buf_p == ' ') || (*buf_p == '\t')) {
-        if (*buf_p == '\0') {
-            return (NULL);
+    if (self_p->size > OFFSET_MAX) {
+        self_p->index.complete = 0;
+
+        return;
+    }
+
+    buf_p = self_p->buf_p;
+    section_p = NULL;
+    section_size = 0;
+
+    while (buf_p != NULL) {
+        buf_p = parse_line(buf_p, &line);
+
+        if (buf_p == NULL) {
+            break;
         }
 
-        buf_p++;
+        if (line.type == LINE_TYPE_SECTION) {
+            section_p = line.name_p;
+            section_size = line.name_size;
+        } else if ((line.type == LINE_TYPE_PROPERTY) && (section_p != NULL)) {
+            index_add(self_p, section_p, section_size, &line);
+
+            if (self_p->index.complete == 0) {
+                break;
+            }
+        }
     }
+}
 
-    if ((*buf_p != ':') && (*buf_p != '=')) {
-        /* Malformed property entry. */
-        return (NULL);
+/**
+ * Move all indexed locations at or after given offset.
+ */
+static void index_move(struct configfile_t *self_p,
+                       size_t offset,
+                       int delta)
+{
+    struct configfile_property_t *slot_p;
+    int i;
+
+    for (i = 0; i < CONFIG_CONFIGFILE_INDEX_SIZE; i++) {
+        slot_p = &self_p->index.slots[i];
+
+        if (slot_p->property_size == 0) {
+            continue;
+        }
+
+        if (slot_p->section_offset >= offset) {
+            slot_p->section_offset += delta;
+        }
+
+        if (slot_p->property_offset >= offset) {
+            slot_p->property_offset += delta;
+        }
+
+        if (slot_p->value_offset >= offset) {
+            slot_p->value_offset += delta;
+        }
     }
+}
 
-    /* Skip the ':'. */
-    buf_p++;
+#endif
 
-    /* Ignore whitespaces after ':'. */
-    while ((*buf_p == ' ') || (*buf_p == '\t')) {
-        if (*buf_p == '\0') {
-            return (NULL);
+/**
+ * Find given property, in the index if possible.
+ */
+static int find_property(struct configfile_t *self_p,
+                         const char *section_p,
+                         const char *property_p,
+                         struct configfile_property_t *found_p)
+{
+    size_t section_size;
+    size_t property_size;
+    uint32_t hash;
+
+    section_size = strlen(section_p);
+    property_size = strlen(property_p);
+    hash = hash_key(section_p, section_size, property_p, property_size);
+
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    struct configfile_property_t *slot_p;
+
+    if (self_p->index.complete == 1) {
+        slot_p = index_find(self_p,
+                            hash,
+                            section_p,
+                            section_size,
+                            property_p,
+                            property_size);
+
+        if ((slot_p == NULL) || (slot_p->property_size == 0)) {
+            return (-EKEYNOTFOUND);
         }
 
-        buf_p++;
+        *found_p = *slot_p;
+
+        return (0);
     }
+#endif
 
-    while (*buf_p != '\n') {
-        if (*buf_p == '\0') {
-            return (NULL);
+    found_p->hash = hash;
+
+    return (find_property_linear(self_p,
+                                 section_p,
+                                 section_size,
+                                 property_p,
+                                 property_size,
+                                 found_p));
+}
+
+/**
+ * Resize the given number of bytes at given offset to given new
+ * size by moving the rest of the file. Indexed locations after the
+ * resized bytes are moved as well.
+ */
+static int resize(struct configfile_t *self_p,
+                  size_t offset,
+                  size_t size,
+                  size_t new_size)
+{
+    size_t length;
+
+    length = strlen(self_p->buf_p);
+
+    if (length - size + new_size + 1 > self_p->size) {
+        return (-ENOMEM);
+    }
+
+    memmove(&self_p->buf_p[offset + new_size],
+            &self_p->buf_p[offset + size],
+            length - offset - size + 1);
+
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    if (self_p->index.complete == 1) {
+        if (length - size + new_size > OFFSET_MAX) {
+            self_p->index.complete = 0;
+        } else {
+            index_move(self_p, offset + size, new_size - size);
         }
+    }
+#endif
+
+    return (0);
+}
+
+/**
+ * Find the offset where a new property in given section is added,
+ * that is before the next section header or at the end of the file.
+ *
+ * @return Offset, or -1 if the section is missing.
+ */
+static ssize_t find_section_end(struct configfile_t *self_p,
+                                const char *section_p,
+                                size_t section_size,
+                                size_t *section_offset_p)
+{
+    struct line_t line;
+    char *buf_p;
+    char *next_p;
+    int found;
 
-        /* Ignore any carriage return. */
-        if (*buf_p != '\r') {
-            if (value_length == (length - 1)) {
-                return (NULL);
+    buf_p = self_p->buf_p;
+    found = 0;
+
+    while (1) {
+        next_p = parse_line(buf_p, &line);
+
+        if (line.type == LINE_TYPE_SECTION) {
+            if (found == 1) {
+                return (buf_p - self_p->buf_p);
             }
 
-            value_p[value_length] = *buf_p;
-            value_length++;
+            if ((line.name_size == section_size)
+                && (memcmp(line.name_p, section_p, section_size) == 0)) {
+                found = 1;
+                *section_offset_p = (line.name_p - self_p->buf_p);
+            }
+        }
+
+        if (next_p == NULL) {
+            break;
         }
 
-        buf_p++;
+        buf_p = next_p;
     }
 
-    value_p[value_length] = '\0';
+    if (found == 0) {
+        return (-1);
+    }
+
+    return (strlen(self_p->buf_p));
+}
 
-    return (std_strip(value_p, NULL));
+static char *append(char *dst_p, const char *src_p, size_t size)
+{
+    memcpy(dst_p, src_p, size);
+
+    return (dst_p + size);
 }
 
 int configfile_init(struct configfile_t *self_p,
@@ -175,6 +521,10 @@ int configfile_init(struct configfile_t *self_p,
     self_p->buf_p = buf_p;
     self_p->size = size;
 
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    index_build(self_p);
+#endif
+
     return (0);
 }
 
@@ -183,7 +533,119 @@ int configfile_set(struct configfile_t *self_p,
                    const char *property_p,
                    const char *value_p)
 {
-    return (-ENOSYS);
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(section_p != NULL, EINVAL);
+    ASSERTN(property_p != NULL, EINVAL);
+    ASSERTN(value_p != NULL, EINVAL);
+
+    struct configfile_property_t property;
+    struct line_t line;
+    size_t section_size;
+    size_t property_size;
+    size_t value_size;
+    size_t size;
+    size_t section_offset;
+    ssize_t offset;
+    char *buf_p;
+    int new_section;
+    int new_line;
+    int res;
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    struct configfile_property_t *slot_p;
+#endif
+
+    value_size = strlen(value_p);
+
+    /* Replace the value of an existing property. */
+    if (find_property(self_p, section_p, property_p, &property) == 0) {
+        res = resize(self_p,
+                     property.value_offset,
+                     property.value_size,
+                     value_size);
+
+        if (res != 0) {
+            return (res);
+        }
+
+        memcpy(&self_p->buf_p[property.value_offset], value_p, value_size);
+
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+        /* The resize moved an empty value along with the rest of the
+           file, so restore its offset. */
+        if (self_p->index.complete == 1) {
+            slot_p = index_find(self_p,
+                                property.hash,
+                                section_p,
+                                property.section_size,
+                                property_p,
+                                property.property_size);
+            slot_p->value_offset = property.value_offset;
+            slot_p->value_size = value_size;
+        }
+#endif
+
+        return (0);
+    }
+
+    /* Add the property last in its section, or in a new section at
+       the end of the file. */
+    section_size = strlen(section_p);
+    property_size = strlen(property_p);
+    offset = find_section_end(self_p, section_p, section_size, &section_offset);
+    size = (property_size + value_size + 4);
+
+    new_section = (offset == -1);
+
+    if (new_section) {
+        offset = strlen(self_p->buf_p);
+        size += (section_size + 4);
+    }
+
+    /* Terminate the last line if needed. */
+    new_line = ((offset > 0) && (self_p->buf_p[offset - 1] != '\n'));
+
+    if (new_line) {
+        size += 2;
+    }
+
+    res = resize(self_p, offset, 0, size);
+
+    if (res != 0) {
+        return (res);
+    }
+
+    buf_p = &self_p->buf_p[offset];
+
+    if (new_line) {
+        buf_p = append(buf_p, "\r\n", 2);
+    }
+
+    if (new_section) {
+        buf_p = append(buf_p, "[", 1);
+        section_offset = (buf_p - self_p->buf_p);
+        buf_p = append(buf_p, section_p, section_size);
+        buf_p = append(buf_p, "]\r\n", 3);
+    }
+
+    line.name_p = buf_p;
+    line.name_size = property_size;
+    buf_p = append(buf_p, property_p, property_size);
+    buf_p = append(buf_p, ": ", 2);
+    line.value_p = buf_p;
+    line.value_size = value_size;
+    buf_p = append(buf_p, value_p, value_size);
+    append(buf_p, "\r\n", 2);
+
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    if (self_p->index.complete == 1) {
+        index_add(self_p,
+                  &self_p->buf_p[section_offset],
+                  section_size,
+                  &line);
+    }
+#endif
+
+    return (0);
 }
 
 char *configfile_get(struct configfile_t *self_p,
@@ -198,48 +660,20 @@ char *configfile_get(struct configfile_t *self_p,
     ASSERTNRN(value_p != NULL, EINVAL);
     ASSERTNRN(length > 0, EINVAL);
 
-    int in_correct_section;
-    int section_length;
-    int property_length;
-    char *buf_p;
-
-    in_correct_section = 0;
-    buf_p = self_p->buf_p;
-    section_length = strlen(section_p);
-    property_length = strlen(property_p);
-
-    while (*buf_p != '\0') {
-        if (*buf_p == '\r') {
-            /* A line my start with "\r". */
-        } else if ((*buf_p == '#') || (*buf_p == ';')) {
-            buf_p = ignore_comment(buf_p);
-        } else if (*buf_p == '[') {
-            buf_p = parse_section_header(buf_p,
-                                         section_p,
-                                         section_length,
-                                         &in_correct_section);
-        } else if (in_correct_section == 0) {
-            buf_p = ignore_line(buf_p);
-        } else {
-            /* Property or empty line.*/
-            if (strncmp(property_p, buf_p, property_length) == 0) {
-                return (parse_property(buf_p,
-                                       value_p,
-                                       length,
-                                       property_length));
-            } else {
-                buf_p = ignore_wrong_property(buf_p);
-            }
-        }
+    struct configfile_property_t property;
 
-        if (buf_p == NULL) {
-            return (buf_p);
-        }
+    if (find_property(self_p, section_p, property_p, &property) != 0) {
+        return (NULL);
+    }
 
-        buf_p++;
+    if (property.value_size >= length) {
+        return (NULL);
     }
 
-    return (NULL);
+    memcpy(value_p, &self_p->buf_p[property.value_offset], property.value_size);
+    value_p[property.value_size] = '\0';
+
+    return (value_p);
 }
 
 int configfile_get_long(struct configfile_t *self_p,
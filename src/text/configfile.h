@@ -33,13 +33,37 @@
 
 #include "simba.h"
 
+/**
+ * Location of a property in the configuration file buffer.
+ */
+struct configfile_property_t {
+    uint32_t hash;
+    uint16_t section_offset;
+    uint16_t property_offset;
+    uint16_t value_offset;
+    uint16_t value_size;
+    uint8_t section_size;
+    /* Zero(0) in unused index slots. */
+    uint8_t property_size;
+};
+
 struct configfile_t {
     char *buf_p;
     size_t size;
+#if CONFIG_CONFIGFILE_INDEX_SIZE > 0
+    struct {
+        struct configfile_property_t slots[CONFIG_CONFIGFILE_INDEX_SIZE];
+        int length;
+        /* True(1) if all properties are in the index. */
+        int complete;
+    } index;
+#endif
 };
 
 /**
- * Initialize given configuration file object.
+ * Initialize given configuration file object. The file is parsed
+ * once into an index of its properties, making later lookups
+ * constant time.
  *
  * @param[in,out] self_p Object to initialize.
  * @param[in] buf_p Configuration file contents as a NULL terminated
@@ -53,14 +77,17 @@ int configfile_init(struct configfile_t *self_p,
                     size_t size);
 
 /**
- * Set the value of given property in given section.
+ * Set the value of given property in given section. The property,
+ * and the section, are appended if missing. Data after the value is
+ * moved in the buffer, and the index is updated to match.
  *
  * @param[in] self_p Initialized parser.
  * @param[in] section_p Section to set the property from.
  * @param[in] property_p Property to set the value for.
  * @param[in] value_p NULL terminated value to set.
  *
- * @return zero(0) or negative error code.
+ * @return zero(0) or negative error code, -ENOMEM if the buffer is
+ *         too small for the new contents.
  */
 int configfile_set(struct configfile_t *self_p,
                    const char *section_p,
@@ -175,12 +175,93 @@ struct compile_t {
 struct match_t {
     const char *compiled_p;
     char flags;
+    const char *buf_begin_p;
     const char *buf_p;
     size_t buf_left;
     struct re_group_t *groups_p;
     size_t *number_of_groups_p;
 };
 
+#if CONFIG_RE_NFA_INSTRUCTIONS_MAX > 255
+#    error "CONFIG_RE_NFA_INSTRUCTIONS_MAX must be at most 255."
+#endif
+
+#if CONFIG_RE_DFA_STATES_MAX > 126
+#    error "CONFIG_RE_DFA_STATES_MAX must be at most 126."
+#endif
+
+#if CONFIG_RE_NFA_INSTRUCTIONS_MAX > 0
+
+/* Linear time engine instruction op codes. */
+#define NFA_OP_ATOM                                     0
+#define NFA_OP_SPLIT                                    1
+#define NFA_OP_JUMP                                     2
+#define NFA_OP_BEGIN                                    3
+#define NFA_OP_END                                      4
+#define NFA_OP_MATCH                                    5
+
+/* An instruction. Atoms refer to the compiled pattern. */
+struct nfa_inst_t {
+    uint8_t op;
+    uint8_t x;
+    uint8_t y;
+    uint16_t atom;
+};
+
+struct nfa_t {
+    const char *compiled_p;
+    char flags;
+    int length;
+    struct nfa_inst_t insts[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+#if CONFIG_RE_DFA_STATES_MAX > 0
+    struct dfa_t *dfa_p;
+#endif
+};
+
+/* Threads in priority order. */
+struct nfa_list_t {
+    int length;
+    uint8_t pcs[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+    const char *starts[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+};
+
+#if CONFIG_RE_DFA_STATES_MAX > 0
+
+#define DFA_CLASSES_MAX                                32
+
+#define DFA_STATE_BEGIN                              0x01
+#define DFA_STATE_SEARCH                             0x02
+
+#define DFA_NEXT_MATCH                               0x80
+#define DFA_NEXT_UNKNOWN                             0xff
+#define DFA_FLUSHED                                 0x100
+
+/* Set in the compiled flags if a DFA cache follows the pattern in
+   the compiled buffer. */
+#define FLAGS_DFA_CACHE                              0x40
+
+/* A DFA state is the ordered list of instructions to continue at
+   after a character has been consumed. */
+struct dfa_state_t {
+    uint8_t flags;
+    uint8_t length;
+    uint8_t kernel[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+    uint8_t next[DFA_CLASSES_MAX];
+};
+
+/* The DFA cache of a compiled pattern, stored after the pattern in
+   the compiled buffer. */
+struct dfa_t {
+    struct mutex_t mutex;
+    uint8_t classes[256];
+    int number_of_states;
+    struct dfa_state_t states[CONFIG_RE_DFA_STATES_MAX];
+};
+
+#endif
+
+#endif
+
 struct module_t {
     int8_t initialized;
 #if CONFIG_RE_DEBUG_LOG_MASK > -1
@@ -592,6 +673,7 @@ static ssize_t match_repetition(struct match_t *self_p,
         /* Initialize the match state. */
         state.compiled_p = self_p->compiled_p + code_size;
         state.flags = self_p->flags;
+        state.buf_begin_p = self_p->buf_begin_p;
         state.buf_p = self_p->buf_p + matched_size_repetition;
         state.buf_left = self_p->buf_left - matched_size_repetition;
         state.groups_p = NULL;
@@ -650,14 +732,59 @@ static ssize_t match_repetition(struct match_t *self_p,
     return (-1);
 }
 
+/**
+ * Returns true(1) if given position is the beginning of the string,
+ * or the beginning of a line in multiline mode.
+ */
+static int is_begin(const char *buf_begin_p,
+                    const char *buf_p,
+                    char flags)
+{
+    if (buf_p == buf_begin_p) {
+        return (1);
+    }
+
+    return ((flags & RE_MULTILINE) && (buf_p[-1] == '\n'));
+}
+
+/**
+ * Returns true(1) if given position is the end of the string, just
+ * before a newline at the end of the string, or the end of a line in
+ * multiline mode.
+ */
+static int is_end(const char *buf_p,
+                  const char *buf_end_p,
+                  char flags)
+{
+    if (buf_p == buf_end_p) {
+        return (1);
+    }
+
+    if (*buf_p != '\n') {
+        return (0);
+    }
+
+    return ((flags & RE_MULTILINE) || (buf_p + 1 == buf_end_p));
+}
+
 static int match_begin(struct match_t *self_p)
 {
-    return (-1);
+    if (!is_begin(self_p->buf_begin_p, self_p->buf_p, self_p->flags)) {
+        return (-1);
+    }
+
+    return (0);
 }
 
 static int match_end(struct match_t *self_p)
 {
-    return (-1);
+    if (!is_end(self_p->buf_p,
+                self_p->buf_p + self_p->buf_left,
+                self_p->flags)) {
+        return (-1);
+    }
+
+    return (0);
 }
 
 static int match_text(struct match_t *self_p)
@@ -916,7 +1043,7 @@ static int match_set(struct match_t *self_p)
     self_p->compiled_p += 2;
     compiled_end_p = (self_p->compiled_p + code_size);
 
-    while (*self_p->compiled_p != OP_CODE_RETURN) {
+    while (self_p->compiled_p < compiled_end_p) {
         if (*self_p->compiled_p++ == OP_CODE_SET_SINGLE) {
             switch (*self_p->compiled_p++) {
 
@@ -1062,6 +1189,813 @@ static ssize_t match(struct match_t *self_p)
     }
 }
 
+static int match_atom(struct match_t *self_p)
+{
+    switch (*self_p->compiled_p++) {
+
+    case OP_CODE_TEXT:
+        return (match_text(self_p));
+
+    case OP_CODE_DOT:
+        return (match_dot(self_p));
+
+    case OP_CODE_WHITESPACE:
+        return (match_whitespace(self_p));
+
+    case OP_CODE_DECIMAL_DIGIT:
+        return (match_decimal_digit(self_p));
+
+    case OP_CODE_ALPHANUMERIC:
+        return (match_alphanumeric(self_p));
+
+    case OP_CODE_SET:
+        return (match_set(self_p));
+
+    default:
+        return (-1);
+    }
+}
+
+static ssize_t match_backtracking(const char *compiled_p,
+                                  const char *buf_begin_p,
+                                  const char *buf_p,
+                                  size_t size,
+                                  struct re_group_t *groups_p,
+                                  size_t *number_of_groups_p)
+{
+    struct match_t state;
+
+    /* Initialize the match state. */
+    state.compiled_p = &compiled_p[1];
+    state.flags = compiled_p[0];
+    state.buf_begin_p = buf_begin_p;
+    state.buf_p = buf_p;
+    state.buf_left = size;
+    state.groups_p = groups_p;
+    state.number_of_groups_p = number_of_groups_p;
+
+    return (match(&state));
+}
+
+#if CONFIG_RE_NFA_INSTRUCTIONS_MAX > 0
+
+static int get_code_size(const char *compiled_p)
+{
+    return (((uint8_t)compiled_p[0] << 8) | (uint8_t)compiled_p[1]);
+}
+
+/**
+ * Returns the size of the atom (a single character, a special
+ * character or a set) at given position, or -1 if the op code is not
+ * an atom.
+ */
+static int get_atom_size(const char *compiled_p)
+{
+    switch (compiled_p[0]) {
+
+    case OP_CODE_TEXT:
+        return (2);
+
+    case OP_CODE_DOT:
+    case OP_CODE_WHITESPACE:
+    case OP_CODE_DECIMAL_DIGIT:
+    case OP_CODE_ALPHANUMERIC:
+        return (1);
+
+    case OP_CODE_SET:
+        return (3 + get_code_size(&compiled_p[1]));
+
+    default:
+        return (-1);
+    }
+}
+
+/**
+ * Returns true(1) if given atom matches given character.
+ */
+static int atom_accepts(const char *atom_p, char flags, char value)
+{
+    struct match_t state;
+
+    state.compiled_p = atom_p;
+    state.flags = flags;
+    state.buf_begin_p = &value;
+    state.buf_p = &value;
+    state.buf_left = 1;
+    state.groups_p = NULL;
+    state.number_of_groups_p = NULL;
+
+    return (match_atom(&state) == 1);
+}
+
+static int nfa_emit(struct nfa_t *self_p,
+                    int op,
+                    int x,
+                    int y,
+                    const char *atom_p)
+{
+    struct nfa_inst_t *inst_p;
+
+    if (self_p->length == CONFIG_RE_NFA_INSTRUCTIONS_MAX) {
+        return (-1);
+    }
+
+    inst_p = &self_p->insts[self_p->length++];
+    inst_p->op = op;
+    inst_p->x = x;
+    inst_p->y = y;
+    inst_p->atom = (atom_p - self_p->compiled_p);
+
+    return (0);
+}
+
+#if CONFIG_RE_DFA_STATES_MAX > 0
+
+/**
+ * The DFA cache of a compiled pattern is stored at the first pointer
+ * aligned address after given end of the pattern.
+ */
+static struct dfa_t *dfa_align(const char *end_p)
+{
+    uintptr_t address;
+
+    address = (uintptr_t)end_p;
+    address += (sizeof(void *) - 1);
+    address &= ~(uintptr_t)(sizeof(void *) - 1);
+
+    return ((struct dfa_t *)address);
+}
+
+#endif
+
+/**
+ * Translate given compiled pattern to a Thompson NFA. Only patterns
+ * where all repetitions apply to a single atom can be translated, as
+ * the backtracking matcher does not backtrack into repeated
+ * sub-patterns.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int nfa_compile(struct nfa_t *self_p, const char *compiled_p)
+{
+    int res, op_code, code_size, pc, number_of_members;
+    const char *atom_p;
+
+    self_p->compiled_p = compiled_p;
+    self_p->flags = compiled_p[0];
+    self_p->length = 0;
+    compiled_p++;
+    res = 0;
+
+    while (res == 0) {
+        op_code = *compiled_p;
+        pc = self_p->length;
+
+        switch (op_code) {
+
+        case OP_CODE_BEGIN:
+        case OP_CODE_END:
+            res = nfa_emit(self_p,
+                           (op_code == OP_CODE_BEGIN
+                            ? NFA_OP_BEGIN
+                            : NFA_OP_END),
+                           0,
+                           0,
+                           compiled_p);
+            compiled_p++;
+            break;
+
+        case OP_CODE_ZERO_OR_ONE:
+        case OP_CODE_ZERO_OR_ONE_NON_GREEDY:
+            code_size = get_code_size(&compiled_p[1]);
+            atom_p = &compiled_p[3];
+
+            if (get_atom_size(atom_p) != code_size) {
+                return (-1);
+            }
+
+            if (op_code == OP_CODE_ZERO_OR_ONE) {
+                res = nfa_emit(self_p, NFA_OP_SPLIT, pc + 1, pc + 2, atom_p);
+            } else {
+                res = nfa_emit(self_p, NFA_OP_SPLIT, pc + 2, pc + 1, atom_p);
+            }
+
+            res |= nfa_emit(self_p, NFA_OP_ATOM, 0, 0, atom_p);
+            compiled_p = (atom_p + code_size);
+            break;
+
+        case OP_CODE_ZERO_OR_MORE:
+        case OP_CODE_ZERO_OR_MORE_NON_GREEDY:
+            code_size = get_code_size(&compiled_p[1]);
+            atom_p = &compiled_p[3];
+
+            if (get_atom_size(atom_p) != code_size - 1) {
+                return (-1);
+            }
+
+            if (op_code == OP_CODE_ZERO_OR_MORE) {
+                res = nfa_emit(self_p, NFA_OP_SPLIT, pc + 1, pc + 3, atom_p);
+            } else {
+                res = nfa_emit(self_p, NFA_OP_SPLIT, pc + 3, pc + 1, atom_p);
+            }
+
+            res |= nfa_emit(self_p, NFA_OP_ATOM, 0, 0, atom_p);
+            res |= nfa_emit(self_p, NFA_OP_JUMP, pc, 0, atom_p);
+            compiled_p = (atom_p + code_size);
+            break;
+
+        case OP_CODE_ONE_OR_MORE:
+        case OP_CODE_ONE_OR_MORE_NON_GREEDY:
+            code_size = get_code_size(&compiled_p[1]);
+            atom_p = &compiled_p[3];
+
+            if (get_atom_size(atom_p) != code_size - 1) {
+                return (-1);
+            }
+
+            res = nfa_emit(self_p, NFA_OP_ATOM, 0, 0, atom_p);
+
+            if (op_code == OP_CODE_ONE_OR_MORE) {
+                res |= nfa_emit(self_p, NFA_OP_SPLIT, pc, pc + 2, atom_p);
+            } else {
+                res |= nfa_emit(self_p, NFA_OP_SPLIT, pc + 2, pc, atom_p);
+            }
+
+            compiled_p = (atom_p + code_size);
+            break;
+
+        case OP_CODE_MEMBERS:
+            code_size = get_code_size(&compiled_p[1]);
+            number_of_members = get_code_size(&compiled_p[3]);
+            atom_p = &compiled_p[5];
+
+            if (get_atom_size(atom_p) != code_size - 1) {
+                return (-1);
+            }
+
+            while ((number_of_members > 0) && (res == 0)) {
+                res = nfa_emit(self_p, NFA_OP_ATOM, 0, 0, atom_p);
+                number_of_members--;
+            }
+
+            compiled_p = (atom_p + code_size);
+            break;
+
+        case OP_CODE_RETURN:
+#if CONFIG_RE_DFA_STATES_MAX > 0
+            if (self_p->flags & FLAGS_DFA_CACHE) {
+                self_p->dfa_p = dfa_align(compiled_p + 1);
+            } else {
+                self_p->dfa_p = NULL;
+            }
+#endif
+
+            return (nfa_emit(self_p, NFA_OP_MATCH, 0, 0, compiled_p));
+
+        default:
+            code_size = get_atom_size(compiled_p);
+
+            if (code_size < 0) {
+                return (-1);
+            }
+
+            res = nfa_emit(self_p, NFA_OP_ATOM, 0, 0, compiled_p);
+            compiled_p += code_size;
+            break;
+        }
+    }
+
+    return (-1);
+}
+
+/**
+ * Add given instruction and all instructions reachable from it
+ * without consuming a character to given thread list, in priority
+ * order.
+ */
+static void nfa_add(struct nfa_t *self_p,
+                    struct nfa_list_t *list_p,
+                    uint8_t *marks_p,
+                    int pc,
+                    const char *start_p,
+                    int begin,
+                    int end)
+{
+    const struct nfa_inst_t *inst_p;
+
+    while (marks_p[pc] == 0) {
+        marks_p[pc] = 1;
+        inst_p = &self_p->insts[pc];
+
+        switch (inst_p->op) {
+
+        case NFA_OP_SPLIT:
+            nfa_add(self_p, list_p, marks_p, inst_p->x, start_p, begin, end);
+            pc = inst_p->y;
+            break;
+
+        case NFA_OP_JUMP:
+            pc = inst_p->x;
+            break;
+
+        case NFA_OP_BEGIN:
+            if (!begin) {
+                return;
+            }
+
+            pc++;
+            break;
+
+        case NFA_OP_END:
+            if (!end) {
+                return;
+            }
+
+            pc++;
+            break;
+
+        default:
+            list_p->pcs[list_p->length] = pc;
+            list_p->starts[list_p->length] = start_p;
+            list_p->length++;
+            return;
+        }
+    }
+}
+
+/**
+ * Simulate the NFA over given buffer, keeping all threads in lock
+ * step. The threads are kept in priority order and lower priority
+ * threads are discarded as soon as a thread matches, which gives the
+ * same result as the backtracking matcher in time proportional to
+ * the buffer size times the number of instructions.
+ *
+ * @return Number of matched bytes or negative error code.
+ */
+static ssize_t nfa_run(struct nfa_t *self_p,
+                       const char *buf_begin_p,
+                       const char *buf_p,
+                       const char *buf_end_p,
+                       int search,
+                       const char **match_begin_pp)
+{
+    struct nfa_list_t lists[2];
+    struct nfa_list_t *clist_p;
+    struct nfa_list_t *nlist_p;
+    struct nfa_list_t *tmp_p;
+    uint8_t marks[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+    const struct nfa_inst_t *inst_p;
+    const char *match_begin_p;
+    const char *match_end_p;
+    int i, begin, end;
+
+    clist_p = &lists[0];
+    nlist_p = &lists[1];
+    match_begin_p = NULL;
+    match_end_p = NULL;
+
+    clist_p->length = 0;
+    memset(&marks[0], 0, self_p->length);
+    nfa_add(self_p,
+            clist_p,
+            &marks[0],
+            0,
+            buf_p,
+            is_begin(buf_begin_p, buf_p, self_p->flags),
+            is_end(buf_p, buf_end_p, self_p->flags));
+
+    while ((clist_p->length > 0) || (search && (match_end_p == NULL))) {
+        nlist_p->length = 0;
+        memset(&marks[0], 0, self_p->length);
+
+        if (buf_p < buf_end_p) {
+            begin = is_begin(buf_begin_p, buf_p + 1, self_p->flags);
+            end = is_end(buf_p + 1, buf_end_p, self_p->flags);
+        } else {
+            begin = 0;
+            end = 0;
+        }
+
+        for (i = 0; i < clist_p->length; i++) {
+            inst_p = &self_p->insts[clist_p->pcs[i]];
+
+            /* Discard all lower priority threads on match. */
+            if (inst_p->op == NFA_OP_MATCH) {
+                match_begin_p = clist_p->starts[i];
+                match_end_p = buf_p;
+                break;
+            }
+
+            if (buf_p == buf_end_p) {
+                continue;
+            }
+
+            if (atom_accepts(&self_p->compiled_p[inst_p->atom],
+                             self_p->flags,
+                             *buf_p)) {
+                nfa_add(self_p,
+                        nlist_p,
+                        &marks[0],
+                        clist_p->pcs[i] + 1,
+                        clist_p->starts[i],
+                        begin,
+                        end);
+            }
+        }
+
+        if (buf_p == buf_end_p) {
+            break;
+        }
+
+        buf_p++;
+
+        /* Start a new lowest priority thread at each position until
+           a match is found. */
+        if (search && (match_end_p == NULL)) {
+            nfa_add(self_p, nlist_p, &marks[0], 0, buf_p, begin, end);
+        }
+
+        tmp_p = clist_p;
+        clist_p = nlist_p;
+        nlist_p = tmp_p;
+    }
+
+    if (match_end_p == NULL) {
+        return (-1);
+    }
+
+    *match_begin_pp = match_begin_p;
+
+    return (match_end_p - match_begin_p);
+}
+
+#if CONFIG_RE_DFA_STATES_MAX > 0
+
+/**
+ * Split the alphabet into classes of characters that all atoms in
+ * the program treat the same. The newline character is always given
+ * its own class as it affects the ``'^'`` and ``'$'`` anchors.
+ *
+ * @return zero(0) or negative error code.
+ */
+static int dfa_init_classes(struct dfa_t *self_p,
+                            struct nfa_t *nfa_p)
+{
+    uint8_t remap[2 * DFA_CLASSES_MAX];
+    const struct nfa_inst_t *inst_p;
+    int i, c, key, number_of_classes;
+    int previous_atom;
+
+    memset(&self_p->classes[0], 0, sizeof(self_p->classes));
+    self_p->classes['\n'] = 1;
+    previous_atom = -1;
+
+    for (i = 0; i < nfa_p->length; i++) {
+        inst_p = &nfa_p->insts[i];
+
+        if ((inst_p->op != NFA_OP_ATOM) || (inst_p->atom == previous_atom)) {
+            continue;
+        }
+
+        previous_atom = inst_p->atom;
+        memset(&remap[0], 0xff, sizeof(remap));
+        number_of_classes = 0;
+
+        for (c = 0; c < 256; c++) {
+            key = (2 * self_p->classes[c]
+                   + atom_accepts(&nfa_p->compiled_p[inst_p->atom],
+                                  nfa_p->flags,
+                                  c));
+
+            if (remap[key] == 0xff) {
+                if (number_of_classes == DFA_CLASSES_MAX) {
+                    return (-1);
+                }
+
+                remap[key] = number_of_classes++;
+            }
+
+            self_p->classes[c] = remap[key];
+        }
+    }
+
+    return (0);
+}
+
+/**
+ * Find given state in the cache, or add it. The whole cache is
+ * flushed if full, which keeps the memory usage bounded while still
+ * guaranteeing linear time as each transition is computed in time
+ * proportional to the number of instructions.
+ *
+ * @return State index, with DFA_FLUSHED set if the cache was
+ *         flushed.
+ */
+static int dfa_add(struct dfa_t *self_p,
+                   int flags,
+                   const uint8_t *kernel_p,
+                   int length)
+{
+    struct dfa_state_t *state_p;
+    int i, flushed;
+
+    for (i = 0; i < self_p->number_of_states; i++) {
+        state_p = &self_p->states[i];
+
+        if ((state_p->flags == flags)
+            && (state_p->length == length)
+            && (memcmp(&state_p->kernel[0], kernel_p, length) == 0)) {
+            return (i);
+        }
+    }
+
+    flushed = 0;
+
+    if (self_p->number_of_states == CONFIG_RE_DFA_STATES_MAX) {
+        self_p->number_of_states = 0;
+        flushed = DFA_FLUSHED;
+    }
+
+    i = self_p->number_of_states++;
+    state_p = &self_p->states[i];
+    state_p->flags = flags;
+    state_p->length = length;
+    memcpy(&state_p->kernel[0], kernel_p, length);
+    memset(&state_p->next[0], DFA_NEXT_UNKNOWN, sizeof(state_p->next));
+
+    return (i | flushed);
+}
+
+/**
+ * Compute the transition from given state on given character, or
+ * whether the state matches at the end of the buffer if ``c`` is
+ * -1. The transition is stored in the state unless ``last`` is set,
+ * as ``'$'`` also matches before a newline at the end of the buffer.
+ *
+ * @return Next state index, with DFA_NEXT_MATCH set if a thread
+ *         matched before the character was consumed.
+ */
+static int dfa_compute(struct dfa_t *self_p,
+                       struct nfa_t *nfa_p,
+                       int index,
+                       int c,
+                       int last)
+{
+    struct dfa_state_t *state_p;
+    struct nfa_list_t list;
+    uint8_t marks[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+    uint8_t kernel[CONFIG_RE_NFA_INSTRUCTIONS_MAX];
+    const struct nfa_inst_t *inst_p;
+    int i, pc, begin, end, matched, length, flags, next;
+
+    state_p = &self_p->states[index];
+    begin = (state_p->flags & DFA_STATE_BEGIN);
+    end = ((c == -1)
+           || ((c == '\n') && ((nfa_p->flags & RE_MULTILINE) || last)));
+    list.length = 0;
+    memset(&marks[0], 0, nfa_p->length);
+
+    for (i = 0; i < state_p->length; i++) {
+        nfa_add(nfa_p, &list, &marks[0], state_p->kernel[i], NULL, begin, end);
+    }
+
+    if (state_p->flags & DFA_STATE_SEARCH) {
+        nfa_add(nfa_p, &list, &marks[0], 0, NULL, begin, end);
+    }
+
+    /* Step all threads with higher priority than the first
+       matching thread. */
+    matched = 0;
+    length = 0;
+    memset(&marks[0], 0, nfa_p->length);
+
+    for (i = 0; i < list.length; i++) {
+        pc = list.pcs[i];
+        inst_p = &nfa_p->insts[pc];
+
+        if (inst_p->op == NFA_OP_MATCH) {
+            matched = DFA_NEXT_MATCH;
+            break;
+        }
+
+        if (c == -1) {
+            continue;
+        }
+
+        if (marks[pc + 1] == 0) {
+            if (atom_accepts(&nfa_p->compiled_p[inst_p->atom],
+                             nfa_p->flags,
+                             c)) {
+                marks[pc + 1] = 1;
+                kernel[length++] = (pc + 1);
+            }
+        }
+    }
+
+    if (c == -1) {
+        return (matched);
+    }
+
+    flags = 0;
+
+    if ((c == '\n') && (nfa_p->flags & RE_MULTILINE)) {
+        flags |= DFA_STATE_BEGIN;
+    }
+
+    if ((state_p->flags & DFA_STATE_SEARCH) && !matched) {
+        flags |= DFA_STATE_SEARCH;
+    }
+
+    next = dfa_add(self_p, flags, &kernel[0], length);
+
+    if (next & DFA_FLUSHED) {
+        next &= ~DFA_FLUSHED;
+    } else if (!last) {
+        state_p->next[self_p->classes[(uint8_t)c]] = (next | matched);
+    }
+
+    return (next | matched);
+}
+
+/**
+ * Run the lazily built DFA over given buffer. An anchored run
+ * returns the match size. A search only finds out if there is a
+ * match, and from which position it is found by the NFA simulation.
+ *
+ * @return Number of matched bytes, zero(0) if a search found a
+ *         match, or negative error code.
+ */
+static ssize_t dfa_run(struct dfa_t *self_p,
+                       struct nfa_t *nfa_p,
+                       const char *buf_begin_p,
+                       const char *buf_p,
+                       const char *buf_end_p,
+                       int search,
+                       const char **restart_pp)
+{
+    const char *match_end_p;
+    const char *start_p;
+    uint8_t kernel;
+    int index, next, flags, c;
+
+    start_p = buf_p;
+    match_end_p = NULL;
+    flags = 0;
+
+    if (is_begin(buf_begin_p, buf_p, nfa_p->flags)) {
+        flags |= DFA_STATE_BEGIN;
+    }
+
+    if (search) {
+        flags |= DFA_STATE_SEARCH;
+    }
+
+    kernel = 0;
+    index = (dfa_add(self_p, flags, &kernel, search ? 0 : 1) & ~DFA_FLUSHED);
+
+    while (buf_p < buf_end_p) {
+        /* No thread started before this position is alive. */
+        if (self_p->states[index].length == 0) {
+            if (!search) {
+                break;
+            }
+
+            *restart_pp = buf_p;
+        }
+
+        c = (uint8_t)*buf_p;
+
+        if ((c == '\n') && (buf_p + 1 == buf_end_p)) {
+            next = dfa_compute(self_p, nfa_p, index, c, 1);
+        } else {
+            next = self_p->states[index].next[self_p->classes[c]];
+
+            if (next == DFA_NEXT_UNKNOWN) {
+                next = dfa_compute(self_p, nfa_p, index, c, 0);
+            }
+        }
+
+        if (next & DFA_NEXT_MATCH) {
+            if (search) {
+                return (0);
+            }
+
+            match_end_p = buf_p;
+        }
+
+        index = (next & ~DFA_NEXT_MATCH);
+        buf_p++;
+    }
+
+    if (buf_p == buf_end_p) {
+        if (dfa_compute(self_p, nfa_p, index, -1, 0) & DFA_NEXT_MATCH) {
+            match_end_p = buf_p;
+        }
+    }
+
+    if (match_end_p == NULL) {
+        return (-1);
+    }
+
+    if (search) {
+        return (0);
+    }
+
+    return (match_end_p - start_p);
+}
+
+/**
+ * Place a DFA cache after given compiled pattern if it fits in the
+ * compiled buffer and the pattern can be matched by the linear time
+ * engines.
+ */
+static void dfa_init(char *compiled_p, const char *end_p, size_t size)
+{
+    struct nfa_t nfa;
+    struct dfa_t *dfa_p;
+
+    compiled_p[0] &= ~FLAGS_DFA_CACHE;
+
+    if (compiled_p[0] & RE_BACKTRACKING) {
+        return;
+    }
+
+    dfa_p = dfa_align(end_p);
+
+    if ((uintptr_t)(dfa_p + 1) > (uintptr_t)(compiled_p + size)) {
+        return;
+    }
+
+    if (nfa_compile(&nfa, compiled_p) != 0) {
+        return;
+    }
+
+    if (dfa_init_classes(dfa_p, &nfa) != 0) {
+        return;
+    }
+
+    mutex_init(&dfa_p->mutex);
+    dfa_p->number_of_states = 0;
+    compiled_p[0] |= FLAGS_DFA_CACHE;
+}
+
+#endif
+
+/**
+ * Match or search using the linear time engines.
+ *
+ * @return Number of matched bytes or negative error code.
+ */
+static ssize_t linear_run(struct nfa_t *nfa_p,
+                          const char *buf_begin_p,
+                          const char *buf_p,
+                          const char *buf_end_p,
+                          int search,
+                          const char **match_begin_pp)
+{
+#if CONFIG_RE_DFA_STATES_MAX > 0
+    struct dfa_t *dfa_p;
+    ssize_t res;
+
+    dfa_p = nfa_p->dfa_p;
+
+    if (dfa_p == NULL) {
+        return (nfa_run(nfa_p,
+                        buf_begin_p,
+                        buf_p,
+                        buf_end_p,
+                        search,
+                        match_begin_pp));
+    }
+
+    mutex_lock(&dfa_p->mutex);
+    *match_begin_pp = buf_p;
+    res = dfa_run(dfa_p,
+                  nfa_p,
+                  buf_begin_p,
+                  buf_p,
+                  buf_end_p,
+                  search,
+                  &buf_p);
+    mutex_unlock(&dfa_p->mutex);
+
+    /* The NFA simulation finds the start of the match, beginning
+       where no earlier thread was alive. */
+    if (!search || (res < 0)) {
+        return (res);
+    }
+#endif
+
+    return (nfa_run(nfa_p,
+                    buf_begin_p,
+                    buf_p,
+                    buf_end_p,
+                    search,
+                    match_begin_pp));
+}
+
+#endif
+
 int re_module_init()
 {
     if (module.initialized == 1) {
@@ -1159,6 +2093,10 @@ char *re_compile(char *compiled_p,
 
         case '\0':
             compile_return(&state);
+#if (CONFIG_RE_NFA_INSTRUCTIONS_MAX > 0) && (CONFIG_RE_DFA_STATES_MAX > 0)
+            dfa_init(state.compiled_begin_p, state.compiled_p, size);
+#endif
+
             return (state.compiled_begin_p);
 
         default:
@@ -1178,15 +2116,80 @@ ssize_t re_match(const char *compiled_p,
                  struct re_group_t *groups_p,
                  size_t *number_of_groups_p)
 {
-    struct match_t state;
+#if CONFIG_RE_NFA_INSTRUCTIONS_MAX > 0
+    struct nfa_t nfa;
+    const char *match_begin_p;
+
+    if (!(compiled_p[0] & RE_BACKTRACKING)
+        && (nfa_compile(&nfa, compiled_p) == 0)) {
+        return (linear_run(&nfa,
+                           buf_p,
+                           buf_p,
+                           buf_p + size,
+                           0,
+                           &match_begin_p));
+    }
+#endif
 
-    /* Initialize the match state. */
-    state.compiled_p = &compiled_p[1];
-    state.flags = compiled_p[0];
-    state.buf_p = buf_p;
-    state.buf_left = size;
-    state.groups_p = groups_p;
-    state.number_of_groups_p = number_of_groups_p;
+    return (match_backtracking(compiled_p,
+                               buf_p,
+                               buf_p,
+                               size,
+                               groups_p,
+                               number_of_groups_p));
+}
 
-    return (match(&state));
+ssize_t re_search(const char *compiled_p,
+                  const char *buf_p,
+                  size_t size,
+                  struct re_group_t *match_p)
+{
+    ssize_t res;
+    size_t offset;
+#if CONFIG_RE_NFA_INSTRUCTIONS_MAX > 0
+    struct nfa_t nfa;
+    const char *match_begin_p;
+
+    if (!(compiled_p[0] & RE_BACKTRACKING)
+        && (nfa_compile(&nfa, compiled_p) == 0)) {
+        res = linear_run(&nfa,
+                         buf_p,
+                         buf_p,
+                         buf_p + size,
+                         1,
+                         &match_begin_p);
+
+        if (res < 0) {
+            return (res);
+        }
+
+        if (match_p != NULL) {
+            match_p->buf_p = match_begin_p;
+            match_p->size = res;
+        }
+
+        return (match_begin_p - buf_p);
+    }
+#endif
+
+    /* Try the backtracking matcher at each position. */
+    for (offset = 0; offset <= size; offset++) {
+        res = match_backtracking(compiled_p,
+                                 buf_p,
+                                 buf_p + offset,
+                                 size - offset,
+                                 NULL,
+                                 NULL);
+
+        if (res >= 0) {
+            if (match_p != NULL) {
+                match_p->buf_p = (buf_p + offset);
+                match_p->size = res;
+            }
+
+            return (offset);
+        }
+    }
+
+    return (-1);
 }
@@ -58,6 +58,12 @@
  */
 #define RE_MULTILINE  0x04
 
+/**
+ * Always use the backtracking matcher instead of the linear time
+ * matcher. Mainly useful for comparing the two.
+ */
+#define RE_BACKTRACKING 0x08
+
 struct re_group_t {
     const char *buf_p;
     ssize_t size;
@@ -80,8 +86,8 @@ int re_module_init(void);
  * Pattern syntax:
  *
  * - ``'.'``   - Any character.
- * - ``'^'``   - Beginning of the string (**not yet supported**).
- * - ``'$'``   - End of the string (**not yet supported**).
+ * - ``'^'``   - Beginning of the string.
+ * - ``'$'``   - End of the string.
  * - ``'?'``   - Zero or one repetitions (greedy).
  * - ``'*'``   - Zero or more repetitions (greedy).
  * - ``'+'``   - One or more repetitions (greedy).
@@ -97,11 +103,22 @@ int re_module_init(void);
  * - ``\\w``   - Alphanumerical characters ``[a-ZA-Z0-9_]``.
  * - ``\\s``   - Whitespace characters ``[ \t\r\n\f\v]``.
  *
+ * Patterns where all repetitions apply to a single character,
+ * special character or set are matched in linear time by simulating
+ * a Thompson NFA, accelerated by a lazily built DFA cache of at most
+ * ``CONFIG_RE_DFA_STATES_MAX`` states. The cache is stored after the
+ * pattern in the compiled buffer, and is only used if it fits in
+ * it. It is shared by all threads matching the pattern, which are
+ * serialized by a mutex in the cache. Other patterns, and patterns
+ * translating to more than ``CONFIG_RE_NFA_INSTRUCTIONS_MAX``
+ * instructions, are matched by a backtracking matcher. Both give the
+ * same result.
+ *
  * @param[out] compiled_p Compiled regular expression pattern.
  * @param[in] pattern_p Regular expression pattern.
  * @param[in] flags A combination of the flags ``RE_IGNORECASE``,
- *                  ``RE_DOTALL`` and ``RE_MULTILINE``
- *                  (``RE_MULTILINE`` is **not yet supported**).
+ *                  ``RE_DOTALL``, ``RE_MULTILINE`` and
+ *                  ``RE_BACKTRACKING``.
  * @param[in] size Size of the compiled buffer.
  *
  * @return Compiled patten, or NULL if the compilation failed.
@@ -129,4 +146,21 @@ ssize_t re_match(const char *compiled_p,
                  struct re_group_t *groups_p,
                  size_t *number_of_groups_p);
 
+/**
+ * Scan through given string looking for the first location where
+ * given regular expression produces a match.
+ *
+ * @param[in] compiled_p Compiled regular expression pattern. Compile
+ *                       a pattern with `re_compile()`.
+ * @param[in] buf_p Buffer to apply the compiled pattern to.
+ * @param[in] size Number of bytes in the buffer.
+ * @param[out] match_p The matched part of the buffer, or NULL.
+ *
+ * @return Offset of the match in the buffer or negative error code.
+ */
+ssize_t re_search(const char *compiled_p,
+                  const char *buf_p,
+                  size_t size,
+                  struct re_group_t *match_p);
+
 #endif
@@ -36,17 +36,18 @@
 /* +7 for floating point decimal point and fraction. */
 #define VALUE_BUF_MAX (3 * sizeof(long) + 7)
 
-struct buffered_output_t {
-    void *chan_p;
-    int pos;
-    char buffer[CONFIG_STD_OUTPUT_BUFFER_MAX];
-    size_t size;
-};
-
-struct snprintf_output_t {
-    char *dst_p;
+/**
+ * Formatted output. Characters are written in blocks to a buffer,
+ * which is flushed when full. Without a flush function the output is
+ * truncated at the buffer end.
+ */
+struct output_t {
+    char *buf_p;
+    size_t pos;
     size_t size;
-    size_t size_max;
+    size_t length;
+    void (*flush)(struct output_t *self_p);
+    void *chan_p;
 };
 
 /**
@@ -66,121 +67,183 @@ static int char_in_string(char c, const char *str_p)
     return (0);
 }
 
+/* Decimal digit pairs "00" to "99", used to format two digits per
+   division. */
+static const FAR char digit_pairs[] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+static const FAR char hex_digits[] = "0123456789abcdef";
+
 /**
- * Put characters to buffer.
+ * Write given buffer to given output.
  */
-static void sprintf_putc(char c, void *arg_p)
+static void output_write(struct output_t *self_p,
+                         const char *buf_p,
+                         size_t size)
 {
-    char **dst_pp = arg_p;
+    size_t n;
 
-    *(*dst_pp)++ = c;
-}
+    self_p->length += size;
 
-/**
- * Put characters to buffer.
- */
-static void snprintf_putc(char c, void *arg_p)
-{
-    struct snprintf_output_t *output_p;
+    while (size > 0) {
+        n = (self_p->size - self_p->pos);
+
+        if (n == 0) {
+            if (self_p->flush == NULL) {
+                break;
+            }
 
-    output_p = arg_p;
+            self_p->flush(self_p);
+            n = self_p->size;
+        }
 
-    if (output_p->size < output_p->size_max) {
-        output_p->dst_p[output_p->size] = c;
-    }
+        if (n > size) {
+            n = size;
+        }
 
-    output_p->size++;
+        memcpy(&self_p->buf_p[self_p->pos], buf_p, n);
+        self_p->pos += n;
+        buf_p += n;
+        size -= n;
+    }
 }
 
 /**
- * Put characters to standard output.
+ * Write given character given number of times to given output.
  */
-static void fprintf_putc(char c, void *arg_p)
+static void output_fill(struct output_t *self_p, char c, int width)
 {
-    struct buffered_output_t *output_p = arg_p;
+    size_t size;
+    size_t n;
+
+    if (width <= 0) {
+        return;
+    }
 
-    output_p->buffer[output_p->pos++] = c;
-    output_p->size++;
+    size = width;
+
+    self_p->length += size;
+
+    while (size > 0) {
+        n = (self_p->size - self_p->pos);
 
-    if (output_p->pos == membersof(output_p->buffer)) {
-        chan_write(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+        if (n == 0) {
+            if (self_p->flush == NULL) {
+                break;
+            }
+
+            self_p->flush(self_p);
+            n = self_p->size;
+        }
+
+        if (n > size) {
+            n = size;
+        }
+
+        memset(&self_p->buf_p[self_p->pos], c, n);
+        self_p->pos += n;
+        size -= n;
+    }
+}
+
+static void output_putc(struct output_t *self_p, char c)
+{
+    if (self_p->pos < self_p->size) {
+        self_p->buf_p[self_p->pos++] = c;
+        self_p->length++;
+    } else {
+        output_write(self_p, &c, 1);
     }
 }
 
 /**
- * Flush output buffer to channel.
+ * Write given far string to given output.
  */
-static void output_flush(struct buffered_output_t *output_p)
+static void output_write_far(struct output_t *self_p,
+                             far_string_t buf_p,
+                             size_t size)
 {
-    if (output_p->pos > 0) {
-        chan_write(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+#if defined(FAR_SPECIAL_ADDRESS)
+    while (size > 0) {
+        output_putc(self_p, *buf_p++);
+        size--;
     }
+#else
+    output_write(self_p, buf_p, size);
+#endif
 }
 
 /**
- * Put characters to standard output from interrupt context or with
- * the system lock taken.
+ * Write the output buffer to the channel.
  */
-static void fprintf_putc_isr(char c, void *arg_p)
+static void output_flush(struct output_t *self_p)
 {
-    struct buffered_output_t *output_p = arg_p;
-
-    output_p->buffer[output_p->pos++] = c;
-    output_p->size++;
-
-    if (output_p->pos == membersof(output_p->buffer)) {
-        chan_write_isr(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+    if (self_p->pos > 0) {
+        chan_write(self_p->chan_p, self_p->buf_p, self_p->pos);
+        self_p->pos = 0;
     }
 }
 
 /**
- * Flush output buffer to channel.
+ * Write the output buffer to the channel from interrupt context or
+ * with the system lock taken.
  */
-static void output_flush_isr(struct buffered_output_t *output_p)
+static void output_flush_isr(struct output_t *self_p)
 {
-    if (output_p->pos > 0) {
-        chan_write_isr(output_p->chan_p, output_p->buffer, output_p->pos);
-        output_p->pos = 0;
+    if (self_p->pos > 0) {
+        chan_write_isr(self_p->chan_p, self_p->buf_p, self_p->pos);
+        self_p->pos = 0;
     }
 }
 
-static void formats(void (*std_putc)(char c, void *arg_p),
-                    void *arg_p,
-                    char *str_p,
+static void output_init(struct output_t *self_p,
+                        char *buf_p,
+                        size_t size,
+                        void (*flush)(struct output_t *self_p),
+                        void *chan_p)
+{
+    self_p->buf_p = buf_p;
+    self_p->pos = 0;
+    self_p->size = size;
+    self_p->length = 0;
+    self_p->flush = flush;
+    self_p->chan_p = chan_p;
+}
+
+static void formats(struct output_t *output_p,
+                    const char *str_p,
+                    size_t size,
                     char flags,
                     int width,
                     char negative_sign)
 {
-    char *s_p = str_p;
-
-    while (*s_p++ != '\0') {
-        width--;
-    }
+    width -= size;
 
     /* Right justification. */
     if (flags != '-') {
         if ((negative_sign == 1) && (flags == '0')) {
-            std_putc(*str_p++, arg_p);
+            output_putc(output_p, *str_p++);
+            size--;
         }
 
-        while (width > 0) {
-            std_putc(flags, arg_p);
-            width--;
-        }
+        output_fill(output_p, flags, width);
     }
 
     /* Number */
-    while (*str_p != '\0') {
-        std_putc(*str_p++, arg_p);
-    }
+    output_write(output_p, str_p, size);
 
     /* Left justification. */
-    while (width > 0) {
-        std_putc(' ', arg_p);
-        width--;
+    if (flags == '-') {
+        output_fill(output_p, ' ', width);
     }
 }
 
@@ -192,7 +255,7 @@ static char *formati(char c,
                      char *negative_sign_p)
 {
     unsigned long value;
-    char digit;
+    unsigned long index;
 
     /* Get argument. */
     if (length == 0) {
@@ -213,14 +276,28 @@ static char *formati(char c,
     }
 
     /* Format number into buffer. */
-    do {
-        digit = (char)(value % radix);
-        value /= radix;
-        if (digit > 9) {
-            digit += 39;
+    if (radix == 16) {
+        do {
+            *--str_p = hex_digits[value & 0xf];
+            value >>= 4;
+        } while (value > 0);
+    } else {
+        while (value >= 100) {
+            index = 2 * (value % 100);
+            value /= 100;
+            str_p -= 2;
+            str_p[0] = digit_pairs[index];
+            str_p[1] = digit_pairs[index + 1];
         }
-        *--str_p = ('0' + digit);
-    } while (value > 0);
+
+        if (value >= 10) {
+            str_p -= 2;
+            str_p[0] = digit_pairs[2 * value];
+            str_p[1] = digit_pairs[2 * value + 1];
+        } else {
+            *--str_p = ('0' + value);
+        }
+    }
 
     if (*negative_sign_p == 1) {
         *--str_p = '-';
@@ -290,136 +367,229 @@ static char *formatf(char c,
 
 #endif
 
-static void vcprintf(void (*std_putc)(char c, void *arg_p),
-                     void *arg_p,
-                     far_string_t fmt_p,
-                     va_list *ap_p)
+/**
+ * Parse the literal text and conversion specification at the
+ * beginning of given format string. The specifier is zero(0) if the
+ * format string ends after the literal text.
+ *
+ * @return Pointer to the text after the parsed conversion.
+ */
+static far_string_t parse_spec(far_string_t fmt_p,
+                               struct std_format_spec_t *spec_p)
 {
-    char c, flags, length, negative_sign, buf[VALUE_BUF_MAX], *s_p;
-    int width;
+    char c;
 
-    buf[sizeof(buf) - 1] = '\0';
+    spec_p->literal_p = fmt_p;
 
-    while ((c = *fmt_p++) != '\0') {
-        if (c != '%') {
-            std_putc(c, arg_p);
-            continue;
-        }
+    while (((c = *fmt_p) != '\0') && (c != '%')) {
+        fmt_p++;
+    }
+
+    spec_p->literal_size = (fmt_p - spec_p->literal_p);
+    spec_p->specifier = '\0';
+
+    if (c == '\0') {
+        return (fmt_p);
+    }
+
+    /* Prototype: %[flags][width][length]specifier  */
+    fmt_p++;
 
-        /* Prototype: %[flags][width][length]specifier  */
+    /* Parse the flags. */
+    spec_p->flags = ' ';
+    c = *fmt_p++;
 
-        /* Parse the flags. */
-        flags = ' ';
+    if ((c == '0') || (c == '-')) {
+        spec_p->flags = c;
         c = *fmt_p++;
+    }
 
-        if ((c == '0') || (c == '-')) {
-            flags = c;
-            c = *fmt_p++;
-        }
+    /* Parse the width. */
+    spec_p->width = 0;
 
-        /* Parse the width. */
-        width = 0;
+    while ((c >= '0') && (c <= '9')) {
+        spec_p->width *= 10;
+        spec_p->width += (c - '0');
+        c = *fmt_p++;
+    }
 
-        while ((c >= '0') && (c <= '9')) {
-            width *= 10;
-            width += (c - '0');
-            c = *fmt_p++;
-        }
+    /* Parse the length. */
+    spec_p->length = 0;
 
-        /* Parse the length. */
-        length = 0;
+    if (c == 'l') {
+        spec_p->length = 1;
+        c = *fmt_p++;
+    }
 
-        if (c == 'l') {
-            length = 1;
-            c = *fmt_p++;
-        }
+    if (c == '\0') {
+        return (fmt_p - 1);
+    }
 
-        if (c == '\0') {
-            break;
-        }
+    spec_p->specifier = c;
+
+    return (fmt_p);
+}
+
+/**
+ * Format the next argument as given conversion specification.
+ */
+static void format_spec(struct output_t *output_p,
+                        const struct std_format_spec_t *spec_p,
+                        va_list *ap_p)
+{
+    char negative_sign;
+    char buf[VALUE_BUF_MAX];
+    char *s_p;
+    size_t size;
 
-        /* Parse the specifier. */
-        negative_sign = 0;
+    negative_sign = 0;
+    s_p = &buf[sizeof(buf)];
 
-        switch (c) {
+    switch (spec_p->specifier) {
 
-        case 'S':
+    case 'S':
 #if defined(FAR_SPECIAL_ADDRESS)
-            {
-                FAR const char *far_string_p;
+        {
+            far_string_t far_string_p;
 
-                far_string_p = va_arg(*ap_p, FAR const char*);
+            far_string_p = va_arg(*ap_p, far_string_t);
 
-                if (far_string_p == NULL) {
-                    far_string_p = FSTR("(null)");
-                }
+            if (far_string_p == NULL) {
+                far_string_p = FSTR("(null)");
+            }
 
-                s_p = &buf[sizeof(buf) - 1];
-                width -= std_strlen(far_string_p);
+            size = std_strlen(far_string_p);
 
-                /* Right justification. */
-                if (flags != '-') {
-                    formats(std_putc, arg_p, s_p, flags, width, negative_sign);
-                }
+            /* Right justification. */
+            if (spec_p->flags != '-') {
+                output_fill(output_p,
+                            spec_p->flags,
+                            spec_p->width - (int)size);
+            }
 
-                while (*far_string_p != '\0') {
-                    std_putc(*far_string_p++, arg_p);
-                }
+            output_write_far(output_p, far_string_p, size);
 
-                /* Left justification. */
-                if (flags == '-') {
-                    formats(std_putc, arg_p, s_p, flags, width, negative_sign);
-                }
+            /* Left justification. */
+            if (spec_p->flags == '-') {
+                output_fill(output_p, ' ', spec_p->width - (int)size);
             }
+        }
 
-            continue;
+        return;
 #endif
 
-        case 's':
-            s_p = va_arg(*ap_p, char*);
+    case 's':
+        s_p = va_arg(*ap_p, char*);
 
-            if (s_p == NULL) {
-                s_p = "(null)";
-            }
+        if (s_p == NULL) {
+            s_p = "(null)";
+        }
 
-            break;
+        size = strlen(s_p);
+        break;
+
+    case 'c':
+        s_p--;
+        *s_p = (char)va_arg(*ap_p, int);
+        size = 1;
+        break;
+
+    case 'i':
+    case 'd':
+    case 'u':
+        s_p = formati(spec_p->specifier,
+                      s_p,
+                      10,
+                      ap_p,
+                      spec_p->length,
+                      &negative_sign);
+        size = (&buf[sizeof(buf)] - s_p);
+        break;
+
+    case 'x':
+        s_p = formati(spec_p->specifier,
+                      s_p,
+                      16,
+                      ap_p,
+                      spec_p->length,
+                      &negative_sign);
+        size = (&buf[sizeof(buf)] - s_p);
+        break;
 
-        case 'c':
-            buf[sizeof(buf) - 2] = (char)va_arg(*ap_p, int);
-            s_p = &buf[sizeof(buf) - 2];
-            break;
+#if CONFIG_FLOAT == 1
+    case 'f':
+        s_p = formatf(spec_p->specifier,
+                      s_p,
+                      ap_p,
+                      spec_p->length,
+                      &negative_sign);
+        size = (&buf[sizeof(buf)] - s_p);
+        break;
+#endif
 
-        case 'i':
-        case 'd':
-        case 'u':
-            s_p = formati(c, &buf[sizeof(buf) - 1], 10, ap_p, length, &negative_sign);
-            break;
+    default:
+        output_putc(output_p, spec_p->specifier);
+        return;
+    }
 
-        case 'x':
-            s_p = formati(c, &buf[sizeof(buf) - 1], 16, ap_p, length, &negative_sign);
-            break;
+    formats(output_p, s_p, size, spec_p->flags, spec_p->width, negative_sign);
+}
 
-#if CONFIG_FLOAT == 1
-        case 'f':
-            s_p = formatf(c, &buf[sizeof(buf) - 1], ap_p, length, &negative_sign);
+static void vcprintf(struct output_t *output_p,
+                     far_string_t fmt_p,
+                     va_list *ap_p)
+{
+    struct std_format_spec_t spec;
+
+    while (1) {
+        fmt_p = parse_spec(fmt_p, &spec);
+        output_write_far(output_p, spec.literal_p, spec.literal_size);
+
+        if (spec.specifier == '\0') {
             break;
-#endif
+        }
+
+        format_spec(output_p, &spec, ap_p);
+    }
+}
+
+/**
+ * Same as `vcprintf()`, but for a format compiled by
+ * `std_format_init()`.
+ */
+static void vcprintf_compiled(struct output_t *output_p,
+                              const struct std_format_t *format_p,
+                              va_list *ap_p)
+{
+    const struct std_format_spec_t *spec_p;
+    int i;
+
+    spec_p = format_p->specs_p;
 
-        default:
-            std_putc(c, arg_p);
-            continue;
+    for (i = 0; i < format_p->length; i++, spec_p++) {
+        output_write_far(output_p, spec_p->literal_p, spec_p->literal_size);
+
+        if (spec_p->specifier == '\0') {
+            break;
         }
 
-        formats(std_putc, arg_p, s_p, flags, width, negative_sign);
+        format_spec(output_p, spec_p, ap_p);
     }
 }
 
-static void cvcprintf(struct buffered_output_t *output_p,
+static void cvcprintf(struct output_t *output_p,
                       far_string_t fmt_p,
+                      const struct std_format_t *format_p,
                       va_list *ap_p)
 {
     chan_control(output_p->chan_p, CHAN_CONTROL_PRINTF_BEGIN);
-    vcprintf(fprintf_putc, output_p, fmt_p, ap_p);
+
+    if (format_p != NULL) {
+        vcprintf_compiled(output_p, format_p, ap_p);
+    } else {
+        vcprintf(output_p, fmt_p, ap_p);
+    }
+
     output_flush(output_p);
     chan_control(output_p->chan_p, CHAN_CONTROL_PRINTF_END);
 }
@@ -480,12 +650,13 @@ ssize_t std_vsprintf(char *dst_p, far_string_t fmt_p, va_list *ap_p)
     ASSERTN(dst_p != NULL, EINVAL);
     ASSERTN(fmt_p != NULL, EINVAL);
 
-    char *d_p = dst_p;
+    struct output_t output;
 
-    vcprintf(sprintf_putc, &d_p, fmt_p, ap_p);
-    sprintf_putc('\0', &d_p);
+    output_init(&output, dst_p, (size_t)-1, NULL, NULL);
+    vcprintf(&output, fmt_p, ap_p);
+    output_putc(&output, '\0');
 
-    return (d_p - dst_p - 1);
+    return (output.length - 1);
 }
 
 ssize_t std_vsnprintf(char *dst_p,
@@ -496,27 +667,24 @@ ssize_t std_vsnprintf(char *dst_p,
     ASSERTN(dst_p != NULL, EINVAL);
     ASSERTN(fmt_p != NULL, EINVAL);
 
-    struct snprintf_output_t output;
+    struct output_t output;
 
     if (size == 0) {
         return (-ENOMEM);
     }
 
-    output.dst_p = dst_p;
-    output.size = 0;
-    output.size_max = size;
-
-    vcprintf(snprintf_putc, &output, fmt_p, ap_p);
-    snprintf_putc('\0', &output);
+    output_init(&output, dst_p, size, NULL, NULL);
+    vcprintf(&output, fmt_p, ap_p);
+    output_putc(&output, '\0');
 
     /* Force the string to be NULL terminated. */
     dst_p[size - 1] = '\0';
 
-    if (output.size > size) {
+    if (output.length > size) {
         return (-ENOMEM);
     }
 
-    return (output.size - 1);
+    return (output.length - 1);
 }
 
 ssize_t std_printf(far_string_t fmt_p, ...)
@@ -524,17 +692,20 @@ ssize_t std_printf(far_string_t fmt_p, ...)
     ASSERTN(fmt_p != NULL, EINVAL);
 
     va_list ap;
-    struct buffered_output_t output;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = sys_get_stdout();
+    output_init(&output,
+                &buf[0],
+                sizeof(buf),
+                output_flush,
+                sys_get_stdout());
 
     va_start(ap, fmt_p);
-    cvcprintf(&output, fmt_p, &ap);
+    cvcprintf(&output, fmt_p, NULL, &ap);
     va_end(ap);
 
-    return (output.size);
+    return (output.length);
 }
 
 ssize_t std_vprintf(far_string_t fmt_p, va_list *ap_p)
@@ -542,15 +713,17 @@ ssize_t std_vprintf(far_string_t fmt_p, va_list *ap_p)
     ASSERTN(fmt_p != NULL, EINVAL);
     ASSERTN(ap_p != NULL, EINVAL);
 
-    struct buffered_output_t output;
-
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = sys_get_stdout();
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    cvcprintf(&output, fmt_p, ap_p);
+    output_init(&output,
+                &buf[0],
+                sizeof(buf),
+                output_flush,
+                sys_get_stdout());
+    cvcprintf(&output, fmt_p, NULL, ap_p);
 
-    return (output.size);
+    return (output.length);
 }
 
 ssize_t std_fprintf(void *chan_p, far_string_t fmt_p, ...)
@@ -559,17 +732,16 @@ ssize_t std_fprintf(void *chan_p, far_string_t fmt_p, ...)
     ASSERTN(fmt_p != NULL, EINVAL);
 
     va_list ap;
-    struct buffered_output_t output;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = chan_p;
+    output_init(&output, &buf[0], sizeof(buf), output_flush, chan_p);
 
     va_start(ap, fmt_p);
-    cvcprintf(&output, fmt_p, &ap);
+    cvcprintf(&output, fmt_p, NULL, &ap);
     va_end(ap);
 
-    return (output.size);
+    return (output.length);
 }
 
 ssize_t std_vfprintf(void *chan_p, far_string_t fmt_p, va_list *ap_p)
@@ -578,49 +750,137 @@ ssize_t std_vfprintf(void *chan_p, far_string_t fmt_p, va_list *ap_p)
     ASSERTN(fmt_p != NULL, EINVAL);
     ASSERTN(ap_p != NULL, EINVAL);
 
-    struct buffered_output_t output;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = chan_p;
+    output_init(&output, &buf[0], sizeof(buf), output_flush, chan_p);
+    cvcprintf(&output, fmt_p, NULL, ap_p);
 
-    cvcprintf(&output, fmt_p, ap_p);
-
-    return (output.size);
+    return (output.length);
 }
 
 ssize_t std_printf_isr(far_string_t fmt_p, ...)
 {
     va_list ap;
-    struct buffered_output_t output;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = sys_get_stdout();
+    output_init(&output,
+                &buf[0],
+                sizeof(buf),
+                output_flush_isr,
+                sys_get_stdout());
 
     va_start(ap, fmt_p);
-    vcprintf(fprintf_putc_isr, &output, fmt_p, &ap);
+    vcprintf(&output, fmt_p, &ap);
     output_flush_isr(&output);
     va_end(ap);
 
-    return (output.size);
+    return (output.length);
 }
 
 ssize_t std_fprintf_isr(void *chan_p, far_string_t fmt_p, ...)
 {
     va_list ap;
-    struct buffered_output_t output;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
 
-    output.pos = 0;
-    output.size = 0;
-    output.chan_p = chan_p;
+    output_init(&output, &buf[0], sizeof(buf), output_flush_isr, chan_p);
 
     va_start(ap, fmt_p);
-    vcprintf(fprintf_putc_isr, &output, fmt_p, &ap);
+    vcprintf(&output, fmt_p, &ap);
     output_flush_isr(&output);
     va_end(ap);
 
-    return (output.size);
+    return (output.length);
+}
+
+int std_format_init(struct std_format_t *self_p,
+                    struct std_format_spec_t *specs_p,
+                    int length,
+                    far_string_t fmt_p)
+{
+    ASSERTN(self_p != NULL, EINVAL);
+    ASSERTN(specs_p != NULL, EINVAL);
+    ASSERTN(length > 0, EINVAL);
+    ASSERTN(fmt_p != NULL, EINVAL);
+
+    int i;
+
+    for (i = 0; i < length; i++) {
+        fmt_p = parse_spec(fmt_p, &specs_p[i]);
+
+        if (specs_p[i].specifier == '\0') {
+            self_p->specs_p = specs_p;
+            self_p->length = (i + 1);
+
+            return (0);
+        }
+    }
+
+    return (-ENOMEM);
+}
+
+ssize_t std_format_sprintf(char *dst_p,
+                           const struct std_format_t *format_p,
+                           ...)
+{
+    ASSERTN(dst_p != NULL, EINVAL);
+    ASSERTN(format_p != NULL, EINVAL);
+
+    va_list ap;
+    struct output_t output;
+
+    output_init(&output, dst_p, (size_t)-1, NULL, NULL);
+
+    va_start(ap, format_p);
+    vcprintf_compiled(&output, format_p, &ap);
+    va_end(ap);
+
+    output_putc(&output, '\0');
+
+    return (output.length - 1);
+}
+
+ssize_t std_format_printf(const struct std_format_t *format_p, ...)
+{
+    ASSERTN(format_p != NULL, EINVAL);
+
+    va_list ap;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
+
+    output_init(&output,
+                &buf[0],
+                sizeof(buf),
+                output_flush,
+                sys_get_stdout());
+
+    va_start(ap, format_p);
+    cvcprintf(&output, NULL, format_p, &ap);
+    va_end(ap);
+
+    return (output.length);
+}
+
+ssize_t std_format_fprintf(void *chan_p,
+                           const struct std_format_t *format_p,
+                           ...)
+{
+    ASSERTN(chan_p != NULL, EINVAL);
+    ASSERTN(format_p != NULL, EINVAL);
+
+    va_list ap;
+    struct output_t output;
+    char buf[CONFIG_STD_OUTPUT_BUFFER_MAX];
+
+    output_init(&output, &buf[0], sizeof(buf), output_flush, chan_p);
+
+    va_start(ap, format_p);
+    cvcprintf(&output, NULL, format_p, &ap);
+    va_end(ap);
+
+    return (output.length);
 }
 
 const char *std_strtolb(const char *str_p,
@@ -34,6 +34,28 @@
 #include "simba.h"
 #include <stdarg.h>
 
+/**
+ * A parsed conversion specification, and the literal text preceding
+ * it.
+ */
+struct std_format_spec_t {
+    far_string_t literal_p;
+    size_t literal_size;
+    int width;
+    char flags;
+    char length;
+    /* Zero(0) if only literal text. */
+    char specifier;
+};
+
+/**
+ * A format string compiled by `std_format_init()`.
+ */
+struct std_format_t {
+    struct std_format_spec_t *specs_p;
+    int length;
+};
+
 /**
  * Initialize the std module. This function must be called before
  * calling any other function in this module.
@@ -211,6 +233,67 @@ ssize_t std_printf_isr(far_string_t fmt_p, ...);
  */
 ssize_t std_fprintf_isr(void *chan_p, far_string_t fmt_p, ...);
 
+/**
+ * Compile given format string once, so that formatting with it does
+ * not parse the format string. Commonly used formats, for example in
+ * logging, may be compiled at startup.
+ *
+ * See `std_sprintf()` for the the format string specification.
+ *
+ * @param[out] self_p Format to initialize.
+ * @param[in] specs_p Conversion specifications array. One element is
+ *                    used per conversion, plus one for the text
+ *                    after the last conversion.
+ * @param[in] length Number of elements in the specifications array.
+ * @param[in] fmt_p Format string. Must be valid as long as the
+ *                  format is used.
+ *
+ * @return zero(0) or negative error code.
+ */
+int std_format_init(struct std_format_t *self_p,
+                    struct std_format_spec_t *specs_p,
+                    int length,
+                    far_string_t fmt_p);
+
+/**
+ * Same as `std_sprintf()`, but with a compiled format.
+ *
+ * @param[out] dst_p Destination buffer.
+ * @param[in] format_p Compiled format.
+ * @param[in] ... Variable arguments list.
+ *
+ * @return Length of the string written to the destination buffer, not
+ *         including the null termination, or negative error code.
+ */
+ssize_t std_format_sprintf(char *dst_p,
+                           const struct std_format_t *format_p,
+                           ...);
+
+/**
+ * Same as `std_printf()`, but with a compiled format.
+ *
+ * @param[in] format_p Compiled format.
+ * @param[in] ... Variable arguments list.
+ *
+ * @return Number of characters written to standard output, or
+ *         negative error code.
+ */
+ssize_t std_format_printf(const struct std_format_t *format_p, ...);
+
+/**
+ * Same as `std_fprintf()`, but with a compiled format.
+ *
+ * @param[in] chan_p Output channel.
+ * @param[in] format_p Compiled format.
+ * @param[in] ... Variable arguments list.
+ *
+ * @return Number of characters written to given channel, or negative
+ *         error code.
+ */
+ssize_t std_format_fprintf(void *chan_p,
+                           const struct std_format_t *format_p,
+                           ...);
+
 /**
  * Convert given string to an integer in given base.
  *
@@ -0,0 +1,147 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define NUMBER_OF_KEYS 64
+
+FIFO_DEFINE_TEMPLATE(int);
+
+static struct fifo_int_t fifo;
+static int fifo_buf[16];
+static struct circular_buffer_t circular_buffer;
+static char circular_buffer_buf[64];
+static struct hash_map_t hash_map;
+static struct hash_map_bucket_t buckets[32];
+static struct hash_map_entry_t entries[NUMBER_OF_KEYS];
+static struct list_t list;
+static struct list_elem_t elem;
+static struct binary_tree_t binary_tree;
+static struct binary_tree_node_t nodes[NUMBER_OF_KEYS];
+static struct heap_t heap;
+static uint8_t heap_buf[1024];
+static size_t heap_sizes[HEAP_FIXED_SIZES_MAX] = {
+    8, 16, 32, 64, 128, 256, 512, 512
+};
+static int key;
+
+static int hash_function(longptr_t key)
+{
+    return (key);
+}
+
+static void bench_fifo(void *arg_p)
+{
+    int value;
+
+    value = 1;
+    fifo_put_int(&fifo, &value);
+    fifo_get_int(&fifo, &value);
+}
+
+static void bench_circular_buffer(void *arg_p)
+{
+    char buf[16];
+
+    memset(&buf[0], 0, sizeof(buf));
+    circular_buffer_write(&circular_buffer, &buf[0], sizeof(buf));
+    circular_buffer_read(&circular_buffer, &buf[0], sizeof(buf));
+}
+
+static void bench_hash_map(void *arg_p)
+{
+    longptr_t value;
+
+    key = ((key + 1) % NUMBER_OF_KEYS);
+    hash_map_get(&hash_map, key, &value);
+}
+
+static void bench_list(void *arg_p)
+{
+    list_add_tail(&list, &elem);
+    list_remove_head(&list);
+}
+
+static void bench_binary_tree(void *arg_p)
+{
+    key = ((key + 1) % NUMBER_OF_KEYS);
+    binary_tree_search(&binary_tree, key);
+}
+
+static void bench_bits(void *arg_p)
+{
+    key = bits_insert_32(key, 3, 5, 7);
+}
+
+static void bench_heap(void *arg_p)
+{
+    heap_free(&heap, heap_alloc(&heap, 24));
+}
+
+int main()
+{
+    int i;
+    struct harness_bench_t benchmarks[] = {
+        { bench_fifo, "fifo_put_get", NULL, NULL },
+        { bench_circular_buffer, "circular_buffer_write_read", NULL, NULL },
+        { bench_hash_map, "hash_map_get", NULL, NULL },
+        { bench_list, "list_add_remove", NULL, NULL },
+        { bench_binary_tree, "binary_tree_search", NULL, NULL },
+        { bench_bits, "bits_insert_32", NULL, NULL },
+        { bench_heap, "heap_alloc_free", NULL, &heap },
+        { NULL, NULL, NULL, NULL }
+    };
+
+    sys_start();
+
+    fifo_init_int(&fifo, &fifo_buf[0], membersof(fifo_buf));
+    circular_buffer_init(&circular_buffer,
+                         &circular_buffer_buf[0],
+                         sizeof(circular_buffer_buf));
+    hash_map_init(&hash_map,
+                  &buckets[0],
+                  membersof(buckets),
+                  &entries[0],
+                  membersof(entries),
+                  hash_function);
+    list_init(&list);
+    binary_tree_init(&binary_tree);
+    heap_init(&heap, &heap_buf[0], sizeof(heap_buf), &heap_sizes[0]);
+
+    for (i = 0; i < NUMBER_OF_KEYS; i++) {
+        hash_map_add(&hash_map, i, i);
+        nodes[i].key = i;
+        binary_tree_insert(&binary_tree, &nodes[i]);
+    }
+
+    harness_bench(benchmarks);
+
+    return (0);
+}
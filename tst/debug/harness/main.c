@@ -247,6 +247,87 @@ static int test_mock_cwrite(void)
     return (0);
 }
 
+static int test_mock_many_ids(void)
+{
+    static char ids[200][8];
+    char id[8];
+    int value;
+    int i;
+    int j;
+
+    /* Interleaved writes to many ids. */
+    for (j = 0; j < 2; j++) {
+        for (i = 0; i < membersof(ids); i++) {
+            std_sprintf(&ids[i][0], FSTR("id%d"), i);
+            value = (2 * i + j);
+            BTASSERTI(harness_mock_write(&ids[i][0],
+                                         &value,
+                                         sizeof(value)), ==, sizeof(value));
+        }
+    }
+
+    /* Read in reverse id order, using copies of the ids. Entries with
+       the same id are read in write order. */
+    for (i = membersof(ids) - 1; i >= 0; i--) {
+        strcpy(&id[0], &ids[i][0]);
+
+        for (j = 0; j < 2; j++) {
+            BTASSERTI(harness_mock_read(&id[0],
+                                        &value,
+                                        sizeof(value)), ==, sizeof(value));
+            BTASSERTI(value, ==, 2 * i + j);
+        }
+    }
+
+    BTASSERTI(harness_mock_try_read("id0", &value, sizeof(value)),
+              ==,
+              -ENOENT);
+
+    /* Writes to different ids from the same reused buffer. */
+    for (i = 0; i < 2; i++) {
+        std_sprintf(&id[0], FSTR("reused%d"), i);
+        value = i;
+        BTASSERTI(harness_mock_write(&id[0], &value, sizeof(value)),
+                  ==,
+                  sizeof(value));
+    }
+
+    strcpy(&id[0], "garbage");
+
+    BTASSERTI(harness_mock_read("reused0", &value, sizeof(value)),
+              ==,
+              sizeof(value));
+    BTASSERTI(value, ==, 0);
+    BTASSERTI(harness_mock_read("reused1", &value, sizeof(value)),
+              ==,
+              sizeof(value));
+    BTASSERTI(value, ==, 1);
+
+    /* A callback entry is read before later entries with the same
+       id. */
+    value = 1;
+    j = 2;
+    BTASSERTI(harness_mock_cwrite("id",
+                                  &value,
+                                  sizeof(value),
+                                  cwrite_cb,
+                                  &j,
+                                  sizeof(j)), ==, sizeof(value));
+    value = 5;
+    BTASSERTI(harness_mock_write("id", &value, sizeof(value)),
+              ==,
+              sizeof(value));
+
+    for (i = 0; i < 3; i++) {
+        BTASSERTI(harness_mock_read("id", &value, sizeof(value)),
+                  ==,
+                  sizeof(value));
+        BTASSERTI(value, ==, 2 * i + 1);
+    }
+
+    return (0);
+}
+
 static int test_stub(void)
 {
     mock_write_foo(0);
@@ -275,6 +356,7 @@ int main()
         { test_mock_wait_notify, "test_mock_wait_notify" },
         { test_mock_mwrite, "test_mock_mwrite" },
         { test_mock_cwrite, "test_mock_cwrite" },
+        { test_mock_many_ids, "test_mock_many_ids" },
         { test_stub, "test_stub" },
         { NULL, NULL }
     };
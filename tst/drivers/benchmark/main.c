@@ -0,0 +1,146 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+/* Shift out one byte, MSB first, on a data and a clock pin, as done
+   by the bit-banged drivers. Divide 8 bits by the median time to get
+   the maximum bit rate, or multiply the time by the CPU frequency to
+   get the number of cycles per byte. */
+
+#define DATA_DEV_P                                      &pin_device[0]
+#define CLOCK_DEV_P                                     &pin_device[1]
+
+static struct pin_driver_t data_pin;
+static struct pin_driver_t clock_pin;
+static uint32_t data_mask;
+static uint32_t clock_mask;
+static volatile uint8_t byte = 0xa5;
+static volatile uint32_t result;
+
+static void bench_pin_write(void *arg_p)
+{
+    int i;
+    uint8_t value;
+
+    value = byte;
+
+    for (i = 0; i < 8; i++) {
+        pin_write(&data_pin, (value & 0x80));
+        pin_write(&clock_pin, 1);
+        pin_write(&clock_pin, 0);
+        value <<= 1;
+    }
+}
+
+static void bench_pin_device_write(void *arg_p)
+{
+    int i;
+    uint8_t value;
+
+    value = byte;
+
+    for (i = 0; i < 8; i++) {
+        pin_device_write(DATA_DEV_P, (value & 0x80));
+        pin_device_write_high(CLOCK_DEV_P);
+        pin_device_write_low(CLOCK_DEV_P);
+        value <<= 1;
+    }
+}
+
+static void bench_pin_device_write_mask(void *arg_p)
+{
+    int i;
+    uint8_t value;
+
+    value = byte;
+
+    /* Data is written together with the falling clock edge. */
+    for (i = 0; i < 8; i++) {
+        if (value & 0x80) {
+            pin_device_write_mask(DATA_DEV_P, data_mask, clock_mask);
+        } else {
+            pin_device_write_mask(DATA_DEV_P, 0, data_mask | clock_mask);
+        }
+
+        pin_device_write_mask(DATA_DEV_P, clock_mask, 0);
+        value <<= 1;
+    }
+}
+
+static void bench_pin_read(void *arg_p)
+{
+    int i;
+    uint8_t value;
+
+    value = 0;
+
+    for (i = 0; i < 8; i++) {
+        value <<= 1;
+        value |= pin_read(&data_pin);
+    }
+
+    result = value;
+}
+
+static void bench_pin_device_read_mask(void *arg_p)
+{
+    result = pin_device_read_mask(DATA_DEV_P, data_mask | clock_mask);
+}
+
+int main()
+{
+    struct harness_bench_t benchmarks[] = {
+        { bench_pin_write, "pin_write_byte", NULL, NULL },
+        { bench_pin_device_write, "pin_device_write_byte", NULL, NULL },
+        {
+            bench_pin_device_write_mask,
+            "pin_device_write_mask_byte",
+            NULL,
+            NULL
+        },
+        { bench_pin_read, "pin_read_byte", NULL, NULL },
+        { bench_pin_device_read_mask, "pin_device_read_mask", NULL, NULL },
+        { NULL, NULL, NULL, NULL }
+    };
+
+    sys_start();
+    pin_module_init();
+
+    pin_init(&data_pin, DATA_DEV_P, PIN_OUTPUT);
+    pin_init(&clock_pin, CLOCK_DEV_P, PIN_OUTPUT);
+    data_mask = pin_device_mask(DATA_DEV_P);
+    clock_mask = pin_device_mask(CLOCK_DEV_P);
+
+    harness_bench(benchmarks);
+
+    return (0);
+}
@@ -325,6 +325,28 @@ static int test_device_input_pull_down(void)
     return (0);
 }
 
+static int test_device_write_read_mask(void)
+{
+    uint32_t d8_mask;
+    uint32_t d9_mask;
+
+    d8_mask = pin_device_mask(&pin_d8_dev);
+    d9_mask = pin_device_mask(&pin_d9_dev);
+
+    BTASSERT(pin_device_set_mode(&pin_d8_dev, PIN_INPUT) == 0);
+    BTASSERT(pin_device_set_mode(&pin_d9_dev, PIN_OUTPUT) == 0);
+
+    /* Write high. */
+    BTASSERT(pin_device_write_mask(&pin_d9_dev, d9_mask, 0) == 0);
+    BTASSERT(pin_device_read_mask(&pin_d8_dev, d8_mask) == d8_mask);
+
+    /* Write low. */
+    BTASSERT(pin_device_write_mask(&pin_d9_dev, 0, d9_mask) == 0);
+    BTASSERT(pin_device_read_mask(&pin_d8_dev, d8_mask) == 0);
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -344,6 +366,7 @@ int main()
         { test_device_input, "test_device_input" },
         { test_device_input_pull_up, "test_device_input_pull_up" },
         { test_device_input_pull_down, "test_device_input_pull_down" },
+        { test_device_write_read_mask, "test_device_write_read_mask" },
         { NULL, NULL }
     };
 
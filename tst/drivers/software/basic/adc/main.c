@@ -0,0 +1,307 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#define CSV_PATH "adc_input.csv"
+#define WAV_PATH "adc_input.wav"
+
+#define SAMPLING_RATE                                   10000
+#define BUFFER_LENGTH                                     100
+#define NUMBER_OF_BUFFERS                                   3
+
+static struct adc_driver_t adc;
+static struct adc_stream_t stream;
+static struct adc_stream_buffer_t buffers[NUMBER_OF_BUFFERS];
+static uint16_t samples[NUMBER_OF_BUFFERS][BUFFER_LENGTH];
+static int number_of_callbacks;
+
+static void stream_callback(void *arg_p,
+                            struct adc_stream_buffer_t *buffer_p)
+{
+    number_of_callbacks++;
+}
+
+static int write_csv(void)
+{
+    FILE *file_p;
+    int i;
+
+    file_p = fopen(CSV_PATH, "w");
+    BTASSERT(file_p != NULL);
+    fprintf(file_p, "sample\n");
+
+    for (i = 0; i < 1000; i++) {
+        fprintf(file_p, "%d\n", i);
+    }
+
+    fclose(file_p);
+
+    return (0);
+}
+
+static int write_wav(void)
+{
+    FILE *file_p;
+    uint8_t header[] = {
+        'R', 'I', 'F', 'F', 48, 0, 0, 0, 'W', 'A', 'V', 'E',
+        /* An unknown chunk that should be skipped. */
+        'L', 'I', 'S', 'T', 4, 0, 0, 0, 'I', 'N', 'F', 'O',
+        /* PCM, two channels, 8000 Hz, 16 bits per sample. */
+        'f', 'm', 't', ' ', 16, 0, 0, 0,
+        1, 0, 2, 0, 0x40, 0x1f, 0, 0, 0x00, 0x7d, 0, 0, 4, 0, 16, 0,
+        'd', 'a', 't', 'a', 12, 0, 0, 0,
+        /* Left and right channel samples. */
+        0x00, 0x80, 0x11, 0x11,
+        0x00, 0x00, 0x22, 0x22,
+        0xff, 0x7f, 0x33, 0x33
+    };
+
+    file_p = fopen(WAV_PATH, "wb");
+    BTASSERT(file_p != NULL);
+    BTASSERT(fwrite(&header[0], sizeof(header), 1, file_p) == 1);
+    fclose(file_p);
+
+    return (0);
+}
+
+static int test_init(void)
+{
+    int i;
+
+    BTASSERT(adc_module_init() == 0);
+    BTASSERT(adc_module_init() == 0);
+    BTASSERT(adc_init(&adc,
+                      &adc_0_dev,
+                      &pin_a0_dev,
+                      ADC_REFERENCE_VCC,
+                      SAMPLING_RATE) == 0);
+
+    for (i = 0; i < NUMBER_OF_BUFFERS; i++) {
+        buffers[i].samples_p = &samples[i][0];
+        buffers[i].length = BUFFER_LENGTH;
+    }
+
+    BTASSERT(adc_stream_init(&stream,
+                             &adc,
+                             &buffers[0],
+                             NUMBER_OF_BUFFERS,
+                             stream_callback,
+                             NULL) == 0);
+
+    return (0);
+}
+
+static int test_convert_no_input_file(void)
+{
+    uint16_t values[2];
+
+    values[0] = 1;
+    values[1] = 1;
+    BTASSERT(adc_convert(&adc, &values[0], 2) == 0);
+    BTASSERT(values[0] == 0);
+    BTASSERT(values[1] == 0);
+
+    return (0);
+}
+
+static int test_convert_csv(void)
+{
+    uint16_t values[3];
+
+    BTASSERT(write_csv() == 0);
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, CSV_PATH) == 0);
+
+    BTASSERT(adc_convert(&adc, &values[0], 3) == 0);
+    BTASSERT(values[0] == 0);
+    BTASSERT(values[1] == 1);
+    BTASSERT(values[2] == 2);
+
+    BTASSERT(adc_convert_isr(&adc, &values[0]) == 0);
+    BTASSERT(values[0] == 3);
+
+    return (0);
+}
+
+static int test_convert_wav(void)
+{
+    uint16_t values[4];
+
+    BTASSERT(write_wav() == 0);
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, WAV_PATH) == 0);
+
+    /* First channel only, replayed from the beginning at the end of
+       the data chunk. */
+    BTASSERT(adc_convert(&adc, &values[0], 4) == 0);
+    BTASSERT(values[0] == 0);
+    BTASSERT(values[1] == 32768);
+    BTASSERT(values[2] == 65535);
+    BTASSERT(values[3] == 0);
+
+    return (0);
+}
+
+static int test_stream(void)
+{
+    struct adc_stream_buffer_t *buffer_p;
+    struct time_t previous;
+    int i;
+    int j;
+
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, CSV_PATH) == 0);
+
+    number_of_callbacks = 0;
+    previous.seconds = 0;
+    previous.nanoseconds = 0;
+
+    BTASSERT(adc_stream_start(&stream) == 0);
+    BTASSERT(adc_stream_start(&stream) == -EBUSY);
+
+    /* Samples are continuous over the buffers and the file is
+       replayed from the beginning after 1000 samples. */
+    for (i = 0; i < 15; i++) {
+        BTASSERT(adc_stream_read(&stream, &buffer_p) == 0);
+        BTASSERT(buffer_p->length == BUFFER_LENGTH);
+
+        for (j = 0; j < BUFFER_LENGTH; j++) {
+            BTASSERTI(buffer_p->samples_p[j], ==, (100 * i + j) % 1000);
+        }
+
+        BTASSERT(time_compare(&buffer_p->timestamp,
+                              &previous) != time_compare_less_than_t);
+        previous = buffer_p->timestamp;
+    }
+
+    BTASSERT(adc_stream_stop(&stream) == 0);
+    BTASSERT(adc_stream_stop(&stream) == -EINVAL);
+    BTASSERTI(number_of_callbacks, >=, 15);
+
+    return (0);
+}
+
+static void wait_for_callbacks(int number)
+{
+    while (number_of_callbacks < number) {
+        thrd_sleep_ms(1);
+    }
+}
+
+static int test_stream_overrun(void)
+{
+    struct adc_stream_buffer_t *buffer_p;
+    int res;
+    int i;
+
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, CSV_PATH) == 0);
+    number_of_callbacks = 0;
+    BTASSERT(adc_stream_start(&stream) == 0);
+
+    /* Hold the first buffer while more buffers than fit in the stream
+       are produced. */
+    BTASSERT(adc_stream_read(&stream, &buffer_p) == 0);
+    wait_for_callbacks(3 * NUMBER_OF_BUFFERS);
+
+    /* The held buffer is not overwritten. */
+    for (i = 0; i < BUFFER_LENGTH; i++) {
+        BTASSERTI(buffer_p->samples_p[i], ==, i);
+    }
+
+    /* The next buffer read is the oldest kept after the overruns. */
+    res = adc_stream_read(&stream, &buffer_p);
+    BTASSERTI(res, >=, 3 * NUMBER_OF_BUFFERS - 1 - NUMBER_OF_BUFFERS);
+    BTASSERTI(buffer_p->samples_p[0], ==, (100 * (1 + res)) % 1000);
+
+    for (i = 0; i < BUFFER_LENGTH; i++) {
+        BTASSERTI(buffer_p->samples_p[i],
+                  ==,
+                  (buffer_p->samples_p[0] + i) % 1000);
+    }
+
+    BTASSERT(adc_stream_stop(&stream) == 0);
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, NULL) == 0);
+
+    return (0);
+}
+
+static int test_stream_no_early_overrun(void)
+{
+    struct adc_stream_buffer_t *buffer_p;
+
+    /* A buffer period of 100 ms, much longer than the system
+       tick. */
+    BTASSERT(adc_init(&adc,
+                      &adc_0_dev,
+                      &pin_a0_dev,
+                      ADC_REFERENCE_VCC,
+                      SAMPLING_RATE / 100) == 0);
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, CSV_PATH) == 0);
+    number_of_callbacks = 0;
+    BTASSERT(adc_stream_start(&stream) == 0);
+
+    /* Hold the first buffer until all buffers are filled. */
+    BTASSERT(adc_stream_read(&stream, &buffer_p) == 0);
+    wait_for_callbacks(NUMBER_OF_BUFFERS);
+
+    /* No buffer is dropped before the first sample of the next
+       buffer is due. */
+    BTASSERTI(adc_stream_read(&stream, &buffer_p), ==, 0);
+    BTASSERTI(buffer_p->samples_p[0], ==, BUFFER_LENGTH);
+
+    BTASSERT(adc_stream_stop(&stream) == 0);
+    BTASSERT(adc_port_device_set_input_file(&adc_0_dev, NULL) == 0);
+    BTASSERT(adc_init(&adc,
+                      &adc_0_dev,
+                      &pin_a0_dev,
+                      ADC_REFERENCE_VCC,
+                      SAMPLING_RATE) == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_convert_no_input_file, "test_convert_no_input_file" },
+        { test_convert_csv, "test_convert_csv" },
+        { test_convert_wav, "test_convert_wav" },
+        { test_stream, "test_stream" },
+        { test_stream_overrun, "test_stream_overrun" },
+        { test_stream_no_early_overrun, "test_stream_no_early_overrun" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -0,0 +1,258 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#define WAV_PATH "dac_output.wav"
+
+#define SAMPLING_RATE                                   10000
+#define BUFFER_LENGTH                                     100
+#define NUMBER_OF_BUFFERS                                   3
+
+static struct dac_driver_t dac;
+static struct dac_stream_t stream;
+static struct dac_stream_buffer_t buffers[NUMBER_OF_BUFFERS];
+static uint32_t samples[NUMBER_OF_BUFFERS][BUFFER_LENGTH];
+static uint32_t next_sample;
+static uint32_t last_sample;
+
+static int refill(void *arg_p,
+                  struct dac_stream_buffer_t *buffer_p)
+{
+    uint32_t *samples_p;
+    size_t i;
+
+    if (next_sample == last_sample) {
+        return (-1);
+    }
+
+    samples_p = buffer_p->samples_p;
+
+    for (i = 0; i < buffer_p->length; i++) {
+        samples_p[i] = next_sample++;
+    }
+
+    return (0);
+}
+
+/**
+ * Read the WAV file and check its header. Returns the number of
+ * samples in the file.
+ */
+static ssize_t read_wav(uint32_t *samples_p, size_t length)
+{
+    FILE *file_p;
+    uint8_t header[44];
+    uint32_t size;
+    ssize_t res;
+
+    file_p = fopen(WAV_PATH, "rb");
+    BTASSERT(file_p != NULL);
+    BTASSERT(fread(&header[0], sizeof(header), 1, file_p) == 1);
+    BTASSERTM(&header[0], "RIFF", 4);
+    BTASSERTM(&header[8], "WAVEfmt ", 8);
+    BTASSERTM(&header[20], "\x01\x00\x02\x00\x10\x27\x00\x00", 8);
+    BTASSERTM(&header[32], "\x04\x00\x10\x00" "data", 8);
+    size = (header[40]
+            | (header[41] << 8)
+            | (header[42] << 16)
+            | (header[43] << 24));
+    BTASSERTI(size % 4, ==, 0);
+    BTASSERTI(size / 4, <=, length);
+    res = fread(samples_p, 4, size / 4, file_p);
+    BTASSERTI(res, ==, size / 4);
+    fclose(file_p);
+
+    return (res);
+}
+
+static int test_init(void)
+{
+    int i;
+
+    BTASSERT(dac_module_init() == 0);
+    BTASSERT(dac_module_init() == 0);
+    BTASSERT(dac_init(&dac,
+                      &dac_0_dev,
+                      &pin_dac0_dev,
+                      &pin_dac1_dev,
+                      SAMPLING_RATE) == 0);
+
+    for (i = 0; i < NUMBER_OF_BUFFERS; i++) {
+        buffers[i].samples_p = &samples[i][0];
+        buffers[i].length = BUFFER_LENGTH;
+    }
+
+    return (0);
+}
+
+static int test_convert(void)
+{
+    uint32_t values[4];
+    uint32_t wav[4];
+
+    values[0] = 0x00000000;
+    values[1] = 0x7fff8000;
+    values[2] = 0x12345678;
+    values[3] = 0xffffffff;
+
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, WAV_PATH) == 0);
+    BTASSERT(dac_convert(&dac, &values[0], 2) == 0);
+    BTASSERT(dac_async_convert(&dac, &values[2], 2) == 0);
+    BTASSERT(dac_async_wait(&dac) == 0);
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, NULL) == 0);
+
+    BTASSERT(read_wav(&wav[0], membersof(wav)) == 4);
+    BTASSERTM(&wav[0], &values[0], sizeof(values));
+
+    return (0);
+}
+
+static int test_stream_refill(void)
+{
+    static uint32_t wav[8000];
+    ssize_t size;
+    ssize_t i;
+
+    BTASSERT(dac_stream_init(&stream,
+                             &dac,
+                             &buffers[0],
+                             NUMBER_OF_BUFFERS,
+                             refill,
+                             NULL) == 0);
+
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, WAV_PATH) == 0);
+
+    /* Samples for ten buffers. */
+    next_sample = 1;
+    last_sample = 1001;
+
+    BTASSERT(dac_stream_start(&stream) == 0);
+    BTASSERT(dac_stream_start(&stream) == -EBUSY);
+    thrd_sleep_ms(200);
+    BTASSERT(dac_stream_stop(&stream) == 0);
+    BTASSERT(dac_stream_stop(&stream) == -EINVAL);
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, NULL) == 0);
+
+    BTASSERTI(stream.counters.underruns, ==, 1);
+    BTASSERTI(stream.counters.late_refills, >=, 1);
+
+    /* All samples without gaps followed by silence. */
+    size = read_wav(&wav[0], membersof(wav));
+    BTASSERTI(size, >, 1000);
+
+    for (i = 0; i < 1000; i++) {
+        BTASSERTI(wav[i], ==, i + 1);
+    }
+
+    for (i = 1000; i < size; i++) {
+        BTASSERTI(wav[i], ==, 0);
+    }
+
+    return (0);
+}
+
+static int test_stream_write(void)
+{
+    static uint32_t wav[8000];
+    struct dac_stream_buffer_t *buffer_p;
+    uint32_t *samples_p;
+    ssize_t size;
+    ssize_t i;
+    int j;
+
+    BTASSERT(dac_stream_init(&stream,
+                             &dac,
+                             &buffers[0],
+                             NUMBER_OF_BUFFERS,
+                             NULL,
+                             NULL) == 0);
+
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, WAV_PATH) == 0);
+
+    /* Write ten buffers. All buffers are written before the stream
+       is started, and then the thread waits for free buffers. */
+    for (i = 0; i < 10; i++) {
+        if (i == NUMBER_OF_BUFFERS) {
+            BTASSERT(dac_stream_start(&stream) == 0);
+        }
+
+        BTASSERT(dac_stream_get_buffer(&stream, &buffer_p) == 0);
+        samples_p = buffer_p->samples_p;
+
+        for (j = 0; j < BUFFER_LENGTH; j++) {
+            samples_p[j] = (BUFFER_LENGTH * i + j + 1);
+        }
+
+        BTASSERT(dac_stream_write(&stream) == 0);
+    }
+
+    /* Not enough time to convert all buffers. */
+    BTASSERTI(stream.counters.underruns, ==, 0);
+    thrd_sleep_ms(100);
+    BTASSERT(dac_stream_stop(&stream) == 0);
+    BTASSERT(dac_port_device_set_output_file(&dac_0_dev, NULL) == 0);
+
+    BTASSERTI(stream.counters.underruns, ==, 1);
+    BTASSERTI(stream.counters.late_refills, ==, 0);
+
+    /* The written buffers are converted on start, so all samples
+       without gaps followed by silence. */
+    size = read_wav(&wav[0], membersof(wav));
+    BTASSERTI(size, >=, 1000);
+
+    for (i = 0; i < 1000; i++) {
+        BTASSERTI(wav[i], ==, i + 1);
+    }
+
+    for (i = 1000; i < size; i++) {
+        BTASSERTI(wav[i], ==, 0);
+    }
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_convert, "test_convert" },
+        { test_stream_refill, "test_stream_refill" },
+        { test_stream_write, "test_stream_write" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -0,0 +1,318 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+/* The simulated timer ticks once per microsecond, so the period is
+   1000 ticks. */
+#define FREQUENCY                                        1000
+#define PERIOD                                           1000
+#define CHANNELS                                            4
+
+/* Recorded edges of one channel. */
+struct channel_t {
+    struct pin_device_t *pin_dev_p;
+    int value;
+    int has_rise;
+    unsigned long rise;
+    /* Allowed high times. */
+    long allowed[2];
+    int pulses;
+    int bad_pulses;
+};
+
+static struct pwm_soft_driver_t pwm_soft[CHANNELS];
+
+static struct {
+    unsigned long now;
+    struct channel_t channels[CHANNELS];
+    long period_jitter_max;
+    int rising_edges_max;
+} recorder;
+
+static void record(void)
+{
+    struct channel_t *channel_p;
+    int rising_edges;
+    long period;
+    long high;
+    int value;
+    int i;
+
+    rising_edges = 0;
+
+    for (i = 0; i < CHANNELS; i++) {
+        channel_p = &recorder.channels[i];
+        value = channel_p->pin_dev_p->value;
+
+        if (value == channel_p->value) {
+            continue;
+        }
+
+        channel_p->value = value;
+
+        if (value == 1) {
+            rising_edges++;
+
+            if (channel_p->has_rise == 1) {
+                period = (recorder.now - channel_p->rise);
+
+                if (period < PERIOD) {
+                    period = (PERIOD - period);
+                } else {
+                    period -= PERIOD;
+                }
+
+                if (period > recorder.period_jitter_max) {
+                    recorder.period_jitter_max = period;
+                }
+            }
+
+            channel_p->rise = recorder.now;
+            channel_p->has_rise = 1;
+        } else if (channel_p->has_rise == 1) {
+            high = (recorder.now - channel_p->rise);
+            channel_p->pulses++;
+
+            if ((high != channel_p->allowed[0])
+                && (high != channel_p->allowed[1])) {
+                std_printf(OSTR("channel %d: bad pulse of %ld ticks\r\n"),
+                           i,
+                           high);
+                channel_p->bad_pulses++;
+            }
+        }
+    }
+
+    if (rising_edges > recorder.rising_edges_max) {
+        recorder.rising_edges_max = rising_edges;
+    }
+}
+
+/**
+ * Run the software PWM timer for given number of ticks.
+ */
+static void simulate(unsigned long ticks)
+{
+    unsigned long end;
+    unsigned int delta;
+
+    end = (recorder.now + ticks);
+
+    while (recorder.now < end) {
+        delta = pwm_soft_port_timer_isr();
+        record();
+        recorder.now += delta;
+    }
+}
+
+static void expect(int channel, long old, long new)
+{
+    recorder.channels[channel].allowed[0] = old;
+    recorder.channels[channel].allowed[1] = new;
+}
+
+static int test_init(void)
+{
+    int i;
+
+    BTASSERT(pwm_soft_module_init(FREQUENCY) == 0);
+    BTASSERT(pwm_soft_set_frequency(FREQUENCY) == 0);
+    BTASSERT(pwm_soft_duty_cycle(100) == PERIOD);
+
+    for (i = 0; i < CHANNELS; i++) {
+        recorder.channels[i].pin_dev_p = &pin_device[i];
+        BTASSERT(pwm_soft_init(&pwm_soft[i],
+                               &pin_device[i],
+                               pwm_soft_duty_cycle(10 + 20 * i)) == 0);
+        expect(i, 100 + 200 * i, 100 + 200 * i);
+    }
+
+    return (0);
+}
+
+static int test_start(void)
+{
+    struct channel_t *channel_p;
+    int i;
+
+    for (i = 0; i < CHANNELS; i++) {
+        BTASSERT(pwm_soft_start(&pwm_soft[i]) == 0);
+    }
+
+    BTASSERT(pwm_soft_set_frequency(FREQUENCY) == -1);
+
+    simulate(10 * PERIOD);
+
+    for (i = 0; i < CHANNELS; i++) {
+        channel_p = &recorder.channels[i];
+        BTASSERTI(channel_p->pulses, >=, 9);
+        BTASSERTI(channel_p->bad_pulses, ==, 0);
+
+        /* The phases are spread over the period. */
+        BTASSERTI(channel_p->rise % PERIOD,
+                  ==,
+                  PERIOD * i / CONFIG_PWM_SOFT_CHANNELS_MAX);
+    }
+
+    std_printf(OSTR("period jitter: %ld ticks, "
+                    "simultaneous rising edges: %d\r\n"),
+               recorder.period_jitter_max,
+               recorder.rising_edges_max);
+
+    BTASSERTI(recorder.period_jitter_max, ==, 0);
+    BTASSERTI(recorder.rising_edges_max, ==, 1);
+
+    return (0);
+}
+
+static int test_set_duty_cycle(void)
+{
+    int i;
+
+    /* Update in the middle of a pulse. Channel 3 wraps from 70 % to
+       20 %. */
+    simulate(PERIOD / 2);
+    expect(1, 300, 900);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[1], 900) == 0);
+    expect(3, 700, 200);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[3], 200) == 0);
+    simulate(3 * PERIOD);
+
+    /* The second update replaces the first before it is used. */
+    expect(0, 100, 400);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[0], 300) == 0);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[0], 400) == 0);
+    simulate(3 * PERIOD + 123);
+
+    /* Channel 3 wraps again. */
+    expect(3, 200, 950);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[3], 950) == 0);
+    simulate(3 * PERIOD);
+
+    for (i = 0; i < CHANNELS; i++) {
+        BTASSERTI(recorder.channels[i].bad_pulses, ==, 0);
+    }
+
+    std_printf(OSTR("period jitter: %ld ticks\r\n"),
+               recorder.period_jitter_max);
+
+    BTASSERTI(recorder.period_jitter_max, ==, 0);
+
+    return (0);
+}
+
+static int test_duty_cycle_min_max(void)
+{
+    /* Always high. */
+    recorder.channels[2].has_rise = 0;
+    expect(2, 500, 500);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[2], PERIOD) == 0);
+    simulate(3 * PERIOD);
+    BTASSERTI(pin_device[2].value, ==, 1);
+    BTASSERTI(recorder.channels[2].bad_pulses, ==, 0);
+
+    /* Always low. */
+    recorder.channels[2].has_rise = 0;
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[2], 0) == 0);
+    simulate(3 * PERIOD);
+    BTASSERTI(pin_device[2].value, ==, 0);
+
+    /* Back to 50 %. */
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[2], 500) == 0);
+    simulate(3 * PERIOD);
+    BTASSERTI(recorder.channels[2].bad_pulses, ==, 0);
+
+    /* Channel 0 rises at the start of the period, where the always
+       high pin falls in the first period of the new schedule. The
+       pin must stay high until the end of the first pulse. */
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[0], PERIOD) == 0);
+    simulate(3 * PERIOD);
+    BTASSERTI(pin_device[0].value, ==, 1);
+    recorder.channels[0].has_rise = 0;
+    expect(0, 300, 300);
+    BTASSERT(pwm_soft_set_duty_cycle(&pwm_soft[0], 300) == 0);
+    simulate((PERIOD - recorder.now % PERIOD) % PERIOD + 100);
+    BTASSERTI(recorder.now % PERIOD, <, 300);
+    BTASSERTI(pin_device[0].value, ==, 1);
+    simulate(3 * PERIOD);
+    BTASSERTI(recorder.channels[0].pulses, >=, 3);
+    BTASSERTI(recorder.channels[0].bad_pulses, ==, 0);
+
+    return (0);
+}
+
+static int test_stop(void)
+{
+    int i;
+
+    /* The stop does not wait for the simulated timer in the Linux
+       port. High pins are set low in the first period of the new
+       schedule. */
+    simulate(PERIOD / 2);
+
+    for (i = 0; i < CHANNELS; i++) {
+        BTASSERT(pwm_soft_stop(&pwm_soft[i]) == 0);
+    }
+
+    simulate(2 * PERIOD);
+
+    for (i = 0; i < CHANNELS; i++) {
+        BTASSERTI(pin_device[i].value, ==, 0);
+    }
+
+    for (i = 0; i < CHANNELS; i++) {
+        BTASSERTI(recorder.channels[i].bad_pulses, ==, 0);
+    }
+
+    BTASSERT(pwm_soft_set_frequency(2 * FREQUENCY) == 0);
+    BTASSERT(pwm_soft_duty_cycle(100) == PERIOD / 2);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_start, "test_start" },
+        { test_set_duty_cycle, "test_set_duty_cycle" },
+        { test_duty_cycle_min_max, "test_duty_cycle_min_max" },
+        { test_stop, "test_stop" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
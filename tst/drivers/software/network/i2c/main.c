@@ -0,0 +1,496 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#define NUMBER_OF_SENSORS                                  12
+#define SENSOR_ADDRESS                                   0x40
+#define SENSOR_DATA_REGISTER                             0x02
+#define SENSOR_DATA_SIZE                                    6
+
+/* A sensor with a register file. A write sets the register pointer
+   and writes any following data. Reads start at the register
+   pointer. */
+struct sensor_t {
+    struct i2c_port_slave_t base;
+    uint8_t registers[16];
+    uint8_t pointer;
+};
+
+/* Bus utilisation of a polling strategy. */
+struct utilisation_t {
+    uint32_t starts;
+    uint32_t stops;
+    uint32_t bytes;
+};
+
+static struct i2c_driver_t i2c;
+static struct sensor_t sensors[NUMBER_OF_SENSORS];
+static char order[2 * NUMBER_OF_SENSORS];
+static int number_of_callbacks;
+static int number_of_requeues;
+static int requeue_res;
+static int is_slow;
+
+static ssize_t sensor_transfer(void *arg_p,
+                               int flags,
+                               void *buf_p,
+                               size_t size)
+{
+    struct sensor_t *self_p;
+    uint8_t *u8_buf_p;
+    size_t i;
+
+    self_p = arg_p;
+    u8_buf_p = buf_p;
+
+    /* Let other threads run in the middle of a transfer. */
+    if (is_slow == 1) {
+        thrd_sleep_ms(1);
+    }
+
+    for (i = 0; i < size; i++) {
+        if (flags & I2C_MESSAGE_READ) {
+            u8_buf_p[i] = self_p->registers[self_p->pointer];
+            self_p->pointer++;
+        } else if (i == 0) {
+            self_p->pointer = u8_buf_p[i];
+        } else {
+            self_p->registers[self_p->pointer] = u8_buf_p[i];
+            self_p->pointer++;
+        }
+
+        self_p->pointer %= sizeof(self_p->registers);
+    }
+
+    return (size);
+}
+
+static void transaction_callback(void *arg_p,
+                                 struct i2c_transaction_t *transaction_p)
+{
+    order[number_of_callbacks] = *(char *)arg_p;
+    number_of_callbacks++;
+}
+
+static void requeue_callback(void *arg_p,
+                             struct i2c_transaction_t *transaction_p)
+{
+    if (number_of_requeues > 0) {
+        requeue_res = i2c_async_transaction(transaction_p);
+        number_of_requeues--;
+    }
+}
+
+static void counters_reset(void)
+{
+    memset(&i2c_device[0].counters, 0, sizeof(i2c_device[0].counters));
+}
+
+static void utilisation_get(struct utilisation_t *utilisation_p)
+{
+    utilisation_p->starts = i2c_device[0].counters.starts;
+    utilisation_p->stops = i2c_device[0].counters.stops;
+    utilisation_p->bytes = i2c_device[0].counters.bytes;
+}
+
+/**
+ * Number of bus clock cycles used. Each byte is nine bits including
+ * the acknowledge bit, and start and stop conditions are one bit
+ * each.
+ */
+static uint32_t utilisation_bits(struct utilisation_t *utilisation_p)
+{
+    return (9 * utilisation_p->bytes
+            + utilisation_p->starts
+            + utilisation_p->stops);
+}
+
+static void utilisation_print(const char *name_p,
+                              struct utilisation_t *utilisation_p)
+{
+    uint32_t bits;
+
+    bits = utilisation_bits(utilisation_p);
+
+    std_printf(FSTR("%-10s starts: %3lu, stops: %3lu, bytes: %3lu, "
+                    "bits: %4lu, time at 100 kbps: %5lu us\r\n"),
+               name_p,
+               (unsigned long)utilisation_p->starts,
+               (unsigned long)utilisation_p->stops,
+               (unsigned long)utilisation_p->bytes,
+               (unsigned long)bits,
+               (unsigned long)(10 * bits));
+}
+
+static int test_init(void)
+{
+    int i;
+    int j;
+
+    BTASSERT(i2c_module_init() == 0);
+    BTASSERT(i2c_module_init() == 0);
+
+    BTASSERT(i2c_init(&i2c,
+                      &i2c_device[0],
+                      I2C_BAUDRATE_100KBPS,
+                      -1) == 0);
+    BTASSERT(i2c_start(&i2c) == 0);
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        for (j = 0; j < sizeof(sensors[i].registers); j++) {
+            sensors[i].registers[j] = (16 * i + j);
+        }
+
+        BTASSERT(i2c_port_device_add_slave(&i2c_device[0],
+                                           &sensors[i].base,
+                                           SENSOR_ADDRESS + i,
+                                           sensor_transfer,
+                                           &sensors[i]) == 0);
+    }
+
+    BTASSERT(i2c_scan(&i2c, SENSOR_ADDRESS) == 1);
+    BTASSERT(i2c_scan(&i2c, 0x10) == 0);
+
+    return (0);
+}
+
+static int test_transfer(void)
+{
+    struct i2c_message_t messages[3];
+    uint8_t buf[4];
+
+    /* Write two registers and read them back in a single transfer. */
+    messages[0].flags = I2C_MESSAGE_WRITE;
+    messages[0].buf_p = "\x08\xaa\xbb";
+    messages[0].size = 3;
+    messages[1].flags = I2C_MESSAGE_WRITE;
+    messages[1].buf_p = "\x07";
+    messages[1].size = 1;
+    messages[2].flags = I2C_MESSAGE_READ;
+    messages[2].buf_p = &buf[0];
+    messages[2].size = 4;
+
+    counters_reset();
+
+    BTASSERT(i2c_transfer(&i2c,
+                          SENSOR_ADDRESS,
+                          &messages[0],
+                          membersof(messages)) == 8);
+    BTASSERTM(&buf[0], "\x07\xaa\xbb\x0a", 4);
+
+    /* Repeated start conditions between the messages. */
+    BTASSERT(i2c_device[0].counters.starts == 3);
+    BTASSERT(i2c_device[0].counters.stops == 1);
+    BTASSERT(i2c_device[0].counters.bytes == 11);
+
+    /* No slave with given address. */
+    BTASSERT(i2c_transfer(&i2c, 0x10, &messages[0], 1) == -1);
+
+    return (0);
+}
+
+static int test_write_read(void)
+{
+    uint8_t buf[SENSOR_DATA_SIZE];
+
+    counters_reset();
+
+    BTASSERT(i2c_write_read(&i2c,
+                            SENSOR_ADDRESS + 1,
+                            "\x02",
+                            1,
+                            &buf[0],
+                            sizeof(buf)) == sizeof(buf));
+    BTASSERTM(&buf[0], "\x12\x13\x14\x15\x16\x17", 6);
+    BTASSERT(i2c_device[0].counters.starts == 2);
+    BTASSERT(i2c_device[0].counters.stops == 1);
+
+    BTASSERT(i2c_write_read(&i2c,
+                            0x10,
+                            "\x02",
+                            1,
+                            &buf[0],
+                            sizeof(buf)) == -1);
+
+    return (0);
+}
+
+static int test_async_transactions(void)
+{
+    struct i2c_transaction_t transactions[NUMBER_OF_SENSORS];
+    struct i2c_message_t messages[NUMBER_OF_SENSORS][2];
+    uint8_t bufs[NUMBER_OF_SENSORS][SENSOR_DATA_SIZE];
+    uint8_t reg;
+    char ids[NUMBER_OF_SENSORS];
+    int i;
+
+    number_of_callbacks = 0;
+    reg = SENSOR_DATA_REGISTER;
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        ids[i] = ('a' + i);
+        messages[i][0].flags = I2C_MESSAGE_WRITE;
+        messages[i][0].buf_p = &reg;
+        messages[i][0].size = 1;
+        messages[i][1].flags = I2C_MESSAGE_READ;
+        messages[i][1].buf_p = &bufs[i][0];
+        messages[i][1].size = SENSOR_DATA_SIZE;
+        BTASSERT(i2c_transaction_init(&transactions[i],
+                                      &i2c,
+                                      SENSOR_ADDRESS + i,
+                                      &messages[i][0],
+                                      2,
+                                      transaction_callback,
+                                      &ids[i]) == 0);
+    }
+
+    /* Queue all transactions back-to-back. */
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(i2c_async_transaction(&transactions[i]) == 0);
+    }
+
+    BTASSERT(i2c_async_transaction(&transactions[NUMBER_OF_SENSORS - 1])
+             == -EBUSY);
+
+    /* Transactions are executed in queue order. */
+    BTASSERT(i2c_transaction_wait(&transactions[NUMBER_OF_SENSORS - 1])
+             == 1 + SENSOR_DATA_SIZE);
+    BTASSERT(number_of_callbacks == NUMBER_OF_SENSORS);
+    BTASSERTM(&order[0], "abcdefghijkl", NUMBER_OF_SENSORS);
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(i2c_transaction_wait(&transactions[i])
+                 == 1 + SENSOR_DATA_SIZE);
+        BTASSERT(bufs[i][0] == 16 * i + SENSOR_DATA_REGISTER);
+        BTASSERT(bufs[i][5] == 16 * i + SENSOR_DATA_REGISTER + 5);
+    }
+
+    /* Queue again when executed. */
+    BTASSERT(i2c_transaction(&transactions[0]) == 1 + SENSOR_DATA_SIZE);
+    BTASSERT(number_of_callbacks == NUMBER_OF_SENSORS + 1);
+
+    return (0);
+}
+
+static int test_requeue_from_callback(void)
+{
+    struct i2c_transaction_t transaction;
+    struct i2c_message_t message;
+    uint8_t buf[2];
+
+    buf[0] = 0x08;
+    buf[1] = 0x08;
+    message.flags = I2C_MESSAGE_WRITE;
+    message.buf_p = &buf[0];
+    message.size = 2;
+    number_of_requeues = 2;
+    requeue_res = -1;
+    counters_reset();
+
+    BTASSERT(i2c_transaction_init(&transaction,
+                                  &i2c,
+                                  SENSOR_ADDRESS,
+                                  &message,
+                                  1,
+                                  requeue_callback,
+                                  NULL) == 0);
+
+    /* The callback queues the transaction again twice. */
+    BTASSERT(i2c_async_transaction(&transaction) == 0);
+
+    while (number_of_requeues > 0) {
+        thrd_sleep_ms(1);
+    }
+
+    BTASSERT(i2c_transaction_wait(&transaction) == 2);
+    BTASSERTI(requeue_res, ==, 0);
+    BTASSERTI(i2c_device[0].counters.stops, ==, 3);
+
+    return (0);
+}
+
+static int test_blocking_and_async(void)
+{
+    struct i2c_transaction_t transaction;
+    struct i2c_message_t messages[2];
+    uint8_t async_reg;
+    uint8_t async_buf[SENSOR_DATA_SIZE];
+    uint8_t blocking_reg;
+    uint8_t blocking_buf[2];
+    int i;
+
+    async_reg = SENSOR_DATA_REGISTER;
+    messages[0].flags = I2C_MESSAGE_WRITE;
+    messages[0].buf_p = &async_reg;
+    messages[0].size = 1;
+    messages[1].flags = I2C_MESSAGE_READ;
+    messages[1].buf_p = &async_buf[0];
+    messages[1].size = SENSOR_DATA_SIZE;
+
+    BTASSERT(i2c_transaction_init(&transaction,
+                                  &i2c,
+                                  SENSOR_ADDRESS,
+                                  &messages[0],
+                                  2,
+                                  NULL,
+                                  NULL) == 0);
+
+    /* The i2c thread and this thread access the same sensor at the
+       same time. The register pointer written by one of them must
+       not be overwritten by the other before the read. */
+    is_slow = 1;
+    blocking_reg = 0x0a;
+
+    BTASSERT(i2c_async_transaction(&transaction) == 0);
+    BTASSERT(i2c_write_read(&i2c,
+                            SENSOR_ADDRESS,
+                            &blocking_reg,
+                            1,
+                            &blocking_buf[0],
+                            sizeof(blocking_buf)) == sizeof(blocking_buf));
+    BTASSERT(i2c_transaction_wait(&transaction) == 1 + SENSOR_DATA_SIZE);
+    is_slow = 0;
+
+    BTASSERTI(blocking_buf[0], ==, 0x0a);
+    BTASSERTI(blocking_buf[1], ==, 0x0b);
+
+    for (i = 0; i < SENSOR_DATA_SIZE; i++) {
+        BTASSERTI(async_buf[i], ==, SENSOR_DATA_REGISTER + i);
+    }
+
+    return (0);
+}
+
+static int test_benchmark(void)
+{
+    struct utilisation_t separate;
+    struct utilisation_t combined;
+    struct utilisation_t queued;
+    struct i2c_transaction_t transactions[NUMBER_OF_SENSORS];
+    struct i2c_message_t messages[NUMBER_OF_SENSORS][2];
+    uint8_t bufs[NUMBER_OF_SENSORS][SENSOR_DATA_SIZE];
+    uint8_t reg;
+    int i;
+
+    reg = SENSOR_DATA_REGISTER;
+
+    /* Poll all sensors with a write and a read per sensor. */
+    counters_reset();
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(i2c_write(&i2c, SENSOR_ADDRESS + i, &reg, 1) == 1);
+        BTASSERT(i2c_read(&i2c,
+                          SENSOR_ADDRESS + i,
+                          &bufs[i][0],
+                          SENSOR_DATA_SIZE) == SENSOR_DATA_SIZE);
+    }
+
+    utilisation_get(&separate);
+
+    /* Poll all sensors with a combined write and read per sensor. */
+    counters_reset();
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(i2c_write_read(&i2c,
+                                SENSOR_ADDRESS + i,
+                                &reg,
+                                1,
+                                &bufs[i][0],
+                                SENSOR_DATA_SIZE) == SENSOR_DATA_SIZE);
+    }
+
+    utilisation_get(&combined);
+
+    /* Poll all sensors with queued transactions. */
+    counters_reset();
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        messages[i][0].flags = I2C_MESSAGE_WRITE;
+        messages[i][0].buf_p = &reg;
+        messages[i][0].size = 1;
+        messages[i][1].flags = I2C_MESSAGE_READ;
+        messages[i][1].buf_p = &bufs[i][0];
+        messages[i][1].size = SENSOR_DATA_SIZE;
+        BTASSERT(i2c_transaction_init(&transactions[i],
+                                      &i2c,
+                                      SENSOR_ADDRESS + i,
+                                      &messages[i][0],
+                                      2,
+                                      NULL,
+                                      NULL) == 0);
+        BTASSERT(i2c_async_transaction(&transactions[i]) == 0);
+    }
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(i2c_transaction_wait(&transactions[i])
+                 == 1 + SENSOR_DATA_SIZE);
+    }
+
+    utilisation_get(&queued);
+
+    std_printf(FSTR("Polling %d sensors:\r\n"), NUMBER_OF_SENSORS);
+    utilisation_print("separate", &separate);
+    utilisation_print("combined", &combined);
+    utilisation_print("queued", &queued);
+
+    /* A combined transfer saves one stop condition per sensor. */
+    BTASSERT(separate.starts == 2 * NUMBER_OF_SENSORS);
+    BTASSERT(separate.stops == 2 * NUMBER_OF_SENSORS);
+    BTASSERT(combined.starts == 2 * NUMBER_OF_SENSORS);
+    BTASSERT(combined.stops == NUMBER_OF_SENSORS);
+    BTASSERT(combined.bytes == separate.bytes);
+    BTASSERT(utilisation_bits(&combined) < utilisation_bits(&separate));
+    BTASSERT(queued.stops == combined.stops);
+    BTASSERT(queued.bytes == combined.bytes);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_transfer, "test_transfer" },
+        { test_write_read, "test_write_read" },
+        { test_async_transactions, "test_async_transactions" },
+        { test_requeue_from_callback, "test_requeue_from_callback" },
+        { test_blocking_and_async, "test_blocking_and_async" },
+        { test_benchmark, "test_benchmark" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
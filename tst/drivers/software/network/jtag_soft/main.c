@@ -29,25 +29,57 @@
  */
 
 #include "simba.h"
-#include "drivers/basic/pin_mock.h"
 
-static int mock_write_clock_low(void)
+/* TCK, TMS and TDI are in the same port. */
+#define TCK_MASK                                          0x1
+#define TMS_MASK                                          0x2
+#define TDI_MASK                                          0x4
+
+static int mock_write_clock_low(int tms, int tdi)
 {
-    mock_write_pin_write(0, 0);
+    uint32_t high_mask;
+    uint32_t low_mask;
+
+    high_mask = 0;
+    low_mask = TCK_MASK;
+
+    if (tms == 1) {
+        high_mask |= TMS_MASK;
+    } else if (tms == 0) {
+        low_mask |= TMS_MASK;
+    }
+
+    if (tdi == 1) {
+        high_mask |= TDI_MASK;
+    } else if (tdi == 0) {
+        low_mask |= TDI_MASK;
+    }
+
+    harness_mock_write("pin_port_device_write_mask(high_mask)",
+                       &high_mask,
+                       sizeof(high_mask));
+    harness_mock_write("pin_port_device_write_mask(low_mask)",
+                       &low_mask,
+                       sizeof(low_mask));
 
     return (0);
 }
 
 static int mock_write_clock_high(void)
 {
-    mock_write_pin_write(1, 0);
+    struct pin_device_t *dev_p;
+
+    dev_p = &pin_device[0];
+    harness_mock_write("pin_port_device_write_high(dev_p)",
+                       &dev_p,
+                       sizeof(dev_p));
 
     return (0);
 }
 
-static int mock_write_clock_pulse(void)
+static int mock_write_clock_pulse(int tms)
 {
-    mock_write_clock_low();
+    mock_write_clock_low(tms, -1);
     mock_write_clock_high();
 
     return (0);
@@ -59,9 +91,7 @@ static int mock_write_move(uint8_t bits,
     size_t i;
 
     for (i = 0; i < number_of_bits; i++) {
-        /* TMS. */
-        mock_write_pin_write(((bits >> i) & 1), 0);
-        mock_write_clock_pulse();
+        mock_write_clock_pulse((bits >> i) & 1);
     }
 
     return (0);
@@ -99,6 +129,8 @@ static int mock_write_transfer(uint8_t *rxbuf_p,
     size_t i;
     size_t byte_index;
     size_t bit_index;
+    int tms;
+    int tdi;
     int value;
 
     for (i = 0; i < number_of_bits; i++) {
@@ -106,19 +138,24 @@ static int mock_write_transfer(uint8_t *rxbuf_p,
         bit_index = (7 - (i % 8));
 
         if (i == number_of_bits - 1) {
-            mock_write_pin_write(1, 0);
+            tms = 1;
+        } else {
+            tms = -1;
         }
 
         if (txbuf_p != NULL) {
-            value = ((txbuf_p[byte_index] >> bit_index) & 1);
-            mock_write_pin_write(value, 0);
+            tdi = ((txbuf_p[byte_index] >> bit_index) & 1);
+        } else {
+            tdi = -1;
         }
 
-        mock_write_clock_low();
+        mock_write_clock_low(tms, tdi);
 
         if (rxbuf_p != NULL) {
             value = ((rxbuf_p[byte_index] >> bit_index) & 1);
-            mock_write_pin_read(value);
+            harness_mock_write("pin_port_device_read(): return (value)",
+                               &value,
+                               sizeof(value));
         }
 
         mock_write_clock_high();
@@ -129,12 +166,27 @@ static int mock_write_transfer(uint8_t *rxbuf_p,
     return (0);
 }
 
+static int mock_write_set_mode(int index, int mode)
+{
+    struct pin_device_t *dev_p;
+
+    dev_p = &pin_device[index];
+    harness_mock_write("pin_port_device_set_mode(dev_p)",
+                       &dev_p,
+                       sizeof(dev_p));
+    harness_mock_write("pin_port_device_set_mode(mode)",
+                       &mode,
+                       sizeof(mode));
+
+    return (0);
+}
+
 static int mock_write_init(void)
 {
-    mock_write_pin_init(&pin_device[0], PIN_INPUT, 0);
-    mock_write_pin_init(&pin_device[1], PIN_INPUT, 0);
-    mock_write_pin_init(&pin_device[2], PIN_INPUT, 0);
-    mock_write_pin_init(&pin_device[3], PIN_INPUT, 0);
+    mock_write_set_mode(0, PIN_INPUT);
+    mock_write_set_mode(1, PIN_INPUT);
+    mock_write_set_mode(2, PIN_INPUT);
+    mock_write_set_mode(3, PIN_INPUT);
 
     return (0);
 }
@@ -149,9 +201,9 @@ static int mock_write_reset(void)
 
 static int mock_write_start(void)
 {
-    mock_write_pin_set_mode(PIN_OUTPUT, 0);
-    mock_write_pin_set_mode(PIN_OUTPUT, 0);
-    mock_write_pin_set_mode(PIN_OUTPUT, 0);
+    mock_write_set_mode(0, PIN_OUTPUT);
+    mock_write_set_mode(1, PIN_OUTPUT);
+    mock_write_set_mode(2, PIN_OUTPUT);
 
     return (mock_write_reset());
 }
@@ -159,9 +211,9 @@ static int mock_write_start(void)
 static int mock_write_stop(void)
 {
     mock_write_move_to_reset();
-    mock_write_pin_set_mode(PIN_INPUT, 0);
-    mock_write_pin_set_mode(PIN_INPUT, 0);
-    mock_write_pin_set_mode(PIN_INPUT, 0);
+    mock_write_set_mode(0, PIN_INPUT);
+    mock_write_set_mode(1, PIN_INPUT);
+    mock_write_set_mode(2, PIN_INPUT);
 
     return (0);
 }
@@ -342,20 +394,89 @@ static int test_make_transition(void)
     BTASSERT(jtag_soft_start(&jtag) == 0);
 
     /* Zero transition. */
-    mock_write_pin_write(0, 0);
-    mock_write_clock_pulse();
+    mock_write_clock_pulse(0);
 
     BTASSERT(jtag_soft_make_transition(&jtag, 0) == 0);
 
     /* One transition. */
-    mock_write_pin_write(1, 0);
-    mock_write_clock_pulse();
+    mock_write_clock_pulse(1);
 
     BTASSERT(jtag_soft_make_transition(&jtag, 1) == 0);
 
     return (0);
 }
 
+int STUB(pin_port_device_set_mode)(const struct pin_device_t *dev_p,
+                                   int mode)
+{
+    harness_mock_assert("pin_port_device_set_mode(dev_p)",
+                        &dev_p,
+                        sizeof(dev_p));
+    harness_mock_assert("pin_port_device_set_mode(mode)",
+                        &mode,
+                        sizeof(mode));
+
+    return (0);
+}
+
+uint32_t STUB(pin_port_device_mask)(const struct pin_device_t *dev_p)
+{
+    return (1 << (dev_p - &pin_device[0]));
+}
+
+int STUB(pin_port_device_is_same_port)(const struct pin_device_t *dev_p,
+                                       const struct pin_device_t *other_p)
+{
+    return (1);
+}
+
+int STUB(pin_port_device_write_mask)(const struct pin_device_t *dev_p,
+                                     uint32_t high_mask,
+                                     uint32_t low_mask)
+{
+    BTASSERT(dev_p == &pin_device[0]);
+
+    harness_mock_assert("pin_port_device_write_mask(high_mask)",
+                        &high_mask,
+                        sizeof(high_mask));
+    harness_mock_assert("pin_port_device_write_mask(low_mask)",
+                        &low_mask,
+                        sizeof(low_mask));
+
+    return (0);
+}
+
+int STUB(pin_port_device_write_high)(const struct pin_device_t *dev_p)
+{
+    harness_mock_assert("pin_port_device_write_high(dev_p)",
+                        &dev_p,
+                        sizeof(dev_p));
+
+    return (0);
+}
+
+int STUB(pin_port_device_write_low)(const struct pin_device_t *dev_p)
+{
+    harness_mock_assert("pin_port_device_write_low(dev_p)",
+                        &dev_p,
+                        sizeof(dev_p));
+
+    return (0);
+}
+
+int STUB(pin_port_device_read)(const struct pin_device_t *dev_p)
+{
+    int value;
+
+    BTASSERT(dev_p == &pin_device[3]);
+
+    harness_mock_read("pin_port_device_read(): return (value)",
+                      &value,
+                      sizeof(value));
+
+    return (value);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
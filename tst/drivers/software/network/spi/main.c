@@ -0,0 +1,308 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#define SS_A_PIN_DEV &pin_device[0]
+#define SS_B_PIN_DEV &pin_device[1]
+
+/* Slave A echoes the written data, slave B always returns 0xb0. */
+struct slave_t {
+    struct spi_port_slave_t base;
+    uint8_t data;
+    uint8_t buf[64];
+    size_t size;
+};
+
+static struct spi_driver_t spi_a;
+static struct spi_driver_t spi_b;
+static struct slave_t slave_a;
+static struct slave_t slave_b;
+static char order[16];
+static int number_of_callbacks;
+static int number_of_requeues;
+static int requeue_res;
+
+static ssize_t slave_transfer(void *arg_p,
+                              void *rxbuf_p,
+                              const void *txbuf_p,
+                              size_t size)
+{
+    struct slave_t *self_p;
+    size_t i;
+
+    self_p = arg_p;
+
+    for (i = 0; i < size; i++) {
+        if (txbuf_p != NULL) {
+            self_p->buf[self_p->size] = ((const uint8_t *)txbuf_p)[i];
+        } else {
+            self_p->buf[self_p->size] = 0xff;
+        }
+
+        if (rxbuf_p != NULL) {
+            if (self_p->data == 0) {
+                ((uint8_t *)rxbuf_p)[i] = self_p->buf[self_p->size];
+            } else {
+                ((uint8_t *)rxbuf_p)[i] = self_p->data;
+            }
+        }
+
+        self_p->size++;
+        self_p->size %= sizeof(self_p->buf);
+    }
+
+    return (size);
+}
+
+static void transaction_callback(void *arg_p,
+                                 struct spi_transaction_t *transaction_p)
+{
+    order[number_of_callbacks] = *(char *)arg_p;
+    number_of_callbacks++;
+}
+
+static void requeue_callback(void *arg_p,
+                             struct spi_transaction_t *transaction_p)
+{
+    if (number_of_requeues > 0) {
+        requeue_res = spi_async_transaction(transaction_p);
+        number_of_requeues--;
+    }
+}
+
+static int test_init(void)
+{
+    BTASSERT(spi_module_init() == 0);
+    BTASSERT(spi_module_init() == 0);
+
+    BTASSERT(spi_init(&spi_a,
+                      &spi_device[0],
+                      SS_A_PIN_DEV,
+                      SPI_MODE_MASTER,
+                      SPI_SPEED_1MBPS,
+                      0,
+                      0) == 0);
+    BTASSERT(spi_init(&spi_b,
+                      &spi_device[0],
+                      SS_B_PIN_DEV,
+                      SPI_MODE_MASTER,
+                      SPI_SPEED_250KBPS,
+                      1,
+                      1) == 0);
+
+    slave_b.data = 0xb0;
+
+    BTASSERT(spi_port_device_add_slave(&spi_device[0],
+                                       &slave_a.base,
+                                       SS_A_PIN_DEV,
+                                       slave_transfer,
+                                       &slave_a) == 0);
+    BTASSERT(spi_port_device_add_slave(&spi_device[0],
+                                       &slave_b.base,
+                                       SS_B_PIN_DEV,
+                                       slave_transfer,
+                                       &slave_b) == 0);
+
+    return (0);
+}
+
+static int test_blocking(void)
+{
+    uint8_t buf[3];
+
+    /* Not selected. */
+    slave_a.size = 0;
+    BTASSERT(spi_write(&spi_a, "\x01\x02", 2) == 2);
+    BTASSERT(slave_a.size == 0);
+
+    BTASSERT(spi_take_bus(&spi_a) == 0);
+    BTASSERT(spi_select(&spi_a) == 0);
+    BTASSERT(spi_transfer(&spi_a, &buf[0], "\x01\x02\x03", 3) == 3);
+    BTASSERT(spi_deselect(&spi_a) == 0);
+    BTASSERT(spi_give_bus(&spi_a) == 0);
+
+    BTASSERTM(&buf[0], "\x01\x02\x03", 3);
+    BTASSERT(slave_a.size == 3);
+
+    return (0);
+}
+
+static int test_transaction(void)
+{
+    struct spi_transaction_t transaction;
+    struct spi_transfer_t transfers[2];
+    uint8_t buf[3];
+
+    /* Write a command and read the response. */
+    transfers[0].rxbuf_p = NULL;
+    transfers[0].txbuf_p = "\x10\x20";
+    transfers[0].size = 2;
+    transfers[0].deselect = 0;
+    transfers[1].rxbuf_p = &buf[0];
+    transfers[1].txbuf_p = NULL;
+    transfers[1].size = sizeof(buf);
+    transfers[1].deselect = 0;
+
+    slave_b.size = 0;
+
+    BTASSERT(spi_transaction_init(&transaction,
+                                  &spi_b,
+                                  &transfers[0],
+                                  membersof(transfers),
+                                  NULL,
+                                  NULL) == 0);
+    BTASSERT(spi_transaction(&transaction) == 5);
+    BTASSERTM(&buf[0], "\xb0\xb0\xb0", 3);
+    BTASSERTM(&slave_b.buf[0], "\x10\x20\xff\xff\xff", 5);
+
+    /* The slave is deselected after the transaction. */
+    BTASSERT(spi_write(&spi_b, "\x01", 1) == 1);
+    BTASSERT(slave_b.size == 5);
+
+    /* The driver configuration is used on the bus. */
+    BTASSERT(spi_device[0].drv_p == &spi_b);
+
+    return (0);
+}
+
+static int test_async_transactions(void)
+{
+    struct spi_transaction_t transactions[6];
+    struct spi_transfer_t transfers[6];
+    uint8_t bufs[6][2];
+    char ids[6];
+    int i;
+
+    number_of_callbacks = 0;
+    slave_a.size = 0;
+    slave_b.size = 0;
+
+    for (i = 0; i < 6; i++) {
+        ids[i] = ('0' + i);
+        transfers[i].rxbuf_p = &bufs[i][0];
+        transfers[i].txbuf_p = &ids[i];
+        transfers[i].size = 1;
+        transfers[i].deselect = (i == 0);
+        BTASSERT(spi_transaction_init(&transactions[i],
+                                      (i % 2 == 0) ? &spi_a : &spi_b,
+                                      &transfers[i],
+                                      1,
+                                      transaction_callback,
+                                      &ids[i]) == 0);
+    }
+
+    /* Queue all transactions back-to-back. */
+    for (i = 0; i < 6; i++) {
+        BTASSERT(spi_async_transaction(&transactions[i]) == 0);
+    }
+
+    BTASSERT(spi_async_transaction(&transactions[5]) == -EBUSY);
+
+    /* Transactions are executed in queue order. */
+    BTASSERT(spi_transaction_wait(&transactions[5]) == 1);
+    BTASSERT(number_of_callbacks == 6);
+    BTASSERTM(&order[0], "012345", 6);
+
+    for (i = 0; i < 6; i++) {
+        BTASSERT(spi_transaction_wait(&transactions[i]) == 1);
+
+        if (i % 2 == 0) {
+            BTASSERT(bufs[i][0] == ids[i]);
+        } else {
+            BTASSERT(bufs[i][0] == 0xb0);
+        }
+    }
+
+    BTASSERTM(&slave_a.buf[0], "024", 3);
+    BTASSERTM(&slave_b.buf[0], "135", 3);
+
+    /* Queue again when executed. */
+    BTASSERT(spi_transaction(&transactions[0]) == 1);
+    BTASSERT(number_of_callbacks == 7);
+
+    return (0);
+}
+
+static int test_requeue_from_callback(void)
+{
+    struct spi_transaction_t transaction;
+    struct spi_transfer_t transfer;
+    uint8_t data;
+
+    data = 'r';
+    transfer.rxbuf_p = NULL;
+    transfer.txbuf_p = &data;
+    transfer.size = 1;
+    transfer.deselect = 0;
+    slave_a.size = 0;
+    number_of_requeues = 2;
+    requeue_res = -1;
+
+    BTASSERT(spi_transaction_init(&transaction,
+                                  &spi_a,
+                                  &transfer,
+                                  1,
+                                  requeue_callback,
+                                  NULL) == 0);
+
+    /* The callback queues the transaction again twice. */
+    BTASSERT(spi_async_transaction(&transaction) == 0);
+
+    while (number_of_requeues > 0) {
+        thrd_sleep_ms(1);
+    }
+
+    BTASSERT(spi_transaction_wait(&transaction) == 1);
+    BTASSERTI(requeue_res, ==, 0);
+    BTASSERTI(slave_a.size, ==, 3);
+    BTASSERTM(&slave_a.buf[0], "rrr", 3);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_blocking, "test_blocking" },
+        { test_transaction, "test_transaction" },
+        { test_async_transactions, "test_async_transactions" },
+        { test_requeue_from_callback, "test_requeue_from_callback" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -144,13 +144,8 @@ static int test_read_unescape(void)
 
     /* Prepare a frame from the XBee module where 0x7d 0x31 will be
        unescaped to 0x11. */
-    mock_write_chan_read(&buf[0], 1, 1);
-    mock_write_chan_read(&buf[1], 1, 1);
-    mock_write_chan_read(&buf[2], 1, 1);
-    mock_write_chan_read(&buf[3], 1, 1);
-    mock_write_chan_read(&buf[4], 1, 1);
-    mock_write_chan_read(&buf[5], 1, 1);
-    mock_write_chan_read(&buf[6], 1, 1);
+    mock_write_chan_size(sizeof(buf));
+    mock_write_chan_read(&buf[0], sizeof(buf), sizeof(buf));
 
     BTASSERT(xbee_read(&xbee, &frame) == 0);
 
@@ -162,6 +157,37 @@ static int test_read_unescape(void)
     return (0);
 }
 
+static int test_read_buffered(void)
+{
+    struct xbee_frame_t frame;
+    uint8_t buf[] = {
+        /* Garbage before the first frame delimiter. */
+        0x12, 0x34,
+        /* TX Status. */
+        0x7e, 0x00, 0x03, 0x89, 0x01, 0x00, 0x75,
+        /* AT Command Response, split over two reads. */
+        0x7e, 0x00, 0x06, 0x88, 0x02, 0x4d, 0x59, 0x00, 0x12, 0xbd
+    };
+
+    /* Both frames are read from the channel in two chunks. */
+    mock_write_chan_size(12);
+    mock_write_chan_read(&buf[0], 12, 12);
+    mock_write_chan_size(sizeof(buf) - 12);
+    mock_write_chan_read(&buf[12], sizeof(buf) - 12, sizeof(buf) - 12);
+
+    BTASSERT(xbee_read(&xbee, &frame) == 0);
+    BTASSERTI(frame.type, ==, XBEE_FRAME_TYPE_TX_STATUS);
+    BTASSERTI(frame.data.size, ==, 2);
+    BTASSERTM(&frame.data.buf[0], "\x01\x00", 2);
+
+    BTASSERT(xbee_read(&xbee, &frame) == 0);
+    BTASSERTI(frame.type, ==, XBEE_FRAME_TYPE_AT_COMMAND_RESPONSE);
+    BTASSERTI(frame.data.size, ==, 5);
+    BTASSERTM(&frame.data.buf[0], "\x02MY\x00\x12", 5);
+
+    return (0);
+}
+
 static int test_frame_type_as_string(void)
 {
     const char *actual_p;
@@ -552,6 +578,7 @@ int main()
         { test_write_at, "test_write_at" },
         { test_write_tx_request, "test_write_tx_request" },
         { test_read_unescape, "test_read_unescape" },
+        { test_read_buffered, "test_read_buffered" },
         { test_frame_type_as_string, "test_frame_type_as_string" },
         { test_tx_status_as_string, "test_tx_status_as_string" },
         { test_modem_status_as_string, "test_modem_status_as_string" },
@@ -0,0 +1,354 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+/* The client writes to the radio simulator over one queue and reads
+   from it over another, as it would over a UART. */
+static struct queue_t to_radio;
+static uint8_t to_radio_buf[512];
+static struct queue_t from_radio;
+static uint8_t from_radio_buf[512];
+
+static struct xbee_client_t client;
+static uint8_t client_rxbuf[256];
+static THRD_STACK(client_stack, 2048);
+
+static struct xbee_driver_t radio;
+static THRD_STACK(radio_stack, 2048);
+
+/* Radio simulator behaviour, configured by each test case. */
+static struct {
+    /* Number of TX statuses to hold back before sending them in
+       reverse order. */
+    int hold;
+    /* Ignore TX requests if non-zero. */
+    int drop;
+    uint8_t tx_status;
+    struct xbee_frame_t held[8];
+    int number_of_held;
+} sim;
+
+/* Completed asynchronous writes. */
+static struct {
+    int count;
+    int index[8];
+    int res[8];
+} completed;
+
+static struct event_t completed_event;
+
+static void on_write_complete(void *arg_p, int res)
+{
+    uint32_t mask;
+
+    completed.index[completed.count] = (int)(uintptr_t)arg_p;
+    completed.res[completed.count] = res;
+    completed.count++;
+
+    mask = 0x1;
+    event_write(&completed_event, &mask, sizeof(mask));
+}
+
+static void wait_for_completed(int count)
+{
+    uint32_t mask;
+
+    while (completed.count < count) {
+        mask = 0x1;
+        event_read(&completed_event, &mask, sizeof(mask));
+    }
+}
+
+static void reset(int hold, int drop, uint8_t tx_status)
+{
+    sim.hold = hold;
+    sim.drop = drop;
+    sim.tx_status = tx_status;
+    sim.number_of_held = 0;
+    completed.count = 0;
+}
+
+static void radio_handle_at_command(struct xbee_frame_t *frame_p)
+{
+    struct xbee_frame_t response;
+
+    /* Respond immediately with the parameter 0x1234. */
+    response.type = XBEE_FRAME_TYPE_AT_COMMAND_RESPONSE;
+    memcpy(&response.data.buf[0], &frame_p->data.buf[0], 3);
+    response.data.buf[3] = 0;
+    response.data.buf[4] = 0x12;
+    response.data.buf[5] = 0x34;
+    response.data.size = 6;
+    xbee_write(&radio, &response);
+}
+
+static void radio_handle_tx_request(struct xbee_frame_t *frame_p)
+{
+    struct xbee_frame_t *response_p;
+
+    if (sim.drop) {
+        return;
+    }
+
+    response_p = &sim.held[sim.number_of_held++];
+    response_p->type = XBEE_FRAME_TYPE_TX_STATUS;
+    response_p->data.buf[0] = frame_p->data.buf[0];
+    response_p->data.buf[1] = sim.tx_status;
+    response_p->data.size = 2;
+
+    if (sim.number_of_held < sim.hold) {
+        return;
+    }
+
+    /* Respond out of order. */
+    while (sim.number_of_held > 0) {
+        xbee_write(&radio, &sim.held[--sim.number_of_held]);
+    }
+}
+
+static void *radio_main(void *arg_p)
+{
+    struct xbee_frame_t frame;
+
+    thrd_set_name("radio");
+
+    while (1) {
+        if (xbee_read(&radio, &frame) != 0) {
+            continue;
+        }
+
+        switch (frame.type) {
+
+        case XBEE_FRAME_TYPE_AT_COMMAND:
+            radio_handle_at_command(&frame);
+            break;
+
+        case XBEE_FRAME_TYPE_TX_REQUEST_16_BIT_ADDRESS:
+            radio_handle_tx_request(&frame);
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return (NULL);
+}
+
+static int test_init(void)
+{
+    BTASSERT(xbee_client_module_init() == 0);
+    BTASSERT(event_init(&completed_event) == 0);
+    BTASSERT(queue_init(&to_radio,
+                        &to_radio_buf[0],
+                        sizeof(to_radio_buf)) == 0);
+    BTASSERT(queue_init(&from_radio,
+                        &from_radio_buf[0],
+                        sizeof(from_radio_buf)) == 0);
+    BTASSERT(xbee_init(&radio, &to_radio, &from_radio) == 0);
+    BTASSERT(xbee_client_init(&client,
+                              &from_radio,
+                              &to_radio,
+                              &client_rxbuf[0],
+                              sizeof(client_rxbuf),
+                              0) == 0);
+
+    BTASSERT(thrd_spawn(radio_main,
+                        NULL,
+                        0,
+                        &radio_stack[0],
+                        sizeof(radio_stack)) != NULL);
+    BTASSERT(thrd_spawn(xbee_client_main,
+                        &client,
+                        0,
+                        &client_stack[0],
+                        sizeof(client_stack)) != NULL);
+
+    return (0);
+}
+
+static int test_write(void)
+{
+    struct xbee_client_address_t address;
+
+    reset(1, 0, 0);
+    address.type = xbee_client_address_type_16_bits_t;
+    address.buf[0] = 0x12;
+    address.buf[1] = 0x34;
+
+    BTASSERTI(xbee_client_write_to(&client, "foo", 3, 0, &address), ==, 3);
+
+    return (0);
+}
+
+static int test_write_async_out_of_order(void)
+{
+    struct xbee_client_address_t address;
+    int i;
+
+    reset(4, 0, 0);
+    address.type = xbee_client_address_type_16_bits_t;
+    address.buf[0] = 0x12;
+    address.buf[1] = 0x34;
+
+    /* All four writes are pending at the same time. */
+    for (i = 0; i < 4; i++) {
+        BTASSERTI(xbee_client_write_to_async(&client,
+                                             "foo",
+                                             3,
+                                             &address,
+                                             on_write_complete,
+                                             (void *)(uintptr_t)i), ==, 3);
+        thrd_sleep_ms(1);
+
+        if (i < 3) {
+            BTASSERTI(completed.count, ==, 0);
+        }
+    }
+
+    /* The radio responds in reverse order. */
+    wait_for_completed(4);
+
+    for (i = 0; i < 4; i++) {
+        BTASSERTI(completed.index[i], ==, 3 - i);
+        BTASSERTI(completed.res[i], ==, 0);
+    }
+
+    return (0);
+}
+
+static int test_at_command_while_write_pending(void)
+{
+    struct xbee_client_address_t address;
+    uint16_t value;
+
+    reset(2, 0, 0);
+    address.type = xbee_client_address_type_16_bits_t;
+    address.buf[0] = 0x12;
+    address.buf[1] = 0x34;
+
+    BTASSERTI(xbee_client_write_to_async(&client,
+                                         "foo",
+                                         3,
+                                         &address,
+                                         on_write_complete,
+                                         (void *)0), ==, 3);
+
+    /* The AT command response is received before the TX status of
+       the pending write. */
+    BTASSERT(xbee_client_at_command_read_u16(&client, "MY", &value) == 0);
+    BTASSERTI(value, ==, 0x1234);
+    BTASSERTI(completed.count, ==, 0);
+
+    BTASSERTI(xbee_client_write_to_async(&client,
+                                         "bar",
+                                         3,
+                                         &address,
+                                         on_write_complete,
+                                         (void *)1), ==, 3);
+    wait_for_completed(2);
+    BTASSERTI(completed.index[0], ==, 1);
+    BTASSERTI(completed.index[1], ==, 0);
+
+    return (0);
+}
+
+static int test_write_async_negative_response(void)
+{
+    struct xbee_client_address_t address;
+
+    reset(1, 0, 1);
+    address.type = xbee_client_address_type_16_bits_t;
+    address.buf[0] = 0x12;
+    address.buf[1] = 0x34;
+
+    BTASSERTI(xbee_client_write_to_async(&client,
+                                         "foo",
+                                         3,
+                                         &address,
+                                         on_write_complete,
+                                         (void *)0), ==, 3);
+    wait_for_completed(1);
+    BTASSERTI(completed.res[0], ==, -EPROTO);
+
+    return (0);
+}
+
+static int test_write_async_timeout(void)
+{
+    struct xbee_client_address_t address;
+
+    reset(1, 1, 0);
+    address.type = xbee_client_address_type_16_bits_t;
+    address.buf[0] = 0x12;
+    address.buf[1] = 0x34;
+
+    BTASSERTI(xbee_client_write_to_async(&client,
+                                         "foo",
+                                         3,
+                                         &address,
+                                         on_write_complete,
+                                         (void *)0), ==, 3);
+    wait_for_completed(1);
+    BTASSERTI(completed.res[0], ==, -ETIMEDOUT);
+
+    /* The timed out request is free for reuse. */
+    reset(1, 0, 0);
+    BTASSERTI(xbee_client_write_to(&client, "foo", 3, 0, &address), ==, 3);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_write, "test_write" },
+        { test_write_async_out_of_order, "test_write_async_out_of_order" },
+        {
+            test_at_command_while_write_pending,
+            "test_at_command_while_write_pending"
+        },
+        {
+            test_write_async_negative_response,
+            "test_write_async_negative_response"
+        },
+        { test_write_async_timeout, "test_write_async_timeout" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
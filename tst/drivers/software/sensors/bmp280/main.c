@@ -64,17 +64,22 @@ static int test_i2c_start(void)
     mock_write_i2c_scan(0x76, 1);
 
     /* Chip id. */
-    mock_write_i2c_write(0x76, "\xd0", 1, 1);
-    mock_write_i2c_read(0x76, "\x58", 1, 1);
+    mock_write_i2c_write_read(0x76,
+                              "\xd0",
+                              1,
+                              "\x58",
+                              1,
+                              1);
 
     /* Calibration data. */
-    mock_write_i2c_write(0x76, "\x88", 1, 1);
-    mock_write_i2c_read(0x76,
-                        "\x70\x6b\x43\x67\x18\xfc\x5f\x8e"
-                        "\x43\xd6\xd0\x0b\x27\x0b\x8c\x00"
-                        "\xf9\xff\x8c\x3c\xf8\xc6\x70\x17",
-                        24,
-                        24);
+    mock_write_i2c_write_read(0x76,
+                              "\x88",
+                              1,
+                              "\x70\x6b\x43\x67\x18\xfc\x5f\x8e"
+                              "\x43\xd6\xd0\x0b\x27\x0b\x8c\x00"
+                              "\xf9\xff\x8c\x3c\xf8\xc6\x70\x17",
+                              24,
+                              24);
 
     BTASSERT(bmp280_start(&bmp280_i2c) == 0);
 
@@ -90,16 +95,28 @@ static int test_i2c_read(void)
     mock_write_i2c_write(0x76, "\xf4\x25", 2, 2);
 
     /* Status reading - not ready. */
-    mock_write_i2c_write(0x76, "\xf3", 1, 1);
-    mock_write_i2c_read(0x76, "\xff", 1, 1);
+    mock_write_i2c_write_read(0x76,
+                              "\xf3",
+                              1,
+                              "\xff",
+                              1,
+                              1);
 
     /* Status reading - ready. */
-    mock_write_i2c_write(0x76, "\xf3", 1, 1);
-    mock_write_i2c_read(0x76, "\x00", 1, 1);
+    mock_write_i2c_write_read(0x76,
+                              "\xf3",
+                              1,
+                              "\x00",
+                              1,
+                              1);
 
     /* Temperature and pressure reading. */
-    mock_write_i2c_write(0x76, "\xf7", 1, 1);
-    mock_write_i2c_read(0x76, "\x65\x5a\xc0\x7e\xed\x00", 6, 6);
+    mock_write_i2c_write_read(0x76,
+                              "\xf7",
+                              1,
+                              "\x65\x5a\xc0\x7e\xed\x00",
+                              6,
+                              6);
 
     BTASSERT(bmp280_read(&bmp280_i2c, &temperature, &pressure) == 0);
     BTASSERT(temperature > 25.082);
@@ -132,7 +149,12 @@ static int test_i2c_read_status_error(void)
     mock_write_i2c_write(0x76, "\xf4\x25", 2, 2);
 
     /* Status register - IO error. */
-    mock_write_i2c_write(0x76, "\xf3", 1, -EIO);
+    mock_write_i2c_write_read(0x76,
+                              "\xf3",
+                              1,
+                              "\x00",
+                              1,
+                              -EIO);
 
     BTASSERT(bmp280_read(&bmp280_i2c, &temperature, &pressure) == -EIO);
 
@@ -150,8 +172,12 @@ static int test_i2c_read_status_timeout(void)
 
     /* Status reading - not ready. */
     for (i = 0; i < CONFIG_BMP280_COVERTION_TIMEOUT_MS; i++) {
-        mock_write_i2c_write(0x76, "\xf3", 1, 1);
-        mock_write_i2c_read(0x76, "\xff", 1, 1);
+        mock_write_i2c_write_read(0x76,
+                              "\xf3",
+                                  1,
+                              "\xff",
+                                  1,
+                                  1);
     }
 
     BTASSERT(bmp280_read(&bmp280_i2c, &temperature, &pressure) == -ETIMEDOUT);
@@ -184,17 +210,22 @@ static int test_i2c_start_automatic(void)
     mock_write_i2c_scan(0x77, 1);
 
     /* Chip id. */
-    mock_write_i2c_write(0x77, "\xd0", 1, 1);
-    mock_write_i2c_read(0x77, "\x48", 1, 1);
+    mock_write_i2c_write_read(0x77,
+                              "\xd0",
+                              1,
+                              "\x48",
+                              1,
+                              1);
 
     /* Calibration data. */
-    mock_write_i2c_write(0x77, "\x88", 1, 1);
-    mock_write_i2c_read(0x77,
-                        "\x70\x6b\x43\x67\x18\xfc\x5f\x8e"
-                        "\x43\xd6\xd0\x0b\x27\x0b\x8c\x00"
-                        "\xf9\xff\x8c\x3c\xf8\xc6\x70\x17",
-                        24,
-                        24);
+    mock_write_i2c_write_read(0x77,
+                              "\x88",
+                              1,
+                              "\x70\x6b\x43\x67\x18\xfc\x5f\x8e"
+                              "\x43\xd6\xd0\x0b\x27\x0b\x8c\x00"
+                              "\xf9\xff\x8c\x3c\xf8\xc6\x70\x17",
+                              24,
+                              24);
 
     BTASSERTI(bmp280_start(&bmp280_i2c), ==, 0);
 
@@ -0,0 +1,326 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+
+#define NUMBER_OF_SENSORS                                   4
+#define PERIOD_MS                                         200
+
+/* Size of a published sample with a 32 bits value. */
+#define SAMPLE_SIZE (offsetof(struct sensor_hub_sample_t, data)  \
+                     + sizeof(int32_t))
+
+/* A simulated sensor. The converted value is the number of started
+   conversions. */
+struct fake_sensor_t {
+    int latency_ms;
+    int res;
+    int32_t value;
+    struct time_t ready;
+};
+
+static struct fake_sensor_t fake_sensors[NUMBER_OF_SENSORS] = {
+    { .latency_ms = 30 },
+    { .latency_ms = 80 },
+    { .latency_ms = 50 },
+    { .latency_ms = 20 }
+};
+
+static struct fake_sensor_t failing_sensor = {
+    .latency_ms = 10,
+    .res = -EIO
+};
+
+static struct bus_t bus;
+static struct sensor_hub_t hub;
+static struct sensor_hub_sensor_t sensors[NUMBER_OF_SENSORS];
+static struct sensor_hub_sensor_t failing;
+static struct bus_listener_t listeners[NUMBER_OF_SENSORS + 1];
+static struct queue_t queue;
+static char queue_buf[512];
+static THRD_STACK(hub_stack, 2048);
+static int sequential_sampling_ms;
+static int sequential_errors;
+
+static int fake_convert(void *arg_p)
+{
+    struct fake_sensor_t *self_p;
+    struct time_t latency;
+
+    self_p = arg_p;
+
+    if (self_p->res != 0) {
+        return (self_p->res);
+    }
+
+    latency.seconds = 0;
+    latency.nanoseconds = (1000000L * self_p->latency_ms);
+    time_get(&self_p->ready);
+    time_add(&self_p->ready, &self_p->ready, &latency);
+    self_p->value++;
+
+    return (0);
+}
+
+static ssize_t fake_read(void *arg_p, void *buf_p, size_t size)
+{
+    struct fake_sensor_t *self_p;
+    struct time_t now;
+
+    self_p = arg_p;
+
+    /* The conversion must have completed. */
+    time_get(&now);
+
+    if (time_compare(&now, &self_p->ready) == time_compare_less_than_t) {
+        return (-EAGAIN);
+    }
+
+    memcpy(buf_p, &self_p->value, sizeof(self_p->value));
+
+    return (sizeof(self_p->value));
+}
+
+static int time_ms(struct time_t *time_p)
+{
+    return (1000 * time_p->seconds + time_p->nanoseconds / 1000000);
+}
+
+static int read_sample(struct sensor_hub_sample_t *sample_p)
+{
+    return (queue_read(&queue, sample_p, SAMPLE_SIZE) == SAMPLE_SIZE);
+}
+
+
+static int test_init(void)
+{
+    int i;
+
+    BTASSERT(sensor_hub_module_init() == 0);
+    BTASSERT(sensor_hub_module_init() == 0);
+
+    BTASSERT(bus_init(&bus) == 0);
+    BTASSERT(queue_init(&queue, &queue_buf[0], sizeof(queue_buf)) == 0);
+
+    for (i = 0; i < NUMBER_OF_SENSORS + 1; i++) {
+        BTASSERT(bus_listener_init(&listeners[i], i, &queue) == 0);
+        BTASSERT(bus_attach(&bus, &listeners[i]) == 0);
+    }
+
+    BTASSERT(sensor_hub_init(&hub, &bus) == 0);
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(sensor_hub_sensor_init(&sensors[i],
+                                        i,
+                                        fake_convert,
+                                        fake_read,
+                                        &fake_sensors[i],
+                                        fake_sensors[i].latency_ms,
+                                        PERIOD_MS) == 0);
+    }
+
+    return (0);
+}
+
+static void bench_sequential(void *arg_p)
+{
+    int32_t value;
+    int i;
+
+    /* Sample all sensors one after the other, as an application
+       without the sensor hub would. */
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        fake_convert(&fake_sensors[i]);
+        thrd_sleep_ms(fake_sensors[i].latency_ms);
+
+        if (fake_read(&fake_sensors[i],
+                      &value,
+                      sizeof(value)) != sizeof(value)) {
+            sequential_errors++;
+        }
+
+        fake_sensors[i].value = 0;
+    }
+}
+
+static int test_sequential(void)
+{
+    struct harness_bench_t bench;
+    struct harness_bench_result_t result;
+
+    bench.callback = bench_sequential;
+    bench.name_p = "sequential";
+    bench.arg_p = NULL;
+    bench.heap_p = NULL;
+
+    BTASSERTI(harness_bench_run(&bench, &result), ==, 0);
+    BTASSERTI(sequential_errors, ==, 0);
+
+    sequential_sampling_ms = (result.median_ns / 1000000);
+
+    BTASSERT(sequential_sampling_ms >= 180);
+
+    return (0);
+}
+
+static int test_pipelined(void)
+{
+    struct sensor_hub_sample_t sample;
+    int start;
+    int hub_sampling_ms;
+    int ids[NUMBER_OF_SENSORS];
+    int i;
+
+    BTASSERT(thrd_spawn(sensor_hub_main,
+                        &hub,
+                        0,
+                        hub_stack,
+                        sizeof(hub_stack)) != NULL);
+
+    start = time_micros();
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(sensor_hub_add(&hub, &sensors[i]) == 0);
+    }
+
+    /* One sample from each sensor. */
+    memset(&ids[0], 0, sizeof(ids));
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(read_sample(&sample));
+        BTASSERT(sample.id >= 0);
+        BTASSERT(sample.id < NUMBER_OF_SENSORS);
+        BTASSERT(sample.res == 0);
+        BTASSERT(*(int32_t *)&sample.data[0] == 1);
+        ids[sample.id]++;
+    }
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(ids[i] == 1);
+    }
+
+    hub_sampling_ms = (time_micros_elapsed(start, time_micros()) / 1000);
+
+    std_printf(FSTR("Sampling %d sensors: sequential %d ms, "
+                    "sensor hub %d ms\r\n"),
+               NUMBER_OF_SENSORS,
+               sequential_sampling_ms,
+               hub_sampling_ms);
+
+    /* The conversion times overlap. */
+    BTASSERT(hub_sampling_ms >= 80);
+    BTASSERT(hub_sampling_ms < sequential_sampling_ms);
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(sensors[i].counters.samples == 1);
+        BTASSERT(sensors[i].counters.errors == 0);
+    }
+
+    return (0);
+}
+
+static int test_periodic(void)
+{
+    struct sensor_hub_sample_t sample;
+    struct time_t timestamp;
+    int period_ms;
+    int i;
+
+    /* Second round. */
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(read_sample(&sample));
+        BTASSERT(sample.res == 0);
+        BTASSERT(*(int32_t *)&sample.data[0] == 2);
+
+        if (sample.id == 3) {
+            timestamp = sample.timestamp;
+        }
+    }
+
+    /* The third round is started one period after the second. */
+    do {
+        BTASSERT(read_sample(&sample));
+        BTASSERT(*(int32_t *)&sample.data[0] == 3);
+    } while (sample.id != 3);
+
+    period_ms = (time_ms(&sample.timestamp) - time_ms(&timestamp));
+    BTASSERT(period_ms >= PERIOD_MS - 20);
+    BTASSERT(period_ms <= PERIOD_MS + 20);
+
+    for (i = 0; i < NUMBER_OF_SENSORS; i++) {
+        BTASSERT(sensors[i].counters.overruns == 0);
+    }
+
+    return (0);
+}
+
+static int test_convert_error(void)
+{
+    struct sensor_hub_sample_t sample;
+
+    BTASSERT(sensor_hub_sensor_init(&failing,
+                                    NUMBER_OF_SENSORS,
+                                    fake_convert,
+                                    fake_read,
+                                    &failing_sensor,
+                                    failing_sensor.latency_ms,
+                                    10000) == 0);
+    BTASSERT(sensor_hub_add(&hub, &failing) == 0);
+
+    /* Skip samples from the other sensors. */
+    do {
+        BTASSERT(read_sample(&sample) == 1);
+    } while (sample.id != NUMBER_OF_SENSORS);
+
+    BTASSERT(sample.res == -EIO);
+    BTASSERT(failing.counters.errors == 1);
+    BTASSERT(failing.counters.samples == 0);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_sequential, "test_sequential" },
+        { test_pipelined, "test_pipelined" },
+        { test_periodic, "test_periodic" },
+        { test_convert_error, "test_convert_error" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -36,6 +36,23 @@ static struct chan_t transport;
 static struct queue_t queue;
 static uint8_t buf[768];
 
+/**
+ * Bytes read by the driver from the transport channel. The driver
+ * reads all available bytes, up to its receive buffer size.
+ */
+static void mock_write_transport(char *buf_p, size_t size)
+{
+    size_t chunk_size;
+
+    while (size > 0) {
+        chunk_size = MIN(size, CONFIG_GNSS_RX_BUFFER_SIZE);
+        mock_write_chan_size(size);
+        mock_write_chan_read(buf_p, chunk_size, chunk_size);
+        buf_p += chunk_size;
+        size -= chunk_size;
+    }
+}
+
 static int test_init(void)
 {
     BTASSERT(queue_init(&queue, &buf[0], sizeof(buf)) == 0);
@@ -109,7 +126,6 @@ static int test_print_no_data(void)
 
 static int test_read_rmc(void)
 {
-    int i;
     char sentence[] =
         "$GPRMC,123519,A,4807.038,N,01131.000,W,022.4,084.4,230394,003.1,W*78\r\n";
     struct date_t date;
@@ -117,9 +133,7 @@ static int test_read_rmc(void)
     float longitude;
     float speed;
 
-    for (i = 0; i < strlen(sentence); i++) {
-        mock_write_chan_read(&sentence[i], 1, 1);
-    }
+    mock_write_transport(&sentence[0], strlen(sentence));
 
     BTASSERTI(gnss_read(&gnss), ==, 0);
 
@@ -160,7 +174,6 @@ static int test_read_rmc(void)
 
 static int test_read_gga_glonass(void)
 {
-    int i;
     char sentence[] =
         "$GNGGA,123520,4907.038,N,01031.000,E,1,08,0.9,545.4,M,46.9,M,,*53\r\n";
     struct date_t date;
@@ -170,9 +183,7 @@ static int test_read_gga_glonass(void)
     int number_of_satellites;
     float altitude;
 
-    for (i = 0; i < strlen(sentence); i++) {
-        mock_write_chan_read(&sentence[i], 1, 1);
-    }
+    mock_write_transport(&sentence[0], strlen(sentence));
 
     BTASSERTI(gnss_read(&gnss), ==, 0);
 
@@ -228,9 +239,11 @@ static int test_read_read_failed(void)
 
     byte = 0;
 
+    mock_write_chan_size(0);
     mock_write_chan_read(&byte, 1, -EIO);
     BTASSERTI(gnss_read(&gnss), ==, -EIO);
 
+    mock_write_chan_size(0);
     mock_write_chan_read(&byte, 1, -EIO);
     BTASSERTI(gnss_read(&gnss), ==, -EIO);
 
@@ -239,14 +252,10 @@ static int test_read_read_failed(void)
 
 static int test_read_sentence_too_long(void)
 {
-    int i;
-    char byte;
+    char sentence[NMEA_SENTENCE_SIZE_MAX];
 
-    byte = '$';
-
-    for (i = 0; i < NMEA_SENTENCE_SIZE_MAX; i++) {
-        mock_write_chan_read(&byte, 1, 1);
-    }
+    memset(&sentence[0], '$', sizeof(sentence));
+    mock_write_transport(&sentence[0], sizeof(sentence));
 
     BTASSERTI(gnss_read(&gnss), ==, -ENOMEM);
 
@@ -255,14 +264,11 @@ static int test_read_sentence_too_long(void)
 
 static int test_read_start_not_first(void)
 {
-    int i;
     char sentence[] =
         "\r\n$GPRMC,123519,A,4807.038,N,01131.000,W,022.4,084.4,230394,"
         "003.1,W*78\r\n";
 
-    for (i = 0; i < strlen(sentence); i++) {
-        mock_write_chan_read(&sentence[i], 1, 1);
-    }
+    mock_write_transport(&sentence[0], strlen(sentence));
 
     BTASSERTI(gnss_read(&gnss), ==, 0);
 
@@ -271,12 +277,9 @@ static int test_read_start_not_first(void)
 
 static int test_read_unsupported_sentence(void)
 {
-    int i;
     char sentence[] = "$GPFOO,BAR*2C\r\n";
 
-    for (i = 0; i < strlen(sentence); i++) {
-        mock_write_chan_read(&sentence[i], 1, 1);
-    }
+    mock_write_transport(&sentence[0], strlen(sentence));
 
     BTASSERTI(gnss_read(&gnss), ==, 0);
 
@@ -285,15 +288,129 @@ static int test_read_unsupported_sentence(void)
 
 static int test_read_wrong_crc(void)
 {
-    int i;
     char sentence[] = "$GPFOO,BAR*2D\r\n";
 
-    for (i = 0; i < strlen(sentence); i++) {
-        mock_write_chan_read(&sentence[i], 1, 1);
-    }
+    mock_write_transport(&sentence[0], strlen(sentence));
+
+    BTASSERTI(gnss_read(&gnss), ==, -EPROTO);
+
+    return (0);
+}
+
+static int test_read_talkers(void)
+{
+    char sentences[] =
+        "$GLGSV,2,1,08,65,40,083,46,66,17,308,41,67,07,344,39,68,22,228,45"
+        "*60\r\n"
+        "$GARMC,083559,A,5123.456,N,00012.345,E,010.0,090.0,170826,,*0F\r\n"
+        "$GNGGA,083600,5123.457,N,00012.346,E,1,14,0.8,120.5,M,46.9,M,,"
+        "*50\r\n";
+    struct date_t date;
+    float latitude;
+    float longitude;
+    float speed;
+    int number_of_satellites;
+
+    /* All sentences are read into the receive buffer in chunks. */
+    mock_write_transport(&sentences[0], strlen(sentences));
+
+    /* GLONASS satellites in view. */
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.type, ==, nmea_sentence_type_gsv_t);
+    BTASSERTI(gnss.nmea.decoded.talker, ==, nmea_talker_gl_t);
+
+    /* Galileo RMC. */
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.talker, ==, nmea_talker_ga_t);
+    BTASSERTI(gnss_get_date(&gnss, &date), >=, 0);
+    BTASSERTI(date.year, ==, 26);
+    BTASSERTI(date.month, ==, 8);
+    BTASSERTI(date.date, ==, 17);
+    BTASSERTI(gnss_get_speed(&gnss, &speed), >=, 0);
+    BTASSERTI(speed, ==, 5.144f);
+
+    /* Combined GGA. */
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.talker, ==, nmea_talker_gn_t);
+    BTASSERTI(gnss_get_position(&gnss, &latitude, &longitude), >=, 0);
+    BTASSERTI(latitude, ==, 51 + (23.457f / 60));
+    BTASSERTI(longitude, ==, 12.346f / 60);
+    BTASSERTI(gnss_get_number_of_satellites(&gnss,
+                                            &number_of_satellites), >=, 0);
+    BTASSERTI(number_of_satellites, ==, 14);
+
+    return (0);
+}
+
+static int test_read_ubx(void)
+{
+    char data[] =
+        /* Garbage and an UBX frame. */
+        "\x00\xb5\x62\x01\x07\x04\x00\x11\x22\x33\x44\xb6\xa5"
+        /* A sync character followed by a sentence. */
+        "\xb5$GPRMC,123519,A,4807.038,N,01131.000,W,022.4,084.4,230394,"
+        "003.1,W,A*15\r\n";
+    char frame[] = "\xb5\x62\x01\x07\x04\x00\x11\x22\x33\x44\xb6\xa5";
+
+    /* The UBX frame is discarded without an output channel. */
+    mock_write_transport(&data[0], sizeof(data) - 1);
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+
+    /* NMEA sentences may have more fields than known. */
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.type, ==, nmea_sentence_type_rmc_t);
+    BTASSERTI(gnss.nmea.decoded.talker, ==, nmea_talker_gp_t);
+
+    /* The UBX frame is passed through to the output channel. */
+    BTASSERTI(gnss_set_ubx_output(&gnss, &transport), ==, 0);
+    mock_write_transport(&data[0], sizeof(data) - 1);
+    mock_write_chan_write(&frame[0], 6, 6);
+    mock_write_chan_write(&frame[6], 6, 6);
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.type, ==, nmea_sentence_type_rmc_t);
+
+    /* Output channel write failure. */
+    mock_write_transport(&data[0], sizeof(data) - 1);
+    mock_write_chan_write(&frame[0], 6, -EIO);
+    BTASSERTI(gnss_read(&gnss), ==, -EIO);
 
+    /* The rest of the frame is skipped when looking for the next
+       frame. */
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.type, ==, nmea_sentence_type_rmc_t);
+
+    BTASSERTI(gnss_set_ubx_output(&gnss, NULL), ==, 0);
+
+    return (0);
+}
+
+static int test_read_ubx_too_long(void)
+{
+    char data[] =
+        /* A false frame start with a too long payload, followed by an
+           UBX frame. */
+        "\xb5\x62\xb5\x62\x01\x07\x04\x00\x11\x22\x33\x44\xb6\xa5"
+        "$GPRMC,123519,A,4807.038,N,01131.000,W,022.4,084.4,230394,"
+        "003.1,W,A*15\r\n";
+    char frame[] = "\xb5\x62\x01\x07\x04\x00\x11\x22\x33\x44\xb6\xa5";
+
+    BTASSERTI(gnss_set_ubx_output(&gnss, &transport), ==, 0);
+    mock_write_transport(&data[0], sizeof(data) - 1);
+
+    /* The false frame is rejected and nothing is written to the
+       output channel. */
     BTASSERTI(gnss_read(&gnss), ==, -EPROTO);
 
+    /* The frame after the false sync characters is found. */
+    mock_write_chan_write(&frame[0], 6, 6);
+    mock_write_chan_write(&frame[6], 6, 6);
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss_read(&gnss), ==, 0);
+    BTASSERTI(gnss.nmea.decoded.type, ==, nmea_sentence_type_rmc_t);
+
+    BTASSERTI(gnss_set_ubx_output(&gnss, NULL), ==, 0);
+
     return (0);
 }
 
@@ -318,6 +435,9 @@ int main()
         { test_read_start_not_first, "test_read_start_not_first" },
         { test_read_unsupported_sentence, "test_read_unsupported_sentence" },
         { test_read_wrong_crc, "test_read_wrong_crc" },
+        { test_read_talkers, "test_read_talkers" },
+        { test_read_ubx, "test_read_ubx" },
+        { test_read_ubx_too_long, "test_read_ubx_too_long" },
         { test_write, "test_write" },
         { NULL, NULL }
     };
@@ -0,0 +1,287 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+
+#include "simba.h"
+#include <time.h>
+
+static int number_of_interrupts;
+
+static void on_interrupt(void *arg_p)
+{
+    number_of_interrupts++;
+}
+
+static ssize_t slave_transfer(void *arg_p,
+                              int flags,
+                              void *buf_p,
+                              size_t size)
+{
+    if (flags & I2C_MESSAGE_READ) {
+        memset(buf_p, 0x5a, size);
+    }
+
+    return (size);
+}
+
+static int test_flash(void)
+{
+    struct flash_driver_t flash;
+    uint8_t memory[256];
+    uint8_t buf[4];
+
+    memset(&flash_device[0].counters, 0, sizeof(flash_device[0].counters));
+    BTASSERT(flash_port_device_set_memory(&flash_device[0],
+                                          &memory[0],
+                                          0x1000,
+                                          sizeof(memory)) == 0);
+    BTASSERT(flash_module_init() == 0);
+    BTASSERT(flash_init(&flash, &flash_device[0]) == 0);
+
+    /* Erased memory reads as 0xff. */
+    BTASSERT(flash_erase(&flash, 0x1000, sizeof(memory)) == 0);
+    BTASSERTI(flash_read(&flash, &buf[0], 0x1010, 4), ==, 4);
+    BTASSERTM(&buf[0], "\xff\xff\xff\xff", 4);
+
+    /* Writes only clear bits. */
+    BTASSERTI(flash_write(&flash, 0x1010, "\xf0\x0f\x55\xff", 4), ==, 4);
+    BTASSERTI(flash_write(&flash, 0x1010, "\x3c\x3c\xff\xaa", 4), ==, 4);
+    BTASSERTI(flash_read(&flash, &buf[0], 0x1010, 4), ==, 4);
+    BTASSERTM(&buf[0], "\x30\x0c\x55\xaa", 4);
+
+    /* Outside the memory. */
+    BTASSERTI(flash_read(&flash, &buf[0], 0x0fff, 4), ==, -EFAULT);
+    BTASSERTI(flash_read(&flash, &buf[0], 0x10fd, 4), ==, -EFAULT);
+    BTASSERTI(flash_write(&flash, 0x1100, &buf[0], 1), ==, -EFAULT);
+    BTASSERTI(flash_erase(&flash, 0x1080, 256), ==, -EFAULT);
+
+    BTASSERTI(flash_device[0].counters.erases, ==, 2);
+    BTASSERTI(flash_device[0].counters.bytes_erased, ==, 256);
+    BTASSERTI(flash_device[0].counters.writes, ==, 3);
+    BTASSERTI(flash_device[0].counters.bytes_written, ==, 8);
+    BTASSERTI(flash_device[0].counters.reads, ==, 4);
+    BTASSERTI(flash_device[0].counters.bytes_read, ==, 8);
+
+    BTASSERT(flash_port_device_set_memory(&flash_device[0],
+                                          NULL,
+                                          0,
+                                          0) == 0);
+
+    return (0);
+}
+
+static int test_pin_stimulus(void)
+{
+    struct pin_driver_t pin;
+    struct exti_driver_t exti;
+
+    BTASSERT(pin_module_init() == 0);
+    BTASSERT(exti_module_init() == 0);
+    BTASSERT(pin_init(&pin, &pin_device[3], PIN_INPUT) == 0);
+    BTASSERT(exti_init(&exti,
+                       &exti_device[3],
+                       EXTI_TRIGGER_RISING_EDGE,
+                       on_interrupt,
+                       NULL) == 0);
+
+    number_of_interrupts = 0;
+
+    /* No interrupts before the driver is started. */
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 1) == 0);
+    BTASSERTI(pin_read(&pin), ==, 1);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 0) == 0);
+    BTASSERTI(pin_read(&pin), ==, 0);
+    BTASSERTI(number_of_interrupts, ==, 0);
+
+    /* Only rising edges. */
+    BTASSERT(exti_start(&exti) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 1) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 1) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 0) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 1) == 0);
+    BTASSERTI(number_of_interrupts, ==, 2);
+
+    /* Both edges. */
+    BTASSERT(exti_stop(&exti) == 0);
+    BTASSERT(exti_init(&exti,
+                       &exti_device[3],
+                       EXTI_TRIGGER_BOTH_EDGES,
+                       on_interrupt,
+                       NULL) == 0);
+    BTASSERT(exti_start(&exti) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 0) == 0);
+    BTASSERT(pin_port_device_set_input(&pin_device[3], 1) == 0);
+    BTASSERTI(number_of_interrupts, ==, 4);
+
+    /* Other pins do not interrupt. */
+    BTASSERT(pin_port_device_set_input(&pin_device[4], 1) == 0);
+    BTASSERTI(number_of_interrupts, ==, 4);
+    BTASSERT(exti_stop(&exti) == 0);
+
+    return (0);
+}
+
+static int test_pin_mask(void)
+{
+    uint32_t mask;
+
+    /* Pins are grouped in ports of 32. */
+    BTASSERT(pin_device_is_same_port(&pin_device[32], &pin_device[63]));
+    BTASSERT(!pin_device_is_same_port(&pin_device[31], &pin_device[32]));
+    BTASSERTI(pin_device_mask(&pin_device[33]), ==, 0x2);
+
+    mask = (pin_device_mask(&pin_device[32])
+            | pin_device_mask(&pin_device[34])
+            | pin_device_mask(&pin_device[63]));
+
+    /* Write all pins high except one. */
+    BTASSERT(pin_device_write_mask(&pin_device[40],
+                                   mask,
+                                   pin_device_mask(&pin_device[33])) == 0);
+    BTASSERTI(pin_device_read(&pin_device[32]), ==, 1);
+    BTASSERTI(pin_device_read(&pin_device[33]), ==, 0);
+    BTASSERTI(pin_device_read(&pin_device[34]), ==, 1);
+    BTASSERTI(pin_device_read(&pin_device[63]), ==, 1);
+    BTASSERTI(pin_device_read(&pin_device[31]), ==, 0);
+    BTASSERTI(pin_device_read(&pin_device[64]), ==, 0);
+    BTASSERTI(pin_device_read_mask(&pin_device[32], 0xffffffff), ==, mask);
+
+    /* High wins if a pin is in both masks. */
+    BTASSERT(pin_device_write_mask(&pin_device[32], 0x2, 0x3) == 0);
+    BTASSERTI(pin_device_read_mask(&pin_device[32], 0x3), ==, 0x2);
+
+    /* Inputs are read back as well. */
+    BTASSERT(pin_port_device_set_input(&pin_device[35], 1) == 0);
+    BTASSERTI(pin_device_read_mask(&pin_device[63], 0xc), ==, 0xc);
+
+    return (0);
+}
+
+static int test_spi_occupancy(void)
+{
+    struct spi_driver_t spi;
+    uint8_t buf[125];
+
+    memset(&spi_device[0].counters, 0, sizeof(spi_device[0].counters));
+    memset(&buf[0], 0, sizeof(buf));
+
+    BTASSERT(spi_module_init() == 0);
+    BTASSERT(spi_init(&spi,
+                      &spi_device[0],
+                      &pin_device[5],
+                      SPI_MODE_MASTER,
+                      SPI_SPEED_1MBPS,
+                      0,
+                      0) == 0);
+    BTASSERT(spi_start(&spi) == 0);
+    BTASSERT(spi_take_bus(&spi) == 0);
+    BTASSERT(spi_select(&spi) == 0);
+    BTASSERTI(spi_write(&spi, &buf[0], sizeof(buf)), ==, sizeof(buf));
+    BTASSERTI(spi_write(&spi, &buf[0], sizeof(buf)), ==, sizeof(buf));
+    BTASSERT(spi_deselect(&spi) == 0);
+    BTASSERT(spi_give_bus(&spi) == 0);
+    BTASSERT(spi_stop(&spi) == 0);
+
+    /* 2 * 125 bytes at 1 Mbps is 2 ms. */
+    BTASSERTI(spi_device[0].counters.transfers, ==, 2);
+    BTASSERTI(spi_device[0].counters.bytes, ==, 250);
+    BTASSERTI(spi_device[0].counters.busy_ns, ==, 2000000);
+
+    return (0);
+}
+
+static int test_i2c_occupancy(void)
+{
+    struct i2c_driver_t i2c;
+    struct i2c_port_slave_t slave;
+    uint8_t buf[10];
+
+    memset(&i2c_device[0].counters, 0, sizeof(i2c_device[0].counters));
+
+    BTASSERT(i2c_module_init() == 0);
+    BTASSERT(i2c_init(&i2c, &i2c_device[0], I2C_BAUDRATE_100KBPS, -1) == 0);
+    BTASSERT(i2c_start(&i2c) == 0);
+    BTASSERT(i2c_port_device_add_slave(&i2c_device[0],
+                                       &slave,
+                                       0x42,
+                                       slave_transfer,
+                                       NULL) == 0);
+    BTASSERTI(i2c_read(&i2c, 0x42, &buf[0], sizeof(buf)), ==, 10);
+    BTASSERTI(buf[9], ==, 0x5a);
+    BTASSERT(i2c_stop(&i2c) == 0);
+
+    /* Start, address, ten bytes and stop is 101 bits, 1.01 ms at
+       100 kbps. */
+    BTASSERTI(i2c_device[0].counters.starts, ==, 1);
+    BTASSERTI(i2c_device[0].counters.stops, ==, 1);
+    BTASSERTI(i2c_device[0].counters.bytes, ==, 11);
+    BTASSERTI(i2c_device[0].counters.busy_ns, ==, 1010000);
+
+    return (0);
+}
+
+static int test_time_speedup(void)
+{
+    struct timespec start;
+    struct timespec stop;
+    long elapsed_ms;
+
+    /* One simulated second takes about 100 ms of real time. */
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    thrd_sleep_ms(1000);
+    clock_gettime(CLOCK_MONOTONIC, &stop);
+
+    elapsed_ms = (1000 * (stop.tv_sec - start.tv_sec)
+                  + (stop.tv_nsec - start.tv_nsec) / 1000000);
+    std_printf(OSTR("Slept 1000 ms in %ld ms real time.\r\n"), elapsed_ms);
+    BTASSERT(elapsed_ms >= 90);
+    BTASSERT(elapsed_ms < 500);
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_flash, "test_flash" },
+        { test_pin_stimulus, "test_pin_stimulus" },
+        { test_pin_mask, "test_pin_mask" },
+        { test_spi_occupancy, "test_spi_occupancy" },
+        { test_i2c_occupancy, "test_i2c_occupancy" },
+        { test_time_speedup, "test_time_speedup" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
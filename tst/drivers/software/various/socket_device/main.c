@@ -0,0 +1,403 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+
+#define TYPE_UART_DEVICE_REQUEST                          (1)
+#define TYPE_UART_DEVICE_RESPONSE                         (2)
+#define TYPE_CAN_DEVICE_REQUEST                           (7)
+#define TYPE_CAN_DEVICE_RESPONSE                          (8)
+
+#define VERSION_SHIFT                                        16
+
+#define FRAME_HEADER_SIZE                                    12
+
+#define BUFFER_SIZE CONFIG_LINUX_SOCKET_DEVICE_BUFFER_SIZE
+
+static struct uart_driver_t uart;
+static char uart_rxbuf[512];
+static struct can_driver_t can;
+static struct can_frame_t can_rxbuf[4];
+static int uart_socket;
+static int can_socket;
+
+/* Device time of the last frame written by the device. */
+static uint64_t device_timestamp;
+
+static void pack_u32(uint8_t *buf_p, uint32_t value)
+{
+    buf_p[0] = (value >> 24);
+    buf_p[1] = (value >> 16);
+    buf_p[2] = (value >> 8);
+    buf_p[3] = value;
+}
+
+static void pack_u64(uint8_t *buf_p, uint64_t value)
+{
+    pack_u32(&buf_p[0], value >> 32);
+    pack_u32(&buf_p[4], value);
+}
+
+static uint32_t unpack_u32(const uint8_t *buf_p)
+{
+    return (((uint32_t)buf_p[0] << 24)
+            | ((uint32_t)buf_p[1] << 16)
+            | ((uint32_t)buf_p[2] << 8)
+            | buf_p[3]);
+}
+
+static uint64_t unpack_u64(const uint8_t *buf_p)
+{
+    return (((uint64_t)unpack_u32(&buf_p[0]) << 32)
+            | unpack_u32(&buf_p[4]));
+}
+
+/**
+ * Pack a version 2 frame into given buffer.
+ *
+ * @return Frame size.
+ */
+static size_t pack_frame(uint8_t *buf_p,
+                         uint64_t timestamp,
+                         const void *payload_p,
+                         size_t size)
+{
+    pack_u32(&buf_p[0], size);
+    pack_u64(&buf_p[4], timestamp);
+    memcpy(&buf_p[FRAME_HEADER_SIZE], payload_p, size);
+
+    return (FRAME_HEADER_SIZE + size);
+}
+
+static ssize_t read_all(int socket, void *buf_p, size_t size)
+{
+    uint8_t *b_p;
+    size_t left;
+    ssize_t res;
+
+    b_p = buf_p;
+    left = size;
+
+    while (left > 0) {
+        res = read(socket, b_p, left);
+
+        if (res <= 0) {
+            return (-1);
+        }
+
+        b_p += res;
+        left -= res;
+    }
+
+    return (size);
+}
+
+/**
+ * Connect to given device, retrying until the socket device listener
+ * has started.
+ *
+ * @return Connected socket or negative error code.
+ */
+static int connect_device(uint32_t type, const char *name_p)
+{
+    struct sockaddr_in addr;
+    uint8_t request[8 + 64];
+    uint8_t response[12];
+    size_t size;
+    int sock;
+    int i;
+
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(47000);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    for (i = 0; i < 100; i++) {
+        sock = socket(AF_INET, SOCK_STREAM, 0);
+
+        if (sock < 0) {
+            return (-1);
+        }
+
+        if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+            break;
+        }
+
+        close(sock);
+        sock = -1;
+        thrd_sleep_ms(10);
+    }
+
+    if (sock < 0) {
+        return (-1);
+    }
+
+    size = strlen(name_p);
+    pack_u32(&request[0], type);
+    pack_u32(&request[4], size);
+    memcpy(&request[8], name_p, size);
+
+    if (write(sock, &request[0], 8 + size) != 8 + size) {
+        close(sock);
+
+        return (-1);
+    }
+
+    /* Response type, size and result. */
+    if ((read_all(sock, &response[0], sizeof(response)) != sizeof(response))
+        || (unpack_u32(&response[0]) != type + 1)
+        || (unpack_u32(&response[8]) != 0)) {
+        close(sock);
+
+        return (-1);
+    }
+
+    return (sock);
+}
+
+static int test_init(void)
+{
+    BTASSERTI(uart_init(&uart,
+                        &uart_device[1],
+                        115200,
+                        &uart_rxbuf[0],
+                        sizeof(uart_rxbuf)), ==, 0);
+    BTASSERTI(uart_start(&uart), ==, 0);
+    BTASSERTI(can_init(&can,
+                       &can_device[1],
+                       CAN_SPEED_500KBPS,
+                       &can_rxbuf[0],
+                       sizeof(can_rxbuf)), ==, 0);
+    BTASSERTI(can_start(&can), ==, 0);
+
+    uart_socket = connect_device((2 << VERSION_SHIFT)
+                                 | TYPE_UART_DEVICE_REQUEST,
+                                 "1");
+    BTASSERT(uart_socket >= 0);
+
+    /* Version 1. */
+    can_socket = connect_device(TYPE_CAN_DEVICE_REQUEST, "1");
+    BTASSERT(can_socket >= 0);
+
+    return (0);
+}
+
+static int test_framing(void)
+{
+    uint8_t buf[64];
+    size_t size;
+
+    /* Two frames in one write. */
+    size = pack_frame(&buf[0], 0, "hello", 5);
+    size += pack_frame(&buf[size], 0, " world", 6);
+    BTASSERTI(write(uart_socket, &buf[0], size), ==, size);
+    BTASSERTI(chan_read(&uart, &buf[0], 11), ==, 11);
+    BTASSERTM(&buf[0], "hello world", 11);
+
+    /* Output is sent as a timestamped frame. */
+    BTASSERTI(chan_write(&uart, "output", 6), ==, 6);
+    BTASSERTI(read_all(uart_socket, &buf[0], FRAME_HEADER_SIZE + 6),
+              ==,
+              FRAME_HEADER_SIZE + 6);
+    BTASSERTI(unpack_u32(&buf[0]), ==, 6);
+    BTASSERTM(&buf[FRAME_HEADER_SIZE], "output", 6);
+    device_timestamp = unpack_u64(&buf[4]);
+    BTASSERT(device_timestamp > 0);
+
+    return (0);
+}
+
+static int test_pacing(void)
+{
+    uint8_t buf[64];
+    size_t size;
+    struct time_t start;
+    struct time_t now;
+    struct time_t elapsed;
+
+    /* The first frame is held until 300 ms after the output frame,
+       and the second frame behind it. */
+    size = pack_frame(&buf[0], device_timestamp + 300000, "a", 1);
+    size += pack_frame(&buf[size], 0, "b", 1);
+    time_get(&start);
+    BTASSERTI(write(uart_socket, &buf[0], size), ==, size);
+    BTASSERTI(chan_read(&uart, &buf[0], 2), ==, 2);
+    time_get(&now);
+    BTASSERTM(&buf[0], "ab", 2);
+
+    time_subtract(&elapsed, &now, &start);
+    BTASSERT(1000 * elapsed.seconds + elapsed.nanoseconds / 1000000 >= 200);
+
+    return (0);
+}
+
+static int test_paused_full_buffer(void)
+{
+    uint8_t buf[2 * BUFFER_SIZE];
+    uint8_t payload[4];
+    size_t size;
+    int i;
+
+    /* A held frame followed by more frames than fit in the client
+       input buffer. No input may be discarded while paused. */
+    size = pack_frame(&buf[0], device_timestamp + 400000, "held", 4);
+
+    for (i = 0; size + FRAME_HEADER_SIZE + 4 <= sizeof(buf); i++) {
+        memset(&payload[0], 'a' + (i % 26), sizeof(payload));
+        size += pack_frame(&buf[size], 0, &payload[0], sizeof(payload));
+    }
+
+    BTASSERT(size > BUFFER_SIZE);
+    BTASSERTI(write(uart_socket, &buf[0], size), ==, size);
+
+    BTASSERTI(chan_read(&uart, &buf[0], 4), ==, 4);
+    BTASSERTM(&buf[0], "held", 4);
+
+    while (--i >= 0) {
+        BTASSERTI(chan_read(&uart, &buf[0], 4), ==, 4);
+    }
+
+    BTASSERTI(chan_size(&uart), ==, 0);
+
+    return (0);
+}
+
+static int test_discard(void)
+{
+    char buf[BUFFER_SIZE + 64];
+    struct can_frame_t frame;
+    size_t size;
+
+    /* A version 1 CAN client with a full buffer and no complete line
+       has its input discarded. The bad line at the end of the
+       discarded data is skipped. */
+    memset(&buf[0], 'x', BUFFER_SIZE + 16);
+    size = (BUFFER_SIZE + 16);
+    strcpy(&buf[size], "\nid=00000005,extended=0,size=1,data=12\n");
+    size += strlen(&buf[size]);
+    BTASSERTI(write(can_socket, &buf[0], size), ==, size);
+
+    BTASSERTI(can_read(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+    BTASSERTI(frame.id, ==, 5);
+    BTASSERTI(frame.extended_frame, ==, 0);
+    BTASSERTI(frame.size, ==, 1);
+    BTASSERTI(frame.data.u8[0], ==, 0x12);
+
+    return (0);
+}
+
+static int test_device_queue_full(void)
+{
+    static uint8_t buf[3 * (FRAME_HEADER_SIZE + 200)];
+    static uint8_t data[600];
+    char line[64];
+    struct can_frame_t frame;
+    size_t size;
+    ssize_t n;
+    int i;
+    int retries;
+
+    for (i = 0; i < sizeof(data); i++) {
+        data[i] = i;
+    }
+
+    /* More UART input than fits in the UART input queue is kept
+       until there is room for it. */
+    size = 0;
+
+    for (i = 0; i < 3; i++) {
+        size += pack_frame(&buf[size], 0, &data[200 * i], 200);
+    }
+
+    BTASSERTI(write(uart_socket, &buf[0], size), ==, size);
+    size = 0;
+    retries = 100;
+
+    while (size < sizeof(data)) {
+        n = chan_size(&uart);
+
+        if (n == 0) {
+            BTASSERT(--retries > 0);
+            thrd_sleep_ms(10);
+            continue;
+        }
+
+        BTASSERTI(chan_read(&uart, &buf[size], n), ==, n);
+        size += n;
+    }
+
+    BTASSERTM(&buf[0], &data[0], sizeof(data));
+
+    /* Same for more CAN frames than fit in the CAN input queue. */
+    for (i = 0; i < 2 * membersof(can_rxbuf); i++) {
+        std_sprintf(&line[0],
+                    FSTR("id=%08x,extended=0,size=1,data=%02x\n"),
+                    i,
+                    i);
+        BTASSERTI(write(can_socket, &line[0], strlen(&line[0])),
+                  ==,
+                  strlen(&line[0]));
+    }
+
+    thrd_sleep_ms(50);
+
+    for (i = 0; i < 2 * membersof(can_rxbuf); i++) {
+        BTASSERTI(can_read(&can, &frame, sizeof(frame)), ==, sizeof(frame));
+        BTASSERTI(frame.id, ==, i);
+        BTASSERTI(frame.data.u8[0], ==, i);
+    }
+
+    return (0);
+}
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_init, "test_init" },
+        { test_framing, "test_framing" },
+        { test_pacing, "test_pacing" },
+        { test_paused_full_buffer, "test_paused_full_buffer" },
+        { test_discard, "test_discard" },
+        { test_device_queue_full, "test_device_queue_full" },
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    close(uart_socket);
+    close(can_socket);
+
+    return (0);
+}
@@ -145,11 +145,211 @@ static int test_decode(void)
     return (0);
 }
 
+static int test_decode_fail(void)
+{
+    char buf[16];
+
+    /* Padding is only allowed at the end. */
+    BTASSERT(base64_decode(buf, "T=Q=", 4) == -1);
+    BTASSERT(base64_decode(buf, "====", 4) == -1);
+    BTASSERT(base64_decode(buf, "TQ=a", 4) == -1);
+    BTASSERT(base64_decode(buf, "TQ==TQ==", 8) == -1);
+
+    /* Characters outside the 7 bit range and from the URL safe
+       alphabet are invalid. */
+    BTASSERT(base64_decode(buf, "TQ\xe5=", 4) == -1);
+    BTASSERT(base64_decode(buf, "-_-_", 4) == -1);
+
+    return (0);
+}
+
+static int test_url(void)
+{
+    char buf[16];
+
+    BTASSERT(base64_url_encode(buf, "\xfb\xff\xbf", 3) == 0);
+    BTASSERTM(&buf[0], "-_-_", 4);
+
+    BTASSERT(base64_url_encode(buf, "\xfb\xff", 2) == 0);
+    BTASSERTM(&buf[0], "-_8=", 4);
+
+    BTASSERT(base64_url_decode(buf, "-_-_", 4) == 0);
+    BTASSERTM(&buf[0], "\xfb\xff\xbf", 3);
+
+    BTASSERT(base64_url_decode(buf, "-_8=", 4) == 0);
+    BTASSERTM(&buf[0], "\xfb\xff", 2);
+
+    BTASSERT(base64_url_decode(buf, "+/+/", 4) == -1);
+
+    return (0);
+}
+
+static int test_stream(void)
+{
+    struct base64_encoder_t encoder;
+    struct base64_decoder_t decoder;
+    char buf[512];
+    char decoded_buf[512];
+    size_t chunk_size;
+    size_t i;
+    size_t size;
+    size_t length;
+    ssize_t res;
+
+    length = strlen(decoded_text);
+
+    /* Encode and decode in chunks of all sizes. */
+    for (chunk_size = 1; chunk_size < 10; chunk_size++) {
+        BTASSERT(base64_encoder_init(&encoder, 0) == 0);
+        size = 0;
+
+        for (i = 0; i < length; i += chunk_size) {
+            res = base64_encoder_update(&encoder,
+                                        &buf[size],
+                                        &decoded_text[i],
+                                        MIN(chunk_size, length - i));
+            BTASSERT(res >= 0);
+            size += res;
+        }
+
+        res = base64_encoder_finish(&encoder, &buf[size]);
+        BTASSERT(res >= 0);
+        size += res;
+        BTASSERTI(size, ==, strlen(encoded_text));
+        BTASSERTM(&buf[0], &encoded_text[0], size);
+
+        BTASSERT(base64_decoder_init(&decoder, 0) == 0);
+        size = 0;
+
+        for (i = 0; i < strlen(encoded_text); i += chunk_size) {
+            res = base64_decoder_update(&decoder,
+                                        &decoded_buf[size],
+                                        &encoded_text[i],
+                                        MIN(chunk_size,
+                                            strlen(encoded_text) - i));
+            BTASSERT(res >= 0);
+            size += res;
+        }
+
+        BTASSERT(base64_decoder_finish(&decoder) == 0);
+        BTASSERTI(size, ==, length);
+        BTASSERTM(&decoded_buf[0], &decoded_text[0], length);
+    }
+
+    /* URL safe alphabet. */
+    BTASSERT(base64_encoder_init(&encoder, 1) == 0);
+    BTASSERTI(base64_encoder_update(&encoder, &buf[0], "\xfb", 1), ==, 0);
+    BTASSERTI(base64_encoder_update(&encoder, &buf[0], "\xff\xbf\xfb", 3),
+              ==,
+              4);
+    BTASSERTI(base64_encoder_finish(&encoder, &buf[4]), ==, 4);
+    BTASSERTM(&buf[0], "-_-_-w==", 8);
+
+    BTASSERT(base64_decoder_init(&decoder, 1) == 0);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[0], "-_-_-", 5),
+              ==,
+              3);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[3], "w==", 3),
+              ==,
+              1);
+    BTASSERT(base64_decoder_finish(&decoder) == 0);
+    BTASSERTM(&decoded_buf[0], "\xfb\xff\xbf\xfb", 4);
+
+    /* Data after padding. */
+    BTASSERT(base64_decoder_init(&decoder, 0) == 0);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[0], "TQ==", 4),
+              ==,
+              1);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[0], "TQ==", 4),
+              ==,
+              -EINVAL);
+
+    /* Partial group. */
+    BTASSERT(base64_decoder_init(&decoder, 0) == 0);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[0], "TWF", 3),
+              ==,
+              0);
+    BTASSERT(base64_decoder_finish(&decoder) == -EINVAL);
+
+    /* Invalid character. */
+    BTASSERT(base64_decoder_init(&decoder, 0) == 0);
+    BTASSERTI(base64_decoder_update(&decoder, &decoded_buf[0], "TW*u", 4),
+              ==,
+              -EINVAL);
+
+    return (0);
+}
+
+#if defined(ARCH_LINUX)
+
+static uint8_t benchmark_decoded[49152];
+static char benchmark_encoded[65536];
+
+static int benchmark_res;
+
+static void bench_base64_encode(void *arg_p)
+{
+    benchmark_res = base64_encode(&benchmark_encoded[0],
+                                  &benchmark_decoded[0],
+                                  sizeof(benchmark_decoded));
+}
+
+static void bench_base64_decode(void *arg_p)
+{
+    benchmark_res = base64_decode(&benchmark_decoded[0],
+                                  &benchmark_encoded[0],
+                                  sizeof(benchmark_encoded));
+}
+
+static int test_benchmark(void)
+{
+    int i;
+    struct harness_bench_t bench;
+    struct harness_bench_result_t result;
+
+    for (i = 0; i < sizeof(benchmark_decoded); i++) {
+        benchmark_decoded[i] = (i * 7);
+    }
+
+    bench.arg_p = NULL;
+    bench.heap_p = NULL;
+
+    bench.callback = bench_base64_encode;
+    bench.name_p = "base64_encode";
+    BTASSERTI(harness_bench_run(&bench, &result), ==, 0);
+    BTASSERTI(benchmark_res, ==, 0);
+    std_printf(FSTR("base64_encode(): %d bytes, %ld KB/s\r\n"),
+               sizeof(benchmark_decoded),
+               (1000000L * sizeof(benchmark_decoded)) / (result.median_ns + 1));
+
+    bench.callback = bench_base64_decode;
+    bench.name_p = "base64_decode";
+    BTASSERTI(harness_bench_run(&bench, &result), ==, 0);
+    BTASSERTI(benchmark_res, ==, 0);
+    std_printf(FSTR("base64_decode(): %d bytes, %ld KB/s\r\n"),
+               sizeof(benchmark_encoded),
+               (1000000L * sizeof(benchmark_encoded)) / (result.median_ns + 1));
+
+    for (i = 0; i < sizeof(benchmark_decoded); i++) {
+        BTASSERTI(benchmark_decoded[i], ==, (uint8_t)(i * 7));
+    }
+
+    return (0);
+}
+
+#endif
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
         { test_encode, "test_encode" },
         { test_decode, "test_decode" },
+        { test_decode_fail, "test_decode_fail" },
+        { test_url, "test_url" },
+        { test_stream, "test_stream" },
+#if defined(ARCH_LINUX)
+        { test_benchmark, "test_benchmark" },
+#endif
         { NULL, NULL }
     };
 
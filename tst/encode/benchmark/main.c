@@ -0,0 +1,105 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+static const char json_document[] =
+    "{\"name\": \"simba\", \"version\": 15, \"boards\": [\"arduino_due\", "
+    "\"arduino_mega\", \"esp32\", \"linux\"], \"valid\": true, "
+    "\"settings\": {\"baudrate\": 115200, \"parity\": null}}";
+
+static uint8_t binary[768];
+static char encoded[1025];
+
+static void bench_json_parse(void *arg_p)
+{
+    struct json_t json;
+    struct json_tok_t tokens[32];
+
+    json_init(&json, &tokens[0], membersof(tokens));
+    json_parse(&json, &json_document[0], sizeof(json_document) - 1);
+}
+
+static void bench_json_writer(void *arg_p)
+{
+    struct json_writer_t writer;
+    char buf[128];
+
+    json_writer_init(&writer, &buf[0], sizeof(buf), NULL);
+    json_writer_object_begin(&writer);
+    json_writer_key(&writer, "name");
+    json_writer_string(&writer, "simba", 5);
+    json_writer_key(&writer, "version");
+    json_writer_integer(&writer, 15);
+    json_writer_key(&writer, "boards");
+    json_writer_array_begin(&writer);
+    json_writer_string(&writer, "arduino_due", 11);
+    json_writer_string(&writer, "linux", 5);
+    json_writer_array_end(&writer);
+    json_writer_key(&writer, "valid");
+    json_writer_boolean(&writer, 1);
+    json_writer_object_end(&writer);
+    json_writer_finish(&writer);
+}
+
+static void bench_base64_encode(void *arg_p)
+{
+    base64_encode(&encoded[0], &binary[0], sizeof(binary));
+}
+
+static void bench_base64_decode(void *arg_p)
+{
+    base64_decode(&binary[0], &encoded[0], sizeof(encoded) - 1);
+}
+
+int main()
+{
+    size_t i;
+    struct harness_bench_t benchmarks[] = {
+        { bench_json_parse, "json_parse", NULL, NULL },
+        { bench_json_writer, "json_writer", NULL, NULL },
+        { bench_base64_encode, "base64_encode_768", NULL, NULL },
+        { bench_base64_decode, "base64_decode_1024", NULL, NULL },
+        { NULL, NULL, NULL, NULL }
+    };
+
+    sys_start();
+
+    for (i = 0; i < sizeof(binary); i++) {
+        binary[i] = i;
+    }
+
+    base64_encode(&encoded[0], &binary[0], sizeof(binary));
+    encoded[sizeof(encoded) - 1] = '\0';
+
+    harness_bench(benchmarks);
+
+    return (0);
+}
@@ -807,6 +807,14 @@ static int test_get(void)
 
     BTASSERT(json_object_get(&json, "1", json_root(&json)) == NULL);
     BTASSERT(json_object_get(&json, "fum", json_root(&json)) == NULL);
+    BTASSERT(json_object_get(&json, "fo", json_root(&json)) == NULL);
+    BTASSERT(json_object_get(&json, "fooo", json_root(&json)) == NULL);
+
+    /* Next sibling offsets. */
+    BTASSERTI(tokens[0].next, ==, 13);
+    BTASSERTI(tokens[1].next, ==, 6);
+    BTASSERTI(tokens[2].next, ==, 5);
+    BTASSERTI(tokens[4].next, ==, 3);
 
     /* Get from an array. */
     ten_p = json_array_get(&json, 0, foo_p);
@@ -833,6 +841,454 @@ static int test_get(void)
     return (0);
 }
 
+struct stream_events_t {
+    char buf[256];
+    size_t pos;
+};
+
+static int stream_callback(void *arg_p,
+                           enum json_stream_event_t event,
+                           const char *buf_p,
+                           size_t size)
+{
+    struct stream_events_t *events_p;
+    static const char prefixes[] = "{}[]ksp";
+
+    events_p = arg_p;
+
+    if (events_p->pos + size + 3 > sizeof(events_p->buf)) {
+        return (-ENOMEM);
+    }
+
+    events_p->buf[events_p->pos++] = prefixes[event];
+
+    if (buf_p != NULL) {
+        events_p->buf[events_p->pos++] = ':';
+        memcpy(&events_p->buf[events_p->pos], buf_p, size);
+        events_p->pos += size;
+    }
+
+    events_p->buf[events_p->pos++] = ' ';
+    events_p->buf[events_p->pos] = '\0';
+
+    return (0);
+}
+
+/**
+ * Parse given string in chunks of given size using the streaming
+ * parser.
+ */
+static int stream_parse(const char *js_p,
+                        size_t chunk_size,
+                        struct stream_events_t *events_p)
+{
+    int res;
+    size_t i;
+    size_t size;
+    size_t length;
+    struct json_stream_t stream;
+    char buf[16];
+
+    events_p->pos = 0;
+    events_p->buf[0] = '\0';
+    length = strlen(js_p);
+
+    BTASSERT(json_stream_init(&stream,
+                              &buf[0],
+                              sizeof(buf),
+                              stream_callback,
+                              events_p) == 0);
+
+    for (i = 0; i < length; i += chunk_size) {
+        size = MIN(chunk_size, length - i);
+        res = json_stream_parse(&stream, &js_p[i], size);
+
+        if (res != 0) {
+            return (res);
+        }
+    }
+
+    return (json_stream_finish(&stream));
+}
+
+static int test_stream(void)
+{
+    size_t chunk_size;
+    struct stream_events_t events;
+    const char js[] = "{\"foo\": [10, {\"fie\":null}],\r\n"
+        " \"bar\\\"\\u00e5\":\"str\", \"e\": {}, \"a\": [],"
+        " \"n\":-1.5e3}";
+
+    /* All chunk sizes must give the same result. */
+    for (chunk_size = 1; chunk_size <= sizeof(js); chunk_size++) {
+        BTASSERTI(stream_parse(js, chunk_size, &events), ==, 0);
+        BTASSERTM(&events.buf[0],
+                  "{ k:foo [ p:10 { k:fie p:null } ] k:bar\\\"\\u00e5 s:str "
+                  "k:e { } k:a [ ] k:n p:-1.5e3 } ",
+                  events.pos);
+    }
+
+    /* Top level array and primitive. */
+    BTASSERTI(stream_parse("[true, \"x\"] ", 2, &events), ==, 0);
+    BTASSERTM(&events.buf[0], "[ p:true s:x ] ", events.pos);
+    BTASSERTI(stream_parse("1234", 3, &events), ==, 0);
+    BTASSERTM(&events.buf[0], "p:1234 ", events.pos);
+
+    return (0);
+}
+
+static int test_stream_fail(void)
+{
+    struct stream_events_t events;
+
+    /* Incomplete documents. */
+    BTASSERTI(stream_parse("{\"a\":", 1, &events), ==, JSON_ERROR_PART);
+    BTASSERTI(stream_parse("[1, 2", 1, &events), ==, JSON_ERROR_PART);
+    BTASSERTI(stream_parse("\"abc", 2, &events), ==, JSON_ERROR_PART);
+
+    /* Invalid documents. */
+    BTASSERTI(stream_parse("{\"a\" 1}", 1, &events), ==, JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("{\"a\":1]", 4, &events), ==, JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("[1,,2]", 4, &events), ==, JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("{1:2}", 4, &events), ==, JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("[\"\\x\"]", 4, &events), ==, JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("[\"\\u12g4\"]", 4, &events),
+              ==,
+              JSON_ERROR_INVAL);
+    BTASSERTI(stream_parse("[1] [", 4, &events), ==, JSON_ERROR_INVAL);
+
+    /* Value longer than the value buffer. */
+    BTASSERTI(stream_parse("[\"0123456789abcdefg\"]", 4, &events),
+              ==,
+              JSON_ERROR_NOMEM);
+
+    /* Too deep nesting. */
+    BTASSERTI(stream_parse("[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[[["
+                           "]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]]",
+                           8,
+                           &events), ==, JSON_ERROR_NOMEM);
+
+    return (0);
+}
+
+static int test_writer(void)
+{
+    struct json_writer_t writer;
+    char buf[256];
+    char small[8];
+    const char control[] = { 'a', '\x01', '\x1f', 'b' };
+
+    /* All value types. */
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_object_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "int"), ==, 0);
+    BTASSERTI(json_writer_integer(&writer, -1234567890L), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "zero"), ==, 0);
+    BTASSERTI(json_writer_integer(&writer, 0), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "array"), ==, 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_boolean(&writer, 1), ==, 0);
+    BTASSERTI(json_writer_boolean(&writer, 0), ==, 0);
+    BTASSERTI(json_writer_null(&writer), ==, 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_array_end(&writer), ==, 0);
+    BTASSERTI(json_writer_object_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_object_end(&writer), ==, 0);
+    BTASSERTI(json_writer_array_end(&writer), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "k\"ey"), ==, 0);
+    BTASSERTI(json_writer_string(&writer, "a\\b\r\n\t/", 7), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "ctrl"), ==, 0);
+    BTASSERTI(json_writer_string(&writer, &control[0], sizeof(control)),
+              ==,
+              0);
+    BTASSERTI(json_writer_object_end(&writer), ==, 0);
+    BTASSERTI(json_writer_finish(&writer), ==, 106);
+    BTASSERTM(&buf[0],
+              "{\"int\":-1234567890,\"zero\":0,"
+              "\"array\":[true,false,null,[],{}],"
+              "\"k\\\"ey\":\"a\\\\b\\r\\n\\t/\","
+              "\"ctrl\":\"a\\u0001\\u001fb\"}",
+              107);
+
+#if CONFIG_FLOAT == 1
+    /* Floating point numbers. */
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_float(&writer, 0.0f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, 1.5f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, -0.125f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, 100.0f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, 2.5e10f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, 1.25e-6f), ==, 0);
+    BTASSERTI(json_writer_float(&writer, NAN), ==, 0);
+    BTASSERTI(json_writer_array_end(&writer), ==, 0);
+    BTASSERTI(json_writer_finish(&writer), ==, 38);
+    BTASSERTM(&buf[0],
+              "[0,1.5,-0.125,100,2.5e10,1.25e-6,null]",
+              39);
+#endif
+
+    /* Output buffer too small. */
+    BTASSERT(json_writer_init(&writer, &small[0], sizeof(small), NULL) == 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_string(&writer, "123456", 6), ==, JSON_ERROR_NOMEM);
+    BTASSERTI(json_writer_null(&writer), ==, JSON_ERROR_NOMEM);
+    BTASSERTI(json_writer_finish(&writer), ==, JSON_ERROR_NOMEM);
+
+    /* Usage errors. */
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_object_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_null(&writer), ==, JSON_ERROR_INVAL);
+
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_key(&writer, "a"), ==, JSON_ERROR_INVAL);
+
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_object_end(&writer), ==, JSON_ERROR_INVAL);
+
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_null(&writer), ==, 0);
+    BTASSERTI(json_writer_null(&writer), ==, JSON_ERROR_INVAL);
+
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), NULL) == 0);
+    BTASSERTI(json_writer_object_begin(&writer), ==, 0);
+    BTASSERTI(json_writer_finish(&writer), ==, JSON_ERROR_PART);
+
+    return (0);
+}
+
+static int test_writer_chan(void)
+{
+    int i;
+    struct json_writer_t writer;
+    char buf[8];
+    char read_buf[64];
+
+    /* Small batch buffer, the document is written to the channel in
+       several chunks. */
+    BTASSERT(json_writer_init(&writer, &buf[0], sizeof(buf), &qout) == 0);
+    BTASSERTI(json_writer_array_begin(&writer), ==, 0);
+
+    for (i = 0; i < 5; i++) {
+        BTASSERTI(json_writer_integer(&writer, i), ==, 0);
+    }
+
+    BTASSERTI(json_writer_string(&writer, "a long string", 13), ==, 0);
+    BTASSERTI(json_writer_array_end(&writer), ==, 0);
+    BTASSERTI(json_writer_finish(&writer), ==, 27);
+    BTASSERTI(queue_size(&qout), ==, 27);
+    BTASSERTI(queue_read(&qout, &read_buf[0], 27), ==, 27);
+    BTASSERTM(&read_buf[0], "[0,1,2,3,4,\"a long string\"]", 27);
+
+    return (0);
+}
+
+#if defined(ARCH_LINUX)
+
+#define BENCHMARK_DOCUMENT_SIZE                             100000
+#define BENCHMARK_KEYS                                        2150
+
+static char benchmark_js[BENCHMARK_DOCUMENT_SIZE + 1024];
+static char benchmark_out[BENCHMARK_DOCUMENT_SIZE + 1024];
+static struct json_tok_t benchmark_tokens[11 * BENCHMARK_KEYS + 1];
+static size_t benchmark_size;
+static struct json_t benchmark_json;
+static char benchmark_key[16];
+static ssize_t benchmark_res;
+static int benchmark_count;
+
+static int benchmark_callback(void *arg_p,
+                              enum json_stream_event_t event,
+                              const char *buf_p,
+                              size_t size)
+{
+    (*(int *)arg_p)++;
+
+    return (0);
+}
+
+/**
+ * Token tree parser.
+ */
+static void bench_json_parse(void *arg_p)
+{
+    json_init(&benchmark_json,
+              benchmark_tokens,
+              membersof(benchmark_tokens));
+    benchmark_res = json_parse(&benchmark_json,
+                               benchmark_js,
+                               benchmark_size);
+}
+
+/**
+ * Streaming parser, fed in 128 bytes chunks.
+ */
+static void bench_json_stream_parse(void *arg_p)
+{
+    struct json_stream_t stream;
+    char value[32];
+    size_t pos;
+
+    benchmark_count = 0;
+    benchmark_res = json_stream_init(&stream,
+                                     &value[0],
+                                     sizeof(value),
+                                     benchmark_callback,
+                                     &benchmark_count);
+
+    for (pos = 0; pos < benchmark_size; pos += 128) {
+        benchmark_res |= json_stream_parse(&stream,
+                                           &benchmark_js[pos],
+                                           MIN(128, benchmark_size - pos));
+    }
+
+    benchmark_res |= json_stream_finish(&stream);
+}
+
+/**
+ * Lookup of the last key, the worst case.
+ */
+static void bench_json_object_get(void *arg_p)
+{
+    benchmark_res = (json_object_get(&benchmark_json,
+                                     &benchmark_key[0],
+                                     json_root(&benchmark_json)) != NULL);
+}
+
+/**
+ * Dump the token tree.
+ */
+static void bench_json_dumps(void *arg_p)
+{
+    benchmark_res = json_dumps(&benchmark_json, NULL, &benchmark_out[0]);
+}
+
+/**
+ * Write the same document without tokens.
+ */
+static void bench_json_writer(void *arg_p)
+{
+    struct json_writer_t writer;
+    char key[16];
+    int i;
+
+    json_writer_init(&writer,
+                     &benchmark_out[0],
+                     sizeof(benchmark_out),
+                     NULL);
+    json_writer_object_begin(&writer);
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        std_sprintf(&key[0], FSTR("key%04d"), i);
+        json_writer_key(&writer, &key[0]);
+        json_writer_object_begin(&writer);
+        json_writer_key(&writer, "a");
+        json_writer_integer(&writer, i);
+        json_writer_key(&writer, "b");
+        json_writer_array_begin(&writer);
+        json_writer_integer(&writer, 1);
+        json_writer_integer(&writer, 2);
+        json_writer_integer(&writer, 3);
+        json_writer_array_end(&writer);
+        json_writer_key(&writer, "c");
+        json_writer_string(&writer, "padding", 7);
+        json_writer_object_end(&writer);
+    }
+
+    json_writer_object_end(&writer);
+    benchmark_res = json_writer_finish(&writer);
+}
+
+static int run_benchmark(harness_bench_cb_t callback, const char *name_p)
+{
+    struct harness_bench_t bench;
+    struct harness_bench_result_t result;
+
+    bench.callback = callback;
+    bench.name_p = name_p;
+    bench.arg_p = NULL;
+    bench.heap_p = NULL;
+
+    BTASSERTI(harness_bench_run(&bench, &result), ==, 0);
+    std_printf(FSTR("%s: %lu bytes, %ld ns median, %ld ns p99\r\n"),
+               name_p,
+               (unsigned long)benchmark_size,
+               result.median_ns,
+               result.p99_ns);
+
+    return (0);
+}
+
+static int test_benchmark(void)
+{
+    int i;
+    size_t size;
+    struct json_tok_t *token_p;
+    char value[32];
+
+    /* Create a ~100 KB document with BENCHMARK_KEYS keys. */
+    size = 0;
+    benchmark_js[size++] = '{';
+
+    for (i = 0; i < BENCHMARK_KEYS; i++) {
+        size += std_sprintf(&benchmark_js[size],
+                            FSTR("%s\"key%04d\":{\"a\":%d,\"b\":[1,2,3],"
+                                 "\"c\":\"padding\"}"),
+                            (i == 0 ? "" : ","),
+                            i,
+                            i);
+    }
+
+    benchmark_js[size++] = '}';
+    benchmark_js[size] = '\0';
+    BTASSERT(size < sizeof(benchmark_js));
+    benchmark_size = size;
+
+    BTASSERTI(run_benchmark(bench_json_parse, "json_parse()"), ==, 0);
+    BTASSERTI(benchmark_res, ==, 11 * BENCHMARK_KEYS + 1);
+
+    BTASSERTI(run_benchmark(bench_json_stream_parse,
+                            "json_stream_parse()"), ==, 0);
+    BTASSERTI(benchmark_res, ==, 0);
+    BTASSERTI(benchmark_count, ==, 13 * BENCHMARK_KEYS + 2);
+
+    std_sprintf(&benchmark_key[0], FSTR("key%04d"), BENCHMARK_KEYS - 1);
+    BTASSERTI(run_benchmark(bench_json_object_get,
+                            "json_object_get()"), ==, 0);
+    BTASSERTI(benchmark_res, ==, 1);
+
+    token_p = json_object_get(&benchmark_json,
+                              &benchmark_key[0],
+                              json_root(&benchmark_json));
+    token_p = json_object_get(&benchmark_json, "a", token_p);
+    BTASSERT(token_p != NULL);
+    std_sprintf(&value[0], FSTR("%d"), BENCHMARK_KEYS - 1);
+    BTASSERTM(token_p->buf_p, &value[0], token_p->size);
+
+    /* Array lookup in the last object. */
+    token_p = json_object_get(&benchmark_json,
+                              &benchmark_key[0],
+                              json_root(&benchmark_json));
+    token_p = json_object_get(&benchmark_json, "b", token_p);
+    token_p = json_array_get(&benchmark_json, 2, token_p);
+    BTASSERT(token_p != NULL);
+    BTASSERTM(token_p->buf_p, "3", 1);
+
+    BTASSERTI(run_benchmark(bench_json_dumps, "json_dumps()"), ==, 0);
+    BTASSERTI(benchmark_res, ==, size);
+    BTASSERTM(&benchmark_out[0], &benchmark_js[0], size);
+
+    BTASSERTI(run_benchmark(bench_json_writer, "json_writer"), ==, 0);
+    BTASSERTI(benchmark_res, ==, size);
+    BTASSERTM(&benchmark_out[0], &benchmark_js[0], size);
+
+    return (0);
+}
+
+#endif
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -854,6 +1310,13 @@ int main()
         { test_dumps_fail, "test_dumps_fail" },
         { test_dump, "test_dump" },
         { test_get, "test_get" },
+        { test_stream, "test_stream" },
+        { test_stream_fail, "test_stream_fail" },
+        { test_writer, "test_writer" },
+        { test_writer_chan, "test_writer_chan" },
+#if defined(ARCH_LINUX)
+        { test_benchmark, "test_benchmark" },
+#endif
         { NULL, NULL }
     };
 
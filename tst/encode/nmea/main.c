@@ -684,6 +684,73 @@ static int test_decode_rmc_short(void)
     return (0);
 }
 
+static int test_decode_rmc_mode(void)
+{
+    size_t size;
+    char encoded[] =
+        "$GPRMC,123519,A,4807.038,N,01131.000,E,022.4,084.4,230394,003.1,W,A"
+        "*07\r\n";
+    struct nmea_sentence_t decoded;
+
+    /* Fields after the known fields are part of the last known
+       field. */
+    size = strlen(encoded);
+    BTASSERTI(nmea_decode(&decoded, &encoded[0], size), ==, 0);
+
+    BTASSERTI(decoded.type, ==, nmea_sentence_type_rmc_t);
+    BTASSERTM(decoded.rmc.date_p, "230394", strlen("230394") + 1);
+    BTASSERTM(decoded.rmc.magnetic_variation.angle_p, "003.1", strlen("003.1") + 1);
+    BTASSERTM(decoded.rmc.magnetic_variation.direction_p, "W,A", strlen("W,A") + 1);
+
+    return (0);
+}
+
+static int test_decode_talkers(void)
+{
+    int i;
+    char encoded[5][23] = {
+        "$GPRMC,,,,,,,,,,,*67\r\n",
+        "$GLRMC,,,,,,,,,,,*7B\r\n",
+        "$GARMC,,,,,,,,,,,*76\r\n",
+        "$GNRMC,,,,,,,,,,,*79\r\n",
+        "$GBRMC,,,,,,,,,,,*75\r\n"
+    };
+    enum nmea_talker_t talkers[5] = {
+        nmea_talker_gp_t,
+        nmea_talker_gl_t,
+        nmea_talker_ga_t,
+        nmea_talker_gn_t,
+        nmea_talker_other_t
+    };
+    struct nmea_sentence_t decoded;
+
+    for (i = 0; i < membersof(talkers); i++) {
+        BTASSERTI(nmea_decode(&decoded,
+                              &encoded[i][0],
+                              strlen(&encoded[i][0])), ==, 0);
+        BTASSERTI(decoded.type, ==, nmea_sentence_type_rmc_t);
+        BTASSERTI(decoded.talker, ==, talkers[i]);
+    }
+
+    return (0);
+}
+
+static int test_decode_long_type(void)
+{
+    size_t size;
+    char encoded[] = "$GNGGAX,1*0D\r\n";
+    struct nmea_sentence_t decoded;
+
+    /* Only three characters sentence types are known. */
+    size = strlen(encoded);
+    BTASSERTI(nmea_decode(&decoded, &encoded[0], size), ==, 0);
+    BTASSERTI(decoded.type, ==, nmea_sentence_type_raw_t);
+    BTASSERTI(decoded.talker, ==, nmea_talker_gn_t);
+    BTASSERTM(decoded.raw.str_p, "GNGGAX,1", strlen("GNGGAX,1") + 1);
+
+    return (0);
+}
+
 static int test_decode_vtg(void)
 {
     size_t size;
@@ -930,6 +997,9 @@ int main()
         { test_decode_rmc, "test_decode_rmc" },
         { test_decode_rmc_empty, "test_decode_rmc_empty" },
         { test_decode_rmc_short, "test_decode_rmc_short" },
+        { test_decode_rmc_mode, "test_decode_rmc_mode" },
+        { test_decode_talkers, "test_decode_talkers" },
+        { test_decode_long_type, "test_decode_long_type" },
         { test_decode_vtg, "test_decode_vtg" },
         { test_decode_vtg_empty, "test_decode_vtg_empty" },
         { test_decode_vtg_short, "test_decode_vtg_short" },
@@ -0,0 +1,74 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+static uint8_t buf[1024];
+
+static void bench_crc_32(void *arg_p)
+{
+    crc_32(0, &buf[0], sizeof(buf));
+}
+
+static void bench_crc_ccitt(void *arg_p)
+{
+    crc_ccitt(0xffff, &buf[0], sizeof(buf));
+}
+
+static void bench_sha1(void *arg_p)
+{
+    struct sha1_t sha1;
+    uint8_t hash[20];
+
+    sha1_init(&sha1);
+    sha1_update(&sha1, &buf[0], sizeof(buf));
+    sha1_digest(&sha1, &hash[0]);
+}
+
+int main()
+{
+    size_t i;
+    struct harness_bench_t benchmarks[] = {
+        { bench_crc_32, "crc_32_1024", NULL, NULL },
+        { bench_crc_ccitt, "crc_ccitt_1024", NULL, NULL },
+        { bench_sha1, "sha1_1024", NULL, NULL },
+        { NULL, NULL, NULL, NULL }
+    };
+
+    sys_start();
+
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = i;
+    }
+
+    harness_bench(benchmarks);
+
+    return (0);
+}
@@ -0,0 +1,89 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+static struct timer_t timer;
+
+static void timer_cb(void *arg_p)
+{
+}
+
+static void bench_thrd_yield(void *arg_p)
+{
+    thrd_yield();
+}
+
+static void bench_sys_lock(void *arg_p)
+{
+    sys_lock();
+    sys_unlock();
+}
+
+static void bench_time_get(void *arg_p)
+{
+    struct time_t now;
+
+    time_get(&now);
+}
+
+static void bench_time_micros(void *arg_p)
+{
+    time_micros();
+}
+
+static void bench_timer_start_stop(void *arg_p)
+{
+    timer_start(&timer);
+    timer_stop(&timer);
+}
+
+int main()
+{
+    struct time_t timeout;
+    struct harness_bench_t benchmarks[] = {
+        { bench_thrd_yield, "thrd_yield", NULL, NULL },
+        { bench_sys_lock, "sys_lock", NULL, NULL },
+        { bench_time_get, "time_get", NULL, NULL },
+        { bench_time_micros, "time_micros", NULL, NULL },
+        { bench_timer_start_stop, "timer_start_stop", NULL, NULL },
+        { NULL, NULL, NULL, NULL }
+    };
+
+    sys_start();
+
+    timeout.seconds = 10;
+    timeout.nanoseconds = 0;
+    timer_init(&timer, &timeout, timer_cb, NULL, 0);
+
+    harness_bench(benchmarks);
+
+    return (0);
+}
@@ -0,0 +1,118 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+#include "simba.h"
+
+#define TX_BUFFER_SIZE CONFIG_START_CONSOLE_UART_TX_BUFFER_SIZE
+
+static char buf[4 * TX_BUFFER_SIZE];
+
+static void fill_buf(char c)
+{
+    size_t i;
+
+    for (i = 0; i < sizeof(buf); i++) {
+        buf[i] = ((i % 64) == 63 ? '\n' : c);
+    }
+}
+
+static int test_flush(void)
+{
+    BTASSERTI(console_flush(), ==, 0);
+
+    /* Nothing to flush. */
+    BTASSERTI(console_flush(), ==, 0);
+    BTASSERTI(console_get_tx_dropped(), ==, 0);
+
+    return (0);
+}
+
+#if CONFIG_START_CONSOLE_UART_TX_OVERFLOW == CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK
+
+static int test_overflow_block(void)
+{
+    void *chan_p;
+
+    chan_p = console_get_output_channel();
+    fill_buf('b');
+
+    /* The writer blocks until the TX thread has made room for all
+       data. */
+    BTASSERTI(chan_write(chan_p, &buf[0], sizeof(buf)), ==, sizeof(buf));
+    BTASSERTI(console_flush(), ==, 0);
+    BTASSERTI(console_get_tx_dropped(), ==, 0);
+
+    return (0);
+}
+
+#else
+
+static int test_overflow_drop(void)
+{
+    void *chan_p;
+
+    chan_p = console_get_output_channel();
+    fill_buf('d');
+
+    /* Only the first ring buffer full of data is written, the rest
+       is dropped. */
+    BTASSERTI(console_flush(), ==, 0);
+    BTASSERTI(chan_write(chan_p, &buf[0], sizeof(buf)), ==, sizeof(buf));
+    BTASSERTI(console_get_tx_dropped(), ==, sizeof(buf) - TX_BUFFER_SIZE);
+    BTASSERTI(console_flush(), ==, 0);
+
+    /* Data that fits is not dropped. */
+    BTASSERTI(chan_write(chan_p, &buf[0], 64), ==, 64);
+    BTASSERTI(console_flush(), ==, 0);
+    BTASSERTI(console_get_tx_dropped(), ==, sizeof(buf) - TX_BUFFER_SIZE);
+
+    return (0);
+}
+
+#endif
+
+int main()
+{
+    struct harness_testcase_t testcases[] = {
+        { test_flush, "test_flush" },
+#if CONFIG_START_CONSOLE_UART_TX_OVERFLOW == CONFIG_START_CONSOLE_UART_TX_OVERFLOW_BLOCK
+        { test_overflow_block, "test_overflow_block" },
+#else
+        { test_overflow_drop, "test_overflow_drop" },
+#endif
+        { NULL, NULL }
+    };
+
+    sys_start();
+
+    harness_run(testcases);
+
+    return (0);
+}
@@ -74,6 +74,91 @@ static int test_read_write_bad_address(void)
     return (0);
 }
 
+static int test_sync(void)
+{
+    uint8_t byte;
+
+    byte = 0x5a;
+    BTASSERT(nvm_write(3, &byte, sizeof(byte)) == sizeof(byte));
+    BTASSERT(nvm_sync() == 0);
+
+    /* The written value shall survive a remount. */
+    BTASSERT(nvm_mount() == 0);
+    byte = 0;
+    BTASSERT(nvm_read(&byte, 3, sizeof(byte)) == sizeof(byte));
+    BTASSERT(byte == 0x5a);
+
+    return (0);
+}
+
+#if defined(ARCH_LINUX)
+
+static uint32_t fnv1a(uint32_t hash, const void *buf_p, size_t size)
+{
+    const uint8_t *u8_p;
+
+    u8_p = buf_p;
+
+    while (size > 0) {
+        hash ^= *u8_p++;
+        hash *= 0x01000193;
+        size--;
+    }
+
+    return (hash);
+}
+
+#endif
+
+static int test_journal_replay(void)
+{
+#if defined(ARCH_LINUX)
+    FILE *file_p;
+    uint8_t byte;
+    uint32_t record[4];
+    uint32_t checksum;
+
+    /* Records are replayed at mount. */
+    byte = 0x33;
+    BTASSERT(nvm_write(4, &byte, sizeof(byte)) == sizeof(byte));
+    byte = 0x34;
+    BTASSERT(nvm_write(5, &byte, sizeof(byte)) == sizeof(byte));
+    BTASSERT(nvm_mount() == 0);
+    BTASSERT(nvm_read(&byte, 4, sizeof(byte)) == sizeof(byte));
+    BTASSERT(byte == 0x33);
+    BTASSERT(nvm_read(&byte, 5, sizeof(byte)) == sizeof(byte));
+    BTASSERT(byte == 0x34);
+
+    /* A record written before a crash, followed by a truncated
+       record. Only the complete record is applied. */
+    record[0] = 0x6e766d6a;
+    record[1] = 6;
+    record[2] = 1;
+    byte = 0x77;
+    checksum = fnv1a(0x811c9dc5, &record[1], 2 * sizeof(uint32_t));
+    checksum = fnv1a(checksum, &byte, sizeof(byte));
+    record[3] = checksum;
+
+    file_p = fopen("nvm.bin.journal", "ab");
+    BTASSERT(file_p != NULL);
+    BTASSERT(fwrite(&record[0], sizeof(record), 1, file_p) == 1);
+    BTASSERT(fwrite(&byte, sizeof(byte), 1, file_p) == 1);
+    record[1] = 7;
+    BTASSERT(fwrite(&record[0], sizeof(record), 1, file_p) == 1);
+    fclose(file_p);
+
+    BTASSERT(nvm_mount() == 0);
+    BTASSERT(nvm_read(&byte, 6, sizeof(byte)) == sizeof(byte));
+    BTASSERT(byte == 0x77);
+    BTASSERT(nvm_read(&byte, 7, sizeof(byte)) == sizeof(byte));
+    BTASSERT(byte == 0xff);
+
+    return (0);
+#else
+    return (1);
+#endif
+}
+
 static int test_fs_commands(void)
 {
     char buf[64];
@@ -127,6 +212,8 @@ int main()
         { test_format_mount, "test_format_mount" },
         { test_read_write, "test_read_write" },
         { test_read_write_bad_address, "test_read_write_bad_address" },
+        { test_sync, "test_sync" },
+        { test_journal_replay, "test_journal_replay" },
         { test_fs_commands, "test_fs_commands" },
         { NULL, NULL }
     };
@@ -0,0 +1,94 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+/**
+ * This file was generated by simbagen.py 1.2 2026-10-17 04:24 UTC.
+ */
+
+#ifndef __SIMBA_GEN_H__
+#define __SIMBA_GEN_H__
+
+#include "simba.h"
+
+#define SETTING_INT32_ADDR 0
+#define SETTING_STRING_ADDR 4
+#define SETTING_BLOB_ADDR 8
+#define SETTING_BLOB_WITH_EMPTY_DEFAULT_DATA_ADDR 10
+#define SETTING_MAX_NAME_LENGTH_40_123456789012345678901_ADDR 20
+#define SETTING_STRING_SPACE_ADDR 24
+#define SETTING_STRING_ESCAPE_ADDR 32
+
+#define SETTING_INT32_SIZE 4
+#define SETTING_STRING_SIZE 4
+#define SETTING_BLOB_SIZE 2
+#define SETTING_BLOB_WITH_EMPTY_DEFAULT_DATA_SIZE 4
+#define SETTING_MAX_NAME_LENGTH_40_123456789012345678901_SIZE 4
+#define SETTING_STRING_SPACE_SIZE 4
+#define SETTING_STRING_ESCAPE_SIZE 8
+
+#define SETTING_INT32_TYPE setting_type_int32_t
+#define SETTING_STRING_TYPE setting_type_string_t
+#define SETTING_BLOB_TYPE setting_type_blob_t
+#define SETTING_BLOB_WITH_EMPTY_DEFAULT_DATA_TYPE setting_type_blob_t
+#define SETTING_MAX_NAME_LENGTH_40_123456789012345678901_TYPE setting_type_string_t
+#define SETTING_STRING_SPACE_TYPE setting_type_string_t
+#define SETTING_STRING_ESCAPE_TYPE setting_type_string_t
+
+#define SETTING_INT32_VALUE -2
+#define SETTING_STRING_VALUE "y"
+#define SETTING_BLOB_VALUE 1112
+#define SETTING_BLOB_WITH_EMPTY_DEFAULT_DATA_VALUE 
+#define SETTING_MAX_NAME_LENGTH_40_123456789012345678901_VALUE ""
+#define SETTING_STRING_SPACE_VALUE "   "
+#define SETTING_STRING_ESCAPE_VALUE "\"\n\t\r\\"
+
+int setting_int32_read(int32_t *value_p);
+int setting_int32_write(int32_t value);
+
+int setting_string_read(char *value_p);
+int setting_string_write(const char *value_p);
+
+int setting_blob_read(void *value_p);
+int setting_blob_write(const void *value_p);
+
+int setting_blob_with_empty_default_data_read(void *value_p);
+int setting_blob_with_empty_default_data_write(const void *value_p);
+
+int setting_max_name_length_40_123456789012345678901_read(char *value_p);
+int setting_max_name_length_40_123456789012345678901_write(const char *value_p);
+
+int setting_string_space_read(char *value_p);
+int setting_string_space_write(const char *value_p);
+
+int setting_string_escape_read(char *value_p);
+int setting_string_escape_write(const char *value_p);
+
+
+#endif
@@ -402,6 +402,87 @@ static int test_cmd_list_after_updates(void)
 #endif
 }
 
+static int test_read_by_all_names(void)
+{
+    int i;
+    uint8_t buf[8];
+    const char *names_p[] = {
+        "int32",
+        "string",
+        "blob",
+        "blob_with_empty_default_data",
+        "max_name_length_40_123456789012345678901",
+        "string_space",
+        "string_escape"
+    };
+
+    /* Every setting shall be found through the name hash. */
+    for (i = 0; i < membersof(names_p); i++) {
+        BTASSERTI(settings_read_by_name(names_p[i], &buf[0], 1), ==, 1);
+    }
+
+    /* Missing names. */
+    BTASSERTI(settings_read_by_name("", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("int", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("int322", &buf[0], 1), ==, -EINVAL);
+    BTASSERTI(settings_read_by_name("blob_", &buf[0], 1), ==, -EINVAL);
+
+    return (0);
+}
+
+static int test_sync(void)
+{
+    int32_t int32;
+    int i;
+
+    /* Write pending writes of previous testcases and cancel their
+       delayed sync. */
+    BTASSERTI(settings_sync(), ==, 0);
+
+    /* Many writes to the same setting. */
+    for (i = 0; i < 100; i++) {
+        int32 = i;
+        BTASSERTI(settings_write(SETTING_INT32_ADDR,
+                                 &int32,
+                                 SETTING_INT32_SIZE), ==, SETTING_INT32_SIZE);
+    }
+
+    int32 = 0;
+    BTASSERTI(nvm_read(&int32,
+                       SETTING_INT32_ADDR,
+                       SETTING_INT32_SIZE), ==, SETTING_INT32_SIZE);
+#if CONFIG_SETTINGS_CACHE == 1 && CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    /* Not yet written to NVM. */
+    BTASSERTI(int32, !=, 99);
+
+    /* Write the dirty range to NVM. */
+    BTASSERTI(settings_sync(), ==, 0);
+    BTASSERTI(nvm_read(&int32,
+                       SETTING_INT32_ADDR,
+                       SETTING_INT32_SIZE), ==, SETTING_INT32_SIZE);
+#endif
+    BTASSERTI(int32, ==, 99);
+
+    /* Nothing to write. */
+    BTASSERTI(settings_sync(), ==, 0);
+
+#if CONFIG_SETTINGS_CACHE == 1 && CONFIG_SETTINGS_SYNC_DELAY_MS > 0
+    /* The sync thread writes to NVM when the timer expires. */
+    int32 = 5;
+    BTASSERTI(settings_write(SETTING_INT32_ADDR,
+                             &int32,
+                             SETTING_INT32_SIZE), ==, SETTING_INT32_SIZE);
+    thrd_sleep_ms(3 * CONFIG_SETTINGS_SYNC_DELAY_MS);
+    int32 = 0;
+    BTASSERTI(nvm_read(&int32,
+                       SETTING_INT32_ADDR,
+                       SETTING_INT32_SIZE), ==, SETTING_INT32_SIZE);
+    BTASSERTI(int32, ==, 5);
+#endif
+
+    return (0);
+}
+
 int main()
 {
     struct harness_testcase_t testcases[] = {
@@ -418,6 +499,8 @@ int main()
         { test_setting_blob_read_write, "test_setting_blob_read_write" },
         { test_read_write_by_name, "test_read_write_by_name" },
         { test_cmd_list_after_updates, "test_cmd_list_after_updates" },
+        { test_read_by_all_names, "test_read_by_all_names" },
+        { test_sync, "test_sync" },
         { NULL, NULL }
     };
 
@@ -208,6 +208,7 @@ static int test_auto_completion(void)
     BTASSERT(harness_expect(&qout,
                             "\r\n"
                             "bar\r\n"
+                            "batch\r\n"
 #if !defined(ARCH_LINUX) && !defined(ARCH_PPC) && !defined(ARCH_AVR) && !defined(ARCH_ARM64)
                             "drivers/\r\n"
 #endif
@@ -223,7 +224,7 @@ static int test_auto_completion(void)
                             NULL) > 0);
 
     /* Auto completion. */
-    chan_write(&qin, "ba\t\r\n", 5);
+    chan_write(&qin, "bar\t\r\n", 6);
     BTASSERT(harness_expect(&qout,
                             "bar \r\n"
                             "0000000000000000\r\n"
@@ -724,6 +725,52 @@ static int test_history_search(void)
     return (0);
 }
 
+static int test_batch(void)
+{
+    char buf[32];
+    int i;
+
+    /* Enter batch mode. */
+    chan_write(&qin, "batch\n", 6);
+    BTASSERT(harness_expect(&qout, "batch\n", NULL) > 0);
+
+    /* Multiple commands in one write, without echo. Comments and
+       empty lines are ignored. */
+    chan_write(&qin,
+               "/tmp/bar 3\r\n"
+               "# comment\n"
+               "\n"
+               "/tmp/bar 4\n"
+               "missing\n",
+               46);
+    BTASSERT(harness_expect(&qout,
+                            "bar 6\n"
+                            "[1] OK\r\n"
+                            "bar 8\n"
+                            "[2] OK\r\n"
+                            "missing: command not found\r\n"
+                            "[3] ERROR(-1003)\r\n",
+                            NULL) > 0);
+
+    /* Too long command. */
+    for (i = 0; i < CONFIG_SHELL_COMMAND_MAX; i++) {
+        chan_write(&qin, "a", 1);
+    }
+
+    chan_write(&qin, "\n", 1);
+    std_sprintf(&buf[0], FSTR("[4] ERROR(%d)\r\n"), -E2BIG);
+    BTASSERT(harness_expect(&qout, &buf[0], NULL) > 0);
+
+    /* Leave batch mode. */
+    chan_write(&qin, "batch off\n", 10);
+    chan_write(&qin, "\n", 1);
+    BTASSERT(harness_expect(&qout, "\n$ ", NULL) > 0);
+
+    std_printf(FSTR("\r\n"));
+
+    return (0);
+}
+
 static int test_comment(void)
 {
     /* Logout. */
@@ -770,6 +817,7 @@ int main()
         { test_history, "test_history" },
         { test_history_up_down, "test_history_up_down" },
         { test_history_search, "test_history_search" },
+        { test_batch, "test_batch" },
         { test_comment, "test_comment" },
         { test_logout, "test_logout" },
         { NULL, NULL }
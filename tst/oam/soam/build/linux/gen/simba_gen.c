@@ -0,0 +1,404 @@
+/**
+ * @section License
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2014-2018, Erik Moqvist
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ *
+ * This file is part of the Simba project.
+ */
+
+/**
+ * This file was generated by simbagen.py 1.2 2026-10-17 07:43 UTC.
+ */
+
+#include "simba.h"
+
+const FAR char sysinfo[] = "app:    soam_suite-master built 2026-10-17 07:43 UTC by root.\r\n"
+                           "board:  Linux\r\n"
+                           "mcu:    Linux\r\n";
+
+
+
+
+
+
+
+const FAR struct setting_t settings[] = {
+
+    { NULL, 0, 0, 0 }
+};
+
+const FAR uint8_t settings_default[CONFIG_SETTINGS_AREA_SIZE] = {};
+
+const FAR struct settings_hash_t settings_hash = { 0, NULL, NULL };
+
+
+
+
+uint8_t nvm_eeprom_soft_block_0[CONFIG_NVM_EEPROM_SOFT_BLOCK_0_SIZE]
+__attribute__ ((section (".nvm.eeprom_soft.block_0"))) = { 28, 99, 138, 8, 1, 0, 195, 165, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255 };
+
+
+
+uint8_t nvm_eeprom_area[CONFIG_NVM_SIZE]
+__attribute__ ((section (".eeprom"))) = {  };
+
+
+const char soam_database_id[] = "8526d66bf103df9ad7e52f9334724d16";
+
+const size_t soam_database_compressed_size = 33408;
+
+const FAR uint8_t soam_database_compressed[] = { 1, 35, 32, 84, 104, 105, 115, 32, 102, 105, 108, 101, 32, 119, 97, 115, 32, 103, 101, 110, 101, 114, 97, 116, 101, 100, 32, 98, 121, 32, 115, 105, 109, 98, 97, 103, 101, 110, 46, 112, 121, 32, 49, 46, 50, 32, 50, 48, 50, 54, 45, 49, 48, 45, 49, 55, 32, 48, 55, 58, 52, 51, 32, 85, 84, 67, 46, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 49, 32, 34, 123, 125, 32, 123, 125, 32, 123, 125, 32, 123, 125, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 49, 32, 34, 100, 117, 102, 115, 99, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 50, 32, 34, 111, 110, 101, 58, 32, 123, 125, 44, 32, 101, 114, 105, 107, 58, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 50, 32, 34, 100, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 51, 32, 34, 102, 111, 111, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 52, 32, 34, 104, 101, 106, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 53, 32, 34, 118, 97, 108, 117, 101, 58, 32, 123, 125, 44, 32, 110, 97, 109, 101, 58, 32, 123, 125, 44, 32, 99, 104, 97, 114, 58, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 53, 32, 34, 100, 115, 99, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 49, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 49, 54, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 49, 55, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 48, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 49, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 48, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 49, 57, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 50, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 50, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 50, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 50, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 97, 108, 108, 111, 99, 47, 104, 101, 97, 112, 46, 99, 58, 50, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 49, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 49, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 49, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 99, 105, 114, 99, 117, 108, 97, 114, 95, 98, 117, 102, 102, 101, 114, 46, 99, 58, 49, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 50, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 111, 100, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 52, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 98, 105, 110, 97, 114, 121, 95, 116, 114, 101, 101, 46, 99, 58, 50, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 51, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 95, 101, 108, 101, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 95, 101, 108, 101, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 50, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 50, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 49, 49, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 49, 49, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 49, 50, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 49, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 99, 111, 108, 108, 101, 99, 116, 105, 111, 110, 115, 47, 108, 105, 115, 116, 46, 99, 58, 49, 52, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 95, 101, 108, 101, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 50, 50, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 104, 97, 110, 100, 108, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 50, 52, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 104, 97, 110, 100, 108, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 50, 55, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 98, 106, 101, 99, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 50, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 98, 106, 101, 99, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 50, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 51, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 51, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 108, 111, 103, 46, 99, 58, 51, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 101, 32, 34, 92, 114, 92, 110, 77, 111, 99, 107, 32, 123, 125, 32, 98, 97, 99, 107, 116, 114, 97, 99, 101, 32, 40, 109, 111, 115, 116, 32, 114, 101, 99, 101, 110, 116, 32, 99, 97, 108, 108, 32, 102, 105, 114, 115, 116, 41, 58, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 101, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 51, 102, 32, 34, 77, 111, 99, 107, 32, 105, 100, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 32, 102, 111, 114, 32, 105, 100, 32, 39, 123, 125, 39, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 51, 102, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 48, 32, 34, 92, 114, 92, 110, 123, 125, 40, 41, 58, 32, 71, 111, 116, 32, 78, 85, 76, 76, 32, 112, 111, 105, 110, 116, 101, 114, 32, 119, 105, 116, 104, 32, 115, 105, 122, 101, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 40, 48, 41, 32, 102, 111, 114, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 46, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 48, 32, 34, 115, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 49, 32, 34, 92, 114, 92, 110, 123, 125, 40, 41, 58, 32, 84, 114, 121, 105, 110, 103, 32, 116, 111, 32, 114, 101, 97, 100, 32, 101, 120, 97, 99, 116, 108, 121, 32, 123, 125, 32, 98, 121, 116, 101, 115, 40, 115, 41, 32, 102, 114, 111, 109, 32, 109, 111, 99, 107, 32, 101, 110, 116, 114, 121, 32, 119, 105, 116, 104, 32, 105, 100, 32, 39, 123, 125, 39, 32, 98, 117, 116, 32, 103, 111, 116, 32, 123, 125, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 49, 32, 34, 115, 100, 115, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 50, 32, 34, 32, 58, 58, 92, 114, 92, 110, 77, 111, 99, 107, 32, 101, 110, 116, 114, 121, 32, 100, 97, 116, 97, 58, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 52, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 105, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 52, 32, 34, 99, 114, 101, 97, 116, 101, 95, 109, 111, 99, 107, 95, 101, 110, 116, 114, 121, 40, 41, 58, 32, 71, 111, 116, 32, 78, 85, 76, 76, 32, 112, 111, 105, 110, 116, 101, 114, 32, 119, 105, 116, 104, 32, 115, 105, 122, 101, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 40, 48, 41, 32, 102, 111, 114, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 52, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 53, 32, 34, 77, 111, 99, 107, 32, 101, 110, 116, 114, 121, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 32, 102, 111, 114, 32, 105, 100, 32, 39, 123, 125, 39, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 53, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 54, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 32, 114, 101, 112, 111, 114, 116, 58, 32, 116, 111, 116, 97, 108, 40, 123, 125, 41, 44, 32, 112, 97, 115, 115, 101, 100, 40, 123, 125, 41, 44, 32, 102, 97, 105, 108, 101, 100, 40, 123, 125, 41, 44, 32, 115, 107, 105, 112, 112, 101, 100, 40, 123, 125, 41, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 54, 32, 34, 100, 100, 100, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 55, 32, 34, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 32, 84, 69, 83, 84, 32, 69, 78, 68, 32, 40, 123, 125, 41, 32, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 55, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 56, 32, 34, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 57, 32, 34, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 32, 84, 69, 83, 84, 32, 66, 69, 71, 73, 78, 32, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 92, 114, 92, 110, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 97, 32, 34, 123, 92, 34, 98, 101, 110, 99, 104, 109, 97, 114, 107, 92, 34, 58, 32, 92, 34, 123, 125, 92, 34, 44, 32, 92, 34, 105, 116, 101, 114, 97, 116, 105, 111, 110, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 115, 97, 109, 112, 108, 101, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 109, 105, 110, 95, 110, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 109, 101, 100, 105, 97, 110, 95, 110, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 112, 57, 57, 95, 110, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 97, 108, 108, 111, 99, 115, 92, 34, 58, 32, 123, 125, 44, 32, 92, 34, 102, 114, 101, 101, 115, 92, 34, 58, 32, 123, 125, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 97, 32, 34, 115, 100, 100, 100, 100, 100, 100, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 98, 32, 34, 109, 111, 99, 107, 32, 104, 101, 97, 112, 32, 115, 105, 122, 101, 58, 32, 123, 125, 32, 98, 121, 116, 101, 115, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 98, 32, 34, 117, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 99, 32, 34, 92, 114, 92, 110, 101, 110, 116, 101, 114, 58, 32, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 99, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 100, 32, 34, 70, 111, 117, 110, 100, 32, 117, 110, 114, 101, 97, 100, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 46, 32, 70, 97, 105, 108, 105, 110, 103, 32, 116, 101, 115, 116, 46, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 100, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 101, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 70, 65, 73, 76, 69, 68, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 101, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 52, 102, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 80, 65, 83, 83, 69, 68, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 52, 102, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 48, 32, 34, 101, 120, 105, 116, 58, 32, 123, 125, 58, 32, 83, 75, 73, 80, 80, 69, 68, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 48, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 49, 32, 34, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 47, 108, 105, 115, 116, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 55, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 101, 110, 99, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 55, 50, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 101, 110, 99, 104, 95, 112, 45, 62, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 55, 51, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 115, 117, 108, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 53, 32, 34, 123, 125, 58, 32, 70, 65, 73, 76, 69, 68, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 53, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 54, 32, 34, 123, 125, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 54, 32, 34, 99, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 56, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 105, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 56, 32, 34, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 99, 119, 114, 105, 116, 101, 40, 41, 58, 32, 77, 111, 99, 107, 32, 101, 110, 116, 114, 121, 32, 99, 97, 108, 108, 98, 97, 99, 107, 32, 109, 101, 109, 111, 114, 121, 32, 97, 108, 108, 111, 99, 97, 116, 105, 111, 110, 32, 102, 97, 105, 108, 101, 100, 32, 102, 111, 114, 32, 105, 100, 32, 39, 123, 125, 39, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 56, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 57, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 114, 101, 97, 100, 40, 41, 58, 32, 77, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 46, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 57, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 49, 48, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 105, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 98, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 97, 115, 115, 101, 114, 116, 40, 41, 58, 32, 68, 97, 116, 97, 32, 109, 105, 115, 109, 97, 116, 99, 104, 32, 102, 111, 114, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 32, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 98, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 99, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 97, 115, 115, 101, 114, 116, 40, 41, 58, 32, 71, 111, 116, 32, 78, 85, 76, 76, 32, 112, 111, 105, 110, 116, 101, 114, 32, 119, 105, 116, 104, 32, 115, 105, 122, 101, 32, 103, 114, 101, 97, 116, 101, 114, 32, 116, 104, 97, 110, 32, 122, 101, 114, 111, 40, 48, 41, 32, 102, 111, 114, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 32, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 99, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 100, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 97, 115, 115, 101, 114, 116, 40, 41, 58, 32, 84, 114, 121, 105, 110, 103, 32, 116, 111, 32, 114, 101, 97, 100, 32, 101, 120, 97, 99, 116, 108, 121, 32, 123, 125, 32, 98, 121, 116, 101, 115, 40, 115, 41, 32, 102, 114, 111, 109, 32, 109, 111, 99, 107, 32, 105, 100, 32, 39, 123, 125, 39, 32, 98, 117, 116, 32, 103, 111, 116, 32, 123, 125, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 100, 32, 34, 100, 115, 100, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 101, 32, 34, 58, 58, 92, 114, 92, 110, 77, 111, 99, 107, 32, 101, 110, 116, 114, 121, 32, 100, 97, 116, 97, 58, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 53, 102, 32, 34, 92, 114, 92, 110, 104, 97, 114, 110, 101, 115, 115, 95, 109, 111, 99, 107, 95, 97, 115, 115, 101, 114, 116, 40, 41, 58, 32, 123, 125, 58, 32, 109, 111, 99, 107, 32, 105, 100, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 53, 102, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 49, 48, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 105, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 101, 98, 117, 103, 47, 104, 97, 114, 110, 101, 115, 115, 46, 99, 58, 49, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 105, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 112, 111, 114, 116, 115, 47, 108, 105, 110, 117, 120, 47, 102, 108, 97, 115, 104, 95, 112, 111, 114, 116, 46, 105, 58, 49, 52, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 101, 118, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 53, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 101, 118, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 55, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 115, 116, 111, 114, 97, 103, 101, 47, 102, 108, 97, 115, 104, 46, 99, 58, 49, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 54, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 54, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 101, 118, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 54, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 56, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 54, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 100, 114, 105, 118, 101, 114, 115, 47, 110, 101, 116, 119, 111, 114, 107, 47, 117, 97, 114, 116, 46, 99, 58, 57, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 104, 97, 115, 104, 47, 99, 114, 99, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 104, 97, 115, 104, 47, 99, 114, 99, 46, 99, 58, 49, 51, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 115, 121, 115, 46, 99, 58, 54, 52, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 117, 112, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 115, 121, 115, 46, 99, 58, 54, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 117, 112, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 111, 119, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 55, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 101, 119, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 101, 102, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 105, 103, 104, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 101, 102, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 105, 103, 104, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 47, 117, 110, 105, 120, 95, 116, 105, 109, 101, 95, 116, 111, 95, 100, 97, 116, 101, 46, 105, 58, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 97, 116, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 55, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 47, 117, 110, 105, 120, 95, 116, 105, 109, 101, 95, 116, 111, 95, 100, 97, 116, 101, 46, 105, 58, 54, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 105, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 55, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 50, 49, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 50, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 105, 109, 101, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 50, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 50, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 105, 109, 101, 114, 46, 99, 58, 50, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 53, 32, 34, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 78, 65, 77, 69, 32, 32, 32, 32, 32, 32, 32, 32, 83, 84, 65, 84, 69, 32, 32, 80, 82, 73, 79, 32, 32, 76, 79, 71, 77, 65, 83, 75, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 54, 32, 34, 123, 125, 32, 123, 125, 32, 123, 125, 32, 32, 32, 32, 32, 48, 120, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 54, 32, 34, 115, 115, 100, 120, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 55, 32, 34, 85, 115, 97, 103, 101, 58, 32, 115, 101, 116, 95, 108, 111, 103, 95, 109, 97, 115, 107, 32, 60, 116, 104, 114, 101, 97, 100, 32, 110, 97, 109, 101, 62, 32, 60, 108, 111, 103, 32, 109, 97, 115, 107, 62, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 53, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 97, 105, 110, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 53, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 99, 107, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 53, 50, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 99, 107, 95, 115, 105, 122, 101, 32, 62, 32, 115, 105, 122, 101, 111, 102, 40, 115, 116, 114, 117, 99, 116, 32, 116, 104, 114, 100, 95, 116, 41, 32, 43, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 53, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 54, 49, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 49, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 116, 104, 114, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 56, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 56, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 55, 55, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 56, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 46, 99, 58, 56, 49, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 52, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 52, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 52, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 61, 32, 55, 32, 43, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 52, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 60, 61, 32, 49, 48, 50, 52, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 52, 57, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 54, 51, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 54, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 54, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 112, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 111, 97, 109, 46, 99, 58, 54, 56, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 54, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 57, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 54, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 57, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 49, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 100, 100, 114, 101, 115, 115, 32, 60, 32, 115, 105, 122, 101, 111, 102, 40, 115, 101, 116, 116, 105, 110, 103, 115, 95, 100, 101, 102, 97, 117, 108, 116, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 97, 100, 100, 114, 101, 115, 115, 32, 43, 32, 115, 105, 122, 101, 41, 32, 60, 61, 32, 115, 105, 122, 101, 111, 102, 40, 115, 101, 116, 116, 105, 110, 103, 115, 95, 100, 101, 102, 97, 117, 108, 116, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 55, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 56, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 55, 56, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 115, 101, 116, 116, 105, 110, 103, 115, 46, 99, 58, 56, 48, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 32, 61, 61, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 32, 61, 61, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 97, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 97, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 49, 57, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 111, 97, 109, 47, 110, 118, 109, 46, 99, 58, 50, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 109, 111, 100, 117, 108, 101, 46, 105, 110, 105, 116, 105, 97, 108, 105, 122, 101, 100, 32, 61, 61, 32, 49, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 50, 32, 34, 123, 125, 123, 125, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 50, 32, 34, 120, 120, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 54, 57, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 109, 109, 97, 110, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 52, 32, 34, 123, 125, 58, 32, 99, 111, 109, 109, 97, 110, 100, 32, 110, 111, 116, 32, 102, 111, 117, 110, 100, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 52, 32, 34, 115, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 57, 52, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 57, 52, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 48, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 51, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 48, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 49, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 49, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 98, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 49, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 98, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 49, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 54, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 50, 54, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 49, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 51, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 105, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 51, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 97, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 52, 56, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 56, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 53, 56, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 111, 117, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 54, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 51, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 99, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 51, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 99, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 109, 100, 95, 112, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 54, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 54, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 109, 100, 95, 112, 32, 33, 61, 32, 78, 85, 76, 76, 44, 32, 69, 73, 78, 86, 65, 76, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 55, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 55, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 97, 109, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 55, 55, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 111, 112, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 54, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 45, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 55, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 55, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 55, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 97, 108, 108, 98, 97, 99, 107, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 56, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 109, 109, 97, 110, 100, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 50, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 100, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 100, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 54, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 55, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 56, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 56, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 116, 104, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 116, 95, 99, 98, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 114, 105, 110, 116, 95, 99, 98, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 49, 57, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 97, 108, 117, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 50, 48, 48, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 112, 97, 114, 97, 109, 101, 116, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 102, 105, 108, 101, 115, 121, 115, 116, 101, 109, 115, 47, 102, 115, 46, 99, 58, 50, 48, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 48, 44, 32, 51, 56, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 114, 101, 97, 100, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 119, 114, 105, 116, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 101, 108, 101, 109, 101, 110, 116, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 101, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 110, 117, 109, 98, 101, 114, 95, 111, 102, 95, 101, 108, 101, 109, 101, 110, 116, 115, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 101, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 40, 115, 116, 114, 117, 99, 116, 32, 99, 104, 97, 110, 95, 116, 32, 42, 41, 115, 101, 108, 102, 95, 112, 41, 45, 62, 114, 101, 97, 100, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 95, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 40, 115, 116, 114, 117, 99, 116, 32, 99, 104, 97, 110, 95, 116, 32, 42, 41, 118, 95, 115, 101, 108, 102, 95, 112, 41, 45, 62, 119, 114, 105, 116, 101, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 49, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 49, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 48, 102, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 48, 102, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 99, 104, 97, 110, 46, 99, 58, 50, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 55, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 55, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 98, 117, 102, 95, 112, 32, 61, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 124, 124, 32, 40, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 41, 32, 38, 38, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 41, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 53, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 49, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 50, 50, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 50, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 48, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 49, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 48, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 50, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 113, 117, 101, 117, 101, 46, 99, 58, 51, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 53, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 57, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 49, 49, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 114, 119, 108, 111, 99, 107, 46, 99, 58, 49, 52, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 41, 32, 38, 38, 32, 40, 99, 111, 117, 110, 116, 32, 60, 61, 32, 99, 111, 117, 110, 116, 95, 109, 97, 120, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 52, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 95, 109, 97, 120, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 53, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 56, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 115, 101, 109, 46, 99, 58, 56, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 111, 117, 110, 116, 32, 62, 61, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 49, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 52, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 49, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 54, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 105, 115, 116, 101, 110, 101, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 49, 51, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 49, 51, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 98, 117, 115, 46, 99, 58, 49, 52, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 51, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 53, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 53, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 50, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 115, 105, 122, 101, 111, 102, 40, 117, 105, 110, 116, 51, 50, 95, 116, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 50, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 56, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 56, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 56, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 115, 105, 122, 101, 111, 102, 40, 117, 105, 110, 116, 51, 50, 95, 116, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 49, 50, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 49, 50, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 98, 117, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 49, 50, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 105, 122, 101, 32, 61, 61, 32, 115, 105, 122, 101, 111, 102, 40, 117, 105, 110, 116, 51, 50, 95, 116, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 49, 53, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 115, 121, 110, 99, 47, 101, 118, 101, 110, 116, 46, 99, 58, 49, 54, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 54, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 54, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 49, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 49, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 112, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 51, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 51, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 51, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 51, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 52, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 53, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 55, 53, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 97, 112, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 48, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 101, 108, 102, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 48, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 112, 101, 99, 115, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 48, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 108, 101, 110, 103, 116, 104, 32, 62, 32, 48, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 48, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 109, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 50, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 50, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 111, 114, 109, 97, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 111, 114, 109, 97, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 55, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 99, 104, 97, 110, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 98, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 99, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 55, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 111, 114, 109, 97, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 99, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 100, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 57, 48, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 100, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 101, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 57, 49, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 118, 97, 108, 117, 101, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 101, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 52, 102, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 56, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 40, 98, 97, 115, 101, 32, 61, 61, 32, 49, 54, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 49, 48, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 56, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 50, 41, 32, 124, 124, 32, 40, 98, 97, 115, 101, 32, 61, 61, 32, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 52, 102, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 48, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 49, 55, 53, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 100, 115, 116, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 48, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 49, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 49, 55, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 114, 99, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 49, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 50, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 49, 57, 50, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 50, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 51, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 49, 57, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 51, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 52, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 48, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 48, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 52, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 53, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 48, 56, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 49, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 53, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 54, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 50, 51, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 54, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 55, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 50, 52, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 55, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 56, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 52, 54, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 48, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 56, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 57, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 52, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 49, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 57, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 97, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 54, 55, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 102, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 97, 32, 34, 34, 10, 70, 77, 84, 58, 32, 48, 120, 56, 49, 53, 98, 32, 34, 47, 114, 111, 111, 116, 47, 114, 101, 112, 111, 47, 115, 114, 99, 47, 116, 101, 120, 116, 47, 115, 116, 100, 46, 99, 58, 49, 50, 55, 57, 58, 32, 65, 83, 83, 69, 82, 84, 58, 32, 40, 115, 116, 114, 95, 112, 32, 33, 61, 32, 40, 40, 118, 111, 105, 100, 32, 42, 41, 48, 41, 44, 32, 50, 50, 41, 32, 92, 114, 92, 110, 34, 10, 65, 82, 71, 58, 32, 48, 120, 56, 49, 53, 98, 32, 34, 34, 10, 67, 77, 68, 58, 32, 48, 120, 56, 48, 48, 54, 32, 34, 47, 102, 111, 111, 34, 10, 67, 77, 68, 58, 32, 48, 120, 56, 48, 57, 51, 32, 34, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 47, 108, 105, 115, 116, 34, 10, 67, 77, 68, 58, 32, 48, 120, 56, 48, 57, 52, 32, 34, 47, 107, 101, 114, 110, 101, 108, 47, 116, 104, 114, 100, 47, 115, 101, 116, 95, 108, 111, 103, 95, 109, 97, 115, 107, 34, 10 };
+
+const FAR char __fmt_eiswiibfouqckzraevzsajldlrzfy3rc[] = "\x80\x01""%d\x1f%u\x1f%f\x1f%s\x1f%c";
+const FAR char __fmt_ejxw4zj2easwilbamvzgs2z2easxgxdslrxce___[] = "\x80\x02""%d\x1f%s";
+const FAR char __fmt_ejtg6324ojog4iq_[] = "\x80\x03""";
+const FAR char __fmt_ejugk2s4ojog4iq_[] = "\x80\x04""";
+const FAR char __fmt_ej3gc3dvmu5cajlefqqg4ylnmu5cajltfqqgg2dboi5cajldlrzfy3rc[] = "\x80\x05""%d\x1f%s\x1f%c";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrgy4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x07""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrgy4tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x08""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrg4yduicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x0e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrheztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x0f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorrhe2duicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x10""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsge4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x11""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsge4tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x12""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgu2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x13""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgu3duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x14""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5qwy3dpmmxwqzlboaxggorsgu3tuicbknjukusuhiqcqy3povxhiib6huqdalbagizcsic4ojog4iq_[] = "\x80\x15""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztooraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x16""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztqoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x17""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiztsoraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x18""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2tgoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x19""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi2tioraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4dkoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x1b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhi4dmoraifjvgrkskq5cakdcovtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x1c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytcnj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytemr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytgob2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x1f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6y3jojrxk3dbojpwe5lgmzsxeltdhiytmmz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x21""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demjyhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x23""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demryhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x24""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5demrzhiqecu2tivjfiorafbxg6zdfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x26""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5denbrhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x27""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5denjqhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x28""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs6ytjnzqxe6k7orzgkzjomm5denjxhiqecu2tivjfiorafbzwk3dgl5ycaij5ebhfktcmfqqekskokzauykjalrzfy3rc[] = "\x80\x29""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gm2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2guytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2guzduicbknjukusuhiqcq5s7mvwgk3k7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x2c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2g4ytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2g4zduicbknjukusuhiqcq5s7mvwgk3k7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x2e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2hezduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x2f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geytgoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x30""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geytioraifjvgrkskq5cakdmnfzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x31""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2gezdgoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x32""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2geztsoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x33""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5rw63dmmvrxi2lpnzzs63djon2c4yz2ge2daoraifjvgrkskq5cakdwl5swyzlnl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x34""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrsg45caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x35""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumruge5caqktkncvevb2eaugqylomrwgk4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x36""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrxga5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x37""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumrygq5caqktkncvevb2eaug6ytkmvrxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x38""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzsge5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x39""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzsgi5caqktkncvevb2eaugg2dpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x3a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumztgq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumztgu5caqktkncvevb2eaug4ylnmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x3c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwy33hfzrtumzxgi5caqktkncvevb2eaugm3lul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x3d""";
+const FAR char __fmt_ejohexdojvxwg2zaevzsaytbmnvxi4tbmnssakdnn5zxiidsmvrwk3tuebrwc3dmebtgs4ttoqutuxdslrxce___[] = "\x80\x3e""%s";
+const FAR char __fmt_ejgw6y3lebuwiidnmvww64tzebqwy3dpmnqxi2lpnyqgmyljnrswiidgn5zca2leeatsk4zhlrzfy3rc[] = "\x80\x3f""%s";
+const FAR char __fmt_ejohexdoevzsqkj2ebdw65bajzkuytbaobxws3tumvzca53joruca43jpjssaz3smvqxizlseb2gqyloeb5gk4tpfaycsidgn5zca3lpmnvsa2leeatsk4zhfyra____[] = "\x80\x40""%s\x1f%s";
+const FAR char __fmt_ejohexdoevzsqkj2ebkhe6ljnztsa5dpebzgkyleebsxqyldorwhsibfmqqge6lumvzsq4zjebthe33nebww6y3lebsw45dspeqho2lunaqgszbae4sxgjzamj2xiidhn52cajleei______[] = "\x80\x41""%s\x1f%d\x1f%s\x1f%d";
+const FAR char __fmt_eiqduos4ojog4tlpmnvsazloorzhsidemf2gcos4ojog4iq_[] = "\x80\x42""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5diobwhiqecu2tivjfiorafbuwix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x43""";
+const FAR char __fmt_ejrxezlborsv63lpmnvv6zloorzhskbjhiqeo33uebhfktcmebyg62loorsxeidxnf2gqidtnf5gkidhojswc5dfoiqhi2dbnyqhuzlsn4udakjamzxxeidnn5rwwidjmqqcojlte5ohexdoei______[] = "\x80\x44""%s";
+const FAR char __fmt_ejgw6y3lebsw45dspeqg2zlnn5zhsidbnrwg6y3boruw63ramzqws3dfmqqgm33sebuwiibhevzsoxdslrxce___[] = "\x80\x45""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzsa4tfobxxe5b2eb2g65dbnquckzbjfqqhayltonswikbfmqusyidgmfuwyzlefaswikjmebzww2lqobswikbfmquvy4s4nzohexdoei______[] = "\x80\x46""%d\x1f%d\x1f%d\x1f%d";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6savcfknkcarkoiqqcqjltfeqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6vy4s4nzohexdoei______[] = "\x80\x47""%s";
+const FAR char __fmt_ejohexdoei______[] = "\x80\x48""";
+const FAR char __fmt_ei6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5ebkeku2uebbekr2jjyqd2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hu6t2pj5hvohexdolrzfy3rc[] = "\x80\x49""";
+const FAR char __fmt_ej5vyitcmvxgg2dnmfzgwxbchiqfyirfonocelbalqrgs5dfojqxi2lpnzzvyir2easwyzbmeboce43bnvygyzltlqrduibfmqwcaxbcnvuw4x3oonoceoraevwgilbalqrg2zlenfqw4x3oonoceoraevwgilbalqrhaojzl5xhgxbchiqck3defqqfyitbnrwg6y3tlqrduibfnrscyic4ejthezlfonoceoraevwgi7k4ojog4iq_[] = "\x80\x4a""%s\x1f%ld\x1f%d\x1f%ld\x1f%ld\x1f%ld\x1f%ld\x1f%ld";
+const FAR char __fmt_ejww6y3lebugkylqebzws6tfhiqck5jamj4xizltlrzfy3rc[] = "\x80\x4b""%u";
+const FAR char __fmt_ejohexdomvxhizlshiqck424ojog4iq_[] = "\x80\x4c""%s";
+const FAR char __fmt_ejdg65lomqqhk3tsmvqwiidnn5rwwidjmqqcojlte4xcartbnfwgs3theb2gk43ufzohexdoei______[] = "\x80\x4d""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebdecskmivcfy4s4nyra____[] = "\x80\x4e""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebiecu2tivcfy4s4nyra____[] = "\x80\x4f""%s";
+const FAR char __fmt_ejsxq2luhiqck4z2ebjuwskqkbcuixdslrxce___[] = "\x80\x50""%s";
+const FAR char __fmt_eixwwzlsnzswyl3unbzgil3mnfzxiiq_[] = "\x80\x51""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5domryhiqecu2tivjfiorafbrgk3tdnbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x52""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5domrzhiqecu2tivjfiorafbrgk3tdnbpxalj6mnqwy3dcmfrwwibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x53""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5domzqhiqecu2tivjfiorafbzgk43vnr2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x54""";
+const FAR char __fmt_eisxgoraizaustcfirohexdoei______[] = "\x80\x55""%s";
+const FAR char __fmt_eiswgiq_[] = "\x80\x56""%c";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dqobxhiqecu2tivjfiorafbuwix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x57""";
+const FAR char __fmt_ejugc4tomvzxgx3nn5rwwx3do5zgs5dffautuicnn5rwwidfnz2he6jamnqwy3dcmfrwwidnmvww64tzebqwy3dpmnqxi2lpnyqgmyljnrswiidgn5zca2leeatsk4zhlrzfy3rc[] = "\x80\x58""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv64tfmfscqkj2ebgw6y3lebuwiibhevzsoidon52caztpovxgils4ojog4iq_[] = "\x80\x59""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmbsgq5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x5a""";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cardborqsa3ljonwwc5ddnaqgm33sebww6y3lebuwiibhevzsoibc[] = "\x80\x5b""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5car3poqqe4vkmjqqha33jnz2gk4rao5uxi2baonuxuzjam5zgkylumvzca5dimfxca6tfojxsqmbjebtg64ranvxwg2zanfscajzfomtsaiq_[] = "\x80\x5c""%s";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cavdspfuw4zzaorxsa4tfmfscazlymfrxi3dzeaswiidcpf2gk4ziomusaztsn5wsa3lpmnvsa2leeatsk4zhebrhk5bam5xxiibfmqra____[] = "\x80\x5d""%d\x1f%s\x1f%d";
+const FAR char __fmt_ei5duxdslrxe233dnmqgk3tuoj4sazdborqtuxdslrxce___[] = "\x80\x5e""";
+const FAR char __fmt_ejohexdonbqxe3tfonzv63lpmnvv6yltonsxe5bife5cajlthiqg233dnmqgszbanzxxiidgn52w4zc4ojog4iq_[] = "\x80\x5f""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmbzgy5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x60""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5sgkytvm4xwqylsnzsxg4zomm5dcmjrha5caqktkncvevb2eaugszc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x61""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3qn5zhi4zpnruw45lyf5tgyyltnbpxa33soqxgsorrgqztuicbknjukusuhiqcqzdfozpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x62""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x63""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2gu4tuicbknjukusuhiqcqzdfozpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x64""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4ytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x65""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4zduicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x66""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2g4ztuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x67""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x68""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he3duicbknjukusuhiqcq43smnpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x69""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2he3tuicbknjukusuhiqcq43jpjssapragawcamrsfeqfy4s4nyra____[] = "\x80\x6a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytqoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x6b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3torxxeylhmuxwm3dbonuc4yz2geytsoraifjvgrkskq5cakdtnf5gkib6eaycyibsgiusaxdslrxce___[] = "\x80\x6c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorwge5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x6d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorwgi5caqktkncvevb2eaugizlwl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x6e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggoryga5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x6f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggoryg45caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x70""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5she2lwmvzhgl3omv2ho33snmxxkylsoqxggorzgq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x71""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dcmjyhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x72""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5ugc43if5rxeyzomm5dcmzuhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x73""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorwgq2duicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x74""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc643zomxggorwgyztuicbknjukusuhiqcq5lqoruw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x75""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2gyztuicbknjukusuhiqcq3tpo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x76""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2g42duicbknjukusuhiqcq3tfo5pxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x77""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2ha4tuicbknjukusuhiqcq4tfonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x78""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2heyduicbknjukusuhiqcq3dfmz2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x79""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2heytuicbknjukusuhiqcq4tjm5uhix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x7a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydkoraifjvgrkskq5cakdsmvzv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x7b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydmoraifjvgrkskq5cakdmmvthix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x7c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss4yz2geydooraifjvgrkskq5cakdsnftwq5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x7d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunryhiqecu2tivjfiorafbsgc5dfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x7e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvss65lonf4f65djnvsv65dpl5sgc5dffzutunrzhiqecu2tivjfiorafb2gs3lfl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x7f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcnz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x80""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcob2ebavgu2fkjkduibioruw2zlpov2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\x81""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdcoj2ebavgu2fkjkduibimnqwy3dcmfrwwibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x82""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdinr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x83""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65djnvsxeltdhizdqnz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x84""";
+const FAR char __fmt_eiqcaibaeaqcaibaeaqcaibaeaqe4qkniuqcaibaeaqcaictkravirjaebifeskpeaqeyt2hjvavgs24ojog4iq_[] = "\x80\x85""";
+const FAR char __fmt_eistemdteastcmtteastkzbaeaqcaibqpastamtylrzfy3rc[] = "\x80\x86""%20s\x1f%12s\x1f%5d\x1f%02x";
+const FAR char __fmt_ejkxgylhmu5ca43forpwy33hl5wwc43lea6hi2dsmvqwiidomfwwkprahrwg6zzanvqxg2z6lrzfy3rc[] = "\x80\x87""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2guzdioraifjvgrkskq5cakdnmfuw4ibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x88""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2guzdkoraifjvgrkskq5cakdtorqwg227oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x89""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2guzdmoraifjvgrkskq5cakdtorqwg227onuxuzjahyqhg2l2mvxwmkdtorzhky3ueb2gq4tel52csibleaysyibsgiusaxdslrxce___[] = "\x80\x8a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2gu4tgoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2gyytooraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4ytcoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g4zdqoraifjvgrkskq5cakdunbzgix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g42tqoraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x8f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2g43tkoraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x90""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2haydmoraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x91""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5vwk4tomvwc65diojsc4yz2haytooraifjvgrkskq5cakdomfwwkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x92""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5diojqhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x95""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5diojrhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x96""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5diojshiqecu2tivjfiorafbzws6tfea7d2ibxeavsamjmeazdekjalrzfy3rc[] = "\x80\x97""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5diojthiqecu2tivjfiorafbzws6tfea6d2ibrgazdilbagizcsic4ojog4iq_[] = "\x80\x98""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5diojuhiqecu2tivjfiorafbrwq33vorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\x99""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dmmzxhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x9a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dmmzyhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\x9b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dmmzzhiqecu2tivjfiorafbqxax3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x9c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponxwc3jomm5dmobthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\x9d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3dqoj2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\x9e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3dsmb2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\x9f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tcnz2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tcob2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tinr2ebavgu2fkjkduibimfsgi4tfonzsapbaonuxuzlpmyuhgzluoruw4z3tl5sgkztbovwhikjmeazdekjalrzfy3rc[] = "\x80\xa2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tinz2ebavgu2fkjkduibifbqwizdsmvzxgiblebzws6tffeqdypjaonuxuzlpmyuhgzluoruw4z3tl5sgkztbovwhikjmeazdekjalrzfy3rc[] = "\x80\xa3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tknr2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xa4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tknz2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tkob2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tooj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xa7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tqmb2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xa8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi3tqmj2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xa9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jponsxi5djnztxgltdhi4damj2ebavgu2fkjkduibinzqw2zk7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xaa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqnz2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xab""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqob2ebavgu2fkjkduibimrzxix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xac""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytqoj2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xad""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnr2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xae""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsnz2ebavgu2fkjkduibionzggx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xaf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhiytsob2ebavgu2fkjkduibionuxuzjahyqdalbagizcsic4ojog4iq_[] = "\x80\xb0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5xwc3jpnz3g2ltdhizdanj2ebavgu2fkjkduibinvxwi5lmmuxgs3tjoruwc3djpjswiib5huqdclbagizcsic4ojog4iq_[] = "\x80\xb1""";
+const FAR char __fmt_eistaodmpastaodmpbohexdoei______[] = "\x80\xb2""%08lx\x1f%08lx";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtunrzgq5caqktkncvevb2eaugg33nnvqw4zc7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xb3""";
+const FAR char __fmt_eisxgoramnxw23lbnzsca3tpoqqgm33vnzsfy4s4nyra____[] = "\x80\xb4""%s";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojuha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtuojuhe5caqktkncvevb2eauhaylunbpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xb6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqga2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgm3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xb8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqgm4duicbknjukusuhiqcqkdeon2f64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\xb9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqha2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xba""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjqha2tuicbknjukusuhiqcqzdtorpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xbb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrge2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xbc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrge2tuicbknjukusuhiqcqkdtojrv64baee6sakbiozxwszbafiutakjjeb6hyibionuxuzjahu6sambjfqqdemrjebohexdoei______[] = "\x80\xbd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrguzduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xbe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjrheztuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xbf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsge4tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgyzduicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjsgyztuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtgeyduicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjtgm3duicbknjukusuhiqcqzdjojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xc4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjthe2tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugi2duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjugi2tuicbknjukusuhiqcq43umf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjuhazduicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvgm4duicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xc9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvgm4tuicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xca""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvhaytuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xcb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjvhazduicbknjukusuhiqcqy3in52xix3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xcc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjwguyduicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xcd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm3duicbknjukusuhiqcqytvmzpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\xce""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm3tuicbknjukusuhiqcq4dboruf64dqeaqt2icokvgeylbaiveu4vsbjqusaxdslrxce___[] = "\x80\xcf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgm4duicbknjukusuhiqcqy3nmrpxa4baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\xd0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgy2duicbknjukusuhiqcq4dboruf64baee6satsvjrgcyicfjfhfmqkmfeqfy4s4nyra____[] = "\x80\xd1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxgy2tuicbknjukusuhiqcqy3nmrpxaibbhuqe4vkmjqwcarkjjzlectbjebohexdoei______[] = "\x80\xd2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg43duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg43tuicbknjukusuhiqcq3tbnvsv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjxg44duicbknjukusuhiqcq33qonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xd5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjygu3duicbknjukusuhiqcqztjnrsxg6ltorsw2x3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xd6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjygy3duicbknjukusuhiqcqmbmeawtgobjebohexdoei______[] = "\x80\xd7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg43duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg43tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xd9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyg44duicbknjukusuhiqcqy3bnrwgeyldnmqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xda""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjyheyduicbknjukusuhiqcqy3pnvwwc3tel5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xdb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgi4tuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xdc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgm4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xdd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgm4tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xde""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgu2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xdf""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzgy2duicbknjukusuhiqcqy3povxhizlsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xe0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzg43tuicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xe1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzha4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzha4tuicbknjukusuhiqcq4dboruf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzheyduicbknjukusuhiqcq43forpwgyraee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzheytuicbknjukusuhiqcq4dsnfxhix3dmiqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xe5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumjzhezduicbknjukusuhiqcq5tbnr2wkx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xe6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqga4tuicbknjukusuhiqcq4dbojqw2zlumvzf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x80\xe7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5tgs3dfon4xg5dfnvzs6zttfzrtumrqgizduicbknjukusuhiqcqmbmeaztqkjalrzfy3rc[] = "\x80\xe8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjrhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xe9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjshiqecu2tivjfiorafbzgkyleeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xea""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjthiqecu2tivjfiorafb3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xeb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtunjuhiqecu2tivjfiorafbzws6tfeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xec""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqgu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xed""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqgy5caqktkncvevb2eaugk3dfnvsw45dtl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xee""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjqg45caqktkncvevb2eaug45lnmjsxex3pmzpwk3dfnvsw45dtea7cambmeazdekjalrzfy3rc[] = "\x80\xef""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjrha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf0""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjtha5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf1""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgm5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf2""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgq5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjonswyzs7oaus2ptsmvqwiibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xf3""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgu5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf4""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjvgy5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xf5""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgu5caqktkncvevb2eauhmx3tmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x80\xf6""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwgy5caqktkncvevb2eaucqkdtorzhky3uebrwqylol52cakrjozpxgzlmmzpxakjnhz3xe2lumuqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x80\xf7""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwg45caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x80\xf8""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumjwha5caqktkncvevb2eauhg2l2muqd4ibqfqqdemrjebohexdoei______[] = "\x80\xf9""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrrgu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfa""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrthe5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfb""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrugy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfc""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrug45caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfd""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrwg45caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xfe""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrwha5caqktkncvevb2eaugg2dbnzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x80\xff""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rwqylofzrtumrzgi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x01""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgq5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x02""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorxgu5caqktkncvevb2eaucqytvmzpxaib5huqcqkdwn5uwiibkfeycskjapr6cakbimj2wmx3qeaqt2ibifb3g62leeavcsmbjfeqcmjrafbzws6tfea7cambjfewcamrsfeqfy4s4nyra____[] = "\x81\x03""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrga3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x04""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrge4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x05""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x06""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorrgu3tuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x07""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgi3tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x08""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggorsgi4duicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x0e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortge3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x0f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgi2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x10""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgq3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x11""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5yxkzlvmuxggortgq3tuicbknjukusuhiqcq43jpjssapr5eaycyibsgiusaxdslrxce___[] = "\x81\x12""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gq3duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x13""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2gu4duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x14""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ha2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x15""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2he2tuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x16""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2geytqoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x17""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zho3dpmnvs4yz2ge2dkoraifjvgrkskq5cakdtmvwgmx3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x18""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x19""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dimz2ebavgu2fkjkduibifbrw65looqqd4pjagausajrgeaugg33vnz2capb5ebrw65loorpw2ylyfewcamrsfeqfy4s4nyra____[] = "\x81\x1a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dinb2ebavgu2fkjkduibimnxxk3tul5wwc6bahyqdalbagizcsic4ojog4iq_[] = "\x81\x1b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dknz2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqnb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5zwk3jomm5dqnj2ebavgu2fkjkduibimnxxk3tuea7d2ibqfqqdemrjebohexdoei______[] = "\x81\x1e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dimb2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x1f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dkmr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x21""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dkmz2ebavgu2fkjkduibimnugc3s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x23""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dmnr2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x24""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dmnz2ebavgu2fkjkduibinruxg5dfnzsxex3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x26""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dsmj2ebavgu2fkjkduibionswyzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x27""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dsmr2ebavgu2fkjkduibinruxg5dfnzsxex3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x28""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmzyhiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x29""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcmzzhiqecu2tivjfiorafbrhkzs7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x2a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5rhk4zomm5dcnbqhiqecu2tivjfiorafbzws6tfea7cambmeazdekjalrzfy3rc[] = "\x81\x2b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggortgu5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x2c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvgi5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x2d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvgm5caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x2e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorvgq5caqktkncvevb2eauhg2l2muqd2pjaonuxuzlpmyuhk2looqztex3ufewcamrsfeqfy4s4nyra____[] = "\x81\x2f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorygy5caqktkncvevb2eauhgzlmmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x30""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggoryg45caqktkncvevb2eauge5lgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x31""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggoryha5caqktkncvevb2eauhg2l2muqd2pjaonuxuzlpmyuhk2looqztex3ufewcamrsfeqfy4s4nyra____[] = "\x81\x32""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgiyduicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x33""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgiytuicbknjukusuhiqcqytvmzpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x34""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgizduicbknjukusuhiqcq43jpjssapj5ebzws6tfn5tcq5ljnz2dgms7oqusyibsgiusaxdslrxce___[] = "\x81\x35""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgu2duicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x36""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf5zxs3tdf5sxmzlooqxggorrgyytuicbknjukusuhiqcq43fnrtf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x37""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmnjqhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x38""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmnjrhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x39""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmnrxhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x3a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmnryhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x3b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dmojshiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x3c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5domjthiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x3d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5domjuhiqecu2tivjfiorafbqxax3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x3e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5domzrhiqecu2tivjfiorafbrwqylol5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x3f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5domzshiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x40""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5donbzhiqecu2tivjfiorafbrwqylol5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x41""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5donjqhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x42""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5donjrhiqecu2tivjfiorafbqxax3qeaqt2ibifb3g62leeavcsmbjfqqdemrjebohexdoei______[] = "\x81\x43""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmbthiqecu2tivjfiorafbzwk3dgl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x44""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmbuhiqecu2tivjfiorafbzxazldonpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x45""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmbvhiqecu2tivjfiorafbwgk3thorucapragawcamrsfeqfy4s4nyra____[] = "\x81\x46""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmbwhiqecu2tivjfiorafbtg25c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x47""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmryhiqecu2tivjfiorafbshg5c7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x48""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqmrzhiqecu2tivjfiorafbtg64tnmf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x49""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqnbxhiqecu2tivjfiorafbtg64tnmf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x4a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqnzqhiqecu2tivjfiorafbrwqylol5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x4b""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqnzrhiqecu2tivjfiorafbtg64tnmf2f64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x4c""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqojqhiqecu2tivjfiorafbzxi4s7oaqccpjafauhm33jmqqcukjqfewcamrsfeqfy4s4nyra____[] = "\x81\x4d""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqojrhiqecu2tivjfiorafb3gc3dvmvpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x4e""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dqojshiqecu2tivjfiorafaugeyltmuqd2pjage3csid4pqqcqytbonssapj5eaytakjapr6cakdcmfzwkib5huqdqkjapr6cakdcmfzwkib5huqdekjapr6cakdcmfzwkib5huqdakjmeazdekjalrzfy3rc[] = "\x81\x4f""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjxgu5caqktkncvevb2eaugi43ul5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x50""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjxgy5caqktkncvevb2eaugm43smnpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x51""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjzgi5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x52""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmjzgm5caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x53""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrqg45caqktkncvevb2eaugm43uoiyf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x54""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrqha5caqktkncvevb2eaugm43uoiyv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x55""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrsgm5caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x56""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrsgq5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x57""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrugy5caqktkncvevb2eaugm43uoiyf64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x58""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrug45caqktkncvevb2eaugm43uoiyv64baee6sakbiozxwszbafiutakjmeazdekjalrzfy3rc[] = "\x81\x59""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrwg45caqktkncvevb2eaugm43uojpxaibbhuqcqkdwn5uwiibkfeycslbagizcsic4ojog4iq_[] = "\x81\x5a""";
+const FAR char __fmt_eixxe33poqxxezlqn4xxg4tdf52gk6duf5zxizbomm5dcmrxhe5caqktkncvevb2eauhg5dsl5ycaij5eaucq5tpnfscakrjgausyibsgiusaxdslrxce___[] = "\x81\x5b""";
+const FAR char __cmd_eixwm33pei______[] = "/\x80\x06";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3mnfzxiiq_[] = "/\x80\x93";
+const FAR char __cmd_eixwwzlsnzswyl3unbzgil3tmv2f63dpm5pw2yltnmra____[] = "/\x80\x94";
+
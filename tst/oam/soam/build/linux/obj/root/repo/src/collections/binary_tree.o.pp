@@ -0,0 +1,10288 @@
+# 0 "/root/repo/src/collections/binary_tree.c"
+# 1 "/root/repo/tst/oam/soam//"
+# 0 "<built-in>"
+# 0 "<command-line>"
+# 1 "/usr/include/stdc-predef.h" 1 3 4
+# 0 "<command-line>" 2
+# 1 "/root/repo/src/collections/binary_tree.c"
+# 31 "/root/repo/src/collections/binary_tree.c"
+# 1 "/root/repo/src/simba.h" 1
+# 61 "/root/repo/src/simba.h"
+# 1 "/usr/include/stdio.h" 1 3 4
+# 27 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 3 4
+# 1 "/usr/include/features.h" 1 3 4
+# 392 "/usr/include/features.h" 3 4
+# 1 "/usr/include/features-time64.h" 1 3 4
+# 20 "/usr/include/features-time64.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 21 "/usr/include/features-time64.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 22 "/usr/include/features-time64.h" 2 3 4
+# 393 "/usr/include/features.h" 2 3 4
+# 489 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 1 3 4
+# 561 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 562 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 563 "/usr/include/x86_64-linux-gnu/sys/cdefs.h" 2 3 4
+# 490 "/usr/include/features.h" 2 3 4
+# 513 "/usr/include/features.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/gnu/stubs-64.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/gnu/stubs.h" 2 3 4
+# 514 "/usr/include/features.h" 2 3 4
+# 34 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 2 3 4
+# 28 "/usr/include/stdio.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+
+# 214 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long unsigned int size_t;
+# 34 "/usr/include/stdio.h" 2 3 4
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 40 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 3 4
+typedef __builtin_va_list __gnuc_va_list;
+# 37 "/usr/include/stdio.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 28 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 1 3 4
+# 19 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/timesize.h" 2 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned char __u_char;
+typedef unsigned short int __u_short;
+typedef unsigned int __u_int;
+typedef unsigned long int __u_long;
+
+
+typedef signed char __int8_t;
+typedef unsigned char __uint8_t;
+typedef signed short int __int16_t;
+typedef unsigned short int __uint16_t;
+typedef signed int __int32_t;
+typedef unsigned int __uint32_t;
+
+typedef signed long int __int64_t;
+typedef unsigned long int __uint64_t;
+
+
+
+
+
+
+typedef __int8_t __int_least8_t;
+typedef __uint8_t __uint_least8_t;
+typedef __int16_t __int_least16_t;
+typedef __uint16_t __uint_least16_t;
+typedef __int32_t __int_least32_t;
+typedef __uint32_t __uint_least32_t;
+typedef __int64_t __int_least64_t;
+typedef __uint64_t __uint_least64_t;
+
+
+
+typedef long int __quad_t;
+typedef unsigned long int __u_quad_t;
+
+
+
+
+
+
+
+typedef long int __intmax_t;
+typedef unsigned long int __uintmax_t;
+# 141 "/usr/include/x86_64-linux-gnu/bits/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/typesizes.h" 1 3 4
+# 142 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/time64.h" 1 3 4
+# 143 "/usr/include/x86_64-linux-gnu/bits/types.h" 2 3 4
+
+
+typedef unsigned long int __dev_t;
+typedef unsigned int __uid_t;
+typedef unsigned int __gid_t;
+typedef unsigned long int __ino_t;
+typedef unsigned long int __ino64_t;
+typedef unsigned int __mode_t;
+typedef unsigned long int __nlink_t;
+typedef long int __off_t;
+typedef long int __off64_t;
+typedef int __pid_t;
+typedef struct { int __val[2]; } __fsid_t;
+typedef long int __clock_t;
+typedef unsigned long int __rlim_t;
+typedef unsigned long int __rlim64_t;
+typedef unsigned int __id_t;
+typedef long int __time_t;
+typedef unsigned int __useconds_t;
+typedef long int __suseconds_t;
+typedef long int __suseconds64_t;
+
+typedef int __daddr_t;
+typedef int __key_t;
+
+
+typedef int __clockid_t;
+
+
+typedef void * __timer_t;
+
+
+typedef long int __blksize_t;
+
+
+
+
+typedef long int __blkcnt_t;
+typedef long int __blkcnt64_t;
+
+
+typedef unsigned long int __fsblkcnt_t;
+typedef unsigned long int __fsblkcnt64_t;
+
+
+typedef unsigned long int __fsfilcnt_t;
+typedef unsigned long int __fsfilcnt64_t;
+
+
+typedef long int __fsword_t;
+
+typedef long int __ssize_t;
+
+
+typedef long int __syscall_slong_t;
+
+typedef unsigned long int __syscall_ulong_t;
+
+
+
+typedef __off64_t __loff_t;
+typedef char *__caddr_t;
+
+
+typedef long int __intptr_t;
+
+
+typedef unsigned int __socklen_t;
+
+
+
+
+typedef int __sig_atomic_t;
+# 39 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 1 3 4
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 1 3 4
+# 13 "/usr/include/x86_64-linux-gnu/bits/types/__mbstate_t.h" 3 4
+typedef struct
+{
+  int __count;
+  union
+  {
+    unsigned int __wch;
+    char __wchb[4];
+  } __value;
+} __mbstate_t;
+# 6 "/usr/include/x86_64-linux-gnu/bits/types/__fpos_t.h" 2 3 4
+
+
+
+
+typedef struct _G_fpos_t
+{
+  __off_t __pos;
+  __mbstate_t __state;
+} __fpos_t;
+# 40 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/__fpos64_t.h" 3 4
+typedef struct _G_fpos64_t
+{
+  __off64_t __pos;
+  __mbstate_t __state;
+} __fpos64_t;
+# 41 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+typedef struct _IO_FILE __FILE;
+# 42 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/FILE.h" 1 3 4
+
+
+
+struct _IO_FILE;
+
+
+typedef struct _IO_FILE FILE;
+# 43 "/usr/include/stdio.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/types/struct_FILE.h" 3 4
+struct _IO_FILE;
+struct _IO_marker;
+struct _IO_codecvt;
+struct _IO_wide_data;
+
+
+
+
+typedef void _IO_lock_t;
+
+
+
+
+
+struct _IO_FILE
+{
+  int _flags;
+
+
+  char *_IO_read_ptr;
+  char *_IO_read_end;
+  char *_IO_read_base;
+  char *_IO_write_base;
+  char *_IO_write_ptr;
+  char *_IO_write_end;
+  char *_IO_buf_base;
+  char *_IO_buf_end;
+
+
+  char *_IO_save_base;
+  char *_IO_backup_base;
+  char *_IO_save_end;
+
+  struct _IO_marker *_markers;
+
+  struct _IO_FILE *_chain;
+
+  int _fileno;
+  int _flags2;
+  __off_t _old_offset;
+
+
+  unsigned short _cur_column;
+  signed char _vtable_offset;
+  char _shortbuf[1];
+
+  _IO_lock_t *_lock;
+
+
+
+
+
+
+
+  __off64_t _offset;
+
+  struct _IO_codecvt *_codecvt;
+  struct _IO_wide_data *_wide_data;
+  struct _IO_FILE *_freeres_list;
+  void *_freeres_buf;
+  size_t __pad5;
+  int _mode;
+
+  char _unused2[15 * sizeof (int) - 4 * sizeof (void *) - sizeof (size_t)];
+};
+# 44 "/usr/include/stdio.h" 2 3 4
+# 52 "/usr/include/stdio.h" 3 4
+typedef __gnuc_va_list va_list;
+# 63 "/usr/include/stdio.h" 3 4
+typedef __off_t off_t;
+# 77 "/usr/include/stdio.h" 3 4
+typedef __ssize_t ssize_t;
+
+
+
+
+
+
+typedef __fpos_t fpos_t;
+# 133 "/usr/include/stdio.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdio_lim.h" 1 3 4
+# 134 "/usr/include/stdio.h" 2 3 4
+# 143 "/usr/include/stdio.h" 3 4
+extern FILE *stdin;
+extern FILE *stdout;
+extern FILE *stderr;
+
+
+
+
+
+
+extern int remove (const char *__filename) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int rename (const char *__old, const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int renameat (int __oldfd, const char *__old, int __newfd,
+       const char *__new) __attribute__ ((__nothrow__ , __leaf__));
+# 178 "/usr/include/stdio.h" 3 4
+extern int fclose (FILE *__stream);
+# 188 "/usr/include/stdio.h" 3 4
+extern FILE *tmpfile (void)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 205 "/usr/include/stdio.h" 3 4
+extern char *tmpnam (char[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern char *tmpnam_r (char __s[20]) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 222 "/usr/include/stdio.h" 3 4
+extern char *tempnam (const char *__dir, const char *__pfx)
+   __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+
+
+
+
+extern int fflush (FILE *__stream);
+# 239 "/usr/include/stdio.h" 3 4
+extern int fflush_unlocked (FILE *__stream);
+# 258 "/usr/include/stdio.h" 3 4
+extern FILE *fopen (const char *__restrict __filename,
+      const char *__restrict __modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *freopen (const char *__restrict __filename,
+        const char *__restrict __modes,
+        FILE *__restrict __stream) ;
+# 293 "/usr/include/stdio.h" 3 4
+extern FILE *fdopen (int __fd, const char *__modes) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 308 "/usr/include/stdio.h" 3 4
+extern FILE *fmemopen (void *__s, size_t __len, const char *__modes)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+
+
+
+
+extern FILE *open_memstream (char **__bufloc, size_t *__sizeloc) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (fclose, 1))) ;
+# 328 "/usr/include/stdio.h" 3 4
+extern void setbuf (FILE *__restrict __stream, char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int setvbuf (FILE *__restrict __stream, char *__restrict __buf,
+      int __modes, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern void setbuffer (FILE *__restrict __stream, char *__restrict __buf,
+         size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void setlinebuf (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int fprintf (FILE *__restrict __stream,
+      const char *__restrict __format, ...);
+
+
+
+
+extern int printf (const char *__restrict __format, ...);
+
+extern int sprintf (char *__restrict __s,
+      const char *__restrict __format, ...) __attribute__ ((__nothrow__));
+
+
+
+
+
+extern int vfprintf (FILE *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg);
+
+
+
+
+extern int vprintf (const char *__restrict __format, __gnuc_va_list __arg);
+
+extern int vsprintf (char *__restrict __s, const char *__restrict __format,
+       __gnuc_va_list __arg) __attribute__ ((__nothrow__));
+
+
+
+extern int snprintf (char *__restrict __s, size_t __maxlen,
+       const char *__restrict __format, ...)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 4)));
+
+extern int vsnprintf (char *__restrict __s, size_t __maxlen,
+        const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__)) __attribute__ ((__format__ (__printf__, 3, 0)));
+# 403 "/usr/include/stdio.h" 3 4
+extern int vdprintf (int __fd, const char *__restrict __fmt,
+       __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__printf__, 2, 0)));
+extern int dprintf (int __fd, const char *__restrict __fmt, ...)
+     __attribute__ ((__format__ (__printf__, 2, 3)));
+
+
+
+
+
+
+
+extern int fscanf (FILE *__restrict __stream,
+     const char *__restrict __format, ...) ;
+
+
+
+
+extern int scanf (const char *__restrict __format, ...) ;
+
+extern int sscanf (const char *__restrict __s,
+     const char *__restrict __format, ...) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 1 3 4
+# 120 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/long-double.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/floatn-common.h" 2 3 4
+# 121 "/usr/include/x86_64-linux-gnu/bits/floatn.h" 2 3 4
+# 431 "/usr/include/stdio.h" 2 3 4
+
+
+
+extern int fscanf (FILE *__restrict __stream, const char *__restrict __format, ...) __asm__ ("" "__isoc99_fscanf")
+
+                               ;
+extern int scanf (const char *__restrict __format, ...) __asm__ ("" "__isoc99_scanf")
+                              ;
+extern int sscanf (const char *__restrict __s, const char *__restrict __format, ...) __asm__ ("" "__isoc99_sscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+                      ;
+# 459 "/usr/include/stdio.h" 3 4
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format,
+      __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+
+
+
+
+
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+
+
+extern int vsscanf (const char *__restrict __s,
+      const char *__restrict __format, __gnuc_va_list __arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__format__ (__scanf__, 2, 0)));
+
+
+
+
+
+extern int vfscanf (FILE *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vfscanf")
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0))) ;
+extern int vscanf (const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vscanf")
+
+     __attribute__ ((__format__ (__scanf__, 1, 0))) ;
+extern int vsscanf (const char *__restrict __s, const char *__restrict __format, __gnuc_va_list __arg) __asm__ ("" "__isoc99_vsscanf") __attribute__ ((__nothrow__ , __leaf__))
+
+
+
+     __attribute__ ((__format__ (__scanf__, 2, 0)));
+# 513 "/usr/include/stdio.h" 3 4
+extern int fgetc (FILE *__stream);
+extern int getc (FILE *__stream);
+
+
+
+
+
+extern int getchar (void);
+
+
+
+
+
+
+extern int getc_unlocked (FILE *__stream);
+extern int getchar_unlocked (void);
+# 538 "/usr/include/stdio.h" 3 4
+extern int fgetc_unlocked (FILE *__stream);
+# 549 "/usr/include/stdio.h" 3 4
+extern int fputc (int __c, FILE *__stream);
+extern int putc (int __c, FILE *__stream);
+
+
+
+
+
+extern int putchar (int __c);
+# 565 "/usr/include/stdio.h" 3 4
+extern int fputc_unlocked (int __c, FILE *__stream);
+
+
+
+
+
+
+
+extern int putc_unlocked (int __c, FILE *__stream);
+extern int putchar_unlocked (int __c);
+
+
+
+
+
+
+extern int getw (FILE *__stream);
+
+
+extern int putw (int __w, FILE *__stream);
+
+
+
+
+
+
+
+extern char *fgets (char *__restrict __s, int __n, FILE *__restrict __stream)
+     __attribute__ ((__access__ (__write_only__, 1, 2)));
+# 605 "/usr/include/stdio.h" 3 4
+extern char *gets (char *__s) __attribute__ ((__deprecated__));
+# 632 "/usr/include/stdio.h" 3 4
+extern __ssize_t __getdelim (char **__restrict __lineptr,
+                             size_t *__restrict __n, int __delimiter,
+                             FILE *__restrict __stream) ;
+extern __ssize_t getdelim (char **__restrict __lineptr,
+                           size_t *__restrict __n, int __delimiter,
+                           FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern __ssize_t getline (char **__restrict __lineptr,
+                          size_t *__restrict __n,
+                          FILE *__restrict __stream) ;
+
+
+
+
+
+
+
+extern int fputs (const char *__restrict __s, FILE *__restrict __stream);
+
+
+
+
+
+extern int puts (const char *__s);
+
+
+
+
+
+
+extern int ungetc (int __c, FILE *__stream);
+
+
+
+
+
+
+extern size_t fread (void *__restrict __ptr, size_t __size,
+       size_t __n, FILE *__restrict __stream) ;
+
+
+
+
+extern size_t fwrite (const void *__restrict __ptr, size_t __size,
+        size_t __n, FILE *__restrict __s);
+# 702 "/usr/include/stdio.h" 3 4
+extern size_t fread_unlocked (void *__restrict __ptr, size_t __size,
+         size_t __n, FILE *__restrict __stream) ;
+extern size_t fwrite_unlocked (const void *__restrict __ptr, size_t __size,
+          size_t __n, FILE *__restrict __stream);
+
+
+
+
+
+
+
+extern int fseek (FILE *__stream, long int __off, int __whence);
+
+
+
+
+extern long int ftell (FILE *__stream) ;
+
+
+
+
+extern void rewind (FILE *__stream);
+# 736 "/usr/include/stdio.h" 3 4
+extern int fseeko (FILE *__stream, __off_t __off, int __whence);
+
+
+
+
+extern __off_t ftello (FILE *__stream) ;
+# 760 "/usr/include/stdio.h" 3 4
+extern int fgetpos (FILE *__restrict __stream, fpos_t *__restrict __pos);
+
+
+
+
+extern int fsetpos (FILE *__stream, const fpos_t *__pos);
+# 786 "/usr/include/stdio.h" 3 4
+extern void clearerr (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int feof (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+extern int ferror (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern void clearerr_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+extern int feof_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern int ferror_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+
+extern void perror (const char *__s);
+
+
+
+
+extern int fileno (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern int fileno_unlocked (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+# 823 "/usr/include/stdio.h" 3 4
+extern int pclose (FILE *__stream);
+
+
+
+
+
+extern FILE *popen (const char *__command, const char *__modes)
+  __attribute__ ((__malloc__)) __attribute__ ((__malloc__ (pclose, 1))) ;
+
+
+
+
+
+
+extern char *ctermid (char *__s) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1)));
+# 867 "/usr/include/stdio.h" 3 4
+extern void flockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ftrylockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void funlockfile (FILE *__stream) __attribute__ ((__nothrow__ , __leaf__));
+# 885 "/usr/include/stdio.h" 3 4
+extern int __uflow (FILE *);
+extern int __overflow (FILE *, int);
+# 909 "/usr/include/stdio.h" 3 4
+
+# 62 "/root/repo/src/simba.h" 2
+# 1 "/usr/include/stdlib.h" 1 3 4
+# 26 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 329 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef int wchar_t;
+# 33 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitflags.h" 1 3 4
+# 41 "/usr/include/stdlib.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/waitstatus.h" 1 3 4
+# 42 "/usr/include/stdlib.h" 2 3 4
+# 59 "/usr/include/stdlib.h" 3 4
+typedef struct
+  {
+    int quot;
+    int rem;
+  } div_t;
+
+
+
+typedef struct
+  {
+    long int quot;
+    long int rem;
+  } ldiv_t;
+
+
+
+
+
+__extension__ typedef struct
+  {
+    long long int quot;
+    long long int rem;
+  } lldiv_t;
+# 98 "/usr/include/stdlib.h" 3 4
+extern size_t __ctype_get_mb_cur_max (void) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+extern double atof (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern int atoi (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+extern long int atol (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+__extension__ extern long long int atoll (const char *__nptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+extern double strtod (const char *__restrict __nptr,
+        char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern float strtof (const char *__restrict __nptr,
+       char **__restrict __endptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern long double strtold (const char *__restrict __nptr,
+       char **__restrict __endptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 177 "/usr/include/stdlib.h" 3 4
+extern long int strtol (const char *__restrict __nptr,
+   char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+extern unsigned long int strtoul (const char *__restrict __nptr,
+      char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+__extension__
+extern long long int strtoq (const char *__restrict __nptr,
+        char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtouq (const char *__restrict __nptr,
+           char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+__extension__
+extern long long int strtoll (const char *__restrict __nptr,
+         char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+__extension__
+extern unsigned long long int strtoull (const char *__restrict __nptr,
+     char **__restrict __endptr, int __base)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 386 "/usr/include/stdlib.h" 3 4
+extern char *l64a (long int __n) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern long int a64l (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1))) ;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/types.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+
+
+
+
+
+
+typedef __u_char u_char;
+typedef __u_short u_short;
+typedef __u_int u_int;
+typedef __u_long u_long;
+typedef __quad_t quad_t;
+typedef __u_quad_t u_quad_t;
+typedef __fsid_t fsid_t;
+
+
+typedef __loff_t loff_t;
+
+
+
+
+typedef __ino_t ino_t;
+# 59 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __dev_t dev_t;
+
+
+
+
+typedef __gid_t gid_t;
+
+
+
+
+typedef __mode_t mode_t;
+
+
+
+
+typedef __nlink_t nlink_t;
+
+
+
+
+typedef __uid_t uid_t;
+# 97 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __pid_t pid_t;
+
+
+
+
+
+typedef __id_t id_t;
+# 114 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+typedef __daddr_t daddr_t;
+typedef __caddr_t caddr_t;
+
+
+
+
+
+typedef __key_t key_t;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clock_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clock_t clock_t;
+# 127 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/clockid_t.h" 1 3 4
+
+
+
+
+
+
+typedef __clockid_t clockid_t;
+# 129 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 1 3 4
+# 10 "/usr/include/x86_64-linux-gnu/bits/types/time_t.h" 3 4
+typedef __time_t time_t;
+# 130 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/timer_t.h" 1 3 4
+
+
+
+
+
+
+typedef __timer_t timer_t;
+# 131 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+# 144 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+typedef unsigned long int ulong;
+typedef unsigned short int ushort;
+typedef unsigned int uint;
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-intn.h" 3 4
+typedef __int8_t int8_t;
+typedef __int16_t int16_t;
+typedef __int32_t int32_t;
+typedef __int64_t int64_t;
+# 156 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+typedef __uint8_t u_int8_t;
+typedef __uint16_t u_int16_t;
+typedef __uint32_t u_int32_t;
+typedef __uint64_t u_int64_t;
+
+
+typedef int register_t __attribute__ ((__mode__ (__word__)));
+# 176 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/endian.h" 1 3 4
+# 24 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endian.h" 1 3 4
+# 35 "/usr/include/x86_64-linux-gnu/bits/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/endianness.h" 1 3 4
+# 36 "/usr/include/x86_64-linux-gnu/bits/endian.h" 2 3 4
+# 25 "/usr/include/endian.h" 2 3 4
+# 35 "/usr/include/endian.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 1 3 4
+# 33 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+static __inline __uint16_t
+__bswap_16 (__uint16_t __bsx)
+{
+
+  return __builtin_bswap16 (__bsx);
+
+
+
+}
+
+
+
+
+
+
+static __inline __uint32_t
+__bswap_32 (__uint32_t __bsx)
+{
+
+  return __builtin_bswap32 (__bsx);
+
+
+
+}
+# 69 "/usr/include/x86_64-linux-gnu/bits/byteswap.h" 3 4
+__extension__ static __inline __uint64_t
+__bswap_64 (__uint64_t __bsx)
+{
+
+  return __builtin_bswap64 (__bsx);
+
+
+
+}
+# 36 "/usr/include/endian.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/uintn-identity.h" 3 4
+static __inline __uint16_t
+__uint16_identity (__uint16_t __x)
+{
+  return __x;
+}
+
+static __inline __uint32_t
+__uint32_identity (__uint32_t __x)
+{
+  return __x;
+}
+
+static __inline __uint64_t
+__uint64_identity (__uint64_t __x)
+{
+  return __x;
+}
+# 37 "/usr/include/endian.h" 2 3 4
+# 177 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/sys/select.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/select.h" 1 3 4
+# 31 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 1 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__sigset_t.h" 1 3 4
+
+
+
+
+typedef struct
+{
+  unsigned long int __val[(1024 / (8 * sizeof (unsigned long int)))];
+} __sigset_t;
+# 5 "/usr/include/x86_64-linux-gnu/bits/types/sigset_t.h" 2 3 4
+
+
+typedef __sigset_t sigset_t;
+# 34 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timeval.h" 1 3 4
+
+
+
+
+
+
+
+struct timeval
+{
+
+
+
+
+  __time_t tv_sec;
+  __suseconds_t tv_usec;
+
+};
+# 38 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 1 3 4
+# 11 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+struct timespec
+{
+
+
+
+  __time_t tv_sec;
+
+
+
+
+  __syscall_slong_t tv_nsec;
+# 31 "/usr/include/x86_64-linux-gnu/bits/types/struct_timespec.h" 3 4
+};
+# 40 "/usr/include/x86_64-linux-gnu/sys/select.h" 2 3 4
+
+
+
+typedef __suseconds_t suseconds_t;
+
+
+
+
+
+typedef long int __fd_mask;
+# 59 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+typedef struct
+  {
+
+
+
+
+
+
+    __fd_mask __fds_bits[1024 / (8 * (int) sizeof (__fd_mask))];
+
+
+  } fd_set;
+
+
+
+
+
+
+typedef __fd_mask fd_mask;
+# 91 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 102 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int select (int __nfds, fd_set *__restrict __readfds,
+     fd_set *__restrict __writefds,
+     fd_set *__restrict __exceptfds,
+     struct timeval *__restrict __timeout);
+# 127 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+extern int pselect (int __nfds, fd_set *__restrict __readfds,
+      fd_set *__restrict __writefds,
+      fd_set *__restrict __exceptfds,
+      const struct timespec *__restrict __timeout,
+      const __sigset_t *__restrict __sigmask);
+# 153 "/usr/include/x86_64-linux-gnu/sys/select.h" 3 4
+
+# 180 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+
+
+typedef __blksize_t blksize_t;
+
+
+
+
+
+
+typedef __blkcnt_t blkcnt_t;
+
+
+
+typedef __fsblkcnt_t fsblkcnt_t;
+
+
+
+typedef __fsfilcnt_t fsfilcnt_t;
+# 227 "/usr/include/x86_64-linux-gnu/sys/types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 1 3 4
+# 44 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 1 3 4
+# 21 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes-arch.h" 2 3 4
+# 45 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/atomic_wide_counter.h" 3 4
+typedef union
+{
+  __extension__ unsigned long long int __value64;
+  struct
+  {
+    unsigned int __low;
+    unsigned int __high;
+  } __value32;
+} __atomic_wide_counter;
+# 47 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+typedef struct __pthread_internal_list
+{
+  struct __pthread_internal_list *__prev;
+  struct __pthread_internal_list *__next;
+} __pthread_list_t;
+
+typedef struct __pthread_internal_slist
+{
+  struct __pthread_internal_slist *__next;
+} __pthread_slist_t;
+# 76 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+struct __pthread_mutex_s
+{
+  int __lock;
+  unsigned int __count;
+  int __owner;
+
+  unsigned int __nusers;
+
+
+
+  int __kind;
+
+  short __spins;
+  short __elision;
+  __pthread_list_t __list;
+# 53 "/usr/include/x86_64-linux-gnu/bits/struct_mutex.h" 3 4
+};
+# 77 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+# 89 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+struct __pthread_rwlock_arch_t
+{
+  unsigned int __readers;
+  unsigned int __writers;
+  unsigned int __wrphase_futex;
+  unsigned int __writers_futex;
+  unsigned int __pad3;
+  unsigned int __pad4;
+
+  int __cur_writer;
+  int __shared;
+  signed char __rwelision;
+
+
+
+
+  unsigned char __pad1[7];
+
+
+  unsigned long int __pad2;
+
+
+  unsigned int __flags;
+# 55 "/usr/include/x86_64-linux-gnu/bits/struct_rwlock.h" 3 4
+};
+# 90 "/usr/include/x86_64-linux-gnu/bits/thread-shared-types.h" 2 3 4
+
+
+
+
+struct __pthread_cond_s
+{
+  __atomic_wide_counter __wseq;
+  __atomic_wide_counter __g1_start;
+  unsigned int __g_refs[2] ;
+  unsigned int __g_size[2];
+  unsigned int __g1_orig_size;
+  unsigned int __wrefs;
+  unsigned int __g_signals[2];
+};
+
+typedef unsigned int __tss_t;
+typedef unsigned long int __thrd_t;
+
+typedef struct
+{
+  int __data ;
+} __once_flag;
+# 24 "/usr/include/x86_64-linux-gnu/bits/pthreadtypes.h" 2 3 4
+
+
+
+typedef unsigned long int pthread_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_mutexattr_t;
+
+
+
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_condattr_t;
+
+
+
+typedef unsigned int pthread_key_t;
+
+
+
+typedef int pthread_once_t;
+
+
+union pthread_attr_t
+{
+  char __size[56];
+  long int __align;
+};
+
+typedef union pthread_attr_t pthread_attr_t;
+
+
+
+
+typedef union
+{
+  struct __pthread_mutex_s __data;
+  char __size[40];
+  long int __align;
+} pthread_mutex_t;
+
+
+typedef union
+{
+  struct __pthread_cond_s __data;
+  char __size[48];
+  __extension__ long long int __align;
+} pthread_cond_t;
+
+
+
+
+
+typedef union
+{
+  struct __pthread_rwlock_arch_t __data;
+  char __size[56];
+  long int __align;
+} pthread_rwlock_t;
+
+typedef union
+{
+  char __size[8];
+  long int __align;
+} pthread_rwlockattr_t;
+
+
+
+
+
+typedef volatile int pthread_spinlock_t;
+
+
+
+
+typedef union
+{
+  char __size[32];
+  long int __align;
+} pthread_barrier_t;
+
+typedef union
+{
+  char __size[4];
+  int __align;
+} pthread_barrierattr_t;
+# 228 "/usr/include/x86_64-linux-gnu/sys/types.h" 2 3 4
+
+
+
+# 396 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+
+extern long int random (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void srandom (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern char *initstate (unsigned int __seed, char *__statebuf,
+   size_t __statelen) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *setstate (char *__statebuf) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+struct random_data
+  {
+    int32_t *fptr;
+    int32_t *rptr;
+    int32_t *state;
+    int rand_type;
+    int rand_deg;
+    int rand_sep;
+    int32_t *end_ptr;
+  };
+
+extern int random_r (struct random_data *__restrict __buf,
+       int32_t *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int srandom_r (unsigned int __seed, struct random_data *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int initstate_r (unsigned int __seed, char *__restrict __statebuf,
+   size_t __statelen,
+   struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)));
+
+extern int setstate_r (char *__restrict __statebuf,
+         struct random_data *__restrict __buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern int rand (void) __attribute__ ((__nothrow__ , __leaf__));
+
+extern void srand (unsigned int __seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int rand_r (unsigned int *__seed) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double drand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern double erand48 (unsigned short int __xsubi[3]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int lrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int nrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern long int mrand48 (void) __attribute__ ((__nothrow__ , __leaf__));
+extern long int jrand48 (unsigned short int __xsubi[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern void srand48 (long int __seedval) __attribute__ ((__nothrow__ , __leaf__));
+extern unsigned short int *seed48 (unsigned short int __seed16v[3])
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+extern void lcong48 (unsigned short int __param[7]) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+struct drand48_data
+  {
+    unsigned short int __x[3];
+    unsigned short int __old_x[3];
+    unsigned short int __c;
+    unsigned short int __init;
+    __extension__ unsigned long long int __a;
+
+  };
+
+
+extern int drand48_r (struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int erand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        double *__restrict __result) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int lrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int nrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int mrand48_r (struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern int jrand48_r (unsigned short int __xsubi[3],
+        struct drand48_data *__restrict __buffer,
+        long int *__restrict __result)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int srand48_r (long int __seedval, struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+extern int seed48_r (unsigned short int __seed16v[3],
+       struct drand48_data *__buffer) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int lcong48_r (unsigned short int __param[7],
+        struct drand48_data *__buffer)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern __uint32_t arc4random (void)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+extern void arc4random_buf (void *__buf, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern __uint32_t arc4random_uniform (__uint32_t __upper_bound)
+     __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+extern void *malloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+extern void *calloc (size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__alloc_size__ (1, 2))) ;
+
+
+
+
+
+
+extern void *realloc (void *__ptr, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__)) __attribute__ ((__alloc_size__ (2)));
+
+
+extern void free (void *__ptr) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__warn_unused_result__))
+     __attribute__ ((__alloc_size__ (2, 3)))
+    __attribute__ ((__malloc__ (__builtin_free, 1)));
+
+
+extern void *reallocarray (void *__ptr, size_t __nmemb, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__ (reallocarray, 1)));
+
+
+
+# 1 "/usr/include/alloca.h" 1 3 4
+# 24 "/usr/include/alloca.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 25 "/usr/include/alloca.h" 2 3 4
+
+
+
+
+
+
+
+extern void *alloca (size_t __size) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+# 588 "/usr/include/stdlib.h" 2 3 4
+
+
+
+
+
+extern void *valloc (size_t __size) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__))
+     __attribute__ ((__alloc_size__ (1))) ;
+
+
+
+
+extern int posix_memalign (void **__memptr, size_t __alignment, size_t __size)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 611 "/usr/include/stdlib.h" 3 4
+extern void abort (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+extern int atexit (void (*__func) (void)) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 630 "/usr/include/stdlib.h" 3 4
+extern int on_exit (void (*__func) (int __status, void *__arg), void *__arg)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern void exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+# 649 "/usr/include/stdlib.h" 3 4
+extern void _Exit (int __status) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__noreturn__));
+
+
+
+
+extern char *getenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 667 "/usr/include/stdlib.h" 3 4
+extern int putenv (char *__string) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int setenv (const char *__name, const char *__value, int __replace)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int unsetenv (const char *__name) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int clearenv (void) __attribute__ ((__nothrow__ , __leaf__));
+# 695 "/usr/include/stdlib.h" 3 4
+extern char *mktemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 708 "/usr/include/stdlib.h" 3 4
+extern int mkstemp (char *__template) __attribute__ ((__nonnull__ (1))) ;
+# 730 "/usr/include/stdlib.h" 3 4
+extern int mkstemps (char *__template, int __suffixlen) __attribute__ ((__nonnull__ (1))) ;
+# 751 "/usr/include/stdlib.h" 3 4
+extern char *mkdtemp (char *__template) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 804 "/usr/include/stdlib.h" 3 4
+extern int system (const char *__command) ;
+# 821 "/usr/include/stdlib.h" 3 4
+extern char *realpath (const char *__restrict __name,
+         char *__restrict __resolved) __attribute__ ((__nothrow__ , __leaf__)) ;
+
+
+
+
+
+
+typedef int (*__compar_fn_t) (const void *, const void *);
+# 841 "/usr/include/stdlib.h" 3 4
+extern void *bsearch (const void *__key, const void *__base,
+        size_t __nmemb, size_t __size, __compar_fn_t __compar)
+     __attribute__ ((__nonnull__ (1, 2, 5))) ;
+
+
+
+
+
+
+
+extern void qsort (void *__base, size_t __nmemb, size_t __size,
+     __compar_fn_t __compar) __attribute__ ((__nonnull__ (1, 4)));
+# 861 "/usr/include/stdlib.h" 3 4
+extern int abs (int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern long int labs (long int __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern long long int llabs (long long int __x)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+
+
+
+
+extern div_t div (int __numer, int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+extern ldiv_t ldiv (long int __numer, long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+
+
+__extension__ extern lldiv_t lldiv (long long int __numer,
+        long long int __denom)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)) ;
+# 893 "/usr/include/stdlib.h" 3 4
+extern char *ecvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *fcvt (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+
+
+
+
+extern char *gcvt (double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern char *qecvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qfcvt (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4))) ;
+extern char *qgcvt (long double __value, int __ndigit, char *__buf)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3))) ;
+
+
+
+
+extern int ecvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int fcvt_r (double __value, int __ndigit, int *__restrict __decpt,
+     int *__restrict __sign, char *__restrict __buf,
+     size_t __len) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+extern int qecvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+extern int qfcvt_r (long double __value, int __ndigit,
+      int *__restrict __decpt, int *__restrict __sign,
+      char *__restrict __buf, size_t __len)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3, 4, 5)));
+
+
+
+
+
+extern int mblen (const char *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int mbtowc (wchar_t *__restrict __pwc,
+     const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int wctomb (char *__s, wchar_t __wchar) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern size_t mbstowcs (wchar_t *__restrict __pwcs,
+   const char *__restrict __s, size_t __n) __attribute__ ((__nothrow__ , __leaf__))
+    __attribute__ ((__access__ (__read_only__, 2)));
+
+extern size_t wcstombs (char *__restrict __s,
+   const wchar_t *__restrict __pwcs, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__access__ (__write_only__, 1, 3)))
+  __attribute__ ((__access__ (__read_only__, 2)));
+
+
+
+
+
+
+extern int rpmatch (const char *__response) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) ;
+# 980 "/usr/include/stdlib.h" 3 4
+extern int getsubopt (char **__restrict __optionp,
+        char *const *__restrict __tokens,
+        char **__restrict __valuep)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3))) ;
+# 1026 "/usr/include/stdlib.h" 3 4
+extern int getloadavg (double __loadavg[], int __nelem)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1036 "/usr/include/stdlib.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdlib-float.h" 1 3 4
+# 1037 "/usr/include/stdlib.h" 2 3 4
+# 1048 "/usr/include/stdlib.h" 3 4
+
+# 63 "/root/repo/src/simba.h" 2
+# 1 "/usr/include/string.h" 1 3 4
+# 26 "/usr/include/string.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/string.h" 2 3 4
+
+
+
+
+
+
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 34 "/usr/include/string.h" 2 3 4
+# 43 "/usr/include/string.h" 3 4
+extern void *memcpy (void *__restrict __dest, const void *__restrict __src,
+       size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void *memmove (void *__dest, const void *__src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+extern void *memccpy (void *__restrict __dest, const void *__restrict __src,
+        int __c, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__access__ (__write_only__, 1, 4)));
+
+
+
+
+extern void *memset (void *__s, int __c, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int memcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 80 "/usr/include/string.h" 3 4
+extern int __memcmpeq (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 107 "/usr/include/string.h" 3 4
+extern void *memchr (const void *__s, int __c, size_t __n)
+      __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 141 "/usr/include/string.h" 3 4
+extern char *strcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern char *strcat (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern char *strncat (char *__restrict __dest, const char *__restrict __src,
+        size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern int strncmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strcoll (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+extern size_t strxfrm (char *__restrict __dest,
+         const char *__restrict __src, size_t __n)
+    __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2))) __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 1 3 4
+# 22 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/types/__locale_t.h" 3 4
+struct __locale_struct
+{
+
+  struct __locale_data *__locales[13];
+
+
+  const unsigned short int *__ctype_b;
+  const int *__ctype_tolower;
+  const int *__ctype_toupper;
+
+
+  const char *__names[13];
+};
+
+typedef struct __locale_struct *__locale_t;
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/locale_t.h" 2 3 4
+
+typedef __locale_t locale_t;
+# 173 "/usr/include/string.h" 2 3 4
+
+
+extern int strcoll_l (const char *__s1, const char *__s2, locale_t __l)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+extern size_t strxfrm_l (char *__dest, const char *__src, size_t __n,
+    locale_t __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 4)))
+     __attribute__ ((__access__ (__write_only__, 1, 3)));
+
+
+
+
+
+extern char *strdup (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern char *strndup (const char *__string, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__malloc__)) __attribute__ ((__nonnull__ (1)));
+# 246 "/usr/include/string.h" 3 4
+extern char *strchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 273 "/usr/include/string.h" 3 4
+extern char *strrchr (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 293 "/usr/include/string.h" 3 4
+extern size_t strcspn (const char *__s, const char *__reject)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern size_t strspn (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 323 "/usr/include/string.h" 3 4
+extern char *strpbrk (const char *__s, const char *__accept)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+# 350 "/usr/include/string.h" 3 4
+extern char *strstr (const char *__haystack, const char *__needle)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strtok (char *__restrict __s, const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+
+extern char *__strtok_r (char *__restrict __s,
+    const char *__restrict __delim,
+    char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+extern char *strtok_r (char *__restrict __s, const char *__restrict __delim,
+         char **__restrict __save_ptr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+# 407 "/usr/include/string.h" 3 4
+extern size_t strlen (const char *__s)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern size_t strnlen (const char *__string, size_t __maxlen)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern char *strerror (int __errnum) __attribute__ ((__nothrow__ , __leaf__));
+# 432 "/usr/include/string.h" 3 4
+extern int strerror_r (int __errnum, char *__buf, size_t __buflen) __asm__ ("" "__xpg_strerror_r") __attribute__ ((__nothrow__ , __leaf__))
+
+                        __attribute__ ((__nonnull__ (2)))
+    __attribute__ ((__access__ (__write_only__, 2, 3)));
+# 458 "/usr/include/string.h" 3 4
+extern char *strerror_l (int __errnum, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+# 1 "/usr/include/strings.h" 1 3 4
+# 23 "/usr/include/strings.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 24 "/usr/include/strings.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+extern int bcmp (const void *__s1, const void *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bcopy (const void *__src, void *__dest, size_t __n)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern void bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 68 "/usr/include/strings.h" 3 4
+extern char *index (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+# 96 "/usr/include/strings.h" 3 4
+extern char *rindex (const char *__s, int __c)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int ffs (int __i) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+extern int ffsl (long int __l) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+__extension__ extern int ffsll (long long int __ll)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern int strcasecmp (const char *__s1, const char *__s2)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int strncasecmp (const char *__s1, const char *__s2, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+
+
+extern int strcasecmp_l (const char *__s1, const char *__s2, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+extern int strncasecmp_l (const char *__s1, const char *__s2,
+     size_t __n, locale_t __loc)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__pure__)) __attribute__ ((__nonnull__ (1, 2, 4)));
+
+
+
+# 463 "/usr/include/string.h" 2 3 4
+
+
+
+extern void explicit_bzero (void *__s, size_t __n) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)))
+    __attribute__ ((__access__ (__write_only__, 1, 2)));
+
+
+
+extern char *strsep (char **__restrict __stringp,
+       const char *__restrict __delim)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern char *strsignal (int __sig) __attribute__ ((__nothrow__ , __leaf__));
+# 489 "/usr/include/string.h" 3 4
+extern char *__stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpcpy (char *__restrict __dest, const char *__restrict __src)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern char *__stpncpy (char *__restrict __dest,
+   const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+extern char *stpncpy (char *__restrict __dest,
+        const char *__restrict __src, size_t __n)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 539 "/usr/include/string.h" 3 4
+
+# 64 "/root/repo/src/simba.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 145 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 3 4
+typedef long int ptrdiff_t;
+# 65 "/root/repo/src/simba.h" 2
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 1 3 4
+# 9 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 3 4
+# 1 "/usr/include/stdint.h" 1 3 4
+# 26 "/usr/include/stdint.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 27 "/usr/include/stdint.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/wchar.h" 1 3 4
+# 29 "/usr/include/stdint.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 30 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 1 3 4
+# 24 "/usr/include/x86_64-linux-gnu/bits/stdint-uintn.h" 3 4
+typedef __uint8_t uint8_t;
+typedef __uint16_t uint16_t;
+typedef __uint32_t uint32_t;
+typedef __uint64_t uint64_t;
+# 38 "/usr/include/stdint.h" 2 3 4
+
+
+
+
+
+typedef __int_least8_t int_least8_t;
+typedef __int_least16_t int_least16_t;
+typedef __int_least32_t int_least32_t;
+typedef __int_least64_t int_least64_t;
+
+
+typedef __uint_least8_t uint_least8_t;
+typedef __uint_least16_t uint_least16_t;
+typedef __uint_least32_t uint_least32_t;
+typedef __uint_least64_t uint_least64_t;
+
+
+
+
+
+typedef signed char int_fast8_t;
+
+typedef long int int_fast16_t;
+typedef long int int_fast32_t;
+typedef long int int_fast64_t;
+# 71 "/usr/include/stdint.h" 3 4
+typedef unsigned char uint_fast8_t;
+
+typedef unsigned long int uint_fast16_t;
+typedef unsigned long int uint_fast32_t;
+typedef unsigned long int uint_fast64_t;
+# 87 "/usr/include/stdint.h" 3 4
+typedef long int intptr_t;
+
+
+typedef unsigned long int uintptr_t;
+# 101 "/usr/include/stdint.h" 3 4
+typedef __intmax_t intmax_t;
+typedef __uintmax_t uintmax_t;
+# 10 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdint.h" 2 3 4
+# 66 "/root/repo/src/simba.h" 2
+
+# 1 "/usr/include/ctype.h" 1 3 4
+# 28 "/usr/include/ctype.h" 3 4
+
+# 46 "/usr/include/ctype.h" 3 4
+enum
+{
+  _ISupper = ((0) < 8 ? ((1 << (0)) << 8) : ((1 << (0)) >> 8)),
+  _ISlower = ((1) < 8 ? ((1 << (1)) << 8) : ((1 << (1)) >> 8)),
+  _ISalpha = ((2) < 8 ? ((1 << (2)) << 8) : ((1 << (2)) >> 8)),
+  _ISdigit = ((3) < 8 ? ((1 << (3)) << 8) : ((1 << (3)) >> 8)),
+  _ISxdigit = ((4) < 8 ? ((1 << (4)) << 8) : ((1 << (4)) >> 8)),
+  _ISspace = ((5) < 8 ? ((1 << (5)) << 8) : ((1 << (5)) >> 8)),
+  _ISprint = ((6) < 8 ? ((1 << (6)) << 8) : ((1 << (6)) >> 8)),
+  _ISgraph = ((7) < 8 ? ((1 << (7)) << 8) : ((1 << (7)) >> 8)),
+  _ISblank = ((8) < 8 ? ((1 << (8)) << 8) : ((1 << (8)) >> 8)),
+  _IScntrl = ((9) < 8 ? ((1 << (9)) << 8) : ((1 << (9)) >> 8)),
+  _ISpunct = ((10) < 8 ? ((1 << (10)) << 8) : ((1 << (10)) >> 8)),
+  _ISalnum = ((11) < 8 ? ((1 << (11)) << 8) : ((1 << (11)) >> 8))
+};
+# 79 "/usr/include/ctype.h" 3 4
+extern const unsigned short int **__ctype_b_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_tolower_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+extern const __int32_t **__ctype_toupper_loc (void)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 108 "/usr/include/ctype.h" 3 4
+extern int isalnum (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit (int) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int tolower (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int toupper (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int isblank (int) __attribute__ ((__nothrow__ , __leaf__));
+# 142 "/usr/include/ctype.h" 3 4
+extern int isascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int toascii (int __c) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int _toupper (int) __attribute__ ((__nothrow__ , __leaf__));
+extern int _tolower (int) __attribute__ ((__nothrow__ , __leaf__));
+# 251 "/usr/include/ctype.h" 3 4
+extern int isalnum_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isalpha_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int iscntrl_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int islower_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isgraph_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isprint_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int ispunct_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isspace_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isupper_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+extern int isxdigit_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+extern int isblank_l (int, locale_t) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int __tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int tolower_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+extern int toupper_l (int __c, locale_t __l) __attribute__ ((__nothrow__ , __leaf__));
+# 327 "/usr/include/ctype.h" 3 4
+
+# 68 "/root/repo/src/simba.h" 2
+# 1 "/usr/include/math.h" 1 3 4
+# 27 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libc-header-start.h" 1 3 4
+# 28 "/usr/include/math.h" 2 3 4
+
+
+
+
+
+
+
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 1 3 4
+# 25 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/libm-simd-decl-stubs.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/math-vector.h" 2 3 4
+# 41 "/usr/include/math.h" 2 3 4
+# 152 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/flt-eval-method.h" 1 3 4
+# 153 "/usr/include/math.h" 2 3 4
+# 163 "/usr/include/math.h" 3 4
+typedef float float_t;
+typedef double double_t;
+# 204 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-logb.h" 1 3 4
+# 205 "/usr/include/math.h" 2 3 4
+# 247 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/fp-fast.h" 1 3 4
+# 248 "/usr/include/math.h" 2 3 4
+# 312 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassify (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbit (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsig (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignaling (double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 313 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atan2 (double __y, double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double cos (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cos (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sin (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sin (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tan (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tan (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double sinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double tanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __tanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double acosh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __acosh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double asinh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __asinh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern double atanh (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __atanh (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double exp (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __frexp (double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern double __ldexp (double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log10 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log10 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern double __modf (double __x, double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern double expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __expm1 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log1p (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log1p (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double logb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __logb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __exp2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern double log2 (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __log2 (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern double pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __pow (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __sqrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern double hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __hypot (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern double cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __cbrt (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __ceil (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fabs (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __floor (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fmod (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinf (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finite (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern double drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __drem (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double significand (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __significand (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __copysign (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern double __nan (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnan (double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern double j0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double j1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __j1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double jn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __jn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y0 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y0 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double y1 (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __y1 (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double yn (int, double) __attribute__ ((__nothrow__ , __leaf__)); extern double __yn (int, double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern double erf (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erf (double) __attribute__ ((__nothrow__ , __leaf__));
+ extern double erfc (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __erfc (double) __attribute__ ((__nothrow__ , __leaf__));
+extern double lgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern double tgamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __tgamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern double gamma (double) __attribute__ ((__nothrow__ , __leaf__)); extern double __gamma (double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern double lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern double __lgamma_r (double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern double rint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __rint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nextafter (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern double nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __nexttoward (double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __remainder (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbn (double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogb (double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalbln (double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern double __nearbyint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __round (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __trunc (double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern double remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern double __remquo (double __x, double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrint (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrint (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llround (double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llround (double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)); extern double __fdim (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern double fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmax (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern double fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern double __fmin (double __x, double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern double fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__)); extern double __fma (double __x, double __y, double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern double scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__)); extern double __scalb (double __x, double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 314 "/usr/include/math.h" 2 3 4
+# 329 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 330 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atan2f (float __y, float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float cosf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cosf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float coshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __coshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __tanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __acoshf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __asinhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern float atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __atanhf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float expf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __frexpf (float __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern float __ldexpf (float __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float logf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log10f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log10f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern float __modff (float __x, float *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern float expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __expm1f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log1pf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float logbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __logbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __exp2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern float log2f (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __log2f (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern float powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __powf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __sqrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern float hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __hypotf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern float cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __cbrtf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __ceilf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fabsf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __floorf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmodf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinff (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitef (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern float dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __dremf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float significandf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __significandf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __copysignf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern float __nanf (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanf (float __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern float j0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float j1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __j1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float jnf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __jnf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y0f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y0f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float y1f (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __y1f (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float ynf (int, float) __attribute__ ((__nothrow__ , __leaf__)); extern float __ynf (int, float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern float erff (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erff (float) __attribute__ ((__nothrow__ , __leaf__));
+ extern float erfcf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __erfcf (float) __attribute__ ((__nothrow__ , __leaf__));
+extern float lgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern float tgammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __tgammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern float gammaf (float) __attribute__ ((__nothrow__ , __leaf__)); extern float __gammaf (float) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern float lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern float __lgammaf_r (float, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern float rintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __rintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern float nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nextafterf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern float nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __nexttowardf (float __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __remainderf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbnf (float __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalblnf (float __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern float __nearbyintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __roundf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __truncf (float __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern float remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern float __remquof (float __x, float __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundf (float __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)); extern float __fdimf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern float fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fmaxf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern float fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern float __fminf (float __x, float __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern float fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__)); extern float __fmaf (float __x, float __y, float __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern float scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__)); extern float __scalbf (float __x, float __n) __attribute__ ((__nothrow__ , __leaf__));
+# 331 "/usr/include/math.h" 2 3 4
+# 398 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 399 "/usr/include/math.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 1 3 4
+# 53 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atan2l (long double __y, long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cosl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __coshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 85 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __acoshl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __asinhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+ extern long double atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __atanhl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double expl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __frexpl (long double __x, int *__exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ldexpl (long double __x, int __exponent) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double logl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log10l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)); extern long double __modfl (long double __x, long double *__iptr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 119 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+ extern long double expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __expm1l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log1pl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __logbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __exp2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+ extern long double log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __log2l (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+ extern long double powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __powl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __sqrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+ extern long double hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __hypotl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+ extern long double cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __cbrtl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __ceill (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fabsl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __floorl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmodl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 177 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isinfl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+extern int finitel (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern long double dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __dreml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __significandl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __copysignl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nanl (const char *__tagb) __attribute__ ((__nothrow__ , __leaf__));
+# 213 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern int isnanl (long double __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+
+
+
+extern long double j0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double j1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __j1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __jnl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y0l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y0l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double y1l (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __y1l (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __ynl (int, long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+ extern long double erfl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfl (long double) __attribute__ ((__nothrow__ , __leaf__));
+ extern long double erfcl (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __erfcl (long double) __attribute__ ((__nothrow__ , __leaf__));
+extern long double lgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern long double tgammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __tgammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+extern long double gammal (long double) __attribute__ ((__nothrow__ , __leaf__)); extern long double __gammal (long double) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern long double lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__)); extern long double __lgammal_r (long double, int *__signgamp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long double rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __rintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern long double nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nextafterl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+extern long double nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nexttowardl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+# 275 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remainderl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbnl (long double __x, int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern int __ilogbl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+# 293 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalblnl (long double __x, long int __n) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long double __nearbyintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __roundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __truncl (long double __x) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+extern long double remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__)); extern long double __remquol (long double __x, long double __y, int *__quo) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+extern long int lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llrintl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long int lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long int __lroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+__extension__
+extern long long int llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__)); extern long long int __llroundl (long double __x) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fdiml (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern long double fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fmaxl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern long double fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__)); extern long double __fminl (long double __x, long double __y) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+extern long double fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__)); extern long double __fmal (long double __x, long double __y, long double __z) __attribute__ ((__nothrow__ , __leaf__));
+# 435 "/usr/include/x86_64-linux-gnu/bits/mathcalls.h" 3 4
+extern long double scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__)); extern long double __scalbl (long double __x, long double __n) __attribute__ ((__nothrow__ , __leaf__));
+# 400 "/usr/include/math.h" 2 3 4
+# 481 "/usr/include/math.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 1 3 4
+# 20 "/usr/include/x86_64-linux-gnu/bits/mathcalls-helper-functions.h" 3 4
+extern int __fpclassifyf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+extern int __signbitf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+
+
+
+extern int __isinff128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __finitef128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __isnanf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+  __attribute__ ((__const__));
+
+
+extern int __iseqsigf128 (_Float128 __x, _Float128 __y) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int __issignalingf128 (_Float128 __value) __attribute__ ((__nothrow__ , __leaf__))
+     __attribute__ ((__const__));
+# 482 "/usr/include/math.h" 2 3 4
+# 854 "/usr/include/math.h" 3 4
+extern int signgam;
+# 934 "/usr/include/math.h" 3 4
+enum
+  {
+    FP_NAN =
+
+      0,
+    FP_INFINITE =
+
+      1,
+    FP_ZERO =
+
+      2,
+    FP_SUBNORMAL =
+
+      3,
+    FP_NORMAL =
+
+      4
+  };
+# 1471 "/usr/include/math.h" 3 4
+
+# 69 "/root/repo/src/simba.h" 2
+
+
+
+
+
+
+
+# 75 "/root/repo/src/simba.h"
+typedef intptr_t longptr_t;
+
+# 1 "/root/repo/src/kernel/ports/linux/gnu/compiler.h" 1
+# 34 "/root/repo/src/kernel/ports/linux/gnu/compiler.h"
+# 1 "/root/repo/src/kernel/ports/linux/gnu/far.h" 1
+# 35 "/root/repo/src/kernel/ports/linux/gnu/compiler.h" 2
+
+typedef const char *far_string_t;
+# 78 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/config.h" 1
+# 79 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/config_default.h" 1
+# 80 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/boards/linux/board.h" 1
+# 79 "/root/repo/src/boards/linux/board.h"
+int board_pin_string_to_device_index(const char *str_p);
+# 81 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/mcus/linux/mcu.h" 1
+# 82 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/kernel/errno.h" 1
+# 451 "/root/repo/src/kernel/errno.h"
+far_string_t errno_as_string(int errno);
+# 84 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/kernel/types.h" 1
+# 158 "/root/repo/src/kernel/types.h"
+typedef uint8_t u8_t;
+typedef int8_t s8_t;
+typedef uint16_t u16_t;
+typedef int16_t s16_t;
+typedef uint32_t u32_t;
+typedef int32_t s32_t;
+
+struct thrd_prio_list_elem_t {
+    struct thrd_prio_list_elem_t *next_p;
+    struct thrd_t *thrd_p;
+};
+
+struct thrd_prio_list_t {
+    struct thrd_prio_list_elem_t *head_p;
+};
+# 85 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/kernel/assert.h" 1
+# 86 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/oam/settings.h" 1
+# 34 "/root/repo/src/oam/settings.h"
+# 1 "/root/repo/src/simba.h" 1
+# 35 "/root/repo/src/oam/settings.h" 2
+
+
+
+
+
+
+enum setting_type_t {
+    setting_type_int32_t = 0,
+    setting_type_string_t,
+    setting_type_blob_t
+};
+
+struct setting_t {
+    const char *name_p;
+    enum setting_type_t type;
+    uint32_t address;
+    size_t size;
+};
+# 61 "/root/repo/src/oam/settings.h"
+struct settings_hash_t {
+    size_t size;
+    const int16_t *displacements_p;
+    const uint16_t *indexes_p;
+};
+# 76 "/root/repo/src/oam/settings.h"
+int settings_module_init(void);
+# 87 "/root/repo/src/oam/settings.h"
+ssize_t settings_read(void *dst_p, size_t src, size_t size);
+# 98 "/root/repo/src/oam/settings.h"
+ssize_t settings_write(size_t dst, const void *src_p, size_t size);
+# 108 "/root/repo/src/oam/settings.h"
+int settings_reset(size_t address, size_t size);
+# 119 "/root/repo/src/oam/settings.h"
+ssize_t settings_read_by_name(const char *name_p,
+                              void *dst_p,
+                              size_t size);
+# 132 "/root/repo/src/oam/settings.h"
+ssize_t settings_write_by_name(const char *name_p,
+                               const void *src_p,
+                               size_t size);
+# 144 "/root/repo/src/oam/settings.h"
+int settings_reset_by_name(const char *name_p,
+                           size_t size);
+
+
+
+
+
+
+int settings_reset_all(void);
+
+
+
+
+
+
+
+int settings_sync(void);
+# 88 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/collections/binary_tree.h" 1
+# 36 "/root/repo/src/collections/binary_tree.h"
+struct binary_tree_node_t {
+    int key;
+    int height;
+    struct binary_tree_node_t *left_p;
+    struct binary_tree_node_t *right_p;
+};
+
+struct binary_tree_t {
+    struct binary_tree_node_t *root_p;
+};
+# 54 "/root/repo/src/collections/binary_tree.h"
+int binary_tree_init(struct binary_tree_t *self_p);
+# 69 "/root/repo/src/collections/binary_tree.h"
+int binary_tree_insert(struct binary_tree_t *self_p,
+                       struct binary_tree_node_t *node_p);
+# 81 "/root/repo/src/collections/binary_tree.h"
+int binary_tree_delete(struct binary_tree_t *self_p,
+                       int key);
+# 93 "/root/repo/src/collections/binary_tree.h"
+struct binary_tree_node_t *
+binary_tree_search(struct binary_tree_t *self_p,
+                   int key);
+
+
+
+
+
+
+void binary_tree_print(struct binary_tree_t *self_p);
+# 90 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/collections/bits.h" 1
+# 50 "/root/repo/src/collections/bits.h"
+static inline uint32_t bits_insert_32(uint32_t dst,
+                                      int position,
+                                      int size,
+                                      uint32_t src)
+{
+    uint32_t mask;
+
+    mask = (((1LU << size) - 1) << position);
+    dst &= ~mask;
+    dst |= ((src << position) & mask);
+
+    return (dst);
+}
+# 91 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/collections/fifo.h" 1
+# 36 "/root/repo/src/collections/fifo.h"
+struct fifo_t {
+    int rdpos;
+    int wrpos;
+    void *buf_p;
+    int max;
+};
+# 128 "/root/repo/src/collections/fifo.h"
+static inline int fifo_init(struct fifo_t *self_p,
+                            int max)
+{
+    self_p->rdpos = 0;
+    self_p->wrpos = 0;
+    self_p->max = max;
+
+    return (0);
+}
+# 146 "/root/repo/src/collections/fifo.h"
+static inline int fifo_put(struct fifo_t *self_p)
+{
+    int i;
+    int wrpos = ((self_p->wrpos + 1) % self_p->max);
+
+    if (self_p->rdpos == wrpos) {
+        return (-1);
+    }
+
+    i = self_p->wrpos;
+    self_p->wrpos = wrpos;
+
+    return (i);
+}
+# 169 "/root/repo/src/collections/fifo.h"
+static inline int fifo_get(struct fifo_t *self_p)
+{
+    int i;
+
+    if (self_p->rdpos == self_p->wrpos) {
+        return (-1);
+    }
+
+    i = self_p->rdpos;
+    self_p->rdpos++;
+    self_p->rdpos %= self_p->max;
+
+    return (i);
+}
+# 92 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/collections/list.h" 1
+# 40 "/root/repo/src/collections/list.h"
+struct list_elem_t {
+    struct list_elem_t *next_p;
+};
+
+
+
+
+struct list_t {
+    struct list_elem_t *head_p;
+    struct list_elem_t *tail_p;
+};
+
+
+
+
+struct list_iter_t {
+    struct list_elem_t *next_p;
+};
+# 71 "/root/repo/src/collections/list.h"
+int list_init(struct list_t *self_p);
+# 80 "/root/repo/src/collections/list.h"
+void *list_peek_head(struct list_t *self_p);
+# 90 "/root/repo/src/collections/list.h"
+int list_add_head(struct list_t *self_p,
+                  void *elem_p);
+# 101 "/root/repo/src/collections/list.h"
+int list_add_tail(struct list_t *self_p,
+                  void *elem_p);
+# 112 "/root/repo/src/collections/list.h"
+void *list_remove_head(struct list_t *self_p);
+# 122 "/root/repo/src/collections/list.h"
+void *list_remove(struct list_t *self_p,
+                  void *elem_p);
+# 133 "/root/repo/src/collections/list.h"
+int list_iter_init(struct list_iter_t *self_p,
+                   struct list_t *list_p);
+# 143 "/root/repo/src/collections/list.h"
+void *list_iter_next(struct list_iter_t *self_p);
+# 93 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/collections/hash_map.h" 1
+# 36 "/root/repo/src/collections/hash_map.h"
+typedef int (*hash_map_hash_t)(longptr_t key);
+
+struct hash_map_entry_t {
+    struct hash_map_entry_t *next_p;
+    longptr_t key;
+    longptr_t value;
+};
+
+struct hash_map_bucket_t {
+    struct hash_map_entry_t *list_p;
+};
+
+struct hash_map_t {
+    struct hash_map_bucket_t *buckets_p;
+    size_t buckets_max;
+    struct hash_map_entry_t *entries_p;
+    hash_map_hash_t hash;
+};
+# 67 "/root/repo/src/collections/hash_map.h"
+int hash_map_init(struct hash_map_t *self_p,
+                  struct hash_map_bucket_t *buckets_p,
+                  size_t buckets_max,
+                  struct hash_map_entry_t *entries_p,
+                  size_t entries_max,
+                  hash_map_hash_t hash);
+# 84 "/root/repo/src/collections/hash_map.h"
+int hash_map_add(struct hash_map_t *self_p,
+                 longptr_t key,
+                 longptr_t value);
+# 96 "/root/repo/src/collections/hash_map.h"
+int hash_map_remove(struct hash_map_t *self_p,
+                    longptr_t key);
+# 110 "/root/repo/src/collections/hash_map.h"
+int hash_map_get(struct hash_map_t *self_p,
+                 longptr_t key,
+                 longptr_t *value_p);
+# 94 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/collections/circular_buffer.h" 1
+# 37 "/root/repo/src/collections/circular_buffer.h"
+struct circular_buffer_t {
+    char *buf_p;
+    size_t size;
+    size_t writepos;
+    size_t readpos;
+};
+# 53 "/root/repo/src/collections/circular_buffer.h"
+int circular_buffer_init(struct circular_buffer_t *self_p,
+                         void *buf_p,
+                         size_t size);
+# 66 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_write(struct circular_buffer_t *self_p,
+                              const void *buf_p,
+                              size_t size);
+# 80 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_read(struct circular_buffer_t *self_p,
+                             void *buf_p,
+                             size_t size);
+# 91 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_used_size(struct circular_buffer_t *self_p);
+# 100 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_unused_size(struct circular_buffer_t *self_p);
+# 110 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_skip_front(struct circular_buffer_t *self_p,
+                                   size_t size);
+# 121 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_reverse_skip_back(struct circular_buffer_t *self_p,
+                                          size_t size);
+# 136 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_array_one(struct circular_buffer_t *self_p,
+                                  void **buf_pp,
+                                  size_t size);
+# 151 "/root/repo/src/collections/circular_buffer.h"
+ssize_t circular_buffer_array_two(struct circular_buffer_t *self_p,
+                                  void **buf_pp,
+                                  size_t size);
+# 95 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/kernel/time.h" 1
+# 40 "/root/repo/src/kernel/time.h"
+struct time_t {
+
+    int32_t seconds;
+
+    int32_t nanoseconds;
+};
+
+
+
+
+struct date_t {
+
+    int second;
+
+    int minute;
+
+    int hour;
+
+    int day;
+
+    int date;
+
+    int month;
+
+    int year;
+};
+
+
+
+
+enum time_compare_t {
+    time_compare_less_than_t = 0,
+    time_compare_equal_t = 1,
+    time_compare_greater_than_t = 2
+};
+# 85 "/root/repo/src/kernel/time.h"
+int time_get(struct time_t *now_p);
+# 94 "/root/repo/src/kernel/time.h"
+int time_set(struct time_t *new_p);
+# 106 "/root/repo/src/kernel/time.h"
+int time_add(struct time_t *res_p,
+             struct time_t *left_p,
+             struct time_t *right_p);
+# 120 "/root/repo/src/kernel/time.h"
+int time_subtract(struct time_t *res_p,
+                  struct time_t *left_p,
+                  struct time_t *right_p);
+# 133 "/root/repo/src/kernel/time.h"
+enum time_compare_t time_compare(struct time_t *left_p,
+                                 struct time_t *right_p);
+# 144 "/root/repo/src/kernel/time.h"
+int time_unix_time_to_date(struct date_t *date_p,
+                           struct time_t *time_p);
+# 159 "/root/repo/src/kernel/time.h"
+void time_busy_wait_us(int microseconds);
+# 172 "/root/repo/src/kernel/time.h"
+int time_micros(void);
+# 184 "/root/repo/src/kernel/time.h"
+int time_micros_elapsed(int start, int stop);
+# 194 "/root/repo/src/kernel/time.h"
+int time_micros_resolution(void);
+# 206 "/root/repo/src/kernel/time.h"
+int time_micros_maximum(void);
+# 97 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/sync/sem.h" 1
+# 51 "/root/repo/src/sync/sem.h"
+struct sem_t {
+
+    int count;
+
+    int count_max;
+
+    struct thrd_prio_list_t waiters;
+};
+# 69 "/root/repo/src/sync/sem.h"
+int sem_module_init(void);
+# 84 "/root/repo/src/sync/sem.h"
+int sem_init(struct sem_t *self_p,
+             int count,
+             int count_max);
+# 98 "/root/repo/src/sync/sem.h"
+int sem_take(struct sem_t *self_p,
+             struct time_t *timeout_p);
+# 117 "/root/repo/src/sync/sem.h"
+int sem_give(struct sem_t *self_p,
+             int count);
+# 129 "/root/repo/src/sync/sem.h"
+int sem_give_isr(struct sem_t *self_p,
+                 int count);
+# 99 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/sync/chan.h" 1
+# 76 "/root/repo/src/sync/chan.h"
+typedef ssize_t (*chan_read_fn_t)(void *self_p,
+                                  void *buf_p,
+                                  size_t size);
+# 89 "/root/repo/src/sync/chan.h"
+typedef ssize_t (*chan_write_fn_t)(void *self_p,
+                                   const void *buf_p,
+                                   size_t size);
+# 101 "/root/repo/src/sync/chan.h"
+typedef int (*chan_control_fn_t)(void *self_p,
+                                 int operation);
+# 114 "/root/repo/src/sync/chan.h"
+typedef int (*chan_write_filter_fn_t)(void *self_p,
+                                      const void *buf_p,
+                                      size_t size);
+# 125 "/root/repo/src/sync/chan.h"
+typedef size_t (*chan_size_fn_t)(void *self_p);
+
+struct chan_list_elem_t {
+    struct chan_t *chan_p;
+};
+
+struct chan_list_t {
+    struct chan_list_elem_t *elements_p;
+    size_t number_of_elements;
+    size_t len;
+};
+
+
+
+
+struct chan_t {
+    chan_read_fn_t read;
+    chan_write_fn_t write;
+    chan_size_fn_t size;
+    chan_control_fn_t control;
+    chan_write_filter_fn_t write_filter_cb;
+    chan_write_fn_t write_isr;
+    chan_write_filter_fn_t write_filter_isr_cb;
+
+    struct thrd_t *reader_p;
+
+    struct chan_list_t *list_p;
+};
+# 163 "/root/repo/src/sync/chan.h"
+int chan_module_init(void);
+# 185 "/root/repo/src/sync/chan.h"
+int chan_init(struct chan_t *self_p,
+              chan_read_fn_t read,
+              chan_write_fn_t write,
+              chan_size_fn_t size);
+# 198 "/root/repo/src/sync/chan.h"
+int chan_set_write_cb(struct chan_t *self_p,
+                      chan_write_fn_t write_cb);
+# 209 "/root/repo/src/sync/chan.h"
+int chan_set_write_isr_cb(struct chan_t *self_p,
+                          chan_write_fn_t write_isr_cb);
+# 223 "/root/repo/src/sync/chan.h"
+int chan_set_write_filter_cb(struct chan_t *self_p,
+                             chan_write_filter_fn_t write_filter_cb);
+# 237 "/root/repo/src/sync/chan.h"
+int chan_set_write_filter_isr_cb(struct chan_t *self_p,
+                                 chan_write_filter_fn_t write_filter_isr_cb);
+# 248 "/root/repo/src/sync/chan.h"
+int chan_set_control_cb(struct chan_t *self_p,
+                        chan_control_fn_t control_cb);
+# 262 "/root/repo/src/sync/chan.h"
+ssize_t chan_read(void *self_p,
+                  void *buf_p,
+                  size_t size);
+# 277 "/root/repo/src/sync/chan.h"
+ssize_t chan_write(void *self_p,
+                   const void *buf_p,
+                   size_t size);
+# 291 "/root/repo/src/sync/chan.h"
+int chan_getc(void *self_p);
+# 305 "/root/repo/src/sync/chan.h"
+int chan_putc(void *self_p, int character);
+# 314 "/root/repo/src/sync/chan.h"
+size_t chan_size(void *self_p);
+# 324 "/root/repo/src/sync/chan.h"
+int chan_control(void *self_p, int operation);
+# 338 "/root/repo/src/sync/chan.h"
+ssize_t chan_write_isr(void *self_p,
+                       const void *buf_p,
+                       size_t size);
+# 350 "/root/repo/src/sync/chan.h"
+int chan_is_polled_isr(struct chan_t *self_p);
+# 364 "/root/repo/src/sync/chan.h"
+int chan_list_init(struct chan_list_t *self_p,
+                   struct chan_list_elem_t *elements_p,
+                   size_t number_of_elements);
+# 375 "/root/repo/src/sync/chan.h"
+int chan_list_destroy(struct chan_list_t *self_p);
+# 385 "/root/repo/src/sync/chan.h"
+int chan_list_add(struct chan_list_t *self_p, void *chan_p);
+# 395 "/root/repo/src/sync/chan.h"
+int chan_list_remove(struct chan_list_t *self_p, void *chan_p);
+# 408 "/root/repo/src/sync/chan.h"
+void *chan_list_poll(struct chan_list_t *self_p,
+                     const struct time_t *timeout_p);
+# 421 "/root/repo/src/sync/chan.h"
+void *chan_poll(void *chan_p, const struct time_t *timeout_p);
+
+
+
+
+
+
+
+void *chan_null(void);
+# 441 "/root/repo/src/sync/chan.h"
+ssize_t chan_read_null(void *self_p,
+                       void *buf_p,
+                       size_t size);
+# 455 "/root/repo/src/sync/chan.h"
+ssize_t chan_write_null(void *self_p,
+                        const void *buf_p,
+                        size_t size);
+# 467 "/root/repo/src/sync/chan.h"
+size_t chan_size_null(void *self_p);
+# 478 "/root/repo/src/sync/chan.h"
+int chan_control_null(void *self_p, int operation);
+# 101 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/kernel/sys.h" 1
+# 35 "/root/repo/src/kernel/sys.h"
+# 1 "/root/repo/src/kernel/ports/linux/gnu/sys_port.h" 1
+# 34 "/root/repo/src/kernel/ports/linux/gnu/sys_port.h"
+static inline uint32_t htonl(uint32_t v)
+{
+    return (((v) << 24)
+            | (((v) & 0x0000ff00) << 8)
+            | (((v) & 0x00ff0000) >> 8)
+            | (((v) & 0xff000000) >> 24));
+}
+
+
+
+static inline uint16_t htons(uint16_t v)
+{
+    return (((v) << 8) | (((v) & 0xff00) >> 8));
+}
+# 36 "/root/repo/src/kernel/sys.h" 2
+
+
+
+
+typedef uint32_t sys_tick_t;
+
+
+typedef float cpu_usage_t;
+
+
+
+
+typedef void (*sys_on_fatal_fn_t)(int error);
+
+
+
+
+enum sys_reset_cause_t {
+    sys_reset_cause_unknown_t = 0,
+    sys_reset_cause_power_on_t,
+    sys_reset_cause_watchdog_timeout_t,
+    sys_reset_cause_software_t,
+    sys_reset_cause_external_t,
+    sys_reset_cause_jtag_t,
+
+
+
+    sys_reset_cause_max_t
+};
+
+
+
+
+
+static inline sys_tick_t t2st(const struct time_t *time_p)
+{
+    return (((sys_tick_t)(time_p)->seconds * 100) +
+            ((((((((time_p)->nanoseconds) + (1000) - 1) / 1000) * 100)) + (1000000) - 1) / 1000000)
+                                                               );
+}
+
+
+
+
+static inline void st2t(sys_tick_t tick, struct time_t *time_p)
+{
+    time_p->seconds = (tick / 100);
+    time_p->nanoseconds = (((1000000 * (tick % 100))
+                            / 100) * 1000);
+}
+
+struct sys_t {
+    sys_on_fatal_fn_t on_fatal_callback;
+    void *stdin_p;
+    void *stdout_p;
+
+
+
+
+
+
+};
+
+extern struct sys_t sys;
+# 110 "/root/repo/src/kernel/sys.h"
+int sys_module_init(void);
+# 124 "/root/repo/src/kernel/sys.h"
+int sys_start(void);
+# 133 "/root/repo/src/kernel/sys.h"
+void sys_stop(int error);
+# 148 "/root/repo/src/kernel/sys.h"
+void sys_panic(far_string_t fmt_p, ...);
+
+
+
+
+
+
+void sys_reboot(void);
+# 165 "/root/repo/src/kernel/sys.h"
+int sys_backtrace(void **buf_p, size_t size);
+
+
+
+
+
+
+enum sys_reset_cause_t sys_reset_cause(void);
+# 181 "/root/repo/src/kernel/sys.h"
+int sys_uptime(struct time_t *uptime_p);
+# 191 "/root/repo/src/kernel/sys.h"
+int sys_uptime_isr(struct time_t *uptime_p);
+# 203 "/root/repo/src/kernel/sys.h"
+void sys_set_on_fatal_callback(sys_on_fatal_fn_t callback);
+# 212 "/root/repo/src/kernel/sys.h"
+void sys_set_stdin(void *chan_p);
+
+
+
+
+
+
+void *sys_get_stdin(void);
+# 228 "/root/repo/src/kernel/sys.h"
+void sys_set_stdout(void *chan_p);
+
+
+
+
+
+
+void *sys_get_stdout(void);
+
+
+
+
+
+
+void sys_lock(void);
+
+
+
+
+
+
+void sys_unlock(void);
+
+
+
+
+
+
+void sys_lock_isr(void);
+
+
+
+
+
+
+
+void sys_unlock_isr(void);
+# 274 "/root/repo/src/kernel/sys.h"
+far_string_t sys_get_info(void);
+# 284 "/root/repo/src/kernel/sys.h"
+far_string_t sys_get_config(void);
+
+
+
+
+
+
+cpu_usage_t sys_interrupt_cpu_usage_get(void);
+
+
+
+
+void sys_interrupt_cpu_usage_reset(void);
+
+
+
+
+far_string_t sys_reset_cause_as_string(enum sys_reset_cause_t reset_cause);
+# 102 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/kernel/timer.h" 1
+# 46 "/root/repo/src/kernel/timer.h"
+typedef void (*timer_callback_t)(void *arg_p);
+
+
+struct timer_t {
+    struct timer_t *next_p;
+    uint32_t delta;
+    uint32_t timeout;
+    int flags;
+    timer_callback_t callback;
+    void *arg_p;
+};
+# 67 "/root/repo/src/kernel/timer.h"
+int timer_module_init(void);
+# 87 "/root/repo/src/kernel/timer.h"
+int timer_init(struct timer_t *self_p,
+               const struct time_t *timeout_p,
+               timer_callback_t callback,
+               void *arg_p,
+               int flags);
+# 100 "/root/repo/src/kernel/timer.h"
+int timer_start(struct timer_t *self_p);
+
+
+
+
+
+
+
+int timer_start_isr(struct timer_t *self_p);
+# 121 "/root/repo/src/kernel/timer.h"
+int timer_stop(struct timer_t *self_p);
+
+
+
+
+
+
+
+int timer_stop_isr(struct timer_t *self_p);
+# 103 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/kernel/thrd.h" 1
+# 35 "/root/repo/src/kernel/thrd.h"
+# 1 "/root/repo/src/kernel/ports/linux/gnu/thrd_port.h" 1
+# 34 "/root/repo/src/kernel/ports/linux/gnu/thrd_port.h"
+# 1 "/usr/include/pthread.h" 1 3 4
+# 22 "/usr/include/pthread.h" 3 4
+# 1 "/usr/include/sched.h" 1 3 4
+# 29 "/usr/include/sched.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/sched.h" 2 3 4
+# 43 "/usr/include/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/sched.h" 1 3 4
+# 80 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 1 3 4
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+
+# 23 "/usr/include/x86_64-linux-gnu/bits/types/struct_sched_param.h" 3 4
+struct sched_param
+{
+  int sched_priority;
+};
+# 81 "/usr/include/x86_64-linux-gnu/bits/sched.h" 2 3 4
+
+
+# 102 "/usr/include/x86_64-linux-gnu/bits/sched.h" 3 4
+
+# 44 "/usr/include/sched.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 1 3 4
+# 32 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+typedef unsigned long int __cpu_mask;
+
+
+
+
+
+
+typedef struct
+{
+  __cpu_mask __bits[1024 / (8 * sizeof (__cpu_mask))];
+} cpu_set_t;
+# 115 "/usr/include/x86_64-linux-gnu/bits/cpu-set.h" 3 4
+
+
+extern int __sched_cpucount (size_t __setsize, const cpu_set_t *__setp)
+     __attribute__ ((__nothrow__ , __leaf__));
+extern cpu_set_t *__sched_cpualloc (size_t __count) __attribute__ ((__nothrow__ , __leaf__)) ;
+extern void __sched_cpufree (cpu_set_t *__set) __attribute__ ((__nothrow__ , __leaf__));
+
+
+# 45 "/usr/include/sched.h" 2 3 4
+
+
+
+
+
+
+
+
+
+extern int sched_setparam (__pid_t __pid, const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getparam (__pid_t __pid, struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_setscheduler (__pid_t __pid, int __policy,
+          const struct sched_param *__param) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_getscheduler (__pid_t __pid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_yield (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_max (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int sched_get_priority_min (int __algorithm) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int sched_rr_get_interval (__pid_t __pid, struct timespec *__t) __attribute__ ((__nothrow__ , __leaf__));
+# 138 "/usr/include/sched.h" 3 4
+
+# 23 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/time.h" 1 3 4
+# 29 "/usr/include/time.h" 3 4
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stddef.h" 1 3 4
+# 30 "/usr/include/time.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/time.h" 1 3 4
+# 34 "/usr/include/time.h" 2 3 4
+
+
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_tm.h" 1 3 4
+
+
+
+
+
+
+struct tm
+{
+  int tm_sec;
+  int tm_min;
+  int tm_hour;
+  int tm_mday;
+  int tm_mon;
+  int tm_year;
+  int tm_wday;
+  int tm_yday;
+  int tm_isdst;
+
+
+  long int tm_gmtoff;
+  const char *tm_zone;
+
+
+
+
+};
+# 40 "/usr/include/time.h" 2 3 4
+# 48 "/usr/include/time.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct_itimerspec.h" 1 3 4
+
+
+
+
+
+
+
+struct itimerspec
+  {
+    struct timespec it_interval;
+    struct timespec it_value;
+  };
+# 49 "/usr/include/time.h" 2 3 4
+struct sigevent;
+# 68 "/usr/include/time.h" 3 4
+
+
+
+
+extern clock_t clock (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern time_t time (time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern double difftime (time_t __time1, time_t __time0)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern time_t mktime (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 100 "/usr/include/time.h" 3 4
+extern size_t strftime (char *__restrict __s, size_t __maxsize,
+   const char *__restrict __format,
+   const struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 116 "/usr/include/time.h" 3 4
+extern size_t strftime_l (char *__restrict __s, size_t __maxsize,
+     const char *__restrict __format,
+     const struct tm *__restrict __tp,
+     locale_t __loc) __attribute__ ((__nothrow__ , __leaf__));
+# 132 "/usr/include/time.h" 3 4
+extern struct tm *gmtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 154 "/usr/include/time.h" 3 4
+extern struct tm *gmtime_r (const time_t *__restrict __timer,
+       struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern struct tm *localtime_r (const time_t *__restrict __timer,
+          struct tm *__restrict __tp) __attribute__ ((__nothrow__ , __leaf__));
+# 179 "/usr/include/time.h" 3 4
+extern char *asctime (const struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime (const time_t *__timer) __attribute__ ((__nothrow__ , __leaf__));
+# 197 "/usr/include/time.h" 3 4
+extern char *asctime_r (const struct tm *__restrict __tp,
+   char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern char *ctime_r (const time_t *__restrict __timer,
+        char *__restrict __buf) __attribute__ ((__nothrow__ , __leaf__));
+# 217 "/usr/include/time.h" 3 4
+extern char *__tzname[2];
+extern int __daylight;
+extern long int __timezone;
+
+
+
+
+extern char *tzname[2];
+
+
+
+extern void tzset (void) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int daylight;
+extern long int timezone;
+# 246 "/usr/include/time.h" 3 4
+extern time_t timegm (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+# 263 "/usr/include/time.h" 3 4
+extern time_t timelocal (struct tm *__tp) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+
+
+
+extern int dysize (int __year) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+# 281 "/usr/include/time.h" 3 4
+extern int nanosleep (const struct timespec *__requested_time,
+        struct timespec *__remaining);
+
+
+extern int clock_getres (clockid_t __clock_id, struct timespec *__res) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int clock_gettime (clockid_t __clock_id, struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+
+
+extern int clock_settime (clockid_t __clock_id, const struct timespec *__tp)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 323 "/usr/include/time.h" 3 4
+extern int clock_nanosleep (clockid_t __clock_id, int __flags,
+       const struct timespec *__req,
+       struct timespec *__rem);
+# 338 "/usr/include/time.h" 3 4
+extern int clock_getcpuclockid (pid_t __pid, clockid_t *__clock_id) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+
+extern int timer_create (clockid_t __clock_id,
+    struct sigevent *__restrict __evp,
+    timer_t *__restrict __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_delete (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern int timer_settime (timer_t __timerid, int __flags,
+     const struct itimerspec *__restrict __value,
+     struct itimerspec *__restrict __ovalue) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int timer_gettime (timer_t __timerid, struct itimerspec *__value)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 376 "/usr/include/time.h" 3 4
+extern int timer_getoverrun (timer_t __timerid) __attribute__ ((__nothrow__ , __leaf__));
+# 452 "/usr/include/time.h" 3 4
+
+# 24 "/usr/include/pthread.h" 2 3 4
+
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 27 "/usr/include/x86_64-linux-gnu/bits/setjmp.h" 2 3 4
+
+
+
+
+typedef long int __jmp_buf[8];
+# 28 "/usr/include/pthread.h" 2 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/wordsize.h" 1 3 4
+# 29 "/usr/include/pthread.h" 2 3 4
+
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 1 3 4
+# 26 "/usr/include/x86_64-linux-gnu/bits/types/struct___jmp_buf_tag.h" 3 4
+struct __jmp_buf_tag
+  {
+
+
+
+
+    __jmp_buf __jmpbuf;
+    int __mask_was_saved;
+    __sigset_t __saved_mask;
+  };
+# 32 "/usr/include/pthread.h" 2 3 4
+
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 1 3 4
+# 29 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 3 4
+# 1 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min.h" 1 3 4
+# 30 "/usr/include/x86_64-linux-gnu/bits/pthread_stack_min-dynamic.h" 2 3 4
+# 34 "/usr/include/pthread.h" 2 3 4
+
+
+
+enum
+{
+  PTHREAD_CREATE_JOINABLE,
+
+  PTHREAD_CREATE_DETACHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_ADAPTIVE_NP
+
+  ,
+  PTHREAD_MUTEX_NORMAL = PTHREAD_MUTEX_TIMED_NP,
+  PTHREAD_MUTEX_RECURSIVE = PTHREAD_MUTEX_RECURSIVE_NP,
+  PTHREAD_MUTEX_ERRORCHECK = PTHREAD_MUTEX_ERRORCHECK_NP,
+  PTHREAD_MUTEX_DEFAULT = PTHREAD_MUTEX_NORMAL
+
+
+
+
+
+};
+
+
+
+
+enum
+{
+  PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_STALLED_NP = PTHREAD_MUTEX_STALLED,
+  PTHREAD_MUTEX_ROBUST,
+  PTHREAD_MUTEX_ROBUST_NP = PTHREAD_MUTEX_ROBUST
+};
+
+
+
+
+
+enum
+{
+  PTHREAD_PRIO_NONE,
+  PTHREAD_PRIO_INHERIT,
+  PTHREAD_PRIO_PROTECT
+};
+# 104 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_RWLOCK_PREFER_READER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NP,
+  PTHREAD_RWLOCK_PREFER_WRITER_NONRECURSIVE_NP,
+  PTHREAD_RWLOCK_DEFAULT_NP = PTHREAD_RWLOCK_PREFER_READER_NP
+};
+# 124 "/usr/include/pthread.h" 3 4
+enum
+{
+  PTHREAD_INHERIT_SCHED,
+
+  PTHREAD_EXPLICIT_SCHED
+
+};
+
+
+
+enum
+{
+  PTHREAD_SCOPE_SYSTEM,
+
+  PTHREAD_SCOPE_PROCESS
+
+};
+
+
+
+enum
+{
+  PTHREAD_PROCESS_PRIVATE,
+
+  PTHREAD_PROCESS_SHARED
+
+};
+# 159 "/usr/include/pthread.h" 3 4
+struct _pthread_cleanup_buffer
+{
+  void (*__routine) (void *);
+  void *__arg;
+  int __canceltype;
+  struct _pthread_cleanup_buffer *__prev;
+};
+
+
+enum
+{
+  PTHREAD_CANCEL_ENABLE,
+
+  PTHREAD_CANCEL_DISABLE
+
+};
+enum
+{
+  PTHREAD_CANCEL_DEFERRED,
+
+  PTHREAD_CANCEL_ASYNCHRONOUS
+
+};
+# 197 "/usr/include/pthread.h" 3 4
+
+
+
+
+
+extern int pthread_create (pthread_t *__restrict __newthread,
+      const pthread_attr_t *__restrict __attr,
+      void *(*__start_routine) (void *),
+      void *__restrict __arg) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+
+extern void pthread_exit (void *__retval) __attribute__ ((__noreturn__));
+
+
+
+
+
+
+
+extern int pthread_join (pthread_t __th, void **__thread_return);
+# 269 "/usr/include/pthread.h" 3 4
+extern int pthread_detach (pthread_t __th) __attribute__ ((__nothrow__ , __leaf__));
+
+
+
+extern pthread_t pthread_self (void) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+extern int pthread_equal (pthread_t __thread1, pthread_t __thread2)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__const__));
+
+
+
+
+
+
+
+extern int pthread_attr_init (pthread_attr_t *__attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_destroy (pthread_attr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getdetachstate (const pthread_attr_t *__attr,
+     int *__detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setdetachstate (pthread_attr_t *__attr,
+     int __detachstate)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getguardsize (const pthread_attr_t *__attr,
+          size_t *__guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setguardsize (pthread_attr_t *__attr,
+          size_t __guardsize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getschedparam (const pthread_attr_t *__restrict __attr,
+           struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedparam (pthread_attr_t *__restrict __attr,
+           const struct sched_param *__restrict
+           __param) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_getschedpolicy (const pthread_attr_t *__restrict
+     __attr, int *__restrict __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setschedpolicy (pthread_attr_t *__attr, int __policy)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getinheritsched (const pthread_attr_t *__restrict
+      __attr, int *__restrict __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setinheritsched (pthread_attr_t *__attr,
+      int __inherit)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getscope (const pthread_attr_t *__restrict __attr,
+      int *__restrict __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_attr_setscope (pthread_attr_t *__attr, int __scope)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_attr_getstackaddr (const pthread_attr_t *__restrict
+          __attr, void **__restrict __stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2))) __attribute__ ((__deprecated__));
+
+
+
+
+
+extern int pthread_attr_setstackaddr (pthread_attr_t *__attr,
+          void *__stackaddr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1))) __attribute__ ((__deprecated__));
+
+
+extern int pthread_attr_getstacksize (const pthread_attr_t *__restrict
+          __attr, size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_attr_setstacksize (pthread_attr_t *__attr,
+          size_t __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_attr_getstack (const pthread_attr_t *__restrict __attr,
+      void **__restrict __stackaddr,
+      size_t *__restrict __stacksize)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2, 3)));
+
+
+
+
+extern int pthread_attr_setstack (pthread_attr_t *__attr, void *__stackaddr,
+      size_t __stacksize) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 441 "/usr/include/pthread.h" 3 4
+extern int pthread_setschedparam (pthread_t __target_thread, int __policy,
+      const struct sched_param *__param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (3)));
+
+
+extern int pthread_getschedparam (pthread_t __target_thread,
+      int *__restrict __policy,
+      struct sched_param *__restrict __param)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2, 3)));
+
+
+extern int pthread_setschedprio (pthread_t __target_thread, int __prio)
+     __attribute__ ((__nothrow__ , __leaf__));
+# 509 "/usr/include/pthread.h" 3 4
+extern int pthread_once (pthread_once_t *__once_control,
+    void (*__init_routine) (void)) __attribute__ ((__nonnull__ (1, 2)));
+# 521 "/usr/include/pthread.h" 3 4
+extern int pthread_setcancelstate (int __state, int *__oldstate);
+
+
+
+extern int pthread_setcanceltype (int __type, int *__oldtype);
+
+
+extern int pthread_cancel (pthread_t __th);
+
+
+
+
+extern void pthread_testcancel (void);
+
+
+
+
+struct __cancel_jmp_buf_tag
+{
+  __jmp_buf __cancel_jmp_buf;
+  int __mask_was_saved;
+};
+
+typedef struct
+{
+  struct __cancel_jmp_buf_tag __cancel_jmp_buf[1];
+  void *__pad[4];
+} __pthread_unwind_buf_t __attribute__ ((__aligned__));
+# 557 "/usr/include/pthread.h" 3 4
+struct __pthread_cleanup_frame
+{
+  void (*__cancel_routine) (void *);
+  void *__cancel_arg;
+  int __do_it;
+  int __cancel_type;
+};
+# 697 "/usr/include/pthread.h" 3 4
+extern void __pthread_register_cancel (__pthread_unwind_buf_t *__buf)
+     ;
+# 709 "/usr/include/pthread.h" 3 4
+extern void __pthread_unregister_cancel (__pthread_unwind_buf_t *__buf)
+  ;
+# 750 "/usr/include/pthread.h" 3 4
+extern void __pthread_unwind_next (__pthread_unwind_buf_t *__buf)
+     __attribute__ ((__noreturn__))
+
+     __attribute__ ((__weak__))
+
+     ;
+# 766 "/usr/include/pthread.h" 3 4
+extern int __sigsetjmp_cancel (struct __cancel_jmp_buf_tag __env[1], int __savemask) __asm__ ("" "__sigsetjmp") __attribute__ ((__nothrow__))
+
+
+                     __attribute__ ((__returns_twice__));
+# 781 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_init (pthread_mutex_t *__mutex,
+          const pthread_mutexattr_t *__mutexattr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_destroy (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_trylock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutex_lock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_mutex_timedlock (pthread_mutex_t *__restrict __mutex,
+        const struct timespec *__restrict
+        __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 835 "/usr/include/pthread.h" 3 4
+extern int pthread_mutex_unlock (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutex_getprioceiling (const pthread_mutex_t *
+      __restrict __mutex,
+      int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutex_setprioceiling (pthread_mutex_t *__restrict __mutex,
+      int __prioceiling,
+      int *__restrict __old_ceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 3)));
+
+
+
+
+extern int pthread_mutex_consistent (pthread_mutex_t *__mutex)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 874 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_init (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_destroy (pthread_mutexattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getpshared (const pthread_mutexattr_t *
+      __restrict __attr,
+      int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setpshared (pthread_mutexattr_t *__attr,
+      int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_gettype (const pthread_mutexattr_t *__restrict
+          __attr, int *__restrict __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+
+extern int pthread_mutexattr_settype (pthread_mutexattr_t *__attr, int __kind)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getprotocol (const pthread_mutexattr_t *
+       __restrict __attr,
+       int *__restrict __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+
+extern int pthread_mutexattr_setprotocol (pthread_mutexattr_t *__attr,
+       int __protocol)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_mutexattr_getprioceiling (const pthread_mutexattr_t *
+          __restrict __attr,
+          int *__restrict __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_mutexattr_setprioceiling (pthread_mutexattr_t *__attr,
+          int __prioceiling)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_mutexattr_getrobust (const pthread_mutexattr_t *__attr,
+     int *__robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+# 946 "/usr/include/pthread.h" 3 4
+extern int pthread_mutexattr_setrobust (pthread_mutexattr_t *__attr,
+     int __robustness)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 967 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_init (pthread_rwlock_t *__restrict __rwlock,
+    const pthread_rwlockattr_t *__restrict
+    __attr) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_destroy (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_rdlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_tryrdlock (pthread_rwlock_t *__rwlock)
+  __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedrdlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1023 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_wrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlock_trywrlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+extern int pthread_rwlock_timedwrlock (pthread_rwlock_t *__restrict __rwlock,
+           const struct timespec *__restrict
+           __abstime) __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1, 2)));
+# 1071 "/usr/include/pthread.h" 3 4
+extern int pthread_rwlock_unlock (pthread_rwlock_t *__rwlock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+extern int pthread_rwlockattr_init (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_destroy (pthread_rwlockattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getpshared (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setpshared (pthread_rwlockattr_t *__attr,
+       int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_rwlockattr_getkind_np (const pthread_rwlockattr_t *
+       __restrict __attr,
+       int *__restrict __pref)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_rwlockattr_setkind_np (pthread_rwlockattr_t *__attr,
+       int __pref) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+
+extern int pthread_cond_init (pthread_cond_t *__restrict __cond,
+         const pthread_condattr_t *__restrict __cond_attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_destroy (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_signal (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_cond_broadcast (pthread_cond_t *__cond)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_cond_wait (pthread_cond_t *__restrict __cond,
+         pthread_mutex_t *__restrict __mutex)
+     __attribute__ ((__nonnull__ (1, 2)));
+# 1145 "/usr/include/pthread.h" 3 4
+extern int pthread_cond_timedwait (pthread_cond_t *__restrict __cond,
+       pthread_mutex_t *__restrict __mutex,
+       const struct timespec *__restrict __abstime)
+     __attribute__ ((__nonnull__ (1, 2, 3)));
+# 1194 "/usr/include/pthread.h" 3 4
+extern int pthread_condattr_init (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_destroy (pthread_condattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_condattr_getpshared (const pthread_condattr_t *
+     __restrict __attr,
+     int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setpshared (pthread_condattr_t *__attr,
+     int __pshared) __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_condattr_getclock (const pthread_condattr_t *
+          __restrict __attr,
+          __clockid_t *__restrict __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_condattr_setclock (pthread_condattr_t *__attr,
+          __clockid_t __clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1230 "/usr/include/pthread.h" 3 4
+extern int pthread_spin_init (pthread_spinlock_t *__lock, int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_destroy (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_lock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_trylock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_spin_unlock (pthread_spinlock_t *__lock)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+
+
+
+extern int pthread_barrier_init (pthread_barrier_t *__restrict __barrier,
+     const pthread_barrierattr_t *__restrict
+     __attr, unsigned int __count)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_destroy (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrier_wait (pthread_barrier_t *__barrier)
+     __attribute__ ((__nothrow__)) __attribute__ ((__nonnull__ (1)));
+
+
+
+extern int pthread_barrierattr_init (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_destroy (pthread_barrierattr_t *__attr)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_barrierattr_getpshared (const pthread_barrierattr_t *
+        __restrict __attr,
+        int *__restrict __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1, 2)));
+
+
+extern int pthread_barrierattr_setpshared (pthread_barrierattr_t *__attr,
+        int __pshared)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+# 1297 "/usr/include/pthread.h" 3 4
+extern int pthread_key_create (pthread_key_t *__key,
+          void (*__destr_function) (void *))
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (1)));
+
+
+extern int pthread_key_delete (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern void *pthread_getspecific (pthread_key_t __key) __attribute__ ((__nothrow__ , __leaf__));
+
+
+extern int pthread_setspecific (pthread_key_t __key,
+    const void *__pointer)
+  __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__access__ (__none__, 2)));
+
+
+
+
+extern int pthread_getcpuclockid (pthread_t __thread_id,
+      __clockid_t *__clock_id)
+     __attribute__ ((__nothrow__ , __leaf__)) __attribute__ ((__nonnull__ (2)));
+# 1332 "/usr/include/pthread.h" 3 4
+extern int pthread_atfork (void (*__prepare) (void),
+      void (*__parent) (void),
+      void (*__child) (void)) __attribute__ ((__nothrow__ , __leaf__));
+# 1346 "/usr/include/pthread.h" 3 4
+
+# 35 "/root/repo/src/kernel/ports/linux/gnu/thrd_port.h" 2
+
+
+
+
+
+
+
+
+# 42 "/root/repo/src/kernel/ports/linux/gnu/thrd_port.h"
+struct thrd_port_t {
+    void *arg_p;
+    pthread_t thrd;
+    pthread_mutex_t mutex;
+    pthread_cond_t cond;
+    void *(*main)(void *arg);
+    void *arg;
+};
+# 36 "/root/repo/src/kernel/thrd.h" 2
+# 76 "/root/repo/src/kernel/thrd.h"
+struct thrd_environment_variable_t {
+    const char *name_p;
+    const char *value_p;
+};
+
+struct thrd_environment_t {
+    struct thrd_environment_variable_t *variables_p;
+    size_t number_of_variables;
+    size_t max_number_of_variables;
+};
+
+struct thrd_t {
+    struct {
+        struct thrd_prio_list_elem_t elem;
+    } scheduler;
+    struct thrd_port_t port;
+    int8_t prio;
+    int8_t state;
+    int err;
+    uint8_t log_mask;
+    struct timer_t *timer_p;
+    const char *name_p;
+    struct thrd_t *next_p;
+
+
+
+    struct {
+# 115 "/root/repo/src/kernel/thrd.h"
+    } statistics;
+
+
+
+    size_t stack_size;
+
+    uint16_t stack_low_magic;
+
+};
+# 134 "/root/repo/src/kernel/thrd.h"
+int thrd_module_init(void);
+# 154 "/root/repo/src/kernel/thrd.h"
+struct thrd_t *thrd_spawn(void *(*main)(void *),
+                          void *arg_p,
+                          int prio,
+                          void *stack_p,
+                          size_t stack_size);
+# 169 "/root/repo/src/kernel/thrd.h"
+int thrd_suspend(const struct time_t *timeout_p);
+# 182 "/root/repo/src/kernel/thrd.h"
+int thrd_resume(struct thrd_t *thrd_p, int err);
+# 194 "/root/repo/src/kernel/thrd.h"
+int thrd_yield(void);
+# 203 "/root/repo/src/kernel/thrd.h"
+int thrd_join(struct thrd_t *thrd_p);
+# 213 "/root/repo/src/kernel/thrd.h"
+int thrd_terminate(struct thrd_t *thrd_p);
+# 222 "/root/repo/src/kernel/thrd.h"
+int thrd_sleep(float seconds);
+# 231 "/root/repo/src/kernel/thrd.h"
+int thrd_sleep_ms(int milliseconds);
+# 240 "/root/repo/src/kernel/thrd.h"
+int thrd_sleep_us(long microseconds);
+
+
+
+
+
+
+struct thrd_t *thrd_self(void);
+# 256 "/root/repo/src/kernel/thrd.h"
+int thrd_set_name(const char *name_p);
+
+
+
+
+
+
+const char *thrd_get_name(void);
+
+
+
+
+
+
+struct thrd_t *thrd_get_by_name(const char *name_p);
+# 280 "/root/repo/src/kernel/thrd.h"
+int thrd_set_log_mask(struct thrd_t *thrd_p, int mask);
+
+
+
+
+
+
+int thrd_get_log_mask(void);
+# 297 "/root/repo/src/kernel/thrd.h"
+int thrd_set_prio(struct thrd_t *thrd_p, int prio);
+
+
+
+
+
+
+int thrd_get_prio(void);
+# 315 "/root/repo/src/kernel/thrd.h"
+int thrd_init_global_env(struct thrd_environment_variable_t *variables_p,
+                         int length);
+# 328 "/root/repo/src/kernel/thrd.h"
+int thrd_set_global_env(const char *name_p, const char *value_p);
+# 339 "/root/repo/src/kernel/thrd.h"
+const char *thrd_get_global_env(const char *name_p);
+# 349 "/root/repo/src/kernel/thrd.h"
+int thrd_init_env(struct thrd_environment_variable_t *variables_p,
+                  int length);
+# 363 "/root/repo/src/kernel/thrd.h"
+int thrd_set_env(const char *name_p, const char *value_p);
+# 375 "/root/repo/src/kernel/thrd.h"
+const char *thrd_get_env(const char *name_p);
+# 387 "/root/repo/src/kernel/thrd.h"
+int thrd_suspend_isr(const struct time_t *timeout_p);
+# 401 "/root/repo/src/kernel/thrd.h"
+int thrd_resume_isr(struct thrd_t *thrd_p, int err);
+
+
+
+
+
+
+
+int thrd_yield_isr(void);
+
+
+
+
+
+
+void *thrd_stack_alloc(size_t size);
+
+
+
+
+
+
+int thrd_stack_free(void *stack_p);
+
+
+
+
+
+
+
+const void *thrd_get_bottom_of_stack(struct thrd_t *thrd_p);
+
+
+
+
+
+
+
+const void *thrd_get_top_of_stack(struct thrd_t *thrd_p);
+
+
+
+
+int thrd_prio_list_init(struct thrd_prio_list_t *self_p);
+# 457 "/root/repo/src/kernel/thrd.h"
+void thrd_prio_list_push_isr(struct thrd_prio_list_t *self_p,
+                             struct thrd_prio_list_elem_t *elem_p);
+# 467 "/root/repo/src/kernel/thrd.h"
+struct thrd_prio_list_elem_t *thrd_prio_list_pop_isr(
+    struct thrd_prio_list_t *self_p);
+# 478 "/root/repo/src/kernel/thrd.h"
+int thrd_prio_list_remove_isr(struct thrd_prio_list_t *self_p,
+                              struct thrd_prio_list_elem_t *elem_p);
+# 104 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/sync/mutex.h" 1
+# 36 "/root/repo/src/sync/mutex.h"
+struct mutex_t {
+
+    int8_t is_locked;
+
+    struct thrd_prio_list_t waiters;
+};
+# 52 "/root/repo/src/sync/mutex.h"
+int mutex_module_init(void);
+# 61 "/root/repo/src/sync/mutex.h"
+int mutex_init(struct mutex_t *self_p);
+# 70 "/root/repo/src/sync/mutex.h"
+int mutex_lock(struct mutex_t *self_p);
+# 79 "/root/repo/src/sync/mutex.h"
+int mutex_unlock(struct mutex_t *self_p);
+# 88 "/root/repo/src/sync/mutex.h"
+int mutex_lock_isr(struct mutex_t *self_p);
+# 97 "/root/repo/src/sync/mutex.h"
+int mutex_unlock_isr(struct mutex_t *self_p);
+# 106 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/sync/cond.h" 1
+# 36 "/root/repo/src/sync/cond.h"
+struct cond_t {
+
+    struct thrd_prio_list_t waiters;
+};
+# 50 "/root/repo/src/sync/cond.h"
+int cond_module_init(void);
+# 59 "/root/repo/src/sync/cond.h"
+int cond_init(struct cond_t *self_p);
+# 71 "/root/repo/src/sync/cond.h"
+int cond_wait(struct cond_t *self_p,
+              struct mutex_t *mutex_p,
+              struct time_t *timeout_p);
+# 85 "/root/repo/src/sync/cond.h"
+int cond_signal(struct cond_t *self_p);
+# 94 "/root/repo/src/sync/cond.h"
+int cond_broadcast(struct cond_t *self_p);
+# 107 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/sync/queue.h" 1
+# 68 "/root/repo/src/sync/queue.h"
+enum queue_state_t {
+
+    QUEUE_STATE_INITIALIZED = 0,
+
+
+    QUEUE_STATE_RUNNING,
+
+
+    QUEUE_STATE_STOPPED,
+};
+
+
+struct queue_t {
+    struct chan_t base;
+    struct thrd_prio_list_t writers;
+    struct queue_writer_elem_t *writer_p;
+    struct {
+        char *buf_p;
+        size_t size;
+        size_t left;
+    } reader;
+    void *buf_p;
+    struct circular_buffer_t buffer;
+    enum queue_state_t state;
+    int flags;
+};
+# 107 "/root/repo/src/sync/queue.h"
+int queue_init(struct queue_t *self_p,
+               void *buf_p,
+               size_t size);
+# 119 "/root/repo/src/sync/queue.h"
+int queue_start(struct queue_t *self_p);
+# 131 "/root/repo/src/sync/queue.h"
+int queue_stop(struct queue_t *self_p);
+
+
+
+
+
+
+int queue_stop_isr(struct queue_t *self_p);
+# 149 "/root/repo/src/sync/queue.h"
+ssize_t queue_read(struct queue_t *self_p,
+                   void *buf_p,
+                   size_t size);
+# 163 "/root/repo/src/sync/queue.h"
+ssize_t queue_write(struct queue_t *self_p,
+                    const void *buf_p,
+                    size_t size);
+# 177 "/root/repo/src/sync/queue.h"
+ssize_t queue_write_isr(struct queue_t *self_p,
+                        const void *buf_p,
+                        size_t size);
+# 189 "/root/repo/src/sync/queue.h"
+ssize_t queue_size(struct queue_t *self_p);
+# 198 "/root/repo/src/sync/queue.h"
+ssize_t queue_unused_size(struct queue_t *self_p);
+# 208 "/root/repo/src/sync/queue.h"
+ssize_t queue_unused_size_isr(struct queue_t *self_p);
+# 218 "/root/repo/src/sync/queue.h"
+ssize_t queue_ignore(struct queue_t *self_p,
+                     size_t size);
+# 108 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/sync/event.h" 1
+# 39 "/root/repo/src/sync/event.h"
+struct event_t {
+    struct chan_t base;
+    uint32_t mask;
+    uint32_t reader_mask;
+};
+# 52 "/root/repo/src/sync/event.h"
+int event_init(struct event_t *self_p);
+# 69 "/root/repo/src/sync/event.h"
+ssize_t event_read(struct event_t *self_p,
+                   void *buf_p,
+                   size_t size);
+# 88 "/root/repo/src/sync/event.h"
+ssize_t event_try_read(struct event_t *self_p,
+                       void *buf_p,
+                       size_t size);
+# 101 "/root/repo/src/sync/event.h"
+ssize_t event_write(struct event_t *self_p,
+                    const void *buf_p,
+                    size_t size);
+# 115 "/root/repo/src/sync/event.h"
+ssize_t event_write_isr(struct event_t *self_p,
+                        const void *buf_p,
+                        size_t size);
+# 127 "/root/repo/src/sync/event.h"
+ssize_t event_size(struct event_t *self_p);
+# 137 "/root/repo/src/sync/event.h"
+int event_clear(struct event_t *self_p, uint32_t mask);
+# 109 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/sync/rwlock.h" 1
+# 36 "/root/repo/src/sync/rwlock.h"
+struct rwlock_t {
+    int number_of_readers;
+    int number_of_writers;
+    volatile struct rwlock_elem_t *readers_p;
+    volatile struct rwlock_elem_t *writers_p;
+};
+# 52 "/root/repo/src/sync/rwlock.h"
+int rwlock_module_init(void);
+# 61 "/root/repo/src/sync/rwlock.h"
+int rwlock_init(struct rwlock_t *self_p);
+# 71 "/root/repo/src/sync/rwlock.h"
+int rwlock_reader_take(struct rwlock_t *self_p);
+# 80 "/root/repo/src/sync/rwlock.h"
+int rwlock_reader_give(struct rwlock_t *self_p);
+# 90 "/root/repo/src/sync/rwlock.h"
+int rwlock_reader_give_isr(struct rwlock_t *self_p);
+# 100 "/root/repo/src/sync/rwlock.h"
+int rwlock_writer_take(struct rwlock_t *self_p);
+# 109 "/root/repo/src/sync/rwlock.h"
+int rwlock_writer_give(struct rwlock_t *self_p);
+# 119 "/root/repo/src/sync/rwlock.h"
+int rwlock_writer_give_isr(struct rwlock_t *self_p);
+# 110 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/sync/bus.h" 1
+# 36 "/root/repo/src/sync/bus.h"
+struct bus_t {
+    struct rwlock_t rwlock;
+    struct binary_tree_t listeners;
+};
+
+struct bus_listener_t {
+    struct binary_tree_node_t base;
+    int id;
+    void *chan_p;
+    struct bus_listener_t *next_p;
+};
+# 57 "/root/repo/src/sync/bus.h"
+int bus_module_init(void);
+# 66 "/root/repo/src/sync/bus.h"
+int bus_init(struct bus_t *self_p);
+# 80 "/root/repo/src/sync/bus.h"
+int bus_listener_init(struct bus_listener_t *self_p,
+                      int id,
+                      void *chan_p);
+# 94 "/root/repo/src/sync/bus.h"
+int bus_attach(struct bus_t *self_p,
+               struct bus_listener_t *listener_p);
+# 106 "/root/repo/src/sync/bus.h"
+int bus_detach(struct bus_t *self_p,
+               struct bus_listener_t *listener_p);
+# 122 "/root/repo/src/sync/bus.h"
+int bus_write(struct bus_t *self_p,
+              int id,
+              const void *buf_p,
+              size_t size);
+# 111 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/alloc/heap.h" 1
+# 41 "/root/repo/src/alloc/heap.h"
+struct heap_fixed_t {
+    void *free_p;
+    size_t size;
+};
+
+struct heap_dynamic_t {
+    void *free_p;
+};
+
+
+
+
+struct heap_t {
+    void *buf_p;
+    size_t size;
+    void *next_p;
+    struct heap_fixed_t fixed[8];
+    struct heap_dynamic_t dynamic;
+    struct mutex_t mutex;
+
+    struct {
+        uint32_t allocs;
+        uint32_t frees;
+    } statistics;
+};
+# 76 "/root/repo/src/alloc/heap.h"
+int heap_init(struct heap_t *self_p,
+              void *buf_p,
+              size_t size,
+              size_t sizes[8]);
+# 93 "/root/repo/src/alloc/heap.h"
+void *heap_alloc(struct heap_t *self_p,
+                 size_t size);
+# 105 "/root/repo/src/alloc/heap.h"
+int heap_free(struct heap_t *self_p,
+              void *buf_p);
+# 117 "/root/repo/src/alloc/heap.h"
+int heap_share(struct heap_t *self_p,
+               const void *buf_p,
+               int count);
+# 113 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/alloc/circular_heap.h" 1
+# 37 "/root/repo/src/alloc/circular_heap.h"
+struct circular_heap_t {
+    void *begin_p;
+    void *end_p;
+    void *alloc_p;
+    void *free_p;
+};
+# 54 "/root/repo/src/alloc/circular_heap.h"
+int circular_heap_init(struct circular_heap_t *self_p,
+                       void *buf_p,
+                       size_t size);
+# 67 "/root/repo/src/alloc/circular_heap.h"
+void *circular_heap_alloc(struct circular_heap_t *self_p,
+                          size_t size);
+# 80 "/root/repo/src/alloc/circular_heap.h"
+int circular_heap_free(struct circular_heap_t *self_p,
+                       void *buf_p);
+# 114 "/root/repo/src/simba.h" 2
+
+
+
+
+# 1 "/root/repo/src/filesystems/spiffs.h" 1
+# 43 "/root/repo/src/filesystems/spiffs.h"
+# 1 "/root/repo/3pp/compat/spiffs/config.h" 1
+# 234 "/root/repo/3pp/compat/spiffs/config.h"
+typedef uint16_t spiffs_block_ix_t;
+
+
+
+
+typedef uint16_t spiffs_page_ix_t;
+
+
+
+
+
+typedef uint16_t spiffs_obj_id_t;
+
+
+
+
+typedef uint16_t spiffs_span_ix_t;
+# 44 "/root/repo/src/filesystems/spiffs.h" 2
+# 93 "/root/repo/src/filesystems/spiffs.h"
+typedef int16_t spiffs_file_t;
+
+typedef uint16_t spiffs_flags_t;
+
+typedef uint16_t spiffs_mode_t;
+
+typedef uint8_t spiffs_obj_type_t;
+
+struct spiffs_t;
+
+
+
+
+typedef int32_t (*spiffs_read_cb_t)(struct spiffs_t *fs_p,
+                                    uint32_t addr,
+                                    uint32_t size,
+                                    uint8_t *dst_p);
+
+typedef int32_t (*spiffs_write_cb_t)(struct spiffs_t *fs_p,
+                                     uint32_t addr,
+                                     uint32_t size,
+                                     uint8_t *src_p);
+
+typedef int32_t (*spiffs_erase_cb_t)(struct spiffs_t *fs_p,
+                                     uint32_t addr,
+                                     uint32_t size);
+# 136 "/root/repo/src/filesystems/spiffs.h"
+enum spiffs_check_type_t {
+    SPIFFS_CHECK_LOOKUP = 0,
+    SPIFFS_CHECK_INDEX,
+    SPIFFS_CHECK_PAGE
+};
+
+
+enum spiffs_check_report_t {
+    SPIFFS_CHECK_PROGRESS = 0,
+    SPIFFS_CHECK_ERROR,
+    SPIFFS_CHECK_FIX_INDEX,
+    SPIFFS_CHECK_FIX_LOOKUP,
+    SPIFFS_CHECK_DELETE_ORPHANED_INDEX,
+    SPIFFS_CHECK_DELETE_PAGE,
+    SPIFFS_CHECK_DELETE_BAD_FILE
+};
+
+
+
+typedef void (*spiffs_check_callback_t)(struct spiffs_t *fs_p,
+                                        enum spiffs_check_type_t type,
+                                        enum spiffs_check_report_t report,
+                                        uint32_t arg1,
+                                        uint32_t arg2);
+# 168 "/root/repo/src/filesystems/spiffs.h"
+enum spiffs_fileop_type_t {
+
+    SPIFFS_CB_CREATED = 0,
+
+    SPIFFS_CB_UPDATED,
+
+    SPIFFS_CB_DELETED
+};
+
+
+typedef void (*spiffs_file_callback_t)(struct spiffs_t *fs_p,
+                                       enum spiffs_fileop_type_t op,
+                                       spiffs_obj_id_t obj_id,
+                                       spiffs_page_ix_t pix);
+# 244 "/root/repo/src/filesystems/spiffs.h"
+struct spiffs_config_t {
+
+    spiffs_read_cb_t hal_read_f;
+
+    spiffs_write_cb_t hal_write_f;
+
+    spiffs_erase_cb_t hal_erase_f;
+
+
+    uint32_t phys_size;
+
+
+    uint32_t phys_addr;
+
+    uint32_t phys_erase_block;
+
+
+
+    uint32_t log_block_size;
+
+
+    uint32_t log_page_size;
+
+
+
+
+
+
+};
+
+struct spiffs_t {
+
+    struct spiffs_config_t cfg;
+
+    uint32_t block_count;
+
+
+    spiffs_block_ix_t free_cursor_block_ix;
+
+    int free_cursor_obj_lu_entry;
+
+    spiffs_block_ix_t cursor_block_ix;
+
+    int cursor_obj_lu_entry;
+
+
+    uint8_t *lu_work;
+
+    uint8_t *work;
+
+    uint8_t *fd_space;
+
+    uint32_t fd_count;
+
+
+    int32_t err_code;
+
+
+    uint32_t free_blocks;
+
+    uint32_t stats_p_allocated;
+
+    uint32_t stats_p_deleted;
+
+    uint8_t cleaning;
+
+    spiffs_obj_id_t max_erase_count;
+
+
+    uint32_t stats_gc_runs;
+
+
+
+
+    void *cache;
+
+    uint32_t cache_size;
+
+    uint32_t cache_hits;
+    uint32_t cache_misses;
+
+
+
+
+    spiffs_check_callback_t check_cb_f;
+
+    spiffs_file_callback_t file_cb_f;
+
+    uint8_t mounted;
+
+    void *user_data;
+
+    uint32_t config_magic;
+};
+
+
+struct spiffs_stat_t {
+    spiffs_obj_id_t obj_id;
+    uint32_t size;
+    spiffs_obj_type_t type;
+    spiffs_page_ix_t pix;
+    uint8_t name[(32)];
+};
+
+struct spiffs_dirent_t {
+    spiffs_obj_id_t obj_id;
+    uint8_t name[(32)];
+    spiffs_obj_type_t type;
+    uint32_t size;
+    spiffs_page_ix_t pix;
+};
+
+struct spiffs_dir_t {
+    struct spiffs_t *fs;
+    spiffs_block_ix_t block;
+    int entry;
+};
+# 424 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_mount(struct spiffs_t *self_p,
+                     struct spiffs_config_t *config_p,
+                     uint8_t *work_p,
+                     uint8_t *fd_space_p,
+                     uint32_t fd_space_size,
+                     void *cache_p,
+                     uint32_t cache_size,
+                     spiffs_check_callback_t check_cb);
+# 441 "/root/repo/src/filesystems/spiffs.h"
+void spiffs_unmount(struct spiffs_t *self_p);
+# 452 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_creat(struct spiffs_t *self_p,
+                     const char *path_p,
+                     spiffs_mode_t mode);
+# 467 "/root/repo/src/filesystems/spiffs.h"
+spiffs_file_t spiffs_open(struct spiffs_t *self_p,
+                          const char *path_p,
+                          spiffs_flags_t flags,
+                          spiffs_mode_t mode);
+# 489 "/root/repo/src/filesystems/spiffs.h"
+spiffs_file_t spiffs_open_by_dirent(struct spiffs_t *self_p,
+                                    struct spiffs_dirent_t *ent_p,
+                                    spiffs_flags_t flags,
+                                    spiffs_mode_t mode);
+# 510 "/root/repo/src/filesystems/spiffs.h"
+spiffs_file_t spiffs_open_by_page(struct spiffs_t *self_p,
+                                  spiffs_page_ix_t page_ix,
+                                  spiffs_flags_t flags,
+                                  spiffs_mode_t mode);
+# 525 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_read(struct spiffs_t *self_p,
+                    spiffs_file_t fh,
+                    void *buf_p,
+                    int32_t len);
+# 540 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_write(struct spiffs_t *self_p,
+                     spiffs_file_t fh,
+                     void *buf_p,
+                     int32_t len);
+# 566 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_lseek(struct spiffs_t *self_p,
+                     spiffs_file_t fh,
+                     int32_t offs,
+                     int whence);
+# 579 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_remove(struct spiffs_t *self_p,
+                      const char *path_p);
+# 590 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_fremove(struct spiffs_t *self_p,
+                       spiffs_file_t fh);
+# 602 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_stat(struct spiffs_t *self_p,
+                    const char *path_p,
+                    struct spiffs_stat_t *stat_p);
+# 615 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_fstat(struct spiffs_t *self_p,
+                     spiffs_file_t fh,
+                     struct spiffs_stat_t *stat_p);
+# 627 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_fflush(struct spiffs_t *self_p,
+                      spiffs_file_t fh);
+# 639 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_close(struct spiffs_t *self_p,
+                     spiffs_file_t fh);
+# 651 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_rename(struct spiffs_t *self_p,
+                      const char *old_path_p,
+                      const char *new_path_p);
+# 662 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_errno(struct spiffs_t *self_p);
+# 671 "/root/repo/src/filesystems/spiffs.h"
+void spiffs_clearerr(struct spiffs_t *self_p);
+# 683 "/root/repo/src/filesystems/spiffs.h"
+struct spiffs_dir_t *spiffs_opendir(struct spiffs_t *self_p,
+                                    const char *name_p,
+                                    struct spiffs_dir_t *dir_p);
+# 694 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_closedir(struct spiffs_dir_t *dir_p);
+# 705 "/root/repo/src/filesystems/spiffs.h"
+struct spiffs_dirent_t *spiffs_readdir(struct spiffs_dir_t *dir_p,
+                                       struct spiffs_dirent_t *ent_p);
+# 715 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_check(struct spiffs_t *self_p);
+# 733 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_info(struct spiffs_t *self_p,
+                    uint32_t *total_p,
+                    uint32_t *used_p);
+# 752 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_format(struct spiffs_t *self_p);
+
+
+
+
+
+
+uint8_t spiffs_mounted(struct spiffs_t *self_p);
+# 788 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_gc_quick(struct spiffs_t *self_p,
+                        uint16_t max_free_pages);
+# 810 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_gc(struct spiffs_t *self_p,
+                  uint32_t size);
+# 821 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_eof(struct spiffs_t *self_p,
+                   spiffs_file_t fh);
+# 832 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_tell(struct spiffs_t *self_p,
+                    spiffs_file_t fh);
+# 851 "/root/repo/src/filesystems/spiffs.h"
+int32_t spiffs_set_file_callback_func(struct spiffs_t *self_p,
+                                      spiffs_file_callback_t cb_func);
+# 870 "/root/repo/src/filesystems/spiffs.h"
+uint32_t spiffs_buffer_bytes_for_filedescs(struct spiffs_t *self_p,
+                                           uint32_t num_descs);
+
+
+
+
+
+
+uint32_t spiffs_buffer_bytes_for_cache(struct spiffs_t *self_p,
+                                       uint32_t num_pages);
+
+
+
+
+typedef spiffs_block_ix_t spiffs_block_ix;
+typedef spiffs_page_ix_t spiffs_page_ix;
+typedef spiffs_obj_id_t spiffs_obj_id;
+typedef spiffs_span_ix_t spiffs_span_ix;
+typedef struct spiffs_t spiffs;
+typedef spiffs_file_t spiffs_file;
+typedef spiffs_flags_t spiffs_flags;
+typedef spiffs_obj_type_t spiffs_obj_type;
+typedef spiffs_mode_t spiffs_mode;
+typedef enum spiffs_fileop_type_t spiffs_fileop_type;
+typedef struct spiffs_config_t spiffs_config;
+typedef spiffs_check_callback_t spiffs_check_callback;
+typedef struct spiffs_dirent_t spiffs_dirent;
+typedef struct spiffs_dir_t spiffs_DIR;
+typedef spiffs_file_callback_t spiffs_file_callback;
+# 119 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/oam/console.h" 1
+# 45 "/root/repo/src/oam/console.h"
+int console_module_init(void);
+
+
+
+
+
+
+int console_init(void);
+
+
+
+
+
+
+int console_start(void);
+
+
+
+
+
+
+int console_stop(void);
+# 75 "/root/repo/src/oam/console.h"
+int console_flush(void);
+# 84 "/root/repo/src/oam/console.h"
+uint32_t console_get_tx_dropped(void);
+# 93 "/root/repo/src/oam/console.h"
+void console_panic_flush(void *chan_p);
+
+
+
+
+
+
+int console_set_input_channel(void *chan_p);
+
+
+
+
+
+
+void *console_get_input_channel(void);
+
+
+
+
+
+
+void *console_set_output_channel(void *chan_p);
+
+
+
+
+
+
+void *console_get_output_channel(void);
+# 121 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/filesystems/fs.h" 1
+# 111 "/root/repo/src/filesystems/fs.h"
+typedef int (*fs_callback_t)(int argc,
+                             const char *argv[],
+                             void *out_p,
+                             void *in_p,
+                             void *arg_p,
+                             void *call_arg_p);
+# 126 "/root/repo/src/filesystems/fs.h"
+typedef int (*fs_parameter_set_callback_t)(void *value_p,
+                                           const char *src_p);
+# 137 "/root/repo/src/filesystems/fs.h"
+typedef int (*fs_parameter_print_callback_t)(void *chout_p,
+                                             void *value_p);
+
+enum fs_type_t {
+    fs_type_fat16_t = 0,
+    fs_type_spiffs_t,
+    fs_type_generic_t
+};
+# 178 "/root/repo/src/filesystems/fs.h"
+struct fs_filesystem_t {
+    const char *name_p;
+    enum fs_type_t type;
+    union {
+
+
+
+
+
+
+        struct {
+            struct fs_filesystem_operations_t *ops_p;
+        } generic;
+    } fs;
+    union {
+
+
+
+    } config;
+    struct fs_filesystem_t *next_p;
+};
+
+
+struct fs_file_t {
+    struct fs_filesystem_t *filesystem_p;
+    union {
+
+
+
+
+
+
+    } u;
+};
+
+
+struct fs_stat_t {
+    uint32_t size;
+    uint8_t type;
+};
+
+
+struct fs_command_t {
+    far_string_t path_p;
+    fs_callback_t callback;
+    void *arg_p;
+    struct fs_command_t *next_p;
+
+    struct fs_command_t *index_next_p;
+
+};
+
+
+struct fs_counter_t {
+    struct fs_command_t command;
+    long long unsigned int value;
+    struct fs_counter_t *next_p;
+};
+
+
+struct fs_parameter_t {
+    struct fs_command_t command;
+    fs_parameter_set_callback_t set_cb;
+    fs_parameter_print_callback_t print_cb;
+    void *value_p;
+    struct fs_parameter_t *next_p;
+};
+
+struct fs_dir_t {
+    struct fs_filesystem_t *filesystem_p;
+    union {
+
+
+
+
+
+
+    } u;
+};
+
+struct fs_dir_entry_t {
+    char name[256];
+    int type;
+    size_t size;
+    struct date_t latest_mod_date;
+};
+
+struct fs_filesystem_operations_t {
+    int (*file_open)(struct fs_filesystem_t *filesystem_p,
+                     struct fs_file_t *self_p,
+                     const char *path_p,
+                     int flags);
+    int (*file_close)(struct fs_file_t *self_p);
+    ssize_t (*file_read)(struct fs_file_t *self_p, void *dst_p, size_t size);
+    ssize_t (*file_write)(struct fs_file_t *self_p, const void *src_p, size_t size);
+    int (*file_seek)(struct fs_file_t *self_p, int offset, int whence);
+    ssize_t (*file_tell)(struct fs_file_t *self_p);
+};
+# 286 "/root/repo/src/filesystems/fs.h"
+int fs_module_init(void);
+# 305 "/root/repo/src/filesystems/fs.h"
+int fs_call(char *command_p,
+            void *chin_p,
+            void *chout_p,
+            void *arg_p);
+# 329 "/root/repo/src/filesystems/fs.h"
+int fs_open(struct fs_file_t *self_p, const char *path_p, int flags);
+# 339 "/root/repo/src/filesystems/fs.h"
+int fs_close(struct fs_file_t *self_p);
+# 350 "/root/repo/src/filesystems/fs.h"
+ssize_t fs_read(struct fs_file_t *self_p, void *dst_p, size_t size);
+# 369 "/root/repo/src/filesystems/fs.h"
+ssize_t fs_read_line(struct fs_file_t *self_p, void *dst_p, size_t size);
+# 380 "/root/repo/src/filesystems/fs.h"
+ssize_t fs_write(struct fs_file_t *self_p, const void *src_p, size_t size);
+# 392 "/root/repo/src/filesystems/fs.h"
+int fs_seek(struct fs_file_t *self_p, int offset, int whence);
+# 401 "/root/repo/src/filesystems/fs.h"
+ssize_t fs_tell(struct fs_file_t *self_p);
+# 412 "/root/repo/src/filesystems/fs.h"
+int fs_dir_open(struct fs_dir_t *dir_p,
+                const char *path_p,
+                int oflag);
+# 423 "/root/repo/src/filesystems/fs.h"
+int fs_dir_close(struct fs_dir_t *dir_p);
+# 434 "/root/repo/src/filesystems/fs.h"
+int fs_dir_read(struct fs_dir_t *dir_p,
+                struct fs_dir_entry_t *entry_p);
+# 444 "/root/repo/src/filesystems/fs.h"
+int fs_remove(const char *path_p);
+# 454 "/root/repo/src/filesystems/fs.h"
+int fs_stat(const char *path_p, struct fs_stat_t *stat_p);
+# 463 "/root/repo/src/filesystems/fs.h"
+int fs_mkdir(const char *path_p);
+# 474 "/root/repo/src/filesystems/fs.h"
+int fs_format(const char *path_p);
+# 486 "/root/repo/src/filesystems/fs.h"
+int fs_ls(const char *path_p,
+          const char *filter_p,
+          void *chout_p);
+# 500 "/root/repo/src/filesystems/fs.h"
+int fs_list(const char *path_p,
+            const char *filter_p,
+            void *chout_p);
+# 514 "/root/repo/src/filesystems/fs.h"
+int fs_auto_complete(char *path_p);
+# 525 "/root/repo/src/filesystems/fs.h"
+void fs_split(char *buf_p, char **path_pp, char **cmd_pp);
+# 535 "/root/repo/src/filesystems/fs.h"
+void fs_merge(char *path_p, char *cmd_p);
+# 546 "/root/repo/src/filesystems/fs.h"
+int fs_filesystem_init_generic(struct fs_filesystem_t *self_p,
+                               const char *name_p,
+                               struct fs_filesystem_operations_t *ops_p);
+# 595 "/root/repo/src/filesystems/fs.h"
+int fs_filesystem_register(struct fs_filesystem_t *self_p);
+# 604 "/root/repo/src/filesystems/fs.h"
+int fs_filesystem_deregister(struct fs_filesystem_t *self_p);
+# 616 "/root/repo/src/filesystems/fs.h"
+int fs_command_init(struct fs_command_t *self_p,
+                    far_string_t path_p,
+                    fs_callback_t callback,
+                    void *arg_p);
+# 629 "/root/repo/src/filesystems/fs.h"
+int fs_command_register(struct fs_command_t *command_p);
+# 638 "/root/repo/src/filesystems/fs.h"
+int fs_command_deregister(struct fs_command_t *command_p);
+# 649 "/root/repo/src/filesystems/fs.h"
+int fs_counter_init(struct fs_counter_t *self_p,
+                    far_string_t path_p,
+                    uint64_t value);
+# 661 "/root/repo/src/filesystems/fs.h"
+int fs_counter_increment(struct fs_counter_t *self_p,
+                         uint64_t value);
+# 671 "/root/repo/src/filesystems/fs.h"
+int fs_counter_register(struct fs_counter_t *counter_p);
+# 680 "/root/repo/src/filesystems/fs.h"
+int fs_counter_deregister(struct fs_counter_t *counter_p);
+# 694 "/root/repo/src/filesystems/fs.h"
+int fs_parameter_init(struct fs_parameter_t *self_p,
+                      far_string_t path_p,
+                      fs_parameter_set_callback_t set_cb,
+                      fs_parameter_print_callback_t print_cb,
+                      void *value_p);
+# 707 "/root/repo/src/filesystems/fs.h"
+int fs_parameter_register(struct fs_parameter_t *parameter_p);
+# 716 "/root/repo/src/filesystems/fs.h"
+int fs_parameter_deregister(struct fs_parameter_t *parameter_p);
+# 726 "/root/repo/src/filesystems/fs.h"
+int fs_parameter_int_set(void *value_p, const char *src_p);
+# 736 "/root/repo/src/filesystems/fs.h"
+int fs_parameter_int_print(void *chout_p, void *value_p);
+# 122 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/shell.h" 1
+# 36 "/root/repo/src/oam/shell.h"
+struct shell_history_elem_t {
+    struct shell_history_elem_t *next_p;
+    struct shell_history_elem_t *prev_p;
+    char buf[1];
+};
+
+struct shell_line_t {
+    char buf[64];
+    int length;
+    int cursor;
+};
+
+struct shell_t {
+    void *chin_p;
+    void *chout_p;
+    void *arg_p;
+    const char *name_p;
+    const char *username_p;
+    const char *password_p;
+    struct shell_line_t line;
+    struct shell_line_t prev_line;
+    int carriage_return_received;
+    int newline_received;
+    int authorized;
+
+
+    struct {
+        int enabled;
+        uint32_t sequence_number;
+        size_t pos;
+        size_t size;
+        char buf[128];
+    } batch;
+# 87 "/root/repo/src/oam/shell.h"
+};
+# 99 "/root/repo/src/oam/shell.h"
+int shell_module_init(void);
+# 115 "/root/repo/src/oam/shell.h"
+int shell_init(struct shell_t *self_p,
+               void *chin_p,
+               void *chout_p,
+               void *arg_p,
+               const char *name_p,
+               const char *username_p,
+               const char *password_p);
+# 145 "/root/repo/src/oam/shell.h"
+void *shell_main(void *arg_p);
+# 123 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/service.h" 1
+# 46 "/root/repo/src/oam/service.h"
+enum service_status_t {
+    service_status_running_t = 0,
+    service_status_stopped_t = 1
+};
+
+struct service_t;
+
+typedef enum service_status_t (*service_get_status_cb_t)(struct service_t *self_p);
+
+
+
+
+struct service_t {
+    const char *name_p;
+    struct event_t control;
+    service_get_status_cb_t status_cb;
+    struct service_t *next_p;
+};
+# 74 "/root/repo/src/oam/service.h"
+int service_module_init(void);
+# 86 "/root/repo/src/oam/service.h"
+int service_init(struct service_t *self_p,
+                 const char *name_p,
+                 service_get_status_cb_t status_cb);
+# 101 "/root/repo/src/oam/service.h"
+int service_start(struct service_t *self_p);
+# 114 "/root/repo/src/oam/service.h"
+int service_stop(struct service_t *self_p);
+# 123 "/root/repo/src/oam/service.h"
+int service_register(struct service_t *service_p);
+# 132 "/root/repo/src/oam/service.h"
+int service_deregister(struct service_t *service_p);
+# 124 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/nvm.h" 1
+# 45 "/root/repo/src/oam/nvm.h"
+int nvm_module_init(void);
+
+
+
+
+
+
+
+int nvm_mount(void);
+
+
+
+
+
+
+
+int nvm_format(void);
+# 73 "/root/repo/src/oam/nvm.h"
+ssize_t nvm_read(void *dst_p, uint32_t src, size_t size);
+# 85 "/root/repo/src/oam/nvm.h"
+ssize_t nvm_write(uint32_t dst, const void *src_p, size_t size);
+
+
+
+
+
+
+
+int nvm_sync(void);
+# 125 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/debug/log.h" 1
+# 61 "/root/repo/src/debug/log.h"
+struct log_handler_t {
+    void *chout_p;
+    struct log_handler_t *next_p;
+};
+
+struct log_object_t {
+    const char *name_p;
+    char mask;
+    struct log_object_t *next_p;
+};
+# 81 "/root/repo/src/debug/log.h"
+int log_module_init(void);
+# 92 "/root/repo/src/debug/log.h"
+int log_object_init(struct log_object_t *self_p,
+                    const char *name_p,
+                    char mask);
+# 104 "/root/repo/src/debug/log.h"
+int log_object_set_log_mask(struct log_object_t *self_p,
+                            char mask);
+# 114 "/root/repo/src/debug/log.h"
+char log_object_get_log_mask(struct log_object_t *self_p);
+# 126 "/root/repo/src/debug/log.h"
+int log_object_is_enabled_for(struct log_object_t *self_p,
+                              int level);
+# 143 "/root/repo/src/debug/log.h"
+int log_object_print(struct log_object_t *self_p,
+                     int level,
+                     const char *fmt_p,
+                     ...);
+# 156 "/root/repo/src/debug/log.h"
+int log_handler_init(struct log_handler_t *self_p,
+                     void *chout_p);
+# 167 "/root/repo/src/debug/log.h"
+int log_add_handler(struct log_handler_t *handler_p);
+# 176 "/root/repo/src/debug/log.h"
+int log_remove_handler(struct log_handler_t *handler_p);
+# 187 "/root/repo/src/debug/log.h"
+int log_add_object(struct log_object_t *object_p);
+# 196 "/root/repo/src/debug/log.h"
+int log_remove_object(struct log_object_t *object_p);
+# 207 "/root/repo/src/debug/log.h"
+int log_set_default_handler_output_channel(void *chout_p);
+# 127 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/text/color.h" 1
+# 129 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/text/re.h" 1
+# 67 "/root/repo/src/text/re.h"
+struct re_group_t {
+    const char *buf_p;
+    ssize_t size;
+};
+# 81 "/root/repo/src/text/re.h"
+int re_module_init(void);
+# 126 "/root/repo/src/text/re.h"
+char *re_compile(char *compiled_p,
+                 const char *pattern_p,
+                 char flags,
+                 size_t size);
+# 143 "/root/repo/src/text/re.h"
+ssize_t re_match(const char *compiled_p,
+                 const char *buf_p,
+                 size_t size,
+                 struct re_group_t *groups_p,
+                 size_t *number_of_groups_p);
+# 161 "/root/repo/src/text/re.h"
+ssize_t re_search(const char *compiled_p,
+                  const char *buf_p,
+                  size_t size,
+                  struct re_group_t *match_p);
+# 130 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/text/std.h" 1
+# 35 "/root/repo/src/text/std.h"
+# 1 "/usr/lib/gcc/x86_64-linux-gnu/12/include/stdarg.h" 1 3 4
+# 36 "/root/repo/src/text/std.h" 2
+
+
+
+
+
+struct std_format_spec_t {
+    far_string_t literal_p;
+    size_t literal_size;
+    int width;
+    char flags;
+    char length;
+
+    char specifier;
+};
+
+
+
+
+struct std_format_t {
+    struct std_format_spec_t *specs_p;
+    int length;
+};
+# 68 "/root/repo/src/text/std.h"
+int std_module_init(void);
+# 96 "/root/repo/src/text/std.h"
+ssize_t std_sprintf(char *dst_p, far_string_t fmt_p, ...);
+# 113 "/root/repo/src/text/std.h"
+ssize_t std_snprintf(char *dst_p,
+                     size_t size,
+                     far_string_t fmt_p,
+                     ...);
+# 130 "/root/repo/src/text/std.h"
+ssize_t std_vsprintf(char *dst_p, far_string_t fmt_p, va_list *ap_p);
+# 147 "/root/repo/src/text/std.h"
+ssize_t std_vsnprintf(char *dst_p, size_t size, far_string_t fmt_p, va_list *ap_p);
+# 161 "/root/repo/src/text/std.h"
+ssize_t std_printf(far_string_t fmt_p, ...);
+# 175 "/root/repo/src/text/std.h"
+ssize_t std_vprintf(far_string_t fmt_p, va_list *ap_p);
+# 190 "/root/repo/src/text/std.h"
+ssize_t std_fprintf(void *chan_p, far_string_t fmt_p, ...);
+# 205 "/root/repo/src/text/std.h"
+ssize_t std_vfprintf(void *chan_p, far_string_t fmt_p, va_list *ap_p);
+# 219 "/root/repo/src/text/std.h"
+ssize_t std_printf_isr(far_string_t fmt_p, ...);
+# 234 "/root/repo/src/text/std.h"
+ssize_t std_fprintf_isr(void *chan_p, far_string_t fmt_p, ...);
+# 253 "/root/repo/src/text/std.h"
+int std_format_init(struct std_format_t *self_p,
+                    struct std_format_spec_t *specs_p,
+                    int length,
+                    far_string_t fmt_p);
+# 268 "/root/repo/src/text/std.h"
+ssize_t std_format_sprintf(char *dst_p,
+                           const struct std_format_t *format_p,
+                           ...);
+# 281 "/root/repo/src/text/std.h"
+ssize_t std_format_printf(const struct std_format_t *format_p, ...);
+# 293 "/root/repo/src/text/std.h"
+ssize_t std_format_fprintf(void *chan_p,
+                           const struct std_format_t *format_p,
+                           ...);
+# 310 "/root/repo/src/text/std.h"
+const char *std_strtolb(const char *str_p,
+                        long *value_p,
+                        int base);
+# 323 "/root/repo/src/text/std.h"
+const char *std_strtol(const char *str_p, long *value_p);
+# 333 "/root/repo/src/text/std.h"
+const char *std_strtod(const char *str_p, double *value_p);
+# 344 "/root/repo/src/text/std.h"
+const char *std_strtodfp(const char *str_p,
+                         long *value_p,
+                         int precision);
+# 356 "/root/repo/src/text/std.h"
+int std_strcpy(char *dst_p, far_string_t src_p);
+# 367 "/root/repo/src/text/std.h"
+int std_strcmp(const char *str_p, far_string_t fstr_p);
+# 378 "/root/repo/src/text/std.h"
+int std_strcmp_f(far_string_t fstr0_p,
+                 far_string_t fstr1_p);
+# 391 "/root/repo/src/text/std.h"
+int std_strncmp(far_string_t fstr_p,
+                const char *str_p,
+                size_t size);
+# 405 "/root/repo/src/text/std.h"
+int std_strncmp_f(far_string_t fstr0_p,
+                  far_string_t fstr1_p,
+                  size_t size);
+# 418 "/root/repo/src/text/std.h"
+int std_strlen(far_string_t fstr_p);
+# 430 "/root/repo/src/text/std.h"
+char *std_strip(char *str_p, const char *strip_p);
+# 442 "/root/repo/src/text/std.h"
+ssize_t std_hexdump(void *chan_p, const void *buf_p, size_t size);
+# 131 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/text/configfile.h" 1
+# 39 "/root/repo/src/text/configfile.h"
+struct configfile_property_t {
+    uint32_t hash;
+    uint16_t section_offset;
+    uint16_t property_offset;
+    uint16_t value_offset;
+    uint16_t value_size;
+    uint8_t section_size;
+
+    uint8_t property_size;
+};
+
+struct configfile_t {
+    char *buf_p;
+    size_t size;
+
+    struct {
+        struct configfile_property_t slots[32];
+        int length;
+
+        int complete;
+    } index;
+
+};
+# 75 "/root/repo/src/text/configfile.h"
+int configfile_init(struct configfile_t *self_p,
+                    char *buf_p,
+                    size_t size);
+# 92 "/root/repo/src/text/configfile.h"
+int configfile_set(struct configfile_t *self_p,
+                   const char *section_p,
+                   const char *property_p,
+                   const char *value_p);
+# 108 "/root/repo/src/text/configfile.h"
+char *configfile_get(struct configfile_t *self_p,
+                     const char *section_p,
+                     const char *property_p,
+                     char *value_p,
+                     int length);
+# 125 "/root/repo/src/text/configfile.h"
+int configfile_get_long(struct configfile_t *self_p,
+                        const char *section_p,
+                        const char *property_p,
+                        long *value_p);
+# 141 "/root/repo/src/text/configfile.h"
+int configfile_get_float(struct configfile_t *self_p,
+                        const char *section_p,
+                        const char *property_p,
+                        float *value_p);
+# 132 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/text/emacs.h" 1
+# 45 "/root/repo/src/text/emacs.h"
+int emacs(const char *path_p, void *chin_p, void *chout_p);
+# 133 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/encode/base64.h" 1
+# 39 "/root/repo/src/encode/base64.h"
+struct base64_encoder_t {
+    const char *alphabet_p;
+    uint8_t buf[3];
+    size_t size;
+};
+
+
+
+
+struct base64_decoder_t {
+    const int8_t *table_p;
+    char buf[4];
+    size_t size;
+    int done;
+};
+# 65 "/root/repo/src/encode/base64.h"
+int base64_encode(char *dst_p, const void *src_p, size_t size);
+# 78 "/root/repo/src/encode/base64.h"
+int base64_decode(void *dst_p, const char *src_p, size_t size);
+# 90 "/root/repo/src/encode/base64.h"
+int base64_url_encode(char *dst_p, const void *src_p, size_t size);
+# 102 "/root/repo/src/encode/base64.h"
+int base64_url_decode(void *dst_p, const char *src_p, size_t size);
+# 112 "/root/repo/src/encode/base64.h"
+int base64_encoder_init(struct base64_encoder_t *self_p, int url);
+# 127 "/root/repo/src/encode/base64.h"
+ssize_t base64_encoder_update(struct base64_encoder_t *self_p,
+                              char *dst_p,
+                              const void *src_p,
+                              size_t size);
+# 141 "/root/repo/src/encode/base64.h"
+ssize_t base64_encoder_finish(struct base64_encoder_t *self_p,
+                              char *dst_p);
+# 152 "/root/repo/src/encode/base64.h"
+int base64_decoder_init(struct base64_decoder_t *self_p, int url);
+# 167 "/root/repo/src/encode/base64.h"
+ssize_t base64_decoder_update(struct base64_decoder_t *self_p,
+                              void *dst_p,
+                              const char *src_p,
+                              size_t size);
+# 180 "/root/repo/src/encode/base64.h"
+int base64_decoder_finish(struct base64_decoder_t *self_p);
+# 135 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/encode/json.h" 1
+# 67 "/root/repo/src/encode/json.h"
+enum json_type_t {
+
+    JSON_UNDEFINED = 0,
+
+
+    JSON_OBJECT = 1,
+
+
+    JSON_ARRAY = 2,
+
+
+    JSON_STRING = 3,
+
+
+    JSON_PRIMITIVE = 4
+};
+
+enum json_err_t {
+
+    JSON_ERROR_NOMEM = -1,
+
+
+    JSON_ERROR_INVAL = -2,
+
+
+    JSON_ERROR_PART = -3
+};
+
+
+
+
+struct json_tok_t {
+
+    enum json_type_t type;
+
+    const char *buf_p;
+
+    size_t size;
+
+    int num_tokens;
+
+
+
+
+
+    int next;
+
+
+
+};
+
+
+
+
+
+
+struct json_t {
+
+    unsigned int pos;
+
+    unsigned int toknext;
+
+    int toksuper;
+
+    int tokopen;
+
+    struct json_tok_t *tokens_p;
+
+    int num_tokens;
+};
+# 146 "/root/repo/src/encode/json.h"
+enum json_stream_event_t {
+
+    JSON_STREAM_OBJECT_BEGIN = 0,
+
+
+    JSON_STREAM_OBJECT_END,
+
+
+    JSON_STREAM_ARRAY_BEGIN,
+
+
+    JSON_STREAM_ARRAY_END,
+
+
+    JSON_STREAM_KEY,
+
+
+    JSON_STREAM_STRING,
+
+
+
+    JSON_STREAM_PRIMITIVE
+};
+# 183 "/root/repo/src/encode/json.h"
+typedef int (*json_stream_callback_t)(void *arg_p,
+                                      enum json_stream_event_t event,
+                                      const char *buf_p,
+                                      size_t size);
+
+
+
+
+
+
+struct json_stream_t {
+    int state;
+    int is_key;
+    int unicode_count;
+    int depth;
+
+    uint32_t arrays;
+    struct {
+        char *buf_p;
+        size_t size;
+        size_t pos;
+    } value;
+    json_stream_callback_t callback;
+    void *arg_p;
+};
+
+
+
+
+
+struct json_writer_t {
+    void *chan_p;
+    char *buf_p;
+    size_t size;
+    size_t pos;
+    ssize_t length;
+    int res;
+    int depth;
+    int has_root;
+    int after_key;
+
+    uint32_t arrays;
+
+
+    uint32_t non_empty;
+};
+# 245 "/root/repo/src/encode/json.h"
+int json_init(struct json_t *self_p,
+              struct json_tok_t *tokens_p,
+              int num_tokens);
+# 259 "/root/repo/src/encode/json.h"
+int json_parse(struct json_t *self_p,
+               const char *js_p,
+               size_t len);
+# 274 "/root/repo/src/encode/json.h"
+ssize_t json_dumps(struct json_t *self_p,
+                   struct json_tok_t *tokens_p,
+                   char *js_p);
+# 289 "/root/repo/src/encode/json.h"
+ssize_t json_dump(struct json_t *self_p,
+                  struct json_tok_t *tokens_p,
+                  void *out_p);
+# 300 "/root/repo/src/encode/json.h"
+struct json_tok_t *json_root(struct json_t *self_p);
+# 311 "/root/repo/src/encode/json.h"
+struct json_tok_t *json_object_get(struct json_t *self_p,
+                                   const char *key_p,
+                                   struct json_tok_t *object_p);
+# 324 "/root/repo/src/encode/json.h"
+struct json_tok_t *json_object_get_primitive(struct json_t *self_p,
+                                             const char *key_p,
+                                             struct json_tok_t *object_p);
+# 337 "/root/repo/src/encode/json.h"
+struct json_tok_t *json_array_get(struct json_t *self_p,
+                                  int index,
+                                  struct json_tok_t *array_p);
+# 356 "/root/repo/src/encode/json.h"
+int json_stream_init(struct json_stream_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     json_stream_callback_t callback,
+                     void *arg_p);
+# 375 "/root/repo/src/encode/json.h"
+int json_stream_parse(struct json_stream_t *self_p,
+                      const char *buf_p,
+                      size_t size);
+# 388 "/root/repo/src/encode/json.h"
+int json_stream_finish(struct json_stream_t *self_p);
+# 404 "/root/repo/src/encode/json.h"
+int json_writer_init(struct json_writer_t *self_p,
+                     char *buf_p,
+                     size_t size,
+                     void *chan_p);
+# 417 "/root/repo/src/encode/json.h"
+int json_writer_object_begin(struct json_writer_t *self_p);
+# 426 "/root/repo/src/encode/json.h"
+int json_writer_object_end(struct json_writer_t *self_p);
+# 435 "/root/repo/src/encode/json.h"
+int json_writer_array_begin(struct json_writer_t *self_p);
+# 444 "/root/repo/src/encode/json.h"
+int json_writer_array_end(struct json_writer_t *self_p);
+# 454 "/root/repo/src/encode/json.h"
+int json_writer_key(struct json_writer_t *self_p, const char *key_p);
+# 466 "/root/repo/src/encode/json.h"
+int json_writer_string(struct json_writer_t *self_p,
+                       const char *buf_p,
+                       size_t size);
+# 478 "/root/repo/src/encode/json.h"
+int json_writer_integer(struct json_writer_t *self_p, long value);
+# 491 "/root/repo/src/encode/json.h"
+int json_writer_float(struct json_writer_t *self_p, float value);
+# 503 "/root/repo/src/encode/json.h"
+int json_writer_boolean(struct json_writer_t *self_p, int value);
+# 512 "/root/repo/src/encode/json.h"
+int json_writer_null(struct json_writer_t *self_p);
+# 522 "/root/repo/src/encode/json.h"
+ssize_t json_writer_finish(struct json_writer_t *self_p);
+
+
+
+
+
+
+
+void json_token_object(struct json_tok_t *token_p,
+                       int num_keys);
+
+
+
+
+
+
+
+void json_token_array(struct json_tok_t *token_p,
+                      int num_elements);
+
+
+
+
+
+
+void json_token_true(struct json_tok_t *token_p);
+
+
+
+
+
+
+void json_token_false(struct json_tok_t *token_p);
+
+
+
+
+
+
+void json_token_null(struct json_tok_t *token_p);
+# 570 "/root/repo/src/encode/json.h"
+void json_token_number(struct json_tok_t *token_p,
+                       const char *buf_p,
+                       size_t size);
+# 581 "/root/repo/src/encode/json.h"
+void json_token_string(struct json_tok_t *token_p,
+                       const char *buf_p,
+                       size_t size);
+# 136 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/encode/nmea.h" 1
+# 41 "/root/repo/src/encode/nmea.h"
+struct nmea_position_t {
+    char *angle_p;
+    char *direction_p;
+};
+
+struct nmea_value_t {
+    char *value_p;
+    char *unit_p;
+};
+
+struct nmea_track_made_good_t {
+    char *value_p;
+    char *relative_to_p;
+};
+
+
+
+
+struct nmea_sentence_raw_t {
+    char *str_p;
+};
+
+
+
+
+struct nmea_sentence_gga_t {
+    char *time_of_fix_p;
+    struct nmea_position_t latitude;
+    struct nmea_position_t longitude;
+    char *fix_quality_p;
+    char *number_of_tracked_satellites_p;
+    char *horizontal_dilution_of_position_p;
+    struct nmea_value_t altitude;
+    struct nmea_value_t height_of_geoid;
+};
+
+
+
+
+struct nmea_sentence_gll_t {
+    char *time_of_fix_p;
+    struct nmea_position_t latitude;
+    struct nmea_position_t longitude;
+    char *data_active_p;
+};
+
+
+
+
+struct nmea_sentence_gsa_t {
+    char *selection_p;
+    char *fix_p;
+    char *prns[12];
+    char *pdop_p;
+    char *hdop_p;
+    char *vdop_p;
+};
+
+
+
+
+struct nmea_sentence_gsv_t {
+    char *number_of_sentences_p;
+    char *sentence_p;
+    char *number_of_satellites_p;
+    struct {
+        char *prn_p;
+        char *elevation_p;
+        char *azimuth_p;
+        char *snr_p;
+    } satellites[4];
+};
+
+
+
+
+struct nmea_sentence_rmc_t {
+    char *time_of_fix_p;
+    char *status_p;
+    struct nmea_position_t latitude;
+    struct nmea_position_t longitude;
+    char *speed_knots_p;
+    char *track_angle_p;
+    char *date_p;
+    struct nmea_position_t magnetic_variation;
+};
+
+
+
+
+struct nmea_sentence_vtg_t {
+    struct nmea_track_made_good_t track_made_good_true;
+    struct nmea_track_made_good_t track_made_good_magnetic;
+    struct nmea_value_t ground_speed_knots;
+    struct nmea_value_t ground_speed_kmph;
+};
+
+
+
+
+enum nmea_sentence_type_t {
+    nmea_sentence_type_raw_t = 0,
+    nmea_sentence_type_gga_t,
+    nmea_sentence_type_gll_t,
+    nmea_sentence_type_gsa_t,
+    nmea_sentence_type_gsv_t,
+    nmea_sentence_type_rmc_t,
+    nmea_sentence_type_vtg_t,
+    nmea_sentence_type_max_t
+};
+
+
+
+
+enum nmea_talker_t {
+
+    nmea_talker_gp_t = 0,
+
+    nmea_talker_gl_t,
+
+    nmea_talker_ga_t,
+
+    nmea_talker_gn_t,
+    nmea_talker_other_t
+};
+
+
+
+
+struct nmea_sentence_t {
+    enum nmea_sentence_type_t type;
+
+
+    enum nmea_talker_t talker;
+    union {
+        struct nmea_sentence_raw_t raw;
+        struct nmea_sentence_gga_t gga;
+        struct nmea_sentence_gll_t gll;
+        struct nmea_sentence_gsa_t gsa;
+        struct nmea_sentence_gsv_t gsv;
+        struct nmea_sentence_rmc_t rmc;
+        struct nmea_sentence_vtg_t vtg;
+    };
+};
+# 196 "/root/repo/src/encode/nmea.h"
+ssize_t nmea_encode(char *dst_p,
+                    struct nmea_sentence_t *src_p,
+                    size_t size);
+# 213 "/root/repo/src/encode/nmea.h"
+ssize_t nmea_decode(struct nmea_sentence_t *dst_p,
+                    char *src_p,
+                    size_t size);
+# 228 "/root/repo/src/encode/nmea.h"
+int nmea_decode_fix_time(char *src_p,
+                         int *hour_p,
+                         int *minute_p,
+                         int *second_p);
+# 244 "/root/repo/src/encode/nmea.h"
+int nmea_decode_date(char *src_p,
+                     int *year_p,
+                     int *month_p,
+                     int *date_p);
+# 262 "/root/repo/src/encode/nmea.h"
+int nmea_decode_position(struct nmea_position_t *src_p,
+                         long *degrees_p);
+# 137 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/hash/crc.h" 1
+# 51 "/root/repo/src/hash/crc.h"
+uint32_t crc_32(uint32_t crc, const void *buf_p, size_t size);
+# 63 "/root/repo/src/hash/crc.h"
+uint16_t crc_ccitt(uint16_t crc, const void *buf_p, size_t size);
+# 75 "/root/repo/src/hash/crc.h"
+uint16_t crc_xmodem(uint16_t crc, const void *buf_p, size_t size);
+# 86 "/root/repo/src/hash/crc.h"
+uint8_t crc_7(const void* buf_p, size_t size);
+# 98 "/root/repo/src/hash/crc.h"
+uint8_t crc_8(uint8_t crc, uint8_t polynomial, const void *buf_p, size_t size);
+# 139 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/hash/sha1.h" 1
+# 36 "/root/repo/src/hash/sha1.h"
+struct sha1_t {
+    struct {
+        uint8_t buf[64];
+        uint32_t size;
+    } block;
+    uint32_t h[5];
+    uint64_t size;
+};
+# 52 "/root/repo/src/hash/sha1.h"
+int sha1_init(struct sha1_t *self_p);
+# 65 "/root/repo/src/hash/sha1.h"
+int sha1_update(struct sha1_t *self_p,
+                void *buf_p,
+                size_t size);
+# 79 "/root/repo/src/hash/sha1.h"
+int sha1_digest(struct sha1_t *self_p,
+                uint8_t *hash_p);
+# 140 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/inet/types.h" 1
+# 142 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/inet.h" 1
+# 36 "/root/repo/src/inet/inet.h"
+struct inet_ip_addr_t {
+
+    uint32_t number;
+};
+
+struct inet_addr_t {
+
+    struct inet_ip_addr_t ip;
+
+    uint16_t port;
+};
+
+
+
+
+struct inet_if_ip_info_t {
+    struct inet_ip_addr_t address;
+    struct inet_ip_addr_t netmask;
+    struct inet_ip_addr_t gateway;
+};
+# 66 "/root/repo/src/inet/inet.h"
+int inet_module_init(void);
+# 84 "/root/repo/src/inet/inet.h"
+int inet_aton(const char *src_p,
+              struct inet_ip_addr_t *dst_p);
+# 97 "/root/repo/src/inet/inet.h"
+char *inet_ntoa(const struct inet_ip_addr_t *src_p,
+                char *dst_p);
+# 108 "/root/repo/src/inet/inet.h"
+uint16_t inet_checksum(void *buf_p, size_t size);
+# 143 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/exti.h" 1
+# 35 "/root/repo/src/drivers/basic/exti.h"
+# 1 "/root/repo/src/drivers/ports/linux/exti_port.h" 1
+# 35 "/root/repo/src/drivers/ports/linux/exti_port.h"
+struct exti_device_t {
+    struct exti_driver_t *drv_p;
+
+
+    const struct pin_device_t *pin_dev_p;
+};
+
+struct exti_driver_t {
+    struct exti_device_t *dev_p;
+    uint8_t trigger;
+    void (*on_interrupt)(void *arg_p);
+    void *arg_p;
+};
+# 36 "/root/repo/src/drivers/basic/exti.h" 2
+# 52 "/root/repo/src/drivers/basic/exti.h"
+extern struct exti_device_t exti_device[32];
+# 63 "/root/repo/src/drivers/basic/exti.h"
+int exti_module_init(void);
+# 79 "/root/repo/src/drivers/basic/exti.h"
+int exti_init(struct exti_driver_t *self_p,
+              struct exti_device_t *dev_p,
+              int trigger,
+              void (*on_interrupt)(void *arg_p),
+              void *arg_p);
+# 93 "/root/repo/src/drivers/basic/exti.h"
+int exti_start(struct exti_driver_t *self_p);
+# 103 "/root/repo/src/drivers/basic/exti.h"
+int exti_stop(struct exti_driver_t *self_p);
+# 112 "/root/repo/src/drivers/basic/exti.h"
+int exti_clear(struct exti_driver_t *self_p);
+# 146 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/pin.h" 1
+# 69 "/root/repo/src/drivers/basic/pin.h"
+# 1 "/root/repo/src/drivers/ports/linux/pin_port.h" 1
+# 34 "/root/repo/src/drivers/ports/linux/pin_port.h"
+struct pin_device_t {
+    const struct pin_driver_t *drv_p;
+    int value;
+};
+
+struct pin_driver_t {
+    const struct pin_device_t *dev_p;
+};
+
+int pin_port_device_set_mode(const struct pin_device_t *dev_p,
+                             int mode);
+
+int pin_port_device_read(const struct pin_device_t *dev_p);
+
+int pin_port_device_write_high(const struct pin_device_t *dev_p);
+
+int pin_port_device_write_low(const struct pin_device_t *dev_p);
+
+uint32_t pin_port_device_mask(const struct pin_device_t *dev_p);
+
+int pin_port_device_is_same_port(const struct pin_device_t *dev_p,
+                                 const struct pin_device_t *other_p);
+
+int pin_port_device_write_mask(const struct pin_device_t *dev_p,
+                               uint32_t high_mask,
+                               uint32_t low_mask);
+
+uint32_t pin_port_device_read_mask(const struct pin_device_t *dev_p,
+                                   uint32_t mask);
+# 74 "/root/repo/src/drivers/ports/linux/pin_port.h"
+int pin_port_device_set_input(struct pin_device_t *dev_p, int value);
+# 70 "/root/repo/src/drivers/basic/pin.h" 2
+
+extern struct pin_device_t pin_device[128];
+# 82 "/root/repo/src/drivers/basic/pin.h"
+int pin_module_init(void);
+# 97 "/root/repo/src/drivers/basic/pin.h"
+int pin_init(struct pin_driver_t *self_p,
+             struct pin_device_t *dev_p,
+             int mode);
+# 112 "/root/repo/src/drivers/basic/pin.h"
+int pin_write(struct pin_driver_t *self_p, int value);
+# 125 "/root/repo/src/drivers/basic/pin.h"
+int pin_read(struct pin_driver_t *self_p);
+# 137 "/root/repo/src/drivers/basic/pin.h"
+int pin_toggle(struct pin_driver_t *self_p);
+# 151 "/root/repo/src/drivers/basic/pin.h"
+int pin_set_mode(struct pin_driver_t *self_p, int mode);
+# 165 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_set_mode(const struct pin_device_t *dev_p,
+                                      int mode)
+{
+    return (pin_port_device_set_mode(dev_p, mode));
+}
+# 182 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_read(const struct pin_device_t *dev_p)
+{
+    return (pin_port_device_read(dev_p));
+}
+# 198 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_write(const struct pin_device_t *dev_p,
+                                   int value)
+{
+    if (value == 0) {
+        return (pin_port_device_write_low(dev_p));
+    } else {
+        return (pin_port_device_write_high(dev_p));
+    }
+}
+# 218 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_write_high(const struct pin_device_t *dev_p)
+{
+    return (pin_port_device_write_high(dev_p));
+}
+# 233 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_write_low(const struct pin_device_t *dev_p)
+{
+    return (pin_port_device_write_low(dev_p));
+}
+# 251 "/root/repo/src/drivers/basic/pin.h"
+static inline uint32_t pin_device_mask(const struct pin_device_t *dev_p)
+{
+    return (pin_port_device_mask(dev_p));
+}
+# 266 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_is_same_port(const struct pin_device_t *dev_p,
+                                          const struct pin_device_t *other_p)
+{
+    return (pin_port_device_is_same_port(dev_p, other_p));
+}
+# 287 "/root/repo/src/drivers/basic/pin.h"
+static inline int pin_device_write_mask(const struct pin_device_t *dev_p,
+                                        uint32_t high_mask,
+                                        uint32_t low_mask)
+{
+    return (pin_port_device_write_mask(dev_p, high_mask, low_mask));
+}
+# 306 "/root/repo/src/drivers/basic/pin.h"
+static inline uint32_t pin_device_read_mask(const struct pin_device_t *dev_p,
+                                            uint32_t mask)
+{
+    return (pin_port_device_read_mask(dev_p, mask));
+}
+# 322 "/root/repo/src/drivers/basic/pin.h"
+int pin_is_valid_device(struct pin_device_t *dev_p);
+# 149 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/i2c_soft.h" 1
+# 36 "/root/repo/src/drivers/network/i2c_soft.h"
+struct i2c_soft_driver_t {
+    struct pin_device_t *scl_p;
+    struct pin_device_t *sda_p;
+    long baudrate;
+    long baudrate_us;
+    long max_clock_stretching_us;
+    long clock_stretching_sleep_us;
+};
+# 54 "/root/repo/src/drivers/network/i2c_soft.h"
+int i2c_soft_module_init(void);
+# 72 "/root/repo/src/drivers/network/i2c_soft.h"
+int i2c_soft_init(struct i2c_soft_driver_t *self_p,
+                  struct pin_device_t *scl_dev_p,
+                  struct pin_device_t *sda_dev_p,
+                  long baudrate,
+                  long max_clock_stretching_us,
+                  long clock_stretching_sleep_us);
+# 88 "/root/repo/src/drivers/network/i2c_soft.h"
+int i2c_soft_start(struct i2c_soft_driver_t *self_p);
+# 97 "/root/repo/src/drivers/network/i2c_soft.h"
+int i2c_soft_stop(struct i2c_soft_driver_t *self_p);
+# 109 "/root/repo/src/drivers/network/i2c_soft.h"
+ssize_t i2c_soft_read(struct i2c_soft_driver_t *self_p,
+                      int address,
+                      void *buf_p,
+                      size_t size);
+# 124 "/root/repo/src/drivers/network/i2c_soft.h"
+ssize_t i2c_soft_write(struct i2c_soft_driver_t *self_p,
+                       int address,
+                       const void *buf_p,
+                       size_t size);
+# 142 "/root/repo/src/drivers/network/i2c_soft.h"
+ssize_t i2c_soft_write_read(struct i2c_soft_driver_t *self_p,
+                            int address,
+                            const void *txbuf_p,
+                            size_t txsize,
+                            void *rxbuf_p,
+                            size_t rxsize);
+# 158 "/root/repo/src/drivers/network/i2c_soft.h"
+int i2c_soft_scan(struct i2c_soft_driver_t *self_p,
+                  int address);
+# 152 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/pwm.h" 1
+# 35 "/root/repo/src/drivers/basic/pwm.h"
+# 1 "/root/repo/src/drivers/ports/linux/pwm_port.h" 1
+# 34 "/root/repo/src/drivers/ports/linux/pwm_port.h"
+struct pwm_device_t {
+    struct pin_device_t *pin_dev_p;
+};
+
+struct pwm_driver_t {
+    const struct pwm_device_t *dev_p;
+    long frequency;
+    long duty_cycle;
+};
+# 36 "/root/repo/src/drivers/basic/pwm.h" 2
+
+extern struct pwm_device_t pwm_device[128];
+# 48 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_module_init(void);
+# 60 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_init(struct pwm_driver_t *self_p,
+             struct pwm_device_t *dev_p,
+             long frequency,
+             long duty_cycle);
+# 72 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_start(struct pwm_driver_t *self_p);
+# 81 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_stop(struct pwm_driver_t *self_p);
+# 93 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_set_frequency(struct pwm_driver_t *self_p,
+                      long value);
+# 103 "/root/repo/src/drivers/basic/pwm.h"
+long pwm_get_frequency(struct pwm_driver_t *self_p);
+# 115 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_set_duty_cycle(struct pwm_driver_t *self_p,
+                       long value);
+# 125 "/root/repo/src/drivers/basic/pwm.h"
+long pwm_get_duty_cycle(struct pwm_driver_t *self_p);
+# 135 "/root/repo/src/drivers/basic/pwm.h"
+long pwm_frequency(int hertz);
+# 145 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_frequency_as_hertz(long value);
+# 155 "/root/repo/src/drivers/basic/pwm.h"
+long pwm_duty_cycle(int percentage);
+# 165 "/root/repo/src/drivers/basic/pwm.h"
+int pwm_duty_cycle_as_percent(long value);
+# 174 "/root/repo/src/drivers/basic/pwm.h"
+struct pwm_device_t *pwm_pin_to_device(struct pin_device_t *pin_p);
+# 155 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/pwm_soft.h" 1
+# 35 "/root/repo/src/drivers/basic/pwm_soft.h"
+# 1 "/root/repo/src/drivers/ports/linux/pwm_soft_port.h" 1
+# 34 "/root/repo/src/drivers/ports/linux/pwm_soft_port.h"
+struct pwm_soft_port_module_t {
+};
+# 44 "/root/repo/src/drivers/ports/linux/pwm_soft_port.h"
+unsigned int pwm_soft_port_timer_isr(void);
+# 36 "/root/repo/src/drivers/basic/pwm_soft.h" 2
+
+struct pwm_soft_driver_t {
+    struct pin_device_t *pin_dev_p;
+    long frequency;
+    long duty_cycle;
+
+    int channel;
+};
+# 59 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_module_init(long frequency);
+# 71 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_set_frequency(long value);
+
+
+
+
+
+
+long pwm_soft_get_frequency(void);
+# 89 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_init(struct pwm_soft_driver_t *self_p,
+                  struct pin_device_t *pin_dev_p,
+                  long duty_cycle);
+# 106 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_start(struct pwm_soft_driver_t *self_p);
+# 118 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_stop(struct pwm_soft_driver_t *self_p);
+# 132 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_set_duty_cycle(struct pwm_soft_driver_t *self_p,
+                            long value);
+# 143 "/root/repo/src/drivers/basic/pwm_soft.h"
+unsigned int pwm_soft_get_duty_cycle(struct pwm_soft_driver_t *self_p);
+# 153 "/root/repo/src/drivers/basic/pwm_soft.h"
+long pwm_soft_duty_cycle(int percentage);
+# 163 "/root/repo/src/drivers/basic/pwm_soft.h"
+int pwm_soft_duty_cycle_as_percent(long value);
+# 158 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/adc.h" 1
+# 36 "/root/repo/src/drivers/basic/adc.h"
+struct adc_stream_t;
+
+# 1 "/root/repo/src/drivers/ports/linux/adc_port.h" 1
+# 39 "/root/repo/src/drivers/ports/linux/adc_port.h"
+struct adc_device_t {
+    struct adc_driver_t *drv_p;
+    struct {
+        FILE *file_p;
+        int is_wav;
+        long data_offset;
+        size_t data_size;
+        size_t data_left;
+        int channels;
+        int bits_per_sample;
+    } input;
+};
+
+struct adc_driver_t {
+    struct adc_device_t *dev_p;
+    long sampling_rate;
+    struct {
+        struct adc_stream_t *stream_p;
+        struct timer_t timer;
+        struct time_t start;
+        uint64_t number_of_samples;
+    } stream;
+};
+# 81 "/root/repo/src/drivers/ports/linux/adc_port.h"
+int adc_port_device_set_input_file(struct adc_device_t *dev_p,
+                                   const char *path_p);
+# 39 "/root/repo/src/drivers/basic/adc.h" 2
+
+
+
+
+
+
+extern struct adc_device_t adc_device[16];
+
+
+
+
+struct adc_stream_buffer_t {
+    uint16_t *samples_p;
+    size_t length;
+
+    struct time_t timestamp;
+
+
+    size_t sequence_number;
+};
+# 67 "/root/repo/src/drivers/basic/adc.h"
+typedef void (*adc_stream_callback_t)(void *arg_p,
+                                      struct adc_stream_buffer_t *buffer_p);
+
+struct adc_stream_t {
+    struct adc_driver_t *drv_p;
+    struct adc_stream_buffer_t *buffers_p;
+    size_t number_of_buffers;
+    adc_stream_callback_t callback;
+    void *arg_p;
+    size_t produced;
+    size_t consumed;
+    size_t assigned;
+    size_t held_sequence_number;
+    int holding;
+    int overruns;
+    int running;
+    struct thrd_t *thrd_p;
+};
+# 95 "/root/repo/src/drivers/basic/adc.h"
+int adc_module_init(void);
+# 115 "/root/repo/src/drivers/basic/adc.h"
+int adc_init(struct adc_driver_t *self_p,
+             struct adc_device_t *dev_p,
+             struct pin_device_t *pin_dev_p,
+             int reference,
+             long sampling_rate);
+# 132 "/root/repo/src/drivers/basic/adc.h"
+int adc_async_convert(struct adc_driver_t *self_p,
+                      uint16_t *samples_p,
+                      size_t length);
+# 143 "/root/repo/src/drivers/basic/adc.h"
+int adc_async_wait(struct adc_driver_t *self_p);
+# 156 "/root/repo/src/drivers/basic/adc.h"
+int adc_convert(struct adc_driver_t *self_p,
+                uint16_t *samples_p,
+                size_t length);
+# 170 "/root/repo/src/drivers/basic/adc.h"
+int adc_convert_isr(struct adc_driver_t *self_p,
+                    uint16_t *sample_p);
+# 194 "/root/repo/src/drivers/basic/adc.h"
+int adc_stream_init(struct adc_stream_t *self_p,
+                    struct adc_driver_t *drv_p,
+                    struct adc_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    adc_stream_callback_t callback,
+                    void *arg_p);
+# 210 "/root/repo/src/drivers/basic/adc.h"
+int adc_stream_start(struct adc_stream_t *self_p);
+# 221 "/root/repo/src/drivers/basic/adc.h"
+int adc_stream_stop(struct adc_stream_t *self_p);
+# 233 "/root/repo/src/drivers/basic/adc.h"
+int adc_stream_read(struct adc_stream_t *self_p,
+                    struct adc_stream_buffer_t **buffer_pp);
+# 243 "/root/repo/src/drivers/basic/adc.h"
+int adc_is_valid_device(struct adc_device_t *dev_p);
+# 161 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/dac.h" 1
+# 36 "/root/repo/src/drivers/basic/dac.h"
+struct dac_stream_t;
+
+# 1 "/root/repo/src/drivers/ports/linux/dac_port.h" 1
+# 36 "/root/repo/src/drivers/ports/linux/dac_port.h"
+struct dac_driver_t;
+
+struct dac_device_t {
+    struct dac_driver_t *drv_p;
+    struct {
+        FILE *file_p;
+        uint32_t data_size;
+        long sampling_rate;
+    } output;
+};
+
+struct dac_driver_t {
+    struct dac_device_t *dev_p;
+    long sampling_rate;
+    struct {
+        struct dac_stream_t *stream_p;
+        struct dac_stream_buffer_t *buffer_p;
+        struct timer_t timer;
+        struct time_t start;
+        uint64_t number_of_samples;
+    } stream;
+};
+# 74 "/root/repo/src/drivers/ports/linux/dac_port.h"
+int dac_port_device_set_output_file(struct dac_device_t *dev_p,
+                                    const char *path_p);
+# 39 "/root/repo/src/drivers/basic/dac.h" 2
+
+extern struct dac_device_t dac_device[16];
+
+
+
+
+struct dac_stream_buffer_t {
+    void *samples_p;
+    size_t length;
+};
+# 61 "/root/repo/src/drivers/basic/dac.h"
+typedef int (*dac_stream_refill_t)(void *arg_p,
+                                   struct dac_stream_buffer_t *buffer_p);
+
+struct dac_stream_t {
+    struct dac_driver_t *drv_p;
+    struct dac_stream_buffer_t *buffers_p;
+    size_t number_of_buffers;
+    dac_stream_refill_t refill;
+    void *arg_p;
+    size_t produced;
+    size_t loaded;
+    size_t consumed;
+    int running;
+    struct thrd_t *thrd_p;
+    struct {
+
+
+        uint32_t underruns;
+
+        uint32_t late_refills;
+    } counters;
+};
+# 93 "/root/repo/src/drivers/basic/dac.h"
+int dac_module_init(void);
+# 106 "/root/repo/src/drivers/basic/dac.h"
+int dac_init(struct dac_driver_t *self_p,
+             struct dac_device_t *dev_p,
+             struct pin_device_t *pin0_dev_p,
+             struct pin_device_t *pin1_dev_p,
+             int sampling_rate);
+# 121 "/root/repo/src/drivers/basic/dac.h"
+int dac_async_convert(struct dac_driver_t *self_p,
+                      void *samples_p,
+                      size_t length);
+# 132 "/root/repo/src/drivers/basic/dac.h"
+int dac_async_wait(struct dac_driver_t *self_p);
+# 143 "/root/repo/src/drivers/basic/dac.h"
+int dac_convert(struct dac_driver_t *self_p,
+                void *samples_p,
+                size_t length);
+# 168 "/root/repo/src/drivers/basic/dac.h"
+int dac_stream_init(struct dac_stream_t *self_p,
+                    struct dac_driver_t *drv_p,
+                    struct dac_stream_buffer_t *buffers_p,
+                    size_t number_of_buffers,
+                    dac_stream_refill_t refill,
+                    void *arg_p);
+# 185 "/root/repo/src/drivers/basic/dac.h"
+int dac_stream_start(struct dac_stream_t *self_p);
+# 195 "/root/repo/src/drivers/basic/dac.h"
+int dac_stream_stop(struct dac_stream_t *self_p);
+# 206 "/root/repo/src/drivers/basic/dac.h"
+int dac_stream_get_buffer(struct dac_stream_t *self_p,
+                          struct dac_stream_buffer_t **buffer_pp);
+# 217 "/root/repo/src/drivers/basic/dac.h"
+int dac_stream_write(struct dac_stream_t *self_p);
+# 164 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/transaction.h" 1
+# 36 "/root/repo/src/drivers/network/transaction.h"
+struct transaction_t;
+# 45 "/root/repo/src/drivers/network/transaction.h"
+typedef ssize_t (*transaction_execute_t)(struct transaction_t *transaction_p);
+
+
+
+
+
+
+
+typedef void (*transaction_complete_t)(struct transaction_t *transaction_p);
+
+
+
+
+struct transaction_t {
+    int state;
+    ssize_t res;
+    struct thrd_t *thrd_p;
+    struct transaction_t *next_p;
+};
+
+
+
+
+struct transaction_list_t {
+    struct transaction_t *head_p;
+    struct transaction_t *tail_p;
+};
+
+
+
+
+
+struct transaction_queue_t {
+    const char *name_p;
+    struct transaction_list_t *lists_p;
+    int number_of_lists;
+    int next_list;
+    transaction_execute_t execute;
+    transaction_complete_t complete;
+    void *stack_p;
+    size_t stack_size;
+    int is_started;
+    int is_waiting;
+    struct thrd_t *thrd_p;
+};
+# 106 "/root/repo/src/drivers/network/transaction.h"
+int transaction_queue_init(struct transaction_queue_t *self_p,
+                           const char *name_p,
+                           struct transaction_list_t *lists_p,
+                           int number_of_lists,
+                           transaction_execute_t execute,
+                           transaction_complete_t complete,
+                           void *stack_p,
+                           size_t stack_size);
+# 127 "/root/repo/src/drivers/network/transaction.h"
+int transaction_queue_push(struct transaction_queue_t *self_p,
+                           struct transaction_t *transaction_p,
+                           int list);
+# 138 "/root/repo/src/drivers/network/transaction.h"
+int transaction_init(struct transaction_t *self_p);
+# 148 "/root/repo/src/drivers/network/transaction.h"
+ssize_t transaction_wait(struct transaction_t *self_p);
+# 167 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/spi.h" 1
+# 35 "/root/repo/src/drivers/network/spi.h"
+# 1 "/root/repo/src/drivers/ports/linux/spi_port.h" 1
+# 34 "/root/repo/src/drivers/ports/linux/spi_port.h"
+# 1 "/root/repo/src/kernel/ports/linux/gnu/io.h" 1
+# 35 "/root/repo/src/drivers/ports/linux/spi_port.h" 2
+# 46 "/root/repo/src/drivers/ports/linux/spi_port.h"
+struct spi_driver_t;
+# 59 "/root/repo/src/drivers/ports/linux/spi_port.h"
+typedef ssize_t (*spi_port_slave_transfer_t)(void *arg_p,
+                                             void *rxbuf_p,
+                                             const void *txbuf_p,
+                                             size_t size);
+
+
+
+
+struct spi_port_slave_t {
+    const struct pin_device_t *ss_pin_p;
+    spi_port_slave_transfer_t transfer;
+    void *arg_p;
+    struct spi_port_slave_t *next_p;
+};
+
+struct spi_device_t {
+    struct spi_driver_t *drv_p;
+    struct mutex_t mutex;
+    struct spi_port_slave_t *slaves_p;
+
+    struct {
+        uint32_t transfers;
+        uint32_t bytes;
+
+        uint64_t busy_ns;
+    } counters;
+};
+
+struct spi_driver_t {
+    struct spi_device_t *dev_p;
+    struct pin_driver_t ss;
+    int mode;
+    int speed;
+    int polarity;
+    int phase;
+};
+# 109 "/root/repo/src/drivers/ports/linux/spi_port.h"
+int spi_port_device_add_slave(struct spi_device_t *dev_p,
+                              struct spi_port_slave_t *slave_p,
+                              const struct pin_device_t *ss_pin_p,
+                              spi_port_slave_transfer_t transfer,
+                              void *arg_p);
+# 36 "/root/repo/src/drivers/network/spi.h" 2
+# 50 "/root/repo/src/drivers/network/spi.h"
+extern struct spi_device_t spi_device[16];
+
+
+
+
+struct spi_transfer_t {
+
+    void *rxbuf_p;
+
+    const void *txbuf_p;
+    size_t size;
+
+
+    int deselect;
+};
+
+struct spi_transaction_t;
+# 75 "/root/repo/src/drivers/network/spi.h"
+typedef void (*spi_transaction_callback_t)(
+    void *arg_p,
+    struct spi_transaction_t *transaction_p);
+
+struct spi_transaction_t {
+    struct spi_driver_t *drv_p;
+    struct spi_transfer_t *transfers_p;
+    size_t number_of_transfers;
+    spi_transaction_callback_t callback;
+    void *arg_p;
+    struct transaction_t base;
+};
+# 97 "/root/repo/src/drivers/network/spi.h"
+int spi_module_init(void);
+# 112 "/root/repo/src/drivers/network/spi.h"
+int spi_init(struct spi_driver_t *self_p,
+             struct spi_device_t *dev_p,
+             struct pin_device_t *ss_pin_p,
+             int mode,
+             int speed,
+             int polarity,
+             int phase);
+# 127 "/root/repo/src/drivers/network/spi.h"
+int spi_start(struct spi_driver_t *self_p);
+# 137 "/root/repo/src/drivers/network/spi.h"
+int spi_stop(struct spi_driver_t *self_p);
+# 148 "/root/repo/src/drivers/network/spi.h"
+int spi_take_bus(struct spi_driver_t *self_p);
+# 158 "/root/repo/src/drivers/network/spi.h"
+int spi_give_bus(struct spi_driver_t *self_p);
+# 167 "/root/repo/src/drivers/network/spi.h"
+int spi_select(struct spi_driver_t *self_p);
+# 176 "/root/repo/src/drivers/network/spi.h"
+int spi_deselect(struct spi_driver_t *self_p);
+# 188 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_transfer(struct spi_driver_t *self_p,
+                     void *rxbuf_p,
+                     const void *txbuf_p,
+                     size_t size);
+# 202 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_read(struct spi_driver_t *self_p,
+                 void *buf_p,
+                 size_t size);
+# 215 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_write(struct spi_driver_t *self_p,
+                  const void *buf_p,
+                  size_t size);
+# 227 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_get(struct spi_driver_t *self_p, uint8_t *data_p);
+# 237 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_put(struct spi_driver_t *self_p, uint8_t data);
+# 254 "/root/repo/src/drivers/network/spi.h"
+int spi_transaction_init(struct spi_transaction_t *self_p,
+                         struct spi_driver_t *drv_p,
+                         struct spi_transfer_t *transfers_p,
+                         size_t number_of_transfers,
+                         spi_transaction_callback_t callback,
+                         void *arg_p);
+# 272 "/root/repo/src/drivers/network/spi.h"
+int spi_async_transaction(struct spi_transaction_t *self_p);
+# 281 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_transaction_wait(struct spi_transaction_t *self_p);
+# 290 "/root/repo/src/drivers/network/spi.h"
+ssize_t spi_transaction(struct spi_transaction_t *self_p);
+# 170 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/uart.h" 1
+# 35 "/root/repo/src/drivers/network/uart.h"
+# 1 "/root/repo/src/drivers/ports/linux/uart_port.h" 1
+# 41 "/root/repo/src/drivers/ports/linux/uart_port.h"
+struct uart_device_t {
+    struct uart_driver_t *drv_p;
+};
+
+struct uart_driver_t {
+    struct queue_t base;
+    struct uart_device_t *dev_p;
+    struct mutex_t mutex;
+    long baudrate;
+    int format;
+};
+# 36 "/root/repo/src/drivers/network/uart.h" 2
+# 85 "/root/repo/src/drivers/network/uart.h"
+typedef int (*uart_rx_filter_cb_t)(char c);
+
+extern struct uart_device_t uart_device[16];
+# 98 "/root/repo/src/drivers/network/uart.h"
+int uart_module_init(void);
+# 111 "/root/repo/src/drivers/network/uart.h"
+int uart_init(struct uart_driver_t *self_p,
+              struct uart_device_t *dev_p,
+              long baudrate,
+              void *rxbuf_p,
+              size_t size);
+# 125 "/root/repo/src/drivers/network/uart.h"
+int uart_set_rx_filter_cb(struct uart_driver_t *self_p,
+                          uart_rx_filter_cb_t rx_filter_cb);
+# 135 "/root/repo/src/drivers/network/uart.h"
+int uart_start(struct uart_driver_t *self_p);
+# 144 "/root/repo/src/drivers/network/uart.h"
+int uart_stop(struct uart_driver_t *self_p);
+# 156 "/root/repo/src/drivers/network/uart.h"
+int uart_set_frame_format(struct uart_driver_t *self_p, int format);
+# 193 "/root/repo/src/drivers/network/uart.h"
+int uart_device_start(struct uart_device_t *dev_p,
+                      long baudrate);
+# 203 "/root/repo/src/drivers/network/uart.h"
+int uart_device_stop(struct uart_device_t *dev_p);
+# 216 "/root/repo/src/drivers/network/uart.h"
+ssize_t uart_device_read(struct uart_device_t *dev_p,
+                         void *buf_p,
+                         size_t size);
+# 230 "/root/repo/src/drivers/network/uart.h"
+ssize_t uart_device_write(struct uart_device_t *dev_p,
+                          const void *buf_p,
+                          size_t size);
+# 173 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/storage/sd.h" 1
+# 55 "/root/repo/src/drivers/storage/sd.h"
+struct sd_cid_t {
+    uint8_t mid;
+    char oid[2];
+    char pnm[5];
+    uint8_t prv;
+    uint32_t psn;
+    uint16_t mdt;
+    uint8_t crc;
+} __attribute__((packed));
+# 87 "/root/repo/src/drivers/storage/sd.h"
+struct sd_csd_v1_t {
+    uint8_t reserved1 : 6;
+    uint8_t csd_structure : 2;
+    uint8_t taac;
+    uint8_t nsac;
+    uint8_t tran_speed;
+    uint8_t ccc_high;
+    uint8_t read_bl_len : 4;
+    uint8_t ccc_low : 4;
+    uint8_t c_size_high : 2;
+    uint8_t reserved2 : 2;
+    uint8_t dsr_imp : 1;
+    uint8_t read_blk_misalign : 1;
+    uint8_t write_blk_misalign : 1;
+    uint8_t read_bl_partial : 1;
+    uint8_t c_size_mid;
+    uint8_t vdd_r_curr_max : 3;
+    uint8_t vdd_r_curr_min : 3;
+    uint8_t c_size_low : 2;
+    uint8_t c_size_mult_high : 2;
+    uint8_t vdd_w_curr_max : 3;
+    uint8_t vdd_w_curr_min : 3;
+    uint8_t sector_size_high : 6;
+    uint8_t erase_blk_en : 1;
+    uint8_t c_size_mult_low : 1;
+    uint8_t wp_grp_size : 7;
+    uint8_t sector_size_low : 1;
+    uint8_t write_bl_len_high : 2;
+    uint8_t r2w_factor : 3;
+    uint8_t reserved3 : 2;
+    uint8_t wp_grp_enable : 1;
+    uint8_t reserved4 : 5;
+    uint8_t write_bl_partial : 1;
+    uint8_t write_bl_len_low : 2;
+    uint8_t reserved5 : 2;
+    uint8_t file_format : 2;
+    uint8_t tmp_write_protect : 1;
+    uint8_t perm_write_protect : 1;
+    uint8_t copy : 1;
+    uint8_t file_format_grp : 1;
+    uint8_t crc;
+} __attribute__((packed));
+
+
+struct sd_csd_v2_t {
+    uint8_t reserved1 : 6;
+    uint8_t csd_structure : 2;
+    uint8_t taac;
+    uint8_t nsac;
+    uint8_t tran_speed;
+    uint8_t ccc_high;
+    uint8_t read_bl_len : 4;
+    uint8_t ccc_low : 4;
+    uint8_t reserved2 : 4;
+    uint8_t dsr_imp : 1;
+    uint8_t read_blk_misalign : 1;
+    uint8_t write_blk_misalign : 1;
+    uint8_t read_bl_partial : 1;
+    uint8_t c_size_high : 6;
+    uint8_t reserved3 : 2;
+    uint8_t c_size_mid;
+    uint8_t c_size_low;
+    uint8_t sector_size_high : 6;
+    uint8_t erase_blk_en : 1;
+    uint8_t reserved4 : 1;
+    uint8_t wp_grp_size : 7;
+    uint8_t sector_size_low : 1;
+    uint8_t write_bl_len_high : 2;
+    uint8_t r2w_factor : 3;
+    uint8_t reserved5 : 2;
+    uint8_t wp_grp_enable : 1;
+    uint8_t reserved6 : 5;
+    uint8_t write_bl_partial : 1;
+    uint8_t write_bl_len_low : 2;
+    uint8_t reserved7 : 2;
+    uint8_t file_format : 2;
+    uint8_t tmp_write_protect : 1;
+    uint8_t perm_write_protect : 1;
+    uint8_t copy : 1;
+    uint8_t file_format_grp : 1;
+    uint8_t crc;
+} __attribute__((packed));
+
+
+union sd_csd_t {
+    struct sd_csd_v1_t v1;
+    struct sd_csd_v2_t v2;
+};
+
+struct sd_driver_t {
+    struct spi_driver_t *spi_p;
+    int type;
+};
+# 188 "/root/repo/src/drivers/storage/sd.h"
+int sd_init(struct sd_driver_t *self_p,
+            struct spi_driver_t *spi_p);
+# 199 "/root/repo/src/drivers/storage/sd.h"
+int sd_start(struct sd_driver_t *self_p);
+# 208 "/root/repo/src/drivers/storage/sd.h"
+int sd_stop(struct sd_driver_t *self_p);
+# 220 "/root/repo/src/drivers/storage/sd.h"
+ssize_t sd_read_cid(struct sd_driver_t *self_p,
+                    struct sd_cid_t* cid_p);
+# 232 "/root/repo/src/drivers/storage/sd.h"
+ssize_t sd_read_csd(struct sd_driver_t *self_p,
+                    union sd_csd_t* csd_p);
+# 260 "/root/repo/src/drivers/storage/sd.h"
+ssize_t sd_read_block(struct sd_driver_t *self_p,
+                      void *dst_p,
+                      uint32_t src_block);
+# 273 "/root/repo/src/drivers/storage/sd.h"
+ssize_t sd_write_block(struct sd_driver_t *self_p,
+                       uint32_t dst_block,
+                       const void *src_p);
+# 176 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/sensors/ds18b20.h" 1
+# 42 "/root/repo/src/drivers/sensors/ds18b20.h"
+struct ds18b20_driver_t {
+    struct owi_driver_t *owi_p;
+    struct ds18b20_driver_t *next_p;
+};
+# 56 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_module_init(void);
+# 67 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_init(struct ds18b20_driver_t *self_p,
+                 struct owi_driver_t *owi_p);
+# 78 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_convert(struct ds18b20_driver_t *self_p);
+# 90 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_convert_start(struct ds18b20_driver_t *self_p);
+# 101 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_read(struct ds18b20_driver_t *self_p,
+                 const uint8_t *id_p,
+                 float *temperature_p);
+# 117 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_read_fixed_point(struct ds18b20_driver_t *self_p,
+                             const uint8_t *id_p,
+                             int *temperature_p);
+# 131 "/root/repo/src/drivers/sensors/ds18b20.h"
+char *ds18b20_read_string(struct ds18b20_driver_t *self_p,
+                          const uint8_t *id_p,
+                          char *temperature_p);
+# 148 "/root/repo/src/drivers/sensors/ds18b20.h"
+int ds18b20_get_temperature(struct ds18b20_driver_t *self_p,
+                            const uint8_t *id_p,
+                            int *temperature_p)
+    __attribute__ ((deprecated("Use ds18b20_read_fixed_point() instead.")));
+# 162 "/root/repo/src/drivers/sensors/ds18b20.h"
+char *ds18b20_get_temperature_str(struct ds18b20_driver_t *self_p,
+                                  const uint8_t *id_p,
+                                  char *temperature_p)
+    __attribute__ ((deprecated("Use ds18b20_read_string() instead.")));
+# 179 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/owi.h" 1
+# 43 "/root/repo/src/drivers/network/owi.h"
+struct owi_device_t {
+    uint8_t id[8];
+};
+
+struct owi_driver_t {
+    struct pin_driver_t pin;
+    struct owi_device_t *devices_p;
+    size_t nmemb;
+    size_t len;
+};
+# 64 "/root/repo/src/drivers/network/owi.h"
+int owi_init(struct owi_driver_t *self_p,
+             struct pin_device_t *dev_p,
+             struct owi_device_t *devices_p,
+             size_t nmemb);
+# 78 "/root/repo/src/drivers/network/owi.h"
+int owi_reset(struct owi_driver_t *self_p);
+# 89 "/root/repo/src/drivers/network/owi.h"
+int owi_search(struct owi_driver_t *self_p);
+# 100 "/root/repo/src/drivers/network/owi.h"
+ssize_t owi_read(struct owi_driver_t *self_p,
+                 void *buf_p,
+                 size_t size);
+# 113 "/root/repo/src/drivers/network/owi.h"
+ssize_t owi_write(struct owi_driver_t *self_p,
+                  const void *buf_p,
+                  size_t size);
+# 182 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/storage/flash.h" 1
+# 35 "/root/repo/src/drivers/storage/flash.h"
+# 1 "/root/repo/src/drivers/ports/linux/flash_port.h" 1
+# 34 "/root/repo/src/drivers/ports/linux/flash_port.h"
+struct flash_device_t {
+    struct mutex_t mutex;
+
+    struct {
+        uint8_t *buf_p;
+        uintptr_t address;
+        size_t size;
+    } memory;
+    struct {
+        uint32_t reads;
+        uint32_t writes;
+        uint32_t erases;
+        uint32_t bytes_read;
+        uint32_t bytes_written;
+        uint32_t bytes_erased;
+    } counters;
+};
+
+struct flash_driver_t {
+    struct flash_device_t *dev_p;
+};
+# 70 "/root/repo/src/drivers/ports/linux/flash_port.h"
+int flash_port_device_set_memory(struct flash_device_t *dev_p,
+                                 void *buf_p,
+                                 uintptr_t address,
+                                 size_t size);
+# 36 "/root/repo/src/drivers/storage/flash.h" 2
+
+extern struct flash_device_t flash_device[16];
+# 48 "/root/repo/src/drivers/storage/flash.h"
+int flash_module_init(void);
+# 58 "/root/repo/src/drivers/storage/flash.h"
+int flash_init(struct flash_driver_t *self_p,
+               struct flash_device_t *dev_p);
+# 71 "/root/repo/src/drivers/storage/flash.h"
+ssize_t flash_read(struct flash_driver_t *self_p,
+                   void *dst_p,
+                   uintptr_t src,
+                   size_t size);
+# 86 "/root/repo/src/drivers/storage/flash.h"
+ssize_t flash_write(struct flash_driver_t *self_p,
+                    uintptr_t dst,
+                    const void *src_p,
+                    size_t size);
+# 100 "/root/repo/src/drivers/storage/flash.h"
+int flash_erase(struct flash_driver_t *self_p,
+                uintptr_t addr,
+                size_t size);
+# 185 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/analog_input_pin.h" 1
+# 36 "/root/repo/src/drivers/basic/analog_input_pin.h"
+struct analog_input_pin_t {
+    struct adc_driver_t adc;
+};
+# 49 "/root/repo/src/drivers/basic/analog_input_pin.h"
+int analog_input_pin_module_init(void);
+# 59 "/root/repo/src/drivers/basic/analog_input_pin.h"
+int analog_input_pin_init(struct analog_input_pin_t *self_p,
+                          struct pin_device_t *dev_p);
+# 69 "/root/repo/src/drivers/basic/analog_input_pin.h"
+int analog_input_pin_read(struct analog_input_pin_t *self_p);
+# 79 "/root/repo/src/drivers/basic/analog_input_pin.h"
+int analog_input_pin_read_isr(struct analog_input_pin_t *self_p);
+# 188 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/basic/analog_output_pin.h" 1
+# 36 "/root/repo/src/drivers/basic/analog_output_pin.h"
+struct analog_output_pin_t {
+    struct pwm_driver_t pwm;
+};
+# 49 "/root/repo/src/drivers/basic/analog_output_pin.h"
+int analog_output_pin_module_init(void);
+# 59 "/root/repo/src/drivers/basic/analog_output_pin.h"
+int analog_output_pin_init(struct analog_output_pin_t *self_p,
+                           struct pin_device_t *dev_p);
+# 72 "/root/repo/src/drivers/basic/analog_output_pin.h"
+int analog_output_pin_write(struct analog_output_pin_t *self_p,
+                            int value);
+# 83 "/root/repo/src/drivers/basic/analog_output_pin.h"
+int analog_output_pin_read(struct analog_output_pin_t *self_p);
+# 191 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/can.h" 1
+# 35 "/root/repo/src/drivers/network/can.h"
+# 1 "/root/repo/src/drivers/ports/linux/can_port.h" 1
+# 38 "/root/repo/src/drivers/ports/linux/can_port.h"
+struct can_device_t {
+    struct can_driver_t *drv_p;
+};
+
+struct can_driver_t {
+    struct chan_t base;
+    struct can_device_t *dev_p;
+    struct queue_t chin;
+    struct mutex_t mutex;
+};
+# 36 "/root/repo/src/drivers/network/can.h" 2
+
+
+
+
+
+struct can_frame_t {
+    uint32_t id;
+    struct {
+        uint8_t extended_frame : 1;
+        uint8_t rtr : 1;
+        uint8_t size : 4;
+    };
+
+    uint32_t timestamp;
+
+
+    union {
+        uint8_t u8[8];
+        uint32_t u32[2];
+    } data;
+};
+
+extern struct can_device_t can_device[16];
+# 69 "/root/repo/src/drivers/network/can.h"
+int can_module_init(void);
+# 83 "/root/repo/src/drivers/network/can.h"
+int can_init(struct can_driver_t *self_p,
+             struct can_device_t *dev_p,
+             uint32_t speed,
+             void *rxbuf_p,
+             size_t size);
+# 97 "/root/repo/src/drivers/network/can.h"
+int can_start(struct can_driver_t *self_p);
+# 106 "/root/repo/src/drivers/network/can.h"
+int can_stop(struct can_driver_t *self_p);
+# 119 "/root/repo/src/drivers/network/can.h"
+ssize_t can_read(struct can_driver_t *self_p,
+                 struct can_frame_t *frame_p,
+                 size_t size);
+# 134 "/root/repo/src/drivers/network/can.h"
+ssize_t can_write(struct can_driver_t *self_p,
+                  const struct can_frame_t *frame_p,
+                  size_t size);
+# 194 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/i2c.h" 1
+# 36 "/root/repo/src/drivers/network/i2c.h"
+struct i2c_message_t;
+
+
+
+
+# 1 "/root/repo/src/drivers/ports/linux/i2c_port.h" 1
+# 40 "/root/repo/src/drivers/ports/linux/i2c_port.h"
+struct i2c_driver_t;
+# 54 "/root/repo/src/drivers/ports/linux/i2c_port.h"
+typedef ssize_t (*i2c_port_slave_transfer_t)(void *arg_p,
+                                             int flags,
+                                             void *buf_p,
+                                             size_t size);
+
+
+
+
+struct i2c_port_slave_t {
+    int address;
+    i2c_port_slave_transfer_t transfer;
+    void *arg_p;
+    struct i2c_port_slave_t *next_p;
+};
+
+struct i2c_device_t {
+    struct i2c_driver_t *drv_p;
+    struct i2c_port_slave_t *slaves_p;
+
+    struct {
+        uint32_t starts;
+        uint32_t stops;
+        uint32_t bytes;
+
+        uint64_t busy_ns;
+    } counters;
+};
+
+struct i2c_driver_t {
+    struct i2c_device_t *dev_p;
+    long baudrate;
+};
+# 98 "/root/repo/src/drivers/ports/linux/i2c_port.h"
+int i2c_port_device_add_slave(struct i2c_device_t *dev_p,
+                              struct i2c_port_slave_t *slave_p,
+                              int address,
+                              i2c_port_slave_transfer_t transfer,
+                              void *arg_p);
+# 42 "/root/repo/src/drivers/network/i2c.h" 2
+# 54 "/root/repo/src/drivers/network/i2c.h"
+extern struct i2c_device_t i2c_device[16];
+
+
+
+
+struct i2c_message_t {
+
+    int flags;
+    void *buf_p;
+    size_t size;
+};
+
+struct i2c_transaction_t;
+# 75 "/root/repo/src/drivers/network/i2c.h"
+typedef void (*i2c_transaction_callback_t)(
+    void *arg_p,
+    struct i2c_transaction_t *transaction_p);
+
+struct i2c_transaction_t {
+    struct i2c_driver_t *drv_p;
+    int address;
+    struct i2c_message_t *messages_p;
+    size_t number_of_messages;
+    i2c_transaction_callback_t callback;
+    void *arg_p;
+    struct transaction_t base;
+};
+# 98 "/root/repo/src/drivers/network/i2c.h"
+int i2c_module_init(void);
+# 114 "/root/repo/src/drivers/network/i2c.h"
+int i2c_init(struct i2c_driver_t *self_p,
+             struct i2c_device_t *dev_p,
+             int baudrate,
+             int address);
+# 128 "/root/repo/src/drivers/network/i2c.h"
+int i2c_start(struct i2c_driver_t *self_p);
+# 138 "/root/repo/src/drivers/network/i2c.h"
+int i2c_stop(struct i2c_driver_t *self_p);
+# 150 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_read(struct i2c_driver_t *self_p,
+                 int address,
+                 void *buf_p,
+                 size_t size);
+# 165 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_write(struct i2c_driver_t *self_p,
+                  int address,
+                  const void *buf_p,
+                  size_t size);
+# 179 "/root/repo/src/drivers/network/i2c.h"
+int i2c_scan(struct i2c_driver_t *self_p, int address);
+# 195 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_transfer(struct i2c_driver_t *self_p,
+                     int address,
+                     struct i2c_message_t *messages_p,
+                     size_t number_of_messages);
+# 214 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_write_read(struct i2c_driver_t *self_p,
+                       int address,
+                       const void *txbuf_p,
+                       size_t txsize,
+                       void *rxbuf_p,
+                       size_t rxsize);
+# 236 "/root/repo/src/drivers/network/i2c.h"
+int i2c_transaction_init(struct i2c_transaction_t *self_p,
+                         struct i2c_driver_t *drv_p,
+                         int address,
+                         struct i2c_message_t *messages_p,
+                         size_t number_of_messages,
+                         i2c_transaction_callback_t callback,
+                         void *arg_p);
+# 256 "/root/repo/src/drivers/network/i2c.h"
+int i2c_async_transaction(struct i2c_transaction_t *self_p);
+# 265 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_transaction_wait(struct i2c_transaction_t *self_p);
+# 274 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_transaction(struct i2c_transaction_t *self_p);
+# 286 "/root/repo/src/drivers/network/i2c.h"
+int i2c_slave_start(struct i2c_driver_t *self_p);
+# 296 "/root/repo/src/drivers/network/i2c.h"
+int i2c_slave_stop(struct i2c_driver_t *self_p);
+# 308 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_slave_read(struct i2c_driver_t *self_p,
+                       void *buf_p,
+                       size_t size);
+# 322 "/root/repo/src/drivers/network/i2c.h"
+ssize_t i2c_slave_write(struct i2c_driver_t *self_p,
+                        const void *buf_p,
+                        size_t size);
+# 197 "/root/repo/src/simba.h" 2
+
+
+
+
+
+# 1 "/root/repo/src/drivers/various/ds3231.h" 1
+# 36 "/root/repo/src/drivers/various/ds3231.h"
+struct ds3231_driver_t {
+    struct i2c_driver_t *i2c_p;
+};
+# 48 "/root/repo/src/drivers/various/ds3231.h"
+int ds3231_init(struct ds3231_driver_t *self_p,
+                struct i2c_driver_t *i2c_p);
+# 59 "/root/repo/src/drivers/various/ds3231.h"
+int ds3231_set_date(struct ds3231_driver_t *self_p,
+                    struct date_t *date_p);
+# 70 "/root/repo/src/drivers/various/ds3231.h"
+int ds3231_get_date(struct ds3231_driver_t *self_p,
+                    struct date_t *date_p);
+# 203 "/root/repo/src/simba.h" 2
+# 235 "/root/repo/src/simba.h"
+# 1 "/root/repo/src/drivers/basic/random.h" 1
+# 35 "/root/repo/src/drivers/basic/random.h"
+# 1 "/root/repo/src/drivers/ports/linux/random_port.h" 1
+# 36 "/root/repo/src/drivers/basic/random.h" 2
+# 46 "/root/repo/src/drivers/basic/random.h"
+int random_module_init(void);
+
+
+
+
+
+
+uint32_t random_read(void);
+# 236 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h" 1
+# 34 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+struct led_7seg_ht16k33_driver_t {
+    struct i2c_soft_driver_t *i2c_p;
+    int i2c_addr;
+    uint8_t buf[5];
+};
+# 56 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_module_init(void);
+# 69 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_init(struct led_7seg_ht16k33_driver_t *self_p,
+                          struct i2c_soft_driver_t *i2c_p,
+                          int i2c_addr);
+
+
+
+
+
+
+
+int led_7seg_ht16k33_start(struct led_7seg_ht16k33_driver_t *self_p);
+# 88 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_display(struct led_7seg_ht16k33_driver_t *self_p);
+# 97 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_clear(struct led_7seg_ht16k33_driver_t *self_p);
+# 108 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_brightness(struct led_7seg_ht16k33_driver_t *self_p,
+                                int brightness);
+# 122 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_set_num(struct led_7seg_ht16k33_driver_t *self_p,
+                             int num,
+                             int base);
+# 134 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_show_colon(struct led_7seg_ht16k33_driver_t *self_p,
+                                int show_colon);
+# 146 "/root/repo/src/drivers/displays/led_7seg_ht16k33.h"
+int led_7seg_ht16k33_show_dot(struct led_7seg_ht16k33_driver_t *self_p,
+                              int position,
+                              int show_colon);
+# 239 "/root/repo/src/simba.h" 2
+
+
+
+
+
+# 1 "/root/repo/src/drivers/sensors/sht3xd.h" 1
+# 36 "/root/repo/src/drivers/sensors/sht3xd.h"
+struct sht3xd_driver_t {
+    struct i2c_driver_t *i2c_p;
+    int i2c_addr;
+    uint32_t serial;
+
+
+
+};
+# 62 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_module_init(void);
+# 75 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_init(struct sht3xd_driver_t *self_p,
+                struct i2c_driver_t *i2c_p,
+                int i2c_addr);
+# 88 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_start(struct sht3xd_driver_t *self_p);
+# 102 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_get_temp_humid(struct sht3xd_driver_t *self_p,
+                          float *temp_p,
+                          float *humid_p);
+# 115 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_measure_start(struct sht3xd_driver_t *self_p);
+# 127 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_measure_read(struct sht3xd_driver_t *self_p,
+                        float *temp_p,
+                        float *humid_p);
+# 139 "/root/repo/src/drivers/sensors/sht3xd.h"
+int sht3xd_get_serial(struct sht3xd_driver_t *self_p,
+                      uint32_t *serial_p);
+# 245 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/storage/eeprom_soft.h" 1
+# 36 "/root/repo/src/drivers/storage/eeprom_soft.h"
+struct eeprom_soft_block_t {
+    uintptr_t address;
+    size_t size;
+};
+
+struct eeprom_soft_driver_t {
+    struct flash_driver_t *flash_p;
+    const struct eeprom_soft_block_t *blocks_p;
+    int number_of_blocks;
+    size_t chunk_size;
+    size_t eeprom_size;
+    struct {
+        const struct eeprom_soft_block_t *block_p;
+        uintptr_t chunk_address;
+        uint16_t revision;
+    } current;
+
+    struct mutex_t mutex;
+
+};
+# 66 "/root/repo/src/drivers/storage/eeprom_soft.h"
+int eeprom_soft_module_init(void);
+# 82 "/root/repo/src/drivers/storage/eeprom_soft.h"
+int eeprom_soft_init(struct eeprom_soft_driver_t *self_p,
+                     struct flash_driver_t *flash_p,
+                     const struct eeprom_soft_block_t *blocks_p,
+                     int number_of_blocks,
+                     size_t chunk_size);
+# 95 "/root/repo/src/drivers/storage/eeprom_soft.h"
+int eeprom_soft_mount(struct eeprom_soft_driver_t *self_p);
+# 104 "/root/repo/src/drivers/storage/eeprom_soft.h"
+int eeprom_soft_format(struct eeprom_soft_driver_t *self_p);
+# 117 "/root/repo/src/drivers/storage/eeprom_soft.h"
+ssize_t eeprom_soft_read(struct eeprom_soft_driver_t *self_p,
+                         void *dst_p,
+                         uintptr_t src,
+                         size_t size);
+# 133 "/root/repo/src/drivers/storage/eeprom_soft.h"
+ssize_t eeprom_soft_write(struct eeprom_soft_driver_t *self_p,
+                          uintptr_t dst,
+                          const void *src_p,
+                          size_t size);
+# 248 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/storage/eeprom_i2c.h" 1
+# 36 "/root/repo/src/drivers/storage/eeprom_i2c.h"
+struct eeprom_i2c_driver_t {
+    struct i2c_driver_t *i2c_p;
+    int i2c_address;
+    uint32_t size;
+};
+# 51 "/root/repo/src/drivers/storage/eeprom_i2c.h"
+int eeprom_i2c_module_init(void);
+# 63 "/root/repo/src/drivers/storage/eeprom_i2c.h"
+int eeprom_i2c_init(struct eeprom_i2c_driver_t *self_p,
+                    struct i2c_driver_t *i2c_p,
+                    int i2c_address,
+                    uint32_t size);
+# 78 "/root/repo/src/drivers/storage/eeprom_i2c.h"
+ssize_t eeprom_i2c_read(struct eeprom_i2c_driver_t *self_p,
+                        void *dst_p,
+                        uint32_t src,
+                        size_t size);
+# 93 "/root/repo/src/drivers/storage/eeprom_i2c.h"
+ssize_t eeprom_i2c_write(struct eeprom_i2c_driver_t *self_p,
+                         uint32_t dst,
+                         const void *src_p,
+                         size_t size);
+# 251 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/xbee.h" 1
+# 94 "/root/repo/src/drivers/network/xbee.h"
+struct xbee_frame_t {
+    uint8_t type;
+    struct {
+        uint8_t buf[120];
+        size_t size;
+    } data;
+};
+
+
+struct xbee_driver_t {
+    struct {
+        struct chan_t *chin_p;
+        struct chan_t *chout_p;
+    } transport;
+    struct {
+        uint8_t buf[32];
+        size_t pos;
+        size_t size;
+    } rx;
+};
+# 124 "/root/repo/src/drivers/network/xbee.h"
+int xbee_module_init(void);
+# 137 "/root/repo/src/drivers/network/xbee.h"
+int xbee_init(struct xbee_driver_t *self_p,
+              void *chin_p,
+              void *chout_p);
+# 150 "/root/repo/src/drivers/network/xbee.h"
+int xbee_read(struct xbee_driver_t *self_p,
+              struct xbee_frame_t *frame_p);
+# 162 "/root/repo/src/drivers/network/xbee.h"
+int xbee_write(struct xbee_driver_t *self_p,
+               const struct xbee_frame_t *frame_p);
+# 174 "/root/repo/src/drivers/network/xbee.h"
+int xbee_print_frame(void *chan_p, struct xbee_frame_t *frame_p);
+# 184 "/root/repo/src/drivers/network/xbee.h"
+const char *xbee_frame_type_as_string(uint8_t frame_type);
+# 194 "/root/repo/src/drivers/network/xbee.h"
+const char *xbee_tx_status_as_string(uint8_t tx_status);
+# 204 "/root/repo/src/drivers/network/xbee.h"
+const char *xbee_modem_status_as_string(uint8_t modem_status);
+# 214 "/root/repo/src/drivers/network/xbee.h"
+const char *xbee_at_command_response_status_as_string(uint8_t response_status);
+# 254 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/xbee_client.h" 1
+# 48 "/root/repo/src/drivers/network/xbee_client.h"
+enum xbee_client_address_type_t {
+    xbee_client_address_type_invalid_t = 0,
+    xbee_client_address_type_16_bits_t,
+    xbee_client_address_type_64_bits_t
+};
+
+struct xbee_client_address_t {
+    enum xbee_client_address_type_t type;
+    uint8_t buf[8];
+};
+# 66 "/root/repo/src/drivers/network/xbee_client.h"
+typedef void (*xbee_client_write_cb_t)(void *arg_p, int res);
+
+
+struct xbee_client_request_t {
+
+    uint8_t frame_id;
+    struct cond_t cond;
+    uint8_t *buf_p;
+    size_t *size_p;
+    int res;
+    xbee_client_write_cb_t callback;
+    void *arg_p;
+    struct time_t deadline;
+};
+
+
+struct xbee_client_t {
+    struct queue_t chin;
+    struct xbee_driver_t driver;
+    uint8_t frame_id;
+    struct {
+        uint8_t value;
+    } pins;
+    struct {
+        struct mutex_t mutex;
+
+        struct cond_t cond;
+        struct xbee_client_request_t
+        requests[4];
+    } rpc;
+
+
+
+};
+# 110 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_module_init(void);
+# 127 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_init(struct xbee_client_t *self_p,
+                     void *chin_p,
+                     void *chout_p,
+                     void *buf_p,
+                     size_t size,
+                     int flags);
+# 141 "/root/repo/src/drivers/network/xbee_client.h"
+void *xbee_client_main(void *arg_p);
+# 154 "/root/repo/src/drivers/network/xbee_client.h"
+ssize_t xbee_client_read_from(struct xbee_client_t *self_p,
+                              void *buf_p,
+                              size_t size,
+                              struct xbee_client_address_t *address_p);
+# 172 "/root/repo/src/drivers/network/xbee_client.h"
+ssize_t xbee_client_write_to(struct xbee_client_t *self_p,
+                             const void *buf_p,
+                             size_t size,
+                             int flags,
+                             struct xbee_client_address_t *address_p);
+# 198 "/root/repo/src/drivers/network/xbee_client.h"
+ssize_t xbee_client_write_to_async(struct xbee_client_t *self_p,
+                                   const void *buf_p,
+                                   size_t size,
+                                   struct xbee_client_address_t *address_p,
+                                   xbee_client_write_cb_t callback,
+                                   void *arg_p);
+# 214 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_pin_set_mode(struct xbee_client_t *self_p,
+                             int pin,
+                             int mode);
+# 226 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_pin_read(struct xbee_client_t *self_p,
+                         int pin);
+# 238 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_pin_write(struct xbee_client_t *self_p,
+                          int pin,
+                          int value);
+# 250 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_pin_toggle(struct xbee_client_t *self_p,
+                           int pin);
+# 262 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_pin_convert(struct xbee_client_t *self_p,
+                            int pin);
+# 276 "/root/repo/src/drivers/network/xbee_client.h"
+ssize_t xbee_client_at_command_read(struct xbee_client_t *self_p,
+                                    const char *command_p,
+                                    uint8_t *parameter_p,
+                                    size_t size);
+# 291 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_write(struct xbee_client_t *self_p,
+                                 const char *command_p,
+                                 const uint8_t *parameter_p,
+                                 size_t size);
+# 306 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_read_u8(struct xbee_client_t *self_p,
+                                   const char *command_p,
+                                   uint8_t *parameter_p);
+# 319 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_write_u8(struct xbee_client_t *self_p,
+                                    const char *command_p,
+                                    uint8_t parameter);
+# 333 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_read_u16(struct xbee_client_t *self_p,
+                                    const char *command_p,
+                                    uint16_t *parameter_p);
+# 346 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_write_u16(struct xbee_client_t *self_p,
+                                     const char *command_p,
+                                     uint16_t parameter);
+# 360 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_read_u32(struct xbee_client_t *self_p,
+                                    const char *command_p,
+                                    uint32_t *parameter_p);
+# 373 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_at_command_write_u32(struct xbee_client_t *self_p,
+                                     const char *command_p,
+                                     uint32_t parameter);
+# 385 "/root/repo/src/drivers/network/xbee_client.h"
+int xbee_client_print_address(void *chan_p,
+                              struct xbee_client_address_t *address_p);
+# 257 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/sensors/hx711.h" 1
+# 36 "/root/repo/src/drivers/sensors/hx711.h"
+enum hx711_channel_gain_t {
+    hx711_channel_gain_a_128_t = 1,
+    hx711_channel_gain_b_32_t,
+    hx711_channel_gain_a_64_t
+};
+
+
+struct hx711_driver_t {
+    struct pin_device_t *pd_sck_p;
+    struct pin_device_t *dout_p;
+    float scale;
+    float offset;
+};
+# 59 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_module_init(void);
+# 74 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_init(struct hx711_driver_t *self_p,
+               struct pin_device_t *pd_sck_p,
+               struct pin_device_t *dout_p,
+               float scale,
+               float offset);
+# 87 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_start(struct hx711_driver_t *self_p);
+# 96 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_stop(struct hx711_driver_t *self_p);
+# 108 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_read(struct hx711_driver_t *self_p,
+               float *weight_p,
+               enum hx711_channel_gain_t channel_gain);
+# 123 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_read_raw(struct hx711_driver_t *self_p,
+                   int32_t *sample_p,
+                   enum hx711_channel_gain_t channel_gain);
+# 136 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_set_scale(struct hx711_driver_t *self_p,
+                    float scale);
+# 148 "/root/repo/src/drivers/sensors/hx711.h"
+int hx711_set_offset(struct hx711_driver_t *self_p,
+                     float offset);
+# 260 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/sensors/sensor_hub.h" 1
+# 43 "/root/repo/src/drivers/sensors/sensor_hub.h"
+typedef int (*sensor_hub_convert_t)(void *arg_p);
+# 54 "/root/repo/src/drivers/sensors/sensor_hub.h"
+typedef ssize_t (*sensor_hub_read_t)(void *arg_p,
+                                     void *buf_p,
+                                     size_t size);
+
+
+
+
+struct sensor_hub_sample_t {
+
+    int id;
+
+    struct time_t timestamp;
+
+    int res;
+
+    uint8_t data[16];
+};
+
+struct sensor_hub_sensor_t {
+    int id;
+    sensor_hub_convert_t convert;
+    sensor_hub_read_t read;
+    void *arg_p;
+    struct time_t latency;
+    struct time_t period;
+    int state;
+    struct time_t timestamp;
+    struct time_t next_convert;
+    struct time_t ready;
+    struct {
+        uint32_t samples;
+        uint32_t errors;
+        uint32_t overruns;
+    } counters;
+    struct sensor_hub_sensor_t *next_p;
+};
+
+struct sensor_hub_t {
+    struct bus_t *bus_p;
+    struct sensor_hub_sensor_t *sensors_p;
+    struct sensor_hub_sensor_t *tail_p;
+    struct thrd_t *thrd_p;
+    int is_waiting;
+};
+# 108 "/root/repo/src/drivers/sensors/sensor_hub.h"
+int sensor_hub_module_init(void);
+# 118 "/root/repo/src/drivers/sensors/sensor_hub.h"
+int sensor_hub_init(struct sensor_hub_t *self_p,
+                    struct bus_t *bus_p);
+# 138 "/root/repo/src/drivers/sensors/sensor_hub.h"
+int sensor_hub_sensor_init(struct sensor_hub_sensor_t *self_p,
+                           int id,
+                           sensor_hub_convert_t convert,
+                           sensor_hub_read_t read,
+                           void *arg_p,
+                           int latency_ms,
+                           int period_ms);
+# 155 "/root/repo/src/drivers/sensors/sensor_hub.h"
+int sensor_hub_add(struct sensor_hub_t *self_p,
+                   struct sensor_hub_sensor_t *sensor_p);
+# 168 "/root/repo/src/drivers/sensors/sensor_hub.h"
+void *sensor_hub_main(void *arg_p);
+# 263 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/various/gnss.h" 1
+# 36 "/root/repo/src/drivers/various/gnss.h"
+struct gnss_driver_t {
+    void *chin_p;
+    void *chout_p;
+    struct time_t rmc_timestamp;
+    struct time_t gga_timestamp;
+    struct date_t date;
+    struct {
+        long latitude_degrees;
+        long longitude_degrees;
+        struct time_t *timestamp_p;
+    } position;
+    long speed;
+    int number_of_satellites;
+    long altitude;
+    struct {
+        struct {
+            char buf[(80 + 3)];
+            size_t size;
+        } input;
+        struct nmea_sentence_t decoded;
+    } nmea;
+    struct {
+        uint8_t buf[64];
+        size_t pos;
+        size_t size;
+    } rx;
+    struct {
+        void *chout_p;
+    } ubx;
+
+
+
+};
+# 79 "/root/repo/src/drivers/various/gnss.h"
+int gnss_module_init(void);
+# 90 "/root/repo/src/drivers/various/gnss.h"
+int gnss_init(struct gnss_driver_t *self_p,
+              void *chin_p,
+              void *chout_p);
+# 105 "/root/repo/src/drivers/various/gnss.h"
+int gnss_set_ubx_output(struct gnss_driver_t *self_p,
+                        void *chan_p);
+# 132 "/root/repo/src/drivers/various/gnss.h"
+int gnss_read(struct gnss_driver_t *self_p);
+# 149 "/root/repo/src/drivers/various/gnss.h"
+int gnss_write(struct gnss_driver_t *self_p,
+               char *str_p);
+# 160 "/root/repo/src/drivers/various/gnss.h"
+int gnss_get_date(struct gnss_driver_t *self_p,
+                  struct date_t *date_p);
+# 174 "/root/repo/src/drivers/various/gnss.h"
+int gnss_get_position(struct gnss_driver_t *self_p,
+                      float *latitude_p,
+                      float *longitude_p);
+# 186 "/root/repo/src/drivers/various/gnss.h"
+int gnss_get_speed(struct gnss_driver_t *self_p,
+                   float *speed_p);
+# 199 "/root/repo/src/drivers/various/gnss.h"
+int gnss_get_number_of_satellites(struct gnss_driver_t *self_p,
+                                  int *number_of_satellites_p);
+# 210 "/root/repo/src/drivers/various/gnss.h"
+int gnss_get_altitude(struct gnss_driver_t *self_p,
+                      float *altitude_p);
+# 221 "/root/repo/src/drivers/various/gnss.h"
+int gnss_print(struct gnss_driver_t *self_p,
+               void *chan_p);
+# 266 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/sensors/bmp280.h" 1
+# 61 "/root/repo/src/drivers/sensors/bmp280.h"
+enum bmp280_mode_t {
+    bmp280_mode_forced_t = 1,
+    bmp280_mode_normal_t = 3
+};
+
+
+
+
+enum bmp280_standby_time_t {
+    bmp280_standby_time_500_us_t = 0,
+    bmp280_standby_time_62500_us_t,
+    bmp280_standby_time_125_ms_t,
+    bmp280_standby_time_250_ms_t,
+    bmp280_standby_time_500_ms_t,
+    bmp280_standby_time_1_s_t,
+    bmp280_standby_time_2_s_t,
+    bmp280_standby_time_4_s_t
+};
+
+
+
+
+enum bmp280_filter_t {
+    bmp280_filter_off_t = 0,
+    bmp280_filter_2_t,
+    bmp280_filter_4_t,
+    bmp280_filter_8_t,
+    bmp280_filter_16_t
+};
+
+
+
+
+enum bmp280_temperature_oversampling_t {
+    bmp280_temperature_off_t = 0,
+    bmp280_temperature_oversampling_1_t,
+    bmp280_temperature_oversampling_2_t,
+    bmp280_temperature_oversampling_4_t,
+    bmp280_temperature_oversampling_8_t,
+    bmp280_temperature_oversampling_16_t
+};
+
+
+
+
+enum bmp280_pressure_oversampling_t {
+    bmp280_pressure_off_t = 0,
+    bmp280_pressure_oversampling_1_t,
+    bmp280_pressure_oversampling_2_t,
+    bmp280_pressure_oversampling_4_t,
+    bmp280_pressure_oversampling_8_t,
+    bmp280_pressure_oversampling_16_t
+};
+
+
+
+
+struct bmp280_driver_t {
+    struct bmp280_transport_t *transport_p;
+    uint8_t ctrl_meas;
+    uint8_t config;
+    int16_t calibration[12];
+
+
+
+};
+
+struct bmp280_transport_protocol_t;
+
+struct bmp280_transport_t {
+    struct bmp280_transport_protocol_t *protocol_p;
+};
+
+struct bmp280_transport_i2c_t {
+    struct bmp280_transport_t base;
+    struct i2c_driver_t *i2c_p;
+    int i2c_address;
+};
+
+struct bmp280_transport_spi_t {
+    struct bmp280_transport_t base;
+    struct spi_driver_t *spi_p;
+};
+# 154 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_module_init(void);
+# 175 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_init(struct bmp280_driver_t *self_p,
+                struct bmp280_transport_t *transport_p,
+                enum bmp280_mode_t mode,
+                enum bmp280_standby_time_t standby_time,
+                enum bmp280_filter_t filter,
+                enum bmp280_temperature_oversampling_t temperature_oversampling,
+                enum bmp280_pressure_oversampling_t pressure_oversampling);
+# 192 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_start(struct bmp280_driver_t *self_p);
+# 201 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_stop(struct bmp280_driver_t *self_p);
+# 212 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_read(struct bmp280_driver_t *self_p,
+                float *temperature_p,
+                float *pressure_p);
+# 226 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_read_fixed_point(struct bmp280_driver_t *self_p,
+                            long *temperature_p,
+                            long *pressure_p);
+# 238 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_convert(struct bmp280_driver_t *self_p);
+# 250 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_read_converted_fixed_point(struct bmp280_driver_t *self_p,
+                                      long *temperature_p,
+                                      long *pressure_p);
+# 266 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_transport_i2c_init(struct bmp280_transport_i2c_t *self_p,
+                              struct i2c_driver_t *i2c_p,
+                              int i2c_address);
+# 278 "/root/repo/src/drivers/sensors/bmp280.h"
+int bmp280_transport_spi_init(struct bmp280_transport_spi_t *self_p,
+                              struct spi_driver_t *spi_p);
+# 269 "/root/repo/src/simba.h" 2
+# 277 "/root/repo/src/simba.h"
+# 1 "/root/repo/src/drivers/displays/hd44780.h" 1
+# 34 "/root/repo/src/drivers/displays/hd44780.h"
+struct hd44780_driver_t {
+    struct pin_device_t *rs_p;
+    struct pin_device_t *enable_p;
+    struct pin_device_t *data_4_p;
+    struct pin_device_t *data_5_p;
+    struct pin_device_t *data_6_p;
+    struct pin_device_t *data_7_p;
+    unsigned int number_of_rows;
+    unsigned int number_of_columns;
+    struct {
+        unsigned int row;
+        unsigned int column;
+    } cursor;
+    uint8_t display_on_off_control;
+};
+# 59 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_module_init(void);
+# 69 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_init(struct hd44780_driver_t *self_p,
+                 struct pin_device_t *rs_p,
+                 struct pin_device_t *enable_p,
+                 struct pin_device_t *data_4_p,
+                 struct pin_device_t *data_5_p,
+                 struct pin_device_t *data_6_p,
+                 struct pin_device_t *data_7_p,
+                 unsigned int number_of_rows,
+                 unsigned int number_of_columns);
+# 86 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_start(struct hd44780_driver_t *self_p);
+# 95 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_stop(struct hd44780_driver_t *self_p);
+# 105 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_display(struct hd44780_driver_t *self_p,
+                    const char *text_p);
+# 116 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_write(struct hd44780_driver_t *self_p,
+                  const char *text_p);
+# 127 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_put(struct hd44780_driver_t *self_p, char character);
+# 136 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_clear(struct hd44780_driver_t *self_p);
+# 146 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_cursor_move(struct hd44780_driver_t *self_p,
+                        unsigned int row,
+                        unsigned int column);
+# 157 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_cursor_show(struct hd44780_driver_t *self_p);
+# 166 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_cursor_hide(struct hd44780_driver_t *self_p);
+# 175 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_text_show(struct hd44780_driver_t *self_p);
+# 184 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_text_hide(struct hd44780_driver_t *self_p);
+# 193 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_scroll_left(struct hd44780_driver_t *self_p);
+# 202 "/root/repo/src/drivers/displays/hd44780.h"
+int hd44780_scroll_right(struct hd44780_driver_t *self_p);
+# 278 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/drivers/network/jtag_soft.h" 1
+# 36 "/root/repo/src/drivers/network/jtag_soft.h"
+struct jtag_soft_driver_t {
+    struct pin_device_t *tck_p;
+    struct pin_device_t *tms_p;
+    struct pin_device_t *tdi_p;
+    struct pin_device_t *tdo_p;
+    uint32_t tck_mask;
+
+
+    uint32_t tms_mask;
+    uint32_t tdi_mask;
+};
+# 57 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_module_init(void);
+# 70 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_init(struct jtag_soft_driver_t *self_p,
+                   struct pin_device_t *tck_p,
+                   struct pin_device_t *tms_p,
+                   struct pin_device_t *tdi_p,
+                   struct pin_device_t *tdo_p);
+# 84 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_start(struct jtag_soft_driver_t *self_p);
+# 94 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_stop(struct jtag_soft_driver_t *self_p);
+# 103 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_reset(struct jtag_soft_driver_t *self_p);
+# 114 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_instruction_write(struct jtag_soft_driver_t *self_p,
+                                const void *buf_p,
+                                size_t number_of_bits);
+# 128 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_data_transfer(struct jtag_soft_driver_t *self_p,
+                            void *rxbuf_p,
+                            const void *txbuf_p,
+                            size_t number_of_bits);
+# 142 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_data_read(struct jtag_soft_driver_t *self_p,
+                        void *buf_p,
+                        size_t number_of_bits);
+# 155 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_data_write(struct jtag_soft_driver_t *self_p,
+                         const void *buf_p,
+                         size_t number_of_bits);
+# 168 "/root/repo/src/drivers/network/jtag_soft.h"
+int jtag_soft_make_transition(struct jtag_soft_driver_t *self_p,
+                              int transition);
+# 281 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/inet/isotp.h" 1
+# 38 "/root/repo/src/inet/isotp.h"
+struct isotp_t {
+    uint8_t *message_p;
+    size_t size;
+    int state;
+    int flags;
+    struct {
+        size_t size;
+        size_t offset;
+        int next_index;
+    } message;
+};
+# 67 "/root/repo/src/inet/isotp.h"
+int isotp_init(struct isotp_t *self_p,
+               uint8_t *message_p,
+               size_t size,
+               int flags);
+# 89 "/root/repo/src/inet/isotp.h"
+ssize_t isotp_input(struct isotp_t *self_p,
+                    const uint8_t *buf_p,
+                    size_t size);
+# 109 "/root/repo/src/inet/isotp.h"
+ssize_t isotp_output(struct isotp_t *self_p,
+                     uint8_t *buf_p,
+                     size_t *size_p);
+# 284 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/debug/harness.h" 1
+# 159 "/root/repo/src/debug/harness.h"
+typedef int (*harness_testcase_cb_t)(void);
+# 172 "/root/repo/src/debug/harness.h"
+typedef int (*harness_mock_cb_t)(void *arg_p,
+                                 void *buf_p);
+
+struct harness_testcase_t {
+    harness_testcase_cb_t callback;
+    const char *name_p;
+};
+
+
+
+
+
+
+typedef void (*harness_bench_cb_t)(void *arg_p);
+
+struct harness_bench_t {
+    harness_bench_cb_t callback;
+    const char *name_p;
+    void *arg_p;
+
+    struct heap_t *heap_p;
+};
+
+struct harness_bench_result_t {
+
+    long iterations;
+    int samples;
+
+    long min_ns;
+    long median_ns;
+    long p99_ns;
+
+    long allocs;
+    long frees;
+};
+# 217 "/root/repo/src/debug/harness.h"
+int harness_run(struct harness_testcase_t *testcases_p);
+# 231 "/root/repo/src/debug/harness.h"
+int harness_bench_run(struct harness_bench_t *bench_p,
+                      struct harness_bench_result_t *result_p);
+# 244 "/root/repo/src/debug/harness.h"
+int harness_bench(struct harness_bench_t *benchmarks_p);
+# 258 "/root/repo/src/debug/harness.h"
+int harness_expect(void *chan_p,
+                   const char *pattern_p,
+                   const struct time_t *timeout_p);
+# 277 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_write(const char *id_p,
+                           const void *buf_p,
+                           size_t size);
+# 298 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_mwrite(const char *id_p,
+                            const void *buf_p,
+                            size_t size,
+                            int length);
+# 324 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_cwrite(const char *id_p,
+                            const void *buf_p,
+                            size_t size,
+                            harness_mock_cb_t cb,
+                            void *arg_p,
+                            size_t arg_size);
+# 343 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_read(const char *id_p,
+                          void *buf_p,
+                          size_t size);
+# 360 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_try_read(const char *id_p,
+                              void *buf_p,
+                              size_t size);
+# 376 "/root/repo/src/debug/harness.h"
+int harness_mock_assert(const char *id_p,
+                        const void *buf_p,
+                        size_t size);
+# 397 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_write_notify(const char *id_p,
+                                  const void *buf_p,
+                                  size_t size);
+# 413 "/root/repo/src/debug/harness.h"
+ssize_t harness_mock_read_wait(const char *id_p,
+                               void *buf_p,
+                               size_t size,
+                               struct time_t *timeout_p);
+# 426 "/root/repo/src/debug/harness.h"
+int harness_set_testcase_result(int result);
+
+
+
+
+
+
+int harness_get_testcase_result(void);
+# 286 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/multimedia/midi.h" 1
+# 170 "/root/repo/src/multimedia/midi.h"
+float midi_note_to_frequency(int note);
+# 288 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/inet/socket.h" 1
+# 49 "/root/repo/src/inet/socket.h"
+struct socket_t {
+    struct chan_t base;
+    int type;
+    struct {
+        union {
+            struct {
+                ssize_t left;
+            } common;
+            struct {
+                ssize_t left;
+
+                struct pbuf *pbuf_p;
+                struct inet_addr_t remote_addr;
+                int closed;
+            } recvfrom;
+            struct {
+                ssize_t left;
+                struct tcp_pcb *pcb_p;
+            } accept;
+        } u;
+        struct {
+            int state;
+            void *args_p;
+            struct thrd_t *thrd_p;
+        } cb;
+    } input;
+    struct {
+        struct {
+            int state;
+            void *args_p;
+            struct thrd_t *thrd_p;
+        } cb;
+    } output;
+    void *pcb_p;
+};
+# 95 "/root/repo/src/inet/socket.h"
+int socket_module_init(void);
+# 104 "/root/repo/src/inet/socket.h"
+int socket_open_tcp(struct socket_t *self_p);
+# 113 "/root/repo/src/inet/socket.h"
+int socket_open_udp(struct socket_t *self_p);
+# 122 "/root/repo/src/inet/socket.h"
+int socket_open_raw(struct socket_t *self_p);
+# 134 "/root/repo/src/inet/socket.h"
+int socket_open(struct socket_t *self_p,
+                int domain,
+                int type,
+                int protocol);
+# 147 "/root/repo/src/inet/socket.h"
+int socket_close(struct socket_t *self_p);
+# 157 "/root/repo/src/inet/socket.h"
+int socket_bind(struct socket_t *self_p,
+                const struct inet_addr_t *local_addr_p);
+# 169 "/root/repo/src/inet/socket.h"
+int socket_listen(struct socket_t *self_p, int backlog);
+# 181 "/root/repo/src/inet/socket.h"
+int socket_connect(struct socket_t *self_p,
+                   const struct inet_addr_t *remote_addr_p);
+# 199 "/root/repo/src/inet/socket.h"
+int socket_connect_by_hostname(struct socket_t *self_p,
+                               const char *hostname_p,
+                               uint16_t port);
+# 213 "/root/repo/src/inet/socket.h"
+int socket_accept(struct socket_t *self_p,
+                  struct socket_t *accepted_p,
+                  struct inet_addr_t *remote_addr_p);
+# 228 "/root/repo/src/inet/socket.h"
+ssize_t socket_sendto(struct socket_t *self_p,
+                      const void *buf_p,
+                      size_t size,
+                      int flags,
+                      const struct inet_addr_t *remote_addr_p);
+# 245 "/root/repo/src/inet/socket.h"
+ssize_t socket_recvfrom(struct socket_t *self_p,
+                        void *buf_p,
+                        size_t size,
+                        int flags,
+                        struct inet_addr_t *remote_addr_p);
+# 262 "/root/repo/src/inet/socket.h"
+ssize_t socket_write(struct socket_t *self_p,
+                     const void *buf_p,
+                     size_t size);
+# 275 "/root/repo/src/inet/socket.h"
+ssize_t socket_read(struct socket_t *self_p,
+                    void *buf_p,
+                    size_t size);
+# 287 "/root/repo/src/inet/socket.h"
+ssize_t socket_size(struct socket_t *self_p);
+# 290 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/inet/ssl.h" 1
+# 41 "/root/repo/src/inet/ssl.h"
+enum ssl_protocol_t {
+    ssl_protocol_tls_v1_0
+};
+
+enum ssl_verify_mode_t {
+    ssl_verify_mode_cert_none_t = 0,
+    ssl_verify_mode_cert_required_t = 2
+};
+
+struct ssl_context_t {
+    enum ssl_protocol_t protocol;
+    void *conf_p;
+    int server_side;
+    int verify_mode;
+};
+
+struct ssl_socket_t {
+    struct chan_t base;
+    void *ssl_p;
+    void *socket_p;
+};
+# 72 "/root/repo/src/inet/ssl.h"
+int ssl_module_init(void);
+# 83 "/root/repo/src/inet/ssl.h"
+int ssl_context_init(struct ssl_context_t *self_p,
+                     enum ssl_protocol_t protocol);
+# 94 "/root/repo/src/inet/ssl.h"
+int ssl_context_destroy(struct ssl_context_t *self_p);
+# 105 "/root/repo/src/inet/ssl.h"
+int ssl_context_load_cert_chain(struct ssl_context_t *self_p,
+                                const char *cert_p,
+                                const char *key_p);
+# 119 "/root/repo/src/inet/ssl.h"
+int ssl_context_load_verify_location(struct ssl_context_t *self_p,
+                                     const char *ca_certs_p);
+# 132 "/root/repo/src/inet/ssl.h"
+int ssl_context_set_verify_mode(struct ssl_context_t *self_p,
+                                enum ssl_verify_mode_t mode);
+# 152 "/root/repo/src/inet/ssl.h"
+int ssl_socket_open(struct ssl_socket_t *self_p,
+                    struct ssl_context_t *context_p,
+                    void *socket_p,
+                    int flags,
+                    const char *server_hostname_p);
+# 165 "/root/repo/src/inet/ssl.h"
+int ssl_socket_close(struct ssl_socket_t *self_p);
+# 176 "/root/repo/src/inet/ssl.h"
+ssize_t ssl_socket_write(struct ssl_socket_t *self_p,
+                         const void *buf_p,
+                         size_t size);
+# 189 "/root/repo/src/inet/ssl.h"
+ssize_t ssl_socket_read(struct ssl_socket_t *self_p,
+                        void *buf_p,
+                        size_t size);
+# 201 "/root/repo/src/inet/ssl.h"
+ssize_t ssl_socket_size(struct ssl_socket_t *self_p);
+# 210 "/root/repo/src/inet/ssl.h"
+const char *ssl_socket_get_server_hostname(struct ssl_socket_t *self_p);
+# 222 "/root/repo/src/inet/ssl.h"
+int ssl_socket_get_cipher(struct ssl_socket_t *self_p,
+                          const char **cipher_pp,
+                          const char **protocol_pp,
+                          int *number_of_secret_bits_p);
+# 293 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/inet/slip.h" 1
+# 33 "/root/repo/src/inet/slip.h"
+struct slip_t {
+    struct {
+        int is_escaped;
+        uint8_t *buf_p;
+        size_t size;
+        size_t pos;
+    } rx;
+    struct chan_t chout;
+    void *chout_p;
+};
+# 51 "/root/repo/src/inet/slip.h"
+int slip_init(struct slip_t *self_p,
+              void *buf_p,
+              size_t size,
+              void *chout_p);
+# 66 "/root/repo/src/inet/slip.h"
+ssize_t slip_input(struct slip_t *self_p,
+                   uint8_t data);
+# 76 "/root/repo/src/inet/slip.h"
+void *slip_get_output_channel(struct slip_t *self_p);
+# 296 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/http_server.h" 1
+# 39 "/root/repo/src/inet/http_server.h"
+enum http_server_request_action_t {
+    http_server_request_action_get_t = 0,
+    http_server_request_action_post_t = 1
+};
+
+
+
+
+enum http_server_content_type_t {
+    http_server_content_type_text_plain_t = 0,
+    http_server_content_type_text_html_t = 1
+};
+
+
+
+
+enum http_server_response_code_t {
+    http_server_response_code_200_ok_t = 200,
+    http_server_response_code_400_bad_request_t = 400,
+    http_server_response_code_401_unauthorized_t = 401,
+    http_server_response_code_404_not_found_t = 404
+};
+
+
+
+
+enum http_server_connection_state_t {
+    http_server_connection_state_free_t = 0,
+    http_server_connection_state_allocated_t
+};
+
+
+
+
+struct http_server_request_t {
+    enum http_server_request_action_t action;
+    char path[64];
+    struct {
+        struct {
+            int present;
+            char value[32];
+        } sec_websocket_key;
+        struct {
+            int present;
+            char value[52];
+        } content_type;
+        struct {
+            int present;
+            long value;
+        } content_length;
+        struct {
+            int present;
+            char value[64];
+        } authorization;
+        struct {
+            int present;
+            char value[20];
+        } expect;
+    } headers;
+};
+
+
+
+
+struct http_server_response_t {
+    int type;
+    enum http_server_response_code_t code;
+    struct {
+        int type;
+        const char *buf_p;
+        size_t size;
+    } content;
+};
+
+struct http_server_connection_t;
+
+typedef int (*http_server_route_callback_t)(struct http_server_connection_t *connection_p,
+                                            struct http_server_request_t *request_p);
+
+struct http_server_listener_t {
+    const char *address_p;
+    int port;
+    struct {
+        const char *name_p;
+        struct {
+            void *buf_p;
+            size_t size;
+        } stack;
+        struct thrd_t *id_p;
+    } thrd;
+    struct socket_t socket;
+};
+
+struct http_server_connection_t {
+    enum http_server_connection_state_t state;
+    struct {
+        const char *name_p;
+        struct {
+            void *buf_p;
+            size_t size;
+        } stack;
+        struct thrd_t *id_p;
+    } thrd;
+    struct http_server_t *self_p;
+    struct socket_t socket;
+
+
+
+    void *chan_p;
+    struct event_t events;
+};
+
+
+
+
+struct http_server_route_t {
+    const char *path_p;
+    http_server_route_callback_t callback;
+};
+
+struct http_server_t {
+    const char *root_path_p;
+    const struct http_server_route_t *routes_p;
+    http_server_route_callback_t on_no_route;
+    struct http_server_listener_t *listener_p;
+    struct http_server_connection_t *connections_p;
+    struct ssl_context_t *ssl_context_p;
+    struct event_t events;
+};
+# 183 "/root/repo/src/inet/http_server.h"
+int http_server_init(struct http_server_t *self_p,
+                     struct http_server_listener_t *listener_p,
+                     struct http_server_connection_t *connections_p,
+                     const char *root_path_p,
+                     const struct http_server_route_t *routes_p,
+                     http_server_route_callback_t on_no_route);
+# 201 "/root/repo/src/inet/http_server.h"
+int http_server_wrap_ssl(struct http_server_t *self_p,
+                         struct ssl_context_t *context_p);
+# 213 "/root/repo/src/inet/http_server.h"
+int http_server_start(struct http_server_t *self_p);
+# 225 "/root/repo/src/inet/http_server.h"
+int http_server_stop(struct http_server_t *self_p);
+# 242 "/root/repo/src/inet/http_server.h"
+int http_server_response_write(struct http_server_connection_t *connection_p,
+                               struct http_server_request_t *request_p,
+                               struct http_server_response_t *response_p);
+# 297 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/http_websocket_server.h" 1
+# 36 "/root/repo/src/inet/http_websocket_server.h"
+struct http_websocket_server_t {
+    struct socket_t *socket_p;
+};
+# 49 "/root/repo/src/inet/http_websocket_server.h"
+int http_websocket_server_init(struct http_websocket_server_t *self_p,
+                               struct socket_t *socket_p);
+# 61 "/root/repo/src/inet/http_websocket_server.h"
+int http_websocket_server_handshake(struct http_websocket_server_t *self_p,
+                                    struct http_server_request_t *request_p);
+# 75 "/root/repo/src/inet/http_websocket_server.h"
+ssize_t http_websocket_server_read(struct http_websocket_server_t *self_p,
+                                   int *type_p,
+                                   void *buf_p,
+                                   size_t size);
+# 90 "/root/repo/src/inet/http_websocket_server.h"
+ssize_t http_websocket_server_write(struct http_websocket_server_t *self_p,
+                                    int type,
+                                    const void *buf_p,
+                                    uint32_t size);
+# 298 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/http_websocket_client.h" 1
+# 36 "/root/repo/src/inet/http_websocket_client.h"
+struct http_websocket_client_t {
+    struct {
+        struct socket_t socket;
+        const char *host_p;
+        int port;
+    } server;
+    struct {
+        size_t left;
+    } frame;
+    const char *path_p;
+};
+# 58 "/root/repo/src/inet/http_websocket_client.h"
+int http_websocket_client_init(struct http_websocket_client_t *self_p,
+                               const char *server_p,
+                               int port,
+                               const char *path_p);
+# 70 "/root/repo/src/inet/http_websocket_client.h"
+int http_websocket_client_connect(struct http_websocket_client_t *self_p);
+# 79 "/root/repo/src/inet/http_websocket_client.h"
+int http_websocket_client_disconnect(struct http_websocket_client_t *self_p);
+# 90 "/root/repo/src/inet/http_websocket_client.h"
+ssize_t http_websocket_client_read(struct http_websocket_client_t *self_p,
+                                   void *buf_p,
+                                   size_t size);
+# 103 "/root/repo/src/inet/http_websocket_client.h"
+ssize_t http_websocket_client_write(struct http_websocket_client_t *self_p,
+                                    int type,
+                                    const void *buf_p,
+                                    uint32_t size);
+# 299 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/tftp_server.h" 1
+# 36 "/root/repo/src/inet/tftp_server.h"
+struct tftp_server_t {
+    struct inet_addr_t addr;
+    struct socket_t listener;
+    int timeout_ms;
+    const char *name_p;
+    const char *root_p;
+    void *stack_p;
+    size_t stack_size;
+    struct thrd_t *thrd_p;
+};
+# 60 "/root/repo/src/inet/tftp_server.h"
+int tftp_server_init(struct tftp_server_t *self_p,
+                     struct inet_addr_t *addr_p,
+                     int timeout_ms,
+                     const char *name_p,
+                     const char *root_p,
+                     void *stack_p,
+                     size_t stack_size);
+# 75 "/root/repo/src/inet/tftp_server.h"
+int tftp_server_start(struct tftp_server_t *self_p);
+# 300 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/mqtt_client.h" 1
+# 40 "/root/repo/src/inet/mqtt_client.h"
+enum mqtt_client_state_t {
+    mqtt_client_state_disconnected_t,
+    mqtt_client_state_connected_t,
+    mqtt_client_state_connecting_t
+};
+
+
+enum mqtt_qos_t {
+    mqtt_qos_0_t = 0,
+    mqtt_qos_1_t = 1,
+    mqtt_qos_2_t = 2
+};
+
+struct mqtt_client_t;
+# 65 "/root/repo/src/inet/mqtt_client.h"
+typedef size_t (*mqtt_on_publish_t)(struct mqtt_client_t *client_p,
+                                    const char *topic_p,
+                                    void *chin_p,
+                                    size_t size);
+# 78 "/root/repo/src/inet/mqtt_client.h"
+typedef int (*mqtt_on_error_t)(struct mqtt_client_t *client_p,
+                               int error);
+
+
+
+
+struct mqtt_string_t {
+    const void *buf_p;
+    size_t size;
+};
+
+
+
+
+struct mqtt_client_t {
+    const char *name_p;
+    struct log_object_t *log_object_p;
+    int state;
+    struct {
+        int type;
+        void *data_p;
+    } message;
+    struct {
+        void *out_p;
+        void *in_p;
+    } transport;
+    struct {
+        struct queue_t out;
+        struct queue_t in;
+    } control;
+    mqtt_on_publish_t on_publish;
+    mqtt_on_error_t on_error;
+};
+
+
+
+
+struct mqtt_application_message_t {
+    struct mqtt_string_t topic;
+    struct mqtt_string_t payload;
+    enum mqtt_qos_t qos;
+};
+
+
+
+
+struct mqtt_conn_options_t {
+
+    struct mqtt_string_t client_id;
+
+    struct mqtt_application_message_t will;
+
+    struct mqtt_string_t user_name;
+
+    struct mqtt_string_t password;
+
+
+    int keep_alive_s;
+};
+# 153 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_init(struct mqtt_client_t *self_p,
+                     const char *name_p,
+                     struct log_object_t *log_object_p,
+                     void *chout_p,
+                     void *chin_p,
+                     mqtt_on_publish_t on_publish,
+                     mqtt_on_error_t on_error);
+# 168 "/root/repo/src/inet/mqtt_client.h"
+void *mqtt_client_main(void *arg_p);
+# 185 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_connect(struct mqtt_client_t *self_p,
+                        struct mqtt_conn_options_t *options_p);
+# 195 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_disconnect(struct mqtt_client_t *self_p);
+# 205 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_ping(struct mqtt_client_t *self_p);
+# 217 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_publish(struct mqtt_client_t *self_p,
+                        struct mqtt_application_message_t *message_p);
+# 230 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_subscribe(struct mqtt_client_t *self_p,
+                          struct mqtt_application_message_t *message_p);
+# 242 "/root/repo/src/inet/mqtt_client.h"
+int mqtt_client_unsubscribe(struct mqtt_client_t *self_p,
+                            struct mqtt_application_message_t *message_p);
+# 301 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/network_interface.h" 1
+# 36 "/root/repo/src/inet/network_interface.h"
+struct network_interface_t;
+
+typedef int (*network_interface_start_t)(struct network_interface_t *netif_p);
+typedef int (*network_interface_stop_t)(struct network_interface_t *netif_p);
+typedef int (*network_interface_is_up_t)(struct network_interface_t *netif_p);
+typedef int (*network_interface_set_ip_info_t)(struct network_interface_t *netif_p,
+                                               const struct inet_if_ip_info_t *info_p);
+typedef int (*network_interface_get_ip_info_t)(struct network_interface_t *netif_p,
+                                               struct inet_if_ip_info_t *info_p);
+
+struct network_interface_t {
+    const char *name_p;
+    struct inet_if_ip_info_t info;
+    network_interface_start_t start;
+    network_interface_stop_t stop;
+    network_interface_is_up_t is_up;
+    network_interface_set_ip_info_t set_ip_info;
+    network_interface_get_ip_info_t get_ip_info;
+    void *netif_p;
+    struct network_interface_t *next_p;
+};
+# 67 "/root/repo/src/inet/network_interface.h"
+int network_interface_module_init(void);
+# 78 "/root/repo/src/inet/network_interface.h"
+int network_interface_add(struct network_interface_t *netif_p);
+# 91 "/root/repo/src/inet/network_interface.h"
+int network_interface_start(struct network_interface_t *netif_p);
+# 103 "/root/repo/src/inet/network_interface.h"
+int network_interface_stop(struct network_interface_t *netif_p);
+# 115 "/root/repo/src/inet/network_interface.h"
+int network_interface_is_up(struct network_interface_t *netif_p);
+# 125 "/root/repo/src/inet/network_interface.h"
+struct network_interface_t *network_interface_get_by_name(const char *name_p);
+# 135 "/root/repo/src/inet/network_interface.h"
+int network_interface_set_ip_info(struct network_interface_t *netif_p,
+                                  const struct inet_if_ip_info_t *info_p);
+# 146 "/root/repo/src/inet/network_interface.h"
+int network_interface_get_ip_info(struct network_interface_t *netif_p,
+                                  struct inet_if_ip_info_t *info_p);
+# 302 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/network_interface/slip.h" 1
+# 38 "/root/repo/src/inet/network_interface/slip.h"
+enum network_interface_slip_state_t {
+    NETWORK_INTERFACE_SLIP_STATE_NORMAL = 0,
+    NETWORK_INTERFACE_SLIP_STATE_ESCAPE
+};
+
+struct network_interface_slip_t {
+    enum network_interface_slip_state_t state;
+    struct {
+        struct pbuf *pbuf_p;
+        uint8_t *buf_p;
+        size_t size;
+    } frame;
+    void *chout_p;
+    struct network_interface_t network_interface;
+};
+
+
+
+
+
+
+int network_interface_slip_module_init(void);
+# 73 "/root/repo/src/inet/network_interface/slip.h"
+int network_interface_slip_init(struct network_interface_slip_t *self_p,
+                                struct inet_ip_addr_t *ipaddr_p,
+                                struct inet_ip_addr_t *netmask_p,
+                                struct inet_ip_addr_t *gateway_p,
+                                void *chout_p);
+# 90 "/root/repo/src/inet/network_interface/slip.h"
+int network_interface_slip_input(struct network_interface_slip_t *self_p,
+                                 uint8_t data);
+# 303 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/network_interface/wifi.h" 1
+# 39 "/root/repo/src/inet/network_interface/wifi.h"
+struct network_interface_wifi_t {
+    struct network_interface_t network_interface;
+    struct network_interface_wifi_driver_t *driver_p;
+    void *arg_p;
+    const char *ssid_p;
+    const char *password_p;
+    const struct inet_if_ip_info_t *info_p;
+};
+
+
+
+
+
+struct network_interface_wifi_driver_t {
+    int (*init)(void *arg_p);
+    int (*start)(void *arg_p,
+                 const char *ssid_p,
+                 const char *password_p,
+                 const struct inet_if_ip_info_t *info_p);
+    int (*stop)(void *arg_p);
+    int (*is_up)(void *arg_p);
+    int (*set_ip_info)(void *arg_p, const struct inet_if_ip_info_t *info_p);
+    int (*get_ip_info)(void *arg_p, struct inet_if_ip_info_t *info_p);
+};
+
+
+
+
+
+
+int network_interface_wifi_module_init(void);
+# 85 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_init(struct network_interface_wifi_t *self_p,
+                                const char *name_p,
+                                struct network_interface_wifi_driver_t *driver_p,
+                                void *arg_p,
+                                const char *ssid_p,
+                                const char *password_p);
+# 99 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_start(struct network_interface_wifi_t *self_p);
+# 108 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_stop(struct network_interface_wifi_t *self_p);
+# 119 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_is_up(struct network_interface_wifi_t *self_p);
+# 130 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_set_ip_info(struct network_interface_wifi_t *self_p,
+                                       const struct inet_if_ip_info_t *info_p);
+# 143 "/root/repo/src/inet/network_interface/wifi.h"
+int network_interface_wifi_get_ip_info(struct network_interface_wifi_t *self_p,
+                                       struct inet_if_ip_info_t *info_p);
+# 304 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/inet/ping.h" 1
+# 45 "/root/repo/src/inet/ping.h"
+int ping_module_init(void);
+# 62 "/root/repo/src/inet/ping.h"
+int ping_host_by_ip_address(struct inet_ip_addr_t *address_p,
+                            struct time_t *timeout_p,
+                            struct time_t *round_trip_time_p);
+# 305 "/root/repo/src/simba.h" 2
+
+# 1 "/root/repo/src/oam/soam.h" 1
+# 33 "/root/repo/src/oam/soam.h"
+struct soam_t {
+    int is_printf;
+    uint8_t transaction_id;
+    struct {
+        uint8_t *buf_p;
+        size_t size;
+        ssize_t pos;
+        struct mutex_t mutex;
+        void *chout_p;
+        uint8_t packet_index;
+        int is_log_points;
+    } tx;
+    struct chan_t stdout_chan;
+    struct chan_t log_chan;
+    struct chan_t command_chan;
+};
+# 59 "/root/repo/src/oam/soam.h"
+int soam_module_init(void);
+# 73 "/root/repo/src/oam/soam.h"
+int soam_init(struct soam_t *self_p,
+              void *buf_p,
+              size_t size,
+              void *chout_p);
+# 87 "/root/repo/src/oam/soam.h"
+int soam_input(struct soam_t *self_p,
+               uint8_t *buf_p,
+               size_t size);
+# 99 "/root/repo/src/oam/soam.h"
+ssize_t soam_write_begin(struct soam_t *self_p,
+                         int type);
+# 111 "/root/repo/src/oam/soam.h"
+ssize_t soam_write_chunk(struct soam_t *self_p,
+                         const void *buf_p,
+                         size_t size);
+# 122 "/root/repo/src/oam/soam.h"
+ssize_t soam_write_end(struct soam_t *self_p);
+# 134 "/root/repo/src/oam/soam.h"
+ssize_t soam_write(struct soam_t *self_p,
+                   int type,
+                   const void *buf_p,
+                   size_t size);
+# 154 "/root/repo/src/oam/soam.h"
+ssize_t soam_log_point(struct soam_t *self_p,
+                       far_string_t fmt_p,
+                       ...);
+# 165 "/root/repo/src/oam/soam.h"
+ssize_t soam_vlog_point(struct soam_t *self_p,
+                        far_string_t fmt_p,
+                        va_list *ap_p);
+
+
+
+
+
+
+int soam_flush(struct soam_t *self_p);
+# 185 "/root/repo/src/oam/soam.h"
+void *soam_get_log_input_channel(struct soam_t *self_p);
+# 195 "/root/repo/src/oam/soam.h"
+void *soam_get_stdout_input_channel(struct soam_t *self_p);
+# 307 "/root/repo/src/simba.h" 2
+
+
+
+
+
+
+# 1 "/root/repo/src/oam/upgrade.h" 1
+# 45 "/root/repo/src/oam/upgrade.h"
+int upgrade_module_init(void);
+
+
+
+
+
+
+
+int upgrade_bootloader_enter(void);
+
+
+
+
+
+
+int upgrade_bootloader_stay_set(void);
+
+
+
+
+
+
+int upgrade_bootloader_stay_clear(void);
+# 76 "/root/repo/src/oam/upgrade.h"
+int upgrade_bootloader_stay_get(void);
+
+
+
+
+
+
+
+int upgrade_application_enter(void);
+
+
+
+
+
+
+int upgrade_application_erase(void);
+# 105 "/root/repo/src/oam/upgrade.h"
+int upgrade_application_is_valid(int quick);
+
+
+
+
+
+
+int upgrade_binary_upload_begin(void);
+# 122 "/root/repo/src/oam/upgrade.h"
+int upgrade_binary_upload(const void *buf_p,
+                          size_t size);
+
+
+
+
+
+
+int upgrade_binary_upload_end(void);
+# 314 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/upgrade/kermit.h" 1
+# 44 "/root/repo/src/oam/upgrade/kermit.h"
+int upgrade_kermit_init(void *chin_p,
+                        void *chout_p);
+
+
+
+
+
+
+int upgrade_kermit_load_file(void);
+# 315 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/upgrade/uds.h" 1
+# 40 "/root/repo/src/oam/upgrade/uds.h"
+struct upgrade_uds_t {
+    int state;
+    void *chin_p;
+    void *chout_p;
+    struct {
+        uint8_t next_block_sequence_counter;
+    } swdl;
+};
+# 58 "/root/repo/src/oam/upgrade/uds.h"
+int upgrade_uds_init(struct upgrade_uds_t *self_p,
+                     void *chin_p,
+                     void *chout_p);
+# 69 "/root/repo/src/oam/upgrade/uds.h"
+int upgrade_uds_handle_service(struct upgrade_uds_t *self_p);
+# 78 "/root/repo/src/oam/upgrade/uds.h"
+void upgrade_uds_main(struct upgrade_uds_t *self_p);
+# 316 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/upgrade/http.h" 1
+# 43 "/root/repo/src/oam/upgrade/http.h"
+int upgrade_http_init(int port);
+
+
+
+
+
+
+int upgrade_http_start(void);
+# 317 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/oam/upgrade/tftp.h" 1
+# 45 "/root/repo/src/oam/upgrade/tftp.h"
+int upgrade_tftp_init(int port, int timeout_ms);
+
+
+
+
+
+
+int upgrade_tftp_start(void);
+# 318 "/root/repo/src/simba.h" 2
+
+
+# 1 "/root/repo/src/science/science.h" 1
+# 47 "/root/repo/src/science/science.h"
+int science_module_init(void);
+# 57 "/root/repo/src/science/science.h"
+float science_pressure_to_altitude(float pressure,
+                                   float pressure_at_sea_level);
+# 68 "/root/repo/src/science/science.h"
+float science_pressure_from_altitude(float altitude,
+                                     float pressure_at_sea_level);
+# 78 "/root/repo/src/science/science.h"
+float science_mps_to_kmph(float speed);
+# 87 "/root/repo/src/science/science.h"
+float science_mps_from_kmph(float speed);
+# 96 "/root/repo/src/science/science.h"
+float science_mps_to_knots(float speed);
+# 105 "/root/repo/src/science/science.h"
+float science_mps_from_knots(float speed);
+# 114 "/root/repo/src/science/science.h"
+float science_mps_to_mph(float speed);
+# 123 "/root/repo/src/science/science.h"
+float science_mps_from_mph(float speed);
+# 137 "/root/repo/src/science/science.h"
+int science_pressure_to_altitude_fixed_point(long pressure,
+                                             long pressure_at_sea_level,
+                                             long *altitude_p);
+# 151 "/root/repo/src/science/science.h"
+int science_pressure_from_altitude_fixed_point(long altitude,
+                                               long pressure_at_sea_level,
+                                               long *pressure_p);
+# 162 "/root/repo/src/science/science.h"
+long science_mps_to_kmph_fixed_point(long speed);
+# 171 "/root/repo/src/science/science.h"
+long science_mps_from_kmph_fixed_point(long speed);
+# 180 "/root/repo/src/science/science.h"
+long science_mps_to_knots_fixed_point(long speed);
+# 189 "/root/repo/src/science/science.h"
+long science_mps_from_knots_fixed_point(long speed);
+# 198 "/root/repo/src/science/science.h"
+long science_mps_to_mph_fixed_point(long speed);
+# 207 "/root/repo/src/science/science.h"
+long science_mps_from_mph_fixed_point(long speed);
+# 321 "/root/repo/src/simba.h" 2
+# 1 "/root/repo/src/science/math.h" 1
+# 46 "/root/repo/src/science/math.h"
+float math_radians_to_degrees(float value);
+# 55 "/root/repo/src/science/math.h"
+float math_degrees_to_radians(float value);
+# 67 "/root/repo/src/science/math.h"
+int32_t math_log2_fixed_point(uint32_t x, int precision);
+# 79 "/root/repo/src/science/math.h"
+int32_t math_ln_fixed_point(uint32_t x, int precision);
+# 91 "/root/repo/src/science/math.h"
+int32_t math_log10_fixed_point(uint32_t x, int precision);
+# 105 "/root/repo/src/science/math.h"
+int32_t math_exp2_fixed_point(int32_t x, int precision);
+# 322 "/root/repo/src/simba.h" 2
+
+# 1 "build/linux/gen/simba_gen.h" 1
+# 324 "/root/repo/src/simba.h" 2
+# 32 "/root/repo/src/collections/binary_tree.c" 2
+
+static void print_node(struct binary_tree_node_t *node_p)
+{
+    std_printf("key = %d\r\n", node_p->key);
+
+    if (node_p->left_p != 
+# 37 "/root/repo/src/collections/binary_tree.c" 3 4
+                         ((void *)0)
+# 37 "/root/repo/src/collections/binary_tree.c"
+                             ) {
+        std_printf("left: ");
+        print_node(node_p->left_p);
+    }
+
+    if (node_p->right_p != 
+# 42 "/root/repo/src/collections/binary_tree.c" 3 4
+                          ((void *)0)
+# 42 "/root/repo/src/collections/binary_tree.c"
+                              ) {
+        std_printf("right: ");
+        print_node(node_p->right_p);
+    }
+}
+
+static int node_height(struct binary_tree_node_t *node_p)
+{
+    return (node_p ? node_p->height : 0);
+}
+
+static void node_recalc(struct binary_tree_node_t *node_p)
+{
+    node_p->height = (1 + (((node_height(node_p->left_p)) > (node_height(node_p->right_p))) ? (node_height(node_p->left_p)) : (node_height(node_p->right_p)))
+                                                           );
+}
+
+static struct binary_tree_node_t *
+node_rotate_right(struct binary_tree_node_t *node_p)
+{
+    struct binary_tree_node_t *left_p = node_p->left_p;
+
+    node_p->left_p = left_p->right_p;
+    left_p->right_p = node_p;
+
+    node_recalc(node_p);
+    node_recalc(left_p);
+
+    return (left_p);
+}
+
+static struct binary_tree_node_t *
+node_rotate_left(struct binary_tree_node_t * node_p)
+{
+    struct binary_tree_node_t *right_p = node_p->right_p;
+
+    node_p->right_p = right_p->left_p;
+    right_p->left_p = node_p;
+
+    node_recalc(node_p);
+    node_recalc(right_p);
+
+    return (right_p);
+}
+
+static struct binary_tree_node_t *
+node_balance(struct binary_tree_node_t *node_p)
+{
+    node_recalc(node_p);
+
+    if ((node_height(node_p->left_p)
+         - node_height(node_p->right_p)) == 2) {
+        if (node_height(node_p->left_p->right_p)
+            > node_height(node_p->left_p->left_p)) {
+            node_p->left_p = node_rotate_left(node_p->left_p);
+        }
+
+        return (node_rotate_right(node_p));
+    } else if ((node_height(node_p->right_p)
+                - node_height(node_p->left_p)) == 2) {
+        if (node_height(node_p->right_p->left_p)
+            > node_height(node_p->right_p->right_p)) {
+            node_p->right_p = node_rotate_right(node_p->right_p);
+        }
+
+        return (node_rotate_left(node_p));
+    }
+
+    return (node_p);
+}
+
+static int node_insert(struct binary_tree_node_t **parent_pp,
+                       struct binary_tree_node_t *node_p)
+{
+    int res = 0;
+    struct binary_tree_node_t *parent_p = *parent_pp;
+
+    if (parent_p == 
+# 119 "/root/repo/src/collections/binary_tree.c" 3 4
+                   ((void *)0)
+# 119 "/root/repo/src/collections/binary_tree.c"
+                       ) {
+        *parent_pp = node_p;
+        return (0);
+    }
+
+    if (node_p->key < parent_p->key) {
+        res = node_insert(&parent_p->left_p, node_p);
+    } else if (node_p->key > parent_p->key ) {
+        res = node_insert(&parent_p->right_p, node_p);
+    } else {
+        return (-1);
+    }
+
+    *parent_pp = node_balance(parent_p);
+
+    return (res);
+}
+
+static struct binary_tree_node_t *
+node_find_min(struct binary_tree_node_t *node_p)
+{
+    if (node_p->left_p != 
+# 140 "/root/repo/src/collections/binary_tree.c" 3 4
+                         ((void *)0)
+# 140 "/root/repo/src/collections/binary_tree.c"
+                             ) {
+        return (node_find_min(node_p->left_p));
+    } else {
+        return (node_p);
+    }
+}
+
+static struct binary_tree_node_t *
+node_delete_min(struct binary_tree_node_t *node_p)
+{
+    if (node_p->left_p == 
+# 150 "/root/repo/src/collections/binary_tree.c" 3 4
+                         ((void *)0)
+# 150 "/root/repo/src/collections/binary_tree.c"
+                             ) {
+        return (node_p->right_p);
+    }
+
+    node_p->left_p = node_delete_min(node_p->left_p);
+
+    return (node_balance(node_p));
+}
+
+static int node_delete_item(struct binary_tree_node_t **node_pp,
+                            int key)
+{
+    int res = 0;
+    struct binary_tree_node_t *left_p;
+    struct binary_tree_node_t *right_p;
+    struct binary_tree_node_t *m_p;
+    struct binary_tree_node_t *node_p = *node_pp;
+
+    if (node_p == 
+# 168 "/root/repo/src/collections/binary_tree.c" 3 4
+                 ((void *)0)
+# 168 "/root/repo/src/collections/binary_tree.c"
+                     ) {
+        return (-1);
+    }
+
+    if (key < node_p->key) {
+        res = node_delete_item(&node_p->left_p, key);
+    } else if (key > node_p->key) {
+        res = node_delete_item(&node_p->right_p, key);
+    } else {
+        left_p = node_p->left_p;
+        right_p = node_p->right_p;
+
+        if (right_p == 
+# 180 "/root/repo/src/collections/binary_tree.c" 3 4
+                      ((void *)0)
+# 180 "/root/repo/src/collections/binary_tree.c"
+                          ) {
+            *node_pp = left_p;
+
+            return (0);
+        }
+
+        m_p = node_find_min(right_p);
+        m_p->right_p = node_delete_min(right_p);
+        m_p->left_p = left_p;
+
+        *node_pp = node_balance(m_p);
+
+        return (0);
+    }
+
+    *node_pp = node_balance(node_p);
+
+    return (res);
+}
+
+static struct binary_tree_node_t *
+node_search(struct binary_tree_node_t *node_p, int key)
+{
+    if (node_p == 
+# 203 "/root/repo/src/collections/binary_tree.c" 3 4
+                 ((void *)0)
+# 203 "/root/repo/src/collections/binary_tree.c"
+                     ) {
+        return (
+# 204 "/root/repo/src/collections/binary_tree.c" 3 4
+               ((void *)0)
+# 204 "/root/repo/src/collections/binary_tree.c"
+                   );
+    }
+
+    if (key < node_p->key) {
+        return node_search(node_p->left_p, key);
+    } else if (key > node_p->key) {
+        return node_search(node_p->right_p, key);
+    } else {
+        return (node_p);
+    }
+}
+
+int binary_tree_init(struct binary_tree_t *self_p)
+{
+    if (!(self_p != 
+# 218 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 218 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "218" ": ASSERT: (" "self_p != ((void *)0)" ", " "22" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return ((-22)); } };
+
+    self_p->root_p = 
+# 220 "/root/repo/src/collections/binary_tree.c" 3 4
+                    ((void *)0)
+# 220 "/root/repo/src/collections/binary_tree.c"
+                        ;
+
+    return (0);
+}
+
+int binary_tree_insert(struct binary_tree_t *self_p,
+                       struct binary_tree_node_t *node_p)
+{
+    if (!(self_p != 
+# 228 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 228 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "228" ": ASSERT: (" "self_p != ((void *)0)" ", " "22" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return ((-22)); } };
+    if (!(node_p != 
+# 229 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 229 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "229" ": ASSERT: (" "node_p != ((void *)0)" ", " "22" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return ((-22)); } };
+
+    node_p->height = 1;
+    node_p->left_p = 
+# 232 "/root/repo/src/collections/binary_tree.c" 3 4
+                    ((void *)0)
+# 232 "/root/repo/src/collections/binary_tree.c"
+                        ;
+    node_p->right_p= 
+# 233 "/root/repo/src/collections/binary_tree.c" 3 4
+                    ((void *)0)
+# 233 "/root/repo/src/collections/binary_tree.c"
+                        ;
+
+    return (node_insert(&self_p->root_p, node_p));
+}
+
+int binary_tree_delete(struct binary_tree_t *self_p,
+                       int key)
+{
+    if (!(self_p != 
+# 241 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 241 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "241" ": ASSERT: (" "self_p != ((void *)0)" ", " "22" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return ((-22)); } };
+
+    return (node_delete_item(&self_p->root_p, key));
+}
+
+struct binary_tree_node_t *
+binary_tree_search(struct binary_tree_t *self_p,
+                   int key)
+{
+    if (!(self_p != 
+# 250 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 250 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "250" ": ASSERT: (" "self_p != ((void *)0)" ", " "22" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return (
+# 250 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 250 "/root/repo/src/collections/binary_tree.c"
+   ); } };
+
+    return (node_search(self_p->root_p, key));
+}
+
+void binary_tree_print(struct binary_tree_t *self_p)
+{
+    if (!(self_p != 
+# 257 "/root/repo/src/collections/binary_tree.c" 3 4
+   ((void *)0)
+# 257 "/root/repo/src/collections/binary_tree.c"
+   )) { std_printf(__simbapp_fmtstr_begin__ "/root/repo/src/collections/binary_tree.c" ":" "257" ": ASSERT: (" "self_p != NULL" ", " "EINVAL" ") " "" "\r\n" __simbapp_fmtstr_end__); if ((1)) { sys.on_fatal_callback(22); } else { return; } };
+
+    if (self_p->root_p == 
+# 259 "/root/repo/src/collections/binary_tree.c" 3 4
+                         ((void *)0)
+# 259 "/root/repo/src/collections/binary_tree.c"
+                             ) {
+        std_printf("empty\r\n");
+    } else {
+        std_printf("root: ");
+        print_node(self_p->root_p);
+        std_printf("\r\n");
+    }
+}